@@ -11,6 +11,7 @@
 #include "catch.hpp"
 #include "re2/re2.h"
 
+#include <cmath>
 #include <fstream>
 #include <sstream>
 #include <thread>
@@ -127,26 +128,76 @@ void BenchmarkRunner::LogOutput(string message) {
 	}
 }
 
-void BenchmarkRunner::RunBenchmark(Benchmark *benchmark) {
+//! Returns the value at the given percentile (between 0 and 1) of the values
+static double Percentile(vector<double> values, double percentile) {
+	D_ASSERT(!values.empty());
+	std::sort(values.begin(), values.end());
+	auto index = idx_t(std::ceil(percentile * values.size()));
+	return values[index == 0 ? 0 : index - 1];
+}
+
+string BenchmarkRunner::RunClients(Benchmark *benchmark, BenchmarkState *state, size_t client_count,
+                                   vector<double> &latencies) {
+	vector<string> errors(client_count);
+	vector<double> client_latencies(client_count);
+	vector<std::thread> clients;
+	for (size_t client_idx = 0; client_idx < client_count; client_idx++) {
+		clients.emplace_back([&, client_idx]() {
+			Profiler profiler;
+			profiler.Start();
+			errors[client_idx] = benchmark->RunClient(state, client_idx);
+			profiler.End();
+			client_latencies[client_idx] = profiler.Elapsed();
+		});
+	}
+	for (auto &client : clients) {
+		client.join();
+	}
+	latencies.insert(latencies.end(), client_latencies.begin(), client_latencies.end());
+	for (auto &error : errors) {
+		if (!error.empty()) {
+			return error;
+		}
+	}
+	return string();
+}
+
+vector<double> BenchmarkRunner::RunBenchmarkInternal(Benchmark *benchmark, const string &display_name,
+                                                     size_t client_count) {
 	Profiler profiler;
-	auto display_name = benchmark->DisplayName();
+	vector<double> timings;
+	vector<double> latencies;
 
 	auto state = benchmark->Initialize(configuration);
+	if (client_count > 0 && !benchmark->InitializeClients(state.get(), client_count)) {
+		LogLine(StringUtil::Format("%s does not support concurrent clients: running from a single client",
+		                           benchmark->name));
+		client_count = 0;
+	}
 	auto nruns = benchmark->NRuns();
 	for (size_t i = 0; i < nruns + 1; i++) {
 		bool hotrun = i > 0;
 		if (hotrun) {
-			Log(StringUtil::Format("%s\t%d\t", benchmark->name, i));
+			Log(StringUtil::Format("%s\t%d\t", display_name, i));
 		}
 		if (hotrun && benchmark->RequireReinit()) {
 			state = benchmark->Initialize(configuration);
+			if (client_count > 0) {
+				benchmark->InitializeClients(state.get(), client_count);
+			}
 		}
 		is_active = true;
 		timeout = false;
 		std::thread interrupt_thread(sleep_thread, benchmark, state.get(), benchmark->Timeout());
 
+		string client_error;
+		vector<double> run_latencies;
 		profiler.Start();
-		benchmark->Run(state.get());
+		if (client_count > 0) {
+			client_error = RunClients(benchmark, state.get(), client_count, run_latencies);
+		} else {
+			benchmark->Run(state.get());
+		}
 		profiler.End();
 
 		is_active = false;
@@ -156,23 +207,70 @@ void BenchmarkRunner::RunBenchmark(Benchmark *benchmark) {
 			if (timeout) {
 				// write timeout
 				LogResult("TIMEOUT");
+				timings.clear();
 				break;
 			} else {
 				// write time
-				auto verify = benchmark->Verify(state.get());
+				// concurrent clients can run different queries, so only their errors are verified
+				auto verify = client_count > 0 ? client_error : benchmark->Verify(state.get());
 				if (!verify.empty()) {
 					LogResult("INCORRECT");
 					LogLine("INCORRECT RESULT: " + verify);
 					LogOutput("INCORRECT RESULT: " + verify);
+					timings.clear();
 					break;
 				} else {
 					LogResult(std::to_string(profiler.Elapsed()));
+					auto statistics = benchmark->GetRunStatistics(state.get());
+					if (!statistics.empty()) {
+						LogLine(StringUtil::Format("%s\t%d\t%s", display_name, i, statistics));
+					}
+					timings.push_back(profiler.Elapsed());
+					latencies.insert(latencies.end(), run_latencies.begin(), run_latencies.end());
 				}
 			}
 		}
 		benchmark->Cleanup(state.get());
 	}
 	benchmark->Finalize();
+	if (client_count > 0 && !timings.empty()) {
+		// report the throughput and latency percentiles of the clients
+		double total_time = 0;
+		for (auto &timing : timings) {
+			total_time += timing;
+		}
+		LogLine(StringUtil::Format("%s\tclients=%d\tthroughput=%.2f queries/s\tp50=%f\tp95=%f\tp99=%f", display_name,
+		                           client_count, latencies.size() / total_time, Percentile(latencies, 0.5),
+		                           Percentile(latencies, 0.95), Percentile(latencies, 0.99)));
+	}
+	return timings;
+}
+
+void BenchmarkRunner::RunBenchmark(Benchmark *benchmark) {
+	auto sweep = thread_counts.empty() ? benchmark->ThreadCounts() : thread_counts;
+	auto client_count = concurrency > 0 ? concurrency : benchmark->Concurrency();
+	if (sweep.empty()) {
+		RunBenchmarkInternal(benchmark, benchmark->name, client_count);
+		return;
+	}
+	// run the benchmark for every thread count, and report the speedup over the first thread count
+	auto default_threads = threads;
+	double baseline = 0;
+	for (auto thread_count : sweep) {
+		threads = thread_count;
+		auto display_name = StringUtil::Format("%s@%dt", benchmark->name, thread_count);
+		auto timings = RunBenchmarkInternal(benchmark, display_name, client_count);
+		if (timings.empty()) {
+			continue;
+		}
+		auto median = Percentile(timings, 0.5);
+		if (baseline == 0) {
+			baseline = median;
+		}
+		LogLine(StringUtil::Format("%s\tthreads=%d\tmedian=%f\tspeedup=%.2fx", benchmark->name, thread_count, median,
+		                           baseline / median));
+	}
+	threads = default_threads;
 }
 
 void BenchmarkRunner::RunBenchmarks() {
@@ -190,6 +288,10 @@ void print_help() {
 	fprintf(stderr, "              --detailed-profile     Prints detailed query profile information\n");
 	fprintf(stderr, "              --threads=n            Sets the amount of threads to use during execution (default: "
 	                "hardware concurrency)\n");
+	fprintf(stderr, "              --threads=n1,n2,...    Runs the benchmarks with each of the thread counts and "
+	                "reports the speedup\n");
+	fprintf(stderr, "              --concurrency=n        Runs the benchmarks from n concurrent clients and reports "
+	                "the throughput and latency percentiles\n");
 	fprintf(stderr, "              --out=[file]           Move benchmark output to file\n");
 	fprintf(stderr, "              --log=[file]           Move log output to file\n");
 	fprintf(stderr, "              --info                 Prints info about the benchmark\n");
@@ -237,7 +339,18 @@ void parse_arguments(const int arg_counter, char const *const *arg_values) {
 		} else if (StringUtil::StartsWith(arg, "--threads=")) {
 			// write info of benchmark
 			auto splits = StringUtil::Split(arg, '=');
-			instance.threads = Value(splits[1]).DefaultCastAs(LogicalType::UINTEGER).GetValue<uint32_t>();
+			auto counts = StringUtil::Split(splits[1], ',');
+			if (counts.size() == 1) {
+				instance.threads = Value(splits[1]).DefaultCastAs(LogicalType::UINTEGER).GetValue<uint32_t>();
+			} else {
+				for (auto &count : counts) {
+					instance.thread_counts.push_back(
+					    Value(count).DefaultCastAs(LogicalType::UINTEGER).GetValue<uint32_t>());
+				}
+			}
+		} else if (StringUtil::StartsWith(arg, "--concurrency=")) {
+			auto splits = StringUtil::Split(arg, '=');
+			instance.concurrency = Value(splits[1]).DefaultCastAs(LogicalType::UINTEGER).GetValue<uint32_t>();
 		} else if (arg == "--query") {
 			// write group of benchmark
 			instance.configuration.meta = BenchmarkMetaType::QUERY;
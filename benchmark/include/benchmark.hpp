@@ -78,6 +78,10 @@ public:
 	}
 
 	virtual string GetLogOutput(BenchmarkState *state) = 0;
+	//! Returns additional statistics of the last run (e.g. the amount of temporary file I/O), if any
+	virtual string GetRunStatistics(BenchmarkState *state) {
+		return string();
+	}
 
 	//! Whether or not Initialize() should be called once for every run or just
 	//! once
@@ -92,6 +96,23 @@ public:
 	virtual size_t Timeout() {
 		return DEFAULT_TIMEOUT;
 	}
+	//! The thread counts to run the benchmark with, if the benchmark should be run with multiple thread counts
+	virtual vector<uint32_t> ThreadCounts() {
+		return vector<uint32_t>();
+	}
+	//! The amount of concurrent clients to run the benchmark with (0 = run the benchmark from a single client)
+	virtual size_t Concurrency() {
+		return 0;
+	}
+	//! Prepare the state for the given amount of concurrent clients, returns false if the benchmark does not support
+	//! concurrent clients
+	virtual bool InitializeClients(BenchmarkState *state, size_t client_count) {
+		return false;
+	}
+	//! Run the benchmark once from the given concurrent client, returns an error message if the run failed
+	virtual string RunClient(BenchmarkState *state, size_t client_idx) {
+		return "Benchmark does not support concurrent clients";
+	}
 };
 
 } // namespace duckdb
@@ -55,6 +55,17 @@ public:
 	ofstream out_file;
 	ofstream log_file;
 	uint32_t threads = std::thread::hardware_concurrency();
+	//! The thread counts to sweep over (if empty, the thread counts of the benchmark are used, if any)
+	vector<uint32_t> thread_counts;
+	//! The amount of concurrent clients (if 0, the concurrency of the benchmark is used)
+	size_t concurrency = 0;
+
+private:
+	//! Runs the benchmark with the current thread count, and returns the timings of the hot runs. Returns an empty
+	//! vector if the benchmark timed out or produced an incorrect result.
+	vector<double> RunBenchmarkInternal(Benchmark *benchmark, const string &display_name, size_t client_count);
+	//! Runs the benchmark once from every client concurrently, and appends the latency of every client to latencies
+	string RunClients(Benchmark *benchmark, BenchmarkState *state, size_t client_count, vector<double> &latencies);
 };
 
 } // namespace duckdb
@@ -23,6 +23,8 @@ struct DuckDBBenchmarkState : public BenchmarkState {
 	DuckDB db;
 	Connection conn;
 	unique_ptr<QueryResult> result;
+	//! The connections of the concurrent clients
+	vector<unique_ptr<Connection>> clients;
 
 	DuckDBBenchmarkState(string path) : db(path.empty() ? nullptr : path.c_str()), conn(db) {
 		auto &instance = BenchmarkRunner::GetInstance();
@@ -120,10 +122,35 @@ public:
 		return profiler.ToJSON();
 	}
 
+	bool InitializeClients(BenchmarkState *state_p, size_t client_count) override {
+		if (GetQuery().empty()) {
+			// the benchmark runs custom code instead of a query
+			return false;
+		}
+		auto state = (DuckDBBenchmarkState *)state_p;
+		state->clients.clear();
+		for (size_t i = 0; i < client_count; i++) {
+			state->clients.push_back(make_unique<Connection>(state->db));
+		}
+		return true;
+	}
+
+	string RunClient(BenchmarkState *state_p, size_t client_idx) override {
+		auto state = (DuckDBBenchmarkState *)state_p;
+		auto result = state->clients[client_idx]->Query(GetQuery());
+		if (result->HasError()) {
+			return result->GetError();
+		}
+		return string();
+	}
+
 	//! Interrupt the benchmark because of a timeout
 	void Interrupt(BenchmarkState *state_p) override {
 		auto state = (DuckDBBenchmarkState *)state_p;
 		state->conn.Interrupt();
+		for (auto &client : state->clients) {
+			client->Interrupt();
+		}
 	}
 };
 
@@ -37,6 +37,7 @@ public:
 	string BenchmarkInfo() override;
 
 	string GetLogOutput(BenchmarkState *state) override;
+	string GetRunStatistics(BenchmarkState *state) override;
 
 	string DisplayName() override;
 	string Group() override;
@@ -52,6 +53,17 @@ public:
 		return require_reinit;
 	}
 
+	vector<uint32_t> ThreadCounts() override {
+		LoadBenchmark();
+		return thread_counts;
+	}
+	size_t Concurrency() override {
+		LoadBenchmark();
+		return concurrency;
+	}
+	bool InitializeClients(BenchmarkState *state, size_t client_count) override;
+	string RunClient(BenchmarkState *state, size_t client_idx) override;
+
 private:
 	string VerifyInternal(BenchmarkState *state_p, MaterializedQueryResult &result);
 
@@ -64,6 +76,8 @@ private:
 
 	std::unordered_map<string, string> queries;
 	string run_query;
+	//! The queries run by the concurrent clients (in round-robin); if empty, the clients run the run query
+	vector<string> client_queries;
 
 	string benchmark_path;
 	string data_cache;
@@ -79,6 +93,8 @@ private:
 
 	bool in_memory = true;
 	bool require_reinit = false;
+	vector<uint32_t> thread_counts;
+	size_t concurrency = 0;
 };
 
 } // namespace duckdb
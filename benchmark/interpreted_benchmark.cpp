@@ -2,10 +2,13 @@
 
 #include "benchmark_runner.hpp"
 #include "duckdb.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/extension_helper.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "test_helpers.hpp"
 
 #include <fstream>
@@ -38,6 +41,15 @@ struct InterpretedBenchmarkState : public BenchmarkState {
 	DuckDB db;
 	Connection con;
 	unique_ptr<MaterializedQueryResult> result;
+	//! The connections of the concurrent clients
+	vector<unique_ptr<Connection>> clients;
+	//! The amount of bytes written to and read from temporary files during the last run
+	idx_t temporary_written_bytes = 0;
+	idx_t temporary_read_bytes = 0;
+	//! The amount of bytes read from and written to files during the last run, and the duration of the run
+	idx_t file_read_bytes = 0;
+	idx_t file_written_bytes = 0;
+	double run_time = 0;
 
 	explicit InterpretedBenchmarkState(string path)
 	    : benchmark_config(GetBenchmarkConfig()), db(path.empty() ? nullptr : path.c_str(), benchmark_config.get()),
@@ -138,8 +150,9 @@ void InterpretedBenchmark::LoadBenchmark() {
 		}
 		// look for a command in this line
 		auto splits = StringUtil::Split(StringUtil::Lower(line), ' ');
-		if (splits[0] == "load" || splits[0] == "run" || splits[0] == "init" || splits[0] == "cleanup") {
-			if (queries.find(splits[0]) != queries.end()) {
+		if (splits[0] == "load" || splits[0] == "run" || splits[0] == "init" || splits[0] == "cleanup" ||
+		    splits[0] == "client") {
+			if (splits[0] != "client" && queries.find(splits[0]) != queries.end()) {
 				throw std::runtime_error("Multiple calls to " + splits[0] + " in the same benchmark file");
 			}
 			// load command: keep reading until we find a blank line or EOF
@@ -170,7 +183,24 @@ void InterpretedBenchmark::LoadBenchmark() {
 			if (query.empty()) {
 				throw std::runtime_error("Encountered an empty " + splits[0] + " node!");
 			}
-			queries[splits[0]] = query;
+			if (splits[0] == "client") {
+				client_queries.push_back(query);
+			} else {
+				queries[splits[0]] = query;
+			}
+		} else if (splits[0] == "threads") {
+			if (splits.size() != 2) {
+				throw std::runtime_error(
+				    reader.FormatException("threads requires a list of thread counts (e.g. threads 1,2,4)"));
+			}
+			for (auto &count : StringUtil::Split(splits[1], ',')) {
+				thread_counts.push_back(std::stoi(count));
+			}
+		} else if (splits[0] == "concurrency") {
+			if (splits.size() != 2) {
+				throw std::runtime_error(reader.FormatException("concurrency requires the amount of clients"));
+			}
+			concurrency = std::stoi(splits[1]);
 		} else if (splits[0] == "require") {
 			if (splits.size() != 2) {
 				throw std::runtime_error(reader.FormatException("require requires a single parameter"));
@@ -290,12 +320,13 @@ void InterpretedBenchmark::LoadBenchmark() {
 				if (line.empty()) {
 					break;
 				}
-				auto parameters = StringUtil::Split(line, '=');
-				if (parameters.size() != 2) {
+				// the value of the parameter can contain '=' (e.g. a query)
+				auto separator = line.find('=');
+				if (separator == string::npos || separator == 0) {
 					throw std::runtime_error(
 					    reader.FormatException("Expected a template parameter in the form of X=Y"));
 				}
-				replacement_mapping[parameters[0]] = parameters[1];
+				replacement_mapping[line.substr(0, separator)] = line.substr(separator + 1);
 			}
 			// restart the load from the template file
 			LoadBenchmark();
@@ -376,7 +407,40 @@ string InterpretedBenchmark::GetQuery() {
 
 void InterpretedBenchmark::Run(BenchmarkState *state_p) {
 	auto &state = (InterpretedBenchmarkState &)*state_p;
+	auto &buffer_manager = BufferManager::GetBufferManager(*state.db.instance);
+	auto written_start = buffer_manager.GetSpilledBytes();
+	auto read_start = buffer_manager.GetTemporaryReadBytes();
+	auto file_read_start = FileSystem::GetTotalBytesRead();
+	auto file_written_start = FileSystem::GetTotalBytesWritten();
+	Profiler profiler;
+	profiler.Start();
 	state.result = state.con.Query(run_query);
+	profiler.End();
+	state.run_time = profiler.Elapsed();
+	state.file_read_bytes = FileSystem::GetTotalBytesRead() - file_read_start;
+	state.file_written_bytes = FileSystem::GetTotalBytesWritten() - file_written_start;
+	state.temporary_written_bytes = buffer_manager.GetSpilledBytes() - written_start;
+	state.temporary_read_bytes = buffer_manager.GetTemporaryReadBytes() - read_start;
+}
+
+bool InterpretedBenchmark::InitializeClients(BenchmarkState *state_p, size_t client_count) {
+	auto &state = (InterpretedBenchmarkState &)*state_p;
+	state.clients.clear();
+	for (size_t i = 0; i < client_count; i++) {
+		state.clients.push_back(make_unique<Connection>(state.db));
+	}
+	return true;
+}
+
+string InterpretedBenchmark::RunClient(BenchmarkState *state_p, size_t client_idx) {
+	auto &state = (InterpretedBenchmarkState &)*state_p;
+	D_ASSERT(client_idx < state.clients.size());
+	auto &query = client_queries.empty() ? run_query : client_queries[client_idx % client_queries.size()];
+	auto result = state.clients[client_idx]->Query(query);
+	if (result->HasError()) {
+		return result->GetError();
+	}
+	return string();
 }
 
 void InterpretedBenchmark::Cleanup(BenchmarkState *state_p) {
@@ -496,6 +560,9 @@ string InterpretedBenchmark::Verify(BenchmarkState *state_p) {
 void InterpretedBenchmark::Interrupt(BenchmarkState *state_p) {
 	auto &state = (InterpretedBenchmarkState &)*state_p;
 	state.con.Interrupt();
+	for (auto &client : state.clients) {
+		client->Interrupt();
+	}
 }
 
 string InterpretedBenchmark::BenchmarkInfo() {
@@ -508,6 +575,29 @@ string InterpretedBenchmark::GetLogOutput(BenchmarkState *state_p) {
 	return profiler.ToJSON();
 }
 
+//! Formats the amount of bytes and the throughput (in MB/s) of the bytes over the given time
+static string FormatThroughput(idx_t bytes, double time) {
+	auto throughput = time > 0 ? double(bytes) / 1000000.0 / time : 0;
+	return StringUtil::Format("%s (%.1f MB/s)", StringUtil::BytesToHumanReadableString(bytes), throughput);
+}
+
+string InterpretedBenchmark::GetRunStatistics(BenchmarkState *state_p) {
+	auto &state = (InterpretedBenchmarkState &)*state_p;
+	vector<string> statistics;
+	// file I/O includes the temporary files
+	if (state.file_read_bytes > 0) {
+		statistics.push_back("read=" + FormatThroughput(state.file_read_bytes, state.run_time));
+	}
+	if (state.file_written_bytes > 0) {
+		statistics.push_back("written=" + FormatThroughput(state.file_written_bytes, state.run_time));
+	}
+	if (state.temporary_written_bytes > 0 || state.temporary_read_bytes > 0) {
+		statistics.push_back("temp_written=" + StringUtil::BytesToHumanReadableString(state.temporary_written_bytes));
+		statistics.push_back("temp_read=" + StringUtil::BytesToHumanReadableString(state.temporary_read_bytes));
+	}
+	return StringUtil::Join(statistics, "\t");
+}
+
 string InterpretedBenchmark::DisplayName() {
 	LoadBenchmark();
 	return display_name.empty() ? name : display_name;
@@ -0,0 +1,105 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+#include "duckdb/common/profiler.hpp"
+#include "duckdb/main/appender.hpp"
+
+using namespace duckdb;
+
+enum class AppenderShape : uint8_t { NARROW, WIDE, STRINGS };
+
+static constexpr idx_t WIDE_COLUMN_COUNT = 50;
+
+static string AppenderCreateStatement(AppenderShape shape) {
+	switch (shape) {
+	case AppenderShape::NARROW:
+		return "CREATE TABLE data(a BIGINT, b BIGINT, c BIGINT)";
+	case AppenderShape::WIDE: {
+		vector<string> columns;
+		for (idx_t c = 0; c < WIDE_COLUMN_COUNT; c++) {
+			columns.push_back("c" + to_string(c) + " DOUBLE");
+		}
+		return "CREATE TABLE data(" + StringUtil::Join(columns, ", ") + ")";
+	}
+	default:
+		return "CREATE TABLE data(id BIGINT, s1 VARCHAR, s2 VARCHAR, s3 VARCHAR)";
+	}
+}
+
+//! Appends row i of the given shape, and returns the amount of value bytes that were appended
+static idx_t AppendShapeRow(Appender &appender, AppenderShape shape, int64_t i) {
+	switch (shape) {
+	case AppenderShape::NARROW:
+		appender.Append<int64_t>(i);
+		appender.Append<int64_t>(i * 2);
+		appender.Append<int64_t>(i % 7);
+		return 3 * sizeof(int64_t);
+	case AppenderShape::WIDE:
+		for (idx_t c = 0; c < WIDE_COLUMN_COUNT; c++) {
+			appender.Append<double>(double(i) * (c + 1.5));
+		}
+		return WIDE_COLUMN_COUNT * sizeof(double);
+	default: {
+		auto s1 = "customer #" + to_string(i);
+		auto s2 = string(i % 64, 'x');
+		auto s3 = "string value " + to_string(i * 3);
+		appender.Append<int64_t>(i);
+		appender.Append<string_t>(string_t(s1));
+		appender.Append<string_t>(string_t(s2));
+		appender.Append<string_t>(string_t(s3));
+		return sizeof(int64_t) + s1.size() + s2.size() + s3.size();
+	}
+	}
+}
+
+//////////////////////////
+// APPENDER THROUGHPUT //
+//////////////////////////
+// Append tables of different shapes and report the throughput of the appended values in MB/s
+#define APPENDER_THROUGHPUT_BENCHMARK(SHAPE, ROW_COUNT)                                                                \
+	idx_t appended_bytes = 0;                                                                                          \
+	double run_time = 0;                                                                                               \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		state->conn.Query(AppenderCreateStatement(SHAPE));                                                             \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state) override {                                                          \
+		Profiler profiler;                                                                                             \
+		profiler.Start();                                                                                              \
+		idx_t bytes = 0;                                                                                               \
+		Appender appender(state->conn, "data");                                                                        \
+		for (int64_t i = 0; i < ROW_COUNT; i++) {                                                                      \
+			appender.BeginRow();                                                                                       \
+			bytes += AppendShapeRow(appender, SHAPE, i);                                                               \
+			appender.EndRow();                                                                                         \
+		}                                                                                                              \
+		appender.Close();                                                                                              \
+		profiler.End();                                                                                                \
+		appended_bytes = bytes;                                                                                        \
+		run_time = profiler.Elapsed();                                                                                 \
+	}                                                                                                                  \
+	void Cleanup(DuckDBBenchmarkState *state) override {                                                               \
+		state->conn.Query("DROP TABLE data");                                                                          \
+		Load(state);                                                                                                   \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	string GetRunStatistics(BenchmarkState *state) override {                                                          \
+		auto throughput = run_time > 0 ? double(appended_bytes) / 1000000.0 / run_time : 0;                            \
+		return StringUtil::Format("appended=%s (%.1f MB/s)",                                                          \
+		                          StringUtil::BytesToHumanReadableString(appended_bytes), throughput);                 \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return StringUtil::Format("Append %d rows using an Appender", ROW_COUNT);                                      \
+	}
+
+DUCKDB_BENCHMARK(AppenderThroughputNarrow, "[io]")
+APPENDER_THROUGHPUT_BENCHMARK(AppenderShape::NARROW, 10000000)
+FINISH_BENCHMARK(AppenderThroughputNarrow)
+
+DUCKDB_BENCHMARK(AppenderThroughputWide, "[io]")
+APPENDER_THROUGHPUT_BENCHMARK(AppenderShape::WIDE, 1000000)
+FINISH_BENCHMARK(AppenderThroughputWide)
+
+DUCKDB_BENCHMARK(AppenderThroughputStrings, "[io]")
+APPENDER_THROUGHPUT_BENCHMARK(AppenderShape::STRINGS, 2000000)
+FINISH_BENCHMARK(AppenderThroughputStrings)
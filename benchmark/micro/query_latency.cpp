@@ -0,0 +1,157 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+#include "duckdb/common/profiler.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/query_profiler.hpp"
+
+using namespace duckdb;
+
+//! The amount of times the query is executed in a single run of a latency benchmark
+static constexpr idx_t QUERY_LATENCY_ITERATIONS = 1000;
+
+struct QueryLatencyState : public DuckDBBenchmarkState {
+	explicit QueryLatencyState(string path) : DuckDBBenchmarkState(move(path)) {
+	}
+
+	//! The prepared statement, if the benchmark executes a prepared statement
+	unique_ptr<PreparedStatement> prepared;
+	//! The total time spent executing the queries in the last run
+	double run_time = 0;
+};
+
+static unique_ptr<QueryResult> RunLatencyQuery(QueryLatencyState &state, const string &query, int32_t i) {
+	if (state.prepared) {
+		vector<Value> values {Value::INTEGER(i)};
+		return state.prepared->Execute(values, false);
+	}
+	return state.conn.Query(query);
+}
+
+//! Executes the query with the profiler enabled and returns the average time spent per phase in microseconds
+static string QueryLatencyBreakdown(QueryLatencyState &state, const string &query) {
+	auto &context = *state.conn.context;
+	auto &config = ClientConfig::GetConfig(context);
+	auto enable_profiler = config.enable_profiler;
+	auto emit_profiler_output = config.emit_profiler_output;
+	config.enable_profiler = true;
+	config.emit_profiler_output = false;
+
+	// the parser runs before the profiler is started: time it separately
+	double parse_time = 0;
+	vector<string> phases;
+	unordered_map<string, double> phase_timings;
+	for (idx_t i = 0; i < QUERY_LATENCY_ITERATIONS; i++) {
+		if (!state.prepared) {
+			Profiler parse_profiler;
+			parse_profiler.Start();
+			context.ParseStatements(query);
+			parse_profiler.End();
+			parse_time += parse_profiler.Elapsed();
+		}
+		RunLatencyQuery(state, query, i);
+		auto &prev_profilers = ClientData::Get(context).query_profiler_history->GetPrevProfilers();
+		if (prev_profilers.empty()) {
+			continue;
+		}
+		for (auto &entry : prev_profilers.back().second->GetOrderedPhaseTimings()) {
+			if (entry.first.find('>') != string::npos) {
+				// only report the top-level phases
+				continue;
+			}
+			if (phase_timings.find(entry.first) == phase_timings.end()) {
+				phases.push_back(entry.first);
+			}
+			phase_timings[entry.first] += entry.second;
+		}
+	}
+	config.enable_profiler = enable_profiler;
+	config.emit_profiler_output = emit_profiler_output;
+
+	auto per_query = [](double time) {
+		return time * 1000000.0 / QUERY_LATENCY_ITERATIONS;
+	};
+	string result;
+	if (!state.prepared) {
+		result += StringUtil::Format("parser=%.2fus", per_query(parse_time));
+	}
+	for (auto &phase : phases) {
+		result += StringUtil::Format("%s%s=%.2fus", result.empty() ? "" : "\t", phase, per_query(phase_timings[phase]));
+	}
+	return result;
+}
+
+/////////////////////
+// QUERY LATENCY //
+/////////////////////
+// Execute a small query many times, and report the latency per query and the time spent in every phase of the
+// query (parsing, planning, optimizing, physical planning and initializing the executor)
+#define QUERY_LATENCY_BENCHMARK(LOAD_QUERY, QUERY, PREPARED, RESULT)                                                   \
+	unique_ptr<DuckDBBenchmarkState> CreateBenchmarkState() override {                                                 \
+		return make_unique<QueryLatencyState>(GetDatabasePath());                                                      \
+	}                                                                                                                  \
+	void Load(DuckDBBenchmarkState *state_p) override {                                                                \
+		auto state = (QueryLatencyState *)state_p;                                                                     \
+		string load_query = LOAD_QUERY;                                                                                \
+		if (!load_query.empty()) {                                                                                     \
+			state->conn.Query(load_query);                                                                             \
+		}                                                                                                              \
+		if (PREPARED) {                                                                                                \
+			state->prepared = state->conn.Prepare(QUERY);                                                              \
+		}                                                                                                              \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state_p) override {                                                        \
+		auto state = (QueryLatencyState *)state_p;                                                                     \
+		Profiler profiler;                                                                                             \
+		profiler.Start();                                                                                              \
+		for (idx_t i = 0; i < QUERY_LATENCY_ITERATIONS; i++) {                                                         \
+			state->result = RunLatencyQuery(*state, QUERY, 42);                                                        \
+		}                                                                                                              \
+		profiler.End();                                                                                                \
+		state->run_time = profiler.Elapsed();                                                                          \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		if (result->HasError()) {                                                                                      \
+			return result->GetError();                                                                                 \
+		}                                                                                                              \
+		auto &materialized = (MaterializedQueryResult &)*result;                                                       \
+		if (materialized.RowCount() != 1 || materialized.GetValue(0, 0).ToString() != #RESULT) {                       \
+			return "Incorrect result " + materialized.ToString();                                                      \
+		}                                                                                                              \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	string GetRunStatistics(BenchmarkState *state_p) override {                                                        \
+		auto state = (QueryLatencyState *)state_p;                                                                     \
+		auto latency = state->run_time * 1000000.0 / QUERY_LATENCY_ITERATIONS;                                         \
+		return StringUtil::Format("latency=%.2fus\t", latency) + QueryLatencyBreakdown(*state, QUERY);                 \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return StringUtil::Format("Execute \"%s\" %d times", QUERY, QUERY_LATENCY_ITERATIONS);                         \
+	}
+
+#define LATENCY_TABLES                                                                                                 \
+	"CREATE TABLE lookup(id BIGINT PRIMARY KEY, val BIGINT); "                                                         \
+	"INSERT INTO lookup SELECT i, i * 2 FROM range(100000) tbl(i); "                                                   \
+	"CREATE TABLE small_a AS SELECT i AS id, i % 10 AS grp FROM range(100) tbl(i); "                                   \
+	"CREATE TABLE small_b AS SELECT i AS grp, i * 3 AS val FROM range(10) tbl(i);"
+
+DUCKDB_BENCHMARK(LatencySelectConstant, "[latency]")
+QUERY_LATENCY_BENCHMARK("", "SELECT 42::BIGINT", false, 42)
+FINISH_BENCHMARK(LatencySelectConstant)
+
+DUCKDB_BENCHMARK(LatencyPointLookup, "[latency]")
+QUERY_LATENCY_BENCHMARK(LATENCY_TABLES, "SELECT val FROM lookup WHERE id = 42", false, 84)
+FINISH_BENCHMARK(LatencyPointLookup)
+
+DUCKDB_BENCHMARK(LatencyPreparedPointLookup, "[latency]")
+QUERY_LATENCY_BENCHMARK(LATENCY_TABLES, "SELECT val FROM lookup WHERE id = $1", true, 84)
+FINISH_BENCHMARK(LatencyPreparedPointLookup)
+
+DUCKDB_BENCHMARK(LatencySmallJoin, "[latency]")
+QUERY_LATENCY_BENCHMARK(LATENCY_TABLES,
+                        "SELECT SUM(val) FROM small_a JOIN small_b USING (grp) WHERE small_a.id < 50", false, 675)
+FINISH_BENCHMARK(LatencySmallJoin)
+
+DUCKDB_BENCHMARK(LatencyPreparedSmallJoin, "[latency]")
+QUERY_LATENCY_BENCHMARK(LATENCY_TABLES,
+                        "SELECT SUM(val) FROM small_a JOIN small_b USING (grp) WHERE small_a.id < $1 + 8", true, 675)
+FINISH_BENCHMARK(LatencyPreparedSmallJoin)
@@ -1,12 +1,14 @@
 #define DUCKDB_EXTENSION_MAIN
 #include "fts-extension.hpp"
 #include "fts_indexing.hpp"
+#include "fts_postings.hpp"
 #include "libstemmer.h"
 
 #include "duckdb.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/function/scalar_function.hpp"
+#include "duckdb/parser/parsed_data/create_aggregate_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_pragma_function_info.hpp"
 
@@ -52,6 +54,9 @@ void FTSExtension::Load(DuckDB &db) {
 	ScalarFunction stem_func("stem", {LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::VARCHAR, stem_function);
 	CreateScalarFunctionInfo stem_info(stem_func);
 
+	CreateAggregateFunctionInfo posting_list_info(GetFTSPostingListFunction());
+	CreateAggregateFunctionInfo bm25_topk_info(GetFTSBM25TopKFunction());
+
 	auto create_fts_index_func = PragmaFunction::PragmaCall(
 	    "create_fts_index", create_fts_index_query, {LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::VARCHAR);
 	create_fts_index_func.named_parameters["stemmer"] = LogicalType::VARCHAR;
@@ -70,6 +75,8 @@ void FTSExtension::Load(DuckDB &db) {
 	conn.BeginTransaction();
 	auto &catalog = Catalog::GetCatalog(*conn.context);
 	catalog.CreateFunction(*conn.context, &stem_info);
+	catalog.CreateFunction(*conn.context, &posting_list_info);
+	catalog.CreateFunction(*conn.context, &bm25_topk_info);
 	catalog.CreatePragmaFunction(*conn.context, &create_fts_index_info);
 	catalog.CreatePragmaFunction(*conn.context, &drop_fts_index_info);
 	conn.Commit();
@@ -140,6 +140,26 @@ static string indexing_script(const string &input_schema, const string &input_ta
             FROM %fts_schema%.docs AS docs
         );
 
+        CREATE TABLE %fts_schema%.postings AS
+        SELECT term_tf.termid,
+               term_tf.fieldid,
+               fts_posting_list(term_tf.docid, term_tf.tf, docs.len) AS postings
+        FROM (
+            SELECT termid,
+                   fieldid,
+                   docid,
+                   COUNT(*) AS tf
+            FROM %fts_schema%.terms
+            GROUP BY termid,
+                     fieldid,
+                     docid
+        ) AS term_tf
+        JOIN %fts_schema%.docs AS docs
+        ON term_tf.docid = docs.docid
+        GROUP BY term_tf.termid,
+                 term_tf.fieldid,
+                 term_tf.docid >> 16;
+
         CREATE MACRO %fts_schema%.match_bm25(docname, query_string, fields := NULL, k := 1.2, b := 0.75, conjunctive := 0) AS (
             WITH tokens AS (
                 SELECT DISTINCT stem(unnest(%fts_schema%.tokenize(query_string)), '%stemmer%') AS t
@@ -200,6 +220,46 @@ static string indexing_script(const string &input_schema, const string &input_ta
             ON  scores.docid = docs.docid
             AND docs.name = docname
         );
+
+        CREATE MACRO %fts_schema%.search(query_string, fields := NULL, top_k := 10, k := 1.2, b := 0.75, conjunctive := 0) AS TABLE
+            WITH tokens AS (
+                SELECT DISTINCT stem(unnest(%fts_schema%.tokenize(query_string)), '%stemmer%') AS t
+            ),
+            fieldids AS (
+                SELECT fieldid
+                FROM %fts_schema%.fields
+                WHERE CASE WHEN fields IS NULL THEN 1 ELSE field IN (SELECT * FROM (SELECT UNNEST(string_split(fields, ','))) AS fsq) END
+            ),
+            qpostings AS (
+                SELECT postings.termid,
+                       postings.fieldid,
+                       postings.postings,
+                       dict.df
+                FROM %fts_schema%.postings AS postings
+                JOIN %fts_schema%.dict AS dict
+                ON postings.termid = dict.termid
+                JOIN tokens
+                ON dict.term = tokens.t
+                WHERE CASE WHEN fields IS NULL THEN 1 ELSE postings.fieldid IN (SELECT * FROM fieldids) END
+            ),
+            topk AS (
+                SELECT fts_bm25_topk(qp.termid, qp.fieldid, qp.postings, qp.df, stats.num_docs, stats.avgdl::BIGINT,
+                                     qtokens.token_count, top_k::BIGINT, k::DOUBLE, b::DOUBLE, conjunctive::BOOLEAN) AS matches
+                FROM qpostings AS qp,
+                     %fts_schema%.stats AS stats,
+                     (SELECT COUNT(*) AS token_count FROM tokens) AS qtokens
+            ),
+            matches AS (
+                SELECT unnest(matches) AS match
+                FROM topk
+            )
+            SELECT docs.name AS "%input_id%",
+                   struct_extract(matches.match, 'score') AS score
+            FROM matches
+            JOIN %fts_schema%.docs AS docs
+            ON struct_extract(matches.match, 'docid') = docs.docid
+            ORDER BY score DESC,
+                     docs.docid;
     )";
 
     // we may have more than 1 input field, therefore we union over the fields, retaining information which field it came from
@@ -0,0 +1,724 @@
+#include "fts_postings.hpp"
+
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Posting list format
+//===--------------------------------------------------------------------===//
+// A posting list is stored as a BLOB that starts with the amount of blocks (uint64_t), followed by the blocks. Every
+// block holds up to FTS_POSTING_BLOCK_SIZE postings sorted by docid: a header, followed by the bitpacked docid deltas,
+// term frequencies and document lengths. The header stores the docid range of the block, so blocks can be skipped
+// without decoding them, and the maximum tf and minimum document length, which bound the score of the block.
+static constexpr idx_t FTS_POSTING_BLOCK_SIZE = 128;
+
+struct FTSPostingBlockHeader {
+	int64_t first_docid;
+	int64_t last_docid;
+	uint32_t count;
+	uint32_t max_tf;
+	uint32_t min_len;
+	bitpacking_width_t delta_width;
+	bitpacking_width_t tf_width;
+	bitpacking_width_t len_width;
+	uint8_t padding;
+};
+
+struct FTSPosting {
+	int64_t docid;
+	uint32_t tf;
+	uint32_t len;
+
+	bool operator<(const FTSPosting &other) const {
+		return docid < other.docid;
+	}
+};
+
+static void PackPostingColumn(string &target, uint32_t *values, idx_t count, bitpacking_width_t width) {
+	auto offset = target.size();
+	target.resize(offset + BitpackingPrimitives::GetRequiredSize(count, width));
+	BitpackingPrimitives::PackBuffer<uint32_t, true>((data_ptr_t)&target[offset], values, count, width);
+}
+
+static string EncodePostingList(vector<FTSPosting> &postings) {
+	std::sort(postings.begin(), postings.end());
+
+	string result(sizeof(uint64_t), '\0');
+	uint64_t block_count = 0;
+	// the buffers are padded with zeroes to a multiple of the bitpacking group size
+	uint32_t deltas[FTS_POSTING_BLOCK_SIZE];
+	uint32_t tfs[FTS_POSTING_BLOCK_SIZE];
+	uint32_t lens[FTS_POSTING_BLOCK_SIZE];
+	idx_t start = 0;
+	while (start < postings.size()) {
+		FTSPostingBlockHeader header;
+		memset(&header, 0, sizeof(header));
+		header.first_docid = postings[start].docid;
+		header.min_len = NumericLimits<uint32_t>::Maximum();
+		memset(deltas, 0, sizeof(deltas));
+		memset(tfs, 0, sizeof(tfs));
+		memset(lens, 0, sizeof(lens));
+
+		idx_t count = 0;
+		for (idx_t i = start; i < postings.size() && count < FTS_POSTING_BLOCK_SIZE; i++) {
+			auto delta = count == 0 ? 0 : uint64_t(postings[i].docid - postings[i - 1].docid);
+			if (delta > NumericLimits<uint32_t>::Maximum()) {
+				// the gap between the docids does not fit in the block: start a new block
+				break;
+			}
+			deltas[count] = uint32_t(delta);
+			tfs[count] = postings[i].tf;
+			lens[count] = postings[i].len;
+			header.last_docid = postings[i].docid;
+			header.max_tf = MaxValue<uint32_t>(header.max_tf, postings[i].tf);
+			header.min_len = MinValue<uint32_t>(header.min_len, postings[i].len);
+			count++;
+		}
+		header.count = uint32_t(count);
+		header.delta_width = BitpackingPrimitives::MinimumBitWidth<uint32_t>(deltas, count);
+		header.tf_width = BitpackingPrimitives::MinimumBitWidth<uint32_t>(tfs, count);
+		header.len_width = BitpackingPrimitives::MinimumBitWidth<uint32_t>(lens, count);
+
+		auto count_aligned = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(count);
+		result.append((const char *)&header, sizeof(header));
+		PackPostingColumn(result, deltas, count_aligned, header.delta_width);
+		PackPostingColumn(result, tfs, count_aligned, header.tf_width);
+		PackPostingColumn(result, lens, count_aligned, header.len_width);
+		block_count++;
+		start += count;
+	}
+	Store<uint64_t>(block_count, (data_ptr_t)&result[0]);
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// fts_posting_list
+//===--------------------------------------------------------------------===//
+static uint32_t ClampPostingValue(int64_t value) {
+	return uint32_t(MinValue<int64_t>(MaxValue<int64_t>(value, 0), NumericLimits<uint32_t>::Maximum()));
+}
+
+struct FTSPostingListState {
+	vector<FTSPosting> *postings;
+};
+
+static void FTSPostingListInitialize(data_ptr_t state) {
+	((FTSPostingListState *)state)->postings = nullptr;
+}
+
+static void FTSPostingListUpdate(Vector inputs[], AggregateInputData &, idx_t input_count, Vector &state_vector,
+                                 idx_t count) {
+	D_ASSERT(input_count == 3);
+	UnifiedVectorFormat sdata;
+	state_vector.ToUnifiedFormat(count, sdata);
+	UnifiedVectorFormat docid_data, tf_data, len_data;
+	inputs[0].ToUnifiedFormat(count, docid_data);
+	inputs[1].ToUnifiedFormat(count, tf_data);
+	inputs[2].ToUnifiedFormat(count, len_data);
+
+	auto states = (FTSPostingListState **)sdata.data;
+	auto docids = (int64_t *)docid_data.data;
+	auto tfs = (int64_t *)tf_data.data;
+	auto lens = (int64_t *)len_data.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto docid_idx = docid_data.sel->get_index(i);
+		auto tf_idx = tf_data.sel->get_index(i);
+		auto len_idx = len_data.sel->get_index(i);
+		if (!docid_data.validity.RowIsValid(docid_idx) || !tf_data.validity.RowIsValid(tf_idx)) {
+			continue;
+		}
+		auto state = states[sdata.sel->get_index(i)];
+		if (!state->postings) {
+			state->postings = new vector<FTSPosting>();
+		}
+		FTSPosting posting;
+		posting.docid = docids[docid_idx];
+		auto len = len_data.validity.RowIsValid(len_idx) ? lens[len_idx] : 0;
+		posting.tf = ClampPostingValue(tfs[tf_idx]);
+		posting.len = ClampPostingValue(len);
+		state->postings->push_back(posting);
+	}
+}
+
+static void FTSPostingListCombine(Vector &state_vector, Vector &combined, AggregateInputData &, idx_t count) {
+	UnifiedVectorFormat sdata;
+	state_vector.ToUnifiedFormat(count, sdata);
+	auto states = (FTSPostingListState **)sdata.data;
+	auto combined_states = FlatVector::GetData<FTSPostingListState *>(combined);
+	for (idx_t i = 0; i < count; i++) {
+		auto state = states[sdata.sel->get_index(i)];
+		if (!state->postings) {
+			continue;
+		}
+		auto target = combined_states[i];
+		if (!target->postings) {
+			target->postings = new vector<FTSPosting>();
+		}
+		target->postings->insert(target->postings->end(), state->postings->begin(), state->postings->end());
+	}
+}
+
+static void FTSPostingListFinalize(Vector &state_vector, AggregateInputData &, Vector &result, idx_t count,
+                                   idx_t offset) {
+	UnifiedVectorFormat sdata;
+	state_vector.ToUnifiedFormat(count, sdata);
+	auto states = (FTSPostingListState **)sdata.data;
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto &mask = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto state = states[sdata.sel->get_index(i)];
+		auto rid = i + offset;
+		if (!state->postings || state->postings->empty()) {
+			mask.SetInvalid(rid);
+			continue;
+		}
+		auto encoded = EncodePostingList(*state->postings);
+		result_data[rid] = StringVector::AddStringOrBlob(result, encoded.c_str(), encoded.size());
+	}
+}
+
+static void FTSPostingListDestroy(Vector &state_vector, idx_t count) {
+	auto states = FlatVector::GetData<FTSPostingListState *>(state_vector);
+	for (idx_t i = 0; i < count; i++) {
+		delete states[i]->postings;
+	}
+}
+
+AggregateFunction GetFTSPostingListFunction() {
+	return AggregateFunction("fts_posting_list", {LogicalType::BIGINT, LogicalType::BIGINT, LogicalType::BIGINT},
+	                         LogicalType::BLOB, AggregateFunction::StateSize<FTSPostingListState>,
+	                         FTSPostingListInitialize, FTSPostingListUpdate, FTSPostingListCombine,
+	                         FTSPostingListFinalize, FunctionNullHandling::SPECIAL_HANDLING, nullptr, nullptr,
+	                         FTSPostingListDestroy);
+}
+
+//===--------------------------------------------------------------------===//
+// Posting list readers
+//===--------------------------------------------------------------------===//
+//! A copy of an encoded posting list, stored 4-byte aligned so the bitpacked data can be unpacked in place
+struct FTSPostingListData {
+	explicit FTSPostingListData(string_t blob) : size(blob.GetSize()) {
+		data = unique_ptr<uint32_t[]>(new uint32_t[(size + sizeof(uint32_t) - 1) / sizeof(uint32_t)]);
+		memcpy(data.get(), blob.GetDataUnsafe(), size);
+	}
+
+	unique_ptr<uint32_t[]> data;
+	idx_t size;
+};
+
+struct FTSPostingBlock {
+	FTSPostingBlockHeader header;
+	data_ptr_t deltas;
+	data_ptr_t tfs;
+	data_ptr_t lens;
+};
+
+//! Reads the postings of a term in a single field, which can be spread over multiple posting lists with disjoint
+//! docid ranges
+class FTSPostingReader {
+public:
+	explicit FTSPostingReader(vector<unique_ptr<FTSPostingListData>> lists_p) : lists(move(lists_p)) {
+		for (auto &list : lists) {
+			auto ptr = (data_ptr_t)list->data.get();
+			auto end = ptr + list->size;
+			auto block_count = Load<uint64_t>(ptr);
+			ptr += sizeof(uint64_t);
+			for (idx_t i = 0; i < block_count; i++) {
+				if (ptr + sizeof(FTSPostingBlockHeader) > end) {
+					throw InvalidInputException("Corrupt FTS posting list");
+				}
+				FTSPostingBlock block;
+				memcpy(&block.header, ptr, sizeof(FTSPostingBlockHeader));
+				ptr += sizeof(FTSPostingBlockHeader);
+				auto count_aligned = BitpackingPrimitives::RoundUpToAlgorithmGroupSize<idx_t>(block.header.count);
+				block.deltas = ptr;
+				ptr += BitpackingPrimitives::GetRequiredSize(count_aligned, block.header.delta_width);
+				block.tfs = ptr;
+				ptr += BitpackingPrimitives::GetRequiredSize(count_aligned, block.header.tf_width);
+				block.lens = ptr;
+				ptr += BitpackingPrimitives::GetRequiredSize(count_aligned, block.header.len_width);
+				if (ptr > end || block.header.count == 0 || block.header.count > FTS_POSTING_BLOCK_SIZE) {
+					throw InvalidInputException("Corrupt FTS posting list");
+				}
+				blocks.push_back(block);
+			}
+		}
+		std::sort(blocks.begin(), blocks.end(), [](const FTSPostingBlock &a, const FTSPostingBlock &b) {
+			return a.header.first_docid < b.header.first_docid;
+		});
+	}
+
+	//! Moves the reader to the first posting with a docid >= target, returns false if there is none
+	bool Advance(int64_t target) {
+		while (block_idx < blocks.size() && blocks[block_idx].header.last_docid < target) {
+			// skip the block without decoding it
+			block_idx++;
+			decoded = false;
+			position = 0;
+		}
+		if (block_idx >= blocks.size()) {
+			return false;
+		}
+		if (!decoded) {
+			Decode(blocks[block_idx]);
+		}
+		while (docids[position] < target) {
+			position++;
+		}
+		return true;
+	}
+
+	int64_t DocId() const {
+		return docids[position];
+	}
+	uint32_t TermFrequency() const {
+		return tfs[position];
+	}
+	uint32_t DocumentLength() const {
+		return lens[position];
+	}
+
+	//! Computes the maximum tf and minimum document length over all postings
+	void GetBounds(uint32_t &max_tf, uint32_t &min_len) const {
+		max_tf = 0;
+		min_len = NumericLimits<uint32_t>::Maximum();
+		for (auto &block : blocks) {
+			max_tf = MaxValue<uint32_t>(max_tf, block.header.max_tf);
+			min_len = MinValue<uint32_t>(min_len, block.header.min_len);
+		}
+	}
+
+private:
+	void Decode(const FTSPostingBlock &block) {
+		uint32_t deltas[FTS_POSTING_BLOCK_SIZE];
+		auto count_aligned = BitpackingPrimitives::RoundUpToAlgorithmGroupSize<idx_t>(block.header.count);
+		BitpackingPrimitives::UnPackBuffer<uint32_t>((data_ptr_t)deltas, block.deltas, count_aligned,
+		                                             block.header.delta_width);
+		BitpackingPrimitives::UnPackBuffer<uint32_t>((data_ptr_t)tfs, block.tfs, count_aligned,
+		                                             block.header.tf_width);
+		BitpackingPrimitives::UnPackBuffer<uint32_t>((data_ptr_t)lens, block.lens, count_aligned,
+		                                             block.header.len_width);
+		int64_t docid = block.header.first_docid;
+		for (idx_t i = 0; i < block.header.count; i++) {
+			docid += deltas[i];
+			docids[i] = docid;
+		}
+		decoded = true;
+	}
+
+private:
+	vector<unique_ptr<FTSPostingListData>> lists;
+	vector<FTSPostingBlock> blocks;
+	idx_t block_idx = 0;
+	bool decoded = false;
+	idx_t position = 0;
+	int64_t docids[FTS_POSTING_BLOCK_SIZE];
+	uint32_t tfs[FTS_POSTING_BLOCK_SIZE];
+	uint32_t lens[FTS_POSTING_BLOCK_SIZE];
+};
+
+//===--------------------------------------------------------------------===//
+// fts_bm25_topk
+//===--------------------------------------------------------------------===//
+struct FTSQueryTerm {
+	int64_t df = 0;
+	//! The posting lists of the term, per field
+	map<int64_t, vector<unique_ptr<FTSPostingListData>>> fields;
+};
+
+struct FTSQuery {
+	map<int64_t, FTSQueryTerm> terms;
+	int64_t num_docs = 0;
+	int64_t avgdl = 0;
+	int64_t query_term_count = 0;
+	//! The amount of documents to return, or -1 to return all matching documents
+	int64_t top_k = -1;
+	double k = 1.2;
+	double b = 0.75;
+	bool conjunctive = false;
+};
+
+struct FTSBM25TopKState {
+	FTSQuery *query;
+};
+
+//! Iterates over the postings of a query term in all of the searched fields
+class FTSTermCursor {
+public:
+	//! The docid of a cursor that has no more postings
+	static constexpr const int64_t EXHAUSTED = 0x7FFFFFFFFFFFFFFF;
+
+	FTSTermCursor(FTSQueryTerm &term, const FTSQuery &query) {
+		uint32_t max_tf = 0;
+		uint32_t min_len = NumericLimits<uint32_t>::Maximum();
+		for (auto &field : term.fields) {
+			readers.push_back(make_unique<FTSPostingReader>(move(field.second)));
+			// the tf of a document is summed over the fields
+			uint32_t field_max_tf, field_min_len;
+			readers.back()->GetBounds(field_max_tf, field_min_len);
+			max_tf += field_max_tf;
+			min_len = MinValue<uint32_t>(min_len, field_min_len);
+		}
+		idf = std::log10((double(query.num_docs) - double(term.df) + 0.5) / (double(term.df) + 0.5));
+		if (query.k < 0 || query.b < 0 || query.b > 1) {
+			// the score is not monotonic in the tf and the document length: we cannot bound it
+			upper_bound = NumericLimits<double>::Maximum();
+		} else if (idf <= 0) {
+			// the term can only lower the score of a document
+			upper_bound = 0;
+		} else {
+			// the score increases with the tf and decreases with the document length
+			// add a small margin so rounding differences never prune a document that should be returned
+			upper_bound = Score(query, max_tf, min_len) * (1 + 1e-9);
+		}
+		exhausted.resize(readers.size(), false);
+		Advance(0);
+	}
+
+	//! Moves the cursor to the first document with a docid >= target
+	void Advance(int64_t target) {
+		doc = EXHAUSTED;
+		for (idx_t i = 0; i < readers.size(); i++) {
+			if (exhausted[i]) {
+				continue;
+			}
+			if (!readers[i]->Advance(target)) {
+				exhausted[i] = true;
+				continue;
+			}
+			doc = MinValue<int64_t>(doc, readers[i]->DocId());
+		}
+	}
+
+	//! The BM25 score of the term for the current document
+	double Score(const FTSQuery &query) const {
+		uint32_t tf = 0;
+		uint32_t len = 0;
+		for (idx_t i = 0; i < readers.size(); i++) {
+			if (!exhausted[i] && readers[i]->DocId() == doc) {
+				tf += readers[i]->TermFrequency();
+				len = readers[i]->DocumentLength();
+			}
+		}
+		return Score(query, tf, len);
+	}
+
+	int64_t doc;
+	double upper_bound;
+
+private:
+	double Score(const FTSQuery &query, uint32_t tf, uint32_t len) const {
+		// len / avgdl is an integer division, which matches the scores of match_bm25
+		double length_ratio = query.avgdl > 0 ? double(int64_t(len) / query.avgdl) : 0;
+		return idf * (tf * (query.k + 1) / (tf + query.k * (1 - query.b + query.b * length_ratio)));
+	}
+
+	vector<unique_ptr<FTSPostingReader>> readers;
+	vector<bool> exhausted;
+	double idf;
+};
+
+struct FTSMatch {
+	int64_t docid;
+	double score;
+
+	//! Orders matches from best to worst: by descending score, and by ascending docid for equal scores
+	bool operator<(const FTSMatch &other) const {
+		if (score != other.score) {
+			return score > other.score;
+		}
+		return docid < other.docid;
+	}
+};
+
+//! Keeps the top-k matches: the top of the queue is the worst match that is kept
+class FTSTopK {
+public:
+	explicit FTSTopK(int64_t k_p) : k(k_p) {
+	}
+
+	//! The score a document has to exceed to enter the top-k
+	double Threshold() const {
+		if (k < 0 || idx_t(k) > heap.size()) {
+			return -NumericLimits<double>::Maximum();
+		}
+		return k == 0 ? NumericLimits<double>::Maximum() : heap.top().score;
+	}
+
+	void Add(int64_t docid, double score) {
+		if (k == 0) {
+			return;
+		}
+		FTSMatch match {docid, score};
+		if (k < 0 || idx_t(k) > heap.size()) {
+			heap.push(match);
+		} else if (match < heap.top()) {
+			heap.pop();
+			heap.push(match);
+		}
+	}
+
+	vector<FTSMatch> GetMatches() {
+		vector<FTSMatch> result;
+		while (!heap.empty()) {
+			result.push_back(heap.top());
+			heap.pop();
+		}
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+private:
+	int64_t k;
+	std::priority_queue<FTSMatch> heap;
+};
+
+static void SortCursors(vector<FTSTermCursor *> &cursors) {
+	std::sort(cursors.begin(), cursors.end(),
+	          [](const FTSTermCursor *a, const FTSTermCursor *b) { return a->doc < b->doc; });
+	while (!cursors.empty() && cursors.back()->doc == FTSTermCursor::EXHAUSTED) {
+		cursors.pop_back();
+	}
+}
+
+//! Scores all documents that contain every query term
+static void SearchConjunctive(FTSQuery &query, vector<unique_ptr<FTSTermCursor>> &cursors, FTSTopK &top_k) {
+	while (true) {
+		int64_t target = 0;
+		for (auto &cursor : cursors) {
+			target = MaxValue<int64_t>(target, cursor->doc);
+		}
+		if (target == FTSTermCursor::EXHAUSTED) {
+			return;
+		}
+		bool all_match = true;
+		for (auto &cursor : cursors) {
+			if (cursor->doc < target) {
+				cursor->Advance(target);
+			}
+			if (cursor->doc != target) {
+				all_match = false;
+			}
+		}
+		if (!all_match) {
+			continue;
+		}
+		double score = 0;
+		for (auto &cursor : cursors) {
+			score += cursor->Score(query);
+			cursor->Advance(target + 1);
+		}
+		top_k.Add(target, score);
+	}
+}
+
+//! Scores the documents that contain any of the query terms using WAND: documents whose score cannot exceed the
+//! score of the current k-th best document are skipped without being scored
+static void SearchDisjunctive(FTSQuery &query, vector<unique_ptr<FTSTermCursor>> &terms, FTSTopK &top_k) {
+	vector<FTSTermCursor *> cursors;
+	for (auto &term : terms) {
+		cursors.push_back(term.get());
+	}
+	while (true) {
+		SortCursors(cursors);
+		if (cursors.empty()) {
+			return;
+		}
+		// find the pivot: the first cursor at which the upper bounds of the cursors exceed the threshold
+		auto threshold = top_k.Threshold();
+		double bound = 0;
+		idx_t pivot = cursors.size();
+		for (idx_t i = 0; i < cursors.size(); i++) {
+			bound += cursors[i]->upper_bound;
+			if (bound > threshold) {
+				pivot = i;
+				break;
+			}
+		}
+		if (pivot == cursors.size()) {
+			// no remaining document can enter the top-k
+			return;
+		}
+		auto pivot_doc = cursors[pivot]->doc;
+		if (cursors[0]->doc == pivot_doc) {
+			// all cursors before the pivot are positioned at the pivot document: score it
+			// the scores are summed in the order of the terms, so equal documents get exactly equal scores
+			double score = 0;
+			for (auto &term : terms) {
+				if (term->doc == pivot_doc) {
+					score += term->Score(query);
+				}
+			}
+			for (auto &cursor : cursors) {
+				if (cursor->doc != pivot_doc) {
+					break;
+				}
+				cursor->Advance(pivot_doc + 1);
+			}
+			top_k.Add(pivot_doc, score);
+		} else {
+			// the documents before the pivot document cannot enter the top-k: skip them
+			for (idx_t i = 0; i < pivot && cursors[i]->doc < pivot_doc; i++) {
+				cursors[i]->Advance(pivot_doc);
+			}
+		}
+	}
+}
+
+static vector<FTSMatch> SearchBM25(FTSQuery &query) {
+	FTSTopK top_k(query.top_k);
+	if (query.terms.empty()) {
+		return top_k.GetMatches();
+	}
+	if (query.conjunctive && int64_t(query.terms.size()) < query.query_term_count) {
+		// not every query term occurs in the searched fields: no document contains all of them
+		return top_k.GetMatches();
+	}
+	vector<unique_ptr<FTSTermCursor>> cursors;
+	for (auto &term : query.terms) {
+		cursors.push_back(make_unique<FTSTermCursor>(term.second, query));
+	}
+	if (query.conjunctive) {
+		SearchConjunctive(query, cursors, top_k);
+	} else {
+		SearchDisjunctive(query, cursors, top_k);
+	}
+	return top_k.GetMatches();
+}
+
+static void FTSBM25TopKInitialize(data_ptr_t state) {
+	((FTSBM25TopKState *)state)->query = nullptr;
+}
+
+static void FTSBM25TopKUpdate(Vector inputs[], AggregateInputData &, idx_t input_count, Vector &state_vector,
+                              idx_t count) {
+	D_ASSERT(input_count == 11);
+	UnifiedVectorFormat sdata;
+	state_vector.ToUnifiedFormat(count, sdata);
+	auto states = (FTSBM25TopKState **)sdata.data;
+
+	UnifiedVectorFormat input_data[11];
+	for (idx_t col = 0; col < input_count; col++) {
+		inputs[col].ToUnifiedFormat(count, input_data[col]);
+	}
+	auto get_bigint = [&](idx_t col, idx_t i, int64_t default_value) {
+		auto idx = input_data[col].sel->get_index(i);
+		return input_data[col].validity.RowIsValid(idx) ? ((int64_t *)input_data[col].data)[idx] : default_value;
+	};
+	auto get_double = [&](idx_t col, idx_t i, double default_value) {
+		auto idx = input_data[col].sel->get_index(i);
+		return input_data[col].validity.RowIsValid(idx) ? ((double *)input_data[col].data)[idx] : default_value;
+	};
+	for (idx_t i = 0; i < count; i++) {
+		auto termid_idx = input_data[0].sel->get_index(i);
+		auto postings_idx = input_data[2].sel->get_index(i);
+		if (!input_data[0].validity.RowIsValid(termid_idx) || !input_data[2].validity.RowIsValid(postings_idx)) {
+			continue;
+		}
+		auto state = states[sdata.sel->get_index(i)];
+		if (!state->query) {
+			auto query = new FTSQuery();
+			query->num_docs = get_bigint(4, i, 0);
+			query->avgdl = get_bigint(5, i, 0);
+			query->query_term_count = get_bigint(6, i, 0);
+			query->top_k = MaxValue<int64_t>(get_bigint(7, i, -1), -1);
+			query->k = get_double(8, i, 1.2);
+			query->b = get_double(9, i, 0.75);
+			auto conjunctive_idx = input_data[10].sel->get_index(i);
+			query->conjunctive = input_data[10].validity.RowIsValid(conjunctive_idx) &&
+			                     ((bool *)input_data[10].data)[conjunctive_idx];
+			state->query = query;
+		}
+		auto &term = state->query->terms[((int64_t *)input_data[0].data)[termid_idx]];
+		term.df = get_bigint(3, i, 0);
+		auto postings = ((string_t *)input_data[2].data)[postings_idx];
+		term.fields[get_bigint(1, i, 0)].push_back(make_unique<FTSPostingListData>(postings));
+	}
+}
+
+static void FTSBM25TopKCombine(Vector &state_vector, Vector &combined, AggregateInputData &, idx_t count) {
+	UnifiedVectorFormat sdata;
+	state_vector.ToUnifiedFormat(count, sdata);
+	auto states = (FTSBM25TopKState **)sdata.data;
+	auto combined_states = FlatVector::GetData<FTSBM25TopKState *>(combined);
+	for (idx_t i = 0; i < count; i++) {
+		auto state = states[sdata.sel->get_index(i)];
+		if (!state->query) {
+			continue;
+		}
+		auto target = combined_states[i];
+		if (!target->query) {
+			// the source state is destroyed after combining: take over its query
+			target->query = state->query;
+			state->query = nullptr;
+			continue;
+		}
+		for (auto &term : state->query->terms) {
+			auto &target_term = target->query->terms[term.first];
+			target_term.df = term.second.df;
+			for (auto &field : term.second.fields) {
+				auto &target_lists = target_term.fields[field.first];
+				for (auto &list : field.second) {
+					target_lists.push_back(move(list));
+				}
+			}
+		}
+	}
+}
+
+static LogicalType FTSMatchType() {
+	child_list_t<LogicalType> children;
+	children.push_back(make_pair("docid", LogicalType::BIGINT));
+	children.push_back(make_pair("score", LogicalType::DOUBLE));
+	return LogicalType::STRUCT(move(children));
+}
+
+static void FTSBM25TopKFinalize(Vector &state_vector, AggregateInputData &, Vector &result, idx_t count,
+                                idx_t offset) {
+	UnifiedVectorFormat sdata;
+	state_vector.ToUnifiedFormat(count, sdata);
+	auto states = (FTSBM25TopKState **)sdata.data;
+	auto match_type = FTSMatchType();
+	for (idx_t i = 0; i < count; i++) {
+		auto state = states[sdata.sel->get_index(i)];
+		vector<Value> matches;
+		if (state->query) {
+			for (auto &match : SearchBM25(*state->query)) {
+				child_list_t<Value> values;
+				values.push_back(make_pair("docid", Value::BIGINT(match.docid)));
+				values.push_back(make_pair("score", Value::DOUBLE(match.score)));
+				matches.push_back(Value::STRUCT(move(values)));
+			}
+		}
+		result.SetValue(i + offset, Value::LIST(match_type, move(matches)));
+	}
+}
+
+static void FTSBM25TopKDestroy(Vector &state_vector, idx_t count) {
+	auto states = FlatVector::GetData<FTSBM25TopKState *>(state_vector);
+	for (idx_t i = 0; i < count; i++) {
+		delete states[i]->query;
+	}
+}
+
+AggregateFunction GetFTSBM25TopKFunction() {
+	return AggregateFunction(
+	    "fts_bm25_topk",
+	    {LogicalType::BIGINT, LogicalType::BIGINT, LogicalType::BLOB, LogicalType::BIGINT, LogicalType::BIGINT,
+	     LogicalType::BIGINT, LogicalType::BIGINT, LogicalType::BIGINT, LogicalType::DOUBLE, LogicalType::DOUBLE,
+	     LogicalType::BOOLEAN},
+	    LogicalType::LIST(FTSMatchType()), AggregateFunction::StateSize<FTSBM25TopKState>, FTSBM25TopKInitialize,
+	    FTSBM25TopKUpdate, FTSBM25TopKCombine, FTSBM25TopKFinalize, FunctionNullHandling::SPECIAL_HANDLING, nullptr,
+	    nullptr, FTSBM25TopKDestroy);
+}
+
+} // namespace duckdb
@@ -0,0 +1,21 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// fts_postings.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/function/aggregate_function.hpp"
+
+namespace duckdb {
+
+//! fts_posting_list(docid, tf, len): encodes the postings of a term as a BLOB of bitpacked blocks
+AggregateFunction GetFTSPostingListFunction();
+//! fts_bm25_topk(termid, fieldid, postings, df, num_docs, avgdl, query_terms, top_k, k, b, conjunctive): scores the
+//! posting lists of the query terms with BM25, and returns the top_k documents as a LIST(STRUCT(docid, score))
+AggregateFunction GetFTSBM25TopKFunction();
+
+} // namespace duckdb
@@ -0,0 +1,218 @@
+#include "http_block_cache.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/to_string.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "httpfs.hpp"
+
+namespace duckdb {
+
+HTTPBlockCache::HTTPBlockCache()
+    : local_fs(FileSystem::CreateLocal()), memory_limit(0), memory_size(0), disk_limit(0), disk_size(0),
+      temporary_file_count(0) {
+}
+
+void HTTPBlockCache::Configure(const HTTPParams &params) {
+	vector<string> evicted_files;
+	{
+		lock_guard<mutex> guard(lock);
+		memory_limit = params.memory_cache_size;
+		disk_limit = params.cache_directory.empty() ? 0 : params.cache_size;
+		if (params.cache_directory != directory) {
+			// the cache moved to another directory: forget about the blocks in the previous one
+			directory = params.cache_directory;
+			disk_blocks.clear();
+			disk_lru.clear();
+			disk_size = 0;
+			if (!directory.empty()) {
+				LoadDirectory();
+			}
+		}
+		EvictMemory();
+		evicted_files = EvictDisk();
+	}
+	RemoveFiles(evicted_files);
+}
+
+bool HTTPBlockCache::Enabled() {
+	lock_guard<mutex> guard(lock);
+	return memory_limit > 0 || disk_limit > 0;
+}
+
+void HTTPBlockCache::LoadDirectory() {
+	if (!local_fs->DirectoryExists(directory)) {
+		local_fs->CreateDirectory(directory);
+		return;
+	}
+	local_fs->ListFiles(directory, [&](const string &name, bool is_directory) {
+		if (is_directory || !StringUtil::EndsWith(name, ".block")) {
+			return;
+		}
+		DiskBlock block;
+		try {
+			auto handle = local_fs->OpenFile(FileSystem::JoinPath(directory, name), FileFlags::FILE_FLAGS_READ);
+			block.size = handle->GetFileSize();
+		} catch (std::exception &ex) {
+			return;
+		}
+		disk_lru.push_back(name);
+		block.lru_position = std::prev(disk_lru.end());
+		disk_size += block.size;
+		disk_blocks[name] = move(block);
+	});
+}
+
+string HTTPBlockCache::GetKey(const string &url, const string &version, idx_t block_idx) {
+	return url + "\n" + version + "\n" + to_string(block_idx);
+}
+
+string HTTPBlockCache::GetBlockFileName(const string &key) {
+	// the full key is stored in the file as well, so that hash collisions are detected when the block is read
+	return StringUtil::Format("%016llx.block", (unsigned long long)Hash(key.c_str(), key.size()));
+}
+
+bool HTTPBlockCache::Get(const string &key, data_ptr_t buffer, idx_t size) {
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = memory_blocks.find(key);
+		if (entry != memory_blocks.end() && entry->second.size == size) {
+			memory_lru.splice(memory_lru.begin(), memory_lru, entry->second.lru_position);
+			memcpy(buffer, entry->second.data.get(), size);
+			return true;
+		}
+	}
+	if (!GetFromDisk(key, buffer, size)) {
+		return false;
+	}
+	PutInMemory(key, buffer, size);
+	return true;
+}
+
+bool HTTPBlockCache::GetFromDisk(const string &key, data_ptr_t buffer, idx_t size) {
+	auto file_name = GetBlockFileName(key);
+	string path;
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = disk_blocks.find(file_name);
+		if (entry == disk_blocks.end() || entry->second.size != sizeof(uint64_t) + key.size() + size) {
+			return false;
+		}
+		disk_lru.splice(disk_lru.begin(), disk_lru, entry->second.lru_position);
+		path = FileSystem::JoinPath(directory, file_name);
+	}
+	// the file is read without holding the lock: it might have been evicted in the meantime
+	try {
+		auto handle = local_fs->OpenFile(path, FileFlags::FILE_FLAGS_READ);
+		uint64_t key_size;
+		handle->Read(&key_size, sizeof(uint64_t));
+		if (key_size != key.size()) {
+			return false;
+		}
+		string file_key(key_size, '\0');
+		handle->Read((void *)file_key.data(), key_size);
+		if (file_key != key) {
+			return false;
+		}
+		handle->Read(buffer, size);
+		return true;
+	} catch (std::exception &ex) {
+		return false;
+	}
+}
+
+void HTTPBlockCache::Put(const string &key, const_data_ptr_t buffer, idx_t size) {
+	PutInMemory(key, buffer, size);
+	PutOnDisk(key, buffer, size);
+}
+
+void HTTPBlockCache::PutInMemory(const string &key, const_data_ptr_t buffer, idx_t size) {
+	lock_guard<mutex> guard(lock);
+	if (size > memory_limit || memory_blocks.find(key) != memory_blocks.end()) {
+		return;
+	}
+	MemoryBlock block;
+	block.data = unique_ptr<data_t[]>(new data_t[size]);
+	memcpy(block.data.get(), buffer, size);
+	block.size = size;
+	memory_lru.push_front(key);
+	block.lru_position = memory_lru.begin();
+	memory_size += size;
+	memory_blocks[key] = move(block);
+	EvictMemory();
+}
+
+void HTTPBlockCache::PutOnDisk(const string &key, const_data_ptr_t buffer, idx_t size) {
+	auto file_name = GetBlockFileName(key);
+	auto file_size = sizeof(uint64_t) + key.size() + size;
+	string path, temporary_path;
+	{
+		lock_guard<mutex> guard(lock);
+		if (file_size > disk_limit || disk_blocks.find(file_name) != disk_blocks.end()) {
+			return;
+		}
+		path = FileSystem::JoinPath(directory, file_name);
+		temporary_path = path + "." + to_string(temporary_file_count++) + ".tmp";
+	}
+	// write the block to a temporary file first, so that readers never see a partially written block
+	try {
+		auto handle =
+		    local_fs->OpenFile(temporary_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
+		uint64_t key_size = key.size();
+		handle->Write(&key_size, sizeof(uint64_t));
+		handle->Write((void *)key.data(), key.size());
+		handle->Write((void *)buffer, size);
+		handle.reset();
+		local_fs->MoveFile(temporary_path, path);
+	} catch (std::exception &ex) {
+		// failing to cache a block does not fail the read
+		return;
+	}
+	vector<string> evicted_files;
+	{
+		lock_guard<mutex> guard(lock);
+		if (disk_blocks.find(file_name) == disk_blocks.end()) {
+			disk_lru.push_front(file_name);
+			DiskBlock block;
+			block.size = file_size;
+			block.lru_position = disk_lru.begin();
+			disk_size += file_size;
+			disk_blocks[file_name] = move(block);
+		}
+		evicted_files = EvictDisk();
+	}
+	RemoveFiles(evicted_files);
+}
+
+void HTTPBlockCache::EvictMemory() {
+	while (memory_size > memory_limit) {
+		auto &key = memory_lru.back();
+		auto entry = memory_blocks.find(key);
+		memory_size -= entry->second.size;
+		memory_blocks.erase(entry);
+		memory_lru.pop_back();
+	}
+}
+
+vector<string> HTTPBlockCache::EvictDisk() {
+	vector<string> evicted_files;
+	while (disk_size > disk_limit) {
+		auto &file_name = disk_lru.back();
+		auto entry = disk_blocks.find(file_name);
+		disk_size -= entry->second.size;
+		evicted_files.push_back(FileSystem::JoinPath(directory, file_name));
+		disk_blocks.erase(entry);
+		disk_lru.pop_back();
+	}
+	return evicted_files;
+}
+
+void HTTPBlockCache::RemoveFiles(const vector<string> &files) {
+	for (auto &file : files) {
+		try {
+			local_fs->RemoveFile(file);
+		} catch (std::exception &ex) {
+		}
+	}
+}
+
+} // namespace duckdb
@@ -20,6 +20,16 @@ static void LoadInternal(DatabaseInstance &instance) {
 	// Single timeout value is used for all 4 types of timeouts, we could split it into 4 if users need that
 	config.AddExtensionOption("httpfs_timeout", "HTTP timeout read/write/connection/retry (default 30000ms)",
 	                          LogicalType::UBIGINT);
+	config.AddExtensionOption("httpfs_parallel_requests",
+	                          "Maximum number of concurrent range requests for a single large read (default 4)",
+	                          LogicalType::UBIGINT);
+	config.AddExtensionOption("httpfs_cache_directory",
+	                          "Directory in which blocks of remote files are cached (default disabled)",
+	                          LogicalType::VARCHAR);
+	config.AddExtensionOption("httpfs_cache_size", "Maximum size of the on-disk block cache (default 10GB)",
+	                          LogicalType::UBIGINT);
+	config.AddExtensionOption("httpfs_memory_cache_size",
+	                          "Maximum size of the in-memory block cache (default 0, disabled)", LogicalType::UBIGINT);
 
 	// Global S3 config
 	config.AddExtensionOption("s3_region", "S3 Region", LogicalType::VARCHAR);
@@ -29,6 +39,9 @@ static void LoadInternal(DatabaseInstance &instance) {
 	config.AddExtensionOption("s3_endpoint", "S3 Endpoint (default 's3.amazonaws.com')", LogicalType::VARCHAR);
 	config.AddExtensionOption("s3_url_style", "S3 url style ('vhost' (default) or 'path')", LogicalType::VARCHAR);
 	config.AddExtensionOption("s3_use_ssl", "S3 use SSL (default true)", LogicalType::BOOLEAN);
+	config.AddExtensionOption("s3_list_cache_ttl",
+	                          "Seconds that the results of S3 listings are reused by globs (default 0: disabled)",
+	                          LogicalType::UBIGINT);
 
 	// S3 Uploader config
 	config.AddExtensionOption("s3_uploader_max_filesize",
@@ -36,7 +49,7 @@ static void LoadInternal(DatabaseInstance &instance) {
 	config.AddExtensionOption("s3_uploader_max_parts_per_file",
 	                          "S3 Uploader max parts per file (between 1 and 10000, default 10000)",
 	                          LogicalType::UBIGINT);
-	config.AddExtensionOption("s3_uploader_thread_limit", "S3 Uploader global thread limit (default 50)",
+	config.AddExtensionOption("s3_uploader_thread_limit", "S3 Uploader thread limit per file (default 50)",
 	                          LogicalType::UBIGINT);
 }
 
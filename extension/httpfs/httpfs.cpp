@@ -8,6 +8,7 @@
 #define CPPHTTPLIB_OPENSSL_SUPPORT
 #include "httplib.hpp"
 
+#include <exception>
 #include <map>
 
 namespace duckdb {
@@ -22,6 +23,10 @@ static unique_ptr<duckdb_httplib_openssl::Headers> initialize_http_headers(Heade
 
 HTTPParams HTTPParams::ReadFrom(FileOpener *opener) {
 	uint64_t timeout;
+	uint64_t parallel_requests;
+	string cache_directory;
+	uint64_t cache_size;
+	uint64_t memory_cache_size;
 	Value value;
 
 	if (opener->TryGetCurrentSetting("http_timeout", value)) {
@@ -29,8 +34,26 @@ HTTPParams HTTPParams::ReadFrom(FileOpener *opener) {
 	} else {
 		timeout = DEFAULT_TIMEOUT;
 	}
+	if (opener->TryGetCurrentSetting("httpfs_parallel_requests", value)) {
+		parallel_requests = value.GetValue<uint64_t>();
+	} else {
+		parallel_requests = DEFAULT_PARALLEL_REQUESTS;
+	}
+	if (opener->TryGetCurrentSetting("httpfs_cache_directory", value) && !value.IsNull()) {
+		cache_directory = value.ToString();
+	}
+	if (opener->TryGetCurrentSetting("httpfs_cache_size", value)) {
+		cache_size = value.GetValue<uint64_t>();
+	} else {
+		cache_size = DEFAULT_CACHE_SIZE;
+	}
+	if (opener->TryGetCurrentSetting("httpfs_memory_cache_size", value)) {
+		memory_cache_size = value.GetValue<uint64_t>();
+	} else {
+		memory_cache_size = 0;
+	}
 
-	return {timeout};
+	return {timeout, parallel_requests, cache_directory, cache_size, memory_cache_size};
 }
 
 void HTTPFileSystem::ParseUrl(string &url, string &path_out, string &proto_host_port_out) {
@@ -57,7 +80,7 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::PostRequest(FileHandle &handle, stri
 	string path, proto_host_port;
 	ParseUrl(url, path, proto_host_port);
 	auto headers = initialize_http_headers(header_map);
-	auto client = GetClient(hfs.http_params, proto_host_port.c_str()); // POST requests use fresh connection
+	auto client = client_cache.GetClient(hfs.http_params, proto_host_port);
 
 	// We use a custom Request method here, because there is no Post call with a contentreceiver in httplib
 	idx_t out_offset = 0;
@@ -84,6 +107,7 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::PostRequest(FileHandle &handle, stri
 	if (res.error() != duckdb_httplib_openssl::Error::Success) {
 		throw std::runtime_error("HTTP POST error on '" + url + "' (Error code " + to_string((int)res.error()) + ")");
 	}
+	client_cache.StoreClient(proto_host_port, move(client));
 	return make_unique<ResponseWrapper>(res.value());
 }
 
@@ -99,19 +123,49 @@ unique_ptr<duckdb_httplib_openssl::Client> HTTPFileSystem::GetClient(const HTTPP
 	return client;
 }
 
+unique_ptr<duckdb_httplib_openssl::Client> HTTPClientCache::GetClient(const HTTPParams &http_params,
+                                                                      const string &proto_host_port) {
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = idle_clients.find(proto_host_port);
+		if (entry != idle_clients.end() && !entry->second.empty()) {
+			auto client = move(entry->second.back());
+			entry->second.pop_back();
+			// the client might have been created by a handle with different settings
+			client->set_write_timeout(http_params.timeout);
+			client->set_read_timeout(http_params.timeout);
+			client->set_connection_timeout(http_params.timeout);
+			return client;
+		}
+	}
+	return HTTPFileSystem::GetClient(http_params, proto_host_port.c_str());
+}
+
+void HTTPClientCache::StoreClient(const string &proto_host_port, unique_ptr<duckdb_httplib_openssl::Client> client) {
+	if (!client || proto_host_port.empty()) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	auto &clients = idle_clients[proto_host_port];
+	if (clients.size() < MAX_IDLE_CLIENTS_PER_HOST) {
+		clients.push_back(move(client));
+	}
+}
+
 unique_ptr<ResponseWrapper> HTTPFileSystem::PutRequest(FileHandle &handle, string url, HeaderMap header_map,
                                                        char *buffer_in, idx_t buffer_in_len) {
 	auto &hfs = (HTTPFileHandle &)handle;
 	string path, proto_host_port;
 	ParseUrl(url, path, proto_host_port);
-	auto client =
-	    GetClient(hfs.http_params, proto_host_port.c_str()); // Put requests use fresh connection for parallel uploads
+	// parallel uploads each take their own connection from the client cache
+	auto client = client_cache.GetClient(hfs.http_params, proto_host_port);
 	auto headers = initialize_http_headers(header_map);
 
 	auto res = client->Put(path.c_str(), *headers, buffer_in, buffer_in_len, "application/octet-stream");
 	if (res.error() != duckdb_httplib_openssl::Error::Success) {
 		throw std::runtime_error("HTTP PUT error on '" + url + "' (Error code " + to_string((int)res.error()) + ")");
 	}
+	client_cache.StoreClient(proto_host_port, move(client));
 	return make_unique<ResponseWrapper>(res.value());
 }
 
@@ -129,11 +183,15 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::HeadRequest(FileHandle &handle, stri
 }
 
 unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle, string url, HeaderMap header_map,
-                                                            idx_t file_offset, char *buffer_out, idx_t buffer_out_len) {
+                                                            idx_t file_offset, char *buffer_out, idx_t buffer_out_len,
+                                                            unique_ptr<duckdb_httplib_openssl::Client> &client) {
 	auto &hfs = (HTTPFileHandle &)handle;
 	string path, proto_host_port;
 	ParseUrl(url, path, proto_host_port);
 	auto headers = initialize_http_headers(header_map);
+	if (!client) {
+		client = client_cache.GetClient(hfs.http_params, proto_host_port);
+	}
 
 	// send the Range header to read only subset of file
 	string range_expr = "bytes=" + to_string(file_offset) + "-" + to_string(file_offset + buffer_out_len - 1);
@@ -144,7 +202,7 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 	idx_t max_tries = 2;
 
 	while (true) {
-		auto res = hfs.http_client->Get(
+		auto res = client->Get(
 		    path.c_str(), *headers,
 		    [&](const duckdb_httplib_openssl::Response &response) {
 			    if (response.status >= 400) {
@@ -175,7 +233,7 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 
 			if (res.error() == duckdb_httplib_openssl::Error::Read) {
 				tries += 1;
-				hfs.http_client = GetClient(hfs.http_params, proto_host_port.c_str());
+				client = GetClient(hfs.http_params, proto_host_port.c_str());
 			}
 
 			if (tries >= max_tries) {
@@ -216,7 +274,19 @@ unique_ptr<FileHandle> HTTPFileSystem::OpenFile(const string &path, uint8_t flag
 	}
 
 	auto handle = CreateHandle(stripped_path, query_param, flags, lock, compression, opener);
-	handle->Initialize();
+	auto res = handle->Initialize();
+	if ((flags & FileFlags::FILE_FLAGS_READ) && opener) {
+		block_cache.Configure(handle->http_params);
+		if (block_cache.Enabled()) {
+			// blocks are only cached for files of which we can tell whether or not they changed
+			auto etag = res->headers.find("ETag");
+			if (etag != res->headers.end() && !etag->second.empty()) {
+				handle->cache_version = etag->second;
+			} else if (!res->headers["Last-Modified"].empty()) {
+				handle->cache_version = res->headers["Last-Modified"] + "/" + to_string(handle->length);
+			}
+		}
+	}
 	return move(handle);
 }
 
@@ -232,7 +302,7 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 	// Don't buffer when DirectIO is set.
 	if (hfh.flags & FileFlags::FILE_FLAGS_DIRECT_IO && to_read > 0) {
-		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
+		ReadRemote(hfh, location, (char *)buffer, to_read);
 		hfh.buffer_available = 0;
 		hfh.buffer_idx = 0;
 		hfh.file_offset = location + nr_bytes;
@@ -269,14 +339,13 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 			// Bypass buffer if we read more than buffer size
 			if (to_read > new_buffer_available) {
-				GetRangeRequest(hfh, hfh.path, {}, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
+				ReadRemote(hfh, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
 				hfh.buffer_available = 0;
 				hfh.buffer_idx = 0;
 				hfh.file_offset += to_read;
 				break;
 			} else {
-				GetRangeRequest(hfh, hfh.path, {}, hfh.file_offset, (char *)hfh.read_buffer.get(),
-				                new_buffer_available);
+				ReadRemote(hfh, hfh.file_offset, (char *)hfh.read_buffer.get(), new_buffer_available);
 				hfh.buffer_available = new_buffer_available;
 				hfh.buffer_idx = 0;
 				hfh.buffer_start = hfh.file_offset;
@@ -286,6 +355,138 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	}
 }
 
+void HTTPFileSystem::ReadRemote(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t nr_bytes) {
+	if (hfh.cache_version.empty()) {
+		ReadRange(hfh, location, buffer, nr_bytes);
+	} else {
+		ReadCachedRange(hfh, location, buffer, nr_bytes);
+	}
+}
+
+void HTTPFileSystem::ReadCachedRange(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t nr_bytes) {
+	const auto block_size = HTTPBlockCache::BLOCK_SIZE;
+	auto end = location + nr_bytes;
+	auto block_idx = location / block_size;
+	auto end_block_idx = (end + block_size - 1) / block_size;
+	auto block_buffer = unique_ptr<data_t[]>(new data_t[block_size]);
+	unique_ptr<data_t[]> missing_buffer;
+	// copies the part of the block that overlaps with the requested range into the result
+	auto copy_block = [&](idx_t idx, const_data_ptr_t block_data) {
+		auto block_start = idx * block_size;
+		auto copy_start = MaxValue<idx_t>(block_start, location);
+		auto copy_end = MinValue<idx_t>(block_start + block_size, end);
+		memcpy(buffer + (copy_start - location), block_data + (copy_start - block_start), copy_end - copy_start);
+	};
+	// reads the block with the given index from the cache into the block buffer
+	auto get_cached_block = [&](idx_t idx) {
+		auto block_len = MinValue<idx_t>(block_size, hfh.length - idx * block_size);
+		return block_cache.Get(HTTPBlockCache::GetKey(hfh.path, hfh.cache_version, idx), block_buffer.get(),
+		                       block_len);
+	};
+	while (block_idx < end_block_idx) {
+		auto block_start = block_idx * block_size;
+		if (get_cached_block(block_idx)) {
+			copy_block(block_idx, block_buffer.get());
+			block_idx++;
+			continue;
+		}
+		// request the blocks up to the next cached one at once, so large reads are still split into parallel requests
+		auto missing_end_idx = block_idx + 1;
+		while (missing_end_idx < end_block_idx && !get_cached_block(missing_end_idx)) {
+			missing_end_idx++;
+		}
+		auto missing_len = MinValue<idx_t>(missing_end_idx * block_size, hfh.length) - block_start;
+		missing_buffer = unique_ptr<data_t[]>(new data_t[missing_len]);
+		ReadRange(hfh, block_start, (char *)missing_buffer.get(), missing_len);
+		for (; block_idx < missing_end_idx; block_idx++) {
+			auto offset = block_idx * block_size - block_start;
+			auto len = MinValue<idx_t>(block_size, missing_len - offset);
+			block_cache.Put(HTTPBlockCache::GetKey(hfh.path, hfh.cache_version, block_idx),
+			                missing_buffer.get() + offset, len);
+			copy_block(block_idx, missing_buffer.get() + offset);
+		}
+		if (missing_end_idx < end_block_idx) {
+			// the block that ended the run of missing blocks was cached: it is in the block buffer
+			copy_block(block_idx, block_buffer.get());
+			block_idx++;
+		}
+	}
+}
+
+void HTTPFileSystem::ReadRange(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t nr_bytes) {
+	if (nr_bytes < 2 * HTTPFileHandle::MIN_PARALLEL_REQUEST_LEN || hfh.http_params.parallel_requests <= 1) {
+		GetRangeRequest(hfh, hfh.path, {}, location, buffer, nr_bytes, hfh.http_client);
+		return;
+	}
+	ReadRangesConcurrently(hfh, {FileReadRange {(data_ptr_t)buffer, nr_bytes, location}});
+}
+
+void HTTPFileSystem::ReadRanges(FileHandle &handle, const vector<FileReadRange> &ranges) {
+	auto &hfh = (HTTPFileHandle &)handle;
+	for (auto &range : ranges) {
+		if (range.location + range.nr_bytes > hfh.length) {
+			throw std::runtime_error("out of file");
+		}
+	}
+	if (!hfh.cache_version.empty() || ranges.size() <= 1) {
+		// cached reads go block by block, large missing runs of blocks are still requested concurrently
+		FileSystem::ReadRanges(handle, ranges);
+		return;
+	}
+	ReadRangesConcurrently(hfh, ranges);
+}
+
+void HTTPFileSystem::ReadRangesConcurrently(HTTPFileHandle &hfh, const vector<FileReadRange> &ranges) {
+	auto parallel_requests = MaxValue<idx_t>(hfh.http_params.parallel_requests, 1);
+	idx_t total_bytes = 0;
+	for (auto &range : ranges) {
+		total_bytes += range.nr_bytes;
+	}
+	auto part_size = MaxValue<idx_t>(HTTPFileHandle::MIN_PARALLEL_REQUEST_LEN,
+	                                 (total_bytes + parallel_requests - 1) / parallel_requests);
+	vector<FileReadRange> parts;
+	for (auto &range : ranges) {
+		for (idx_t offset = 0; offset < range.nr_bytes; offset += part_size) {
+			auto part_len = MinValue<idx_t>(part_size, range.nr_bytes - offset);
+			parts.push_back(FileReadRange {range.buffer + offset, part_len, range.location + offset});
+		}
+	}
+	auto worker_count = MinValue<idx_t>(parallel_requests, parts.size());
+	if (worker_count == 0) {
+		return;
+	}
+	if (hfh.parallel_clients.size() < worker_count - 1) {
+		hfh.parallel_clients.resize(worker_count - 1);
+	}
+	// every worker requests the next part that is not taken yet over its own connection, until all parts are read.
+	// the first worker is this thread, the others are helper threads
+	atomic<idx_t> next_part(0);
+	vector<std::exception_ptr> errors(worker_count);
+	auto read_parts = [&](idx_t worker_idx, unique_ptr<duckdb_httplib_openssl::Client> &client) {
+		try {
+			for (auto part_idx = next_part++; part_idx < parts.size(); part_idx = next_part++) {
+				auto &part = parts[part_idx];
+				GetRangeRequest(hfh, hfh.path, {}, part.location, (char *)part.buffer, part.nr_bytes, client);
+			}
+		} catch (...) {
+			errors[worker_idx] = std::current_exception();
+		}
+	};
+	vector<thread> worker_threads;
+	for (idx_t worker_idx = 1; worker_idx < worker_count; worker_idx++) {
+		worker_threads.emplace_back(read_parts, worker_idx, std::ref(hfh.parallel_clients[worker_idx - 1]));
+	}
+	read_parts(0, hfh.http_client);
+	for (auto &worker_thread : worker_threads) {
+		worker_thread.join();
+	}
+	for (auto &error : errors) {
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+}
+
 int64_t HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &hfh = (HTTPFileHandle &)handle;
 	idx_t max_read = hfh.length - hfh.file_offset;
@@ -388,7 +589,8 @@ unique_ptr<ResponseWrapper> HTTPFileHandle::Initialize() {
 void HTTPFileHandle::InitializeClient() {
 	string path_out, proto_host_port;
 	HTTPFileSystem::ParseUrl(path, path_out, proto_host_port);
-	http_client = HTTPFileSystem::GetClient(this->http_params, proto_host_port.c_str());
+	client_host = proto_host_port;
+	http_client = ((HTTPFileSystem &)file_system).client_cache.GetClient(this->http_params, client_host);
 }
 
 ResponseWrapper::ResponseWrapper(duckdb_httplib_openssl::Response &res) {
@@ -399,5 +601,12 @@ ResponseWrapper::ResponseWrapper(duckdb_httplib_openssl::Response &res) {
 	}
 }
 
-HTTPFileHandle::~HTTPFileHandle() = default;
+HTTPFileHandle::~HTTPFileHandle() {
+	// hand the connections back, so that the next file on the same host does not have to set up new ones
+	auto &client_cache = ((HTTPFileSystem &)file_system).client_cache;
+	client_cache.StoreClient(client_host, move(http_client));
+	for (auto &client : parallel_clients) {
+		client_cache.StoreClient(client_host, move(client));
+	}
+}
 } // namespace duckdb
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+
+struct HTTPParams;
+
+//! The HTTPBlockCache caches fixed-size blocks of remote files, keyed on the URL, the version (ETag) of the file and
+//! the offset of the block. Blocks are kept in memory and/or in files in a local directory, both with a size limit
+//! and LRU eviction. The cache belongs to the file system, so it is shared by all connections to the database, and
+//! the blocks on disk are picked up again when the database is restarted.
+class HTTPBlockCache {
+public:
+	constexpr static idx_t BLOCK_SIZE = 1 << 20; // 1 MiB
+
+	HTTPBlockCache();
+
+public:
+	//! Sets the directory and the size limits of the cache from the parameters of a newly opened file
+	void Configure(const HTTPParams &params);
+	//! Whether or not either the in-memory or the on-disk cache is enabled
+	bool Enabled();
+
+	//! Returns the key of the block at the given index of a remote file
+	static string GetKey(const string &url, const string &version, idx_t block_idx);
+	//! Copies the cached block with the given key into the buffer. Returns false if the block is not cached
+	bool Get(const string &key, data_ptr_t buffer, idx_t size);
+	//! Adds the block with the given key to the cache
+	void Put(const string &key, const_data_ptr_t buffer, idx_t size);
+
+private:
+	struct MemoryBlock {
+		unique_ptr<data_t[]> data;
+		idx_t size;
+		list<string>::iterator lru_position;
+	};
+	struct DiskBlock {
+		idx_t size;
+		list<string>::iterator lru_position;
+	};
+
+	//! Registers the blocks that were written to the cache directory before
+	void LoadDirectory();
+	string GetBlockFileName(const string &key);
+	bool GetFromDisk(const string &key, data_ptr_t buffer, idx_t size);
+	void PutInMemory(const string &key, const_data_ptr_t buffer, idx_t size);
+	void PutOnDisk(const string &key, const_data_ptr_t buffer, idx_t size);
+	//! Evicts the least recently used blocks until the blocks in memory fit the memory limit
+	void EvictMemory();
+	//! Evicts the least recently used blocks until the blocks on disk fit the disk limit, returns the files to remove
+	vector<string> EvictDisk();
+	void RemoveFiles(const vector<string> &files);
+
+	unique_ptr<FileSystem> local_fs;
+	mutex lock;
+
+	idx_t memory_limit;
+	idx_t memory_size;
+	//! The blocks in memory, and their keys ordered from most to least recently used
+	unordered_map<string, MemoryBlock> memory_blocks;
+	list<string> memory_lru;
+
+	string directory;
+	idx_t disk_limit;
+	idx_t disk_size;
+	//! The block files in the cache directory, and their names ordered from most to least recently used
+	unordered_map<string, DiskBlock> disk_blocks;
+	list<string> disk_lru;
+	//! Used to give the files that blocks are written to before they are moved into place a unique name
+	atomic<idx_t> temporary_file_count;
+};
+
+} // namespace duckdb
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
+#include "http_block_cache.hpp"
 
 namespace duckdb_httplib_openssl {
 struct Response;
@@ -25,8 +27,18 @@ public:
 
 struct HTTPParams {
 	static constexpr uint64_t DEFAULT_TIMEOUT = 30000; // 30 sec
+	static constexpr uint64_t DEFAULT_PARALLEL_REQUESTS = 4;
+	static constexpr uint64_t DEFAULT_CACHE_SIZE = 10ULL << 30; // 10 GiB
 
 	uint64_t timeout;
+	//! The maximum number of concurrent range requests that a single large read is split up into
+	uint64_t parallel_requests;
+	//! The directory of the on-disk block cache (disabled if empty)
+	string cache_directory;
+	//! The maximum size of the on-disk block cache
+	uint64_t cache_size;
+	//! The maximum size of the in-memory block cache (disabled if 0)
+	uint64_t memory_cache_size;
 
 	static HTTPParams ReadFrom(FileOpener *opener);
 };
@@ -40,6 +52,9 @@ public:
 
 	// We keep an http client stored for connection reuse with keep-alive headers
 	unique_ptr<duckdb_httplib_openssl::Client> http_client;
+	// The protocol, host and port that the clients of this handle connect to. The clients are handed back to the
+	// client cache of the file system when the handle is destroyed
+	string client_host;
 
 	const HTTPParams http_params;
 
@@ -47,6 +62,8 @@ public:
 	uint8_t flags;
 	idx_t length;
 	time_t last_modified;
+	// The version of the file that the cached blocks have to match (the ETag), or empty if the file is not cached
+	string cache_version;
 
 	// Read info
 	idx_t buffer_available;
@@ -59,6 +76,11 @@ public:
 	unique_ptr<data_t[]> read_buffer;
 	constexpr static idx_t READ_BUFFER_LEN = 1000000;
 
+	// Reads larger than this are split up into concurrent range requests of at least this size
+	constexpr static idx_t MIN_PARALLEL_REQUEST_LEN = 1 << 21; // 2 MiB
+	// The connections for the concurrent range requests, these are kept for connection reuse as well
+	vector<unique_ptr<duckdb_httplib_openssl::Client>> parallel_clients;
+
 public:
 	void Close() override {
 	}
@@ -67,6 +89,22 @@ protected:
 	virtual void InitializeClient();
 };
 
+//! The HTTPClientCache keeps the idle clients of closed file handles per host, so that the next file on the same host
+//! reuses their keep-alive connections instead of setting up a new (TLS) connection
+class HTTPClientCache {
+public:
+	constexpr static idx_t MAX_IDLE_CLIENTS_PER_HOST = 64;
+
+	//! Returns an idle client for the host, or a new client if there is none
+	unique_ptr<duckdb_httplib_openssl::Client> GetClient(const HTTPParams &http_params, const string &proto_host_port);
+	//! Hands a client that is no longer used back to the cache
+	void StoreClient(const string &proto_host_port, unique_ptr<duckdb_httplib_openssl::Client> client);
+
+private:
+	mutex lock;
+	unordered_map<string, vector<unique_ptr<duckdb_httplib_openssl::Client>>> idle_clients;
+};
+
 class HTTPFileSystem : public FileSystem {
 public:
 	static unique_ptr<duckdb_httplib_openssl::Client> GetClient(const HTTPParams &http_params,
@@ -84,9 +122,11 @@ public:
 	virtual unique_ptr<ResponseWrapper> PutRequest(FileHandle &handle, string url, HeaderMap header_map,
 	                                               char *buffer_in, idx_t buffer_in_len);
 	virtual unique_ptr<ResponseWrapper> HeadRequest(FileHandle &handle, string url, HeaderMap header_map);
-	// Get Request with range parameter that GETs exactly buffer_out_len bytes from the url
+	// Get Request with range parameter that GETs exactly buffer_out_len bytes from the url, over the given client
+	// (a new client is created if it is not set yet)
 	virtual unique_ptr<ResponseWrapper> GetRangeRequest(FileHandle &handle, string url, HeaderMap header_map,
-	                                                    idx_t file_offset, char *buffer_out, idx_t buffer_out_len);
+	                                                    idx_t file_offset, char *buffer_out, idx_t buffer_out_len,
+	                                                    unique_ptr<duckdb_httplib_openssl::Client> &client);
 	// Post Request that can handle variable sized responses without a content-length header (needed for s3 multipart)
 	virtual unique_ptr<ResponseWrapper> PostRequest(FileHandle &handle, string url, HeaderMap header_map,
 	                                                unique_ptr<char[]> &buffer_out, idx_t &buffer_out_len,
@@ -94,6 +134,7 @@ public:
 
 	// FS methods
 	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	void ReadRanges(FileHandle &handle, const vector<FileReadRange> &ranges) override;
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
@@ -115,10 +156,28 @@ public:
 
 	static void Verify();
 
+public:
+	// The idle connections to remote hosts, shared by all file handles
+	HTTPClientCache client_cache;
+
 protected:
+	// Reads a range from the server, or from the block cache if the file is cached
+	void ReadRemote(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t nr_bytes);
+	// Reads a range through the block cache: the blocks that are not cached are requested and added to the cache
+	void ReadCachedRange(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t nr_bytes);
+	// Reads a range that bypasses the read buffer. Large ranges are split up into parts that are requested
+	// concurrently, so a single thread has multiple requests in flight.
+	void ReadRange(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t nr_bytes);
+	// Reads the ranges from the server over a pool of (at most parallel_requests) connections. Ranges larger than
+	// MIN_PARALLEL_REQUEST_LEN are split up so that the work is spread evenly over the connections.
+	void ReadRangesConcurrently(HTTPFileHandle &hfh, const vector<FileReadRange> &ranges);
+
 	virtual unique_ptr<HTTPFileHandle> CreateHandle(const string &path, const string &query_param, uint8_t flags,
 	                                                FileLockType lock, FileCompressionType compression,
 	                                                FileOpener *opener);
+
+	// The cache of remote file blocks, shared by all connections to the database
+	HTTPBlockCache block_cache;
 };
 
 } // namespace duckdb
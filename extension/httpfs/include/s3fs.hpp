@@ -11,6 +11,7 @@
 #include "httplib.hpp"
 
 #include <condition_variable>
+#include <exception>
 #include <iostream>
 
 namespace duckdb {
@@ -107,6 +108,11 @@ protected:
 	mutex uploads_in_progress_lock;
 	std::condition_variable uploads_in_progress_cv;
 	atomic<uint16_t> uploads_in_progress;
+	// The write buffers of this file that are being filled or uploaded, limited to max_upload_threads. Protected by
+	// uploads_in_progress_lock
+	idx_t buffers_in_use;
+	// The first error that occurred in an upload thread, it is thrown by the next write or flush of the file
+	std::exception_ptr upload_exception;
 
 	// Etags are stored for each part
 	mutex part_etags_lock;
@@ -118,6 +124,17 @@ protected:
 	void InitializeClient() override;
 };
 
+// The keys and (if listed with a delimiter) the common prefixes directly below a prefix
+struct S3ListResult {
+	vector<string> keys;
+	vector<string> common_prefixes;
+};
+
+struct S3ListCacheEntry {
+	S3ListResult result;
+	std::chrono::steady_clock::time_point list_time;
+};
+
 class S3FileSystem : public HTTPFileSystem {
 public:
 	explicit S3FileSystem(BufferManager &buffer_manager) : buffer_manager(buffer_manager) {
@@ -125,11 +142,16 @@ public:
 
 	constexpr static int MULTIPART_UPLOAD_WAIT_BETWEEN_RETRIES_MS = 1000;
 
-	// Global limits to write buffers
-	mutex buffers_available_lock;
-	std::condition_variable buffers_available_cv;
-	atomic<uint16_t> buffers_available;
-	atomic<uint16_t> threads_waiting_for_memory = {0};
+	// The uploads in progress over all files. A write buffer that cannot be allocated because the buffer manager is out
+	// of memory waits for one of these to finish and release its buffer
+	mutex uploads_lock;
+	std::condition_variable upload_finished_cv;
+	idx_t uploads_in_progress = 0;
+	idx_t uploads_finished = 0;
+
+	// The results of recent listing requests, kept for s3_list_cache_ttl seconds and cleared when a file is written
+	mutex list_cache_lock;
+	unordered_map<string, S3ListCacheEntry> list_cache;
 
 	BufferManager &buffer_manager;
 
@@ -142,7 +164,8 @@ public:
 	                                       idx_t buffer_in_len) override;
 	unique_ptr<ResponseWrapper> HeadRequest(FileHandle &handle, string url, HeaderMap header_map) override;
 	unique_ptr<ResponseWrapper> GetRangeRequest(FileHandle &handle, string url, HeaderMap header_map, idx_t file_offset,
-	                                            char *buffer_out, idx_t buffer_out_len) override;
+	                                            char *buffer_out, idx_t buffer_out_len,
+	                                            unique_ptr<duckdb_httplib_openssl::Client> &client) override;
 
 	static void Verify();
 
@@ -167,8 +190,15 @@ public:
 	// Uploads the contents of write_buffer to S3.
 	// Note: caller is responsible to not call this method twice on the same buffer
 	static void UploadBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuffer> write_buffer);
+	// Sends the PUT request for a single part of the multipart upload, retrying on connection errors
+	static void UploadPart(S3FileHandle &file_handle, S3WriteBuffer &write_buffer);
 
 	vector<string> Glob(const string &glob_pattern, FileOpener *opener = nullptr) override;
+	// Lists all keys below the prefix of the bucket, or with use_delimiter only the keys and common prefixes directly
+	// below it. Results are taken from the listing cache if they are at most cache_ttl seconds old
+	S3ListResult ListPrefix(const string &bucket_url, const string &prefix, bool use_delimiter,
+	                        HTTPParams &http_params, S3AuthParams &s3_auth_params, uint64_t cache_ttl);
+	void ClearListCache();
 
 protected:
 	unique_ptr<HTTPFileHandle> CreateHandle(const string &path, const string &query_param, uint8_t flags,
@@ -184,6 +214,10 @@ protected:
 	// Allocate an S3WriteBuffer
 	// Note: call may block if no buffers are available or if the buffer manager fails to allocate more memory.
 	shared_ptr<S3WriteBuffer> GetBuffer(S3FileHandle &file_handle, uint16_t write_buffer_idx);
+	// Allocates the memory of a write buffer from the buffer manager, waiting for uploads to finish while it is full
+	BufferHandle AllocateBuffer(idx_t size);
+	// Throws the error of a failed upload of the file, if any
+	static void CheckUploadException(S3FileHandle &file_handle);
 };
 
 // Helper class to do s3 ListObjectV2 api call https://docs.aws.amazon.com/AmazonS3/latest/API/API_ListObjectsV2.html
@@ -10,6 +10,8 @@
 
 #include <duckdb/function/scalar/string_functions.hpp>
 #include <duckdb/storage/buffer_manager.hpp>
+#include <algorithm>
+#include <deque>
 #include <iostream>
 #include <thread>
 
@@ -228,8 +230,8 @@ void S3FileHandle::Close() {
 void S3FileHandle::InitializeClient() {
 	auto parsed_url = S3FileSystem::S3UrlParse(path, this->auth_params);
 
-	string proto_host_port = parsed_url.http_proto + parsed_url.host;
-	http_client = HTTPFileSystem::GetClient(this->http_params, proto_host_port.c_str());
+	client_host = parsed_url.http_proto + parsed_url.host;
+	http_client = ((HTTPFileSystem &)file_system).client_cache.GetClient(this->http_params, client_host);
 }
 
 // Opens the multipart upload and returns the ID
@@ -259,8 +261,42 @@ string S3FileSystem::InitializeMultipartUpload(S3FileHandle &file_handle) {
 
 void S3FileSystem::UploadBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuffer> write_buffer) {
 	auto &s3fs = (S3FileSystem &)file_handle.file_system;
+	{
+		lock_guard<mutex> guard(s3fs.uploads_lock);
+		s3fs.uploads_in_progress++;
+	}
+	try {
+		UploadPart(file_handle, *write_buffer);
+	} catch (...) {
+		// this runs on a detached thread: the error is thrown by the next write or flush of the file instead
+		lock_guard<mutex> guard(file_handle.uploads_in_progress_lock);
+		if (!file_handle.upload_exception) {
+			file_handle.upload_exception = std::current_exception();
+		}
+	}
+
+	// Free up the memory of the buffer, so that other threads (of any file) can allocate a new buffer
+	write_buffer.reset();
+	{
+		lock_guard<mutex> guard(s3fs.uploads_lock);
+		s3fs.uploads_in_progress--;
+		s3fs.uploads_finished++;
+	}
+	s3fs.upload_finished_cv.notify_all();
 
-	string query_param = S3FileSystem::UrlEncode("partNumber") + "=" + to_string(write_buffer->part_no + 1) + "&" +
+	// Update uploads in progress
+	{
+		lock_guard<mutex> guard(file_handle.uploads_in_progress_lock);
+		file_handle.buffers_in_use--;
+		file_handle.uploads_in_progress--;
+	}
+	file_handle.uploads_in_progress_cv.notify_all();
+}
+
+void S3FileSystem::UploadPart(S3FileHandle &file_handle, S3WriteBuffer &write_buffer) {
+	auto &s3fs = (S3FileSystem &)file_handle.file_system;
+
+	string query_param = S3FileSystem::UrlEncode("partNumber") + "=" + to_string(write_buffer.part_no + 1) + "&" +
 	                     S3FileSystem::UrlEncode("uploadId") + "=" +
 	                     S3FileSystem::UrlEncode(file_handle.multipart_upload_id, true);
 	unique_ptr<ResponseWrapper> res;
@@ -273,7 +309,7 @@ void S3FileSystem::UploadBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuf
 	while (true) {
 		try {
 			res = s3fs.PutRequest(file_handle, file_handle.stripped_path + "?" + query_param, {},
-			                      (char *)write_buffer->Ptr(), write_buffer->idx);
+			                      (char *)write_buffer.Ptr(), write_buffer.idx);
 			if (res->code == 200) {
 				success = true;
 				break;
@@ -312,19 +348,22 @@ void S3FileSystem::UploadBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuf
 
 	// Insert etag
 	file_handle.part_etags_lock.lock();
-	file_handle.part_etags.insert(std::pair<uint16_t, string>(write_buffer->part_no, etag_lookup->second));
+	file_handle.part_etags.insert(std::pair<uint16_t, string>(write_buffer.part_no, etag_lookup->second));
 	file_handle.part_etags_lock.unlock();
 
 	file_handle.parts_uploaded++;
+}
 
-	// Free up space for another thread to acquire an S3WriteBuffer
-	write_buffer.reset();
-	s3fs.buffers_available++;
-	s3fs.buffers_available_cv.notify_one();
+void S3FileSystem::ClearListCache() {
+	lock_guard<mutex> guard(list_cache_lock);
+	list_cache.clear();
+}
 
-	// Update uploads in progress
-	file_handle.uploads_in_progress--;
-	file_handle.uploads_in_progress_cv.notify_one();
+void S3FileSystem::CheckUploadException(S3FileHandle &file_handle) {
+	lock_guard<mutex> guard(file_handle.uploads_in_progress_lock);
+	if (file_handle.upload_exception) {
+		std::rethrow_exception(file_handle.upload_exception);
+	}
 }
 
 void S3FileSystem::FlushBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuffer> write_buffer) {
@@ -344,7 +383,10 @@ void S3FileSystem::FlushBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuff
 	file_handle.write_buffers_lock.lock();
 	file_handle.write_buffers.erase(write_buffer->part_no);
 	file_handle.write_buffers_lock.unlock();
-	file_handle.uploads_in_progress++;
+	{
+		lock_guard<mutex> guard(file_handle.uploads_in_progress_lock);
+		file_handle.uploads_in_progress++;
+	}
 
 	thread upload_thread(UploadBuffer, std::ref(file_handle), write_buffer);
 	upload_thread.detach();
@@ -368,13 +410,18 @@ void S3FileSystem::FlushAllBuffers(S3FileHandle &file_handle) {
 			FlushBuffer(file_handle, write_buffer);
 		}
 	}
-	unique_lock<mutex> lck(file_handle.uploads_in_progress_lock);
-	file_handle.uploads_in_progress_cv.wait(lck,
-	                                        [&file_handle] { return file_handle.uploads_in_progress.load() == 0; });
+	{
+		unique_lock<mutex> lck(file_handle.uploads_in_progress_lock);
+		file_handle.uploads_in_progress_cv.wait(
+		    lck, [&file_handle] { return file_handle.uploads_in_progress.load() == 0; });
+	}
+	CheckUploadException(file_handle);
 }
 
 void S3FileSystem::FinalizeMultipartUpload(S3FileHandle &file_handle) {
 	auto &s3fs = (S3FileSystem &)file_handle.file_system;
+	// the new file has to show up in the next glob
+	s3fs.ClearListCache();
 
 	std::stringstream ss;
 	ss << "<CompleteMultipartUpload xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">";
@@ -418,45 +465,29 @@ shared_ptr<S3WriteBuffer> S3FileSystem::GetBuffer(S3FileHandle &file_handle, uin
 		}
 	}
 
-	// Wait for a buffer to become available
+	// Wait until this file has less than max_upload_threads buffers that are being filled or uploaded
 	{
-		unique_lock<mutex> lck(s3fs.buffers_available_lock);
-		s3fs.buffers_available_cv.wait(lck, [&s3fs] { return s3fs.buffers_available > 0; });
-		s3fs.buffers_available--;
+		unique_lock<mutex> lck(file_handle.uploads_in_progress_lock);
+		file_handle.uploads_in_progress_cv.wait(lck, [&file_handle] {
+			return file_handle.buffers_in_use < file_handle.config_params.max_upload_threads ||
+			       file_handle.upload_exception;
+		});
+		if (file_handle.upload_exception) {
+			std::rethrow_exception(file_handle.upload_exception);
+		}
+		file_handle.buffers_in_use++;
 	}
 
-	// Try to allocate a buffer from the buffer manager
 	BufferHandle duckdb_buffer;
-	bool set_waiting_for_memory = false;
-
-	while (true) {
-		try {
-			duckdb_buffer = buffer_manager.Allocate(file_handle.part_size);
-
-			if (set_waiting_for_memory) {
-				threads_waiting_for_memory--;
-			}
-			break;
-		} catch (OutOfMemoryException &e) {
-			if (!set_waiting_for_memory) {
-				threads_waiting_for_memory++;
-				set_waiting_for_memory = true;
-			}
-			auto buffers_available = s3fs.buffers_available.load();
-
-			if (buffers_available >= file_handle.config_params.max_upload_threads - threads_waiting_for_memory) {
-				// There exist no upload write buffers that can release more memory. We really ran out of memory here.
-				throw e;
-			} else {
-
-				// Wait for more buffers to become available before trying again
-				{
-					unique_lock<mutex> lck(s3fs.buffers_available_lock);
-					s3fs.buffers_available_cv.wait(
-					    lck, [&s3fs, &buffers_available] { return s3fs.buffers_available > buffers_available; });
-				}
-			}
+	try {
+		duckdb_buffer = s3fs.AllocateBuffer(file_handle.part_size);
+	} catch (...) {
+		{
+			lock_guard<mutex> guard(file_handle.uploads_in_progress_lock);
+			file_handle.buffers_in_use--;
 		}
+		file_handle.uploads_in_progress_cv.notify_all();
+		throw;
 	}
 
 	auto new_write_buffer = make_shared<S3WriteBuffer>(write_buffer_idx * file_handle.part_size, file_handle.part_size,
@@ -467,18 +498,42 @@ shared_ptr<S3WriteBuffer> S3FileSystem::GetBuffer(S3FileHandle &file_handle, uin
 		auto lookup_result = file_handle.write_buffers.find(write_buffer_idx);
 
 		// Check if other thread has created the same buffer, if so we return theirs and drop ours.
-		if (lookup_result != file_handle.write_buffers.end()) {
-			// write_buffer_idx << std::endl;
-			shared_ptr<S3WriteBuffer> write_buffer = lookup_result->second;
-			file_handle.write_buffers_lock.unlock();
-			return write_buffer;
+		if (lookup_result == file_handle.write_buffers.end()) {
+			file_handle.write_buffers.insert(
+			    pair<uint16_t, shared_ptr<S3WriteBuffer>>(write_buffer_idx, new_write_buffer));
+			return new_write_buffer;
 		}
-		file_handle.write_buffers.insert(pair<uint16_t, shared_ptr<S3WriteBuffer>>(write_buffer_idx, new_write_buffer));
+		new_write_buffer = lookup_result->second;
 	}
-
+	{
+		lock_guard<mutex> guard(file_handle.uploads_in_progress_lock);
+		file_handle.buffers_in_use--;
+	}
+	file_handle.uploads_in_progress_cv.notify_all();
 	return new_write_buffer;
 }
 
+BufferHandle S3FileSystem::AllocateBuffer(idx_t size) {
+	while (true) {
+		idx_t uploads_finished_before;
+		{
+			lock_guard<mutex> guard(uploads_lock);
+			uploads_finished_before = uploads_finished;
+		}
+		try {
+			return buffer_manager.Allocate(size);
+		} catch (OutOfMemoryException &e) {
+			// Wait for an upload of any file to finish and release its buffer before trying again
+			unique_lock<mutex> lck(uploads_lock);
+			if (uploads_in_progress == 0 && uploads_finished == uploads_finished_before) {
+				// There exist no upload write buffers that can release more memory. We really ran out of memory here.
+				throw;
+			}
+			upload_finished_cv.wait(lck, [&] { return uploads_finished != uploads_finished_before; });
+		}
+	}
+}
+
 void S3FileSystem::GetQueryParam(const string &key, string &param, duckdb_httplib_openssl::Params &query_params) {
 	auto found_param = query_params.find(key);
 	if (found_param != query_params.end()) {
@@ -625,14 +680,15 @@ unique_ptr<ResponseWrapper> S3FileSystem::HeadRequest(FileHandle &handle, string
 }
 
 unique_ptr<ResponseWrapper> S3FileSystem::GetRangeRequest(FileHandle &handle, string url, HeaderMap header_map,
-                                                          idx_t file_offset, char *buffer_out, idx_t buffer_out_len) {
+                                                          idx_t file_offset, char *buffer_out, idx_t buffer_out_len,
+                                                          unique_ptr<duckdb_httplib_openssl::Client> &client) {
 	auto auth_params = static_cast<S3FileHandle &>(handle).auth_params;
 	url = url.substr(0, url.find_last_of('?'));
 	auto parsed_url = S3UrlParse(url, auth_params);
 	string full_url = get_full_s3_url(auth_params, parsed_url);
 	auto headers = create_s3_header(parsed_url.path, parsed_url.query_param, parsed_url.host, "s3", "GET", auth_params,
 	                                "", "", "", "");
-	return HTTPFileSystem::GetRangeRequest(handle, full_url, headers, file_offset, buffer_out, buffer_out_len);
+	return HTTPFileSystem::GetRangeRequest(handle, full_url, headers, file_offset, buffer_out, buffer_out_len, client);
 }
 
 unique_ptr<HTTPFileHandle> S3FileSystem::CreateHandle(const string &path, const string &query_param, uint8_t flags,
@@ -753,8 +809,8 @@ unique_ptr<ResponseWrapper> S3FileHandle::Initialize() {
 
 		multipart_upload_id = s3fs.InitializeMultipartUpload(*this);
 
-		// Threads are limited by limiting the amount of write buffers available, since each
-		s3fs.buffers_available = config_params.max_upload_threads;
+		// Threads are limited by limiting the amount of write buffers of the file that can be in use at once
+		buffers_in_use = 0;
 		uploads_in_progress = 0;
 		parts_uploaded = 0;
 		upload_finalized = false;
@@ -810,6 +866,92 @@ void S3FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx
 	}
 }
 
+enum class GlobPrefixMatch : uint8_t { NONE, PARTIAL, ALL };
+
+// Returns whether keys that start with the prefix can match the glob pattern: NONE if none of them can, ALL if the
+// pattern reaches a '*' within the prefix (the '*' also matches '/', so nothing below the prefix can be pruned)
+static GlobPrefixMatch MatchGlobPrefix(const string &prefix, const string &pattern) {
+	idx_t pidx = 0;
+	for (idx_t sidx = 0; sidx < prefix.size(); sidx++) {
+		if (pidx == pattern.size()) {
+			return GlobPrefixMatch::NONE;
+		}
+		auto p = pattern[pidx];
+		if (p == '*') {
+			return GlobPrefixMatch::ALL;
+		} else if (p == '?') {
+			pidx++;
+			continue;
+		} else if (p == '[') {
+			// a ']' directly after the opening bracket (or the '!') is matched literally
+			auto bracket_end = pidx + 1;
+			if (bracket_end < pattern.size() && pattern[bracket_end] == '!') {
+				bracket_end++;
+			}
+			bracket_end = pattern.find(']', bracket_end + 1);
+			if (bracket_end == string::npos) {
+				return GlobPrefixMatch::NONE;
+			}
+			if (!LikeFun::Glob(prefix.c_str() + sidx, 1, pattern.c_str() + pidx, bracket_end + 1 - pidx)) {
+				return GlobPrefixMatch::NONE;
+			}
+			pidx = bracket_end + 1;
+			continue;
+		} else if (p == '\\') {
+			pidx++;
+			if (pidx == pattern.size()) {
+				return GlobPrefixMatch::NONE;
+			}
+			p = pattern[pidx];
+		}
+		if (prefix[sidx] != p) {
+			return GlobPrefixMatch::NONE;
+		}
+		pidx++;
+	}
+	if (pidx < pattern.size() && pattern[pidx] == '*') {
+		return GlobPrefixMatch::ALL;
+	}
+	return GlobPrefixMatch::PARTIAL;
+}
+
+S3ListResult S3FileSystem::ListPrefix(const string &bucket_url, const string &prefix, bool use_delimiter,
+                                      HTTPParams &http_params, S3AuthParams &s3_auth_params, uint64_t cache_ttl) {
+	auto cache_key = s3_auth_params.endpoint + "\n" + s3_auth_params.access_key_id + "\n" + bucket_url + prefix +
+	                 (use_delimiter ? "\n/" : "\n");
+	auto now = std::chrono::steady_clock::now();
+	if (cache_ttl > 0) {
+		lock_guard<mutex> guard(list_cache_lock);
+		auto entry = list_cache.find(cache_key);
+		if (entry != list_cache.end() && now - entry->second.list_time < std::chrono::seconds(cache_ttl)) {
+			return entry->second.result;
+		}
+	}
+
+	S3ListResult result;
+	string prefix_path = bucket_url + prefix;
+	string continuation_token;
+	do {
+		auto response = AWSListObjectV2::Request(prefix_path, http_params, s3_auth_params, continuation_token,
+		                                         use_delimiter);
+		AWSListObjectV2::ParseKey(response, result.keys);
+		if (use_delimiter) {
+			auto common_prefixes = AWSListObjectV2::ParseCommonPrefix(response);
+			result.common_prefixes.insert(result.common_prefixes.end(), common_prefixes.begin(),
+			                              common_prefixes.end());
+		}
+		continuation_token = AWSListObjectV2::ParseContinuationToken(response);
+	} while (!continuation_token.empty());
+
+	if (cache_ttl > 0) {
+		lock_guard<mutex> guard(list_cache_lock);
+		auto &entry = list_cache[cache_key];
+		entry.result = result;
+		entry.list_time = now;
+	}
+	return result;
+}
+
 vector<string> S3FileSystem::Glob(const string &glob_pattern, FileOpener *opener) {
 	if (opener == nullptr) {
 		throw InternalException("Cannot S3 Glob without FileOpener");
@@ -826,46 +968,16 @@ vector<string> S3FileSystem::Glob(const string &glob_pattern, FileOpener *opener
 		return {glob_pattern};
 	}
 
-	string shared_path = glob_pattern.substr(0, first_wildcard_pos);
-
 	auto s3_auth_params = S3AuthParams::ReadFrom(opener);
 	auto http_params = HTTPParams::ReadFrom(opener);
+	uint64_t list_cache_ttl = 0;
+	Value value;
+	if (opener->TryGetCurrentSetting("s3_list_cache_ttl", value)) {
+		list_cache_ttl = value.GetValue<uint64_t>();
+	}
 
 	// Parse pattern
 	auto parsed_url = S3UrlParse(glob_pattern, s3_auth_params);
-
-	// Do main listobjectsv2 request
-	vector<string> s3_keys;
-	string main_continuation_token = "";
-
-	// Main paging loop
-	do {
-		// main listobject call, may
-		string response_str =
-		    AWSListObjectV2::Request(shared_path, http_params, s3_auth_params, main_continuation_token);
-		main_continuation_token = AWSListObjectV2::ParseContinuationToken(response_str);
-		AWSListObjectV2::ParseKey(response_str, s3_keys);
-
-		// Repeat requests until the keys of all common prefixes are parsed.
-		auto common_prefixes = AWSListObjectV2::ParseCommonPrefix(response_str);
-		while (!common_prefixes.empty()) {
-			auto prefix_path = "s3://" + parsed_url.bucket + '/' + common_prefixes.back();
-			common_prefixes.pop_back();
-
-			// TODO we could optimize here by doing a match on the prefix, if it doesn't match we can skip this prefix
-			// Paging loop for common prefix requests
-			string common_prefix_continuation_token = "";
-			do {
-				auto prefix_res = AWSListObjectV2::Request(prefix_path, http_params, s3_auth_params,
-				                                           common_prefix_continuation_token);
-				AWSListObjectV2::ParseKey(prefix_res, s3_keys);
-				auto more_prefixes = AWSListObjectV2::ParseCommonPrefix(prefix_res);
-				common_prefixes.insert(common_prefixes.end(), more_prefixes.begin(), more_prefixes.end());
-				common_prefix_continuation_token = AWSListObjectV2::ParseContinuationToken(prefix_res);
-			} while (!common_prefix_continuation_token.empty());
-		}
-	} while (!main_continuation_token.empty());
-
 	auto pattern_trimmed = parsed_url.path.substr(1);
 
 	// Trim the bucket prefix for path-style urls
@@ -878,6 +990,72 @@ vector<string> S3FileSystem::Glob(const string &glob_pattern, FileOpener *opener
 		pattern_trimmed += '?' + parsed_url.query_param;
 	}
 
+	// The keys are listed "directory" by directory: only the common prefixes (ending in '/') that keys matching the
+	// pattern can start with are listed further. Once the pattern reaches a '*', everything below the prefix is listed
+	// at once. The prefixes are listed concurrently, by up to httpfs_parallel_requests threads.
+	string bucket_url = "s3://" + parsed_url.bucket + "/";
+	auto literal_prefix = pattern_trimmed.substr(0, pattern_trimmed.find_first_of("*?[\\"));
+	auto root_match = MatchGlobPrefix(literal_prefix, pattern_trimmed);
+
+	mutex lock;
+	std::condition_variable prefixes_cv;
+	std::deque<pair<string, bool>> prefixes_to_list;
+	prefixes_to_list.emplace_back(literal_prefix, root_match != GlobPrefixMatch::ALL);
+	idx_t active_listings = 0;
+	std::exception_ptr error;
+	vector<string> s3_keys;
+
+	auto list_prefixes = [&]() {
+		unique_lock<mutex> guard(lock);
+		while (true) {
+			prefixes_cv.wait(guard, [&] { return !prefixes_to_list.empty() || active_listings == 0 || error; });
+			if (prefixes_to_list.empty() || error) {
+				// either all prefixes are listed, or one of the listings failed
+				prefixes_cv.notify_all();
+				return;
+			}
+			auto next = prefixes_to_list.front();
+			prefixes_to_list.pop_front();
+			active_listings++;
+			guard.unlock();
+
+			S3ListResult result;
+			std::exception_ptr listing_error;
+			try {
+				result = ListPrefix(bucket_url, next.first, next.second, http_params, s3_auth_params, list_cache_ttl);
+			} catch (...) {
+				listing_error = std::current_exception();
+			}
+
+			guard.lock();
+			active_listings--;
+			if (listing_error && !error) {
+				error = listing_error;
+			}
+			s3_keys.insert(s3_keys.end(), result.keys.begin(), result.keys.end());
+			for (auto &common_prefix : result.common_prefixes) {
+				auto match = MatchGlobPrefix(common_prefix, pattern_trimmed);
+				if (match != GlobPrefixMatch::NONE) {
+					prefixes_to_list.emplace_back(common_prefix, match == GlobPrefixMatch::PARTIAL);
+				}
+			}
+			prefixes_cv.notify_all();
+		}
+	};
+	vector<thread> list_threads;
+	for (idx_t i = 1; i < http_params.parallel_requests; i++) {
+		list_threads.emplace_back(list_prefixes);
+	}
+	list_prefixes();
+	for (auto &list_thread : list_threads) {
+		list_thread.join();
+	}
+	if (error) {
+		std::rethrow_exception(error);
+	}
+	// the prefixes are listed in parallel: sort the keys to return them in the order S3 lists them in
+	std::sort(s3_keys.begin(), s3_keys.end());
+
 	vector<string> result;
 	for (const auto &s3_key : s3_keys) {
 
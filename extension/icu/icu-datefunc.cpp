@@ -1,5 +1,6 @@
 #include "include/icu-datefunc.hpp"
 
+#include "duckdb/execution/expression_executor_state.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/common/operator/add.hpp"
 #include "duckdb/common/operator/multiply.hpp"
@@ -50,6 +51,17 @@ unique_ptr<FunctionData> ICUDateFunc::Bind(ClientContext &context, ScalarFunctio
 	return make_unique<BindData>(context);
 }
 
+unique_ptr<FunctionLocalState> ICUDateFunc::InitCalendar(ExpressionState &state, const BoundFunctionExpression &expr,
+                                                         FunctionData *bind_data) {
+	auto &info = (BindData &)*bind_data;
+	return make_unique<CalendarLocalState>(CalendarPtr(info.calendar->clone()));
+}
+
+icu::Calendar *ICUDateFunc::GetCalendar(ExpressionState &state) {
+	auto &lstate = (CalendarLocalState &)*ExecuteFunctionState::GetFunctionState(state);
+	return lstate.calendar.get();
+}
+
 void ICUDateFunc::SetTimeZone(icu::Calendar *calendar, const string_t &tz_id) {
 	auto tz = icu_66::TimeZone::createTimeZone(icu::UnicodeString::fromUTF8(icu::StringPiece(tz_id.GetString())));
 	calendar->adoptTimeZone(tz);
@@ -236,8 +236,7 @@ struct ICUDatePart : public ICUDateFunc {
 
 		auto &func_expr = (BoundFunctionExpression &)state.expr;
 		auto &info = (BIND_TYPE &)*func_expr.bind_info;
-		CalendarPtr calendar_ptr(info.calendar->clone());
-		auto calendar = calendar_ptr.get();
+		auto calendar = GetCalendar(state);
 
 		UnaryExecutor::ExecuteWithNulls<INPUT_TYPE, RESULT_TYPE>(date_arg, result, args.size(),
 		                                                         [&](INPUT_TYPE input, ValidityMask &mask, idx_t idx) {
@@ -253,15 +252,33 @@ struct ICUDatePart : public ICUDateFunc {
 
 	template <typename INPUT_TYPE, typename RESULT_TYPE>
 	static void BinaryTimestampFunction(DataChunk &args, ExpressionState &state, Vector &result) {
-		using BIND_TYPE = BindAdapterData<int64_t>;
 		D_ASSERT(args.ColumnCount() == 2);
 		auto &part_arg = args.data[0];
 		auto &date_arg = args.data[1];
 
-		auto &func_expr = (BoundFunctionExpression &)state.expr;
-		auto &info = (BIND_TYPE &)*func_expr.bind_info;
-		CalendarPtr calendar_ptr(info.calendar->clone());
-		auto calendar = calendar_ptr.get();
+		auto calendar = GetCalendar(state);
+
+		if (part_arg.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+			// common case of a constant part: look up its adapter once
+			if (ConstantVector::IsNull(part_arg)) {
+				result.SetVectorType(VectorType::CONSTANT_VECTOR);
+				ConstantVector::SetNull(result, true);
+				return;
+			}
+			const auto specifier = ConstantVector::GetData<string_t>(part_arg)->GetString();
+			auto adapter = PartCodeAdapterFactory(GetDatePartSpecifier(specifier));
+			UnaryExecutor::ExecuteWithNulls<INPUT_TYPE, RESULT_TYPE>(
+			    date_arg, result, args.size(), [&](INPUT_TYPE input, ValidityMask &mask, idx_t idx) {
+				    if (Timestamp::IsFinite(input)) {
+					    const auto micros = SetTime(calendar, input);
+					    return adapter(calendar, micros);
+				    } else {
+					    mask.SetInvalid(idx);
+					    return RESULT_TYPE(0);
+				    }
+			    });
+			return;
+		}
 
 		BinaryExecutor::ExecuteWithNulls<string_t, INPUT_TYPE, RESULT_TYPE>(
 		    part_arg, date_arg, result, args.size(),
@@ -282,8 +299,7 @@ struct ICUDatePart : public ICUDateFunc {
 		using BIND_TYPE = BindAdapterData<int64_t>;
 		auto &func_expr = (BoundFunctionExpression &)state.expr;
 		auto &info = (BIND_TYPE &)*func_expr.bind_info;
-		CalendarPtr calendar_ptr(info.calendar->clone());
-		auto calendar = calendar_ptr.get();
+		auto calendar = GetCalendar(state);
 
 		D_ASSERT(args.ColumnCount() == 1);
 		const auto count = args.size();
@@ -428,7 +444,7 @@ struct ICUDatePart : public ICUDateFunc {
 	template <typename INPUT_TYPE, typename RESULT_TYPE>
 	static ScalarFunction GetUnaryPartCodeFunction(const LogicalType &temporal_type) {
 		return ScalarFunction({temporal_type}, LogicalType::BIGINT, UnaryTimestampFunction<INPUT_TYPE, RESULT_TYPE>,
-		                      BindDatePart);
+		                      BindDatePart, nullptr, nullptr, InitCalendar);
 	}
 
 	static void AddUnaryPartCodeFunctions(const string &name, ClientContext &context) {
@@ -442,14 +458,16 @@ struct ICUDatePart : public ICUDateFunc {
 	template <typename INPUT_TYPE, typename RESULT_TYPE>
 	static ScalarFunction GetBinaryPartCodeFunction(const LogicalType &temporal_type) {
 		return ScalarFunction({LogicalType::VARCHAR, temporal_type}, LogicalType::BIGINT,
-		                      BinaryTimestampFunction<INPUT_TYPE, RESULT_TYPE>, BindDatePart);
+		                      BinaryTimestampFunction<INPUT_TYPE, RESULT_TYPE>, BindDatePart, nullptr, nullptr,
+		                      InitCalendar);
 	}
 
 	template <typename INPUT_TYPE>
 	static ScalarFunction GetStructFunction(const LogicalType &temporal_type) {
 		auto part_type = LogicalType::LIST(LogicalType::VARCHAR);
 		auto result_type = LogicalType::STRUCT({});
-		ScalarFunction result({part_type, temporal_type}, result_type, StructFunction<INPUT_TYPE>, BindStruct);
+		ScalarFunction result({part_type, temporal_type}, result_type, StructFunction<INPUT_TYPE>, BindStruct,
+		                      nullptr, nullptr, InitCalendar);
 		result.serialize = SerializeFunction;
 		result.deserialize = DeserializeFunction;
 		return result;
@@ -473,7 +491,7 @@ struct ICUDatePart : public ICUDateFunc {
 	template <typename INPUT_TYPE>
 	static ScalarFunction GetLastDayFunction(const LogicalType &temporal_type) {
 		return ScalarFunction({temporal_type}, LogicalType::DATE, UnaryTimestampFunction<INPUT_TYPE, date_t>,
-		                      BindLastDate);
+		                      BindLastDate, nullptr, nullptr, InitCalendar);
 	}
 	static void AddLastDayFunctions(const string &name, ClientContext &context) {
 		auto &catalog = Catalog::GetCatalog(context);
@@ -92,15 +92,101 @@ struct ICUDateTrunc : public ICUDateFunc {
 		calendar->set(UCAL_ERA, era);
 	}
 
+	//! Gets the calendar field and the amount by which it advances from one bucket of the part to the next
+	static bool GetBucketWidth(DatePartSpecifier part, UCalendarDateFields &field, int32_t &amount) {
+		switch (part) {
+		case DatePartSpecifier::MILLENNIUM:
+			field = UCAL_YEAR;
+			amount = 1000;
+			return true;
+		case DatePartSpecifier::CENTURY:
+			field = UCAL_YEAR;
+			amount = 100;
+			return true;
+		case DatePartSpecifier::DECADE:
+			field = UCAL_YEAR;
+			amount = 10;
+			return true;
+		case DatePartSpecifier::YEAR:
+			field = UCAL_YEAR;
+			amount = 1;
+			return true;
+		case DatePartSpecifier::QUARTER:
+			field = UCAL_MONTH;
+			amount = 3;
+			return true;
+		case DatePartSpecifier::MONTH:
+			field = UCAL_MONTH;
+			amount = 1;
+			return true;
+		case DatePartSpecifier::WEEK:
+		case DatePartSpecifier::YEARWEEK:
+			field = UCAL_DATE;
+			amount = 7;
+			return true;
+		case DatePartSpecifier::DAY:
+		case DatePartSpecifier::DOW:
+		case DatePartSpecifier::ISODOW:
+		case DatePartSpecifier::DOY:
+			field = UCAL_DATE;
+			amount = 1;
+			return true;
+		case DatePartSpecifier::HOUR:
+			field = UCAL_HOUR_OF_DAY;
+			amount = 1;
+			return true;
+		case DatePartSpecifier::MINUTE:
+			field = UCAL_MINUTE;
+			amount = 1;
+			return true;
+		case DatePartSpecifier::SECOND:
+		case DatePartSpecifier::EPOCH:
+			field = UCAL_SECOND;
+			amount = 1;
+			return true;
+		case DatePartSpecifier::MILLISECONDS:
+			field = UCAL_MILLISECOND;
+			amount = 1;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	//! Gets the (exclusive) end of the bucket that starts at the given timestamp, or the start itself if the end can
+	//! not be determined
+	static timestamp_t GetBucketEnd(icu::Calendar *calendar, part_trunc_t truncator, UCalendarDateFields field,
+	                                int32_t amount, timestamp_t bucket_start) {
+		SetTime(calendar, bucket_start);
+		UErrorCode status = U_ZERO_ERROR;
+		calendar->add(field, amount, status);
+		if (U_FAILURE(status)) {
+			return bucket_start;
+		}
+		const auto millis = calendar->getTime(status);
+		if (U_FAILURE(status) || millis >= double(Timestamp::GetEpochMs(timestamp_t::infinity()))) {
+			return bucket_start;
+		}
+		const timestamp_t bucket_end(int64_t(millis) * Interval::MICROS_PER_MSEC);
+		if (bucket_end <= bucket_start) {
+			return bucket_start;
+		}
+		// truncation is monotonic: if the last µs of the bucket is truncated to its start, all of its values are
+		auto micros = SetTime(calendar, timestamp_t(bucket_end.value - 1));
+		truncator(calendar, micros);
+		if (GetTimeUnsafe(calendar, micros) != bucket_start) {
+			return bucket_start;
+		}
+		return bucket_end;
+	}
+
 	template <typename T>
 	static void ICUDateTruncFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 		D_ASSERT(args.ColumnCount() == 2);
 		auto &part_arg = args.data[0];
 		auto &date_arg = args.data[1];
 
-		auto &func_expr = (BoundFunctionExpression &)state.expr;
-		auto &info = (BindData &)*func_expr.bind_info;
-		CalendarPtr calendar(info.calendar->clone());
+		auto calendar = GetCalendar(state);
 
 		if (part_arg.GetVectorType() == VectorType::CONSTANT_VECTOR) {
 			// Common case of constant part.
@@ -109,12 +195,32 @@ struct ICUDateTrunc : public ICUDateFunc {
 				ConstantVector::SetNull(result, true);
 			} else {
 				const auto specifier = ConstantVector::GetData<string_t>(part_arg)->GetString();
-				auto truncator = TruncationFactory(GetDatePartSpecifier(specifier));
+				const auto part = GetDatePartSpecifier(specifier);
+				auto truncator = TruncationFactory(part);
+				UCalendarDateFields field;
+				int32_t amount;
+				const auto has_buckets = GetBucketWidth(part, field, amount);
+				// consecutive values often fall into the same bucket: once two consecutive values are truncated to
+				// the same timestamp, the end of their bucket is computed and the truncation is skipped up to it
+				timestamp_t bucket_start(0);
+				timestamp_t bucket_end(0);
+				timestamp_t previous(0);
+				bool has_previous = false;
 				UnaryExecutor::Execute<T, timestamp_t>(date_arg, result, args.size(), [&](T input) {
 					if (Timestamp::IsFinite(input)) {
-						auto micros = SetTime(calendar.get(), input);
-						truncator(calendar.get(), micros);
-						return GetTimeUnsafe(calendar.get(), micros);
+						if (input >= bucket_start && input < bucket_end) {
+							return bucket_start;
+						}
+						auto micros = SetTime(calendar, input);
+						truncator(calendar, micros);
+						const auto truncated = GetTimeUnsafe(calendar, micros);
+						if (has_buckets && has_previous && truncated == previous) {
+							bucket_start = truncated;
+							bucket_end = GetBucketEnd(calendar, truncator, field, amount, truncated);
+						}
+						previous = truncated;
+						has_previous = true;
+						return truncated;
 					} else {
 						return input;
 					}
@@ -125,9 +231,9 @@ struct ICUDateTrunc : public ICUDateFunc {
 			    part_arg, date_arg, result, args.size(), [&](string_t specifier, T input) {
 				    if (Timestamp::IsFinite(input)) {
 					    auto truncator = TruncationFactory(GetDatePartSpecifier(specifier.GetString()));
-					    auto micros = SetTime(calendar.get(), input);
-					    truncator(calendar.get(), micros);
-					    return GetTimeUnsafe(calendar.get(), micros);
+					    auto micros = SetTime(calendar, input);
+					    truncator(calendar, micros);
+					    return GetTimeUnsafe(calendar, micros);
 				    } else {
 					    return input;
 				    }
@@ -137,7 +243,8 @@ struct ICUDateTrunc : public ICUDateFunc {
 
 	template <typename TA>
 	static ScalarFunction GetDateTruncFunction(const LogicalTypeId &type) {
-		return ScalarFunction({LogicalType::VARCHAR, type}, LogicalType::TIMESTAMP_TZ, ICUDateTruncFunction<TA>, Bind);
+		return ScalarFunction({LogicalType::VARCHAR, type}, LogicalType::TIMESTAMP_TZ, ICUDateTruncFunction<TA>, Bind,
+		                      nullptr, nullptr, InitCalendar);
 	}
 
 	static void AddBinaryTimestampFunction(const string &name, ClientContext &context) {
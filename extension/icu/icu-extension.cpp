@@ -4,6 +4,7 @@
 #include "unicode/stringpiece.h"
 #include "unicode/coll.h"
 #include "unicode/sortkey.h"
+#include "unicode/ustring.h"
 #include "unicode/timezone.h"
 #include "unicode/calendar.h"
 
@@ -19,6 +20,7 @@
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/config.hpp"
 
+#include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/function/scalar_function.hpp"
@@ -28,6 +30,11 @@
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/collate_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/default/default_generator.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/set.hpp"
 
 #include <cassert>
 
@@ -106,6 +113,63 @@ static void ICUCollateFunction(DataChunk &args, ExpressionState &state, Vector &
 	});
 }
 
+//! Computes the ICU sort keys of the strings of a chunk, reusing its conversion and key buffers for all of them
+struct ICUSortKeyState {
+	explicit ICUSortKeyState(icu::Collator &collator) : collator(collator) {
+	}
+
+	//! Computes the sort key of the input, returns its size (without the terminating zero byte)
+	idx_t GetSortKey(string_t input) {
+		// convert the string to UTF-16 without allocating a UnicodeString for every value
+		auto input_size = input.GetSize();
+		if (characters.size() < input_size + 1) {
+			characters.resize(input_size + 1);
+		}
+		int32_t character_count = 0;
+		UErrorCode status = U_ZERO_ERROR;
+		u_strFromUTF8(characters.data(), int32_t(characters.size()), &character_count, input.GetDataUnsafe(),
+		              int32_t(input_size), &status);
+		if (U_FAILURE(status)) {
+			throw InvalidInputException("Failed to convert string to UTF-16 for collation: %s", u_errorName(status));
+		}
+		auto key_size = collator.getSortKey(characters.data(), character_count, key.data(), int32_t(key.size()));
+		if (key_size > int32_t(key.size())) {
+			key.resize(key_size);
+			key_size = collator.getSortKey(characters.data(), character_count, key.data(), int32_t(key.size()));
+		}
+		D_ASSERT(key_size > 0);
+		return idx_t(key_size - 1);
+	}
+
+	icu::Collator &collator;
+	vector<UChar> characters;
+	vector<uint8_t> key = vector<uint8_t>(256);
+};
+
+//! Computes the sort keys that strings are compared by under a collation
+//! The sort keys are byte-comparable, so they are returned as BLOBs that the sort can use directly in its normalized
+//! keys (unlike hex-encoded keys, every prefix byte is significant).
+//! The keys of consecutive repeated values are only computed once.
+static void ICUCollateSortKeyFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = (BoundFunctionExpression &)state.expr;
+	auto &info = (IcuBindData &)*func_expr.bind_info;
+
+	ICUSortKeyState sort_key_state(*info.collator);
+	bool has_previous = false;
+	string_t previous_input;
+	string_t previous_key;
+	UnaryExecutor::Execute<string_t, string_t>(args.data[0], result, args.size(), [&](string_t input) {
+		if (has_previous && Equals::Operation(input, previous_input)) {
+			return previous_key;
+		}
+		auto key_size = sort_key_state.GetSortKey(input);
+		previous_input = input;
+		previous_key = StringVector::AddStringOrBlob(result, (const char *)sort_key_state.key.data(), key_size);
+		has_previous = true;
+		return previous_key;
+	});
+}
+
 static unique_ptr<FunctionData> ICUCollateBind(ClientContext &context, ScalarFunction &bound_function,
                                                vector<unique_ptr<Expression>> &arguments) {
 	auto splits = StringUtil::Split(bound_function.name, "_");
@@ -147,12 +211,66 @@ static unique_ptr<FunctionData> ICUCollateDeserialize(ClientContext &context, Fi
 }
 
 static ScalarFunction GetICUFunction(const string &collation) {
-	ScalarFunction result(collation, {LogicalType::VARCHAR}, LogicalType::VARCHAR, ICUCollateFunction, ICUCollateBind);
+	ScalarFunction result(collation, {LogicalType::VARCHAR}, LogicalType::BLOB, ICUCollateSortKeyFunction,
+	                      ICUCollateBind);
 	result.serialize = ICUCollateSerialize;
 	result.deserialize = ICUCollateDeserialize;
 	return result;
 }
 
+//! The ICUCollationGenerator creates the collations of the available ICU locales when they are first used, so that
+//! the collation data of ICU is only loaded by processes that use them
+class ICUCollationGenerator : public DefaultGenerator {
+public:
+	ICUCollationGenerator(Catalog &catalog, SchemaCatalogEntry *schema) : DefaultGenerator(catalog), schema(schema) {
+	}
+
+	unique_ptr<CatalogEntry> CreateDefaultEntry(ClientContext &context, const string &entry_name) override {
+		auto collation = StringUtil::Lower(entry_name);
+		auto &collations = GetCollations();
+		if (collations.find(collation) == collations.end()) {
+			return nullptr;
+		}
+		CreateCollationInfo info(collation, GetICUFunction(collation), false, true);
+		info.schema = schema->name;
+		return make_unique_base<CatalogEntry, CollateCatalogEntry>(&catalog, schema, &info);
+	}
+
+	vector<string> GetDefaultEntries() override {
+		auto &collations = GetCollations();
+		return vector<string>(collations.begin(), collations.end());
+	}
+
+private:
+	const set<string> &GetCollations() {
+		lock_guard<mutex> guard(lock);
+		if (!initialized) {
+			// iterate over all the collations
+			int32_t count;
+			auto locales = icu::Collator::getAvailableLocales(count);
+			for (int32_t i = 0; i < count; i++) {
+				string collation;
+				if (string(locales[i].getCountry()).empty()) {
+					// language only
+					collation = locales[i].getLanguage();
+				} else {
+					// language + country
+					collation = locales[i].getLanguage() + string("_") + locales[i].getCountry();
+				}
+				collations.insert(StringUtil::Lower(collation));
+			}
+			initialized = true;
+		}
+		return collations;
+	}
+
+private:
+	SchemaCatalogEntry *schema;
+	mutex lock;
+	bool initialized = false;
+	set<string> collations;
+};
+
 static void SetICUTimeZone(ClientContext &context, SetScope scope, Value &parameter) {
 	icu::StringPiece utf8(StringValue::Get(parameter));
 	const auto uid = icu::UnicodeString::fromUTF8(utf8);
@@ -285,6 +403,20 @@ static void ICUCalendarFunction(ClientContext &context, TableFunctionInput &data
 	output.SetCardinality(index);
 }
 
+static Value GetICUTimeZoneDefault(DatabaseInstance &db) {
+	std::unique_ptr<icu::TimeZone> tz(icu::TimeZone::createDefault());
+	icu::UnicodeString tz_id;
+	std::string tz_string;
+	tz->getID(tz_id).toUTF8String(tz_string);
+	return Value(tz_string);
+}
+
+static Value GetICUCalendarDefault(DatabaseInstance &db) {
+	UErrorCode status = U_ZERO_ERROR;
+	std::unique_ptr<icu::Calendar> cal(icu::Calendar::createInstance(status));
+	return Value(cal->getType());
+}
+
 static void SetICUCalendar(ClientContext &context, SetScope scope, Value &parameter) {
 	const auto name = parameter.Value::GetValueUnsafe<string>();
 	string locale_key = "@calendar=" + name;
@@ -303,38 +435,20 @@ void ICUExtension::Load(DuckDB &db) {
 
 	auto &catalog = Catalog::GetCatalog(*con.context);
 
-	// iterate over all the collations
-	int32_t count;
-	auto locales = icu::Collator::getAvailableLocales(count);
-	for (int32_t i = 0; i < count; i++) {
-		string collation;
-		if (string(locales[i].getCountry()).empty()) {
-			// language only
-			collation = locales[i].getLanguage();
-		} else {
-			// language + country
-			collation = locales[i].getLanguage() + string("_") + locales[i].getCountry();
-		}
-		collation = StringUtil::Lower(collation);
+	// the collations of the ICU locales are created when they are first used
+	auto schema = catalog.GetSchema(*con.context, DEFAULT_SCHEMA);
+	schema->SetDefaultGenerator(CatalogType::COLLATION_ENTRY, make_unique<ICUCollationGenerator>(catalog, schema));
 
-		CreateCollationInfo info(collation, GetICUFunction(collation), false, true);
-		info.on_conflict = OnCreateConflict::IGNORE_ON_CONFLICT;
-		catalog.CreateCollation(*con.context, &info);
-	}
 	ScalarFunction sort_key("icu_sort_key", {LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::VARCHAR,
 	                        ICUCollateFunction, ICUSortKeyBind);
 
 	CreateScalarFunctionInfo sort_key_info(move(sort_key));
 	catalog.CreateFunction(*con.context, &sort_key_info);
 
-	// Time Zones
+	// Time Zones: the default time zone is only determined when the setting is first used
 	auto &config = DBConfig::GetConfig(*db.instance);
-	config.AddExtensionOption("TimeZone", "The current time zone", LogicalType::VARCHAR, SetICUTimeZone);
-	std::unique_ptr<icu::TimeZone> tz(icu::TimeZone::createDefault());
-	icu::UnicodeString tz_id;
-	std::string tz_string;
-	tz->getID(tz_id).toUTF8String(tz_string);
-	config.options.set_variables["TimeZone"] = Value(tz_string);
+	config.AddExtensionOption("TimeZone", "The current time zone", LogicalType::VARCHAR, SetICUTimeZone,
+	                          GetICUTimeZoneDefault);
 
 	TableFunction tz_names("pg_timezone_names", {}, ICUTimeZoneFunction, ICUTimeZoneBind, ICUTimeZoneInit);
 	CreateTableFunctionInfo tz_names_info(move(tz_names));
@@ -348,10 +462,8 @@ void ICUExtension::Load(DuckDB &db) {
 	RegisterICUStrptimeFunctions(*con.context);
 
 	// Calendars
-	config.AddExtensionOption("Calendar", "The current calendar", LogicalType::VARCHAR, SetICUCalendar);
-	UErrorCode status = U_ZERO_ERROR;
-	std::unique_ptr<icu::Calendar> cal(icu::Calendar::createInstance(status));
-	config.options.set_variables["Calendar"] = Value(cal->getType());
+	config.AddExtensionOption("Calendar", "The current calendar", LogicalType::VARCHAR, SetICUCalendar,
+	                          GetICUCalendarDefault);
 
 	TableFunction cal_names("icu_calendar_names", {}, ICUCalendarFunction, ICUCalendarBind, ICUCalendarInit);
 	CreateTableFunctionInfo cal_names_info(move(cal_names));
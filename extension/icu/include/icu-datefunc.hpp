@@ -42,9 +42,22 @@ struct ICUDateFunc {
 		unique_ptr<FunctionData> info;
 	};
 
+	//! The calendar of a thread, cloned once so it keeps its cached time zone transitions across chunks
+	struct CalendarLocalState : public FunctionLocalState {
+		explicit CalendarLocalState(CalendarPtr calendar_p) : calendar(move(calendar_p)) {
+		}
+
+		CalendarPtr calendar;
+	};
+
 	//! Binds a default calendar object for use by the function
 	static unique_ptr<FunctionData> Bind(ClientContext &context, ScalarFunction &bound_function,
 	                                     vector<unique_ptr<Expression>> &arguments);
+	//! Clones the bound calendar for a thread that executes the function
+	static unique_ptr<FunctionLocalState> InitCalendar(ExpressionState &state, const BoundFunctionExpression &expr,
+	                                                   FunctionData *bind_data);
+	//! Gets the calendar of the thread that executes the function
+	static icu::Calendar *GetCalendar(ExpressionState &state);
 
 	//! Sets the time zone for the calendar.
 	static void SetTimeZone(icu::Calendar *calendar, const string_t &tz_id);
@@ -17,6 +17,68 @@
 
 namespace duckdb {
 
+enum class JSONPathElementType : uint8_t { KEY, INDEX, INDEX_FROM_BACK };
+
+struct JSONPathElement {
+	JSONPathElementType type;
+	//! The key of an object
+	string key;
+	//! The index in an array (or from the back of an array)
+	idx_t index;
+};
+
+//! A JSON path that is compiled once at bind time, so it is not parsed again for every value
+struct JSONCompiledPath {
+public:
+	JSONCompiledPath();
+	//! The path must be valid, and start with '/' or '$'
+	JSONCompiledPath(const char *ptr, idx_t len);
+
+	//! Paths in '$' notation are split into their elements, paths in '/' notation are passed on to yyjson
+	const char *ptr;
+	idx_t len;
+	vector<JSONPathElement> elements;
+
+public:
+	inline yyjson_val *Get(yyjson_val *root) const {
+		if (len == 0) {
+			return nullptr;
+		}
+		if (*ptr == '/') {
+			return len == 1 ? root : unsafe_yyjson_get_pointer(root, ptr, len);
+		}
+		auto val = root;
+		for (auto &element : elements) {
+			if (!val) {
+				return nullptr;
+			}
+			switch (element.type) {
+			case JSONPathElementType::KEY:
+				if (!yyjson_is_obj(val)) {
+					return nullptr;
+				}
+				val = yyjson_obj_getn(val, element.key.c_str(), element.key.size());
+				break;
+			case JSONPathElementType::INDEX:
+				if (!yyjson_is_arr(val)) {
+					return nullptr;
+				}
+				val = yyjson_arr_get(val, element.index);
+				break;
+			case JSONPathElementType::INDEX_FROM_BACK: {
+				if (!yyjson_is_arr(val)) {
+					return nullptr;
+				}
+				auto arr_size = yyjson_arr_size(val);
+				val = yyjson_arr_get(val, element.index > arr_size ? arr_size : arr_size - element.index);
+				break;
+			}
+			}
+		}
+		return val;
+	}
+};
+
 struct JSONReadFunctionData : public FunctionData {
 public:
 	JSONReadFunctionData(bool constant, string path_p, idx_t len);
@@ -30,6 +92,8 @@ public:
 	const string path;
 	const char *ptr;
 	const size_t len;
+	//! The compiled path (if the path is constant)
+	JSONCompiledPath compiled_path;
 };
 
 struct JSONReadManyFunctionData : public FunctionData {
@@ -44,6 +108,7 @@ public:
 	const vector<string> paths;
 	vector<const char *> ptrs;
 	const vector<size_t> lens;
+	vector<JSONCompiledPath> compiled_paths;
 };
 
 template <class YYJSON_DOC_T>
@@ -102,6 +167,8 @@ public:
 };
 
 struct JSONCommon {
+	friend struct JSONCompiledPath;
+
 private:
 	//! Read/Write flag that make sense for us
 	static constexpr auto READ_FLAG = YYJSON_READ_ALLOW_INF_AND_NAN | YYJSON_READ_ALLOW_TRAILING_COMMAS;
@@ -152,6 +219,10 @@ public:
 	static inline DocPointer<yyjson_doc> ReadDocumentUnsafe(const string_t &input) {
 		return DocPointer<yyjson_doc>(yyjson_read(input.GetDataUnsafe(), input.GetSize(), READ_FLAG));
 	}
+	//! Read JSON document from a buffer (returns nullptr and sets the error if invalid JSON)
+	static inline DocPointer<yyjson_doc> ReadDocumentUnsafe(const char *data, idx_t size, yyjson_read_err *error) {
+		return DocPointer<yyjson_doc>(yyjson_read_opts((char *)data, size, READ_FLAG, nullptr, error));
+	}
 	//! Read JSON document (throws error if malformed JSON)
 	static inline DocPointer<yyjson_doc> ReadDocument(const string_t &input) {
 		auto result = ReadDocumentUnsafe(input);
@@ -160,6 +231,36 @@ public:
 		}
 		return result;
 	}
+	//! Read JSON document from either text or binary JSON (throws error if malformed)
+	static inline DocPointer<yyjson_doc> ReadDocument(const string_t &input, bool binary) {
+		if (!binary) {
+			return ReadDocument(input);
+		}
+		auto result = ReadBinaryUnsafe(input);
+		if (result.IsNull()) {
+			throw InvalidInputException("malformed JSONB");
+		}
+		return result;
+	}
+
+public:
+	//! The binary JSON type, which stores the parsed values, so that they do not have to be parsed again
+	static LogicalType JSONBType() {
+		LogicalType result(LogicalTypeId::BLOB);
+		result.SetAlias("JSONB");
+		return result;
+	}
+	static bool IsJSONB(const LogicalType &type) {
+		return type.id() == LogicalTypeId::BLOB && type.GetAlias() == "JSONB";
+	}
+	//! Writes a parsed document as binary JSON: the yyjson values as they are laid out in the document, followed by
+	//! the strings, which the string values refer to by offset instead of by pointer
+	static string_t WriteBinary(yyjson_doc *doc, Vector &vector);
+	//! Read a document from binary JSON, which only requires copying the values and setting the string pointers
+	//! (returns nullptr if the binary JSON is invalid)
+	static DocPointer<yyjson_doc> ReadBinaryUnsafe(const string_t &input);
+
+public:
 	//! Some wrappers around writes so we don't have to free the malloc'ed char[]
 	static inline unique_ptr<char, void (*)(void *)> WriteVal(yyjson_val *val, idx_t &len) {
 		return unique_ptr<char, decltype(free) *>(
@@ -247,8 +348,9 @@ public:
 	static void UnaryExecute(DataChunk &args, ExpressionState &state, Vector &result,
 	                         std::function<T(yyjson_val *, Vector &)> fun) {
 		auto &inputs = args.data[0];
+		const auto binary = IsJSONB(inputs.GetType());
 		UnaryExecutor::Execute<string_t, T>(inputs, result, args.size(), [&](string_t input) {
-			auto doc = JSONCommon::ReadDocument(input);
+			auto doc = JSONCommon::ReadDocument(input, binary);
 			return fun(doc->root, result);
 		});
 	}
@@ -261,15 +363,15 @@ public:
 		const auto &info = (JSONReadFunctionData &)*func_expr.bind_info;
 
 		auto &inputs = args.data[0];
+		const auto binary = IsJSONB(inputs.GetType());
 		if (info.constant) {
 			// Constant path
-			const char *ptr = info.ptr;
-			const idx_t &len = info.len;
+			const auto &path = info.compiled_path;
 			UnaryExecutor::ExecuteWithNulls<string_t, T>(
 			    inputs, result, args.size(), [&](string_t input, ValidityMask &mask, idx_t idx) {
-				    auto doc = ReadDocument(input);
+				    auto doc = ReadDocument(input, binary);
 				    yyjson_val *val;
-				    if (!(val = GetPointerUnsafe<yyjson_val>(doc->root, ptr, len))) {
+				    if (!(val = path.Get(doc->root))) {
 					    mask.SetInvalid(idx);
 					    return T {};
 				    } else {
@@ -281,7 +383,7 @@ public:
 			auto &paths = args.data[1];
 			BinaryExecutor::ExecuteWithNulls<string_t, string_t, T>(
 			    inputs, paths, result, args.size(), [&](string_t input, string_t path, ValidityMask &mask, idx_t idx) {
-				    auto doc = ReadDocument(input);
+				    auto doc = ReadDocument(input, binary);
 				    yyjson_val *val;
 				    if (!(val = GetPointer<yyjson_val>(doc->root, path))) {
 					    mask.SetInvalid(idx);
@@ -302,15 +404,16 @@ public:
 	                        std::function<T(yyjson_val *, Vector &)> fun) {
 		auto &func_expr = (BoundFunctionExpression &)state.expr;
 		const auto &info = (JSONReadManyFunctionData &)*func_expr.bind_info;
-		D_ASSERT(info.ptrs.size() == info.lens.size());
+		D_ASSERT(info.compiled_paths.size() == info.lens.size());
 
 		const auto count = args.size();
-		const idx_t num_paths = info.ptrs.size();
+		const idx_t num_paths = info.compiled_paths.size();
 		const idx_t list_size = count * num_paths;
 
 		UnifiedVectorFormat input_data;
 		auto &input_vector = args.data[0];
 		input_vector.ToUnifiedFormat(count, input_data);
+		const auto binary = IsJSONB(input_vector.GetType());
 		auto inputs = (string_t *)input_data.data;
 
 		ListVector::Reserve(result, list_size);
@@ -330,10 +433,10 @@ public:
 				continue;
 			}
 
-			auto doc = ReadDocument(inputs[idx]);
+			auto doc = ReadDocument(inputs[idx], binary);
 			for (idx_t path_i = 0; path_i < num_paths; path_i++) {
 				auto child_idx = offset + path_i;
-				if (!(val = GetPointerUnsafe<yyjson_val>(doc->root, info.ptrs[path_i], info.lens[path_i]))) {
+				if (!(val = info.compiled_paths[path_i].Get(doc->root))) {
 					child_validity.SetInvalid(child_idx);
 				} else {
 					child_data[child_idx] = fun(val, child);
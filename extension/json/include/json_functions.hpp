@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 
 namespace duckdb {
 
@@ -18,8 +19,9 @@ public:
 		vector<CreateScalarFunctionInfo> functions;
 
 		// Extract functions
-		AddAliases({"json_extract", "json_extract_path"}, GetExtractFunction(), functions);
-		AddAliases({"json_extract_string", "json_extract_path_text", "->>"}, GetExtractStringFunction(), functions);
+		AddAliases({"json_extract", "json_extract_path"}, AddJSONBOverloads(GetExtractFunction()), functions);
+		AddAliases({"json_extract_string", "json_extract_path_text", "->>"},
+		           AddJSONBOverloads(GetExtractStringFunction()), functions);
 
 		// Create functions
 		functions.push_back(GetArrayFunction());
@@ -30,19 +32,29 @@ public:
 		functions.push_back(GetMergePatchFunction());
 
 		// Structure/Transform
-		functions.push_back(GetStructureFunction());
-		AddAliases({"json_transform", "from_json"}, GetTransformFunction(), functions);
-		AddAliases({"json_transform_strict", "from_json_strict"}, GetTransformStrictFunction(), functions);
+		functions.push_back(AddJSONBOverloads(GetStructureFunction()));
+		AddAliases({"json_transform", "from_json"}, AddJSONBOverloads(GetTransformFunction()), functions);
+		AddAliases({"json_transform_strict", "from_json_strict"}, AddJSONBOverloads(GetTransformStrictFunction()),
+		           functions);
 
 		// Other
-		functions.push_back(GetArrayLengthFunction());
+		functions.push_back(AddJSONBOverloads(GetArrayLengthFunction()));
 		functions.push_back(GetContainsFunction());
-		functions.push_back(GetTypeFunction());
+		functions.push_back(AddJSONBOverloads(GetTypeFunction()));
 		functions.push_back(GetValidFunction());
 
 		return functions;
 	}
 
+	static vector<CreateTableFunctionInfo> GetTableFunctions() {
+		vector<CreateTableFunctionInfo> functions;
+
+		// Reading JSON files
+		AddAliases({"read_json", "read_ndjson"}, GetReadJSONFunction(), functions);
+
+		return functions;
+	}
+
 private:
 	static CreateScalarFunctionInfo GetExtractFunction();
 	static CreateScalarFunctionInfo GetExtractStringFunction();
@@ -63,8 +75,18 @@ private:
 	static CreateScalarFunctionInfo GetTypeFunction();
 	static CreateScalarFunctionInfo GetValidFunction();
 
-	static void AddAliases(vector<string> names, CreateScalarFunctionInfo fun,
-	                       vector<CreateScalarFunctionInfo> &functions) {
+	static CreateTableFunctionInfo GetReadJSONFunction();
+
+public:
+	//! Registers the binary JSON type (JSONB) and its casts
+	static void RegisterJSONBType(ClientContext &context);
+
+private:
+	//! Adds overloads for JSONB to the functions that read JSON, which read JSONB without parsing it
+	static CreateScalarFunctionInfo AddJSONBOverloads(CreateScalarFunctionInfo info);
+
+	template <class FUNCTION_INFO>
+	static void AddAliases(vector<string> names, FUNCTION_INFO fun, vector<FUNCTION_INFO> &functions) {
 		for (auto &name : names) {
 			fun.name = name;
 			functions.push_back(fun);
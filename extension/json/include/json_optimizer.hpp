@@ -0,0 +1,30 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// json_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/optimizer_extension.hpp"
+
+namespace duckdb {
+
+//! Fuses json_extract calls with constant paths on the same input within a projection
+/*!
+    SELECT j->'$.a', j->'$.b' FROM tbl parses every document twice. The calls are replaced by
+    list_extract(json_extract(j, ['$.a', '$.b']), i), where the fused json_extract is computed once in a projection
+    that is pushed below, so every document is only parsed once.
+*/
+class JSONExtractFusion : public OptimizerExtension {
+public:
+	JSONExtractFusion() {
+		optimize_function = Optimize;
+	}
+
+	static void Optimize(ClientContext &context, OptimizerExtensionInfo *info, unique_ptr<LogicalOperator> &plan);
+};
+
+} // namespace duckdb
@@ -0,0 +1,32 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// json_structure.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "json_common.hpp"
+
+namespace duckdb {
+
+struct JSONStructure {
+public:
+	//! Builds the structure of a JSON value (throws if an object in the value has duplicate keys)
+	static yyjson_mut_val *BuildStructure(yyjson_val *val, yyjson_mut_doc *structure_doc);
+	//! Merges the structures of multiple values into a structure that fits all of them
+	//! Throws if the structures are inconsistent (e.g. an object and an array)
+	static yyjson_mut_val *MergeStructures(const vector<yyjson_mut_val *> &structures, yyjson_mut_doc *structure_doc);
+	//! Returns the type that values with the given structure are transformed into
+	static LogicalType StructureToType(yyjson_mut_val *structure);
+};
+
+struct JSONTransform {
+public:
+	//! Transforms JSON values into the type of the result vector (values that are nullptr become NULL)
+	static void Transform(yyjson_val *vals[], Vector &result, const idx_t count, bool strict);
+};
+
+} // namespace duckdb
@@ -8,6 +8,7 @@
 #include "duckdb/parser/tableref/table_function_ref.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "json_functions.hpp"
+#include "json_optimizer.hpp"
 
 namespace duckdb {
 
@@ -31,9 +32,13 @@ void JSONExtension::Load(DuckDB &db) {
 	con.BeginTransaction();
 
 	auto &catalog = Catalog::GetCatalog(*con.context);
+	JSONFunctions::RegisterJSONBType(*con.context);
 	for (auto &fun : JSONFunctions::GetFunctions()) {
 		catalog.CreateFunction(*con.context, &fun);
 	}
+	for (auto &fun : JSONFunctions::GetTableFunctions()) {
+		catalog.CreateTableFunction(*con.context, &fun);
+	}
 
 	for (idx_t index = 0; json_macros[index].name != nullptr; index++) {
 		auto info = DefaultFunctionGenerator::CreateInternalMacroInfo(json_macros[index]);
@@ -44,6 +49,9 @@ void JSONExtension::Load(DuckDB &db) {
 		catalog.CreateFunction(*con.context, info.get());
 	}
 	con.Commit();
+
+	auto &config = DBConfig::GetConfig(*db.instance);
+	config.optimizer_extensions.push_back(JSONExtractFusion());
 }
 
 std::string JSONExtension::Name() {
@@ -27,8 +27,66 @@ static void CheckPath(const Value &path_val, string &path, size_t &len) {
 	}
 }
 
+JSONCompiledPath::JSONCompiledPath() : ptr(nullptr), len(0) {
+}
+
+JSONCompiledPath::JSONCompiledPath(const char *ptr_p, idx_t len_p) : ptr(ptr_p), len(len_p) {
+	if (len == 0 || *ptr != '$') {
+		return;
+	}
+	// The path was validated already, so we can split it into its elements without checking it again
+	const char *const end = ptr + len;
+	// Skip past '$'
+	auto p = ptr + 1;
+	while (p != end) {
+		const auto &c = *p++;
+		JSONPathElement element;
+		if (c == '.') {
+			// Object
+			bool escaped = false;
+			if (*p == '"') {
+				// Skip past opening '"'
+				p++;
+				escaped = true;
+			}
+			auto key_len = JSONCommon::ReadString(p, end, escaped);
+			element.type = JSONPathElementType::KEY;
+			element.key = string(p, key_len);
+			element.index = 0;
+			p += key_len;
+			if (escaped) {
+				// Skip past closing '"'
+				p++;
+			}
+		} else {
+			D_ASSERT(c == '[');
+			// Array
+			element.type = JSONPathElementType::INDEX;
+			element.index = 0;
+			if (*p == '#') {
+				// Index from back of array, '[#]' is one past the last element
+				element.type = JSONPathElementType::INDEX_FROM_BACK;
+				p++;
+				if (*p != ']') {
+					// Skip past '-'
+					p++;
+					p += JSONCommon::ReadIndex(p, end, element.index);
+				}
+			} else {
+				p += JSONCommon::ReadIndex(p, end, element.index);
+			}
+			// Skip past closing ']'
+			p++;
+		}
+		elements.push_back(move(element));
+	}
+}
+
 JSONReadFunctionData::JSONReadFunctionData(bool constant, string path_p, idx_t len)
     : constant(constant), path(move(path_p)), ptr(path.c_str()), len(len) {
+	if (constant) {
+		compiled_path = JSONCompiledPath(ptr, len);
+	}
 }
 
 unique_ptr<FunctionData> JSONReadFunctionData::Copy() const {
@@ -56,8 +114,9 @@ unique_ptr<FunctionData> JSONReadFunctionData::Bind(ClientContext &context, Scal
 
 JSONReadManyFunctionData::JSONReadManyFunctionData(vector<string> paths_p, vector<size_t> lens_p)
     : paths(move(paths_p)), lens(move(lens_p)) {
-	for (const auto &path : paths) {
-		ptrs.push_back(path.c_str());
+	for (idx_t i = 0; i < paths.size(); i++) {
+		ptrs.push_back(paths[i].c_str());
+		compiled_paths.emplace_back(ptrs[i], lens[i]);
 	}
 }
 
@@ -152,4 +211,189 @@ void JSONCommon::ValidatePathDollar(const char *ptr, const idx_t &len) {
 	}
 }
 
+//! The binary JSON header, followed by the values and the strings
+struct JSONBinaryHeader {
+	static constexpr const uint32_t MAGIC = 0x4A534F4E;
+	static constexpr const uint32_t VERSION = 1;
+
+	uint32_t magic;
+	uint32_t version;
+	uint64_t val_count;
+	uint64_t str_size;
+};
+
+//! Reading binary JSON creates documents that are laid out like the documents that yyjson reads:
+//! the document header, the values and the strings, all in one allocation
+static constexpr const idx_t JSON_DOC_HEADER_VALS =
+    (sizeof(yyjson_doc) + sizeof(yyjson_val) - 1) / sizeof(yyjson_val);
+
+static void *JSONBinaryMalloc(void *ctx, size_t size) {
+	return malloc(size);
+}
+
+static void *JSONBinaryRealloc(void *ctx, void *ptr, size_t size) {
+	return realloc(ptr, size);
+}
+
+static void JSONBinaryFree(void *ctx, void *ptr) {
+	free(ptr);
+}
+
+static const yyjson_alc JSON_BINARY_ALC = {JSONBinaryMalloc, JSONBinaryRealloc, JSONBinaryFree, nullptr};
+
+static inline bool IsStringTag(uint8_t tag) {
+	auto type = tag & YYJSON_TYPE_MASK;
+	return type == YYJSON_TYPE_STR || type == YYJSON_TYPE_RAW;
+}
+
+string_t JSONCommon::WriteBinary(yyjson_doc *doc, Vector &vector) {
+	const auto vals = doc->root;
+	const auto val_count = doc->val_read;
+	idx_t str_size = 0;
+	for (idx_t i = 0; i < val_count; i++) {
+		if (IsStringTag(vals[i].tag)) {
+			str_size += unsafe_yyjson_get_len(&vals[i]) + 1;
+		}
+	}
+	auto size = sizeof(JSONBinaryHeader) + val_count * sizeof(yyjson_val) + str_size;
+	auto result = StringVector::EmptyString(vector, size);
+	auto data = result.GetDataWriteable();
+
+	JSONBinaryHeader header;
+	header.magic = JSONBinaryHeader::MAGIC;
+	header.version = JSONBinaryHeader::VERSION;
+	header.val_count = val_count;
+	header.str_size = str_size;
+	memcpy(data, &header, sizeof(JSONBinaryHeader));
+
+	auto val_data = data + sizeof(JSONBinaryHeader);
+	auto str_data = val_data + val_count * sizeof(yyjson_val);
+	idx_t str_offset = 0;
+	for (idx_t i = 0; i < val_count; i++) {
+		auto val = vals[i];
+		if (IsStringTag(val.tag)) {
+			// strings are referred to by their offset, and are terminated like the strings in yyjson documents
+			auto len = unsafe_yyjson_get_len(&val);
+			memcpy(str_data + str_offset, val.uni.str, len);
+			str_data[str_offset + len] = '\0';
+			val.uni.ofs = str_offset;
+			str_offset += len + 1;
+		}
+		memcpy(val_data + i * sizeof(yyjson_val), &val, sizeof(yyjson_val));
+	}
+	D_ASSERT(str_offset == str_size);
+	result.Finalize();
+	return result;
+}
+
+//! Checks that the values form a single JSON value, and sets the string pointers
+static bool ReadBinaryValues(yyjson_val *vals, idx_t val_count, const char *strings, idx_t str_size) {
+	struct Container {
+		idx_t end;
+		idx_t remaining;
+		bool is_obj;
+	};
+	vector<Container> containers;
+	// the root is the only child of a virtual container that spans all values
+	Container current {val_count, 1, false};
+	idx_t pos = 0;
+	while (true) {
+		if (current.remaining == 0) {
+			if (pos != current.end) {
+				return false;
+			}
+			if (containers.empty()) {
+				return true;
+			}
+			current = containers.back();
+			containers.pop_back();
+			continue;
+		}
+		if (pos >= current.end) {
+			return false;
+		}
+		auto &val = vals[pos];
+		const auto tag = (uint8_t)val.tag;
+		const bool is_key = current.is_obj && current.remaining % 2 == 0;
+		if (is_key && tag != (YYJSON_TYPE_STR | YYJSON_SUBTYPE_NONE)) {
+			return false;
+		}
+		current.remaining--;
+		switch (tag) {
+		case YYJSON_TYPE_NULL | YYJSON_SUBTYPE_NONE:
+		case YYJSON_TYPE_BOOL | YYJSON_SUBTYPE_TRUE:
+		case YYJSON_TYPE_BOOL | YYJSON_SUBTYPE_FALSE:
+		case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_UINT:
+		case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_SINT:
+		case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_REAL:
+			pos++;
+			break;
+		case YYJSON_TYPE_STR | YYJSON_SUBTYPE_NONE:
+		case YYJSON_TYPE_RAW | YYJSON_SUBTYPE_NONE: {
+			auto len = unsafe_yyjson_get_len(&val);
+			auto ofs = val.uni.ofs;
+			if (ofs >= str_size || len >= str_size - ofs || strings[ofs + len] != '\0') {
+				return false;
+			}
+			val.uni.str = strings + ofs;
+			pos++;
+			break;
+		}
+		case YYJSON_TYPE_ARR | YYJSON_SUBTYPE_NONE:
+		case YYJSON_TYPE_OBJ | YYJSON_SUBTYPE_NONE: {
+			// containers store the byte offset to the next value, and the number of elements
+			auto ofs = val.uni.ofs;
+			auto len = unsafe_yyjson_get_len(&val);
+			if (ofs % sizeof(yyjson_val) != 0 || ofs == 0 || ofs / sizeof(yyjson_val) > current.end - pos ||
+			    len > val_count) {
+				return false;
+			}
+			containers.push_back(current);
+			bool is_obj = tag == (YYJSON_TYPE_OBJ | YYJSON_SUBTYPE_NONE);
+			current = Container {pos + ofs / sizeof(yyjson_val), is_obj ? len * 2 : len, is_obj};
+			pos++;
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+}
+
+DocPointer<yyjson_doc> JSONCommon::ReadBinaryUnsafe(const string_t &input) {
+	auto data = input.GetDataUnsafe();
+	auto size = input.GetSize();
+	JSONBinaryHeader header;
+	if (size < sizeof(JSONBinaryHeader)) {
+		return DocPointer<yyjson_doc>(nullptr);
+	}
+	memcpy(&header, data, sizeof(JSONBinaryHeader));
+	if (header.magic != JSONBinaryHeader::MAGIC || header.version != JSONBinaryHeader::VERSION ||
+	    header.val_count == 0 || header.val_count > size / sizeof(yyjson_val) ||
+	    header.str_size != size - sizeof(JSONBinaryHeader) - header.val_count * sizeof(yyjson_val)) {
+		return DocPointer<yyjson_doc>(nullptr);
+	}
+	auto vals_size = header.val_count * sizeof(yyjson_val);
+	auto block = (char *)malloc(JSON_DOC_HEADER_VALS * sizeof(yyjson_val) + vals_size + header.str_size);
+	if (!block) {
+		throw std::bad_alloc();
+	}
+	DocPointer<yyjson_doc> result((yyjson_doc *)block);
+	auto vals = (yyjson_val *)block + JSON_DOC_HEADER_VALS;
+	auto strings = (char *)(vals + header.val_count);
+	memcpy(vals, data + sizeof(JSONBinaryHeader), vals_size);
+	memcpy(strings, data + sizeof(JSONBinaryHeader) + vals_size, header.str_size);
+
+	auto &doc = **result;
+	doc.root = vals;
+	doc.alc = JSON_BINARY_ALC;
+	doc.dat_read = size;
+	doc.val_read = header.val_count;
+	doc.str_pool = nullptr;
+	if (!ReadBinaryValues(vals, header.val_count, strings, header.str_size)) {
+		return DocPointer<yyjson_doc>(nullptr);
+	}
+	return result;
+}
+
 } // namespace duckdb
@@ -0,0 +1,85 @@
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/function/cast/cast_function_set.hpp"
+#include "duckdb/function/cast/default_casts.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/parser/parsed_data/create_type_info.hpp"
+#include "json_common.hpp"
+#include "json_functions.hpp"
+
+namespace duckdb {
+
+static bool CastToJSONB(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	bool success = true;
+	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+	    source, result, count, [&](string_t input, ValidityMask &mask, idx_t idx) {
+		    yyjson_read_err error;
+		    auto doc = JSONCommon::ReadDocumentUnsafe(input.GetDataUnsafe(), input.GetSize(), &error);
+		    if (doc.IsNull()) {
+			    HandleCastError::AssignError(StringUtil::Format("Malformed JSON at byte %llu of input: %s. Input: %s",
+			                                                    error.pos, error.msg, input.GetString()),
+			                                 parameters.error_message);
+			    mask.SetInvalid(idx);
+			    success = false;
+			    return string_t();
+		    }
+		    return JSONCommon::WriteBinary(*doc, result);
+	    });
+	return success;
+}
+
+static bool CastBinaryToJSONB(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	// arbitrary blobs can not be used as binary JSON, so they are checked
+	bool success = true;
+	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+	    source, result, count, [&](string_t input, ValidityMask &mask, idx_t idx) {
+		    if (JSONCommon::ReadBinaryUnsafe(input).IsNull()) {
+			    HandleCastError::AssignError("BLOB is not valid JSONB", parameters.error_message);
+			    mask.SetInvalid(idx);
+			    success = false;
+			    return string_t();
+		    }
+		    return StringVector::AddStringOrBlob(result, input);
+	    });
+	return success;
+}
+
+static bool CastFromJSONB(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	UnaryExecutor::Execute<string_t, string_t>(source, result, count, [&](string_t input) {
+		auto doc = JSONCommon::ReadDocument(input, true);
+		return JSONCommon::WriteVal(doc->root, result);
+	});
+	return true;
+}
+
+void JSONFunctions::RegisterJSONBType(ClientContext &context) {
+	auto jsonb_type = JSONCommon::JSONBType();
+	CreateTypeInfo info("JSONB", jsonb_type);
+	info.temporary = true;
+	info.internal = true;
+	Catalog::GetCatalog(context).CreateType(context, &info);
+
+	// JSON is converted when it is inserted into JSONB, JSONB can be used wherever JSON is expected
+	auto &casts = DBConfig::GetConfig(context).GetCastFunctions();
+	casts.RegisterCastFunction(LogicalType::VARCHAR, jsonb_type, CastToJSONB);
+	casts.RegisterCastFunction(LogicalType::JSON, jsonb_type, CastToJSONB);
+	casts.RegisterCastFunction(LogicalType::BLOB, jsonb_type, CastBinaryToJSONB);
+	casts.RegisterCastFunction(jsonb_type, LogicalType::JSON, CastFromJSONB, 100);
+	casts.RegisterCastFunction(jsonb_type, LogicalType::VARCHAR, CastFromJSONB);
+	casts.RegisterCastFunction(jsonb_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast);
+}
+
+CreateScalarFunctionInfo JSONFunctions::AddJSONBOverloads(CreateScalarFunctionInfo info) {
+	auto jsonb_type = JSONCommon::JSONBType();
+	auto &set = info.functions;
+	auto function_count = set.functions.size();
+	for (idx_t i = 0; i < function_count; i++) {
+		auto function = set.functions[i];
+		if (!function.arguments.empty() && function.arguments[0] == LogicalType::JSON) {
+			function.arguments[0] = jsonb_type;
+			set.AddFunction(move(function));
+		}
+	}
+	return info;
+}
+
+} // namespace duckdb
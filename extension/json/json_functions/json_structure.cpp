@@ -1,5 +1,6 @@
 #include "json_common.hpp"
 #include "json_functions.hpp"
+#include "json_structure.hpp"
 
 namespace duckdb {
 
@@ -208,6 +209,39 @@ static void StructureFunction(DataChunk &args, ExpressionState &state, Vector &r
 	JSONCommon::UnaryExecute<string_t>(args, state, result, Structure);
 }
 
+yyjson_mut_val *JSONStructure::BuildStructure(yyjson_val *val, yyjson_mut_doc *structure_doc) {
+	return duckdb::BuildStructure(val, structure_doc);
+}
+
+yyjson_mut_val *JSONStructure::MergeStructures(const vector<yyjson_mut_val *> &structures,
+                                               yyjson_mut_doc *structure_doc) {
+	return GetConsistentArrayStructure(structures, structure_doc);
+}
+
+LogicalType JSONStructure::StructureToType(yyjson_mut_val *structure) {
+	switch (yyjson_mut_get_tag(structure)) {
+	case YYJSON_TYPE_NULL | YYJSON_SUBTYPE_NONE:
+		// only NULL values: the type is unknown
+		return LogicalType::JSON;
+	case YYJSON_TYPE_ARR | YYJSON_SUBTYPE_NONE:
+		return LogicalType::LIST(StructureToType(yyjson_mut_arr_get_first(structure)));
+	case YYJSON_TYPE_OBJ | YYJSON_SUBTYPE_NONE: {
+		if (yyjson_mut_obj_size(structure) == 0) {
+			return LogicalType::JSON;
+		}
+		child_list_t<LogicalType> child_types;
+		size_t idx, max;
+		yyjson_mut_val *key, *val;
+		yyjson_mut_obj_foreach(structure, idx, max, key, val) {
+			child_types.emplace_back(string(yyjson_mut_get_str(key), yyjson_mut_get_len(key)), StructureToType(val));
+		}
+		return LogicalType::STRUCT(move(child_types));
+	}
+	default:
+		return TransformStringToLogicalType(JSONCommon::ValTypeToString<yyjson_mut_val>(structure));
+	}
+}
+
 CreateScalarFunctionInfo JSONFunctions::GetStructureFunction() {
 	return CreateScalarFunctionInfo(
 	    ScalarFunction("json_structure", {LogicalType::JSON}, LogicalType::JSON, StructureFunction));
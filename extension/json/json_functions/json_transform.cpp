@@ -2,6 +2,7 @@
 #include "duckdb/function/scalar/nested_functions.hpp"
 #include "json_common.hpp"
 #include "json_functions.hpp"
+#include "json_structure.hpp"
 
 namespace duckdb {
 
@@ -237,6 +238,19 @@ static void TransformToString(yyjson_val *vals[], Vector &result, const idx_t co
 	}
 }
 
+static void TransformToJSON(yyjson_val *vals[], Vector &result, const idx_t count) {
+	auto data = (string_t *)FlatVector::GetData(result);
+	auto &validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		const auto &val = vals[i];
+		if (!val || yyjson_is_null(val)) {
+			validity.SetInvalid(i);
+		} else {
+			data[i] = JSONCommon::WriteVal(val, result);
+		}
+	}
+}
+
 static void TransformObject(yyjson_val *vals[], Vector &result, const idx_t count, const LogicalType &type,
                             bool strict) {
 	// Initialize array for the nested values
@@ -353,6 +367,7 @@ static void Transform(yyjson_val *vals[], Vector &result, const idx_t count, boo
 	case LogicalTypeId::UUID:
 		return TransformFromString(vals, result, count, result_type, strict);
 	case LogicalTypeId::JSON:
+		return TransformToJSON(vals, result, count);
 	case LogicalTypeId::VARCHAR:
 	case LogicalTypeId::BLOB:
 		return TransformToString(vals, result, count);
@@ -365,6 +380,10 @@ static void Transform(yyjson_val *vals[], Vector &result, const idx_t count, boo
 	}
 }
 
+void JSONTransform::Transform(yyjson_val *vals[], Vector &result, const idx_t count, bool strict) {
+	duckdb::Transform(vals, result, count, strict);
+}
+
 template <bool strict>
 static void TransformFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	const auto count = args.size();
@@ -372,6 +391,7 @@ static void TransformFunction(DataChunk &args, ExpressionState &state, Vector &r
 	UnifiedVectorFormat input_data;
 	input.ToUnifiedFormat(count, input_data);
 	auto inputs = (string_t *)input_data.data;
+	const auto binary = JSONCommon::IsJSONB(input.GetType());
 	// Read documents
 	vector<DocPointer<yyjson_doc>> docs;
 	docs.reserve(count);
@@ -384,7 +404,7 @@ static void TransformFunction(DataChunk &args, ExpressionState &state, Vector &r
 			vals[i] = nullptr;
 			result_validity.SetInvalid(i);
 		} else {
-			docs.emplace_back(JSONCommon::ReadDocument(inputs[idx]));
+			docs.emplace_back(JSONCommon::ReadDocument(inputs[idx], binary));
 			vals[i] = docs.back()->root;
 		}
 	}
@@ -0,0 +1,397 @@
+#include "duckdb/common/enums/file_compression_type.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "json_common.hpp"
+#include "json_functions.hpp"
+#include "json_structure.hpp"
+
+namespace duckdb {
+
+struct ReadJSONData : public TableFunctionData {
+	//! The files to read
+	vector<string> files;
+	//! The names and types of the columns
+	vector<string> names;
+	vector<LogicalType> types;
+	//! The amount of JSON objects that are sampled to detect the columns
+	idx_t sample_size = 10 * STANDARD_VECTOR_SIZE;
+	//! The maximum size of a single JSON object (i.e., line) in bytes
+	idx_t maximum_object_size = 16777216;
+	//! Whether or not malformed objects and values that can not be converted are ignored
+	bool ignore_errors = false;
+	FileCompressionType compression = FileCompressionType::AUTO_DETECT;
+};
+
+//! A buffer that contains complete lines of a file
+struct JSONBuffer {
+	unique_ptr<char[]> data;
+	idx_t size = 0;
+	idx_t position = 0;
+	//! The index of the buffer in the scan (used to preserve the insertion order)
+	idx_t batch_index = 0;
+	string file_path;
+
+	bool Exhausted() const {
+		return position >= size;
+	}
+};
+
+static void ThrowObjectSizeError(const string &file_path, idx_t maximum_object_size) {
+	throw InvalidInputException("JSON object in file \"%s\" is larger than the maximum object size (%llu bytes), "
+	                            "increase the MAXIMUM_OBJECT_SIZE option",
+	                            file_path, maximum_object_size);
+}
+
+//! Reads files sequentially into buffers that end at a newline, so that the buffers can be parsed independently
+class JSONBufferReader {
+public:
+	//! The buffer size is chosen so that each thread gets a part of the file, within these bounds
+	static constexpr const idx_t MINIMUM_BUFFER_SIZE = 1 << 14;
+	static constexpr const idx_t MAXIMUM_BUFFER_SIZE = 1 << 24;
+
+	JSONBufferReader(ClientContext &context, const ReadJSONData &bind_data, idx_t max_threads)
+	    : fs(FileSystem::GetFileSystem(context)), opener(FileSystem::GetFileOpener(context)), bind_data(bind_data),
+	      max_threads(max_threads) {
+	}
+
+	//! Reads the next buffer, returns false if all files have been read
+	bool ReadBuffer(JSONBuffer &buffer) {
+		while (true) {
+			if (!file_handle) {
+				if (file_index >= bind_data.files.size()) {
+					return false;
+				}
+				OpenFile(bind_data.files[file_index++]);
+			}
+			// the buffer starts with the incomplete line at the end of the previous buffer
+			auto capacity = remainder.size() + buffer_size;
+			buffer.data = unique_ptr<char[]>(new char[capacity]);
+			memcpy(buffer.data.get(), remainder.c_str(), remainder.size());
+			auto read_count = ReadFile(buffer.data.get() + remainder.size(), buffer_size);
+			auto total_size = remainder.size() + read_count;
+			buffer.file_path = file_handle->path;
+			buffer.position = 0;
+			if (read_count == 0) {
+				// end of the file: the remainder is the last line (which does not end with a newline)
+				file_handle.reset();
+				remainder.clear();
+				if (total_size == 0) {
+					continue;
+				}
+				buffer.size = total_size;
+				buffer.batch_index = batch_index++;
+				return true;
+			}
+			// the buffer ends at the last newline
+			idx_t end = total_size;
+			while (end > 0 && buffer.data[end - 1] != '\n') {
+				end--;
+			}
+			if (end == 0) {
+				// no complete line yet: keep reading
+				if (total_size > bind_data.maximum_object_size) {
+					ThrowObjectSizeError(file_handle->path, bind_data.maximum_object_size);
+				}
+				remainder = string(buffer.data.get(), total_size);
+				continue;
+			}
+			remainder = string(buffer.data.get() + end, total_size - end);
+			buffer.size = end;
+			buffer.batch_index = batch_index++;
+			return true;
+		}
+	}
+
+private:
+	void OpenFile(const string &path) {
+		file_handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ, FileLockType::NO_LOCK, bind_data.compression,
+		                          opener);
+		auto file_size = file_handle->GetFileSize();
+		buffer_size = MaxValue<idx_t>(MinValue<idx_t>(file_size / max_threads, MAXIMUM_BUFFER_SIZE),
+		                              MINIMUM_BUFFER_SIZE);
+	}
+
+	idx_t ReadFile(char *target, idx_t nr_bytes) {
+		// pipes can return fewer bytes than requested before they end
+		idx_t total_read = 0;
+		while (total_read < nr_bytes) {
+			auto read_count = file_handle->Read(target + total_read, nr_bytes - total_read);
+			if (read_count <= 0) {
+				break;
+			}
+			total_read += read_count;
+		}
+		return total_read;
+	}
+
+	FileSystem &fs;
+	FileOpener *opener;
+	const ReadJSONData &bind_data;
+	idx_t max_threads;
+
+	unique_ptr<FileHandle> file_handle;
+	idx_t file_index = 0;
+	idx_t buffer_size = MINIMUM_BUFFER_SIZE;
+	//! The incomplete line at the end of the previous buffer
+	string remainder;
+	idx_t batch_index = 0;
+};
+
+//! Parses the next JSON object of the buffer, returns nullptr if the buffer is exhausted
+static yyjson_val *ReadNextObject(JSONBuffer &buffer, const ReadJSONData &bind_data,
+                                  vector<DocPointer<yyjson_doc>> &docs) {
+	while (!buffer.Exhausted()) {
+		auto line = buffer.data.get() + buffer.position;
+		auto newline = (const char *)memchr(line, '\n', buffer.size - buffer.position);
+		idx_t line_size = newline ? newline - line : buffer.size - buffer.position;
+		buffer.position += line_size + 1;
+		if (line_size > bind_data.maximum_object_size) {
+			ThrowObjectSizeError(buffer.file_path, bind_data.maximum_object_size);
+		}
+		// skip empty lines
+		idx_t start = 0;
+		while (start < line_size && StringUtil::CharacterIsSpace(line[start])) {
+			start++;
+		}
+		if (start == line_size) {
+			continue;
+		}
+		yyjson_read_err error;
+		auto doc = JSONCommon::ReadDocumentUnsafe(line + start, line_size - start, &error);
+		if (doc.IsNull()) {
+			if (bind_data.ignore_errors) {
+				continue;
+			}
+			throw InvalidInputException("Malformed JSON in file \"%s\": %s at byte %llu of line \"%s\"",
+			                            buffer.file_path, error.msg, error.pos,
+			                            string(line, MinValue<idx_t>(line_size, 100)));
+		}
+		auto root = doc->root;
+		if (!yyjson_is_obj(root)) {
+			if (bind_data.ignore_errors) {
+				continue;
+			}
+			throw InvalidInputException("Expected a JSON object in file \"%s\", but found %s: \"%s\"", buffer.file_path,
+			                            JSONCommon::ValTypeToString<yyjson_val>(root),
+			                            string(line, MinValue<idx_t>(line_size, 100)));
+		}
+		docs.push_back(move(doc));
+		return root;
+	}
+	return nullptr;
+}
+
+//! Detects the columns from the structure of the first objects
+static void DetectColumns(ClientContext &context, ReadJSONData &bind_data) {
+	auto structure_doc = JSONCommon::CreateDocument();
+	vector<string> keys;
+	unordered_map<string, vector<yyjson_mut_val *>> key_structures;
+	unordered_set<string> inconsistent_keys;
+
+	JSONBufferReader reader(context, bind_data, 1);
+	JSONBuffer buffer;
+	idx_t object_count = 0;
+	while (object_count < bind_data.sample_size) {
+		vector<DocPointer<yyjson_doc>> docs;
+		auto root = ReadNextObject(buffer, bind_data, docs);
+		if (!root) {
+			if (!reader.ReadBuffer(buffer)) {
+				break;
+			}
+			continue;
+		}
+		object_count++;
+		size_t idx, max;
+		yyjson_val *key, *val;
+		yyjson_obj_foreach(root, idx, max, key, val) {
+			string key_string(yyjson_get_str(key), yyjson_get_len(key));
+			auto entry = key_structures.find(key_string);
+			if (entry == key_structures.end()) {
+				keys.push_back(key_string);
+				entry = key_structures.insert(make_pair(key_string, vector<yyjson_mut_val *>())).first;
+			}
+			try {
+				entry->second.push_back(JSONStructure::BuildStructure(val, *structure_doc));
+			} catch (InvalidInputException &ex) {
+				inconsistent_keys.insert(key_string);
+			}
+		}
+	}
+	if (keys.empty()) {
+		throw InvalidInputException("Could not detect the columns of \"%s\": no JSON objects with keys were found, "
+		                            "specify the columns with the COLUMNS option",
+		                            bind_data.files[0]);
+	}
+	for (auto &key : keys) {
+		// values whose structure is inconsistent (e.g. both objects and numbers) are read as JSON
+		LogicalType type = LogicalType::JSON;
+		if (inconsistent_keys.find(key) == inconsistent_keys.end()) {
+			try {
+				auto structure = JSONStructure::MergeStructures(key_structures[key], *structure_doc);
+				type = JSONStructure::StructureToType(structure);
+			} catch (InvalidInputException &ex) {
+				type = LogicalType::JSON;
+			}
+		}
+		bind_data.names.push_back(key);
+		bind_data.types.push_back(move(type));
+	}
+}
+
+static unique_ptr<FunctionData> ReadJSONBind(ClientContext &context, TableFunctionBindInput &input,
+                                             vector<LogicalType> &return_types, vector<string> &names) {
+	auto &config = DBConfig::GetConfig(context);
+	if (!config.options.enable_external_access) {
+		throw PermissionException("Scanning JSON files is disabled through configuration");
+	}
+	auto result = make_unique<ReadJSONData>();
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto file_pattern = StringValue::Get(input.inputs[0]);
+	result->files = fs.Glob(file_pattern, context);
+	if (result->files.empty()) {
+		throw IOException("No files found that match the pattern \"%s\"", file_pattern);
+	}
+
+	for (auto &kv : input.named_parameters) {
+		auto loption = StringUtil::Lower(kv.first);
+		if (loption == "columns") {
+			auto &child_type = kv.second.type();
+			if (child_type.id() != LogicalTypeId::STRUCT) {
+				throw BinderException("read_json columns requires a struct as input");
+			}
+			auto &struct_children = StructValue::GetChildren(kv.second);
+			D_ASSERT(StructType::GetChildCount(child_type) == struct_children.size());
+			for (idx_t i = 0; i < struct_children.size(); i++) {
+				auto &val = struct_children[i];
+				if (val.type().id() != LogicalTypeId::VARCHAR) {
+					throw BinderException("read_json requires a type specification as string");
+				}
+				result->names.push_back(StructType::GetChildName(child_type, i));
+				result->types.push_back(TransformStringToLogicalType(StringValue::Get(val)));
+			}
+			if (result->names.empty()) {
+				throw BinderException("read_json requires at least a single column as input!");
+			}
+		} else if (loption == "sample_size") {
+			auto sample_size = kv.second.GetValue<int64_t>();
+			if (sample_size <= 0) {
+				throw BinderException("read_json sample_size must be positive");
+			}
+			result->sample_size = sample_size;
+		} else if (loption == "maximum_object_size") {
+			result->maximum_object_size = kv.second.GetValue<uint32_t>();
+		} else if (loption == "ignore_errors") {
+			result->ignore_errors = BooleanValue::Get(kv.second);
+		} else if (loption == "compression") {
+			result->compression = FileCompressionTypeFromString(StringValue::Get(kv.second));
+		}
+	}
+	if (result->names.empty()) {
+		DetectColumns(context, *result);
+	}
+	names = result->names;
+	return_types = result->types;
+	return move(result);
+}
+
+struct ReadJSONGlobalState : public GlobalTableFunctionState {
+	ReadJSONGlobalState(ClientContext &context, const ReadJSONData &bind_data, idx_t max_threads)
+	    : reader(context, bind_data, max_threads), max_threads(max_threads) {
+	}
+
+	mutex lock;
+	JSONBufferReader reader;
+	idx_t max_threads;
+	vector<column_t> column_ids;
+
+	idx_t MaxThreads() const override {
+		return max_threads;
+	}
+
+	bool ReadBuffer(JSONBuffer &buffer) {
+		lock_guard<mutex> guard(lock);
+		return reader.ReadBuffer(buffer);
+	}
+};
+
+struct ReadJSONLocalState : public LocalTableFunctionState {
+	JSONBuffer buffer;
+};
+
+static unique_ptr<GlobalTableFunctionState> ReadJSONInitGlobal(ClientContext &context,
+                                                               TableFunctionInitInput &input) {
+	auto &bind_data = (ReadJSONData &)*input.bind_data;
+	auto result = make_unique<ReadJSONGlobalState>(context, bind_data, context.db->NumberOfThreads());
+	result->column_ids = input.column_ids;
+	return move(result);
+}
+
+static unique_ptr<LocalTableFunctionState> ReadJSONInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                             GlobalTableFunctionState *global_state) {
+	return make_unique<ReadJSONLocalState>();
+}
+
+static void ReadJSONFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = (ReadJSONData &)*data_p.bind_data;
+	auto &gstate = (ReadJSONGlobalState &)*data_p.global_state;
+	auto &lstate = (ReadJSONLocalState &)*data_p.local_state;
+
+	// all objects of a chunk come from the same buffer, so that the chunk has a single batch index
+	vector<DocPointer<yyjson_doc>> docs;
+	yyjson_val *objects[STANDARD_VECTOR_SIZE];
+	idx_t count = 0;
+	while (count == 0) {
+		if (lstate.buffer.Exhausted() && !gstate.ReadBuffer(lstate.buffer)) {
+			return;
+		}
+		while (count < STANDARD_VECTOR_SIZE) {
+			auto object = ReadNextObject(lstate.buffer, bind_data, docs);
+			if (!object) {
+				break;
+			}
+			objects[count++] = object;
+		}
+	}
+
+	// transform the values of the projected columns directly into the output vectors
+	yyjson_val *vals[STANDARD_VECTOR_SIZE];
+	for (idx_t col_idx = 0; col_idx < gstate.column_ids.size(); col_idx++) {
+		auto column_id = gstate.column_ids[col_idx];
+		auto &result = output.data[col_idx];
+		if (IsRowIdColumnId(column_id)) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+			ConstantVector::SetNull(result, true);
+			continue;
+		}
+		auto &name = bind_data.names[column_id];
+		for (idx_t i = 0; i < count; i++) {
+			vals[i] = yyjson_obj_getn(objects[i], name.c_str(), name.size());
+		}
+		JSONTransform::Transform(vals, result, count, !bind_data.ignore_errors);
+	}
+	output.SetCardinality(count);
+}
+
+static idx_t ReadJSONGetBatchIndex(ClientContext &context, const FunctionData *bind_data_p,
+                                   LocalTableFunctionState *local_state, GlobalTableFunctionState *global_state) {
+	auto &lstate = (ReadJSONLocalState &)*local_state;
+	return lstate.buffer.batch_index;
+}
+
+CreateTableFunctionInfo JSONFunctions::GetReadJSONFunction() {
+	TableFunction read_json("read_json", {LogicalType::VARCHAR}, ReadJSONFunction, ReadJSONBind, ReadJSONInitGlobal,
+	                        ReadJSONInitLocal);
+	read_json.named_parameters["columns"] = LogicalType::ANY;
+	read_json.named_parameters["sample_size"] = LogicalType::BIGINT;
+	read_json.named_parameters["maximum_object_size"] = LogicalType::UINTEGER;
+	read_json.named_parameters["ignore_errors"] = LogicalType::BOOLEAN;
+	read_json.named_parameters["compression"] = LogicalType::VARCHAR;
+	read_json.projection_pushdown = true;
+	read_json.get_batch_index = ReadJSONGetBatchIndex;
+	return CreateTableFunctionInfo(read_json);
+}
+
+} // namespace duckdb
@@ -0,0 +1,212 @@
+#include "json_optimizer.hpp"
+
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "json_common.hpp"
+
+namespace duckdb {
+
+//! The json_extract calls with the same function and input, which are fused into a single call
+struct JSONExtractGroup {
+	string function_name;
+	unique_ptr<Expression> input;
+	//! The distinct paths that are extracted
+	vector<string> paths;
+	//! The amount of calls
+	idx_t count = 0;
+	//! The column index of the fused call in the pushed down projection
+	idx_t column_index = DConstants::INVALID_INDEX;
+
+	idx_t PathIndex(const string &path) const {
+		return std::find(paths.begin(), paths.end(), path) - paths.begin();
+	}
+};
+
+struct JSONExtractFusionState {
+	explicit JSONExtractFusionState(ClientContext &context) : context(context) {
+	}
+
+	ClientContext &context;
+	vector<JSONExtractGroup> groups;
+	//! The projection index of the new projection
+	idx_t projection_index;
+	//! Map of column bindings to column indexes in the projection expression list
+	column_binding_map_t<idx_t> column_map;
+	//! The set of expressions of the resulting projection
+	vector<unique_ptr<Expression>> expressions;
+};
+
+static bool IsFusableExtract(Expression &expr) {
+	if (expr.expression_class != ExpressionClass::BOUND_FUNCTION) {
+		return false;
+	}
+	auto &func = (BoundFunctionExpression &)expr;
+	if (func.function.name != "json_extract" && func.function.name != "json_extract_string") {
+		return false;
+	}
+	// only extractions of a single constant path are fused
+	if (func.children.size() != 2 || func.function.arguments[1].id() != LogicalTypeId::VARCHAR || !func.bind_info) {
+		return false;
+	}
+	auto &info = (JSONReadFunctionData &)*func.bind_info;
+	return info.constant && !func.children[0]->HasSideEffects();
+}
+
+static JSONExtractGroup *FindGroup(JSONExtractFusionState &state, BoundFunctionExpression &func) {
+	for (auto &group : state.groups) {
+		if (group.function_name == func.function.name && group.input->Equals(func.children[0].get())) {
+			return &group;
+		}
+	}
+	return nullptr;
+}
+
+static bool SkipChildren(Expression &expr) {
+	// skip conjunctions and case, since short-circuiting might be incorrectly disabled otherwise
+	return expr.expression_class == ExpressionClass::BOUND_CONJUNCTION ||
+	       expr.expression_class == ExpressionClass::BOUND_CASE;
+}
+
+static void CountExtractions(Expression &expr, JSONExtractFusionState &state) {
+	if (SkipChildren(expr)) {
+		return;
+	}
+	if (IsFusableExtract(expr)) {
+		auto &func = (BoundFunctionExpression &)expr;
+		auto group = FindGroup(state, func);
+		if (!group) {
+			state.groups.emplace_back();
+			group = &state.groups.back();
+			group->function_name = func.function.name;
+			group->input = func.children[0]->Copy();
+		}
+		auto &path = ((JSONReadFunctionData &)*func.bind_info).path;
+		if (group->PathIndex(path) == group->paths.size()) {
+			group->paths.push_back(path);
+		}
+		group->count++;
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { CountExtractions(child, state); });
+}
+
+static unique_ptr<Expression> BindFunction(ClientContext &context, const string &name,
+                                           vector<unique_ptr<Expression>> children) {
+	string error;
+	FunctionBinder function_binder(context);
+	auto result = function_binder.BindScalarFunction(DEFAULT_SCHEMA, name, move(children), error);
+	if (!result) {
+		throw InternalException("Failed to bind \"%s\" when fusing JSON extractions: %s", name, error);
+	}
+	return result;
+}
+
+static void ReplaceExtractions(unique_ptr<Expression> *expr_ptr, JSONExtractFusionState &state, bool skip_fusion) {
+	auto &expr = **expr_ptr;
+	if (expr.expression_class == ExpressionClass::BOUND_COLUMN_REF) {
+		// the column is passed through the new projection
+		auto &bound_column_ref = (BoundColumnRefExpression &)expr;
+		auto column_entry = state.column_map.find(bound_column_ref.binding);
+		idx_t column_index;
+		if (column_entry == state.column_map.end()) {
+			column_index = state.expressions.size();
+			state.column_map[bound_column_ref.binding] = column_index;
+			state.expressions.push_back(make_unique<BoundColumnRefExpression>(
+			    bound_column_ref.alias, bound_column_ref.return_type, bound_column_ref.binding));
+		} else {
+			column_index = column_entry->second;
+		}
+		bound_column_ref.binding = ColumnBinding(state.projection_index, column_index);
+		return;
+	}
+	if (!skip_fusion && IsFusableExtract(expr)) {
+		auto &func = (BoundFunctionExpression &)expr;
+		auto group = FindGroup(state, func);
+		D_ASSERT(group);
+		if (group->count > 1) {
+			if (group->column_index == DConstants::INVALID_INDEX) {
+				// push the fused extraction into the projection
+				vector<Value> paths;
+				for (auto &path : group->paths) {
+					paths.emplace_back(path);
+				}
+				vector<unique_ptr<Expression>> children;
+				children.push_back(group->input->Copy());
+				children.push_back(make_unique<BoundConstantExpression>(Value::LIST(move(paths))));
+				group->column_index = state.expressions.size();
+				state.expressions.push_back(BindFunction(state.context, group->function_name, move(children)));
+			}
+			// replace the extraction with the element of the fused extraction
+			auto &fused = *state.expressions[group->column_index];
+			auto path_index = group->PathIndex(((JSONReadFunctionData &)*func.bind_info).path);
+			vector<unique_ptr<Expression>> children;
+			children.push_back(make_unique<BoundColumnRefExpression>(
+			    fused.return_type, ColumnBinding(state.projection_index, group->column_index)));
+			children.push_back(make_unique<BoundConstantExpression>(Value::BIGINT(path_index + 1)));
+			auto result = BindFunction(state.context, "list_extract", move(children));
+			D_ASSERT(result->return_type == expr.return_type);
+			result->alias = expr.alias;
+			*expr_ptr = move(result);
+			return;
+		}
+	}
+	skip_fusion = skip_fusion || SkipChildren(expr);
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](unique_ptr<Expression> &child) { ReplaceExtractions(&child, state, skip_fusion); });
+}
+
+static void FuseExtractions(ClientContext &context, LogicalOperator &op, idx_t &next_table_index) {
+	for (auto &child : op.children) {
+		FuseExtractions(context, *child, next_table_index);
+	}
+	if (op.type != LogicalOperatorType::LOGICAL_PROJECTION) {
+		return;
+	}
+	JSONExtractFusionState state(context);
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *child) { CountExtractions(**child, state); });
+	bool perform_fusion = false;
+	for (auto &group : state.groups) {
+		if (group.count > 1) {
+			perform_fusion = true;
+			break;
+		}
+	}
+	if (!perform_fusion) {
+		return;
+	}
+	// the fused extractions are computed once in a projection that is pushed below this projection
+	state.projection_index = next_table_index++;
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *child) { ReplaceExtractions(child, state, false); });
+	D_ASSERT(!state.expressions.empty());
+	auto projection = make_unique<LogicalProjection>(state.projection_index, move(state.expressions));
+	projection->children.push_back(move(op.children[0]));
+	op.children[0] = move(projection);
+}
+
+static idx_t GetMaxTableIndex(LogicalOperator &op) {
+	idx_t result = 0;
+	for (auto &table_index : op.GetTableIndex()) {
+		result = MaxValue<idx_t>(result, table_index);
+	}
+	for (auto &child : op.children) {
+		result = MaxValue<idx_t>(result, GetMaxTableIndex(*child));
+	}
+	return result;
+}
+
+void JSONExtractFusion::Optimize(ClientContext &context, OptimizerExtensionInfo *info,
+                                 unique_ptr<LogicalOperator> &plan) {
+	// the optimizer runs after binding, so new table indexes are taken after the largest one in the plan
+	auto next_table_index = GetMaxTableIndex(*plan) + 1;
+	FuseExtractions(context, *plan, next_table_index);
+}
+
+} // namespace duckdb
@@ -33,11 +33,6 @@ using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::PageType;
 using duckdb_parquet::format::Type;
 
-const uint32_t ParquetDecodeUtils::BITPACK_MASKS[] = {
-    0,       1,       3,        7,        15,       31,        63,        127,       255,        511,       1023,
-    2047,    4095,    8191,     16383,    32767,    65535,     131071,    262143,    524287,     1048575,   2097151,
-    4194303, 8388607, 16777215, 33554431, 67108863, 134217727, 268435455, 536870911, 1073741823, 2147483647};
-
 const uint8_t ParquetDecodeUtils::BITPACK_DLEN = 8;
 
 ColumnReader::ColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t file_idx_p,
@@ -123,6 +118,67 @@ unique_ptr<BaseStatistics> ColumnReader::Stats(idx_t row_group_idx_p, const std:
 	return ParquetStatisticsUtils::TransformColumnStatistics(Schema(), Type(), columns[file_idx]);
 }
 
+unique_ptr<ParquetBloomFilter> ColumnReader::ReadBloomFilter(const std::vector<ColumnChunk> &columns,
+                                                             TProtocol &protocol_p) {
+	if (Type().id() == LogicalTypeId::LIST || Type().id() == LogicalTypeId::STRUCT ||
+	    Type().id() == LogicalTypeId::MAP || !ParquetBloomFilter::SupportsType(Type(), Schema().type)) {
+		return nullptr;
+	}
+	auto &column_chunk = columns[file_idx];
+	if (!column_chunk.__isset.meta_data || !column_chunk.meta_data.__isset.bloom_filter_offset) {
+		return nullptr;
+	}
+	auto &trans = (ThriftFileTransport &)*protocol_p.getTransport();
+	trans.SetLocation(column_chunk.meta_data.bloom_filter_offset);
+	return ParquetBloomFilter::Read(protocol_p);
+}
+
+bool ColumnReader::PageStats(const std::vector<ColumnChunk> &columns, TProtocol &protocol_p,
+                             vector<ParquetPageStatistics> &result) {
+	if (Type().id() == LogicalTypeId::LIST || Type().id() == LogicalTypeId::STRUCT ||
+	    Type().id() == LogicalTypeId::MAP || HasRepeats()) {
+		return false;
+	}
+	auto &column_chunk = columns[file_idx];
+	if (!column_chunk.__isset.meta_data || !column_chunk.__isset.column_index_offset ||
+	    !column_chunk.__isset.offset_index_offset) {
+		return false;
+	}
+	auto &trans = (ThriftFileTransport &)*protocol_p.getTransport();
+	ColumnIndex column_index;
+	trans.SetLocation(column_chunk.column_index_offset);
+	column_index.read(&protocol_p);
+	OffsetIndex offset_index;
+	trans.SetLocation(column_chunk.offset_index_offset);
+	offset_index.read(&protocol_p);
+
+	auto page_count = offset_index.page_locations.size();
+	if (column_index.null_pages.size() != page_count || column_index.min_values.size() != page_count ||
+	    column_index.max_values.size() != page_count) {
+		return false;
+	}
+	for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+		ParquetPageStatistics page;
+		page.first_row = offset_index.page_locations[page_idx].first_row_index;
+		if (!column_index.null_pages[page_idx]) {
+			// the page statistics are encoded in the same way as those of the column chunk: transform them as such
+			ColumnChunk page_chunk;
+			page_chunk.__isset.meta_data = true;
+			page_chunk.meta_data.type = column_chunk.meta_data.type;
+			page_chunk.meta_data.__isset.statistics = true;
+			auto &page_stats = page_chunk.meta_data.statistics;
+			page_stats.__set_min_value(column_index.min_values[page_idx]);
+			page_stats.__set_max_value(column_index.max_values[page_idx]);
+			if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+				page_stats.__set_null_count(column_index.null_counts[page_idx]);
+			}
+			page.stats = ParquetStatisticsUtils::TransformColumnStatistics(Schema(), Type(), page_chunk);
+		}
+		result.push_back(move(page));
+	}
+	return true;
+}
+
 void ColumnReader::Plain(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, idx_t num_values, // NOLINT
                          parquet_filter_t &filter, idx_t result_offset, Vector &result) {
 	throw NotImplementedException("Plain");
@@ -142,6 +198,13 @@ void ColumnReader::DictReference(Vector &result) {
 void ColumnReader::PlainReference(shared_ptr<ByteBuffer>, Vector &result) { // NOLINT
 }
 
+void ColumnReader::EnableDictionaryVectors() {
+}
+
+bool ColumnReader::DictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) {
+	return false;
+}
+
 void ColumnReader::InitializeRead(idx_t row_group_idx_p, const std::vector<ColumnChunk> &columns,
                                   TProtocol &protocol_p) {
 	D_ASSERT(file_idx < columns.size());
@@ -365,6 +428,32 @@ void ColumnReader::PrepareDataPage(PageHeader &page_hdr) {
 		break;
 	}
 		 */
+	case Encoding::BYTE_STREAM_SPLIT: {
+		// the k-th bytes of all values are stored together: interleave them back into plain-encoded values
+		idx_t type_size;
+		switch (schema.type) {
+		case Type::FLOAT:
+			type_size = sizeof(float);
+			break;
+		case Type::DOUBLE:
+			type_size = sizeof(double);
+			break;
+		default:
+			throw std::runtime_error("BYTE_STREAM_SPLIT should only be FLOAT or DOUBLE");
+		}
+		auto value_count = block->len / type_size;
+		auto plain_block = make_shared<ResizeableBuffer>(reader.allocator, value_count * type_size);
+		auto src = (const_data_ptr_t)block->ptr;
+		auto dst = (data_ptr_t)plain_block->ptr;
+		for (idx_t byte_idx = 0; byte_idx < type_size; byte_idx++) {
+			auto stream = src + byte_idx * value_count;
+			for (idx_t i = 0; i < value_count; i++) {
+				dst[i * type_size + byte_idx] = stream[i];
+			}
+		}
+		block = move(plain_block);
+		break;
+	}
 	case Encoding::PLAIN:
 		// nothing to do here, will be read directly below
 		break;
@@ -422,19 +511,24 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, uint8_t
 		if (dict_decoder) {
 			offset_buffer.resize(reader.allocator, sizeof(uint32_t) * (read_now - null_count));
 			dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr, read_now - null_count);
-			DictReference(result);
-			Offsets((uint32_t *)offset_buffer.ptr, define_out, read_now, filter, result_offset, result);
+			// if the entire read comes from this page, the result can reference the dictionary directly
+			if (read_now < num_values ||
+			    !DictionaryVector((uint32_t *)offset_buffer.ptr, define_out, read_now, result)) {
+				DictReference(result);
+				Offsets((uint32_t *)offset_buffer.ptr, define_out, read_now, filter, result_offset, result);
+			}
 		} else if (dbp_decoder) {
 			// TODO keep this in the state
 			auto read_buf = make_shared<ResizeableBuffer>();
 
-			switch (type.id()) {
-			case LogicalTypeId::INTEGER:
+			// the values are decoded in their physical type, Plain() converts them like plain-encoded values
+			switch (schema.type) {
+			case Type::INT32:
 				read_buf->resize(reader.allocator, sizeof(int32_t) * (read_now - null_count));
 				dbp_decoder->GetBatch<int32_t>(read_buf->ptr, read_now - null_count);
 
 				break;
-			case LogicalTypeId::BIGINT:
+			case Type::INT64:
 				read_buf->resize(reader.allocator, sizeof(int64_t) * (read_now - null_count));
 				dbp_decoder->GetBatch<int64_t>(read_buf->ptr, read_now - null_count);
 				break;
@@ -463,16 +557,57 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	auto &trans = (ThriftFileTransport &)*protocol->getTransport();
+	trans.SetLocation(chunk_read_offset);
+
+	idx_t skipped = 0;
+	while (page_rows_available == 0 && skipped < num_values) {
+		auto page_start = trans.GetLocation();
+		PageHeader page_hdr;
+		page_hdr.read(protocol);
+
+		if (page_hdr.type == PageType::DICTIONARY_PAGE) {
+			// the dictionary is needed by the data pages that are read later on
+			trans.SetLocation(page_start);
+			PrepareRead(none_filter);
+			continue;
+		}
+		if (page_hdr.type != PageType::DATA_PAGE && page_hdr.type != PageType::DATA_PAGE_V2) {
+			trans.SetLocation(trans.GetLocation() + page_hdr.compressed_page_size);
+			continue;
+		}
+		idx_t page_rows = page_hdr.type == PageType::DATA_PAGE ? page_hdr.data_page_header.num_values
+		                                                       : page_hdr.data_page_header_v2.num_rows;
+		if (skipped + page_rows > num_values) {
+			// (some of) the rows of this page are read: leave it to Read
+			trans.SetLocation(page_start);
+			break;
+		}
+		trans.SetLocation(trans.GetLocation() + page_hdr.compressed_page_size);
+		skipped += page_rows;
+	}
+	group_rows_available -= skipped;
+	chunk_read_offset = trans.GetLocation();
+	return skipped;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	idx_t remaining = num_values;
+	if (!HasRepeats()) {
+		// without repeats every value is a row: pages that only contain skipped rows are not decompressed at all
+		remaining -= SkipPages(remaining);
+	}
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
 	// TODO this can be optimized, for example we dont actually have to bitunpack offsets
 	Vector dummy_result(type, nullptr);
 
-	idx_t remaining = num_values;
+	idx_t to_skip = remaining;
 	idx_t read = 0;
 
 	while (remaining) {
@@ -481,7 +616,7 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 		remaining -= to_read;
 	}
 
-	if (read != num_values) {
+	if (read != to_skip) {
 		throw std::runtime_error("Row count mismatch when skipping rows");
 	}
 }
@@ -518,6 +653,7 @@ uint32_t StringColumnReader::VerifyString(const char *str_data, uint32_t str_len
 
 void StringColumnReader::Dictionary(shared_ptr<ByteBuffer> data, idx_t num_entries) {
 	dict = move(data);
+	dict_size = num_entries;
 	dict_strings = unique_ptr<string_t[]>(new string_t[num_entries]);
 	for (idx_t dict_idx = 0; dict_idx < num_entries; dict_idx++) {
 		uint32_t str_len;
@@ -534,6 +670,7 @@ void StringColumnReader::Dictionary(shared_ptr<ByteBuffer> data, idx_t num_entri
 		dict_strings[dict_idx] = string_t(dict->ptr, actual_str_len);
 		dict->inc(str_len);
 	}
+	dictionary_vector.reset();
 }
 
 class ParquetStringVectorBuffer : public VectorBuffer {
@@ -553,6 +690,43 @@ void StringColumnReader::PlainReference(shared_ptr<ByteBuffer> plain_data, Vecto
 	StringVector::AddBuffer(result, make_buffer<ParquetStringVectorBuffer>(move(plain_data)));
 }
 
+void StringColumnReader::EnableDictionaryVectors() {
+	dictionary_vectors = true;
+}
+
+bool StringColumnReader::DictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) {
+	if (!dictionary_vectors) {
+		return false;
+	}
+	if (!dictionary_vector) {
+		// create the vector of the dictionary on first use, it is shared by all result vectors of the column chunk
+		// the entry after the dictionary entries is NULL, so that NULL rows can point to it
+		dictionary_vector = make_unique<Vector>(Type(), dict_size + 1);
+		auto dictionary_data = FlatVector::GetData<string_t>(*dictionary_vector);
+		for (idx_t dict_idx = 0; dict_idx < dict_size; dict_idx++) {
+			dictionary_data[dict_idx] = dict_strings[dict_idx];
+		}
+		FlatVector::SetNull(*dictionary_vector, dict_size, true);
+		StringVector::AddBuffer(*dictionary_vector, make_buffer<ParquetStringVectorBuffer>(dict));
+	}
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t offset_idx = 0;
+	for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
+		if (HasDefines() && defines[row_idx] != max_define) {
+			sel.set_index(row_idx, dict_size);
+			continue;
+		}
+		D_ASSERT(offsets[offset_idx] < dict_size);
+		sel.set_index(row_idx, offsets[offset_idx++]);
+	}
+	// rows after the read rows can still be looked at by the filters (which skip them), so point them to NULL
+	for (idx_t row_idx = num_values; row_idx < STANDARD_VECTOR_SIZE; row_idx++) {
+		sel.set_index(row_idx, dict_size);
+	}
+	result.Slice(*dictionary_vector, sel, num_values);
+	return true;
+}
+
 string_t StringParquetValueConversion::DictRead(ByteBuffer &dict, uint32_t &offset, ColumnReader &reader) {
 	auto &dict_strings = ((StringColumnReader &)reader).dict_strings;
 	return dict_strings[offset];
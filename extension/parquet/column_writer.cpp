@@ -2,6 +2,7 @@
 #include "parquet_writer.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
+#include "parquet_dbp_encoder.hpp"
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
@@ -40,7 +41,7 @@ using duckdb_parquet::format::Type;
 
 #define PARQUET_DEFINE_VALID 65535
 
-static void VarintEncode(uint32_t val, Serializer &ser) {
+static void VarintEncode(uint64_t val, Serializer &ser) {
 	do {
 		uint8_t byte = val & 127;
 		val >>= 7;
@@ -168,13 +169,110 @@ void RleBpEncoder::FinishWrite(Serializer &writer) {
 	WriteRun(writer);
 }
 
+//===--------------------------------------------------------------------===//
+// DbpEncoder
+//===--------------------------------------------------------------------===//
+static uint64_t ZigzagEncode(int64_t value) {
+	return (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+}
+
+//! Converts the difference between two values into the delta that a reader of type_bits wide integers adds up
+static int64_t WrapDelta(uint64_t difference, idx_t type_bits) {
+	return type_bits == 64 ? int64_t(difference) : int64_t(int32_t(uint32_t(difference)));
+}
+
+uint8_t DbpEncoder::BitWidth(uint64_t value) {
+	uint8_t bit_width = 0;
+	while (value != 0) {
+		bit_width++;
+		value >>= 1;
+	}
+	return bit_width;
+}
+
+idx_t DbpEncoder::EstimateSize(idx_t count, uint8_t bit_width) {
+	// every block stores its minimum delta as a varint (at most 10 bytes) and the bit widths of its miniblocks
+	auto block_count = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	return (count * bit_width + 7) / 8 + block_count * (10 + MINIBLOCK_COUNT);
+}
+
+void DbpEncoder::BitPack(Serializer &writer, const uint64_t *values, idx_t count, uint8_t bit_width) {
+	// the values are packed starting from the least significant bit of every byte
+	uint8_t current_byte = 0;
+	idx_t current_bits = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto value = values[i];
+		idx_t remaining_bits = bit_width;
+		while (remaining_bits > 0) {
+			auto bits = MinValue<idx_t>(8 - current_bits, remaining_bits);
+			current_byte |= uint8_t((value & ((uint64_t(1) << bits) - 1)) << current_bits);
+			value >>= bits;
+			current_bits += bits;
+			remaining_bits -= bits;
+			if (current_bits == 8) {
+				writer.Write<uint8_t>(current_byte);
+				current_byte = 0;
+				current_bits = 0;
+			}
+		}
+	}
+	if (current_bits > 0) {
+		writer.Write<uint8_t>(current_byte);
+	}
+}
+
+void DbpEncoder::Encode(Serializer &writer, const int64_t *values, idx_t count, idx_t type_bits) {
+	// <block size in values> <number of miniblocks in a block> <total value count> <first value>
+	VarintEncode(BLOCK_SIZE, writer);
+	VarintEncode(MINIBLOCK_COUNT, writer);
+	VarintEncode(count, writer);
+	VarintEncode(ZigzagEncode(count > 0 ? values[0] : 0), writer);
+
+	int64_t deltas[BLOCK_SIZE];
+	uint64_t packed[MINIBLOCK_SIZE];
+	uint8_t bit_widths[MINIBLOCK_COUNT];
+	for (idx_t block_start = 1; block_start < count; block_start += BLOCK_SIZE) {
+		auto block_count = MinValue<idx_t>(BLOCK_SIZE, count - block_start);
+		auto min_delta = NumericLimits<int64_t>::Maximum();
+		for (idx_t i = 0; i < block_count; i++) {
+			auto value_idx = block_start + i;
+			deltas[i] = WrapDelta(uint64_t(values[value_idx]) - uint64_t(values[value_idx - 1]), type_bits);
+			min_delta = MinValue<int64_t>(min_delta, deltas[i]);
+		}
+		// <min delta> <bit widths of the miniblocks> <miniblocks>
+		// the bit widths of miniblocks that are not needed in the last block are written as 0
+		VarintEncode(ZigzagEncode(min_delta), writer);
+		for (idx_t miniblock_idx = 0; miniblock_idx < MINIBLOCK_COUNT; miniblock_idx++) {
+			uint64_t max_offset = 0;
+			auto miniblock_end = MinValue<idx_t>((miniblock_idx + 1) * MINIBLOCK_SIZE, block_count);
+			for (idx_t i = miniblock_idx * MINIBLOCK_SIZE; i < miniblock_end; i++) {
+				max_offset = MaxValue<uint64_t>(max_offset, uint64_t(deltas[i]) - uint64_t(min_delta));
+			}
+			bit_widths[miniblock_idx] = BitWidth(max_offset);
+			writer.Write<uint8_t>(bit_widths[miniblock_idx]);
+		}
+		for (idx_t miniblock_idx = 0; miniblock_idx < MINIBLOCK_COUNT; miniblock_idx++) {
+			auto miniblock_start = miniblock_idx * MINIBLOCK_SIZE;
+			if (miniblock_start >= block_count) {
+				break;
+			}
+			// the last miniblock is padded to a full miniblock
+			for (idx_t i = 0; i < MINIBLOCK_SIZE; i++) {
+				auto delta_idx = miniblock_start + i;
+				packed[i] = delta_idx < block_count ? uint64_t(deltas[delta_idx]) - uint64_t(min_delta) : 0;
+			}
+			BitPack(writer, packed, MINIBLOCK_SIZE, bit_widths[miniblock_idx]);
+		}
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // ColumnWriter
 //===--------------------------------------------------------------------===//
 ColumnWriter::ColumnWriter(ParquetWriter &writer, idx_t schema_idx, vector<string> schema_path_p, idx_t max_repeat,
                            idx_t max_define, bool can_have_nulls)
     : writer(writer), schema_idx(schema_idx), schema_path(move(schema_path_p)), max_repeat(max_repeat),
-      max_define(max_define), can_have_nulls(can_have_nulls), null_count(0) {
+      max_define(max_define), can_have_nulls(can_have_nulls) {
 }
 ColumnWriter::~ColumnWriter() {
 }
@@ -252,7 +350,7 @@ void ColumnWriter::HandleDefineLevels(ColumnWriterState &state, ColumnWriterStat
 				if (!can_have_nulls) {
 					throw IOException("Parquet writer: map key column is not allowed to contain NULL values");
 				}
-				null_count++;
+				state.null_count++;
 				state.definition_levels.push_back(null_value);
 			}
 			if (parent->is_empty.empty() || !parent->is_empty[current_index]) {
@@ -268,7 +366,7 @@ void ColumnWriter::HandleDefineLevels(ColumnWriterState &state, ColumnWriterStat
 				if (!can_have_nulls) {
 					throw IOException("Parquet writer: map key column is not allowed to contain NULL values");
 				}
-				null_count++;
+				state.null_count++;
 				state.definition_levels.push_back(null_value);
 			}
 		}
@@ -346,7 +444,7 @@ public:
 	void Prepare(ColumnWriterState &state, ColumnWriterState *parent, Vector &vector, idx_t count) override;
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
-	void FinalizeWrite(ColumnWriterState &state) override;
+	void FinalizeWrite(ColumnWriterState &state, BufferedSerializer &target) override;
 
 protected:
 	void WriteLevels(Serializer &temp_writer, const vector<uint16_t> &levels, idx_t max_value, idx_t start_offset,
@@ -600,7 +698,7 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
                                              duckdb_parquet::format::ColumnChunk &column_chunk) {
 	if (max_repeat == 0) {
-		column_chunk.meta_data.statistics.null_count = null_count;
+		column_chunk.meta_data.statistics.null_count = state.null_count;
 		column_chunk.meta_data.statistics.__isset.null_count = true;
 		column_chunk.meta_data.__isset.statistics = true;
 	}
@@ -635,14 +733,14 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 	}
 }
 
-void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p, BufferedSerializer &target) {
 	auto &state = (BasicColumnWriterState &)state_p;
 	auto &column_chunk = state.row_group.columns[state.col_idx];
 
 	// flush the last page (if any remains)
 	FlushPage(state);
 
-	auto start_offset = writer.writer->GetTotalWritten();
+	auto start_offset = target.blob.size;
 	auto page_offset = start_offset;
 	// flush the dictionary
 	if (HasDictionary(state)) {
@@ -660,16 +758,17 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	auto protocol = ParquetWriter::CreateProtocol(target);
 	for (auto &write_info : state.write_info) {
 		D_ASSERT(write_info.page_header.uncompressed_page_size > 0);
-		auto header_start_offset = writer.writer->GetTotalWritten();
-		write_info.page_header.write(writer.protocol.get());
+		auto header_start_offset = target.blob.size;
+		write_info.page_header.write(protocol.get());
 		// total uncompressed size in the column chunk includes the header size (!)
-		total_uncompressed_size += writer.writer->GetTotalWritten() - header_start_offset;
+		total_uncompressed_size += target.blob.size - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
-		writer.writer->WriteData(write_info.compressed_data, write_info.compressed_size);
+		target.WriteData(write_info.compressed_data, write_info.compressed_size);
 	}
-	column_chunk.meta_data.total_compressed_size = writer.writer->GetTotalWritten() - start_offset;
+	column_chunk.meta_data.total_compressed_size = target.blob.size - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
 }
 
@@ -810,6 +909,55 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, idx_
 	}
 }
 
+//! Returns the value as it is delta encoded: 32-bit values are sign-extended, so that their deltas wrap around like
+//! they do in readers of 32-bit integers
+template <class T>
+static int64_t GetDeltaValue(T value) {
+	return sizeof(T) == sizeof(int32_t) ? int64_t(int32_t(value)) : int64_t(value);
+}
+
+template <class TGT>
+class StandardColumnWriterState : public BasicColumnWriterState {
+public:
+	StandardColumnWriterState(duckdb_parquet::format::RowGroup &row_group, idx_t col_idx)
+	    : BasicColumnWriterState(row_group, col_idx) {
+	}
+	~StandardColumnWriterState() override = default;
+
+	// analysis state
+	idx_t value_count = 0;
+	//! The distinct values and their dictionary index, cleared once there are too many for a dictionary to pay off
+	unordered_map<TGT, uint32_t> dictionary;
+	bool dictionary_overflow = false;
+	//! The previous value and the range of the deltas between consecutive values
+	bool has_last_value = false;
+	int64_t last_value = 0;
+	int64_t min_delta = NumericLimits<int64_t>::Maximum();
+	int64_t max_delta = NumericLimits<int64_t>::Minimum();
+
+	//! The encoding of the data pages, and the bit width of the keys if the chunk is dictionary encoded
+	Encoding::type encoding = Encoding::PLAIN;
+	uint32_t key_bit_width = 0;
+};
+
+template <class TGT>
+class StandardWriterPageState : public ColumnWriterPageState {
+public:
+	StandardWriterPageState(Encoding::type encoding, uint32_t bit_width, const unordered_map<TGT, uint32_t> &values)
+	    : encoding(encoding), bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
+	}
+
+	Encoding::type encoding;
+	// dictionary encoded pages
+	uint32_t bit_width;
+	const unordered_map<TGT, uint32_t> &dictionary;
+	RleBpEncoder encoder;
+	bool written_value;
+	//! DELTA_BINARY_PACKED and BYTE_STREAM_SPLIT pages need all values of the page before they can be written
+	vector<int64_t> delta_values;
+	vector<TGT> values;
+};
+
 template <class SRC, class TGT, class OP = ParquetCastOperator>
 class StandardColumnWriter : public BasicColumnWriter {
 public:
@@ -819,18 +967,209 @@ public:
 	}
 	~StandardColumnWriter() override = default;
 
+	//! The maximum number of distinct values of a dictionary encoded column chunk
+	static constexpr const idx_t MAX_NUMERIC_DICTIONARY_SIZE = 65536;
+
 public:
 	unique_ptr<ColumnWriterStatistics> InitializeStatsState() override {
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
-	void WriteVector(Serializer &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
+	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override {
+		auto result = make_unique<StandardColumnWriterState<TGT>>(row_group, row_group.columns.size());
+		RegisterToRowGroup(row_group);
+		return move(result);
+	}
+
+	bool HasAnalyze() override {
+		return true;
+	}
+
+	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
+		if (std::is_floating_point<TGT>::value) {
+			// floating point values are never dictionary or delta encoded
+			return;
+		}
+		auto &state = (StandardColumnWriterState<TGT> &)state_p;
+
+		idx_t vcount = parent ? parent->definition_levels.size() - state.definition_levels.size() : count;
+		idx_t parent_index = state.definition_levels.size();
+		auto &validity = FlatVector::Validity(vector);
+		auto data = FlatVector::GetData<SRC>(vector);
+		idx_t vector_index = 0;
+		for (idx_t i = 0; i < vcount; i++) {
+			if (parent && !parent->is_empty.empty() && parent->is_empty[parent_index + i]) {
+				continue;
+			}
+			if (validity.RowIsValid(vector_index)) {
+				TGT value = OP::template Operation<SRC, TGT>(data[vector_index]);
+				state.value_count++;
+				if (!state.dictionary_overflow) {
+					state.dictionary.insert(make_pair(value, uint32_t(state.dictionary.size())));
+					if (state.dictionary.size() > MAX_NUMERIC_DICTIONARY_SIZE) {
+						state.dictionary.clear();
+						state.dictionary_overflow = true;
+					}
+				}
+				auto delta_value = GetDeltaValue<TGT>(value);
+				if (state.has_last_value) {
+					auto delta = WrapDelta(uint64_t(delta_value) - uint64_t(state.last_value), sizeof(TGT) * 8);
+					state.min_delta = MinValue<int64_t>(state.min_delta, delta);
+					state.max_delta = MaxValue<int64_t>(state.max_delta, delta);
+				}
+				state.has_last_value = true;
+				state.last_value = delta_value;
+			}
+			vector_index++;
+		}
+	}
+
+	void FinalizeAnalyze(ColumnWriterState &state_p) override {
+		auto &state = (StandardColumnWriterState<TGT> &)state_p;
+		if (std::is_floating_point<TGT>::value) {
+			// splitting the bytes of floating point values into separate streams makes them compress better
+			auto compressed = writer.GetCodec() != CompressionCodec::UNCOMPRESSED;
+			state.encoding = compressed ? Encoding::BYTE_STREAM_SPLIT : Encoding::PLAIN;
+			return;
+		}
+		// choose the encoding with the smallest estimated size
+		idx_t best_size = state.value_count * sizeof(TGT);
+		state.encoding = Encoding::PLAIN;
+		if (!state.dictionary_overflow && !state.dictionary.empty()) {
+			auto bit_width = RleBpDecoder::ComputeBitWidth(state.dictionary.size());
+			auto dictionary_size = state.dictionary.size() * sizeof(TGT) + (state.value_count * bit_width + 7) / 8;
+			if (dictionary_size < best_size) {
+				best_size = dictionary_size;
+				state.encoding = Encoding::RLE_DICTIONARY;
+				state.key_bit_width = bit_width;
+			}
+		}
+		if (state.value_count > 1) {
+			auto delta_range = uint64_t(state.max_delta) - uint64_t(state.min_delta);
+			auto delta_size = DbpEncoder::EstimateSize(state.value_count, DbpEncoder::BitWidth(delta_range));
+			if (delta_size < best_size) {
+				best_size = delta_size;
+				state.encoding = Encoding::DELTA_BINARY_PACKED;
+			}
+		}
+		if (state.encoding != Encoding::RLE_DICTIONARY) {
+			state.dictionary.clear();
+			state.key_bit_width = 0;
+		}
+	}
+
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
+		auto &state = (StandardColumnWriterState<TGT> &)state_p;
+		return make_unique<StandardWriterPageState<TGT>>(state.encoding, state.key_bit_width, state.dictionary);
+	}
+
+	void WriteVector(Serializer &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state_p,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
+		auto &page_state = (StandardWriterPageState<TGT> &)*page_state_p;
 		auto &mask = FlatVector::Validity(input_column);
-		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+		if (page_state.encoding == Encoding::PLAIN) {
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+			return;
+		}
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+			switch (page_state.encoding) {
+			case Encoding::RLE_DICTIONARY: {
+				auto value_index = page_state.dictionary.at(target_value);
+				if (!page_state.written_value) {
+					// first value: write the bit-width as a one-byte entry, then begin writing the keys
+					temp_writer.Write<uint8_t>(page_state.bit_width);
+					page_state.encoder.BeginWrite(temp_writer, value_index);
+					page_state.written_value = true;
+				} else {
+					page_state.encoder.WriteValue(temp_writer, value_index);
+				}
+				break;
+			}
+			case Encoding::DELTA_BINARY_PACKED:
+				page_state.delta_values.push_back(GetDeltaValue<TGT>(target_value));
+				break;
+			default:
+				page_state.values.push_back(target_value);
+				break;
+			}
+		}
 	}
 
-	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
+	void FlushPageState(Serializer &temp_writer, ColumnWriterPageState *state_p) override {
+		auto &page_state = (StandardWriterPageState<TGT> &)*state_p;
+		switch (page_state.encoding) {
+		case Encoding::RLE_DICTIONARY:
+			if (!page_state.written_value) {
+				// all values are null: just write the bit width
+				temp_writer.Write<uint8_t>(page_state.bit_width);
+				return;
+			}
+			page_state.encoder.FinishWrite(temp_writer);
+			break;
+		case Encoding::DELTA_BINARY_PACKED:
+			DbpEncoder::Encode(temp_writer, page_state.delta_values.data(), page_state.delta_values.size(),
+			                   sizeof(TGT) * 8);
+			break;
+		case Encoding::BYTE_STREAM_SPLIT: {
+			// the k-th bytes of all values are written after each other
+			auto count = page_state.values.size();
+			auto data = (const_data_ptr_t)page_state.values.data();
+			auto streams = unique_ptr<data_t[]>(new data_t[count * sizeof(TGT)]);
+			for (idx_t byte_idx = 0; byte_idx < sizeof(TGT); byte_idx++) {
+				for (idx_t i = 0; i < count; i++) {
+					streams[byte_idx * count + i] = data[i * sizeof(TGT) + byte_idx];
+				}
+			}
+			temp_writer.WriteData(streams.get(), count * sizeof(TGT));
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
+		auto &state = (StandardColumnWriterState<TGT> &)state_p;
+		return state.encoding;
+	}
+
+	bool HasDictionary(BasicColumnWriterState &state_p) override {
+		auto &state = (StandardColumnWriterState<TGT> &)state_p;
+		return state.encoding == Encoding::RLE_DICTIONARY;
+	}
+
+	idx_t DictionarySize(BasicColumnWriterState &state_p) override {
+		auto &state = (StandardColumnWriterState<TGT> &)state_p;
+		D_ASSERT(state.encoding == Encoding::RLE_DICTIONARY);
+		return state.dictionary.size();
+	}
+
+	void FlushDictionary(BasicColumnWriterState &state_p, ColumnWriterStatistics *stats) override {
+		auto &state = (StandardColumnWriterState<TGT> &)state_p;
+		D_ASSERT(state.encoding == Encoding::RLE_DICTIONARY);
+		// the statistics were already updated when the keys were written, write the values in index order
+		auto values = vector<TGT>(state.dictionary.size());
+		for (const auto &entry : state.dictionary) {
+			values[entry.second] = entry.first;
+		}
+		auto temp_writer = make_unique<BufferedSerializer>();
+		for (auto &value : values) {
+			temp_writer->Write<TGT>(value);
+		}
+		WriteDictionary(state, move(temp_writer), values.size());
+	}
+
+	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state_p) override {
+		auto &state = (StandardColumnWriterState<TGT> &)state_p;
+		if (state.encoding == Encoding::RLE_DICTIONARY) {
+			return (state.key_bit_width + 7) / 8;
+		}
 		return sizeof(TGT);
 	}
 };
@@ -1551,7 +1890,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
-	void FinalizeWrite(ColumnWriterState &state) override;
+	void FinalizeWrite(ColumnWriterState &state, BufferedSerializer &target) override;
 };
 
 class StructColumnWriterState : public ColumnWriterState {
@@ -1640,12 +1979,12 @@ void StructColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 	}
 }
 
-void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p, BufferedSerializer &target) {
 	auto &state = (StructColumnWriterState &)state_p;
 	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
 		// we add the null count of the struct to the null count of the children
-		child_writers[child_idx]->null_count += null_count;
-		child_writers[child_idx]->FinalizeWrite(*state.child_states[child_idx]);
+		state.child_states[child_idx]->null_count += state.null_count;
+		child_writers[child_idx]->FinalizeWrite(*state.child_states[child_idx], target);
 	}
 }
 
@@ -1672,7 +2011,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
-	void FinalizeWrite(ColumnWriterState &state) override;
+	void FinalizeWrite(ColumnWriterState &state, BufferedSerializer &target) override;
 };
 
 class ListColumnWriterState : public ColumnWriterState {
@@ -1778,9 +2117,9 @@ void ListColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t c
 	child_writer->Write(*state.child_state, list_child, list_count);
 }
 
-void ListColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void ListColumnWriter::FinalizeWrite(ColumnWriterState &state_p, BufferedSerializer &target) {
 	auto &state = (ListColumnWriterState &)state_p;
-	child_writer->FinalizeWrite(*state.child_state);
+	child_writer->FinalizeWrite(*state.child_state, target);
 }
 
 //===--------------------------------------------------------------------===//
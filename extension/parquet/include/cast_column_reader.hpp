@@ -23,6 +23,14 @@ public:
 
 public:
 	unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const std::vector<ColumnChunk> &columns) override;
+	bool PageStats(const std::vector<ColumnChunk> &columns, TProtocol &protocol_p,
+	               vector<ParquetPageStatistics> &result) override {
+		return false;
+	}
+	unique_ptr<ParquetBloomFilter> ReadBloomFilter(const std::vector<ColumnChunk> &columns,
+	                                               TProtocol &protocol_p) override {
+		return nullptr;
+	}
 	void InitializeRead(idx_t row_group_idx_p, const std::vector<ColumnChunk> &columns, TProtocol &protocol_p) override;
 
 	idx_t Read(uint64_t num_values, parquet_filter_t &filter, uint8_t *define_out, uint8_t *repeat_out,
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "parquet_bloom_filter.hpp"
 #include "parquet_types.h"
 #include "thrift_tools.hpp"
 #include "resizable_buffer.hpp"
@@ -33,14 +34,24 @@ class ParquetReader;
 using duckdb_apache::thrift::protocol::TProtocol;
 
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
 
 typedef std::bitset<STANDARD_VECTOR_SIZE> parquet_filter_t;
 
+//! The statistics of a single page of a column chunk, taken from the page index of the file
+struct ParquetPageStatistics {
+	//! The index of the first row of the page within the row group
+	idx_t first_row;
+	//! The min/max statistics of the page, or nullptr if there are none (e.g. because the page only contains NULLs)
+	unique_ptr<BaseStatistics> stats;
+};
+
 class ColumnReader {
 public:
 	ColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t file_idx_p,
@@ -72,6 +83,15 @@ public:
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const std::vector<ColumnChunk> &columns);
+	//! Reads the statistics of the pages of the column chunk from the ColumnIndex and OffsetIndex of the file. Returns
+	//! false if the file has no page index for the column chunk
+	virtual bool PageStats(const std::vector<ColumnChunk> &columns, TProtocol &protocol_p,
+	                       vector<ParquetPageStatistics> &result);
+	//! Reads the Bloom filter of the column chunk, returns nullptr if the column chunk has no (usable) Bloom filter
+	virtual unique_ptr<ParquetBloomFilter> ReadBloomFilter(const std::vector<ColumnChunk> &columns,
+	                                                       TProtocol &protocol_p);
+	//! Allows the reader to emit dictionary-encoded pages as dictionary vectors, only used for top-level columns
+	virtual void EnableDictionaryVectors();
 
 protected:
 	// readers that use the default Read() need to implement those
@@ -84,6 +104,9 @@ protected:
 	// these are nops for most types, but not for strings
 	virtual void DictReference(Vector &result);
 	virtual void PlainReference(shared_ptr<ByteBuffer>, Vector &result);
+	//! Turns the result into a dictionary vector over the dictionary of the column chunk, returns false if the reader
+	//! does not (currently) emit dictionary vectors
+	virtual bool DictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result);
 
 	// applies any skips that were registered using Skip()
 	virtual void ApplyPendingSkips(idx_t num_values);
@@ -113,6 +136,9 @@ private:
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
+	//! Skips the data pages that only contain rows within the next num_values rows, without reading their contents.
+	//! Returns the number of rows skipped
+	idx_t SkipPages(idx_t num_values);
 	void DecompressInternal(CompressionCodec::type codec, const char *src, idx_t src_size, char *dst, idx_t dst_size);
 
 	const duckdb_parquet::format::ColumnChunk *chunk = nullptr;
@@ -24,6 +24,8 @@ public:
 	vector<uint16_t> definition_levels;
 	vector<uint16_t> repetition_levels;
 	vector<bool> is_empty;
+	//! The amount of NULL values written for this column chunk
+	idx_t null_count = 0;
 };
 
 class ColumnWriterStatistics {
@@ -49,8 +51,6 @@ public:
 	idx_t max_repeat;
 	idx_t max_define;
 	bool can_have_nulls;
-	// collected stats
-	idx_t null_count;
 
 public:
 	//! Create the column writer for a specific type recursively
@@ -80,7 +80,8 @@ public:
 
 	virtual void BeginWrite(ColumnWriterState &state) = 0;
 	virtual void Write(ColumnWriterState &state, Vector &vector, idx_t count) = 0;
-	virtual void FinalizeWrite(ColumnWriterState &state) = 0;
+	//! Writes the column chunk(s) to the target, the offsets in the column meta data are relative to its start
+	virtual void FinalizeWrite(ColumnWriterState &state, BufferedSerializer &target) = 0;
 
 protected:
 	void HandleDefineLevels(ColumnWriterState &state, ColumnWriterState *parent, ValidityMask &validity, idx_t count,
@@ -11,22 +11,22 @@ public:
 		return (n >> 1) ^ -(n & 1);
 	}
 
-	static const uint32_t BITPACK_MASKS[];
 	static const uint8_t BITPACK_DLEN;
 
 	template <typename T>
 	static uint32_t BitUnpack(ByteBuffer &buffer, uint8_t &bitpack_pos, T *dest, uint32_t count, uint8_t width) {
-		auto mask = BITPACK_MASKS[width];
+		// the values are unpacked as 64-bit integers, DELTA_BINARY_PACKED deltas can be up to 64 bits wide
+		uint64_t mask = width >= 64 ? NumericLimits<uint64_t>::Maximum() : (uint64_t(1) << width) - 1;
 
 		for (uint32_t i = 0; i < count; i++) {
-			T val = (buffer.get<uint8_t>() >> bitpack_pos) & mask;
+			uint64_t val = (uint64_t(buffer.get<uint8_t>()) >> bitpack_pos) & mask;
 			bitpack_pos += width;
 			while (bitpack_pos > BITPACK_DLEN) {
 				buffer.inc(1);
-				val |= (buffer.get<uint8_t>() << (BITPACK_DLEN - (bitpack_pos - width))) & mask;
+				val |= (uint64_t(buffer.get<uint8_t>()) << (BITPACK_DLEN - (bitpack_pos - width))) & mask;
 				bitpack_pos -= BITPACK_DLEN;
 			}
-			dest[i] = val;
+			dest[i] = T(val);
 		}
 		return count;
 	}
@@ -37,7 +37,7 @@ public:
 		uint8_t shift = 0;
 		while (true) {
 			auto byte = buf.read<uint8_t>();
-			result |= (byte & 127) << shift;
+			result |= T(byte & 127) << shift;
 			if ((byte & 128) == 0)
 				break;
 			shift += 7;
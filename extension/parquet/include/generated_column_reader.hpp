@@ -41,6 +41,14 @@ public:
 			return nullptr;
 		}
 	};
+	bool PageStats(const std::vector<ColumnChunk> &columns, TProtocol &protocol_p,
+	               vector<ParquetPageStatistics> &result) override {
+		return false;
+	}
+	unique_ptr<ParquetBloomFilter> ReadBloomFilter(const std::vector<ColumnChunk> &columns,
+	                                               TProtocol &protocol_p) override {
+		return nullptr;
+	}
 
 	void InitializeRead(idx_t row_group_idx_p, const std::vector<ColumnChunk> &columns,
 	                    TProtocol &protocol_p) override {
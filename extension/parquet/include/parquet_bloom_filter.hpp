@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#endif
+#include "parquet_types.h"
+#include "thrift/protocol/TProtocol.h"
+
+namespace duckdb {
+
+//! ParquetBloomFilter is a split block Bloom filter as defined by the Parquet format
+/*!
+   The filter consists of blocks of eight 32-bit words. The upper half of the (64-bit xxHash) hash of a value selects
+   a block, and the lower half sets a single bit in every word of that block. Values are hashed in their plain
+   encoding, so that filters written by other writers can be used as well.
+*/
+class ParquetBloomFilter {
+public:
+	//! The size of a block of the filter in bytes
+	static constexpr const idx_t BLOCK_SIZE = 32;
+	//! The bits that are reserved per distinct value when a filter is written (~1% false positives)
+	static constexpr const idx_t BITS_PER_VALUE = 10;
+	//! The maximum size of a filter in bytes
+	static constexpr const idx_t MAX_SIZE = 128 * 1024 * 1024;
+
+	//! Creates an empty filter that is sized for the given amount of distinct values
+	explicit ParquetBloomFilter(idx_t distinct_count);
+	explicit ParquetBloomFilter(vector<uint32_t> words);
+
+public:
+	//! Whether or not values of the given type (stored as the given physical type) can be looked up in a filter
+	static bool SupportsType(const LogicalType &type, duckdb_parquet::format::Type::type physical_type);
+	//! Returns the hash of a (non-NULL) value of a supported type
+	static uint64_t HashValue(const Value &value);
+	//! Adds the hashes of the valid values of a vector of a supported type to the set of hashes
+	static void HashVector(Vector &input, idx_t count, unordered_set<uint64_t> &hashes);
+	//! Whether or not the filter has an equality comparison that a Bloom filter could exclude
+	static bool HasEqualityFilter(const TableFilter &filter);
+
+	void Insert(uint64_t hash);
+	bool MightContain(uint64_t hash) const;
+	//! Returns true if none of the values in the filter can pass the table filter
+	bool ExcludesFilter(const TableFilter &filter) const;
+
+	//! Writes the header and the bitset of the filter
+	void Write(duckdb_apache::thrift::protocol::TProtocol &protocol) const;
+	//! Reads a filter that was written at the current position of the protocol's transport
+	static unique_ptr<ParquetBloomFilter> Read(duckdb_apache::thrift::protocol::TProtocol &protocol);
+
+private:
+	//! The words of the filter, the number of words is a multiple of the block size
+	vector<uint32_t> words;
+};
+
+} // namespace duckdb
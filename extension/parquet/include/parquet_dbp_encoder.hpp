@@ -0,0 +1,40 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "parquet_types.h"
+#include "thrift_tools.hpp"
+#include "resizable_buffer.hpp"
+
+namespace duckdb {
+
+//! DbpEncoder writes integers with the DELTA_BINARY_PACKED encoding: the first value followed by blocks of deltas
+//! between consecutive values, where every miniblock of deltas is bit-packed relative to the minimum delta of its block
+class DbpEncoder {
+public:
+	//! The number of values in a block
+	static constexpr const idx_t BLOCK_SIZE = 128;
+	//! The number of miniblocks in a block
+	static constexpr const idx_t MINIBLOCK_COUNT = 4;
+	static constexpr const idx_t MINIBLOCK_SIZE = BLOCK_SIZE / MINIBLOCK_COUNT;
+
+public:
+	//! Writes the values of a page. The deltas are computed with the wrap-around of a type_bits wide (32 or 64)
+	//! integer, which is how readers add them up again
+	static void Encode(Serializer &writer, const int64_t *values, idx_t count, idx_t type_bits);
+	//! Returns the number of bits that are needed to bit-pack the value
+	static uint8_t BitWidth(uint64_t value);
+	//! Returns an (over-)estimate of the encoded size of count values with deltas in a range of the given bit width
+	static idx_t EstimateSize(idx_t count, uint8_t bit_width);
+
+private:
+	static void BitPack(Serializer &writer, const uint64_t *values, idx_t count, uint8_t bit_width);
+};
+
+} // namespace duckdb
@@ -9,7 +9,10 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/storage/object_cache.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
 #endif
 #include "parquet_types.h"
 
@@ -20,8 +23,9 @@ class ParquetFileMetadataCache : public ObjectCacheEntry {
 public:
 	ParquetFileMetadataCache() : metadata(nullptr) {
 	}
-	ParquetFileMetadataCache(std::unique_ptr<duckdb_parquet::format::FileMetaData> file_metadata, time_t r_time)
-	    : metadata(std::move(file_metadata)), read_time(r_time) {
+	ParquetFileMetadataCache(std::unique_ptr<duckdb_parquet::format::FileMetaData> file_metadata, time_t r_time,
+	                         idx_t footer_size_p = 0)
+	    : metadata(std::move(file_metadata)), read_time(r_time), footer_size(footer_size_p) {
 	}
 
 	~ParquetFileMetadataCache() override = default;
@@ -31,6 +35,14 @@ public:
 
 	//! read time
 	time_t read_time;
+	//! The size of the (thrift encoded) footer of the file
+	idx_t footer_size;
+
+	//! Lock protecting the schema and the column statistics
+	mutex lock;
+	//! The statistics of the top-level columns of the file (by column name and type), which are computed the first
+	//! time a scan uses them to check if the file can be skipped. nullptr if the file has no statistics for the column.
+	unordered_map<string, shared_ptr<BaseStatistics>> column_stats;
 
 public:
 	static string ObjectType() {
@@ -40,5 +52,43 @@ public:
 	string GetObjectType() override {
 		return ObjectType();
 	}
+
+	idx_t EstimatedSize() override {
+		idx_t result = sizeof(ParquetFileMetadataCache) + footer_size;
+		if (metadata) {
+			result += metadata->schema.size() * sizeof(duckdb_parquet::format::SchemaElement);
+			for (auto &row_group : metadata->row_groups) {
+				result += sizeof(row_group) + row_group.columns.size() * sizeof(duckdb_parquet::format::ColumnChunk);
+			}
+		}
+		return result;
+	}
+
+	//! Gets the top-level column names and types derived from the schema of the file, if a reader with the same
+	//! options has derived them before
+	bool GetSchema(bool binary_as_string, vector<string> &names, vector<LogicalType> &types) {
+		lock_guard<mutex> guard(lock);
+		if (!has_schema || schema_binary_as_string != binary_as_string) {
+			return false;
+		}
+		names = schema_names;
+		types = schema_types;
+		return true;
+	}
+
+	void SetSchema(bool binary_as_string, const vector<string> &names, const vector<LogicalType> &types) {
+		lock_guard<mutex> guard(lock);
+		has_schema = true;
+		schema_binary_as_string = binary_as_string;
+		schema_names = names;
+		schema_types = types;
+	}
+
+private:
+	//! The top-level columns of the file, as derived by ParquetReader::InitializeSchema
+	bool has_schema = false;
+	bool schema_binary_as_string = false;
+	vector<string> schema_names;
+	vector<LogicalType> schema_types;
 };
 } // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
@@ -44,6 +45,12 @@ struct ParquetReaderPrefetchConfig {
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
 };
 
+//! A range [start, end) of rows within a row group
+struct ParquetRowRange {
+	idx_t start;
+	idx_t end;
+};
+
 struct ParquetReaderScanState {
 	vector<idx_t> group_idx_list;
 	int64_t current_group;
@@ -62,6 +69,22 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! The range of rows that is scanned within the row groups, which allows a single large row group to be split up
+	//! over multiple scans
+	idx_t group_row_start = 0;
+	idx_t group_row_end = NumericLimits<idx_t>::Maximum();
+
+	//! The ranges of rows of the current row group that can pass the filters according to the page index of the file,
+	//! the other rows are skipped without being read. Only used if has_row_ranges is set
+	bool has_row_ranges = false;
+	vector<ParquetRowRange> row_ranges;
+	idx_t row_range_idx = 0;
+
+	//! Determines the order in which the filter columns are read and evaluated
+	unique_ptr<AdaptiveFilter> adaptive_filter;
+	//! The filter statistics that are shared with the other scans of the same query (optional)
+	shared_ptr<AdaptiveFilterStatistics> filter_statistics;
 };
 
 struct ParquetOptions {
@@ -116,6 +139,8 @@ public:
 
 	idx_t NumRows();
 	idx_t NumRowGroups();
+	//! Whether the file is read from a local disk (rather than e.g. over HTTP)
+	bool OnDiskFile();
 
 	const duckdb_parquet::format::FileMetaData *GetFileMetadata();
 
@@ -137,7 +162,13 @@ private:
 	idx_t GetGroupOffset(ParquetReaderScanState &state);
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
+	//! The row up to which the current row group is scanned
+	idx_t GetGroupRowEnd(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Determines the ranges of rows of the current row group that can pass the filters using the page index
+	void PrepareRowRanges(ParquetReaderScanState &state);
+	//! Skips the next count rows of the current row group in all scanned columns
+	void SkipRows(ParquetReaderScanState &state, idx_t count);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
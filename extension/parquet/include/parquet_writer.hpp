@@ -14,6 +14,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/serializer/buffered_serializer.hpp"
 #include "duckdb/common/types/column_data_collection.hpp"
 #endif
 
@@ -25,6 +26,13 @@ namespace duckdb {
 class FileSystem;
 class FileOpener;
 
+//! A row group that has been encoded and compressed, but not yet appended to the file
+struct PreparedRowGroup {
+	duckdb_parquet::format::RowGroup row_group;
+	//! The column chunks and Bloom filters of the row group, the offsets in the row group are relative to its start
+	unique_ptr<BufferedSerializer> data;
+};
+
 class ParquetWriter {
 	friend class ColumnWriter;
 	friend class BasicColumnWriter;
@@ -33,12 +41,24 @@ class ParquetWriter {
 
 public:
 	ParquetWriter(FileSystem &fs, string file_name, FileOpener *file_opener, vector<LogicalType> types,
-	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec);
+	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec,
+	              vector<bool> bloom_filter_columns = vector<bool>());
 
 public:
 	void Flush(ColumnDataCollection &buffer);
+	//! Encodes and compresses the buffer as a row group, this can be called by multiple threads at the same time
+	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
+	//! Appends a prepared row group to the file
+	void FlushRowGroup(PreparedRowGroup &prepared);
 	void Finalize();
 
+	duckdb_parquet::format::CompressionCodec::type GetCodec() const {
+		return codec;
+	}
+
+	//! Creates a (compact) thrift protocol that writes to the serializer
+	static shared_ptr<duckdb_apache::thrift::protocol::TProtocol> CreateProtocol(Serializer &serializer);
+
 	static duckdb_parquet::format::Type::type DuckDBTypeToParquetType(const LogicalType &duckdb_type);
 	static void SetSchemaProperties(const LogicalType &duckdb_type, duckdb_parquet::format::SchemaElement &schema_ele);
 
@@ -47,6 +67,8 @@ private:
 	vector<LogicalType> sql_types;
 	vector<string> column_names;
 	duckdb_parquet::format::CompressionCodec::type codec;
+	//! For every column, whether or not a Bloom filter is written for its column chunks
+	vector<bool> bloom_filter_columns;
 
 	unique_ptr<BufferedFileWriter> writer;
 	shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
@@ -27,6 +27,14 @@ public:
 	           Vector &result) override;
 
 	unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const std::vector<ColumnChunk> &columns) override;
+	bool PageStats(const std::vector<ColumnChunk> &columns, TProtocol &protocol_p,
+	               vector<ParquetPageStatistics> &result) override {
+		return false;
+	}
+	unique_ptr<ParquetBloomFilter> ReadBloomFilter(const std::vector<ColumnChunk> &columns,
+	                                               TProtocol &protocol_p) override {
+		return nullptr;
+	}
 
 	void InitializeRead(idx_t row_group_idx_p, const std::vector<ColumnChunk> &columns, TProtocol &protocol_p) override;
 
@@ -26,16 +26,23 @@ public:
 	                   idx_t max_define_p, idx_t max_repeat_p);
 
 	unique_ptr<string_t[]> dict_strings;
+	idx_t dict_size = 0;
 	idx_t fixed_width_string_length;
+	//! Whether or not dictionary-encoded pages are emitted as dictionary vectors
+	bool dictionary_vectors = false;
+	//! The dictionary of the current column chunk as a vector (created when it is first referenced)
+	unique_ptr<Vector> dictionary_vector;
 
 public:
 	void Dictionary(shared_ptr<ByteBuffer> dictionary_data, idx_t num_entries) override;
+	void EnableDictionaryVectors() override;
 
 	uint32_t VerifyString(const char *str_data, uint32_t str_len);
 
 protected:
 	void DictReference(Vector &result) override;
 	void PlainReference(shared_ptr<ByteBuffer> plain_data, Vector &result) override;
+	bool DictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) override;
 };
 
 } // namespace duckdb
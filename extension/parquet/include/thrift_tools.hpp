@@ -51,6 +51,10 @@ struct ReadHeadComparator {
 // 1: register all ranges that will be read, merging ranges that are consecutive
 // 2: prefetch all registered ranges
 struct ReadAheadBuffer {
+	// For files that are not on disk (e.g. over HTTP) every request has a latency that costs about as much as
+	// transferring this many bytes, so ranges with smaller gaps in between are read with a single request
+	static constexpr uint64_t REMOTE_REQUEST_COST = 1 << 20; // 1 MiB
+
 	ReadAheadBuffer(Allocator &allocator, FileHandle &handle, FileOpener &opener)
 	    : allocator(allocator), handle(handle), file_opener(opener) {
 	}
@@ -105,16 +109,48 @@ struct ReadAheadBuffer {
 		return nullptr;
 	}
 
+	// Merges the read heads that have not been fetched yet if the gap between them is cheaper to read than an extra
+	// request, should only be called after the registration is finalized
+	void CoalesceReadHeads() {
+		std::list<ReadHead> pending_heads;
+		for (auto it = read_heads.begin(); it != read_heads.end();) {
+			auto current = it++;
+			if (!current->data_isset) {
+				pending_heads.splice(pending_heads.end(), read_heads, current);
+			}
+		}
+		pending_heads.sort([](const ReadHead &a, const ReadHead &b) { return a.location < b.location; });
+		for (auto it = pending_heads.begin(); it != pending_heads.end();) {
+			auto next = std::next(it);
+			if (next != pending_heads.end() && next->location <= it->GetEnd() + REMOTE_REQUEST_COST) {
+				it->size = MaxValue<idx_t>(it->GetEnd(), next->GetEnd()) - it->location;
+				pending_heads.erase(next);
+			} else {
+				it = next;
+			}
+		}
+		read_heads.splice(read_heads.end(), pending_heads);
+	}
+
 	// Prefetch all read heads
 	void Prefetch() {
+		if (!handle.OnDiskFile()) {
+			CoalesceReadHeads();
+		}
+		// all ranges are handed to the file system at once, so that it can read them concurrently
+		vector<FileReadRange> ranges;
 		for (auto &read_head : read_heads) {
-			read_head.Allocate(allocator);
-
+			if (read_head.data_isset) {
+				continue;
+			}
 			if (read_head.GetEnd() > handle.GetFileSize()) {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
-
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
+			read_head.Allocate(allocator);
+			ranges.push_back(FileReadRange {read_head.data.get(), read_head.size, read_head.location});
+		}
+		handle.ReadRanges(ranges);
+		for (auto &read_head : read_heads) {
 			read_head.data_isset = true;
 		}
 	}
@@ -26,6 +26,11 @@ public:
 	unique_ptr<StreamWrapper> CreateStream() override;
 	idx_t InBufferSize() override;
 	idx_t OutBufferSize() override;
+
+	//! Finds the frames of a zstd file that consists of multiple frames, which all store their uncompressed size
+	bool FindBlocks(FileHandle &child_handle, vector<CompressedFileBlock> &blocks) override;
+	void DecompressBlock(const_data_ptr_t compressed_data, const CompressedFileBlock &block,
+	                     data_ptr_t target) override;
 };
 
 } // namespace duckdb
@@ -3,6 +3,7 @@
 #include "parquet-extension.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_metadata.hpp"
 #include "parquet_reader.hpp"
 #include "parquet_writer.hpp"
@@ -20,15 +21,18 @@
 #include "duckdb/common/field_writer.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
+#include "duckdb/common/random_engine.hpp"
 #include "duckdb/common/types/chunk_collection.hpp"
 #include "duckdb/function/copy_function.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/parser/parsed_data/create_copy_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "duckdb/parser/parsed_data/sample_options.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
@@ -76,7 +80,19 @@ struct ParquetReadGlobalState : public GlobalTableFunctionState {
 	idx_t batch_index;
 	idx_t file_index;
 	idx_t row_group_index;
+	//! The part of the current row group that is handed out next, and the amount of parts the row group is split into
+	idx_t row_group_split;
+	idx_t row_group_splits;
+	//! The amount of rows in every part of the current row group
+	idx_t row_group_split_rows;
 	idx_t max_threads;
+	idx_t thread_count;
+	//! The runtime statistics of the filters, shared between the scans so they agree on the order of the filters
+	shared_ptr<AdaptiveFilterStatistics> filter_statistics;
+	//! The probability with which a row group is part of the system sample of the scan, and the random engine used to
+	//! sample the row groups (if any)
+	double sample_probability = 1;
+	unique_ptr<RandomEngine> sample_random;
 
 	vector<idx_t> projection_ids;
 	vector<LogicalType> scanned_types;
@@ -96,6 +112,8 @@ struct ParquetWriteBindData : public TableFunctionData {
 	vector<string> column_names;
 	duckdb_parquet::format::CompressionCodec::type codec = duckdb_parquet::format::CompressionCodec::SNAPPY;
 	idx_t row_group_size = RowGroup::ROW_GROUP_SIZE;
+	//! For every column, whether or not Bloom filters are written for it
+	vector<bool> bloom_filter_columns;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -125,6 +143,9 @@ void ParquetOptions::Deserialize(FieldReader &reader) {
 
 class ParquetScanFunction {
 public:
+	//! Row groups are only split up into parts of at least this amount of rows
+	static constexpr const idx_t MIN_ROW_GROUP_SPLIT_ROWS = 1 << 17;
+
 	static TableFunctionSet GetFunctionSet() {
 		TableFunctionSet set("parquet_scan");
 		TableFunction table_function({LogicalType::VARCHAR}, ParquetScanImplementation, ParquetScanBind,
@@ -143,6 +164,7 @@ public:
 		table_function.projection_pushdown = true;
 		table_function.filter_pushdown = true;
 		table_function.filter_prune = true;
+		table_function.sampling_pushdown = true;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 		set.AddFunction(table_function);
 		table_function.arguments = {LogicalType::LIST(LogicalType::VARCHAR)};
@@ -399,9 +421,18 @@ public:
 		}
 
 		result->row_group_index = 0;
+		result->row_group_split = 0;
+		result->row_group_splits = 1;
+		result->row_group_split_rows = 0;
 		result->file_index = 0;
 		result->batch_index = 0;
 		result->max_threads = ParquetScanMaxThreads(context, input.bind_data);
+		result->thread_count = TaskScheduler::GetScheduler(context).NumberOfThreads();
+		result->filter_statistics = make_shared<AdaptiveFilterStatistics>();
+		if (input.sample_options) {
+			result->sample_probability = input.sample_options->sample_size.GetValue<double>() / 100;
+			result->sample_random = make_unique<RandomEngine>(input.sample_options->seed);
+		}
 		if (input.CanRemoveFilterColumns()) {
 			result->projection_ids = input.projection_ids;
 			const auto table_types = bind_data.types;
@@ -477,7 +508,158 @@ public:
 
 	static idx_t ParquetScanMaxThreads(ClientContext &context, const FunctionData *bind_data) {
 		auto &data = (ParquetReadBindData &)*bind_data;
-		return data.initial_file_row_groups * data.files.size();
+		// large row groups can be split up over multiple threads
+		return MaxValue<idx_t>(data.initial_file_row_groups * data.files.size(),
+		                       data.initial_file_cardinality * data.files.size() / MIN_ROW_GROUP_SPLIT_ROWS);
+	}
+
+	//! Initializes the scan of the next row group of the current file. If there are fewer row groups than threads, a
+	//! large row group is split up into multiple scans over consecutive ranges of its rows.
+	static void ParquetInitializeGroupScan(ParquetReadLocalState &scan_data, ParquetReadGlobalState &parallel_state) {
+		auto &reader = *parallel_state.current_reader;
+		auto row_group_index = parallel_state.row_group_index;
+		if (parallel_state.row_group_split == 0) {
+			auto group_rows = (idx_t)reader.GetFileMetadata()->row_groups[row_group_index].num_rows;
+			idx_t splits = 1;
+			// splitting a row group means skipping to the start of the range in every scan: only do so for local files
+			auto row_groups = reader.NumRowGroups();
+			if (reader.OnDiskFile() && row_groups < parallel_state.thread_count) {
+				splits = (parallel_state.thread_count + row_groups - 1) / row_groups;
+				splits = MaxValue<idx_t>(MinValue<idx_t>(splits, group_rows / MIN_ROW_GROUP_SPLIT_ROWS), 1);
+			}
+			// the parts are aligned to vectors
+			auto split_rows = (group_rows + splits - 1) / splits;
+			split_rows = (split_rows + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE * STANDARD_VECTOR_SIZE;
+			split_rows = MaxValue<idx_t>(split_rows, 1);
+			parallel_state.row_group_split_rows = split_rows;
+			parallel_state.row_group_splits = MaxValue<idx_t>((group_rows + split_rows - 1) / split_rows, 1);
+		}
+
+		scan_data.reader = parallel_state.current_reader;
+		scan_data.scan_state.filter_statistics = parallel_state.filter_statistics;
+		vector<idx_t> group_indexes {row_group_index};
+		scan_data.reader->InitializeScan(scan_data.scan_state, scan_data.column_ids, group_indexes,
+		                                 scan_data.table_filters);
+		if (parallel_state.row_group_splits > 1) {
+			auto &scan_state = scan_data.scan_state;
+			scan_state.group_row_start = parallel_state.row_group_split * parallel_state.row_group_split_rows;
+			scan_state.group_row_end = scan_state.group_row_start + parallel_state.row_group_split_rows;
+		}
+		scan_data.batch_index = parallel_state.batch_index++;
+		scan_data.file_index = parallel_state.file_index;
+
+		parallel_state.row_group_split++;
+		if (parallel_state.row_group_split >= parallel_state.row_group_splits) {
+			parallel_state.row_group_split = 0;
+			parallel_state.row_group_index++;
+		}
+	}
+
+	//! Returns the index of the schema element that follows the element (and its children) at schema_idx
+	static idx_t SkipSchemaElement(const std::vector<duckdb_parquet::format::SchemaElement> &schema, idx_t schema_idx) {
+		auto child_count = schema[schema_idx].num_children;
+		schema_idx++;
+		for (int32_t child_idx = 0; child_idx < child_count && schema_idx < schema.size(); child_idx++) {
+			schema_idx = SkipSchemaElement(schema, schema_idx);
+		}
+		return schema_idx;
+	}
+
+	//! Returns the names of the top-level columns of a Parquet file
+	static vector<string> GetTopLevelColumnNames(const duckdb_parquet::format::FileMetaData &file_meta_data) {
+		vector<string> result;
+		auto &schema = file_meta_data.schema;
+		if (schema.empty()) {
+			return result;
+		}
+		idx_t schema_idx = 1;
+		for (int32_t child_idx = 0; child_idx < schema[0].num_children && schema_idx < schema.size(); child_idx++) {
+			result.push_back(schema[schema_idx].name);
+			schema_idx = SkipSchemaElement(schema, schema_idx);
+		}
+		return result;
+	}
+
+	//! Returns the statistics of a column of a file, which are stored with the cached metadata of the file
+	static shared_ptr<BaseStatistics> GetCachedColumnStatistics(ParquetFileMetadataCache &metadata,
+	                                                             ParquetReader &reader, idx_t file_col_idx,
+	                                                             const string &key) {
+		lock_guard<mutex> stats_guard(metadata.lock);
+		auto entry = metadata.column_stats.find(key);
+		if (entry != metadata.column_stats.end()) {
+			return entry->second;
+		}
+		auto type = reader.return_types[file_col_idx];
+		shared_ptr<BaseStatistics> stats =
+		    ParquetReader::ReadStatistics(reader, type, file_col_idx, metadata.metadata.get());
+		metadata.column_stats[key] = stats;
+		return stats;
+	}
+
+	//! Checks whether the filters of the scan exclude every row of a file, using the min/max statistics of the cached
+	//! metadata of the file. Files that are skipped are neither read nor is a reader created for them.
+	static bool SkipFileByStatistics(ClientContext &context, const ParquetReadBindData &bind_data,
+	                                 ParquetReader &current_reader, const string &file,
+	                                 ParquetReadLocalState &scan_data) {
+		if (!scan_data.table_filters || scan_data.table_filters->filters.empty() ||
+		    !ObjectCache::ObjectCacheEnabled(context)) {
+			return false;
+		}
+		auto metadata = ObjectCache::GetObjectCache(context).Get<ParquetFileMetadataCache>(file);
+		if (!metadata) {
+			// the metadata of the file has not been read yet
+			return false;
+		}
+		auto &fs = FileSystem::GetFileSystem(context);
+		auto handle = fs.OpenFile(file, FileFlags::FILE_FLAGS_READ, FileSystem::DEFAULT_LOCK,
+		                          FileSystem::DEFAULT_COMPRESSION, FileSystem::GetFileOpener(context));
+		if (fs.GetLastModifiedTime(*handle) + 10 >= metadata->read_time) {
+			// the file might have been changed after the metadata was read
+			return false;
+		}
+		// the statistics are read with the column readers of the current file: the files need to have the same schema
+		auto file_names = GetTopLevelColumnNames(*metadata->metadata);
+		if (file_names.size() > current_reader.names.size()) {
+			return false;
+		}
+		for (idx_t col_idx = 0; col_idx < file_names.size(); col_idx++) {
+			if (file_names[col_idx] != current_reader.names[col_idx]) {
+				return false;
+			}
+		}
+		for (auto &entry : scan_data.table_filters->filters) {
+			auto column_id = scan_data.column_ids[entry.first];
+			if (IsRowIdColumnId(column_id) || column_id >= bind_data.names.size()) {
+				continue;
+			}
+			auto &name = bind_data.names[column_id];
+			auto &type = bind_data.types[column_id];
+			auto file_col = std::find(file_names.begin(), file_names.end(), name);
+			if (file_col == file_names.end()) {
+				// a generated column (e.g. the filename or a hive partition)
+				continue;
+			}
+			auto stats = GetCachedColumnStatistics(*metadata, current_reader, file_col - file_names.begin(),
+			                                       name + ":" + type.ToString());
+			if (stats && stats->type == type &&
+			    entry.second->CheckStatistics(*stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//! System sampling: skips the row groups of the current file that are not part of the sample of the scan (if any)
+	static void SkipUnsampledRowGroups(ParquetReadGlobalState &parallel_state) {
+		if (!parallel_state.sample_random || parallel_state.row_group_split != 0) {
+			// not sampling, or we are in the middle of a row group that is split up over multiple scans
+			return;
+		}
+		auto row_groups = parallel_state.current_reader->NumRowGroups();
+		while (parallel_state.row_group_index < row_groups &&
+		       parallel_state.sample_random->NextRandom() > parallel_state.sample_probability) {
+			parallel_state.row_group_index++;
+		}
 	}
 
 	static bool ParquetParallelStateNext(ClientContext &context, const ParquetReadBindData &bind_data,
@@ -488,21 +670,19 @@ public:
 			return false;
 		}
 
+		SkipUnsampledRowGroups(parallel_state);
 		if (parallel_state.row_group_index < parallel_state.current_reader->NumRowGroups()) {
 			// groups remain in the current parquet file: read the next group
-			scan_data.reader = parallel_state.current_reader;
-			vector<idx_t> group_indexes {parallel_state.row_group_index};
-			scan_data.reader->InitializeScan(scan_data.scan_state, scan_data.column_ids, group_indexes,
-			                                 scan_data.table_filters);
-			scan_data.batch_index = parallel_state.batch_index++;
-			scan_data.file_index = parallel_state.file_index;
-			parallel_state.row_group_index++;
+			ParquetInitializeGroupScan(scan_data, parallel_state);
 			return true;
 		} else {
 			// no groups remain in the current parquet file: check if there are more files to read
 			while (parallel_state.file_index + 1 < bind_data.files.size()) {
 				// read the next file
 				string file = bind_data.files[++parallel_state.file_index];
+				if (SkipFileByStatistics(context, bind_data, *parallel_state.current_reader, file, scan_data)) {
+					continue;
+				}
 
 				parallel_state.current_reader =
 				    make_shared<ParquetReader>(context, file, bind_data.names, bind_data.types, scan_data.column_ids,
@@ -512,13 +692,14 @@ public:
 					continue;
 				}
 				// set up the scan state to read the first group
-				scan_data.reader = parallel_state.current_reader;
-				vector<idx_t> group_indexes {0};
-				scan_data.reader->InitializeScan(scan_data.scan_state, scan_data.column_ids, group_indexes,
-				                                 scan_data.table_filters);
-				scan_data.batch_index = parallel_state.batch_index++;
-				scan_data.file_index = parallel_state.file_index;
-				parallel_state.row_group_index = 1;
+				parallel_state.row_group_index = 0;
+				parallel_state.row_group_split = 0;
+				SkipUnsampledRowGroups(parallel_state);
+				if (parallel_state.row_group_index >= parallel_state.current_reader->NumRowGroups()) {
+					// none of the row groups of the file are sampled
+					continue;
+				}
+				ParquetInitializeGroupScan(scan_data, parallel_state);
 				return true;
 			}
 		}
@@ -550,6 +731,34 @@ public:
 	}
 };
 
+static vector<bool> ParseBloomFilterColumns(const vector<Value> &set, vector<string> &names,
+                                            vector<LogicalType> &sql_types) {
+	vector<bool> result(names.size(), false);
+	if (set.empty()) {
+		throw BinderException("\"BLOOM_FILTER_COLUMNS\" expects a column list as parameter");
+	}
+	for (auto &entry : set) {
+		auto column_name = entry.ToString();
+		idx_t col_idx;
+		for (col_idx = 0; col_idx < names.size(); col_idx++) {
+			if (names[col_idx] == column_name) {
+				break;
+			}
+		}
+		if (col_idx == names.size()) {
+			throw BinderException("\"BLOOM_FILTER_COLUMNS\" expected to find %s, but it was not found in the table",
+			                      column_name);
+		}
+		auto &type = sql_types[col_idx];
+		if (!ParquetBloomFilter::SupportsType(type, ParquetWriter::DuckDBTypeToParquetType(type))) {
+			throw BinderException("\"BLOOM_FILTER_COLUMNS\" does not support column %s of type %s", column_name,
+			                      type.ToString());
+		}
+		result[col_idx] = true;
+	}
+	return result;
+}
+
 unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyInfo &info, vector<string> &names,
                                           vector<LogicalType> &sql_types) {
 	auto bind_data = make_unique<ParquetWriteBindData>();
@@ -575,6 +784,8 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyInfo &info
 				}
 			}
 			throw ParserException("Expected %s argument to be either [uncompressed, snappy, gzip or zstd]", loption);
+		} else if (loption == "bloom_filter_columns") {
+			bind_data->bloom_filter_columns = ParseBloomFilterColumns(option.second, names, sql_types);
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
@@ -593,7 +804,7 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	auto &fs = FileSystem::GetFileSystem(context);
 	global_state->writer =
 	    make_unique<ParquetWriter>(fs, file_path, FileSystem::GetFileOpener(context), parquet_bind.sql_types,
-	                               parquet_bind.column_names, parquet_bind.codec);
+	                               parquet_bind.column_names, parquet_bind.codec, parquet_bind.bloom_filter_columns);
 	return move(global_state);
 }
 
@@ -0,0 +1,317 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#endif
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TProtocol;
+using duckdb_apache::thrift::protocol::TType;
+using duckdb_parquet::format::Type;
+
+//! The salt values that select the bit to set in every word of a block, as defined by the Parquet format
+static constexpr const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+static constexpr const idx_t WORDS_PER_BLOCK = ParquetBloomFilter::BLOCK_SIZE / sizeof(uint32_t);
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t distinct_count) {
+	auto size = NextPowerOfTwo(MaxValue<idx_t>(distinct_count * BITS_PER_VALUE / 8, BLOCK_SIZE));
+	size = MinValue<idx_t>(size, MAX_SIZE);
+	words.resize(size / sizeof(uint32_t), 0);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(vector<uint32_t> words_p) : words(move(words_p)) {
+	D_ASSERT(!words.empty() && words.size() % WORDS_PER_BLOCK == 0);
+}
+
+static uint64_t HashData(const void *data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+bool ParquetBloomFilter::SupportsType(const LogicalType &type, Type::type physical_type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+		return physical_type == Type::INT32;
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UBIGINT:
+		return physical_type == Type::INT64;
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+		return physical_type == Type::BYTE_ARRAY;
+	default:
+		return false;
+	}
+}
+
+template <class TGT>
+static uint64_t HashPlain(TGT value) {
+	return HashData(&value, sizeof(TGT));
+}
+
+uint64_t ParquetBloomFilter::HashValue(const Value &value) {
+	D_ASSERT(!value.IsNull());
+	switch (value.type().id()) {
+	case LogicalTypeId::TINYINT:
+		return HashPlain<int32_t>(value.GetValueUnsafe<int8_t>());
+	case LogicalTypeId::SMALLINT:
+		return HashPlain<int32_t>(value.GetValueUnsafe<int16_t>());
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::DATE:
+		return HashPlain<int32_t>(value.GetValueUnsafe<int32_t>());
+	case LogicalTypeId::UTINYINT:
+		return HashPlain<int32_t>(value.GetValueUnsafe<uint8_t>());
+	case LogicalTypeId::USMALLINT:
+		return HashPlain<int32_t>(value.GetValueUnsafe<uint16_t>());
+	case LogicalTypeId::UINTEGER:
+		return HashPlain<uint32_t>(value.GetValueUnsafe<uint32_t>());
+	case LogicalTypeId::BIGINT:
+		return HashPlain<int64_t>(value.GetValueUnsafe<int64_t>());
+	case LogicalTypeId::UBIGINT:
+		return HashPlain<uint64_t>(value.GetValueUnsafe<uint64_t>());
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB: {
+		auto &str = StringValue::Get(value);
+		return HashData(str.c_str(), str.size());
+	}
+	default:
+		throw InternalException("Unsupported type for Parquet Bloom filter");
+	}
+}
+
+template <class SRC, class TGT>
+static void TemplatedHashVector(Vector &input, idx_t count, unordered_set<uint64_t> &hashes) {
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = (SRC *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		hashes.insert(HashPlain<TGT>(data[idx]));
+	}
+}
+
+static void HashStringVector(Vector &input, idx_t count, unordered_set<uint64_t> &hashes) {
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = (string_t *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		hashes.insert(HashData(data[idx].GetDataUnsafe(), data[idx].GetSize()));
+	}
+}
+
+void ParquetBloomFilter::HashVector(Vector &input, idx_t count, unordered_set<uint64_t> &hashes) {
+	// values are hashed in the same physical representation as the column writers store them
+	switch (input.GetType().id()) {
+	case LogicalTypeId::TINYINT:
+		TemplatedHashVector<int8_t, int32_t>(input, count, hashes);
+		break;
+	case LogicalTypeId::SMALLINT:
+		TemplatedHashVector<int16_t, int32_t>(input, count, hashes);
+		break;
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::DATE:
+		TemplatedHashVector<int32_t, int32_t>(input, count, hashes);
+		break;
+	case LogicalTypeId::UTINYINT:
+		TemplatedHashVector<uint8_t, int32_t>(input, count, hashes);
+		break;
+	case LogicalTypeId::USMALLINT:
+		TemplatedHashVector<uint16_t, int32_t>(input, count, hashes);
+		break;
+	case LogicalTypeId::UINTEGER:
+		TemplatedHashVector<uint32_t, uint32_t>(input, count, hashes);
+		break;
+	case LogicalTypeId::BIGINT:
+		TemplatedHashVector<int64_t, int64_t>(input, count, hashes);
+		break;
+	case LogicalTypeId::UBIGINT:
+		TemplatedHashVector<uint64_t, uint64_t>(input, count, hashes);
+		break;
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+		HashStringVector(input, count, hashes);
+		break;
+	default:
+		throw InternalException("Unsupported type for Parquet Bloom filter");
+	}
+}
+
+bool ParquetBloomFilter::HasEqualityFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return ((ConstantFilter &)filter).comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = (ConjunctionAndFilter &)filter;
+		for (auto &child_filter : conjunction.child_filters) {
+			if (HasEqualityFilter(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = (ConjunctionOrFilter &)filter;
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!HasEqualityFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+void ParquetBloomFilter::Insert(uint64_t hash) {
+	auto block_count = words.size() / WORDS_PER_BLOCK;
+	auto block = &words[((hash >> 32) * block_count >> 32) * WORDS_PER_BLOCK];
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		block[i] |= uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::MightContain(uint64_t hash) const {
+	auto block_count = words.size() / WORDS_PER_BLOCK;
+	auto block = &words[((hash >> 32) * block_count >> 32) * WORDS_PER_BLOCK];
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		if (!(block[i] & (uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ParquetBloomFilter::ExcludesFilter(const TableFilter &filter) const {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = (ConstantFilter &)filter;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL || constant_filter.constant.IsNull()) {
+			return false;
+		}
+		return !MightContain(HashValue(constant_filter.constant));
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = (ConjunctionAndFilter &)filter;
+		for (auto &child_filter : conjunction.child_filters) {
+			if (ExcludesFilter(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = (ConjunctionOrFilter &)filter;
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!ExcludesFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Writes a union (of empty structs) with the given field set
+static void WriteUnion(TProtocol &protocol, const char *name, const char *field_name, int16_t field_id) {
+	protocol.writeFieldBegin(name, TType::T_STRUCT, field_id);
+	protocol.writeStructBegin(name);
+	protocol.writeFieldBegin(field_name, TType::T_STRUCT, 1);
+	protocol.writeStructBegin(field_name);
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+}
+
+void ParquetBloomFilter::Write(TProtocol &protocol) const {
+	auto size = words.size() * sizeof(uint32_t);
+	// the BloomFilterHeader
+	protocol.writeStructBegin("BloomFilterHeader");
+	protocol.writeFieldBegin("numBytes", TType::T_I32, 1);
+	protocol.writeI32(int32_t(size));
+	protocol.writeFieldEnd();
+	WriteUnion(protocol, "algorithm", "BLOCK", 2);
+	WriteUnion(protocol, "hash", "XXHASH", 3);
+	WriteUnion(protocol, "compression", "UNCOMPRESSED", 4);
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	// followed by the bitset
+	protocol.getTransport()->write((const uint8_t *)words.data(), size);
+}
+
+//! Reads a union (of empty structs), returns the id of the field that is set
+static int16_t ReadUnion(TProtocol &protocol) {
+	string name;
+	TType field_type;
+	int16_t field_id;
+	int16_t result = 0;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == TType::T_STOP) {
+			break;
+		}
+		result = field_id;
+		protocol.skip(field_type);
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	return result;
+}
+
+unique_ptr<ParquetBloomFilter> ParquetBloomFilter::Read(TProtocol &protocol) {
+	string name;
+	TType field_type;
+	int16_t field_id;
+	int32_t size = 0;
+	// only uncompressed split block filters with xxHash are defined, but check that the file agrees
+	bool supported = true;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == TType::T_STOP) {
+			break;
+		}
+		if (field_id == 1 && field_type == TType::T_I32) {
+			protocol.readI32(size);
+		} else if (field_id >= 2 && field_id <= 4 && field_type == TType::T_STRUCT) {
+			supported = supported && ReadUnion(protocol) == 1;
+		} else {
+			protocol.skip(field_type);
+		}
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	if (!supported || size <= 0 || idx_t(size) > MAX_SIZE || idx_t(size) % BLOCK_SIZE != 0) {
+		return nullptr;
+	}
+	vector<uint32_t> words(size / sizeof(uint32_t));
+	protocol.getTransport()->readAll((uint8_t *)words.data(), size);
+	return make_unique<ParquetBloomFilter>(move(words));
+}
+
+} // namespace duckdb
@@ -19,6 +19,7 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
@@ -87,7 +88,7 @@ static shared_ptr<ParquetFileMetadataCache> LoadMetadata(Allocator &allocator, F
 
 	auto metadata = make_unique<FileMetaData>();
 	metadata->read(proto.get());
-	return make_shared<ParquetFileMetadataCache>(move(metadata), current_time);
+	return make_shared<ParquetFileMetadataCache>(move(metadata), current_time, footer_len);
 }
 
 LogicalType ParquetReader::DeriveLogicalType(const SchemaElement &s_ele, bool binary_as_string) {
@@ -364,6 +365,11 @@ unique_ptr<ColumnReader> ParquetReader::CreateReader(const duckdb_parquet::forma
 		root_struct_reader.child_readers[column_idx] = move(cast_reader);
 	}
 
+	// the top-level columns can emit dictionary-encoded pages as dictionary vectors
+	for (auto &child_reader : root_struct_reader.child_readers) {
+		child_reader->EnableDictionaryVectors();
+	}
+
 	if (parquet_options.filename) {
 		Value val = Value(file_name);
 		root_struct_reader.child_readers.push_back(make_unique<GeneratedConstantColumnReader>(
@@ -403,14 +409,18 @@ void ParquetReader::InitializeSchema(const vector<string> &expected_names, const
 
 	bool has_expected_names = !expected_names.empty();
 	bool has_expected_types = !expected_types.empty();
-	auto root_reader = CreateReader(file_meta_data);
-
-	auto &root_type = root_reader->Type();
-	auto &child_types = StructType::GetChildTypes(root_type);
-	D_ASSERT(root_type.id() == LogicalTypeId::STRUCT);
-	for (auto &type_pair : child_types) {
-		names.push_back(type_pair.first);
-		return_types.push_back(type_pair.second);
+	// deriving the types of the columns from the schema is only done once for every (cached) file
+	if (!metadata->GetSchema(parquet_options.binary_as_string, names, return_types)) {
+		auto root_reader = CreateReader(file_meta_data);
+
+		auto &root_type = root_reader->Type();
+		auto &child_types = StructType::GetChildTypes(root_type);
+		D_ASSERT(root_type.id() == LogicalTypeId::STRUCT);
+		for (auto &type_pair : child_types) {
+			names.push_back(type_pair.first);
+			return_types.push_back(type_pair.second);
+		}
+		metadata->SetSchema(parquet_options.binary_as_string, names, return_types);
 	}
 
 	// Add generated constant column for filename
@@ -649,12 +659,21 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t o
 		auto stats = column_reader->Stats(state.group_idx_list[state.current_group], group.columns);
 		// filters contain output chunk index, not file col idx!
 		auto filter_entry = state.filters->filters.find(out_col_idx);
-		if (stats && filter_entry != state.filters->filters.end()) {
+		if (filter_entry != state.filters->filters.end()) {
 			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
-			auto prune_result = filter.CheckStatistics(*stats);
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-				skip_chunk = true;
+			if (stats) {
+				auto prune_result = filter.CheckStatistics(*stats);
+				if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					skip_chunk = true;
+				}
+			}
+			if (!skip_chunk && ParquetBloomFilter::HasEqualityFilter(filter)) {
+				// the min/max statistics cannot exclude the constant: check the Bloom filter of the column chunk
+				auto bloom_filter = column_reader->ReadBloomFilter(group.columns, *state.thrift_file_proto);
+				if (bloom_filter && bloom_filter->ExcludesFilter(filter)) {
+					skip_chunk = true;
+				}
 			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
@@ -668,6 +687,87 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t o
 	                                  *state.thrift_file_proto);
 }
 
+void ParquetReader::PrepareRowRanges(ParquetReaderScanState &state) {
+	auto &group = GetGroup(state);
+	auto root_reader = ((StructColumnReader *)state.root_reader.get());
+	auto group_rows = (idx_t)group.num_rows;
+
+	vector<ParquetRowRange> ranges;
+	bool has_ranges = false;
+	for (auto &filter_entry : state.filters->filters) {
+		auto file_col_idx = state.column_ids[filter_entry.first];
+		if (IsRowIdColumnId(file_col_idx)) {
+			continue;
+		}
+		vector<ParquetPageStatistics> pages;
+		if (!root_reader->GetChildReader(file_col_idx)->PageStats(group.columns, *state.thrift_file_proto, pages)) {
+			continue;
+		}
+		// collect the (merged) row ranges of the pages that can pass the filter
+		vector<ParquetRowRange> column_ranges;
+		for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+			auto &page = pages[page_idx];
+			auto page_end = page_idx + 1 < pages.size() ? pages[page_idx + 1].first_row : group_rows;
+			if (page.first_row >= page_end) {
+				continue;
+			}
+			if (page.stats &&
+			    filter_entry.second->CheckStatistics(*page.stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				continue;
+			}
+			if (!column_ranges.empty() && column_ranges.back().end == page.first_row) {
+				column_ranges.back().end = page_end;
+			} else {
+				column_ranges.push_back({page.first_row, page_end});
+			}
+		}
+		if (!has_ranges) {
+			ranges = move(column_ranges);
+			has_ranges = true;
+			continue;
+		}
+		// all filters have to pass: intersect the ranges with those of the previous filters
+		vector<ParquetRowRange> intersection;
+		idx_t left_idx = 0;
+		idx_t right_idx = 0;
+		while (left_idx < ranges.size() && right_idx < column_ranges.size()) {
+			auto start = MaxValue<idx_t>(ranges[left_idx].start, column_ranges[right_idx].start);
+			auto end = MinValue<idx_t>(ranges[left_idx].end, column_ranges[right_idx].end);
+			if (start < end) {
+				intersection.push_back({start, end});
+			}
+			if (ranges[left_idx].end < column_ranges[right_idx].end) {
+				left_idx++;
+			} else {
+				right_idx++;
+			}
+		}
+		ranges = move(intersection);
+	}
+	if (!has_ranges) {
+		return;
+	}
+	if (ranges.empty()) {
+		// no page can pass the filters: skip the entire row group
+		state.group_offset = group_rows;
+		return;
+	}
+	state.has_row_ranges = true;
+	state.row_ranges = move(ranges);
+	state.row_range_idx = 0;
+}
+
+void ParquetReader::SkipRows(ParquetReaderScanState &state, idx_t count) {
+	auto root_reader = ((StructColumnReader *)state.root_reader.get());
+	for (auto &file_col_idx : state.column_ids) {
+		if (IsRowIdColumnId(file_col_idx)) {
+			continue;
+		}
+		root_reader->GetChildReader(file_col_idx)->Skip(count);
+	}
+	state.group_offset += count;
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -676,6 +776,14 @@ idx_t ParquetReader::NumRowGroups() {
 	return GetFileMetadata()->row_groups.size();
 }
 
+bool ParquetReader::OnDiskFile() {
+	return file_handle->OnDiskFile();
+}
+
+idx_t ParquetReader::GetGroupRowEnd(ParquetReaderScanState &state) {
+	return MinValue<idx_t>(GetGroup(state).num_rows, state.group_row_end);
+}
+
 void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<column_t> column_ids,
                                    vector<idx_t> groups_to_read, TableFilterSet *filters) {
 	state.current_group = -1;
@@ -683,8 +791,15 @@ void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<column_
 	state.column_ids = column_id_map.empty() ? move(column_ids) : column_id_map;
 	state.group_offset = 0;
 	state.group_idx_list = move(groups_to_read);
+	state.group_row_start = 0;
+	state.group_row_end = NumericLimits<idx_t>::Maximum();
 	state.filters = filters;
 	state.sel.Initialize(STANDARD_VECTOR_SIZE);
+	if (filters) {
+		state.adaptive_filter = make_unique<AdaptiveFilter>(filters, state.filter_statistics);
+	} else {
+		state.adaptive_filter.reset();
+	}
 
 	if (!state.file_handle || state.file_handle->path != file_handle->path) {
 		auto flags = FileFlags::FILE_FLAGS_READ;
@@ -715,14 +830,14 @@ void FilterIsNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 		}
 		return;
 	}
-	D_ASSERT(v.GetVectorType() == VectorType::FLAT_VECTOR);
-
-	auto &mask = FlatVector::Validity(v);
-	if (mask.AllValid()) {
+	// dictionary vectors (of dictionary-encoded string columns) are filtered through their selection vector
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	if (vdata.validity.AllValid()) {
 		filter_mask.reset();
 	} else {
 		for (idx_t i = 0; i < count; i++) {
-			filter_mask[i] = filter_mask[i] && !mask.RowIsValid(i);
+			filter_mask[i] = filter_mask[i] && !vdata.validity.RowIsValid(vdata.sel->get_index(i));
 		}
 	}
 }
@@ -735,12 +850,11 @@ void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 		}
 		return;
 	}
-	D_ASSERT(v.GetVectorType() == VectorType::FLAT_VECTOR);
-
-	auto &mask = FlatVector::Validity(v);
-	if (!mask.AllValid()) {
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	if (!vdata.validity.AllValid()) {
 		for (idx_t i = 0; i < count; i++) {
-			filter_mask[i] = filter_mask[i] && mask.RowIsValid(i);
+			filter_mask[i] = filter_mask[i] && vdata.validity.RowIsValid(vdata.sel->get_index(i));
 		}
 	}
 }
@@ -759,6 +873,19 @@ void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_ma
 		return;
 	}
 
+	if (v.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		UnifiedVectorFormat vdata;
+		v.ToUnifiedFormat(count, vdata);
+		auto v_ptr = (T *)vdata.data;
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			if (filter_mask[i] && vdata.validity.RowIsValid(idx)) {
+				filter_mask[i] = OP::Operation(v_ptr[idx], constant);
+			}
+		}
+		return;
+	}
+
 	D_ASSERT(v.GetVectorType() == VectorType::FLAT_VECTOR);
 	auto v_ptr = FlatVector::GetData<T>(v);
 	auto &mask = FlatVector::Validity(v);
@@ -886,6 +1013,22 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 	}
 }
 
+//! Reads the next count rows of a column, of which only the rows in the filter mask are materialized. The rows after
+//! the last row in the filter mask are skipped rather than decoded.
+static void ReadFilteredColumn(ColumnReader &reader, idx_t count, parquet_filter_t &filter_mask, uint8_t *define_ptr,
+                               uint8_t *repeat_ptr, Vector &result) {
+	idx_t read_count = count;
+	while (read_count > 0 && !filter_mask[read_count - 1]) {
+		read_count--;
+	}
+	if (read_count > 0) {
+		reader.Read(read_count, filter_mask, define_ptr, repeat_ptr, result);
+	}
+	if (read_count < count) {
+		reader.Skip(count - read_count);
+	}
+}
+
 void ParquetReader::Scan(ParquetReaderScanState &state, DataChunk &result) {
 	while (ScanInternal(state, result)) {
 		if (result.size() > 0) {
@@ -901,7 +1044,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	}
 
 	// see if we have to switch to the next row group in the parquet file
-	if (state.current_group < 0 || (int64_t)state.group_offset >= GetGroup(state).num_rows) {
+	if (state.current_group < 0 || state.group_offset >= GetGroupRowEnd(state)) {
 		state.current_group++;
 		state.group_offset = 0;
 
@@ -930,6 +1073,14 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		}
 
 		auto &group = GetGroup(state);
+		state.has_row_ranges = false;
+		if (state.filters && state.group_offset == 0) {
+			PrepareRowRanges(state);
+		}
+		if (state.group_offset == 0 && state.group_row_start > 0) {
+			// only a part of the row group is scanned: skip the rows before it
+			SkipRows(state, MinValue<idx_t>(state.group_row_start, group.num_rows));
+		}
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
 
 			uint64_t total_row_group_span = GetGroupSpan(state);
@@ -980,7 +1131,29 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	auto group_row_end = GetGroupRowEnd(state);
+	if (state.has_row_ranges) {
+		// skip the rows that cannot pass the filters according to the page index
+		auto &ranges = state.row_ranges;
+		while (state.row_range_idx < ranges.size() && ranges[state.row_range_idx].end <= state.group_offset) {
+			state.row_range_idx++;
+		}
+		idx_t next_row = group_row_end;
+		if (state.row_range_idx < ranges.size()) {
+			next_row = MinValue<idx_t>(MaxValue<idx_t>(ranges[state.row_range_idx].start, state.group_offset),
+			                           group_row_end);
+			group_row_end = MinValue<idx_t>(ranges[state.row_range_idx].end, group_row_end);
+		}
+		if (next_row > state.group_offset) {
+			SkipRows(state, next_row - state.group_offset);
+		}
+		if (state.group_offset >= group_row_end) {
+			// no rows left in this row group (part)
+			result.SetCardinality(0);
+			return true;
+		}
+	}
+	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, group_row_end - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -1009,20 +1182,32 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	if (state.filters) {
 		vector<bool> need_to_read(result.ColumnCount(), true);
 
-		// first load the columns that are used in filters
-		for (auto &filter_col : state.filters->filters) {
-			auto file_col_idx = state.column_ids[filter_col.first];
+		// first load the columns that are used in filters, starting with the filters that eliminate the most rows at
+		// the lowest cost: every next filter column only decodes the rows that passed the previous filters
+		auto &adaptive_filter = *state.adaptive_filter;
+		for (idx_t filter_idx = 0; filter_idx < state.filters->filters.size(); filter_idx++) {
+			auto out_col_idx = adaptive_filter.permutation[filter_idx];
+			auto file_col_idx = state.column_ids[out_col_idx];
 			// row_group skipping of columns that are never scanned.
 			if (filter_mask.none()) { // if no rows are left we can stop checking filters
 				break;
 			}
 
-			root_reader->GetChildReader(file_col_idx)
-			    ->Read(result.size(), filter_mask, define_ptr, repeat_ptr, result.data[filter_col.first]);
+			auto tuple_count = filter_mask.count();
+			auto start_time = high_resolution_clock::now();
+			ReadFilteredColumn(*root_reader->GetChildReader(file_col_idx), result.size(), filter_mask, define_ptr,
+			                   repeat_ptr, result.data[out_col_idx]);
 
-			need_to_read[filter_col.first] = false;
+			need_to_read[out_col_idx] = false;
 
-			ApplyFilter(result.data[filter_col.first], *filter_col.second, filter_mask, this_output_chunk_rows);
+			ApplyFilter(result.data[out_col_idx], *state.filters->filters[out_col_idx], filter_mask,
+			            this_output_chunk_rows);
+			auto end_time = high_resolution_clock::now();
+			adaptive_filter.AddFilterRuntime(filter_idx, tuple_count, tuple_count - filter_mask.count(),
+			                                 duration_cast<duration<double>>(end_time - start_time).count());
+		}
+		if (state.filters->filters.size() > 1) {
+			adaptive_filter.AdaptRuntimeStatistics();
 		}
 
 		// we still may have to read some cols
@@ -1037,8 +1222,8 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				continue;
 			}
 			// TODO handle ROWID here, too
-			root_reader->GetChildReader(file_col_idx)
-			    ->Read(result.size(), filter_mask, define_ptr, repeat_ptr, result.data[out_col_idx]);
+			ReadFilteredColumn(*root_reader->GetChildReader(file_col_idx), result.size(), filter_mask, define_ptr,
+			                   repeat_ptr, result.data[out_col_idx]);
 		}
 
 		idx_t sel_size = 0;
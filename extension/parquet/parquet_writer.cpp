@@ -1,4 +1,5 @@
 #include "parquet_writer.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_timestamp.hpp"
 
 #include "duckdb.hpp"
@@ -213,15 +214,16 @@ void ParquetWriter::SetSchemaProperties(const LogicalType &duckdb_type,
 }
 
 ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, FileOpener *file_opener_p, vector<LogicalType> types_p,
-                             vector<string> names_p, CompressionCodec::type codec)
-    : file_name(move(file_name_p)), sql_types(move(types_p)), column_names(move(names_p)), codec(codec) {
+                             vector<string> names_p, CompressionCodec::type codec, vector<bool> bloom_filter_columns_p)
+    : file_name(move(file_name_p)), sql_types(move(types_p)), column_names(move(names_p)), codec(codec),
+      bloom_filter_columns(move(bloom_filter_columns_p)) {
+	bloom_filter_columns.resize(sql_types.size(), false);
 	// initialize the file writer
 	writer = make_unique<BufferedFileWriter>(
 	    fs, file_name.c_str(), FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW, file_opener_p);
 	// parquet files start with the string "PAR1"
 	writer->WriteData((const_data_ptr_t) "PAR1", 4);
-	TCompactProtocolFactoryT<MyTransport> tproto_factory;
-	protocol = tproto_factory.getProtocol(make_shared<MyTransport>(*writer));
+	protocol = CreateProtocol(*writer);
 
 	file_meta_data.num_rows = 0;
 	file_meta_data.version = 1;
@@ -245,22 +247,33 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, FileOpener *fil
 	}
 }
 
+shared_ptr<TProtocol> ParquetWriter::CreateProtocol(Serializer &serializer) {
+	TCompactProtocolFactoryT<MyTransport> tproto_factory;
+	return tproto_factory.getProtocol(make_shared<MyTransport>(serializer));
+}
+
 void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	if (buffer.Count() == 0) {
 		return;
 	}
-	lock_guard<mutex> glock(lock);
+	PreparedRowGroup prepared;
+	PrepareRowGroup(buffer, prepared);
+	FlushRowGroup(prepared);
+}
 
-	// set up a new row group for this chunk collection
-	ParquetRowGroup row_group;
+void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
+	// the row group is written to an in-memory buffer first: only appending it to the file requires the lock
+	auto &row_group = result.row_group;
 	row_group.num_rows = buffer.Count();
-	row_group.file_offset = writer->GetTotalWritten();
-	row_group.__isset.file_offset = true;
+	result.data = make_unique<BufferedSerializer>();
+	auto &target = *result.data;
 
 	// iterate over each of the columns of the chunk collection and write them
 	D_ASSERT(buffer.ColumnCount() == column_writers.size());
+	vector<idx_t> column_chunk_indexes;
 	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx++) {
 		const unique_ptr<ColumnWriter> &col_writer = column_writers[col_idx];
+		column_chunk_indexes.push_back(row_group.columns.size());
 		auto write_state = col_writer->InitializeWriteState(row_group);
 		if (col_writer->HasAnalyze()) {
 			for (auto &chunk : buffer.Chunks()) {
@@ -275,12 +288,55 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 		for (auto &chunk : buffer.Chunks()) {
 			col_writer->Write(*write_state, chunk.data[col_idx], chunk.size());
 		}
-		col_writer->FinalizeWrite(*write_state);
+		col_writer->FinalizeWrite(*write_state, target);
+	}
+
+	// write the Bloom filters of the row group after its column chunks
+	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx++) {
+		if (!bloom_filter_columns[col_idx]) {
+			continue;
+		}
+		unordered_set<uint64_t> hashes;
+		for (auto &chunk : buffer.Chunks()) {
+			ParquetBloomFilter::HashVector(chunk.data[col_idx], chunk.size(), hashes);
+		}
+		ParquetBloomFilter bloom_filter(hashes.size());
+		for (auto &hash : hashes) {
+			bloom_filter.Insert(hash);
+		}
+		// the column chunk of a column with a Bloom filter is the only leaf of that column
+		auto &column_chunk = row_group.columns[column_chunk_indexes[col_idx]];
+		column_chunk.meta_data.__set_bloom_filter_offset(target.blob.size);
+		bloom_filter.Write(*CreateProtocol(target));
+	}
+}
+
+void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
+	if (prepared.row_group.num_rows == 0) {
+		return;
+	}
+	lock_guard<mutex> glock(lock);
+
+	// the offsets of the row group are relative to the start of its buffer: make them point into the file
+	auto &row_group = prepared.row_group;
+	auto file_offset = writer->GetTotalWritten();
+	row_group.file_offset = file_offset;
+	row_group.__isset.file_offset = true;
+	for (auto &column_chunk : row_group.columns) {
+		auto &meta_data = column_chunk.meta_data;
+		meta_data.data_page_offset += file_offset;
+		if (meta_data.__isset.dictionary_page_offset) {
+			meta_data.dictionary_page_offset += file_offset;
+		}
+		if (meta_data.__isset.bloom_filter_offset) {
+			meta_data.bloom_filter_offset += file_offset;
+		}
 	}
+	writer->WriteData(prepared.data->blob.data.get(), prepared.data->blob.size);
 
 	// append the row group to the file meta data
-	file_meta_data.row_groups.push_back(row_group);
-	file_meta_data.num_rows += buffer.Count();
+	file_meta_data.num_rows += row_group.num_rows;
+	file_meta_data.row_groups.push_back(move(row_group));
 }
 
 void ParquetWriter::Finalize() {
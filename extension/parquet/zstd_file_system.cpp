@@ -180,4 +180,98 @@ idx_t ZStdFileSystem::OutBufferSize() {
 	return duckdb_zstd::ZSTD_DStreamOutSize();
 }
 
+static constexpr const uint32_t ZSTD_FRAME_MAGIC = 0xFD2FB528;
+static constexpr const uint32_t ZSTD_SKIPPABLE_FRAME_MAGIC = 0x184D2A50;
+static constexpr const idx_t ZSTD_FRAME_HEADER_MAX_SIZE = 18;
+static constexpr const idx_t ZSTD_BLOCK_HEADER_SIZE = 3;
+static constexpr const idx_t ZSTD_CHECKSUM_SIZE = 4;
+
+bool ZStdFileSystem::FindBlocks(FileHandle &child_handle, vector<CompressedFileBlock> &blocks) {
+	auto file_size = child_handle.GetFileSize();
+	idx_t position = 0;
+	while (position < file_size) {
+		// read the frame header (https://github.com/facebook/zstd/blob/dev/doc/zstd_compression_format.md)
+		data_t header[ZSTD_FRAME_HEADER_MAX_SIZE];
+		auto header_size = MinValue<idx_t>(ZSTD_FRAME_HEADER_MAX_SIZE, file_size - position);
+		if (header_size < 8) {
+			return false;
+		}
+		child_handle.Read(header, header_size, position);
+		auto magic = Load<uint32_t>(header);
+		if ((magic & 0xFFFFFFF0) == ZSTD_SKIPPABLE_FRAME_MAGIC) {
+			// skippable frames (e.g. the seek table of the seekable format) contain no data
+			position += 8 + Load<uint32_t>(header + 4);
+			continue;
+		}
+		if (magic != ZSTD_FRAME_MAGIC) {
+			return false;
+		}
+		auto content_size = duckdb_zstd::ZSTD_getFrameContentSize(header, header_size);
+		if (content_size == ZSTD_CONTENTSIZE_UNKNOWN || content_size == ZSTD_CONTENTSIZE_ERROR) {
+			// the frame does not store its uncompressed size
+			return false;
+		}
+		// compute the size of the header from the frame header descriptor
+		auto descriptor = header[4];
+		bool single_segment = descriptor & 0x20;
+		bool has_checksum = descriptor & 0x04;
+		static constexpr const idx_t DICTIONARY_ID_SIZES[] = {0, 1, 2, 4};
+		static constexpr const idx_t CONTENT_SIZE_SIZES[] = {0, 2, 4, 8};
+		auto content_size_size = CONTENT_SIZE_SIZES[descriptor >> 6];
+		if (content_size_size == 0 && single_segment) {
+			content_size_size = 1;
+		}
+		idx_t frame_end = position + 5 + (single_segment ? 0 : 1) + DICTIONARY_ID_SIZES[descriptor & 0x03] +
+		                  content_size_size;
+		// skip over the blocks of the frame, using their headers
+		bool last_block = false;
+		while (!last_block) {
+			if (frame_end + ZSTD_BLOCK_HEADER_SIZE > file_size) {
+				return false;
+			}
+			data_t block_header[sizeof(uint32_t)] = {0, 0, 0, 0};
+			child_handle.Read(block_header, ZSTD_BLOCK_HEADER_SIZE, frame_end);
+			auto header_value = Load<uint32_t>(block_header);
+			last_block = header_value & 0x01;
+			auto block_type = (header_value >> 1) & 0x03;
+			idx_t block_size = header_value >> 3;
+			if (block_type == 1) {
+				// RLE block: a single byte is repeated block_size times
+				block_size = 1;
+			} else if (block_type == 3) {
+				// reserved block type
+				return false;
+			}
+			frame_end += ZSTD_BLOCK_HEADER_SIZE + block_size;
+		}
+		if (has_checksum) {
+			frame_end += ZSTD_CHECKSUM_SIZE;
+		}
+		if (frame_end > file_size) {
+			return false;
+		}
+		CompressedFileBlock block;
+		block.compressed_offset = position;
+		block.compressed_size = frame_end - position;
+		block.uncompressed_size = content_size;
+		if (block.uncompressed_size > 0) {
+			blocks.push_back(block);
+		}
+		position = frame_end;
+	}
+	return true;
+}
+
+void ZStdFileSystem::DecompressBlock(const_data_ptr_t compressed_data, const CompressedFileBlock &block,
+                                     data_ptr_t target) {
+	auto res =
+	    duckdb_zstd::ZSTD_decompress(target, block.uncompressed_size, compressed_data, block.compressed_size);
+	if (duckdb_zstd::ZSTD_isError(res)) {
+		throw IOException(duckdb_zstd::ZSTD_getErrorName(res));
+	}
+	if (res != block.uncompressed_size) {
+		throw IOException("Failed to decode zstd frame at position %llu", block.compressed_offset);
+	}
+}
+
 } // namespace duckdb
@@ -0,0 +1,295 @@
+#include "duckdb_server.hpp"
+
+#include "duckdb/common/serializer/buffered_serializer.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "httplib.hpp"
+
+namespace duckdb {
+
+DuckDBServer::DuckDBServer(DatabaseInstance &db) : db(db) {
+}
+
+DuckDBServer::~DuckDBServer() {
+	Stop();
+}
+
+shared_ptr<DuckDBServer> DuckDBServer::Get(ClientContext &context) {
+	static mutex cache_lock;
+	lock_guard<mutex> guard(cache_lock);
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto server = cache.Get<DuckDBServer>(ObjectType());
+	if (!server) {
+		server = make_shared<DuckDBServer>(DatabaseInstance::GetDatabase(context));
+		cache.Put(ObjectType(), server);
+	}
+	return server;
+}
+
+static string SerializeSchema(BufferedSerializer &serializer, const vector<LogicalType> &types,
+                              const vector<string> &names) {
+	D_ASSERT(types.size() == names.size());
+	serializer.Write<idx_t>(types.size());
+	for (idx_t i = 0; i < types.size(); i++) {
+		serializer.WriteString(names[i]);
+		types[i].Serialize(serializer);
+	}
+	auto blob = serializer.GetData();
+	return string((const char *)blob.data.get(), blob.size);
+}
+
+//===--------------------------------------------------------------------===//
+// Sessions
+//===--------------------------------------------------------------------===//
+idx_t DuckDBServer::CreateSession() {
+	lock_guard<mutex> guard(lock);
+	auto session_id = next_id++;
+	sessions[session_id] = make_unique<ServerSession>();
+	return session_id;
+}
+
+void DuckDBServer::CloseSession(idx_t session_id) {
+	unique_ptr<ServerSession> session;
+	vector<shared_ptr<ServerQuery>> session_queries;
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = sessions.find(session_id);
+		if (entry == sessions.end()) {
+			throw InvalidInputException("Session %llu does not exist", session_id);
+		}
+		session = move(entry->second);
+		sessions.erase(entry);
+		for (auto &query_id : session->queries) {
+			session_queries.push_back(move(queries[query_id]));
+			queries.erase(query_id);
+		}
+	}
+	// wait for fetches that are in progress before the connections of the queries are closed
+	for (auto &query : session_queries) {
+		lock_guard<mutex> query_guard(query->lock);
+		query->result.reset();
+		query->pending.reset();
+		query->connection.reset();
+	}
+}
+
+unique_ptr<Connection> DuckDBServer::GetConnection(idx_t session_id) {
+	lock_guard<mutex> guard(lock);
+	auto entry = sessions.find(session_id);
+	if (entry == sessions.end()) {
+		throw InvalidInputException("Session %llu does not exist", session_id);
+	}
+	auto &idle_connections = entry->second->idle_connections;
+	if (idle_connections.empty()) {
+		return make_unique<Connection>(db);
+	}
+	// reuse the connection that was used last, so consecutive statements of a session share their connection
+	auto connection = move(idle_connections.back());
+	idle_connections.pop_back();
+	return connection;
+}
+
+void DuckDBServer::ReturnConnection(idx_t session_id, unique_ptr<Connection> connection) {
+	lock_guard<mutex> guard(lock);
+	auto entry = sessions.find(session_id);
+	if (entry != sessions.end()) {
+		entry->second->idle_connections.push_back(move(connection));
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Queries
+//===--------------------------------------------------------------------===//
+string DuckDBServer::DescribeQuery(idx_t session_id, const string &query) {
+	auto connection = GetConnection(session_id);
+	auto prepared = connection->Prepare(query);
+	string error;
+	string schema;
+	if (prepared->HasError()) {
+		error = prepared->GetError();
+	} else {
+		BufferedSerializer serializer;
+		schema = SerializeSchema(serializer, prepared->GetTypes(), prepared->GetNames());
+	}
+	prepared.reset();
+	ReturnConnection(session_id, move(connection));
+	if (!error.empty()) {
+		throw Exception(error);
+	}
+	return schema;
+}
+
+string DuckDBServer::StartQuery(idx_t session_id, const string &query) {
+	auto server_query = make_shared<ServerQuery>(session_id);
+	server_query->connection = GetConnection(session_id);
+	// the query is planned here and its tasks are scheduled, so it starts running before its first batch is fetched
+	server_query->pending = server_query->connection->PendingQuery(query, true);
+
+	lock_guard<mutex> guard(lock);
+	auto entry = sessions.find(session_id);
+	if (entry == sessions.end()) {
+		throw InvalidInputException("Session %llu does not exist", session_id);
+	}
+	auto &session = *entry->second;
+	if (server_query->pending->HasError()) {
+		auto error = server_query->pending->GetError();
+		server_query->pending.reset();
+		session.idle_connections.push_back(move(server_query->connection));
+		throw Exception(error);
+	}
+	auto query_id = next_id++;
+	session.queries.insert(query_id);
+	queries[query_id] = server_query;
+
+	BufferedSerializer serializer;
+	serializer.Write<idx_t>(query_id);
+	return SerializeSchema(serializer, server_query->pending->types, server_query->pending->names);
+}
+
+shared_ptr<ServerQuery> DuckDBServer::GetQuery(idx_t query_id) {
+	lock_guard<mutex> guard(lock);
+	auto entry = queries.find(query_id);
+	if (entry == queries.end()) {
+		throw InvalidInputException("Query %llu does not exist", query_id);
+	}
+	return entry->second;
+}
+
+void DuckDBServer::FinishQuery(idx_t query_id, ServerQuery &query) {
+	query.result.reset();
+	query.pending.reset();
+	lock_guard<mutex> guard(lock);
+	queries.erase(query_id);
+	auto entry = sessions.find(query.session_id);
+	if (entry != sessions.end()) {
+		entry->second->queries.erase(query_id);
+		entry->second->idle_connections.push_back(move(query.connection));
+	}
+	query.connection.reset();
+}
+
+bool DuckDBServer::FetchBatch(idx_t query_id, string &batch) {
+	auto query = GetQuery(query_id);
+	lock_guard<mutex> query_guard(query->lock);
+	if (!query->connection) {
+		throw InvalidInputException("Query %llu was cancelled", query_id);
+	}
+	if (!query->result) {
+		query->result = query->pending->Execute();
+		query->pending.reset();
+	}
+	unique_ptr<DataChunk> chunk;
+	do {
+		chunk = query->result->Fetch();
+	} while (chunk && chunk->size() == 0);
+	if (query->result->HasError()) {
+		auto error = query->result->GetError();
+		FinishQuery(query_id, *query);
+		throw Exception(error);
+	}
+	if (!chunk) {
+		FinishQuery(query_id, *query);
+		return false;
+	}
+	BufferedSerializer serializer(chunk->size() * chunk->ColumnCount() * sizeof(int64_t));
+	chunk->Serialize(serializer);
+	auto blob = serializer.GetData();
+	batch = string((const char *)blob.data.get(), blob.size);
+	return true;
+}
+
+void DuckDBServer::CancelQuery(idx_t query_id) {
+	auto query = GetQuery(query_id);
+	lock_guard<mutex> query_guard(query->lock);
+	if (query->connection) {
+		FinishQuery(query_id, *query);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// HTTP
+//===--------------------------------------------------------------------===//
+static idx_t GetId(const duckdb_httplib::Request &req) {
+	auto matches = req.matches;
+	return std::stoull(matches.str(1));
+}
+
+template <class FUNC>
+static void HandleRequest(duckdb_httplib::Response &res, FUNC func) {
+	try {
+		func();
+	} catch (std::exception &ex) {
+		res.status = 400;
+		res.set_content(ex.what(), "text/plain");
+	}
+}
+
+void DuckDBServer::Start(const string &host, int32_t port) {
+	lock_guard<mutex> guard(server_lock);
+	if (server) {
+		throw InvalidInputException("The server is already running");
+	}
+	auto new_server = make_unique<duckdb_httplib::Server>();
+	new_server->Post("/sessions", [&](const duckdb_httplib::Request &req, duckdb_httplib::Response &res) {
+		HandleRequest(res, [&]() { res.set_content(to_string(CreateSession()), "text/plain"); });
+	});
+	new_server->Delete(R"(/sessions/(\d+))", [&](const duckdb_httplib::Request &req, duckdb_httplib::Response &res) {
+		HandleRequest(res, [&]() { CloseSession(GetId(req)); });
+	});
+	new_server->Post(R"(/sessions/(\d+)/describe)",
+	                 [&](const duckdb_httplib::Request &req, duckdb_httplib::Response &res) {
+		                 HandleRequest(res, [&]() {
+			                 res.set_content(DescribeQuery(GetId(req), req.body), "application/octet-stream");
+		                 });
+	                 });
+	new_server->Post(R"(/sessions/(\d+)/queries)",
+	                 [&](const duckdb_httplib::Request &req, duckdb_httplib::Response &res) {
+		                 HandleRequest(res, [&]() {
+			                 res.set_content(StartQuery(GetId(req), req.body), "application/octet-stream");
+		                 });
+	                 });
+	new_server->Get(R"(/queries/(\d+))", [&](const duckdb_httplib::Request &req, duckdb_httplib::Response &res) {
+		HandleRequest(res, [&]() {
+			string batch;
+			if (FetchBatch(GetId(req), batch)) {
+				res.set_content(batch, "application/octet-stream");
+			} else {
+				res.status = 204;
+			}
+		});
+	});
+	new_server->Delete(R"(/queries/(\d+))", [&](const duckdb_httplib::Request &req, duckdb_httplib::Response &res) {
+		HandleRequest(res, [&]() { CancelQuery(GetId(req)); });
+	});
+	if (!new_server->bind_to_port(host.c_str(), port)) {
+		throw IOException("Could not bind the server to %s:%d", host, port);
+	}
+	server = move(new_server);
+	server_thread = thread([&]() { server->listen_after_bind(); });
+}
+
+void DuckDBServer::Stop() {
+	lock_guard<mutex> guard(server_lock);
+	if (!server) {
+		return;
+	}
+	server->stop();
+	server_thread.join();
+	server.reset();
+	vector<idx_t> session_ids;
+	{
+		lock_guard<mutex> guard(lock);
+		for (auto &entry : sessions) {
+			session_ids.push_back(entry.first);
+		}
+	}
+	for (auto &session_id : session_ids) {
+		CloseSession(session_id);
+	}
+}
+
+bool DuckDBServer::IsRunning() {
+	lock_guard<mutex> guard(server_lock);
+	return server != nullptr;
+}
+
+} // namespace duckdb
@@ -0,0 +1,118 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb_server.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb_httplib {
+class Server;
+} // namespace duckdb_httplib
+
+namespace duckdb {
+
+//! A query that is in flight on the server
+struct ServerQuery {
+	explicit ServerQuery(idx_t session_id) : session_id(session_id) {
+	}
+
+	//! Serializes the fetches of the query
+	mutex lock;
+	//! The session the query belongs to
+	idx_t session_id;
+	//! The connection the query runs on, which is handed back to the session once the query is finished
+	unique_ptr<Connection> connection;
+	//! The pending query, until the first batch is fetched
+	unique_ptr<PendingQueryResult> pending;
+	//! The (streaming) result of the query
+	unique_ptr<QueryResult> result;
+};
+
+//! A session of a remote client
+struct ServerSession {
+	//! The connections of the session that have no query in flight
+	vector<unique_ptr<Connection>> idle_connections;
+	//! The queries of the session that are in flight
+	unordered_set<idx_t> queries;
+};
+
+//! The DuckDBServer executes queries for remote clients over HTTP, and sends their results as serialized DataChunks
+/*!
+    Every query that is in flight runs on its own connection of the session, so several queries of a session can be
+    executed and fetched concurrently. Connections are reused once their query is finished, so statements that are
+    issued one after another run on the same connection and share its settings and transaction.
+
+    POST   /sessions                create a session, returns its id
+    DELETE /sessions/<session>      close a session, cancelling its queries
+    POST   /sessions/<session>/describe  returns the result schema of the query in the body, without running it
+    POST   /sessions/<session>/queries   starts the query in the body, returns the query id and the result schema
+    GET    /queries/<query>         returns the next batch of the result, or 204 (No Content) once it is exhausted
+    DELETE /queries/<query>         cancel a query
+*/
+class DuckDBServer : public ObjectCacheEntry {
+public:
+	explicit DuckDBServer(DatabaseInstance &db);
+	~DuckDBServer() override;
+
+	//! Starts listening on the given host and port in a background thread
+	void Start(const string &host, int32_t port);
+	//! Stops the server, cancelling all queries and closing all sessions
+	void Stop();
+	bool IsRunning();
+
+	//! Returns the server of the database, creating it if it does not exist yet
+	static shared_ptr<DuckDBServer> Get(ClientContext &context);
+
+	static string ObjectType() {
+		return "duckdb_server";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+public:
+	idx_t CreateSession();
+	void CloseSession(idx_t session_id);
+	//! Prepares the query and serializes its result schema
+	string DescribeQuery(idx_t session_id, const string &query);
+	//! Starts the query and serializes its id and result schema
+	string StartQuery(idx_t session_id, const string &query);
+	//! Serializes the next batch of the query, or returns false if the result is exhausted
+	bool FetchBatch(idx_t query_id, string &batch);
+	void CancelQuery(idx_t query_id);
+
+private:
+	unique_ptr<Connection> GetConnection(idx_t session_id);
+	//! Hands a connection back to the idle connections of its session
+	void ReturnConnection(idx_t session_id, unique_ptr<Connection> connection);
+	shared_ptr<ServerQuery> GetQuery(idx_t query_id);
+	//! Removes a query and hands its connection back to its session
+	void FinishQuery(idx_t query_id, ServerQuery &query);
+
+private:
+	DatabaseInstance &db;
+	//! Guards the sessions and the queries
+	mutex lock;
+	unordered_map<idx_t, unique_ptr<ServerSession>> sessions;
+	unordered_map<idx_t, shared_ptr<ServerQuery>> queries;
+	//! Session and query ids are taken from the same counter
+	idx_t next_id = 1;
+
+	//! Guards starting and stopping the server
+	mutex server_lock;
+	unique_ptr<duckdb_httplib::Server> server;
+	thread server_thread;
+};
+
+} // namespace duckdb
@@ -0,0 +1,20 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// remote_query.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/function/table_function.hpp"
+
+namespace duckdb {
+
+//! remote_query(url, query) runs a query on a DuckDBServer and fetches its result batch by batch
+struct RemoteQueryFunction {
+	static TableFunction GetFunction();
+};
+
+} // namespace duckdb
@@ -0,0 +1,21 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// server-extension.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+class ServerExtension : public Extension {
+public:
+	void Load(DuckDB &db) override;
+	std::string Name() override;
+};
+
+} // namespace duckdb
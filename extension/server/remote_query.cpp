@@ -0,0 +1,126 @@
+#include "remote_query.hpp"
+
+#include "duckdb/common/serializer/buffered_deserializer.hpp"
+#include "httplib.hpp"
+
+namespace duckdb {
+
+struct RemoteQueryBindData : public TableFunctionData {
+	string url;
+	string query;
+	vector<LogicalType> types;
+};
+
+//! A session on the server, which is closed when the state is destroyed
+struct RemoteQueryGlobalState : public GlobalTableFunctionState {
+	~RemoteQueryGlobalState() override;
+
+	unique_ptr<duckdb_httplib::Client> client;
+	idx_t session_id = DConstants::INVALID_INDEX;
+	idx_t query_id = DConstants::INVALID_INDEX;
+	//! Whether or not all batches of the query have been fetched
+	bool finished = false;
+};
+
+static string CheckResponse(const string &url, const duckdb_httplib::Result &res) {
+	if (!res) {
+		throw IOException("Could not connect to \"%s\": %s", url, duckdb_httplib::to_string(res.error()));
+	}
+	if (res->status >= 300) {
+		// the server returns the error of the query as-is
+		throw Exception(res->body);
+	}
+	return res->body;
+}
+
+static unique_ptr<duckdb_httplib::Client> Connect(const string &url, idx_t &session_id) {
+	auto client = make_unique<duckdb_httplib::Client>(url);
+	if (!client->is_valid()) {
+		throw InvalidInputException("Invalid server URL \"%s\"", url);
+	}
+	// fetching a batch blocks until the query has produced it
+	client->set_read_timeout(3600);
+	session_id = std::stoull(CheckResponse(url, client->Post("/sessions")));
+	return client;
+}
+
+static void DeserializeSchema(BufferedDeserializer &source, vector<LogicalType> &types, vector<string> &names) {
+	auto column_count = source.Read<idx_t>();
+	for (idx_t i = 0; i < column_count; i++) {
+		names.push_back(source.Read<string>());
+		types.push_back(LogicalType::Deserialize(source));
+	}
+}
+
+static unique_ptr<FunctionData> RemoteQueryBind(ClientContext &context, TableFunctionBindInput &input,
+                                                vector<LogicalType> &return_types, vector<string> &names) {
+	auto result = make_unique<RemoteQueryBindData>();
+	result->url = StringValue::Get(input.inputs[0]);
+	result->query = StringValue::Get(input.inputs[1]);
+
+	// the query is only prepared on the server to obtain its result schema
+	idx_t session_id;
+	auto client = Connect(result->url, session_id);
+	auto session_path = "/sessions/" + to_string(session_id);
+	auto res = client->Post((session_path + "/describe").c_str(), result->query, "text/plain");
+	client->Delete(session_path.c_str());
+	auto schema = CheckResponse(result->url, res);
+	BufferedDeserializer source((data_ptr_t)schema.c_str(), schema.size());
+	DeserializeSchema(source, return_types, names);
+	if (return_types.empty()) {
+		throw InvalidInputException("remote_query requires a query that returns a result");
+	}
+	result->types = return_types;
+	return move(result);
+}
+
+static unique_ptr<GlobalTableFunctionState> RemoteQueryInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto &bind_data = (RemoteQueryBindData &)*input.bind_data;
+	auto result = make_unique<RemoteQueryGlobalState>();
+	result->client = Connect(bind_data.url, result->session_id);
+	auto path = "/sessions/" + to_string(result->session_id) + "/queries";
+	auto response = CheckResponse(bind_data.url, result->client->Post(path.c_str(), bind_data.query, "text/plain"));
+
+	BufferedDeserializer source((data_ptr_t)response.c_str(), response.size());
+	result->query_id = source.Read<idx_t>();
+	vector<LogicalType> types;
+	vector<string> names;
+	DeserializeSchema(source, types, names);
+	if (types != bind_data.types) {
+		throw InvalidInputException("The result schema of the remote query changed after it was bound");
+	}
+	return move(result);
+}
+
+RemoteQueryGlobalState::~RemoteQueryGlobalState() {
+	if (!client || session_id == DConstants::INVALID_INDEX) {
+		return;
+	}
+	// closing the session cancels the query if it has not been fetched entirely
+	client->Delete(("/sessions/" + to_string(session_id)).c_str());
+}
+
+static void RemoteQueryFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = (RemoteQueryBindData &)*data_p.bind_data;
+	auto &state = (RemoteQueryGlobalState &)*data_p.global_state;
+	if (state.finished) {
+		return;
+	}
+	auto res = state.client->Get(("/queries/" + to_string(state.query_id)).c_str());
+	auto batch = CheckResponse(bind_data.url, res);
+	if (res->status == 204) {
+		state.finished = true;
+		return;
+	}
+	BufferedDeserializer source((data_ptr_t)batch.c_str(), batch.size());
+	DataChunk chunk;
+	chunk.Deserialize(source);
+	output.Reference(chunk);
+}
+
+TableFunction RemoteQueryFunction::GetFunction() {
+	return TableFunction("remote_query", {LogicalType::VARCHAR, LogicalType::VARCHAR}, RemoteQueryFunc,
+	                     RemoteQueryBind, RemoteQueryInit);
+}
+
+} // namespace duckdb
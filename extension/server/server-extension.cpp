@@ -0,0 +1,102 @@
+#define DUCKDB_EXTENSION_MAIN
+
+#include "server-extension.hpp"
+#include "duckdb_server.hpp"
+#include "remote_query.hpp"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#endif
+
+namespace duckdb {
+
+struct ServerFunctionData : public TableFunctionData {
+	string host;
+	int32_t port = 0;
+	bool finished = false;
+};
+
+static unique_ptr<FunctionData> ServerStartBind(ClientContext &context, TableFunctionBindInput &input,
+                                                vector<LogicalType> &return_types, vector<string> &names) {
+	auto result = make_unique<ServerFunctionData>();
+	result->host = StringValue::Get(input.inputs[0]);
+	result->port = IntegerValue::Get(input.inputs[1]);
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("url");
+	return move(result);
+}
+
+static void ServerStartFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = (ServerFunctionData &)*data_p.bind_data;
+	if (data.finished) {
+		return;
+	}
+	DuckDBServer::Get(context)->Start(data.host, data.port);
+	output.SetValue(0, 0, Value(StringUtil::Format("http://%s:%d", data.host, data.port)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+static unique_ptr<FunctionData> ServerStopBind(ClientContext &context, TableFunctionBindInput &input,
+                                               vector<LogicalType> &return_types, vector<string> &names) {
+	return_types.emplace_back(LogicalType::BOOLEAN);
+	names.emplace_back("success");
+	return make_unique<ServerFunctionData>();
+}
+
+static void ServerStopFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = (ServerFunctionData &)*data_p.bind_data;
+	if (data.finished) {
+		return;
+	}
+	auto server = DuckDBServer::Get(context);
+	auto was_running = server->IsRunning();
+	server->Stop();
+	output.SetValue(0, 0, Value::BOOLEAN(was_running));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void ServerExtension::Load(DuckDB &db) {
+	Connection con(db);
+	con.BeginTransaction();
+	auto &catalog = Catalog::GetCatalog(*con.context);
+
+	TableFunction server_start("server_start", {LogicalType::VARCHAR, LogicalType::INTEGER}, ServerStartFunction,
+	                           ServerStartBind);
+	CreateTableFunctionInfo server_start_info(server_start);
+	catalog.CreateTableFunction(*con.context, &server_start_info);
+
+	TableFunction server_stop("server_stop", {}, ServerStopFunction, ServerStopBind);
+	CreateTableFunctionInfo server_stop_info(server_stop);
+	catalog.CreateTableFunction(*con.context, &server_stop_info);
+
+	CreateTableFunctionInfo remote_query_info(RemoteQueryFunction::GetFunction());
+	catalog.CreateTableFunction(*con.context, &remote_query_info);
+
+	con.Commit();
+}
+
+std::string ServerExtension::Name() {
+	return "server";
+}
+
+} // namespace duckdb
+
+extern "C" {
+
+DUCKDB_EXTENSION_API void server_init(duckdb::DatabaseInstance &db) {
+	duckdb::DuckDB db_wrapper(db);
+	db_wrapper.LoadExtension<duckdb::ServerExtension>();
+}
+
+DUCKDB_EXTENSION_API const char *server_version() {
+	return duckdb::DuckDB::LibraryVersion();
+}
+}
+
+#ifndef DUCKDB_EXTENSION_MAIN
+#error DUCKDB_EXTENSION_MAIN not defined
+#endif
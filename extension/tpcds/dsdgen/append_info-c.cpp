@@ -4,7 +4,9 @@
 #include "config.h"
 #include "date.h"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/column_data_collection.hpp"
 #include "duckdb/common/types/date.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "nulls.h"
 #include "porting.h"
@@ -14,6 +16,119 @@
 
 using namespace tpcds;
 
+namespace tpcds {
+
+class TPCDSAppendTask : public duckdb::Task {
+public:
+	explicit TPCDSAppendTask(TPCDSAppendQueue &queue) : queue(queue) {
+	}
+
+	duckdb::TaskExecutionResult Execute(duckdb::TaskExecutionMode mode) override {
+		queue.AppendPending();
+		return duckdb::TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	TPCDSAppendQueue &queue;
+};
+
+TPCDSAppendQueue::TPCDSAppendQueue(duckdb::ClientContext &context)
+    : context(context), counter(duckdb::TaskScheduler::GetScheduler(context)), appending(false) {
+	background = duckdb::TaskScheduler::GetScheduler(context).NumberOfThreads() > 1;
+}
+
+TPCDSAppendQueue::~TPCDSAppendQueue() {
+	// generation failed if rows are still pending: drop them, but wait for the background task
+	{
+		std::lock_guard<duckdb::mutex> guard(lock);
+		pending.clear();
+	}
+	counter.Finish();
+}
+
+void TPCDSAppendQueue::Enqueue(duckdb::TableCatalogEntry &table,
+                               duckdb::unique_ptr<duckdb::ColumnDataCollection> rows) {
+	if (!background) {
+		table.storage->LocalAppend(table, context, *rows);
+		return;
+	}
+	std::unique_lock<duckdb::mutex> guard(lock);
+	// limit the memory held by the buffered rows: wait for the background task when generation gets ahead of it
+	appended.wait(guard, [&]() { return pending.size() < MAX_PENDING_APPENDS || error; });
+	if (error) {
+		error.Throw();
+	}
+	TPCDSPendingAppend append;
+	append.table = &table;
+	append.rows = std::move(rows);
+	pending.push_back(std::move(append));
+	if (!appending) {
+		appending = true;
+		counter.AddTask(duckdb::make_unique<TPCDSAppendTask>(*this));
+	}
+}
+
+void TPCDSAppendQueue::AppendPending() {
+	while (true) {
+		TPCDSPendingAppend append;
+		{
+			std::lock_guard<duckdb::mutex> guard(lock);
+			if (pending.empty() || error) {
+				appending = false;
+				break;
+			}
+			append = std::move(pending.front());
+			pending.pop_front();
+		}
+		appended.notify_all();
+		try {
+			append.table->storage->LocalAppend(*append.table, context, *append.rows);
+		} catch (duckdb::Exception &ex) {
+			std::lock_guard<duckdb::mutex> guard(lock);
+			error = duckdb::PreservedError(ex);
+		} catch (std::exception &ex) {
+			std::lock_guard<duckdb::mutex> guard(lock);
+			error = duckdb::PreservedError(ex);
+		} catch (...) { // LCOV_EXCL_START
+			std::lock_guard<duckdb::mutex> guard(lock);
+			error = duckdb::PreservedError("Unknown exception during TPC-DS data generation!");
+		} // LCOV_EXCL_STOP
+	}
+	appended.notify_all();
+	counter.FinishTask();
+}
+
+void TPCDSAppendQueue::Finish() {
+	counter.Finish();
+	if (error) {
+		error.Throw();
+	}
+}
+
+TPCDSAppender::TPCDSAppender(TPCDSAppendQueue &queue, duckdb::TableCatalogEntry &table)
+    : BaseAppender(duckdb::Allocator::DefaultAllocator(), table.GetTypes(), duckdb::AppenderType::PHYSICAL),
+      queue(queue), table(table) {
+}
+
+void TPCDSAppender::FlushInternal(duckdb::ColumnDataCollection &) {
+	// hand the collection over to the queue: the appender continues with an empty one
+	queue.Enqueue(table, std::move(collection));
+	collection = duckdb::make_unique<duckdb::ColumnDataCollection>(allocator, types);
+}
+
+void TPCDSAppender::AppendChunksInternal(const std::function<bool(duckdb::DataChunk &chunk)> &next_chunk) {
+	auto rows = duckdb::make_unique<duckdb::ColumnDataCollection>(allocator, types);
+	duckdb::DataChunk chunk;
+	chunk.Initialize(allocator, types);
+	while (next_chunk(chunk)) {
+		rows->Append(chunk);
+		chunk.Reset();
+	}
+	queue.Enqueue(table, std::move(rows));
+}
+
+} // namespace tpcds
+
 append_info *append_info_get(void *info_list, int table_id) {
 	auto &append_vector = *((std::vector<std::unique_ptr<tpcds_append_information>> *)info_list);
 	return (append_info *)append_vector[table_id].get();
@@ -73,6 +73,9 @@ void DSDGenWrapper::DSDGen(double scale, ClientContext &context, string schema,
 
 	InitializeDSDgen(scale);
 
+	// the rows are appended in the background while the next rows are generated
+	TPCDSAppendQueue append_queue(context);
+
 	// populate append info
 	vector<unique_ptr<tpcds_append_information>> append_info;
 	append_info.resize(DBGEN_VERSION);
@@ -86,7 +89,7 @@ void DSDGenWrapper::DSDGen(double scale, ClientContext &context, string schema,
 		assert(table_def.name);
 		auto table_entry = catalog.GetEntry<TableCatalogEntry>(context, schema, table_name);
 
-		auto append = make_unique<tpcds_append_information>(context, table_entry);
+		auto append = make_unique<tpcds_append_information>(append_queue, table_entry);
 		append->table_def = table_def;
 		append_info[table_id] = move(append);
 	}
@@ -124,6 +127,7 @@ void DSDGenWrapper::DSDGen(double scale, ClientContext &context, string schema,
 	for (int table_id = tmin; table_id < tmax; table_id++) {
 		append_info[table_id]->appender.Close();
 	}
+	append_queue.Finish();
 }
 
 uint32_t DSDGenWrapper::QueriesCount() {
@@ -4,6 +4,10 @@
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/client_context.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/preserved_error.hpp"
+#include "duckdb/parallel/task_counter.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/types/date.hpp"
 #include "duckdb/parser/column_definition.hpp"
@@ -14,6 +18,7 @@
 
 #include <memory>
 #include <cassert>
+#include <condition_variable>
 
 namespace tpcds {
 
@@ -26,13 +31,61 @@ struct tpcds_table_def {
 #define CALL_CENTER   0
 #define DBGEN_VERSION 24
 
+struct TPCDSPendingAppend {
+	duckdb::TableCatalogEntry *table;
+	duckdb::unique_ptr<duckdb::ColumnDataCollection> rows;
+};
+
+//! Appends the rows buffered by the appenders of the tables on a background task. dsdgen generates all tables on a
+//! single thread (its random number streams are global), this overlaps that generation with appending the rows.
+class TPCDSAppendQueue {
+public:
+	explicit TPCDSAppendQueue(duckdb::ClientContext &context);
+	~TPCDSAppendQueue();
+
+	//! Appends the rows to the table, after the previously enqueued rows have been appended
+	void Enqueue(duckdb::TableCatalogEntry &table, duckdb::unique_ptr<duckdb::ColumnDataCollection> rows);
+	//! Appends the pending rows, called by the background task
+	void AppendPending();
+	//! Waits until all enqueued rows have been appended, and throws the error of the appends (if any)
+	void Finish();
+
+private:
+	//! The maximum amount of buffered collections that wait to be appended, before generation waits for the appends
+	static constexpr const duckdb::idx_t MAX_PENDING_APPENDS = 4;
+
+	duckdb::ClientContext &context;
+	//! Whether the rows are appended on a background task, which requires more than one thread
+	bool background;
+	duckdb::TaskCounter counter;
+
+	duckdb::mutex lock;
+	std::condition_variable appended;
+	duckdb::deque<TPCDSPendingAppend> pending;
+	//! Whether there is a scheduled task appending the pending rows
+	bool appending;
+	duckdb::PreservedError error;
+};
+
+//! Appender that hands the buffered rows to the append queue when flushing
+class TPCDSAppender : public duckdb::BaseAppender {
+public:
+	TPCDSAppender(TPCDSAppendQueue &queue, duckdb::TableCatalogEntry &table);
+
+protected:
+	void FlushInternal(duckdb::ColumnDataCollection &collection) override;
+	void AppendChunksInternal(const std::function<bool(duckdb::DataChunk &chunk)> &next_chunk) override;
+
+private:
+	TPCDSAppendQueue &queue;
+	duckdb::TableCatalogEntry &table;
+};
+
 struct tpcds_append_information {
-	tpcds_append_information(duckdb::ClientContext &context_p, duckdb::TableCatalogEntry *table)
-	    : context(context_p), appender(context_p, *table) {
+	tpcds_append_information(TPCDSAppendQueue &queue, duckdb::TableCatalogEntry *table) : appender(queue, *table) {
 	}
 
-	duckdb::ClientContext &context;
-	duckdb::InternalAppender appender;
+	TPCDSAppender appender;
 
 	tpcds_table_def table_def;
 };
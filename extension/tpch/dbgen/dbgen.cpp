@@ -10,6 +10,12 @@
 #include "duckdb/parser/constraints/not_null_constraint.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/main/appender.hpp"
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/common/preserved_error.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/parallel/task_counter.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/data_table.hpp"
 #endif
 
 #define DECLARER /* EXTERN references get defined here */
@@ -24,8 +30,38 @@ using namespace duckdb;
 
 namespace tpch {
 
+//! Appender that buffers the rows generated for a range of a table, the buffered rows are appended to the table once
+//! all preceding ranges of the table have been appended
+class TPCHRangeAppender : public BaseAppender {
+public:
+	explicit TPCHRangeAppender(vector<LogicalType> types)
+	    : BaseAppender(Allocator::DefaultAllocator(), move(types), AppenderType::PHYSICAL) {
+	}
+
+	//! The buffered rows
+	vector<unique_ptr<ColumnDataCollection>> buffered;
+
+protected:
+	void FlushInternal(ColumnDataCollection &) override {
+		// take over the collection: the appender continues with an empty one
+		buffered.push_back(move(collection));
+		collection = make_unique<ColumnDataCollection>(allocator, types);
+	}
+
+	void AppendChunksInternal(const std::function<bool(DataChunk &chunk)> &next_chunk) override {
+		auto result = make_unique<ColumnDataCollection>(allocator, types);
+		DataChunk chunk;
+		chunk.Initialize(allocator, types);
+		while (next_chunk(chunk)) {
+			result->Append(chunk);
+			chunk.Reset();
+		}
+		buffered.push_back(move(result));
+	}
+};
+
 struct tpch_append_information {
-	unique_ptr<InternalAppender> appender;
+	unique_ptr<TPCHRangeAppender> appender;
 };
 
 void append_value(tpch_append_information &info, int32_t value) {
@@ -244,14 +280,15 @@ static void append_region(code_t *c, tpch_append_information *info) {
 	append_info.appender->EndRow();
 }
 
-static void gen_tbl(int tnum, DSS_HUGE count, tpch_append_information *info, DBGenContext *dbgen_ctx) {
+static void gen_tbl(int tnum, DSS_HUGE start, DSS_HUGE count, tpch_append_information *info,
+                    DBGenContext *dbgen_ctx) {
 	order_t o;
 	supplier_t supp;
 	customer_t cust;
 	part_t part;
 	code_t code;
 
-	for (DSS_HUGE i = 1; count; count--, i++) {
+	for (DSS_HUGE i = start + 1; count; count--, i++) {
 		row_start(tnum, dbgen_ctx);
 		switch (tnum) {
 		case LINE:
@@ -310,6 +347,135 @@ string get_table_name(int num) {
 	}
 }
 
+//! The amount of rows of a table that are generated by a single task
+static constexpr const DSS_HUGE DBGEN_RANGE_SIZE = 10000;
+
+//! Returns the tables that are filled when generating the given table
+static vector<int> get_generated_tables(int tnum) {
+	switch (tnum) {
+	case ORDER_LINE:
+		return {ORDER, LINE};
+	case PART_PSUPP:
+		return {PART, PSUPP};
+	default:
+		return {tnum};
+	}
+}
+
+struct TPCHTableGenerateState {
+	//! The index of the next range that is appended to the table(s)
+	idx_t next_range = 0;
+	//! The generated ranges that wait for the preceding ranges to be appended
+	map<idx_t, unique_ptr<tpch_append_information[]>> finished;
+};
+
+struct TPCHGenerateState {
+	TPCHGenerateState(ClientContext &context, DBGenContext &base_ctx)
+	    : context(context), base_ctx(base_ctx), counter(TaskScheduler::GetScheduler(context)) {
+		for (idx_t i = 0; i <= REGION; i++) {
+			tables[i] = nullptr;
+		}
+	}
+
+	ClientContext &context;
+	//! The generator state after loading the distributions, every range starts from a copy of it
+	DBGenContext &base_ctx;
+	//! The tables to append to
+	TableCatalogEntry *tables[REGION + 1];
+	TPCHTableGenerateState table_states[REGION + 1];
+	TaskCounter counter;
+	//! Appending to the transaction-local storage is not thread-safe: only one range is appended at a time
+	mutex append_lock;
+
+	mutex error_lock;
+	PreservedError error;
+
+public:
+	void PushError(PreservedError new_error) {
+		lock_guard<mutex> guard(error_lock);
+		if (!error) {
+			error = move(new_error);
+		}
+	}
+
+	//! Appends the generated range, and any generated ranges that follow it, once the preceding ranges are appended.
+	//! This keeps the rows of every table in the same order as generating the whole table on a single thread.
+	void FinishRange(int tnum, idx_t range_idx, unique_ptr<tpch_append_information[]> info) {
+		lock_guard<mutex> guard(append_lock);
+		auto &table_state = table_states[tnum];
+		table_state.finished[range_idx] = move(info);
+		while (true) {
+			auto entry = table_state.finished.find(table_state.next_range);
+			if (entry == table_state.finished.end()) {
+				break;
+			}
+			for (auto table_idx : get_generated_tables(tnum)) {
+				auto &table = *tables[table_idx];
+				for (auto &collection : entry->second[table_idx].appender->buffered) {
+					table.storage->LocalAppend(table, context, *collection);
+				}
+			}
+			table_state.finished.erase(entry);
+			table_state.next_range++;
+		}
+	}
+};
+
+//! Generates a range of rows of a table
+class TPCHGenerateTask : public Task {
+public:
+	TPCHGenerateTask(TPCHGenerateState &state, int tnum, idx_t range_idx, DSS_HUGE start, DSS_HUGE count)
+	    : state(state), tnum(tnum), range_idx(range_idx), start(start), count(count) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			auto tables = get_generated_tables(tnum);
+			auto info = unique_ptr<tpch_append_information[]>(new tpch_append_information[REGION + 1]);
+			for (auto table_idx : tables) {
+				info[table_idx].appender = make_unique<TPCHRangeAppender>(state.tables[table_idx]->GetTypes());
+			}
+			// advance the seeds past the rows of the preceding ranges
+			DBGenContext dbgen_ctx = state.base_ctx;
+			row_skip_h(tnum, start, &dbgen_ctx);
+			gen_tbl(tnum, start, count, info.get(), &dbgen_ctx);
+			for (auto table_idx : tables) {
+				info[table_idx].appender->Flush();
+			}
+			state.FinishRange(tnum, range_idx, move(info));
+		} catch (Exception &ex) {
+			state.PushError(PreservedError(ex));
+		} catch (std::exception &ex) {
+			state.PushError(PreservedError(ex));
+		} catch (...) { // LCOV_EXCL_START
+			state.PushError(PreservedError("Unknown exception during TPC-H data generation!"));
+		} // LCOV_EXCL_STOP
+		state.counter.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	TPCHGenerateState &state;
+	int tnum;
+	idx_t range_idx;
+	DSS_HUGE start;
+	DSS_HUGE count;
+};
+
+//! mk_order, mk_part, mk_cust and mk_supp lazily initialize static state on their first call: call them once before
+//! generating in parallel, so the tasks only read that state
+static void initialize_generators(DBGenContext &base_ctx) {
+	DBGenContext dbgen_ctx = base_ctx;
+	auto o = make_unique<order_t>();
+	auto part = make_unique<part_t>();
+	customer_t cust;
+	supplier_t supp;
+	mk_order(1, o.get(), &dbgen_ctx, 0);
+	mk_part(1, part.get(), &dbgen_ctx);
+	mk_cust(1, &cust, &dbgen_ctx);
+	mk_supp(1, &supp, &dbgen_ctx);
+}
+
 struct RegionInfo {
 	static constexpr char *Name = "region";
 	static constexpr idx_t ColumnCount = 3;
@@ -498,17 +664,17 @@ void DBGenWrapper::LoadTPCHData(ClientContext &context, double flt_scale, string
 
 	auto &catalog = Catalog::GetCatalog(context);
 
-	auto append_info = unique_ptr<tpch_append_information[]>(new tpch_append_information[REGION + 1]);
-	memset(append_info.get(), 0, sizeof(tpch_append_information) * REGION + 1);
+	TPCHGenerateState state(context, dbgen_ctx);
 	for (size_t i = PART; i <= REGION; i++) {
 		auto tname = get_table_name(i);
 		if (!tname.empty()) {
 			string full_tname = string(tname) + string(suffix);
-			auto tbl_catalog = catalog.GetEntry<TableCatalogEntry>(context, schema, full_tname);
-			append_info[i].appender = make_unique<InternalAppender>(context, *tbl_catalog);
+			state.tables[i] = catalog.GetEntry<TableCatalogEntry>(context, schema, full_tname);
 		}
 	}
+	initialize_generators(dbgen_ctx);
 
+	// split the tables into ranges of rows, which are generated in parallel
 	for (i = PART; i <= REGION; i++) {
 		if (table & (1 << i)) {
 			if (i < NATION) {
@@ -516,19 +682,19 @@ void DBGenWrapper::LoadTPCHData(ClientContext &context, double flt_scale, string
 			} else {
 				rowcnt = tdefs[i].base;
 			}
-			// actually doing something
-			gen_tbl((int)i, rowcnt, append_info.get(), &dbgen_ctx);
-		}
-	}
-	// flush any incomplete chunks
-	for (size_t i = PART; i <= REGION; i++) {
-		if (append_info[i].appender) {
-			append_info[i].appender->Flush();
-			append_info[i].appender.reset();
+			idx_t range_idx = 0;
+			for (DSS_HUGE start = 0; start < rowcnt; start += DBGEN_RANGE_SIZE) {
+				auto count = MinValue<DSS_HUGE>(DBGEN_RANGE_SIZE, rowcnt - start);
+				state.counter.AddTask(make_unique<TPCHGenerateTask>(state, (int)i, range_idx++, start, count));
+			}
 		}
 	}
+	state.counter.Finish();
 
 	cleanup_dists();
+	if (state.error) {
+		state.error.Throw();
+	}
 }
 
 string DBGenWrapper::GetQuery(int query) {
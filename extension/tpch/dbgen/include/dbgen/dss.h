@@ -166,6 +166,7 @@ DSS_HUGE UnifInt PROTO((DSS_HUGE nLow, DSS_HUGE nHigh, seed_t *seed));
 void dss_random(DSS_HUGE *tgt, DSS_HUGE min, DSS_HUGE max, seed_t *seed);
 void row_start(int t, DBGenContext *ctx);
 void row_stop_h(int t, DBGenContext *ctx);
+void row_skip_h(int t, DSS_HUGE count, DBGenContext *ctx);
 void dump_seeds_ds(int t, seed_t *seeds);
 
 /* text.c */
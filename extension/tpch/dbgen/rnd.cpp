@@ -70,6 +70,25 @@ void row_stop_h(int t, DBGenContext *ctx) {
 	return;
 }
 
+/* advance the seeds of a table past count rows, which is what row_stop_h does after every generated row */
+void row_skip_h(int t, DSS_HUGE count, DBGenContext *ctx) {
+	int i;
+
+	if (t == ORDER_LINE)
+		t = ORDER;
+	if (t == PART_PSUPP)
+		t = PART;
+
+	for (i = 0; i <= MAX_STREAM; i++)
+		if ((ctx->Seed[i].table == t) || (ctx->Seed[i].table == ctx->tdefs[t].child)) {
+			NthElement(ctx->Seed[i].boundary * count, &ctx->Seed[i].value);
+#ifdef RNG_TEST
+			ctx->Seed[i].nCalls += ctx->Seed[i].boundary * count;
+#endif
+		}
+	return;
+}
+
 void dump_seeds(int tbl, seed_t *seeds) {
 	int i;
 
@@ -274,18 +274,18 @@ CatalogException Catalog::CreateMissingEntryException(ClientContext &context, co
 CatalogEntryLookup Catalog::LookupEntry(ClientContext &context, CatalogType type, const string &schema_name,
                                         const string &name, bool if_exists, QueryErrorContext error_context) {
 	if (!schema_name.empty()) {
-		auto schema = GetSchema(context, schema_name, if_exists, error_context);
-		if (!schema) {
-			D_ASSERT(if_exists);
+		auto lookup = LookupEntryInSchema(context, type, schema_name, name);
+		if (!lookup.schema) {
+			if (!if_exists) {
+				// throws the exception that the schema does not exist
+				GetSchema(context, schema_name, false, error_context);
+			}
 			return {nullptr, nullptr};
 		}
-
-		auto entry = schema->GetCatalogSet(type).GetEntry(context, name);
-		if (!entry && !if_exists) {
-			throw CreateMissingEntryException(context, name, type, {schema}, error_context);
+		if (!lookup.Found() && !if_exists) {
+			throw CreateMissingEntryException(context, name, type, {lookup.schema}, error_context);
 		}
-
-		return {schema, entry};
+		return lookup;
 	}
 
 	const auto &paths = ClientData::Get(context).catalog_search_path->Get();
@@ -311,6 +311,22 @@ CatalogEntryLookup Catalog::LookupEntry(ClientContext &context, CatalogType type
 	return {nullptr, nullptr};
 }
 
+CatalogEntryLookup Catalog::LookupEntryInSchema(ClientContext &context, CatalogType type, const string &schema_name,
+                                                const string &name) {
+	// the entries that are visible to the transaction only change when the catalog is modified, so lookups that are
+	// repeated within the transaction (e.g. the schemas of the search path that do not contain the entry) are cached
+	auto &cache = Transaction::GetTransaction(context).catalog_lookups;
+	auto version = GetCatalogVersion();
+	CatalogEntryLookup result;
+	if (cache.Get(version, type, schema_name, name, result.schema, result.entry)) {
+		return result;
+	}
+	result.schema = GetSchema(context, schema_name, true);
+	result.entry = result.schema ? result.schema->GetCatalogSet(type).GetEntry(context, name) : nullptr;
+	cache.Put(version, type, schema_name, name, result.schema, result.entry);
+	return result;
+}
+
 CatalogEntry *Catalog::GetEntry(ClientContext &context, const string &schema, const string &name) {
 	vector<CatalogType> entry_types {CatalogType::TABLE_ENTRY, CatalogType::SEQUENCE_ENTRY};
 
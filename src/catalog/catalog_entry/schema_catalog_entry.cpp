@@ -305,6 +305,10 @@ void SchemaCatalogEntry::Scan(ClientContext &context, CatalogType type,
 	set.Scan(context, callback);
 }
 
+void SchemaCatalogEntry::SetDefaultGenerator(CatalogType type, unique_ptr<DefaultGenerator> generator) {
+	GetCatalogSet(type).SetDefaultGenerator(move(generator));
+}
+
 void SchemaCatalogEntry::Scan(CatalogType type, const std::function<void(CatalogEntry *)> &callback) {
 	auto &set = GetCatalogSet(type);
 	set.Scan(callback);
@@ -6,6 +6,7 @@
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
 #include "duckdb/common/limits.hpp"
+#include "duckdb/execution/materialized_view.hpp"
 
 #include <algorithm>
 
@@ -18,6 +19,7 @@ void ViewCatalogEntry::Initialize(CreateViewInfo *info) {
 	this->temporary = info->temporary;
 	this->sql = info->sql;
 	this->internal = info->internal;
+	this->materialized = info->materialized;
 }
 
 ViewCatalogEntry::ViewCatalogEntry(Catalog *catalog, SchemaCatalogEntry *schema, CreateViewInfo *info)
@@ -52,6 +54,7 @@ void ViewCatalogEntry::Serialize(Serializer &serializer) {
 	writer.WriteSerializable(*query);
 	writer.WriteList<string>(aliases);
 	writer.WriteRegularSerializableList<LogicalType>(types);
+	writer.WriteField<bool>(materialized);
 	writer.Finalize();
 }
 
@@ -65,6 +68,7 @@ unique_ptr<CreateViewInfo> ViewCatalogEntry::Deserialize(Deserializer &source, C
 	info->query = reader.ReadRequiredSerializable<SelectStatement>();
 	info->aliases = reader.ReadRequiredList<string>();
 	info->types = reader.ReadRequiredSerializableList<LogicalType, LogicalType>();
+	info->materialized = reader.ReadField<bool>(false);
 	reader.Finalize();
 
 	return info;
@@ -90,6 +94,7 @@ unique_ptr<CatalogEntry> ViewCatalogEntry::Copy(ClientContext &context) {
 	}
 	create_info->temporary = temporary;
 	create_info->sql = sql;
+	create_info->materialized = materialized;
 
 	return make_unique<ViewCatalogEntry>(catalog, schema, create_info.get());
 }
@@ -61,6 +61,8 @@ void CatalogSet::PutEntry(EntryIndex index, unique_ptr<CatalogEntry> catalog_ent
 	catalog_entry->child = move(entry->second.entry);
 	catalog_entry->child->parent = catalog_entry.get();
 	entry->second.entry = move(catalog_entry);
+	// the new version of the entry is now visible: invalidate the catalog lookups that transactions have cached
+	catalog.ModifyCatalog();
 }
 
 bool CatalogSet::CreateEntry(ClientContext &context, const string &name, unique_ptr<CatalogEntry> value,
@@ -603,6 +605,14 @@ void CatalogSet::Undo(CatalogEntry *entry) {
 	catalog.ModifyCatalog();
 }
 
+void CatalogSet::SetDefaultGenerator(unique_ptr<DefaultGenerator> defaults_p) {
+	lock_guard<mutex> lock(catalog_lock);
+	if (defaults) {
+		throw InternalException("Catalog set already has a default generator");
+	}
+	defaults = move(defaults_p);
+}
+
 void CatalogSet::CreateDefaultEntries(ClientContext &context, unique_lock<mutex> &lock) {
 	if (!defaults || defaults->created_all_entries) {
 		return;
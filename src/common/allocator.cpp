@@ -6,6 +6,10 @@
 
 #include <cstdint>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 #ifdef DUCKDB_DEBUG_ALLOCATION
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
@@ -109,7 +113,7 @@ Allocator::Allocator()
 Allocator::Allocator(allocate_function_ptr_t allocate_function_p, free_function_ptr_t free_function_p,
                      reallocate_function_ptr_t reallocate_function_p, unique_ptr<PrivateAllocatorData> private_data_p)
     : allocate_function(allocate_function_p), free_function(free_function_p),
-      reallocate_function(reallocate_function_p), private_data(move(private_data_p)) {
+      reallocate_function(reallocate_function_p), private_data(move(private_data_p)), huge_pages(false) {
 	D_ASSERT(allocate_function);
 	D_ASSERT(free_function);
 	D_ASSERT(reallocate_function);
@@ -149,7 +153,9 @@ data_ptr_t Allocator::AllocateData(idx_t size) {
 	auto result = (data_ptr_t)vmm.lemon_malloc(size);
 	mtx.unlock();
 #endif
-
+	if (huge_pages && size >= HUGE_PAGE_SIZE) {
+		AdviseHugePages(result, size);
+	}
 	return result;
 }
 
@@ -194,6 +200,9 @@ data_ptr_t Allocator::ReallocateData(data_ptr_t pointer, idx_t old_size, idx_t s
 	if (!new_pointer) {
 		throw std::bad_alloc();
 	}
+	if (huge_pages && size >= HUGE_PAGE_SIZE) {
+		AdviseHugePages(new_pointer, size);
+	}
 	return new_pointer;
 #endif
 
@@ -204,11 +213,27 @@ data_ptr_t Allocator::ReallocateData(data_ptr_t pointer, idx_t old_size, idx_t s
 	memcpy(new_addr, pointer, old_size);
 	vmm.lemon_free(pointer);
 	mtx.unlock();
+	if (huge_pages && size >= HUGE_PAGE_SIZE) {
+		AdviseHugePages((data_ptr_t)new_addr, size);
+	}
 	return (data_ptr_t)new_addr;
 #endif
 
 }
 
+void Allocator::AdviseHugePages(data_ptr_t pointer, idx_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	// only the part of the allocation that covers whole huge pages can be backed by huge pages
+	auto start = AlignValue<idx_t, HUGE_PAGE_SIZE>((idx_t)pointer);
+	auto end = ((idx_t)pointer + size) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+	if (start >= end) {
+		return;
+	}
+	// this is only a hint: if transparent huge pages are disabled we silently fall back to regular pages
+	madvise((void *)start, end - start, MADV_HUGEPAGE);
+#endif
+}
+
 shared_ptr<Allocator> &Allocator::DefaultAllocatorReference() {
 	static shared_ptr<Allocator> DEFAULT_ALLOCATOR = make_shared<Allocator>();
 	return DEFAULT_ALLOCATOR;
@@ -30,6 +30,8 @@ struct ArrowAppendData {
 
 	// child data (if any)
 	vector<unique_ptr<ArrowAppendData>> child_data;
+	//! the vector that is exported without copying (if any), keeps the memory of the vector alive
+	unique_ptr<Vector> zero_copy_vector;
 
 	//! the arrow array C API data, only set after Finalize
 	unique_ptr<ArrowArray> array;
@@ -180,6 +182,53 @@ struct ArrowScalarData : public ArrowScalarBaseData<TGT, SRC, OP> {
 	}
 };
 
+//===--------------------------------------------------------------------===//
+// Fixed-Size Types
+//===--------------------------------------------------------------------===//
+//! Fixed-size types with the same layout in DuckDB and Arrow. If an array consists of a single vector that keeps its
+//! (immutable) memory alive, the memory of the vector is exported without copying it.
+template <class T>
+struct ArrowFixedSizeData : public ArrowScalarData<T> {
+	static bool CanZeroCopy(Vector &input) {
+		if (input.GetVectorType() != VectorType::FLAT_VECTOR) {
+			return false;
+		}
+		auto buffer = input.GetBuffer();
+		return buffer && buffer->GetBufferType() == VectorBufferType::SHARED_BUFFER && !buffer->GetData();
+	}
+
+	static void Append(ArrowAppendData &append_data, Vector &input, idx_t size) {
+		if (append_data.row_count == 0 && CanZeroCopy(input)) {
+			append_data.zero_copy_vector = make_unique<Vector>(input);
+			append_data.row_count = size;
+			return;
+		}
+		// the array consists of multiple vectors: copy the data of the first vector after all
+		if (append_data.zero_copy_vector) {
+			auto first_vector = move(append_data.zero_copy_vector);
+			auto first_size = append_data.row_count;
+			append_data.row_count = 0;
+			ArrowScalarData<T>::Append(append_data, *first_vector, first_size);
+		}
+		ArrowScalarData<T>::Append(append_data, input, size);
+	}
+
+	static void Finalize(ArrowAppendData &append_data, const LogicalType &type, ArrowArray *result) {
+		if (!append_data.zero_copy_vector) {
+			ArrowScalarData<T>::Finalize(append_data, type, result);
+			return;
+		}
+		// the validity mask of a vector has the same layout as an arrow validity bitmap
+		auto &input = *append_data.zero_copy_vector;
+		auto &validity = FlatVector::Validity(input);
+		result->n_buffers = 2;
+		result->buffers[0] = validity.GetData();
+		result->buffers[1] = FlatVector::GetData(input);
+		auto valid_count = validity.AllValid() ? append_data.row_count : validity.CountValid(append_data.row_count);
+		result->null_count = append_data.row_count - valid_count;
+	}
+};
+
 //===--------------------------------------------------------------------===//
 // Enums
 //===--------------------------------------------------------------------===//
@@ -559,14 +608,14 @@ static void InitializeFunctionPointers(ArrowAppendData &append_data, const Logic
 		InitializeFunctionPointers<ArrowBoolData>(append_data);
 		break;
 	case LogicalTypeId::TINYINT:
-		InitializeFunctionPointers<ArrowScalarData<int8_t>>(append_data);
+		InitializeFunctionPointers<ArrowFixedSizeData<int8_t>>(append_data);
 		break;
 	case LogicalTypeId::SMALLINT:
-		InitializeFunctionPointers<ArrowScalarData<int16_t>>(append_data);
+		InitializeFunctionPointers<ArrowFixedSizeData<int16_t>>(append_data);
 		break;
 	case LogicalTypeId::DATE:
 	case LogicalTypeId::INTEGER:
-		InitializeFunctionPointers<ArrowScalarData<int32_t>>(append_data);
+		InitializeFunctionPointers<ArrowFixedSizeData<int32_t>>(append_data);
 		break;
 	case LogicalTypeId::TIME:
 	case LogicalTypeId::TIMESTAMP_SEC:
@@ -576,28 +625,28 @@ static void InitializeFunctionPointers(ArrowAppendData &append_data, const Logic
 	case LogicalTypeId::TIMESTAMP_TZ:
 	case LogicalTypeId::TIME_TZ:
 	case LogicalTypeId::BIGINT:
-		InitializeFunctionPointers<ArrowScalarData<int64_t>>(append_data);
+		InitializeFunctionPointers<ArrowFixedSizeData<int64_t>>(append_data);
 		break;
 	case LogicalTypeId::HUGEINT:
-		InitializeFunctionPointers<ArrowScalarData<hugeint_t>>(append_data);
+		InitializeFunctionPointers<ArrowFixedSizeData<hugeint_t>>(append_data);
 		break;
 	case LogicalTypeId::UTINYINT:
-		InitializeFunctionPointers<ArrowScalarData<uint8_t>>(append_data);
+		InitializeFunctionPointers<ArrowFixedSizeData<uint8_t>>(append_data);
 		break;
 	case LogicalTypeId::USMALLINT:
-		InitializeFunctionPointers<ArrowScalarData<uint16_t>>(append_data);
+		InitializeFunctionPointers<ArrowFixedSizeData<uint16_t>>(append_data);
 		break;
 	case LogicalTypeId::UINTEGER:
-		InitializeFunctionPointers<ArrowScalarData<uint32_t>>(append_data);
+		InitializeFunctionPointers<ArrowFixedSizeData<uint32_t>>(append_data);
 		break;
 	case LogicalTypeId::UBIGINT:
-		InitializeFunctionPointers<ArrowScalarData<uint64_t>>(append_data);
+		InitializeFunctionPointers<ArrowFixedSizeData<uint64_t>>(append_data);
 		break;
 	case LogicalTypeId::FLOAT:
-		InitializeFunctionPointers<ArrowScalarData<float>>(append_data);
+		InitializeFunctionPointers<ArrowFixedSizeData<float>>(append_data);
 		break;
 	case LogicalTypeId::DOUBLE:
-		InitializeFunctionPointers<ArrowScalarData<double>>(append_data);
+		InitializeFunctionPointers<ArrowFixedSizeData<double>>(append_data);
 		break;
 	case LogicalTypeId::DECIMAL:
 		switch (type.InternalType()) {
@@ -611,7 +660,7 @@ static void InitializeFunctionPointers(ArrowAppendData &append_data, const Logic
 			InitializeFunctionPointers<ArrowScalarData<hugeint_t, int64_t>>(append_data);
 			break;
 		case PhysicalType::INT128:
-			InitializeFunctionPointers<ArrowScalarData<hugeint_t>>(append_data);
+			InitializeFunctionPointers<ArrowFixedSizeData<hugeint_t>>(append_data);
 			break;
 		default:
 			throw InternalException("Unsupported internal decimal type");
@@ -4,6 +4,7 @@
 #include "duckdb/common/assert.hpp"
 #include "duckdb/common/exception.hpp"
 
+#include "duckdb/main/arrow_query_result.hpp"
 #include "duckdb/main/stream_query_result.hpp"
 
 #include "duckdb/common/arrow/result_arrow_wrapper.hpp"
@@ -186,6 +187,16 @@ bool ArrowUtil::TryFetchNext(QueryResult &result, unique_ptr<DataChunk> &chunk,
 bool ArrowUtil::TryFetchChunk(QueryResult *result, idx_t chunk_size, ArrowArray *out, idx_t &count,
                               PreservedError &error) {
 	count = 0;
+	if (result->type == QueryResultType::ARROW_RESULT) {
+		// the result was already converted to Arrow while executing the query
+		auto &arrow_result = (ArrowQueryResult &)*result;
+		if (arrow_result.HasError()) {
+			error = arrow_result.GetErrorObject();
+			return false;
+		}
+		count = arrow_result.FetchArray(out);
+		return true;
+	}
 	ArrowAppender appender(result->types, chunk_size);
 	while (count < chunk_size) {
 		unique_ptr<DataChunk> data_chunk;
@@ -10,9 +10,18 @@ hash_t Checksum(uint64_t x) {
 uint64_t Checksum(uint8_t *buffer, size_t size) {
 	uint64_t result = 5381;
 	uint64_t *ptr = (uint64_t *)buffer;
-	size_t i;
+	size_t i = 0;
 	// for efficiency, we first checksum uint64_t values
-	for (i = 0; i < size / 8; i++) {
+	// these are combined with XOR, so we can compute them in independent lanes without changing the checksum
+	uint64_t lanes[4] = {0, 0, 0, 0};
+	for (; i + 4 <= size / 8; i += 4) {
+		lanes[0] ^= Checksum(ptr[i]);
+		lanes[1] ^= Checksum(ptr[i + 1]);
+		lanes[2] ^= Checksum(ptr[i + 2]);
+		lanes[3] ^= Checksum(ptr[i + 3]);
+	}
+	result ^= lanes[0] ^ lanes[1] ^ lanes[2] ^ lanes[3];
+	for (; i < size / 8; i++) {
 		result ^= Checksum(ptr[i]);
 	}
 	if (size - i * 8 > 0) {
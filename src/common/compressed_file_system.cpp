@@ -1,4 +1,6 @@
 #include "duckdb/common/compressed_file_system.hpp"
+#include "duckdb/common/preserved_error.hpp"
+#include "duckdb/parallel/task_counter.hpp"
 
 namespace duckdb {
 
@@ -129,4 +131,180 @@ bool CompressedFileSystem::CanSeek() {
 	return false;
 }
 
+bool CompressedFileSystem::FindBlocks(FileHandle &child_handle, vector<CompressedFileBlock> &blocks) {
+	return false;
+}
+
+void CompressedFileSystem::DecompressBlock(const_data_ptr_t compressed_data, const CompressedFileBlock &block,
+                                           data_ptr_t target) {
+	throw InternalException("Compressed file system does not support decompressing blocks");
+}
+
+struct CompressedBlockState {
+	explicit CompressedBlockState(TaskScheduler &scheduler) : counter(scheduler) {
+	}
+
+	TaskCounter counter;
+
+	mutex error_lock;
+	PreservedError error;
+
+public:
+	void PushError(PreservedError new_error) {
+		lock_guard<mutex> guard(error_lock);
+		if (!error) {
+			error = move(new_error);
+		}
+	}
+};
+
+//! Decompresses a group of consecutive blocks
+class CompressedBlockTask : public Task {
+public:
+	CompressedBlockTask(CompressedBlockState &state, CompressedBlockReader &reader, const_data_ptr_t compressed_data,
+	                    idx_t compressed_start, idx_t begin, idx_t end, data_ptr_t target)
+	    : state(state), reader(reader), compressed_data(compressed_data), compressed_start(compressed_start),
+	      begin(begin), end(end), target(target) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			reader.DecompressBlocks(compressed_data, compressed_start, begin, end, target);
+		} catch (Exception &ex) {
+			state.PushError(PreservedError(ex));
+		} catch (std::exception &ex) {
+			state.PushError(PreservedError(ex));
+		} catch (...) { // LCOV_EXCL_START
+			state.PushError(PreservedError("Unknown exception while decompressing blocks!"));
+		} // LCOV_EXCL_STOP
+		state.counter.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	CompressedBlockState &state;
+	CompressedBlockReader &reader;
+	const_data_ptr_t compressed_data;
+	idx_t compressed_start;
+	idx_t begin;
+	idx_t end;
+	data_ptr_t target;
+};
+
+CompressedBlockReader::CompressedBlockReader(TaskScheduler &scheduler, CompressedFile &file,
+                                             vector<CompressedFileBlock> blocks_p)
+    : scheduler(scheduler), file(file), blocks(move(blocks_p)), uncompressed_size(0), block_index(0),
+      partial_block_size(0), partial_block_position(0), compressed_buffer_capacity(0) {
+	idx_t max_block_size = 0;
+	for (auto &block : blocks) {
+		uncompressed_size += block.uncompressed_size;
+		max_block_size = MaxValue<idx_t>(max_block_size, block.uncompressed_size);
+	}
+	partial_block = unique_ptr<data_t[]>(new data_t[max_block_size]);
+}
+
+unique_ptr<CompressedBlockReader> CompressedBlockReader::TryCreate(TaskScheduler &scheduler, FileHandle &handle,
+                                                                   idx_t max_block_size) {
+	auto compressed_fs = dynamic_cast<CompressedFileSystem *>(&handle.file_system);
+	if (!compressed_fs) {
+		return nullptr;
+	}
+	auto &file = (CompressedFile &)handle;
+	if (file.write || !file.child_handle->CanSeek()) {
+		return nullptr;
+	}
+	vector<CompressedFileBlock> blocks;
+	if (!compressed_fs->FindBlocks(*file.child_handle, blocks) || blocks.size() < 2) {
+		// a single block can not be decompressed in parallel
+		return nullptr;
+	}
+	for (auto &block : blocks) {
+		if (block.uncompressed_size > max_block_size) {
+			return nullptr;
+		}
+	}
+	return make_unique<CompressedBlockReader>(scheduler, file, move(blocks));
+}
+
+idx_t CompressedBlockReader::Read(data_ptr_t buffer, idx_t nr_bytes) {
+	idx_t total_read = 0;
+	// first copy what is left of the partially read block
+	if (partial_block_position < partial_block_size) {
+		auto available = MinValue<idx_t>(nr_bytes, partial_block_size - partial_block_position);
+		memcpy(buffer, partial_block.get() + partial_block_position, available);
+		partial_block_position += available;
+		total_read += available;
+	}
+	// decompress all blocks that fit entirely directly into the buffer
+	idx_t end = block_index;
+	idx_t blocks_size = 0;
+	while (end < blocks.size() && total_read + blocks_size + blocks[end].uncompressed_size <= nr_bytes) {
+		blocks_size += blocks[end].uncompressed_size;
+		end++;
+	}
+	ReadBlocks(block_index, end, buffer + total_read);
+	block_index = end;
+	total_read += blocks_size;
+	// the next block only fits partially: decompress it separately
+	if (total_read < nr_bytes && block_index < blocks.size()) {
+		ReadBlocks(block_index, block_index + 1, partial_block.get());
+		partial_block_size = blocks[block_index].uncompressed_size;
+		block_index++;
+		partial_block_position = nr_bytes - total_read;
+		memcpy(buffer + total_read, partial_block.get(), partial_block_position);
+		total_read = nr_bytes;
+	}
+	return total_read;
+}
+
+void CompressedBlockReader::Reset() {
+	block_index = 0;
+	partial_block_size = 0;
+	partial_block_position = 0;
+}
+
+void CompressedBlockReader::ReadBlocks(idx_t begin, idx_t end, data_ptr_t target) {
+	if (begin == end) {
+		return;
+	}
+	// the blocks are stored consecutively: read their compressed data at once
+	auto compressed_start = blocks[begin].compressed_offset;
+	auto compressed_size = blocks[end - 1].compressed_offset + blocks[end - 1].compressed_size - compressed_start;
+	if (compressed_size > compressed_buffer_capacity) {
+		compressed_buffer_capacity = NextPowerOfTwo(compressed_size);
+		compressed_buffer = unique_ptr<data_t[]>(new data_t[compressed_buffer_capacity]);
+	}
+	file.child_handle->Read(compressed_buffer.get(), compressed_size, compressed_start);
+
+	// decompress groups of blocks in parallel
+	CompressedBlockState state(scheduler);
+	idx_t group_start = begin;
+	idx_t group_size = 0;
+	for (idx_t block_idx = begin; block_idx < end; block_idx++) {
+		group_size += blocks[block_idx].uncompressed_size;
+		if (group_size >= MINIMUM_TASK_SIZE || block_idx + 1 == end) {
+			auto task = make_unique<CompressedBlockTask>(state, *this, compressed_buffer.get(), compressed_start,
+			                                             group_start, block_idx + 1, target);
+			state.counter.AddTask(move(task));
+			target += group_size;
+			group_start = block_idx + 1;
+			group_size = 0;
+		}
+	}
+	state.counter.Finish();
+	if (state.error) {
+		state.error.Throw();
+	}
+}
+
+void CompressedBlockReader::DecompressBlocks(const_data_ptr_t compressed_data, idx_t compressed_start, idx_t begin,
+                                             idx_t end, data_ptr_t target) {
+	for (idx_t block_idx = begin; block_idx < end; block_idx++) {
+		auto &block = blocks[block_idx];
+		auto block_data = compressed_data + (block.compressed_offset - compressed_start);
+		file.compressed_fs.DecompressBlock(block_data, block, target);
+		target += block.uncompressed_size;
+	}
+}
+
 } // namespace duckdb
@@ -27,6 +27,17 @@ void FileBuffer::Init() {
 	malloced_size = 0;
 }
 
+FileBuffer::FileBuffer(Allocator &allocator, FileBufferType type, data_ptr_t internal_buffer_p,
+                       uint64_t internal_size_p)
+    : allocator(allocator), type(type) {
+	D_ASSERT(type != FileBufferType::TINY_BUFFER);
+	Init();
+	internal_buffer = internal_buffer_p;
+	internal_size = internal_size_p;
+	buffer = internal_buffer + Storage::BLOCK_HEADER_SIZE;
+	size = internal_size - Storage::BLOCK_HEADER_SIZE;
+}
+
 FileBuffer::FileBuffer(FileBuffer &source, FileBufferType type_p) : allocator(source.allocator), type(type_p) {
 	// take over the structures of the source buffer
 	buffer = source.buffer;
@@ -95,6 +106,10 @@ void FileBuffer::Read(FileHandle &handle, uint64_t location) {
 void FileBuffer::ReadAndChecksum(FileHandle &handle, uint64_t location) {
 	// read the buffer from disk
 	Read(handle, location);
+	VerifyChecksum();
+}
+
+void FileBuffer::VerifyChecksum() {
 	// compute the checksum
 	auto stored_checksum = Load<uint64_t>(internal_buffer);
 	uint64_t computed_checksum = Checksum(buffer, size);
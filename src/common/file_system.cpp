@@ -1,5 +1,6 @@
 #include "duckdb/common/file_system.hpp"
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_opener.hpp"
@@ -231,6 +232,12 @@ void FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t
 	throw NotImplementedException("%s: Write (with location) is not implemented!", GetName());
 }
 
+void FileSystem::ReadRanges(FileHandle &handle, const vector<FileReadRange> &ranges) {
+	for (auto &range : ranges) {
+		Read(handle, range.buffer, range.nr_bytes, range.location);
+	}
+}
+
 int64_t FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	throw NotImplementedException("%s: Read is not implemented!", GetName());
 }
@@ -291,6 +298,10 @@ void FileSystem::FileSync(FileHandle &handle) {
 	throw NotImplementedException("%s: FileSync is not implemented!", GetName());
 }
 
+void FileSystem::Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+	// read-ahead is only a hint: by default we do nothing
+}
+
 vector<string> FileSystem::Glob(const string &path, FileOpener *opener) {
 	throw NotImplementedException("%s: Glob is not implemented!", GetName());
 }
@@ -342,20 +353,48 @@ FileHandle::FileHandle(FileSystem &file_system, string path_p) : file_system(fil
 FileHandle::~FileHandle() {
 }
 
+static atomic<idx_t> total_bytes_read(0);
+static atomic<idx_t> total_bytes_written(0);
+
+idx_t FileSystem::GetTotalBytesRead() {
+	return total_bytes_read;
+}
+
+idx_t FileSystem::GetTotalBytesWritten() {
+	return total_bytes_written;
+}
+
 int64_t FileHandle::Read(void *buffer, idx_t nr_bytes) {
-	return file_system.Read(*this, buffer, nr_bytes);
+	auto bytes_read = file_system.Read(*this, buffer, nr_bytes);
+	if (bytes_read > 0) {
+		total_bytes_read += bytes_read;
+	}
+	return bytes_read;
 }
 
 int64_t FileHandle::Write(void *buffer, idx_t nr_bytes) {
-	return file_system.Write(*this, buffer, nr_bytes);
+	auto bytes_written = file_system.Write(*this, buffer, nr_bytes);
+	if (bytes_written > 0) {
+		total_bytes_written += bytes_written;
+	}
+	return bytes_written;
 }
 
 void FileHandle::Read(void *buffer, idx_t nr_bytes, idx_t location) {
 	file_system.Read(*this, buffer, nr_bytes, location);
+	total_bytes_read += nr_bytes;
+}
+
+void FileHandle::ReadRanges(const vector<FileReadRange> &ranges) {
+	file_system.ReadRanges(*this, ranges);
+	for (auto &range : ranges) {
+		total_bytes_read += range.nr_bytes;
+	}
 }
 
 void FileHandle::Write(void *buffer, idx_t nr_bytes, idx_t location) {
 	file_system.Write(*this, buffer, nr_bytes, location);
+	total_bytes_written += nr_bytes;
 }
 
 void FileHandle::Seek(idx_t location) {
@@ -400,6 +439,10 @@ void FileHandle::Sync() {
 	file_system.FileSync(*this);
 }
 
+void FileHandle::Prefetch(idx_t location, idx_t nr_bytes) {
+	file_system.Prefetch(*this, location, nr_bytes);
+}
+
 void FileHandle::Truncate(int64_t new_size) {
 	file_system.Truncate(*this, new_size);
 }
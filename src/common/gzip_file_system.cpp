@@ -6,6 +6,7 @@
 #include "miniz_wrapper.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/common/helper.hpp"
 
 namespace duckdb {
 
@@ -64,6 +65,23 @@ static idx_t GZipConsumeString(FileHandle &input) {
 	return size;
 }
 
+//! Skips the optional fields of the header of a gzip member, and seeks to the start of its compressed data
+static void GZipSkipHeaderFields(FileHandle &input, uint8_t gzip_hdr[], idx_t data_start) {
+	if (gzip_hdr[3] & GZIP_FLAG_EXTRA) {
+		uint8_t extra_length[2];
+		input.Seek(data_start);
+		if (input.Read(extra_length, 2) != 2) {
+			throw IOException("Input is not a GZIP stream");
+		}
+		data_start += 2 + Load<uint16_t>(extra_length);
+	}
+	if (gzip_hdr[3] & GZIP_FLAG_NAME) {
+		input.Seek(data_start);
+		data_start += GZipConsumeString(input);
+	}
+	input.Seek(data_start);
+}
+
 struct MiniZStreamWrapper : public StreamWrapper {
 	~MiniZStreamWrapper() override;
 
@@ -82,6 +100,8 @@ public:
 	void Close() override;
 
 	void FlushStream();
+	//! Starts decompressing the next member of the file, returns false if there are no more members
+	bool ReadNextMember(StreamData &stream_data);
 };
 
 MiniZStreamWrapper::~MiniZStreamWrapper() {
@@ -117,15 +137,9 @@ void MiniZStreamWrapper::Initialize(CompressedFile &file, bool write) {
 			throw InternalException("Failed to initialize miniz");
 		}
 	} else {
-		idx_t data_start = GZIP_HEADER_MINSIZE;
 		auto read_count = file.child_handle->Read(gzip_hdr, GZIP_HEADER_MINSIZE);
 		GZipFileSystem::VerifyGZIPHeader(gzip_hdr, read_count);
-
-		if (gzip_hdr[3] & GZIP_FLAG_NAME) {
-			file.child_handle->Seek(data_start);
-			data_start += GZipConsumeString(*file.child_handle);
-		}
-		file.child_handle->Seek(data_start);
+		GZipSkipHeaderFields(*file.child_handle, gzip_hdr, GZIP_HEADER_MINSIZE);
 		// stream is now set to beginning of payload data
 		auto ret = duckdb_miniz::mz_inflateInit2((duckdb_miniz::mz_streamp)mz_stream_ptr, -MZ_DEFAULT_WINDOW_BITS);
 		if (ret != duckdb_miniz::MZ_OK) {
@@ -150,14 +164,40 @@ bool MiniZStreamWrapper::Read(StreamData &sd) {
 	sd.in_buff_end = sd.in_buff_start + mz_stream_ptr->avail_in;
 	sd.out_buff_end = (data_ptr_t)mz_stream_ptr->next_out;
 	D_ASSERT(sd.out_buff_end + mz_stream_ptr->avail_out == sd.out_buff.get() + sd.out_buf_size);
-	// if stream ended, deallocate inflator
-	if (ret == duckdb_miniz::MZ_STREAM_END) {
+	// if stream ended, continue with the next member (if any) or deallocate inflator
+	if (ret == duckdb_miniz::MZ_STREAM_END && !ReadNextMember(sd)) {
 		Close();
 		return true;
 	}
 	return false;
 }
 
+bool MiniZStreamWrapper::ReadNextMember(StreamData &sd) {
+	// a gzip file can consist of multiple members (e.g. concatenated or blocked gzip files)
+	// the next member starts after the footer of the current member
+	auto &input = *file->child_handle;
+	idx_t member_start = input.SeekPosition() - (sd.in_buff_end - sd.in_buff_start) + MiniZStream::GZIP_FOOTER_SIZE;
+	input.Seek(member_start);
+	uint8_t gzip_hdr[GZIP_HEADER_MINSIZE];
+	auto read_count = input.Read(gzip_hdr, GZIP_HEADER_MINSIZE);
+	if (read_count < 2 || gzip_hdr[0] != 0x1F || gzip_hdr[1] != 0x8B) {
+		// no more members: any trailing data is ignored (like gzip does)
+		return false;
+	}
+	GZipFileSystem::VerifyGZIPHeader(gzip_hdr, read_count);
+	GZipSkipHeaderFields(input, gzip_hdr, member_start + GZIP_HEADER_MINSIZE);
+	sd.in_buff_start = sd.in_buff.get();
+	sd.in_buff_end = sd.in_buff.get();
+
+	duckdb_miniz::mz_inflateEnd(mz_stream_ptr);
+	memset(mz_stream_ptr, 0, sizeof(duckdb_miniz::mz_stream));
+	auto ret = duckdb_miniz::mz_inflateInit2((duckdb_miniz::mz_streamp)mz_stream_ptr, -MZ_DEFAULT_WINDOW_BITS);
+	if (ret != duckdb_miniz::MZ_OK) {
+		throw InternalException("Failed to initialize miniz");
+	}
+	return true;
+}
+
 void MiniZStreamWrapper::Write(CompressedFile &file, StreamData &sd, data_ptr_t uncompressed_data,
                                int64_t uncompressed_size) {
 	// update the src and the total size
@@ -281,6 +321,15 @@ string GZipFileSystem::UncompressGZIPString(const string &in) {
 	body_ptr += GZIP_HEADER_MINSIZE;
 	GZipFileSystem::VerifyGZIPHeader(gzip_hdr, GZIP_HEADER_MINSIZE);
 
+	if (gzip_hdr[3] & GZIP_FLAG_EXTRA) {
+		if ((idx_t)(body_ptr - in.data()) + 2 > in.size()) {
+			throw IOException("Input is not a GZIP stream");
+		}
+		body_ptr += 2 + Load<uint16_t>((const_data_ptr_t)body_ptr);
+		if ((idx_t)(body_ptr - in.data()) > in.size()) {
+			throw IOException("Input is not a GZIP stream");
+		}
+	}
 	if (gzip_hdr[3] & GZIP_FLAG_NAME) {
 		char c;
 		do {
@@ -335,4 +384,60 @@ idx_t GZipFileSystem::OutBufferSize() {
 	return BUFFER_SIZE;
 }
 
+bool GZipFileSystem::FindBlocks(FileHandle &child_handle, vector<CompressedFileBlock> &blocks) {
+	auto file_size = child_handle.GetFileSize();
+	idx_t position = 0;
+	while (position < file_size) {
+		if (position + BGZF_HEADER_SIZE + MiniZStream::GZIP_FOOTER_SIZE > file_size) {
+			return false;
+		}
+		// the header has a single "BC" extra field, that contains the size of the member minus one
+		uint8_t header[BGZF_HEADER_SIZE];
+		child_handle.Read(header, BGZF_HEADER_SIZE, position);
+		if (header[0] != 0x1F || header[1] != 0x8B || header[2] != GZIP_COMPRESSION_DEFLATE ||
+		    header[3] != GZIP_FLAG_EXTRA || Load<uint16_t>(header + 10) != 6 || header[12] != 'B' ||
+		    header[13] != 'C' || Load<uint16_t>(header + 14) != 2) {
+			return false;
+		}
+		CompressedFileBlock block;
+		block.compressed_offset = position;
+		block.compressed_size = idx_t(Load<uint16_t>(header + 16)) + 1;
+		if (block.compressed_size < BGZF_HEADER_SIZE + MiniZStream::GZIP_FOOTER_SIZE ||
+		    position + block.compressed_size > file_size) {
+			return false;
+		}
+		// the footer ends with the uncompressed size of the member
+		uint8_t uncompressed_size[sizeof(uint32_t)];
+		child_handle.Read(uncompressed_size, sizeof(uint32_t), position + block.compressed_size - sizeof(uint32_t));
+		block.uncompressed_size = Load<uint32_t>(uncompressed_size);
+		if (block.uncompressed_size > 0) {
+			// skip empty members, such as the end-of-file marker
+			blocks.push_back(block);
+		}
+		position += block.compressed_size;
+	}
+	return true;
+}
+
+void GZipFileSystem::DecompressBlock(const_data_ptr_t compressed_data, const CompressedFileBlock &block,
+                                     data_ptr_t target) {
+	duckdb_miniz::mz_stream stream;
+	memset(&stream, 0, sizeof(duckdb_miniz::mz_stream));
+	auto ret = duckdb_miniz::mz_inflateInit2(&stream, -MZ_DEFAULT_WINDOW_BITS);
+	if (ret != duckdb_miniz::MZ_OK) {
+		throw InternalException("Failed to initialize miniz");
+	}
+	stream.next_in = compressed_data + BGZF_HEADER_SIZE;
+	stream.avail_in = block.compressed_size - BGZF_HEADER_SIZE - MiniZStream::GZIP_FOOTER_SIZE;
+	stream.next_out = target;
+	stream.avail_out = block.uncompressed_size;
+	ret = duckdb_miniz::mz_inflate(&stream, duckdb_miniz::MZ_FINISH);
+	auto decompressed_size = stream.total_out;
+	duckdb_miniz::mz_inflateEnd(&stream);
+	if (ret != duckdb_miniz::MZ_STREAM_END || decompressed_size != block.uncompressed_size) {
+		throw IOException("Failed to decode gzip block at position %llu: %s", block.compressed_offset,
+		                  duckdb_miniz::mz_error(ret));
+	}
+}
+
 } // namespace duckdb
@@ -0,0 +1,101 @@
+#include "duckdb/common/hardware_counters.hpp"
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#define DUCKDB_PERF_EVENT
+#endif
+
+namespace duckdb {
+
+#ifdef DUCKDB_PERF_EVENT
+static int OpenCounter(uint64_t config, int group_fd) {
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = config;
+	// the group is enabled at once through its leader
+	attr.disabled = group_fd == -1 ? 1 : 0;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP;
+	// measure the calling thread on any cpu
+	return syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+#endif
+
+HardwareCounters::HardwareCounters() : leader(-1) {
+	for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+		fds[i] = -1;
+		positions[i] = DConstants::INVALID_INDEX;
+	}
+#ifdef DUCKDB_PERF_EVENT
+	const uint64_t configs[COUNTER_COUNT] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+	                                         PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+	idx_t position = 0;
+	for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+		// counters that are not supported by the cpu (or the hypervisor) are skipped
+		fds[i] = OpenCounter(configs[i], leader);
+		if (fds[i] < 0) {
+			fds[i] = -1;
+			continue;
+		}
+		if (leader == -1) {
+			leader = fds[i];
+		}
+		positions[i] = position++;
+	}
+	if (leader != -1) {
+		ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+#endif
+}
+
+HardwareCounters::~HardwareCounters() {
+#ifdef DUCKDB_PERF_EVENT
+	for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+		if (fds[i] != -1) {
+			close(fds[i]);
+		}
+	}
+#endif
+}
+
+HardwareCounters &HardwareCounters::Get() {
+	static thread_local HardwareCounters counters;
+	return counters;
+}
+
+bool HardwareCounters::IsAvailable() const {
+	return leader != -1;
+}
+
+HardwareCounterValues HardwareCounters::Read() const {
+	HardwareCounterValues result;
+#ifdef DUCKDB_PERF_EVENT
+	if (leader == -1) {
+		return result;
+	}
+	// a group read returns the number of counters followed by their values
+	uint64_t buffer[1 + COUNTER_COUNT];
+	auto bytes = read(leader, buffer, sizeof(buffer));
+	if (bytes < ssize_t(sizeof(uint64_t))) {
+		return result;
+	}
+	uint64_t *values[COUNTER_COUNT] = {&result.cycles, &result.instructions, &result.cache_misses,
+	                                   &result.branch_misses};
+	for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+		if (positions[i] != DConstants::INVALID_INDEX && positions[i] < buffer[0]) {
+			*values[i] = buffer[1 + positions[i]];
+		}
+	}
+#endif
+	return result;
+}
+
+} // namespace duckdb
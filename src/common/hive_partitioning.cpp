@@ -94,6 +94,8 @@ void HivePartitioning::ApplyFiltersToFileList(ClientContext &context, vector<str
 	if ((!filename_enabled && !hive_enabled) || filters.empty()) {
 		return;
 	}
+	// whether a filter has to be kept because it could not be evaluated for one of the files
+	vector<bool> keep_filter(filters.size(), false);
 
 	for (idx_t i = 0; i < files.size(); i++) {
 		auto &file = files[i];
@@ -101,7 +103,8 @@ void HivePartitioning::ApplyFiltersToFileList(ClientContext &context, vector<str
 		auto known_values = GetKnownColumnValues(file, column_map, regex, filename_enabled, hive_enabled);
 
 		FilterCombiner combiner(context);
-		for (auto &filter : filters) {
+		for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+			auto &filter = filters[filter_idx];
 			unique_ptr<Expression> filter_copy = filter->Copy();
 			ConvertKnownColRefToConstants(filter_copy, known_values, table_index);
 			// Evaluate the filter, if it can be evaluated here, we can not prune this filter
@@ -109,8 +112,8 @@ void HivePartitioning::ApplyFiltersToFileList(ClientContext &context, vector<str
 			if (!filter_copy->IsScalar() || !filter_copy->IsFoldable() ||
 			    !ExpressionExecutor::TryEvaluateScalar(context, *filter_copy, result_value)) {
 				// can not be evaluated only with the filename/hive columns added, we can not prune this filter
-				pruned_filters.emplace_back(filter->Copy());
-			} else if (!result_value.GetValue<bool>()) {
+				keep_filter[filter_idx] = true;
+			} else if (result_value.IsNull() || !result_value.GetValue<bool>()) {
 				// filter evaluates to false
 				should_prune_file = true;
 			}
@@ -126,8 +129,88 @@ void HivePartitioning::ApplyFiltersToFileList(ClientContext &context, vector<str
 		}
 	}
 
+	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+		if (keep_filter[filter_idx]) {
+			pruned_filters.push_back(move(filters[filter_idx]));
+		}
+	}
 	filters = std::move(pruned_filters);
 	files = std::move(pruned_files);
 }
 
+HivePartitionedColumnData::HivePartitionedColumnData(ClientContext &context, vector<LogicalType> types,
+                                                     vector<idx_t> partition_columns_p)
+    : PartitionedColumnData(PartitionedColumnDataType::HIVE, context, move(types)),
+      partition_columns(move(partition_columns_p)) {
+}
+
+HivePartitionedColumnData::~HivePartitionedColumnData() {
+}
+
+const vector<Value> &HivePartitionedColumnData::GetPartitionKey(idx_t partition_index) const {
+	D_ASSERT(partition_index < partition_keys.size());
+	return partition_keys[partition_index];
+}
+
+unique_ptr<ColumnDataCollection> HivePartitionedColumnData::TakePartition(PartitionedColumnDataAppendState &state,
+                                                                          idx_t partition_index) {
+	auto result = move(partitions[partition_index]);
+	partitions[partition_index] = CreatePartitionCollection(partition_index);
+	partitions[partition_index]->InitializeAppend(*state.partition_append_states[partition_index]);
+	return result;
+}
+
+idx_t HivePartitionedColumnData::GetPartitionIndex(PartitionedColumnDataAppendState &state, vector<Value> key) {
+	// NULL values are prefixed differently, so they can not collide with the string "NULL"
+	string key_string;
+	for (auto &value : key) {
+		key_string += value.IsNull() ? "N" : "V" + value.ToString();
+		key_string += '\0';
+	}
+	auto entry = partition_map.find(key_string);
+	if (entry != partition_map.end()) {
+		return entry->second;
+	}
+	// a new partition: create its collection and the buffers to append to it
+	auto partition_index = partitions.size();
+	CreateAllocator();
+	partitions.push_back(CreatePartitionCollection(partition_index));
+	state.partition_append_states.push_back(make_unique<ColumnDataAppendState>());
+	partitions.back()->InitializeAppend(*state.partition_append_states.back());
+	state.partition_buffers.push_back(CreatePartitionBuffer());
+	partition_keys.push_back(move(key));
+	partition_map[key_string] = partition_index;
+	return partition_index;
+}
+
+void HivePartitionedColumnData::ComputePartitionIndices(PartitionedColumnDataAppendState &state, DataChunk &input) {
+	auto count = input.size();
+	bool all_constant = true;
+	for (auto &col_idx : partition_columns) {
+		if (input.data[col_idx].GetVectorType() != VectorType::CONSTANT_VECTOR) {
+			all_constant = false;
+			break;
+		}
+	}
+	if (all_constant) {
+		// all rows belong to the same partition
+		vector<Value> key;
+		for (auto &col_idx : partition_columns) {
+			key.push_back(input.data[col_idx].GetValue(0));
+		}
+		state.partition_indices.SetVectorType(VectorType::CONSTANT_VECTOR);
+		ConstantVector::GetData<idx_t>(state.partition_indices)[0] = GetPartitionIndex(state, move(key));
+		return;
+	}
+	state.partition_indices.SetVectorType(VectorType::FLAT_VECTOR);
+	auto partition_indices = FlatVector::GetData<idx_t>(state.partition_indices);
+	for (idx_t i = 0; i < count; i++) {
+		vector<Value> key;
+		for (auto &col_idx : partition_columns) {
+			key.push_back(input.data[col_idx].GetValue(i));
+		}
+		partition_indices[i] = GetPartitionIndex(state, move(key));
+	}
+}
+
 } // namespace duckdb
@@ -448,6 +448,14 @@ void LocalFileSystem::FileSync(FileHandle &handle) {
 	}
 }
 
+void LocalFileSystem::Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+#if defined(POSIX_FADV_WILLNEED)
+	int fd = ((UnixFileHandle &)handle).fd;
+	// this only schedules the read, failures are not an error: the data is read synchronously later on
+	posix_fadvise(fd, location, nr_bytes, POSIX_FADV_WILLNEED);
+#endif
+}
+
 void LocalFileSystem::MoveFile(const string &source, const string &target) {
 	//! FIXME: rename does not guarantee atomicity or overwriting target file if it exists
 	if (rename(source.c_str(), target.c_str()) != 0) {
@@ -769,6 +777,10 @@ void LocalFileSystem::FileSync(FileHandle &handle) {
 	}
 }
 
+void LocalFileSystem::Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+	// no read-ahead hints on Windows
+}
+
 void LocalFileSystem::MoveFile(const string &source, const string &target) {
 	auto source_unicode = WindowsUtil::UTF8ToUnicode(source.c_str());
 	auto target_unicode = WindowsUtil::UTF8ToUnicode(target.c_str());
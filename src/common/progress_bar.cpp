@@ -16,23 +16,21 @@ double ProgressBar::GetCurrentPercentage() {
 void ProgressBar::Start() {
 	profiler.Start();
 	current_percentage = 0;
-	supported = true;
+	rows_processed = 0;
+	total_rows_to_process = 0;
 }
 
 void ProgressBar::Update(bool final) {
-	if (!supported) {
-		return;
-	}
-	double new_percentage;
-	supported = executor.GetPipelinesProgress(new_percentage);
-	if (!supported) {
-		return;
+	double new_percentage = executor.GetPipelinesProgress(rows_processed, total_rows_to_process);
+	if (final) {
+		new_percentage = 100;
 	}
 	auto sufficient_time_elapsed = profiler.Elapsed() > show_progress_after / 1000.0;
+	// the reported progress never decreases, even if the estimated cardinalities turn out to be too low
 	if (new_percentage > current_percentage) {
 		current_percentage = new_percentage;
 	}
-	if (supported && print_progress && sufficient_time_elapsed && current_percentage > -1 && print_progress) {
+	if (print_progress && sufficient_time_elapsed && current_percentage > -1) {
 #ifndef DUCKDB_DISABLE_PRINT
 		if (final) {
 			FinishProgressBarPrint();
@@ -50,8 +50,14 @@ void RowOperations::DestroyStates(RowLayout &layout, Vector &addresses, idx_t co
 void RowOperations::UpdateStates(AggregateObject &aggr, Vector &addresses, DataChunk &payload, idx_t arg_idx,
                                  idx_t count) {
 	AggregateInputData aggr_input_data(aggr.bind_data, Allocator::DefaultAllocator());
-	aggr.function.update(aggr.child_count == 0 ? nullptr : &payload.data[arg_idx], aggr_input_data, aggr.child_count,
-	                     addresses, count);
+	auto inputs = aggr.child_count == 0 ? nullptr : &payload.data[arg_idx];
+	if (addresses.GetVectorType() == VectorType::CONSTANT_VECTOR && aggr.function.simple_update) {
+		// all rows update the same state: use the (faster) ungrouped update
+		auto state = ConstantVector::GetData<data_ptr_t>(addresses)[0];
+		aggr.function.simple_update(inputs, aggr_input_data, aggr.child_count, state, count);
+		return;
+	}
+	aggr.function.update(inputs, aggr_input_data, aggr.child_count, addresses, count);
 }
 
 void RowOperations::UpdateFilteredStates(AggregateFilterData &filter_data, AggregateObject &aggr, Vector &addresses,
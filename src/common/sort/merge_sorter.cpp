@@ -1,6 +1,7 @@
 #include "duckdb/common/fast_mem.hpp"
 #include "duckdb/common/sort/comparators.hpp"
 #include "duckdb/common/sort/sort.hpp"
+#include "duckdb/main/client_context.hpp"
 
 namespace duckdb {
 
@@ -9,16 +10,27 @@ MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
 }
 
 void MergeSorter::PerformInMergeRound() {
-	while (true) {
-		{
-			lock_guard<mutex> pair_guard(state.lock);
-			if (state.pair_idx == state.num_pairs) {
-				break;
-			}
-			GetNextPartition();
-		}
+	while (NextPartition()) {
+		MergePartition();
+	}
+}
+
+void MergeSorter::PerformInMergeRound(ClientContext &context) {
+	while (NextPartition()) {
 		MergePartition();
+		if (context.interrupted) {
+			throw InterruptException();
+		}
+	}
+}
+
+bool MergeSorter::NextPartition() {
+	lock_guard<mutex> pair_guard(state.lock);
+	if (state.pair_idx == state.num_pairs) {
+		return false;
 	}
+	GetNextPartition();
+	return true;
 }
 
 void MergeSorter::MergePartition() {
@@ -276,7 +276,22 @@ static void SubSortTiedTuples(BufferManager &buffer_manager, const data_ptr_t da
 	}
 }
 
-void LocalSortState::SortInMemory() {
+//! Checks whether the rows are in order already
+static bool IsSorted(const data_ptr_t dataptr, const idx_t &count, const SortLayout &sort_layout) {
+	data_ptr_t prev_ptr = dataptr;
+	for (idx_t i = 1; i < count; i++) {
+		const data_ptr_t curr_ptr = prev_ptr + sort_layout.entry_size;
+		const auto cmp = FastMemcmp(prev_ptr, curr_ptr, sort_layout.comparison_size);
+		if (cmp > 0 || (cmp == 0 && !sort_layout.all_constant)) {
+			// Out of order, or tied on the prefix of a variable-size column
+			return false;
+		}
+		prev_ptr = curr_ptr;
+	}
+	return true;
+}
+
+bool LocalSortState::SortInMemory() {
 	auto &sb = *sorted_blocks.back();
 	auto &block = *sb.radix_sorting_data.back();
 	const auto &count = block.count;
@@ -288,6 +303,10 @@ void LocalSortState::SortInMemory() {
 		Store<uint32_t>(i, idx_dataptr);
 		idx_dataptr += sort_layout->entry_size;
 	}
+	// Data that is appended in order (e.g., timestamps) is often sunk in order
+	if (IsSorted(dataptr, count, *sort_layout)) {
+		return false;
+	}
 	// Radix sort and break ties until no more ties, or until all columns are sorted
 	idx_t sorting_size = 0;
 	idx_t col_offset = 0;
@@ -339,6 +358,7 @@ void LocalSortState::SortInMemory() {
 		col_offset += sorting_size;
 		sorting_size = 0;
 	}
+	return true;
 }
 
 } // namespace duckdb
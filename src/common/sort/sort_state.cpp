@@ -1,3 +1,4 @@
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/fast_mem.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
@@ -37,6 +38,16 @@ idx_t GetNestedSortingColSize(idx_t &col_size, const LogicalType &type) {
 	}
 }
 
+//! The number of leading bytes that all strings have in common, according to their min/max statistics
+static idx_t CommonPrefixLength(const StringStatistics &str_stats) {
+	idx_t length = 0;
+	while (length < StringStatistics::MAX_STRING_MINMAX_SIZE && length < str_stats.max_string_length &&
+	       str_stats.min[length] != '\0' && str_stats.min[length] == str_stats.max[length]) {
+		length++;
+	}
+	return length;
+}
+
 SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
     : column_count(orders.size()), all_constant(true), comparison_size(0), entry_size(0) {
 	vector<LogicalType> blob_layout_types;
@@ -68,13 +79,15 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			if (stats.back()) {
 				auto &str_stats = (StringStatistics &)*stats.back();
 				col_size += str_stats.max_string_length;
-				if (col_size > 12) {
-					col_size = 12;
+				if (col_size > SortConstants::MAX_CONSTANT_STRING_SIZE) {
+					// The bytes that all strings have in common (e.g., "https://") do not help to order them,
+					// so we extend the prefix by their length
+					col_size = SortConstants::STRING_PREFIX_SIZE + CommonPrefixLength(str_stats);
 				} else {
 					constant_size.back() = true;
 				}
 			} else {
-				col_size = 12;
+				col_size = SortConstants::STRING_PREFIX_SIZE;
 			}
 			prefix_lengths.back() = col_size - size_before;
 		} else {
@@ -245,7 +258,10 @@ void LocalSortState::Sort(GlobalSortState &global_sort_state, bool reorder_heap)
 	auto payload_block = ConcatenateBlocks(*payload_data);
 	sb.payload_data->data_blocks.push_back(move(payload_block));
 	// Now perform the actual sort
-	SortInMemory();
+	if (!SortInMemory() && !reorder_heap) {
+		// The data was sunk in order, so there is nothing to re-order
+		return;
+	}
 	// Re-order before the merge sort
 	ReOrder(global_sort_state, reorder_heap);
 }
@@ -353,7 +369,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), memory_limit(buffer_manager.GetMaxMemory()) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -391,7 +407,7 @@ void GlobalSortState::PrepareMergePhase() {
 	idx_t total_heap_size =
 	    std::accumulate(sorted_blocks.begin(), sorted_blocks.end(), (idx_t)0,
 	                    [](idx_t a, const unique_ptr<SortedBlock> &b) { return a + b->HeapSize(); });
-	if (external || (pinned_blocks.empty() && total_heap_size > 0.25 * buffer_manager.GetMaxMemory())) {
+	if (external || (pinned_blocks.empty() && total_heap_size > 0.25 * memory_limit)) {
 		external = true;
 	}
 	// Use the data that we have to determine which partition size to use during the merge
@@ -416,7 +432,48 @@ void GlobalSortState::PrepareMergePhase() {
 			sb->blob_sorting_data->Unswizzle();
 			sb->payload_data->Unswizzle();
 		}
+		ConcatenateDisjointBlocks();
+	}
+}
+
+void GlobalSortState::ConcatenateDisjointBlocks() {
+	if (sorted_blocks.size() < 2) {
+		return;
+	}
+	// Collect the first and the last sorting key of every block
+	const auto &comparison_size = sort_layout.comparison_size;
+	const auto &entry_size = sort_layout.entry_size;
+	vector<BufferHandle> handles;
+	vector<pair<data_ptr_t, data_ptr_t>> bounds;
+	for (auto &sb : sorted_blocks) {
+		handles.push_back(buffer_manager.Pin(sb->radix_sorting_data.front()->block));
+		auto first = handles.back().Ptr();
+		auto &last_block = *sb->radix_sorting_data.back();
+		handles.push_back(buffer_manager.Pin(last_block.block));
+		auto last = handles.back().Ptr() + (last_block.count - 1) * entry_size;
+		bounds.emplace_back(first, last);
+	}
+	// Order the blocks by their first key, and check that every block ends before the next one starts
+	vector<idx_t> order(sorted_blocks.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(), [&](const idx_t &l, const idx_t &r) {
+		return FastMemcmp(bounds[l].first, bounds[r].first, comparison_size) < 0;
+	});
+	for (idx_t i = 1; i < order.size(); i++) {
+		auto cmp = FastMemcmp(bounds[order[i - 1]].second, bounds[order[i]].first, comparison_size);
+		if (cmp > 0 || (cmp == 0 && !sort_layout.all_constant)) {
+			// The blocks overlap, or they might (ties on the prefix of a variable-size column)
+			return;
+		}
+	}
+	handles.clear();
+	vector<unique_ptr<SortedBlock>> ordered_blocks;
+	for (auto &block_idx : order) {
+		ordered_blocks.push_back(move(sorted_blocks[block_idx]));
 	}
+	sorted_blocks.clear();
+	sorted_blocks.push_back(make_unique<SortedBlock>(buffer_manager, *this));
+	sorted_blocks.back()->AppendSortedBlocks(ordered_blocks);
 }
 
 void GlobalSortState::InitializeMergeRound() {
@@ -217,12 +217,23 @@ SBScanState::SBScanState(BufferManager &buffer_manager, GlobalSortState &state)
     : buffer_manager(buffer_manager), sort_layout(state.sort_layout), state(state), block_idx(0), entry_idx(0) {
 }
 
+//! Blocks are scanned in order, so when we pin a block of a spilled run we start reading the next one
+static void PrefetchNextBlock(BufferManager &buffer_manager, vector<unique_ptr<RowDataBlock>> &blocks,
+                              idx_t block_idx) {
+	if (block_idx + 1 < blocks.size()) {
+		buffer_manager.Prefetch(blocks[block_idx + 1]->block);
+	}
+}
+
 void SBScanState::PinRadix(idx_t block_idx_to) {
 	auto &radix_sorting_data = sb->radix_sorting_data;
 	D_ASSERT(block_idx_to < radix_sorting_data.size());
 	auto &block = radix_sorting_data[block_idx_to];
 	if (!radix_handle.IsValid() || radix_handle.GetBlockHandle() != block->block) {
 		radix_handle = buffer_manager.Pin(block->block);
+		if (state.external) {
+			PrefetchNextBlock(buffer_manager, radix_sorting_data, block_idx_to);
+		}
 	}
 }
 
@@ -234,6 +245,9 @@ void SBScanState::PinData(SortedData &sd) {
 	auto &data_block = sd.data_blocks[block_idx];
 	if (!data_handle.IsValid() || data_handle.GetBlockHandle() != data_block->block) {
 		data_handle = buffer_manager.Pin(data_block->block);
+		if (state.external) {
+			PrefetchNextBlock(buffer_manager, sd.data_blocks, block_idx);
+		}
 	}
 	if (sd.layout.AllConstant() || !state.external) {
 		return;
@@ -241,6 +255,7 @@ void SBScanState::PinData(SortedData &sd) {
 	auto &heap_block = sd.heap_blocks[block_idx];
 	if (!heap_handle.IsValid() || heap_handle.GetBlockHandle() != heap_block->block) {
 		heap_handle = buffer_manager.Pin(heap_block->block);
+		PrefetchNextBlock(buffer_manager, sd.heap_blocks, block_idx);
 	}
 }
 
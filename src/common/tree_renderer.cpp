@@ -494,6 +494,24 @@ unique_ptr<RenderTreeNode> TreeRenderer::CreateNode(const QueryProfiler::TreeNod
 	result->extra_text += "\n" + to_string(op.info.elements);
 	string timing = StringUtil::Format("%.2f", op.info.time);
 	result->extra_text += "\n(" + timing + "s)";
+	if (op.info.counters.HasValues()) {
+		auto &counters = op.info.counters;
+		result->extra_text += "\n[INFOSEPARATOR]";
+		result->extra_text += "\ncycles: " + to_string(counters.cycles);
+		result->extra_text += "\ninstructions: " + to_string(counters.instructions);
+		result->extra_text += "\ncache_misses: " + to_string(counters.cache_misses);
+		result->extra_text += "\nbranch_misses: " + to_string(counters.branch_misses);
+	}
+	if (op.info.memory.HasValues()) {
+		auto &memory = op.info.memory;
+		result->extra_text += "\n[INFOSEPARATOR]";
+		result->extra_text += "\npeak memory: " + StringUtil::BytesToHumanReadableString(memory.peak_memory);
+		result->extra_text += "\nallocated: " + StringUtil::BytesToHumanReadableString(memory.allocated_bytes);
+		if (memory.spilled_bytes > 0 || memory.read_bytes > 0) {
+			result->extra_text += "\nspilled: " + StringUtil::BytesToHumanReadableString(memory.spilled_bytes);
+			result->extra_text += "\nread back: " + StringUtil::BytesToHumanReadableString(memory.read_bytes);
+		}
+	}
 	if (config.detailed) {
 		for (auto &info : op.info.executors_info) {
 			if (!info) {
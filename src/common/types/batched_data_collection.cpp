@@ -7,6 +7,17 @@ namespace duckdb {
 BatchedDataCollection::BatchedDataCollection(vector<LogicalType> types_p) : types(move(types_p)) {
 }
 
+BatchedDataCollection::BatchedDataCollection(ClientContext &context_p, vector<LogicalType> types_p)
+    : context(&context_p), types(move(types_p)) {
+}
+
+unique_ptr<ColumnDataCollection> BatchedDataCollection::CreateCollection() {
+	if (context) {
+		return ColumnDataCollection::CreateMaterializedCollection(*context, types);
+	}
+	return make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), types);
+}
+
 void BatchedDataCollection::Append(DataChunk &input, idx_t batch_index) {
 	D_ASSERT(batch_index != DConstants::INVALID_INDEX);
 	ColumnDataCollection *collection;
@@ -20,7 +31,7 @@ void BatchedDataCollection::Append(DataChunk &input, idx_t batch_index) {
 		if (last_collection.collection) {
 			new_collection = make_unique<ColumnDataCollection>(*last_collection.collection);
 		} else {
-			new_collection = make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), types);
+			new_collection = CreateCollection();
 		}
 		last_collection.collection = new_collection.get();
 		last_collection.batch_index = batch_index;
@@ -81,7 +92,7 @@ unique_ptr<ColumnDataCollection> BatchedDataCollection::FetchCollection() {
 	data.clear();
 	if (!result) {
 		// empty result
-		return make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), types);
+		return CreateCollection();
 	}
 	return result;
 }
@@ -14,6 +14,11 @@ ColumnDataAllocator::ColumnDataAllocator(BufferManager &buffer_manager)
 	alloc.buffer_manager = &buffer_manager;
 }
 
+ColumnDataAllocator::ColumnDataAllocator(shared_ptr<DatabaseInstance> database_p)
+    : database(move(database_p)), type(ColumnDataAllocatorType::BUFFER_MANAGER_ALLOCATOR) {
+	alloc.buffer_manager = &BufferManager::GetBufferManager(*database);
+}
+
 ColumnDataAllocator::ColumnDataAllocator(ClientContext &context, ColumnDataAllocatorType allocator_type)
     : type(allocator_type) {
 	switch (type) {
@@ -154,6 +159,23 @@ data_ptr_t ColumnDataAllocator::GetDataPointer(ChunkManagementState &state, uint
 	return state.handles[block_id].Ptr() + offset;
 }
 
+idx_t ColumnDataAllocator::SizeInBytes() const {
+	idx_t result = 0;
+	for (auto &block : blocks) {
+		result += block.capacity;
+	}
+	return result;
+}
+
+bool ColumnDataAllocator::CanKeepAlive() const {
+	if (type == ColumnDataAllocatorType::IN_MEMORY_ALLOCATOR) {
+		// the memory is freed through the allocator, which must not be destroyed with the database
+		return alloc.allocator == &Allocator::DefaultAllocator();
+	}
+	// pinned blocks can only be released while the buffer manager exists
+	return database != nullptr;
+}
+
 void ColumnDataAllocator::DeleteBlock(uint32_t block_id) {
 	blocks[block_id].handle->SetCanDestroy(true);
 }
@@ -173,7 +195,7 @@ void ColumnDataAllocator::InitializeChunkState(ChunkManagementState &state, Chun
 	do {
 		found_handle = false;
 		for (auto it = state.handles.begin(); it != state.handles.end(); it++) {
-			if (chunk.block_ids.find(it->first) != chunk.block_ids.end()) {
+			if (chunk.HasBlock(it->first)) {
 				// still required: do not release
 				continue;
 			}
@@ -3,7 +3,9 @@
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/column_data_collection_segment.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/main/client_context.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
@@ -77,6 +79,18 @@ ColumnDataCollection::ColumnDataCollection(ColumnDataCollection &other)
 	D_ASSERT(!types.empty());
 }
 
+unique_ptr<ColumnDataCollection> ColumnDataCollection::CreateMaterializedCollection(ClientContext &context,
+                                                                                   vector<LogicalType> types) {
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	if (buffer_manager.GetTemporaryDirectory().empty()) {
+		// the data cannot be spilled: keep it in memory without restricting it to the memory limit
+		return make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), move(types));
+	}
+	// the collection can outlive the connection and the database: keep the buffer manager alive as long as it exists
+	auto allocator = make_shared<ColumnDataAllocator>(context.db);
+	return make_unique<ColumnDataCollection>(move(allocator), move(types));
+}
+
 ColumnDataCollection::~ColumnDataCollection() {
 }
 
@@ -733,11 +747,14 @@ void ColumnDataCollection::Combine(ColumnDataCollection &other) {
 	if (types != other.types) {
 		throw InternalException("Attempting to combine ColumnDataCollections with mismatching types");
 	}
+	// the segments are moved over: the data itself is not copied
+	// note that we do not reserve the exact amount of segments here, as that would re-allocate the segment list every
+	// time a collection is combined into this one (e.g. when combining the collections of many batches)
 	this->count += other.count;
-	this->segments.reserve(segments.size() + other.segments.size());
 	for (auto &other_seg : other.segments) {
 		segments.push_back(move(other_seg));
 	}
+	other.Reset();
 	Verify();
 }
 
@@ -752,6 +769,19 @@ idx_t ColumnDataCollection::ChunkCount() const {
 	return chunk_count;
 }
 
+idx_t ColumnDataCollection::SizeInBytes() const {
+	// the segments of combined collections can have their own allocators
+	unordered_set<ColumnDataAllocator *> allocators;
+	idx_t result = 0;
+	for (auto &segment : segments) {
+		if (allocators.insert(segment->allocator.get()).second) {
+			result += segment->allocator->SizeInBytes();
+		}
+		result += segment->heap.SizeInBytes();
+	}
+	return result;
+}
+
 void ColumnDataCollection::FetchChunk(idx_t chunk_idx, DataChunk &result) const {
 	D_ASSERT(chunk_idx < ChunkCount());
 	for (auto &segment : segments) {
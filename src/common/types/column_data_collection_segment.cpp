@@ -1,7 +1,24 @@
 #include "duckdb/common/types/column_data_collection_segment.hpp"
 
+#include "duckdb/common/algorithm.hpp"
+
 namespace duckdb {
 
+void ChunkMetaData::AddBlock(uint32_t block_id) {
+	// blocks are allocated in order: the block is usually the last one that was added
+	if (!block_ids.empty() && block_ids.back() == block_id) {
+		return;
+	}
+	if (HasBlock(block_id)) {
+		return;
+	}
+	block_ids.push_back(block_id);
+}
+
+bool ChunkMetaData::HasBlock(uint32_t block_id) const {
+	return std::find(block_ids.begin(), block_ids.end(), block_id) != block_ids.end();
+}
+
 ColumnDataCollectionSegment::ColumnDataCollectionSegment(shared_ptr<ColumnDataAllocator> allocator_p,
                                                          vector<LogicalType> types_p)
     : allocator(move(allocator_p)), types(move(types_p)), count(0), heap(allocator->GetAllocator()) {
@@ -25,7 +42,7 @@ VectorDataIndex ColumnDataCollectionSegment::AllocateVectorInternal(const Logica
 	allocator->AllocateData(GetDataSize(type_size) + ValidityMask::STANDARD_MASK_SIZE, meta_data.block_id,
 	                        meta_data.offset, chunk_state);
 	if (allocator->GetType() == ColumnDataAllocatorType::BUFFER_MANAGER_ALLOCATOR) {
-		chunk_meta.block_ids.insert(meta_data.block_id);
+		chunk_meta.AddBlock(meta_data.block_id);
 	}
 
 	auto index = vector_data.size();
@@ -115,9 +132,23 @@ idx_t ColumnDataCollectionSegment::ReadVectorInternal(ChunkManagementState &stat
 
 	auto base_ptr = allocator->GetDataPointer(state, vdata.block_id, vdata.offset);
 	auto validity_data = GetValidityPointer(base_ptr, type_size);
-	if (!vdata.next_data.IsValid() && state.properties != ColumnDataScanProperties::DISALLOW_ZERO_COPY) {
+	bool zero_copy = !vdata.next_data.IsValid() && state.properties != ColumnDataScanProperties::DISALLOW_ZERO_COPY;
+	bool keep_alive = state.properties == ColumnDataScanProperties::KEEP_ALIVE_ZERO_COPY;
+	if (zero_copy && keep_alive) {
+		// strings point into the heap of the segment, which can not be kept alive
+		zero_copy = allocator->CanKeepAlive() && TypeIsConstantSize(internal_type);
+	}
+	if (zero_copy) {
 		// no next data, we can do a zero-copy read of this vector
-		FlatVector::SetData(result, base_ptr);
+		if (keep_alive) {
+			// the vector keeps the allocator alive, and keeps the block pinned if it is managed by the buffer manager
+			auto pin = allocator->GetType() == ColumnDataAllocatorType::BUFFER_MANAGER_ALLOCATOR
+			               ? allocator->Pin(vdata.block_id)
+			               : BufferHandle();
+			FlatVector::SetData(result, base_ptr, make_buffer<SharedVectorBuffer>(allocator, move(pin)));
+		} else {
+			FlatVector::SetData(result, base_ptr);
+		}
 		FlatVector::Validity(result).Initialize(validity_data);
 		return vdata.count;
 	}
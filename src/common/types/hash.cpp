@@ -64,6 +64,10 @@ hash_t Hash(const char *str) {
 
 template <>
 hash_t Hash(string_t val) {
+	if (val.IsInlined()) {
+		auto data = (const_data_ptr_t)&val;
+		return HashInlinedString(Load<uint64_t>(data), Load<uint64_t>(data + sizeof(uint64_t)));
+	}
 	return Hash(val.GetDataUnsafe(), val.GetSize());
 }
 
@@ -129,11 +133,15 @@ hash_t HashBytes(void *ptr, size_t len) noexcept {
 }
 
 hash_t Hash(const char *val, size_t size) {
+	if (size <= string_t::INLINE_LENGTH) {
+		// short strings are hashed like an inlined string_t
+		return Hash(string_t(val, size));
+	}
 	return HashBytes((void *)val, size);
 }
 
 hash_t Hash(uint8_t *val, size_t size) {
-	return HashBytes((void *)val, size);
+	return Hash((const char *)val, size);
 }
 
 } // namespace duckdb
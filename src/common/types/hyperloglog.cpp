@@ -106,6 +106,27 @@ unique_ptr<HyperLogLog> HyperLogLog::Deserialize(FieldReader &reader) {
 	return result;
 }
 
+string_t HyperLogLog::ToBlob(Vector &result) const {
+	auto blob = StringVector::EmptyString(result, 1 + GetSize());
+	auto blob_data = (data_ptr_t)blob.GetDataWriteable();
+	blob_data[0] = (uint8_t)HLLStorageType::UNCOMPRESSED;
+	memcpy(blob_data + 1, GetPtr(), GetSize());
+	blob.Finalize();
+	return blob;
+}
+
+unique_ptr<HyperLogLog> HyperLogLog::FromBlob(const string_t &blob) {
+	auto blob_data = (const_data_ptr_t)blob.GetDataUnsafe();
+	// the blob holds the storage type, followed by the dense HLL (which starts with the "HYLL" magic and encoding)
+	if (blob.GetSize() != 1 + GetSize() || blob_data[0] != (uint8_t)HLLStorageType::UNCOMPRESSED ||
+	    memcmp(blob_data + 1, "HYLL", 4) != 0 || blob_data[5] != 0) {
+		throw InvalidInputException("Invalid HyperLogLog sketch: the blob was not created by hll_sketch");
+	}
+	auto result = make_unique<HyperLogLog>();
+	memcpy(result->GetPtr(), blob_data + 1, GetSize());
+	return result;
+}
+
 //===--------------------------------------------------------------------===//
 // Vectorized HLL implementation
 //===--------------------------------------------------------------------===//
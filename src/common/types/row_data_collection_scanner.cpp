@@ -127,8 +127,13 @@ void RowDataCollectionScanner::ScanState::PinData() {
 	auto &rows = scanner.rows;
 	D_ASSERT(block_idx < rows.blocks.size());
 	auto &data_block = rows.blocks[block_idx];
+	// the blocks are scanned in order: if they were spilled, start reading the next one while we scan this one
+	const auto prefetch = scanner.external && block_idx + 1 < scanner.block_end;
 	if (!data_handle.IsValid() || data_handle.GetBlockHandle() != data_block->block) {
 		data_handle = rows.buffer_manager.Pin(data_block->block);
+		if (prefetch) {
+			rows.buffer_manager.Prefetch(rows.blocks[block_idx + 1]->block);
+		}
 	}
 	if (scanner.layout.AllConstant() || !scanner.external) {
 		return;
@@ -139,18 +144,38 @@ void RowDataCollectionScanner::ScanState::PinData() {
 	auto &heap_block = heap.blocks[block_idx];
 	if (!heap_handle.IsValid() || heap_handle.GetBlockHandle() != heap_block->block) {
 		heap_handle = heap.buffer_manager.Pin(heap_block->block);
+		if (prefetch && block_idx + 1 < heap.blocks.size()) {
+			heap.buffer_manager.Prefetch(heap.blocks[block_idx + 1]->block);
+		}
 	}
 }
 
 RowDataCollectionScanner::RowDataCollectionScanner(RowDataCollection &rows_p, RowDataCollection &heap_p,
                                                    const RowLayout &layout_p, bool external_p, bool flush_p)
     : rows(rows_p), heap(heap_p), layout(layout_p), read_state(*this), total_count(rows.count), total_scanned(0),
-      external(external_p), flush(flush_p), unswizzling(!layout.AllConstant() && external && !heap.keep_pinned) {
+      external(external_p), flush(flush_p), unswizzling(!layout.AllConstant() && external && !heap.keep_pinned),
+      block_begin(0), block_end(rows.blocks.size()) {
+
+	if (unswizzling) {
+		D_ASSERT(rows.blocks.size() == heap.blocks.size());
+	}
+
+	ValidateUnscannedBlock();
+}
+
+RowDataCollectionScanner::RowDataCollectionScanner(RowDataCollection &rows_p, RowDataCollection &heap_p,
+                                                   const RowLayout &layout_p, bool external_p, idx_t block_idx,
+                                                   bool flush_p)
+    : rows(rows_p), heap(heap_p), layout(layout_p), read_state(*this), total_count(rows.blocks[block_idx]->count),
+      total_scanned(0), external(external_p), flush(flush_p),
+      unswizzling(!layout.AllConstant() && external && !heap.keep_pinned), block_begin(block_idx),
+      block_end(block_idx + 1) {
 
 	if (unswizzling) {
 		D_ASSERT(rows.blocks.size() == heap.blocks.size());
 	}
 
+	read_state.block_idx = block_begin;
 	ValidateUnscannedBlock();
 }
 
@@ -189,7 +214,7 @@ void RowDataCollectionScanner::ReSwizzle() {
 }
 
 void RowDataCollectionScanner::ValidateUnscannedBlock() const {
-	if (unswizzling && read_state.block_idx < rows.blocks.size()) {
+	if (unswizzling && read_state.block_idx < block_end) {
 		D_ASSERT(rows.blocks[read_state.block_idx]->block->IsSwizzled());
 	}
 }
@@ -254,7 +279,7 @@ void RowDataCollectionScanner::Scan(DataChunk &chunk) {
 
 	if (flush) {
 		// Release blocks we have passed.
-		for (idx_t i = 0; i < read_state.block_idx; ++i) {
+		for (idx_t i = block_begin; i < read_state.block_idx; ++i) {
 			rows.blocks[i]->block = nullptr;
 			if (unswizzling) {
 				heap.blocks[i]->block = nullptr;
@@ -262,7 +287,7 @@ void RowDataCollectionScanner::Scan(DataChunk &chunk) {
 		}
 	} else if (unswizzling) {
 		// Reswizzle blocks we have passed so they can be flushed safely.
-		for (idx_t i = 0; i < read_state.block_idx; ++i) {
+		for (idx_t i = block_begin; i < read_state.block_idx; ++i) {
 			auto &data_block = rows.blocks[i];
 			if (data_block->block && !data_block->block->IsSwizzled()) {
 				SwizzleBlock(*data_block, *heap.blocks[i]);
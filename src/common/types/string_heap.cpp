@@ -16,10 +16,18 @@ void StringHeap::Destroy() {
 	allocator.Destroy();
 }
 
+void StringHeap::Reset() {
+	allocator.Reset();
+}
+
 void StringHeap::Move(StringHeap &other) {
 	other.allocator.Move(allocator);
 }
 
+idx_t StringHeap::SizeInBytes() const {
+	return allocator.SizeInBytes();
+}
+
 string_t StringHeap::AddString(const char *data, idx_t len) {
 	D_ASSERT(Utf8Proc::Analyze(data, len) != UnicodeType::INVALID);
 	return AddBlob(data, len);
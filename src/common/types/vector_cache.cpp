@@ -6,6 +6,9 @@
 namespace duckdb {
 
 class VectorCacheBuffer : public VectorBuffer {
+	//! The maximum size of a string heap that is kept around to be reused by the next vector
+	static constexpr const idx_t MAXIMUM_REUSED_HEAP_SIZE = 1024 * 1024;
+
 public:
 	explicit VectorCacheBuffer(Allocator &allocator, const LogicalType &type_p, idx_t capacity_p = STANDARD_VECTOR_SIZE)
 	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), type(type_p), capacity(capacity_p) {
@@ -72,6 +75,10 @@ public:
 			}
 			break;
 		}
+		case PhysicalType::VARCHAR:
+			result.data = owned_data.get();
+			ResetStringHeap(result);
+			break;
 		default:
 			// regular type: no aux data and reset data to cached data
 			result.data = owned_data.get();
@@ -84,6 +91,23 @@ public:
 		return type;
 	}
 
+private:
+	//! Clears the string heap of the previous contents of the vector. If nothing else references the heap (in which
+	//! case it would be freed here) its memory is reused for the strings of the next chunk instead, which saves
+	//! allocating and freeing the heap for every chunk an expression or operator produces.
+	void ResetStringHeap(Vector &result) {
+		if (!result.auxiliary || result.auxiliary.use_count() != 1 ||
+		    result.auxiliary->GetBufferType() != VectorBufferType::STRING_BUFFER) {
+			result.auxiliary.reset();
+			return;
+		}
+		auto &string_buffer = (VectorStringBuffer &)*result.auxiliary;
+		string_buffer.Reset();
+		if (string_buffer.SizeInBytes() > MAXIMUM_REUSED_HEAP_SIZE) {
+			result.auxiliary.reset();
+		}
+	}
+
 private:
 	//! The type of the vector cache
 	LogicalType type;
@@ -74,6 +74,25 @@ bool VectorOperations::HasNull(Vector &input, idx_t count) {
 		if (data.validity.AllValid()) {
 			return false;
 		}
+		if (!data.sel->data()) {
+			// flat vector: check the validity mask one entry (64 rows) at a time
+			auto entry_count = ValidityMask::EntryCount(count);
+			for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+				auto entry = data.validity.GetValidityEntry(entry_idx);
+				if (ValidityMask::AllValid(entry)) {
+					continue;
+				}
+				// the entry can contain invalid bits past the end of the vector: only check the rows in the vector
+				auto start = entry_idx * ValidityMask::BITS_PER_VALUE;
+				auto end = MinValue<idx_t>(start + ValidityMask::BITS_PER_VALUE, count);
+				for (idx_t i = start; i < end; i++) {
+					if (!ValidityMask::RowIsValid(entry, i - start)) {
+						return true;
+					}
+				}
+			}
+			return false;
+		}
 		for (idx_t i = 0; i < count; i++) {
 			auto idx = data.sel->get_index(i);
 			if (!data.validity.RowIsValid(idx)) {
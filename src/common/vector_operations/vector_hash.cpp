@@ -11,12 +11,27 @@
 
 namespace duckdb {
 
+template <class T>
+static inline hash_t HashValue(T input) {
+	return duckdb::Hash<T>(input);
+}
+
+template <>
+inline hash_t HashValue(string_t input) {
+	// inlined strings are hashed here without a function call, only long strings are hashed byte by byte
+	if (input.IsInlined()) {
+		auto data = (const_data_ptr_t)&input;
+		return HashInlinedString(Load<uint64_t>(data), Load<uint64_t>(data + sizeof(uint64_t)));
+	}
+	return duckdb::Hash(input.GetDataUnsafe(), input.GetSize());
+}
+
 struct HashOp {
 	static const hash_t NULL_HASH = 0xbf58476d1ce4e5b9;
 
 	template <class T>
 	static inline hash_t Operation(T input, bool is_null) {
-		return is_null ? NULL_HASH : duckdb::Hash<T>(input);
+		return is_null ? NULL_HASH : HashValue<T>(input);
 	}
 };
 
@@ -33,23 +48,88 @@ static inline void TightLoopHash(T *__restrict ldata, hash_t *__restrict result_
 			auto idx = sel_vector->get_index(ridx);
 			result_data[ridx] = HashOp::Operation(ldata[idx], !mask.RowIsValid(idx));
 		}
+	} else if (!HAS_RSEL && !sel_vector->data()) {
+		// flat input without NULL values: a tight loop the compiler can vectorize
+		for (idx_t i = 0; i < count; i++) {
+			result_data[i] = HashValue<T>(ldata[i]);
+		}
 	} else {
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
-			result_data[ridx] = duckdb::Hash<T>(ldata[idx]);
+			result_data[ridx] = HashValue<T>(ldata[idx]);
+		}
+	}
+}
+
+//! Whether values of type T are expensive enough to hash that hashing every entry of a dictionary only once pays off
+template <class T>
+struct HashDictionaryOnce {
+	static constexpr bool ENABLED = false;
+};
+
+template <>
+struct HashDictionaryOnce<string_t> {
+	static constexpr bool ENABLED = true;
+};
+
+//! Computes the hashes of the dictionary entries referenced by the rows of a dictionary vector, hashing every entry
+//! only once. Dictionary vectors emitted by e.g. a scan of a dictionary compressed segment reference the same few
+//! strings many times. Returns false (without computing anything) if the vector is not a dictionary vector over a flat
+//! vector that is at most half as large as the amount of rows.
+template <bool HAS_RSEL, class T>
+static bool TryHashDictionary(Vector &input, const SelectionVector *rsel, idx_t count,
+                              hash_t dictionary_hashes[STANDARD_VECTOR_SIZE], const SelectionVector *&dictionary_sel) {
+	if (!HashDictionaryOnce<T>::ENABLED || input.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return false;
+	}
+	auto &child = DictionaryVector::Child(input);
+	if (child.GetVectorType() != VectorType::FLAT_VECTOR) {
+		return false;
+	}
+	auto &sel = DictionaryVector::SelVector(input);
+	idx_t dictionary_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+		dictionary_count = MaxValue<idx_t>(dictionary_count, sel.get_index(ridx) + 1);
+	}
+	if (dictionary_count * 2 > count) {
+		return false;
+	}
+	// only hash the entries that are referenced: the others might not be initialized
+	bool hashed[STANDARD_VECTOR_SIZE];
+	memset(hashed, 0, dictionary_count * sizeof(bool));
+	auto ldata = FlatVector::GetData<T>(child);
+	auto &mask = FlatVector::Validity(child);
+	for (idx_t i = 0; i < count; i++) {
+		auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+		auto idx = sel.get_index(ridx);
+		if (!hashed[idx]) {
+			dictionary_hashes[idx] = HashOp::Operation(ldata[idx], !mask.RowIsValid(idx));
+			hashed[idx] = true;
 		}
 	}
+	dictionary_sel = &sel;
+	return true;
 }
 
 template <bool HAS_RSEL, class T>
 static inline void TemplatedLoopHash(Vector &input, Vector &result, const SelectionVector *rsel, idx_t count) {
+	hash_t dictionary_hashes[STANDARD_VECTOR_SIZE];
+	const SelectionVector *dictionary_sel;
 	if (input.GetVectorType() == VectorType::CONSTANT_VECTOR) {
 		result.SetVectorType(VectorType::CONSTANT_VECTOR);
 
 		auto ldata = ConstantVector::GetData<T>(input);
 		auto result_data = ConstantVector::GetData<hash_t>(result);
 		*result_data = HashOp::Operation(*ldata, ConstantVector::IsNull(input));
+	} else if (TryHashDictionary<HAS_RSEL, T>(input, rsel, count, dictionary_hashes, dictionary_sel)) {
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		auto result_data = FlatVector::GetData<hash_t>(result);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			result_data[ridx] = dictionary_hashes[dictionary_sel->get_index(ridx)];
+		}
 	} else {
 		result.SetVectorType(VectorType::FLAT_VECTOR);
 
@@ -251,11 +331,15 @@ static inline void TightLoopCombineHashConstant(T *__restrict ldata, hash_t cons
 			auto other_hash = HashOp::Operation(ldata[idx], !mask.RowIsValid(idx));
 			hash_data[ridx] = CombineHashScalar(constant_hash, other_hash);
 		}
+	} else if (!HAS_RSEL && !sel_vector->data()) {
+		for (idx_t i = 0; i < count; i++) {
+			hash_data[i] = CombineHashScalar(constant_hash, HashValue<T>(ldata[i]));
+		}
 	} else {
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
-			auto other_hash = duckdb::Hash<T>(ldata[idx]);
+			auto other_hash = HashValue<T>(ldata[idx]);
 			hash_data[ridx] = CombineHashScalar(constant_hash, other_hash);
 		}
 	}
@@ -271,11 +355,15 @@ static inline void TightLoopCombineHash(T *__restrict ldata, hash_t *__restrict
 			auto other_hash = HashOp::Operation(ldata[idx], !mask.RowIsValid(idx));
 			hash_data[ridx] = CombineHashScalar(hash_data[ridx], other_hash);
 		}
+	} else if (!HAS_RSEL && !sel_vector->data()) {
+		for (idx_t i = 0; i < count; i++) {
+			hash_data[i] = CombineHashScalar(hash_data[i], HashValue<T>(ldata[i]));
+		}
 	} else {
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
-			auto other_hash = duckdb::Hash<T>(ldata[idx]);
+			auto other_hash = HashValue<T>(ldata[idx]);
 			hash_data[ridx] = CombineHashScalar(hash_data[ridx], other_hash);
 		}
 	}
@@ -283,12 +371,32 @@ static inline void TightLoopCombineHash(T *__restrict ldata, hash_t *__restrict
 
 template <bool HAS_RSEL, class T>
 void TemplatedLoopCombineHash(Vector &input, Vector &hashes, const SelectionVector *rsel, idx_t count) {
+	hash_t dictionary_hashes[STANDARD_VECTOR_SIZE];
+	const SelectionVector *dictionary_sel;
 	if (input.GetVectorType() == VectorType::CONSTANT_VECTOR && hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
 		auto ldata = ConstantVector::GetData<T>(input);
 		auto hash_data = ConstantVector::GetData<hash_t>(hashes);
 
 		auto other_hash = HashOp::Operation(*ldata, ConstantVector::IsNull(input));
 		*hash_data = CombineHashScalar(*hash_data, other_hash);
+	} else if (TryHashDictionary<HAS_RSEL, T>(input, rsel, count, dictionary_hashes, dictionary_sel)) {
+		if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+			auto constant_hash = *ConstantVector::GetData<hash_t>(hashes);
+			hashes.SetVectorType(VectorType::FLAT_VECTOR);
+			auto hash_data = FlatVector::GetData<hash_t>(hashes);
+			for (idx_t i = 0; i < count; i++) {
+				auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+				hash_data[ridx] = CombineHashScalar(constant_hash, dictionary_hashes[dictionary_sel->get_index(ridx)]);
+			}
+		} else {
+			D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+			auto hash_data = FlatVector::GetData<hash_t>(hashes);
+			for (idx_t i = 0; i < count; i++) {
+				auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+				auto other_hash = dictionary_hashes[dictionary_sel->get_index(ridx)];
+				hash_data[ridx] = CombineHashScalar(hash_data[ridx], other_hash);
+			}
+		}
 	} else {
 		UnifiedVectorFormat idata;
 		input.ToUnifiedFormat(count, idata);
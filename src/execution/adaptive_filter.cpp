@@ -1,89 +1,104 @@
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
-#include <vector>
+#include "duckdb/common/algorithm.hpp"
 
 namespace duckdb {
 
-AdaptiveFilter::AdaptiveFilter(const Expression &expr)
-    : iteration_count(0), observe_interval(10), execute_interval(20), warmup(true) {
+double FilterRuntimeStatistics::GetRank() const {
+	if (tuple_count == 0) {
+		// no statistics yet: evaluate the filter early so we find out
+		return 0;
+	}
+	auto cost = runtime / tuple_count;
+	auto eliminated_fraction = double(eliminated_count) / tuple_count;
+	return cost / MaxValue<double>(eliminated_fraction, 0.0001);
+}
+
+AdaptiveFilter::AdaptiveFilter(const Expression &expr) : iteration_count(0) {
 	auto &conj_expr = (const BoundConjunctionExpression &)expr;
 	D_ASSERT(conj_expr.children.size() > 1);
 	for (idx_t idx = 0; idx < conj_expr.children.size(); idx++) {
-		permutation.push_back(idx);
-		if (idx != conj_expr.children.size() - 1) {
-			swap_likeliness.push_back(100);
-		}
+		filter_ids.push_back(idx);
 	}
-	right_random_border = 100 * (conj_expr.children.size() - 1);
+	Initialize();
 }
 
-AdaptiveFilter::AdaptiveFilter(TableFilterSet *table_filters)
-    : iteration_count(0), observe_interval(10), execute_interval(20), warmup(true) {
+AdaptiveFilter::AdaptiveFilter(TableFilterSet *table_filters, shared_ptr<AdaptiveFilterStatistics> shared_statistics_p)
+    : shared_statistics(move(shared_statistics_p)), iteration_count(0) {
 	for (auto &table_filter : table_filters->filters) {
-		permutation.push_back(table_filter.first);
-		swap_likeliness.push_back(100);
+		filter_ids.push_back(table_filter.first);
+	}
+	Initialize();
+	if (shared_statistics) {
+		// start out with what the other threads have learned already
+		lock_guard<mutex> guard(shared_statistics->lock);
+		shared_statistics->filters.resize(filter_ids.size());
 	}
-	swap_likeliness.pop_back();
-	right_random_border = 100 * (table_filters->filters.size() - 1);
 }
-void AdaptiveFilter::AdaptRuntimeStatistics(double duration) {
-	iteration_count++;
-	runtime_sum += duration;
 
-	if (!warmup) {
-		// the last swap was observed
-		if (observe && iteration_count == observe_interval) {
-			// keep swap if runtime decreased, else reverse swap
-			if (prev_mean - (runtime_sum / iteration_count) <= 0) {
-				// reverse swap because runtime didn't decrease
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
-
-				// decrease swap likeliness, but make sure there is always a small likeliness left
-				if (swap_likeliness[swap_idx] > 1) {
-					swap_likeliness[swap_idx] /= 2;
-				}
-			} else {
-				// keep swap because runtime decreased, reset likeliness
-				swap_likeliness[swap_idx] = 100;
-			}
-			observe = false;
-
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-		} else if (!observe && iteration_count == execute_interval) {
-			// save old mean to evaluate swap
-			prev_mean = runtime_sum / iteration_count;
-
-			// get swap index and swap likeliness
-			std::uniform_int_distribution<int> distribution(1, right_random_border); // a <= i <= b
-			idx_t random_number = distribution(generator) - 1;
+void AdaptiveFilter::Initialize() {
+	for (idx_t idx = 0; idx < filter_ids.size(); idx++) {
+		order.push_back(idx);
+		permutation.push_back(filter_ids[idx]);
+	}
+	local_statistics.resize(filter_ids.size());
+	statistics.resize(filter_ids.size());
+}
 
-			swap_idx = random_number / 100;                    // index to be swapped
-			idx_t likeliness = random_number - 100 * swap_idx; // random number between [0, 100)
+void AdaptiveFilter::AddFilterRuntime(idx_t idx, idx_t tuple_count, idx_t eliminated_count, double runtime) {
+	D_ASSERT(idx < order.size());
+	auto &filter = local_statistics[order[idx]];
+	filter.tuple_count += tuple_count;
+	filter.eliminated_count += eliminated_count;
+	filter.runtime += runtime;
+}
 
-			// check if swap is going to happen
-			if (swap_likeliness[swap_idx] > likeliness) { // always true for the first swap of an index
-				// swap
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
+static void DecayStatistics(vector<FilterRuntimeStatistics> &statistics, idx_t decay_tuple_count) {
+	for (auto &filter : statistics) {
+		if (filter.tuple_count > decay_tuple_count) {
+			filter.tuple_count /= 2;
+			filter.eliminated_count /= 2;
+			filter.runtime /= 2;
+		}
+	}
+}
 
-				// observe whether swap will be applied
-				observe = true;
-			}
+void AdaptiveFilter::AdaptRuntimeStatistics() {
+	iteration_count++;
+	if (iteration_count < ADAPT_INTERVAL) {
+		return;
+	}
+	iteration_count = 0;
 
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
+	// combine the new statistics with the old ones
+	if (shared_statistics) {
+		lock_guard<mutex> guard(shared_statistics->lock);
+		auto &shared_filters = shared_statistics->filters;
+		D_ASSERT(shared_filters.size() == local_statistics.size());
+		for (idx_t i = 0; i < local_statistics.size(); i++) {
+			shared_filters[i].Merge(local_statistics[i]);
 		}
+		DecayStatistics(shared_filters, DECAY_TUPLE_COUNT);
+		statistics = shared_filters;
 	} else {
-		if (iteration_count == 5) {
-			// initially set all values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-			observe = false;
-			warmup = false;
+		for (idx_t i = 0; i < local_statistics.size(); i++) {
+			statistics[i].Merge(local_statistics[i]);
 		}
+		DecayStatistics(statistics, DECAY_TUPLE_COUNT);
+	}
+	for (auto &filter : local_statistics) {
+		filter = FilterRuntimeStatistics();
+	}
+
+	// evaluate the cheapest filters that eliminate the most tuples first
+	vector<double> ranks;
+	for (auto &filter : statistics) {
+		ranks.push_back(filter.GetRank());
+	}
+	std::stable_sort(order.begin(), order.end(), [&](idx_t a, idx_t b) { return ranks[a] < ranks[b]; });
+	for (idx_t i = 0; i < order.size(); i++) {
+		permutation[i] = filter_ids[order[i]];
 	}
 }
 
@@ -83,6 +83,7 @@ void GroupedAggregateHashTable::PayloadApply(FUNC fun) {
 	if (entries == 0) {
 		return;
 	}
+	Pin();
 	idx_t apply_entries = entries;
 	idx_t page_nr = 0;
 	idx_t page_offset = 0;
@@ -101,12 +102,41 @@ void GroupedAggregateHashTable::PayloadApply(FUNC fun) {
 }
 
 void GroupedAggregateHashTable::NewBlock() {
-	auto pin = buffer_manager.Allocate(Storage::BLOCK_SIZE);
+	D_ASSERT(unpinned_blocks.empty());
+	// the block can not be destroyed when it is evicted, so it is written to a temporary file if it is unpinned
+	auto pin = buffer_manager.Allocate(Storage::BLOCK_SIZE, false);
 	payload_hds.push_back(move(pin));
 	payload_hds_ptrs.push_back(payload_hds.back().Ptr());
 	payload_page_offset = 0;
 }
 
+bool GroupedAggregateHashTable::CanUnpin() const {
+	return is_finalized && layout.AllConstant();
+}
+
+void GroupedAggregateHashTable::Unpin() {
+	D_ASSERT(CanUnpin());
+	if (!unpinned_blocks.empty()) {
+		return;
+	}
+	for (auto &handle : payload_hds) {
+		unpinned_blocks.push_back(handle.GetBlockHandle());
+	}
+	payload_hds.clear();
+	payload_hds_ptrs.clear();
+}
+
+void GroupedAggregateHashTable::Pin() {
+	if (unpinned_blocks.empty()) {
+		return;
+	}
+	for (auto &block : unpinned_blocks) {
+		payload_hds.push_back(buffer_manager.Pin(block));
+		payload_hds_ptrs.push_back(payload_hds.back().Ptr());
+	}
+	unpinned_blocks.clear();
+}
+
 void GroupedAggregateHashTable::Destroy() {
 	// check if there is a destructor
 	bool has_destructor = false;
@@ -253,6 +283,15 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload,
 	return AddChunk(groups, hashes, payload, filter);
 }
 
+static bool AllGroupsConstant(DataChunk &groups) {
+	for (auto &group : groups.data) {
+		if (group.GetVectorType() != VectorType::CONSTANT_VECTOR) {
+			return false;
+		}
+	}
+	return true;
+}
+
 idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashes, DataChunk &payload,
                                           const vector<idx_t> &filter) {
 	D_ASSERT(!is_finalized);
@@ -269,11 +308,73 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 	}
 
 	Vector addresses(LogicalType::POINTER);
-	auto new_group_count = FindOrCreateGroups(groups, group_hashes, addresses, new_groups);
+	idx_t new_group_count;
+	if (AllGroupsConstant(groups)) {
+		// every row belongs to the same group (e.g. a run of a run-length encoded column): look it up only once, and
+		// update the aggregates through a constant address so they can aggregate the entire chunk at once
+		DataChunk constant_groups;
+		constant_groups.InitializeEmpty(groups.GetTypes());
+		constant_groups.Reference(groups);
+		constant_groups.SetCardinality(1);
+		new_group_count = FindOrCreateGroups(constant_groups, group_hashes, addresses, new_groups);
+		addresses.SetVectorType(VectorType::CONSTANT_VECTOR);
+	} else {
+		new_group_count = FindOrCreateGroups(groups, group_hashes, addresses, new_groups);
+	}
 	VectorOperations::AddInPlace(addresses, layout.GetAggrOffset(), payload.size());
 
 	// now every cell has an entry
 	// update the aggregates
+	UpdateAggregates(addresses, payload, filter);
+
+	Verify();
+	return new_group_count;
+}
+
+idx_t GroupedAggregateHashTable::AppendChunk(DataChunk &groups, Vector &group_hashes, DataChunk &payload,
+                                             const vector<idx_t> &filter) {
+	// the pointer table is gone after finalizing, so lookups are no longer possible anyway
+	D_ASSERT(is_finalized);
+	if (groups.size() == 0) {
+		return 0;
+	}
+	if (entries + groups.size() > MaxCapacity()) {
+		throw InternalException("Hash table capacity reached");
+	}
+	D_ASSERT(groups.ColumnCount() + 1 == layout.ColumnCount());
+	D_ASSERT(group_hashes.GetType() == LogicalType::HASH);
+
+	// every row gets a new entry
+	Vector addresses(LogicalType::POINTER);
+	auto addresses_ptr = FlatVector::GetData<data_ptr_t>(addresses);
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (payload_page_offset == tuples_per_block || payload_hds.empty()) {
+			NewBlock();
+		}
+		addresses_ptr[i] = payload_hds_ptrs.back() + (payload_page_offset++ * tuple_size);
+	}
+	entries += groups.size();
+
+	// serialize the groups and their hashes to the new entries
+	DataChunk group_chunk;
+	group_chunk.InitializeEmpty(layout.GetTypes());
+	for (idx_t grp_idx = 0; grp_idx < groups.ColumnCount(); grp_idx++) {
+		group_chunk.data[grp_idx].Reference(groups.data[grp_idx]);
+	}
+	group_chunk.data[groups.ColumnCount()].Reference(group_hashes);
+	group_chunk.SetCardinality(groups);
+	auto group_data = group_chunk.ToUnifiedFormat();
+
+	const auto &sel = *FlatVector::IncrementalSelectionVector();
+	RowOperations::Scatter(group_chunk, group_data.get(), layout, addresses, *string_heap, sel, groups.size());
+	RowOperations::InitializeStates(layout, addresses, sel, groups.size());
+
+	VectorOperations::AddInPlace(addresses, layout.GetAggrOffset(), payload.size());
+	UpdateAggregates(addresses, payload, filter);
+	return groups.size();
+}
+
+void GroupedAggregateHashTable::UpdateAggregates(Vector &addresses, DataChunk &payload, const vector<idx_t> &filter) {
 	idx_t payload_idx = 0;
 
 	auto &aggregates = layout.GetAggregates();
@@ -299,9 +400,6 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 		VectorOperations::AddInPlace(addresses, aggr.payload_size, payload.size());
 		filter_idx++;
 	}
-
-	Verify();
-	return new_group_count;
 }
 
 void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &result) {
@@ -610,6 +708,15 @@ idx_t GroupedAggregateHashTable::Scan(AggregateHTScanState &scan_state, DataChun
 	idx_t this_n;
 	Vector addresses(LogicalType::POINTER);
 	auto data_pointers = FlatVector::GetData<data_ptr_t>(addresses);
+	// if the payload is unpinned, the HT can be scanned by multiple threads at once: each pins the blocks it reads
+	vector<BufferHandle> scan_pins;
+	auto get_block_ptr = [&](idx_t block_idx) {
+		if (unpinned_blocks.empty()) {
+			return payload_hds_ptrs[block_idx];
+		}
+		scan_pins.push_back(buffer_manager.Pin(unpinned_blocks[block_idx]));
+		return scan_pins.back().Ptr();
+	};
 	{
 		lock_guard<mutex> l(scan_state.lock);
 		if (scan_state.scan_position >= entries) {
@@ -622,12 +729,12 @@ idx_t GroupedAggregateHashTable::Scan(AggregateHTScanState &scan_state, DataChun
 		auto chunk_offset = (scan_state.scan_position % tuples_per_block) * tuple_size;
 		D_ASSERT(chunk_offset + tuple_size <= Storage::BLOCK_SIZE);
 
-		auto read_ptr = payload_hds_ptrs[chunk_idx++];
+		auto read_ptr = get_block_ptr(chunk_idx++);
 		for (idx_t i = 0; i < this_n; i++) {
 			data_pointers[i] = read_ptr + chunk_offset;
 			chunk_offset += tuple_size;
-			if (chunk_offset >= tuples_per_block * tuple_size) {
-				read_ptr = payload_hds_ptrs[chunk_idx++];
+			if (chunk_offset >= tuples_per_block * tuple_size && i + 1 < this_n) {
+				read_ptr = get_block_ptr(chunk_idx++);
 				chunk_offset = 0;
 			}
 		}
@@ -78,6 +78,21 @@ void ExpressionExecutor::Execute(DataChunk *input, DataChunk &result) {
 	result.Verify();
 }
 
+void ExpressionExecutor::Execute(DataChunk &input, const SelectionVector &sel, idx_t count, DataChunk &result) {
+	SetChunk(&input);
+	D_ASSERT(expressions.size() == result.ColumnCount());
+	D_ASSERT(!expressions.empty());
+
+	for (idx_t i = 0; i < expressions.size(); i++) {
+		D_ASSERT(result.data[i].GetType().id() == expressions[i]->return_type.id());
+		states[i]->profiler.BeginSample();
+		Execute(*expressions[i], states[i]->root_state.get(), &sel, count, result.data[i]);
+		states[i]->profiler.EndSample(count);
+	}
+	result.SetCardinality(count);
+	result.Verify();
+}
+
 void ExpressionExecutor::ExecuteExpression(DataChunk &input, Vector &result) {
 	SetChunk(&input);
 	ExecuteExpression(result);
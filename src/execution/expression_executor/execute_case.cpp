@@ -1,9 +1,130 @@
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression/bound_case_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 
 namespace duckdb {
 
+//! Lookup table for CASE expressions of the form CASE x WHEN c1 THEN v1 WHEN c2 THEN v2 ... ELSE v END, where all
+//! of the WHEN values are integer constants and all of the results are constants. Instead of checking the branches
+//! one after the other, the branch of every row is looked up directly.
+struct CaseLookupTable {
+	//! Minimum amount of branches for which the lookup table is used
+	static constexpr const idx_t MIN_BRANCH_COUNT = 8;
+
+	explicit CaseLookupTable(const BoundCaseExpression &expr)
+	    : input(*((BoundComparisonExpression &)*expr.case_checks[0].when_expr).left),
+	      values(expr.return_type, expr.case_checks.size() + 1), else_branch(expr.case_checks.size()),
+	      min_key(0), branches(STANDARD_VECTOR_SIZE) {
+	}
+
+	//! The (shared) expression that is compared with the WHEN values
+	const Expression &input;
+	//! The THEN values, followed by the ELSE value
+	Vector values;
+	//! The index of the ELSE value
+	sel_t else_branch;
+	//! Direct lookup from (key - min_key) to the branch, used if the keys are close together
+	int64_t min_key;
+	vector<sel_t> dense;
+	//! Lookup from key to branch, used otherwise
+	unordered_map<int64_t, sel_t> sparse;
+	//! The branch of every row
+	SelectionVector branches;
+
+public:
+	sel_t Find(int64_t key) const {
+		if (!dense.empty()) {
+			auto offset = uint64_t(key) - uint64_t(min_key);
+			return offset < dense.size() ? dense[offset] : else_branch;
+		}
+		auto entry = sparse.find(key);
+		return entry == sparse.end() ? else_branch : entry->second;
+	}
+
+	static unique_ptr<CaseLookupTable> TryCreate(const BoundCaseExpression &expr);
+};
+
+unique_ptr<CaseLookupTable> CaseLookupTable::TryCreate(const BoundCaseExpression &expr) {
+	if (expr.case_checks.size() < MIN_BRANCH_COUNT || expr.else_expr->type != ExpressionType::VALUE_CONSTANT) {
+		return nullptr;
+	}
+	for (auto &case_check : expr.case_checks) {
+		auto &when_expr = *case_check.when_expr;
+		if (when_expr.type != ExpressionType::COMPARE_EQUAL ||
+		    when_expr.expression_class != ExpressionClass::BOUND_COMPARISON ||
+		    case_check.then_expr->type != ExpressionType::VALUE_CONSTANT) {
+			return nullptr;
+		}
+		auto &comparison = (BoundComparisonExpression &)when_expr;
+		auto &first = (BoundComparisonExpression &)*expr.case_checks[0].when_expr;
+		if (comparison.right->type != ExpressionType::VALUE_CONSTANT || !comparison.left->Equals(first.left.get()) ||
+		    ((BoundConstantExpression &)*comparison.right).value.IsNull()) {
+			return nullptr;
+		}
+	}
+	auto &first = (BoundComparisonExpression &)*expr.case_checks[0].when_expr;
+	if (first.left->HasSideEffects()) {
+		// the input is only evaluated once instead of once per branch
+		return nullptr;
+	}
+	switch (first.left->return_type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+		break;
+	default:
+		return nullptr;
+	}
+
+	auto result = make_unique<CaseLookupTable>(expr);
+	vector<int64_t> keys;
+	for (idx_t i = 0; i < expr.case_checks.size(); i++) {
+		auto &case_check = expr.case_checks[i];
+		auto &comparison = (BoundComparisonExpression &)*case_check.when_expr;
+		keys.push_back(((BoundConstantExpression &)*comparison.right).value.GetValue<int64_t>());
+		result->values.SetValue(i, ((BoundConstantExpression &)*case_check.then_expr).value);
+	}
+	result->values.SetValue(result->else_branch, ((BoundConstantExpression &)*expr.else_expr).value);
+
+	auto min_key = *std::min_element(keys.begin(), keys.end());
+	auto max_key = *std::max_element(keys.begin(), keys.end());
+	auto range = uint64_t(max_key) - uint64_t(min_key);
+	if (range < MaxValue<uint64_t>(4 * keys.size(), STANDARD_VECTOR_SIZE)) {
+		result->min_key = min_key;
+		result->dense.resize(range + 1, result->else_branch);
+	}
+	// iterate in reverse: if a key occurs multiple times, the first branch wins
+	for (idx_t i = keys.size(); i > 0; i--) {
+		auto branch = sel_t(i - 1);
+		if (!result->dense.empty()) {
+			result->dense[uint64_t(keys[branch]) - uint64_t(min_key)] = branch;
+		} else {
+			result->sparse[keys[branch]] = branch;
+		}
+	}
+	return result;
+}
+
+template <class T>
+static void FindCaseBranches(CaseLookupTable &lookup, Vector &input, idx_t count) {
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = (const T *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		auto branch = vdata.validity.RowIsValid(idx) ? lookup.Find(int64_t(data[idx])) : lookup.else_branch;
+		lookup.branches.set_index(i, branch);
+	}
+}
+
 struct CaseExpressionState : public ExpressionState {
 	CaseExpressionState(const Expression &expr, ExpressionExecutorState &root)
 	    : ExpressionState(expr, root), true_sel(STANDARD_VECTOR_SIZE), false_sel(STANDARD_VECTOR_SIZE) {
@@ -11,6 +132,8 @@ struct CaseExpressionState : public ExpressionState {
 
 	SelectionVector true_sel;
 	SelectionVector false_sel;
+	//! The lookup table of the branches (if any)
+	unique_ptr<CaseLookupTable> lookup;
 };
 
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundCaseExpression &expr,
@@ -22,6 +145,7 @@ unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundCaseE
 	}
 	result->AddChild(expr.else_expr.get());
 	result->Finalize();
+	result->lookup = CaseLookupTable::TryCreate(expr);
 	return move(result);
 }
 
@@ -29,6 +153,42 @@ void ExpressionExecutor::Execute(const BoundCaseExpression &expr, ExpressionStat
                                  idx_t count, Vector &result) {
 	auto state = (CaseExpressionState *)state_p;
 
+	if (state->lookup) {
+		// evaluate the input once using the state of the (first) comparison, and look up the branch of every row
+		auto &lookup = *state->lookup;
+		auto &comparison_state = *state->child_states[0];
+		comparison_state.intermediate_chunk.Reset();
+		auto &input = comparison_state.intermediate_chunk.data[0];
+		Execute(lookup.input, comparison_state.child_states[0].get(), sel, count, input);
+		switch (input.GetType().InternalType()) {
+		case PhysicalType::INT8:
+			FindCaseBranches<int8_t>(lookup, input, count);
+			break;
+		case PhysicalType::INT16:
+			FindCaseBranches<int16_t>(lookup, input, count);
+			break;
+		case PhysicalType::INT32:
+			FindCaseBranches<int32_t>(lookup, input, count);
+			break;
+		case PhysicalType::INT64:
+			FindCaseBranches<int64_t>(lookup, input, count);
+			break;
+		case PhysicalType::UINT8:
+			FindCaseBranches<uint8_t>(lookup, input, count);
+			break;
+		case PhysicalType::UINT16:
+			FindCaseBranches<uint16_t>(lookup, input, count);
+			break;
+		case PhysicalType::UINT32:
+			FindCaseBranches<uint32_t>(lookup, input, count);
+			break;
+		default:
+			throw InternalException("Unsupported type for CASE lookup");
+		}
+		VectorOperations::Copy(lookup.values, result, lookup.branches, count, 0, 0);
+		return;
+	}
+
 	state->intermediate_chunk.Reset();
 
 	// first execute the check expression
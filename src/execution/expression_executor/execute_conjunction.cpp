@@ -4,8 +4,6 @@
 #include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/common/chrono.hpp"
 
-#include <random>
-
 namespace duckdb {
 
 struct ConjunctionState : public ExpressionState {
@@ -58,10 +56,8 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
                                  SelectionVector *false_sel) {
 	auto state = (ConjunctionState *)state_p;
 
+	auto &adaptive_filter = *state->adaptive_filter;
 	if (expr.type == ExpressionType::CONJUNCTION_AND) {
-		// get runtime statistics
-		auto start_time = high_resolution_clock::now();
-
 		const SelectionVector *current_sel = sel;
 		idx_t current_count = count;
 		idx_t false_count = 0;
@@ -75,10 +71,16 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 			true_sel = temp_true.get();
 		}
 		for (idx_t i = 0; i < expr.children.size(); i++) {
-			idx_t tcount = Select(*expr.children[state->adaptive_filter->permutation[i]],
-			                      state->child_states[state->adaptive_filter->permutation[i]].get(), current_sel,
+			auto child_idx = adaptive_filter.permutation[i];
+			// get runtime statistics
+			auto start_time = high_resolution_clock::now();
+			idx_t tcount = Select(*expr.children[child_idx], state->child_states[child_idx].get(), current_sel,
 			                      current_count, true_sel, temp_false.get());
+			auto end_time = high_resolution_clock::now();
 			idx_t fcount = current_count - tcount;
+			// the tuples that did not pass are eliminated
+			adaptive_filter.AddFilterRuntime(i, current_count, fcount,
+			                                 duration_cast<duration<double>>(end_time - start_time).count());
 			if (fcount > 0 && false_sel) {
 				// move failing tuples into the false_sel
 				// tuples passed, move them into the actual result vector
@@ -98,13 +100,9 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 		}
 
 		// adapt runtime statistics
-		auto end_time = high_resolution_clock::now();
-		state->adaptive_filter->AdaptRuntimeStatistics(duration_cast<duration<double>>(end_time - start_time).count());
+		adaptive_filter.AdaptRuntimeStatistics();
 		return current_count;
 	} else {
-		// get runtime statistics
-		auto start_time = high_resolution_clock::now();
-
 		const SelectionVector *current_sel = sel;
 		idx_t current_count = count;
 		idx_t result_count = 0;
@@ -118,9 +116,15 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 			false_sel = temp_false.get();
 		}
 		for (idx_t i = 0; i < expr.children.size(); i++) {
-			idx_t tcount = Select(*expr.children[state->adaptive_filter->permutation[i]],
-			                      state->child_states[state->adaptive_filter->permutation[i]].get(), current_sel,
+			auto child_idx = adaptive_filter.permutation[i];
+			// get runtime statistics
+			auto start_time = high_resolution_clock::now();
+			idx_t tcount = Select(*expr.children[child_idx], state->child_states[child_idx].get(), current_sel,
 			                      current_count, temp_true.get(), false_sel);
+			auto end_time = high_resolution_clock::now();
+			// the tuples that passed are eliminated
+			adaptive_filter.AddFilterRuntime(i, current_count, tcount,
+			                                 duration_cast<duration<double>>(end_time - start_time).count());
 			if (tcount > 0) {
 				if (true_sel) {
 					// tuples passed, move them into the actual result vector
@@ -135,8 +139,7 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 		}
 
 		// adapt runtime statistics
-		auto end_time = high_resolution_clock::now();
-		state->adaptive_filter->AdaptRuntimeStatistics(duration_cast<duration<double>>(end_time - start_time).count());
+		adaptive_filter.AdaptRuntimeStatistics();
 		return result_count;
 	}
 }
@@ -12,17 +12,13 @@
 
 namespace duckdb {
 
+constexpr const idx_t ART::CONSTRUCT_BATCH_SIZE;
+
 ART::ART(const vector<column_t> &column_ids, TableIOManager &table_io_manager,
          const vector<unique_ptr<Expression>> &unbound_expressions, IndexConstraintType constraint_type,
          DatabaseInstance &db, idx_t block_id, idx_t block_offset)
     : Index(IndexType::ART, table_io_manager, column_ids, unbound_expressions, constraint_type), db(db),
       estimated_art_size(0), estimated_key_size(16) {
-	if (block_id != DConstants::INVALID_INDEX) {
-		tree = Node::Deserialize(*this, block_id, block_offset);
-	} else {
-		tree = nullptr;
-	}
-	serialized_data_pointer = BlockPointer(block_id, block_offset);
 	for (idx_t i = 0; i < types.size(); i++) {
 		switch (types[i]) {
 		case PhysicalType::BOOL:
@@ -54,6 +50,13 @@ ART::ART(const vector<column_t> &column_ids, TableIOManager &table_io_manager,
 			throw InvalidTypeException(logical_types[i], "Invalid type for index");
 		}
 	}
+	// the key size is known now, so the memory of the leaves that are loaded from storage can be accounted for
+	if (block_id != DConstants::INVALID_INDEX) {
+		tree = Node::Deserialize(*this, block_id, block_offset);
+	} else {
+		tree = nullptr;
+	}
+	serialized_data_pointer = BlockPointer(block_id, block_offset);
 }
 
 ART::~ART() {
@@ -101,6 +104,9 @@ static void TemplatedGenerateKeys(ArenaAllocator &allocator, Vector &input, idx_
 		auto idx = idata.sel->get_index(i);
 		if (idata.validity.RowIsValid(idx)) {
 			Key::CreateKey<T>(allocator, keys[i], input_data[idx]);
+		} else {
+			// the keys can be reused across chunks: clear the key of a NULL value
+			keys[i] = Key();
 		}
 	}
 }
@@ -300,43 +306,62 @@ void ART::ConstructAndMerge(IndexLock &lock, PayloadScanner &scanner, Allocator
 	auto payload_types = logical_types;
 	payload_types.emplace_back(LogicalType::ROW_TYPE);
 
+	// the keys and row identifiers of the current batch of sorted chunks
 	ArenaAllocator arena_allocator(BufferAllocator::Get(db));
-	vector<Key> keys(STANDARD_VECTOR_SIZE);
+	vector<Key> chunk_keys(STANDARD_VECTOR_SIZE);
+	vector<Key> keys;
+	vector<row_t> row_ids;
+	keys.reserve(CONSTRUCT_BATCH_SIZE);
+	row_ids.reserve(CONSTRUCT_BATCH_SIZE);
 
 	auto temp_art = make_unique<ART>(this->column_ids, this->table_io_manager, this->unbound_expressions,
 	                                 this->constraint_type, this->db);
 
-	for (;;) {
-		DataChunk ordered_chunk;
-		ordered_chunk.Initialize(allocator, payload_types);
-		ordered_chunk.SetCardinality(0);
-		scanner.Scan(ordered_chunk);
-		if (ordered_chunk.size() == 0) {
-			break;
-		}
+	bool exhausted = false;
+	while (!exhausted) {
+		// gather the keys of many sorted chunks, so that the nodes of the batch are created with their final size
+		// instead of growing them when merging small ARTs
+		keys.clear();
+		row_ids.clear();
+		arena_allocator.Reset();
+		while (keys.size() + STANDARD_VECTOR_SIZE <= CONSTRUCT_BATCH_SIZE) {
+			DataChunk ordered_chunk;
+			ordered_chunk.Initialize(allocator, payload_types);
+			ordered_chunk.SetCardinality(0);
+			scanner.Scan(ordered_chunk);
+			if (ordered_chunk.size() == 0) {
+				exhausted = true;
+				break;
+			}
 
-		// get the key chunk and the row_identifiers vector
-		DataChunk row_id_chunk;
-		ordered_chunk.Split(row_id_chunk, ordered_chunk.ColumnCount() - 1);
-		auto &row_identifiers = row_id_chunk.data[0];
+			// get the key chunk and the row_identifiers vector
+			DataChunk row_id_chunk;
+			ordered_chunk.Split(row_id_chunk, ordered_chunk.ColumnCount() - 1);
+			auto &row_identifiers = row_id_chunk.data[0];
 
-		D_ASSERT(row_identifiers.GetType().InternalType() == ROW_TYPE);
-		D_ASSERT(logical_types[0] == ordered_chunk.data[0].GetType());
+			D_ASSERT(row_identifiers.GetType().InternalType() == ROW_TYPE);
+			D_ASSERT(logical_types[0] == ordered_chunk.data[0].GetType());
 
-		// generate the keys for the given input
-		arena_allocator.Reset();
-		GenerateKeys(arena_allocator, ordered_chunk, keys);
+			// generate the keys for the given input
+			GenerateKeys(arena_allocator, ordered_chunk, chunk_keys);
+			keys.insert(keys.end(), chunk_keys.begin(), chunk_keys.begin() + ordered_chunk.size());
 
-		// prepare the row_identifiers
-		row_identifiers.Flatten(ordered_chunk.size());
-		auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+			// prepare the row_identifiers
+			row_identifiers.Flatten(ordered_chunk.size());
+			auto chunk_row_ids = FlatVector::GetData<row_t>(row_identifiers);
+			row_ids.insert(row_ids.end(), chunk_row_ids, chunk_row_ids + ordered_chunk.size());
+		}
+		if (keys.empty()) {
+			break;
+		}
 
-		// construct the ART of this chunk
+		// construct the ART of this batch bottom-up
 		auto art = make_unique<ART>(this->column_ids, this->table_io_manager, this->unbound_expressions,
 		                            this->constraint_type, this->db);
-		auto key_section = KeySection(0, ordered_chunk.size() - 1, 0, 0);
+		art->ReserveKeyMemory(keys.size());
+		auto key_section = KeySection(0, keys.size() - 1, 0, 0);
 		auto has_constraint = IsUnique();
-		Construct(keys, row_ids, art->tree, key_section, has_constraint);
+		Construct(keys, row_ids.data(), art->tree, key_section, has_constraint);
 
 		// merge art into temp_art
 		if (!temp_art->MergeIndexes(lock, art.get())) {
@@ -361,9 +386,7 @@ bool ART::Insert(IndexLock &lock, DataChunk &input, Vector &row_ids) {
 	vector<Key> keys(input.size());
 	GenerateKeys(arena_allocator, input, keys);
 
-	idx_t extra_memory = estimated_key_size * input.size();
-	BufferManager::GetBufferManager(db).ReserveMemory(extra_memory);
-	estimated_art_size += extra_memory;
+	ReserveKeyMemory(input.size());
 
 	// now insert the elements into the index
 	row_ids.Flatten(input.size());
@@ -411,6 +434,10 @@ void ART::VerifyAppend(DataChunk &chunk) {
 	VerifyExistence(chunk, VerifyExistenceType::APPEND);
 }
 
+void ART::VerifyAppend(DataChunk &chunk, string *err_msg_ptr) {
+	VerifyExistence(chunk, VerifyExistenceType::APPEND, err_msg_ptr);
+}
+
 void ART::VerifyAppendForeignKey(DataChunk &chunk, string *err_msg_ptr) {
 	VerifyExistence(chunk, VerifyExistenceType::APPEND_FK, err_msg_ptr);
 }
@@ -645,11 +672,36 @@ void ART::SearchEqualJoinNoFetch(Key &key, idx_t &result_size) {
 	// we need to look for a leaf
 	auto leaf = Lookup(tree, key, 0);
 	if (!leaf) {
+		result_size = 0;
 		return;
 	}
 	result_size = leaf->count;
 }
 
+void ART::SearchRangeJoin(Key &key, ExpressionType comparison, vector<row_t> &result_ids) {
+	if (!tree) {
+		return;
+	}
+	ARTIndexScanState state;
+	auto max_count = NumericLimits<idx_t>::Maximum();
+	switch (comparison) {
+	case ExpressionType::COMPARE_LESSTHAN:
+		SearchGreater(&state, key, false, max_count, result_ids);
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		SearchGreater(&state, key, true, max_count, result_ids);
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		SearchLess(&state, key, false, max_count, result_ids);
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		SearchLess(&state, key, true, max_count, result_ids);
+		break;
+	default:
+		throw InternalException("Unsupported comparison for a range index join");
+	}
+}
+
 Leaf *ART::Lookup(Node *node, Key &key, idx_t depth) {
 	while (node) {
 		if (node->type == NodeType::NLeaf) {
@@ -707,6 +759,42 @@ bool ART::SearchGreater(ARTIndexScanState *state, Key &key, bool inclusive, idx_
 	return it->Scan(empty_key, max_count, result_ids, false);
 }
 
+//===--------------------------------------------------------------------===//
+// Ordered Scan
+//===--------------------------------------------------------------------===//
+static bool ScanOrderedInternal(ART &art, Node *node, bool descending, idx_t max_count, vector<row_t> &result_ids) {
+	if (node->type == NodeType::NLeaf) {
+		auto leaf = (Leaf *)node;
+		for (idx_t i = 0; i < leaf->count; i++) {
+			result_ids.push_back(leaf->GetRowId(i));
+		}
+		return result_ids.size() < max_count;
+	}
+	// the positions of the children in key order
+	vector<idx_t> positions;
+	for (auto pos = node->GetNextPos(DConstants::INVALID_INDEX); pos != DConstants::INVALID_INDEX;
+	     pos = node->GetNextPos(pos)) {
+		positions.push_back(pos);
+	}
+	if (descending) {
+		std::reverse(positions.begin(), positions.end());
+	}
+	for (auto &pos : positions) {
+		if (!ScanOrderedInternal(art, node->GetChild(art, pos), descending, max_count, result_ids)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ART::ScanOrdered(bool descending, idx_t max_count, vector<row_t> &result_ids) {
+	lock_guard<mutex> l(lock);
+	if (!tree) {
+		return false;
+	}
+	return !ScanOrderedInternal(*this, tree, descending, max_count, result_ids);
+}
+
 //===--------------------------------------------------------------------===//
 // Less Than
 //===--------------------------------------------------------------------===//
@@ -840,13 +928,35 @@ void ART::VerifyExistence(DataChunk &chunk, VerifyExistenceType verify_type, str
 	vector<Key> keys(expression_chunk.size());
 	GenerateKeys(arena_allocator, expression_chunk, keys);
 
+	// probe the tree in key order: consecutive lookups then share most of their path through the tree, and
+	// duplicate keys within the chunk are only looked up once
+	vector<idx_t> probe_order;
+	probe_order.reserve(chunk.size());
+	for (idx_t i = 0; i < chunk.size(); i++) {
+		if (!keys[i].Empty()) {
+			probe_order.push_back(i);
+		}
+	}
+	std::stable_sort(probe_order.begin(), probe_order.end(),
+	                 [&](const idx_t &lhs, const idx_t &rhs) { return keys[lhs] < keys[rhs]; });
+
+	// when collecting error messages for an append, a key that occurs earlier in the chunk is a conflict as well
+	bool detect_duplicates = err_msg_ptr && verify_type == VerifyExistenceType::APPEND;
+	auto key_exists = unique_ptr<bool[]>(new bool[chunk.size()]);
+	for (idx_t k = 0; k < probe_order.size(); k++) {
+		auto idx = probe_order[k];
+		if (k > 0 && keys[idx] == keys[probe_order[k - 1]]) {
+			key_exists[idx] = detect_duplicates || key_exists[probe_order[k - 1]];
+			continue;
+		}
+		key_exists[idx] = Lookup(tree, keys[idx], 0) != nullptr;
+	}
+
 	for (idx_t i = 0; i < chunk.size(); i++) {
 		if (keys[i].Empty()) {
 			continue;
 		}
-		Node *node_ptr = Lookup(tree, keys[i], 0);
-		bool throw_exception =
-		    verify_type == VerifyExistenceType::APPEND_FK ? node_ptr == nullptr : node_ptr != nullptr;
+		bool throw_exception = verify_type == VerifyExistenceType::APPEND_FK ? !key_exists[i] : key_exists[i];
 		if (!throw_exception) {
 			continue;
 		}
@@ -887,6 +997,12 @@ void ART::VerifyExistence(DataChunk &chunk, VerifyExistenceType verify_type, str
 	}
 }
 
+void ART::ReserveKeyMemory(idx_t key_count) {
+	idx_t extra_memory = estimated_key_size * key_count;
+	BufferManager::GetBufferManager(db).ReserveMemory(extra_memory);
+	estimated_art_size += extra_memory;
+}
+
 //===--------------------------------------------------------------------===//
 // Serialization
 //===--------------------------------------------------------------------===//
@@ -280,8 +280,11 @@ Node *Node::Deserialize(ART &art, idx_t block_id, idx_t offset) {
 	NodeType node_type(static_cast<NodeType>(n));
 	Node *deserialized_node;
 	switch (node_type) {
-	case NodeType::NLeaf:
-		return Leaf::Deserialize(reader);
+	case NodeType::NLeaf: {
+		auto leaf = Leaf::Deserialize(reader);
+		art.ReserveKeyMemory(leaf->count);
+		return leaf;
+	}
 	case NodeType::N4: {
 		deserialized_node = (Node *)Node4::New();
 		break;
@@ -10,12 +10,22 @@ bool Prefix::IsInlined() const {
 	return size <= PREFIX_INLINE_BYTES;
 }
 
+uint8_t *Prefix::GetPointer() const {
+	uint8_t *ptr;
+	memcpy(&ptr, value, sizeof(uint8_t *));
+	return ptr;
+}
+
+void Prefix::SetPointer(uint8_t *ptr) {
+	memcpy(value, &ptr, sizeof(uint8_t *));
+}
+
 uint8_t *Prefix::GetPrefixData() {
-	return IsInlined() ? &value.inlined[0] : value.ptr;
+	return IsInlined() ? &value[0] : GetPointer();
 }
 
 const uint8_t *Prefix::GetPrefixData() const {
-	return IsInlined() ? &value.inlined[0] : value.ptr;
+	return IsInlined() ? &value[0] : GetPointer();
 }
 
 uint8_t *Prefix::AllocatePrefix(uint32_t size) {
@@ -24,11 +34,11 @@ uint8_t *Prefix::AllocatePrefix(uint32_t size) {
 	this->size = size;
 	uint8_t *prefix;
 	if (IsInlined()) {
-		prefix = &value.inlined[0];
+		prefix = &value[0];
 	} else {
 		// allocate new prefix
-		value.ptr = AllocateArray<uint8_t>(size);
-		prefix = value.ptr;
+		prefix = AllocateArray<uint8_t>(size);
+		SetPointer(prefix);
 	}
 	return prefix;
 }
@@ -62,7 +72,7 @@ Prefix::~Prefix() {
 
 void Prefix::Destroy() {
 	if (!IsInlined()) {
-		DeleteArray<uint8_t>(value.ptr, size);
+		DeleteArray<uint8_t>(GetPointer(), size);
 		size = 0;
 	}
 }
@@ -86,7 +96,10 @@ Prefix &Prefix::operator=(const Prefix &src) {
 
 Prefix &Prefix::operator=(Prefix &&other) noexcept {
 	std::swap(size, other.size);
-	std::swap(value, other.value);
+	uint8_t temp[PREFIX_INLINE_BYTES];
+	memcpy(temp, value, PREFIX_INLINE_BYTES);
+	memcpy(value, other.value, PREFIX_INLINE_BYTES);
+	memcpy(other.value, temp, PREFIX_INLINE_BYTES);
 	return *this;
 }
 
@@ -104,7 +117,7 @@ void Prefix::Overwrite(uint32_t new_size, uint8_t *data) {
 		// take over the data directly
 		Destroy();
 		size = new_size;
-		value.ptr = data;
+		SetPointer(data);
 	}
 }
 
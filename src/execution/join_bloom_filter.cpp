@@ -0,0 +1,56 @@
+#include "duckdb/execution/join_bloom_filter.hpp"
+
+namespace duckdb {
+
+JoinBloomFilter::JoinBloomFilter(vector<idx_t> probe_columns_p)
+    : probe_columns(move(probe_columns_p)), word_mask(0), ready(false) {
+}
+
+void JoinBloomFilter::Initialize(Allocator &allocator, idx_t count) {
+	D_ASSERT(!ready);
+	// every 64-bit word holds (at least) 64 / BITS_PER_KEY keys
+	idx_t word_count = NextPowerOfTwo(MaxValue<idx_t>(count * BITS_PER_KEY / 64, 1));
+	word_mask = word_count - 1;
+	if (data.GetSize() != word_count * sizeof(uint64_t)) {
+		data = allocator.Allocate(word_count * sizeof(uint64_t));
+	}
+	memset(data.get(), 0, data.GetSize());
+}
+
+void JoinBloomFilter::Insert(const hash_t hashes[], idx_t count) {
+	D_ASSERT(data.get());
+	auto words = (atomic<uint64_t> *)data.get();
+	for (idx_t i = 0; i < count; i++) {
+		const auto hash = hashes[i];
+		words[GetWord(hash)].fetch_or(GetMask(hash), std::memory_order_relaxed);
+	}
+}
+
+void JoinBloomFilter::SetReady() {
+	ready = true;
+}
+
+void JoinBloomFilter::Reset() {
+	ready = false;
+}
+
+idx_t JoinBloomFilter::Filter(Vector &hashes, const SelectionVector &sel, idx_t count, SelectionVector &result) const {
+	D_ASSERT(ready);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+
+	auto hash_data = (const hash_t *)hdata.data;
+	auto words = (const uint64_t *)data.get();
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		const auto hash = hash_data[hdata.sel->get_index(idx)];
+		const auto mask = GetMask(hash);
+		if ((words[GetWord(hash)] & mask) == mask) {
+			result.set_index(result_count++, idx);
+		}
+	}
+	return result_count;
+}
+
+} // namespace duckdb
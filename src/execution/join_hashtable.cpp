@@ -1,6 +1,8 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/column_data_collection_segment.hpp"
 #include "duckdb/common/types/row_data_collection.hpp"
@@ -19,8 +21,8 @@ using ProbeSpillLocalState = JoinHashTable::ProbeSpillLocalAppendState;
 JoinHashTable::JoinHashTable(BufferManager &buffer_manager, const vector<JoinCondition> &conditions,
                              vector<LogicalType> btypes, JoinType type)
     : buffer_manager(buffer_manager), conditions(conditions), build_types(move(btypes)), entry_size(0), tuple_size(0),
-      vfound(Value::BOOLEAN(false)), join_type(type), finalized(false), has_null(false), external(false), radix_bits(4),
-      tuples_per_round(0), partition_start(0), partition_end(0) {
+      vfound(Value::BOOLEAN(false)), join_type(type), finalized(false), has_null(false), partition_shift(0),
+      partition_mask(0), heavy_hitter_mask(0), heavy_hitter_offset(0), external(false), radix_bits(4), tuples_per_round(0), partition_start(0), partition_end(0) {
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
 		auto type = condition.left->return_type;
@@ -116,12 +118,12 @@ void JoinHashTable::ApplyBitmask(Vector &hashes, idx_t count) {
 	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
 		D_ASSERT(!ConstantVector::IsNull(hashes));
 		auto indices = ConstantVector::GetData<hash_t>(hashes);
-		*indices = *indices & bitmask;
+		*indices = GetPointerTableIndex(*indices);
 	} else {
 		hashes.Flatten(count);
 		auto indices = FlatVector::GetData<hash_t>(hashes);
 		for (idx_t i = 0; i < count; i++) {
-			indices[i] &= bitmask;
+			indices[i] = GetPointerTableIndex(indices[i]);
 		}
 	}
 }
@@ -137,7 +139,9 @@ void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx
 		auto rindex = sel.get_index(i);
 		auto hindex = hdata.sel->get_index(rindex);
 		auto hash = hash_data[hindex];
-		result_data[rindex] = main_ht + (hash & bitmask);
+		result_data[rindex] = main_ht + GetPointerTableIndex(hash);
+		// the bucket heads are loaded for the whole vector in InitializeSelectionVector, prefetch them now
+		DUCKDB_PREFETCH(result_data[rindex]);
 	}
 }
 
@@ -297,10 +301,11 @@ static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t
 			} while (!std::atomic_compare_exchange_weak(&pointers[index], &head, key_locations[i]));
 		} else {
 			// set prev in current key to the value (NOTE: this will be nullptr if there is none)
-			Store<data_ptr_t>(pointers[index], key_locations[i] + pointer_offset);
+			// no other thread writes to this entry, so we do not need any ordering guarantees
+			Store<data_ptr_t>(pointers[index].load(std::memory_order_relaxed), key_locations[i] + pointer_offset);
 
 			// set pointer to current tuple
-			pointers[index] = key_locations[i];
+			pointers[index].store(key_locations[i], std::memory_order_relaxed);
 		}
 	}
 }
@@ -330,15 +335,87 @@ void JoinHashTable::InitializePointerTable() {
 	// size needs to be a power of 2
 	D_ASSERT((capacity & (capacity - 1)) == 0);
 	bitmask = capacity - 1;
+	partition_shift = 0;
+	partition_mask = 0;
+	if (PartitionedBuild()) {
+		// the radix bits (the highest bits) of the hash select the sub-table of the partition,
+		// the lowest bits select the position within the sub-table
+		idx_t capacity_bits = 0;
+		while ((idx_t(1) << capacity_bits) < capacity) {
+			capacity_bits++;
+		}
+		D_ASSERT(capacity_bits > radix_bits);
+		const auto sub_table_bits = capacity_bits - radix_bits;
+		bitmask = (uint64_t(1) << sub_table_bits) - 1;
+		partition_shift = sizeof(hash_t) * 8 - capacity_bits;
+		partition_mask = (RadixPartitioning::NumberOfPartitions(radix_bits) - 1) << sub_table_bits;
+	}
+
+	DetectHeavyHitters(capacity);
 
-	if (!hash_map.get()) {
-		// allocate the HT if not yet done
-		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+	// the chains of the heavy hitters are stored after the buckets
+	const auto entry_count = capacity + HEAVY_HITTER_SLOTS;
+	if (hash_map.GetSize() != entry_count * sizeof(data_ptr_t)) {
+		// allocate the HT if not yet done, or if a partition of this round is larger than tuples_per_round
+		hash_map = buffer_manager.GetBufferAllocator().Allocate(entry_count * sizeof(data_ptr_t));
 	}
-	D_ASSERT(hash_map.GetSize() == capacity * sizeof(data_ptr_t));
+	D_ASSERT(hash_map.GetSize() == entry_count * sizeof(data_ptr_t));
 
 	// initialize HT with all-zero entries
-	memset(hash_map.get(), 0, capacity * sizeof(data_ptr_t));
+	memset(hash_map.get(), 0, entry_count * sizeof(data_ptr_t));
+}
+
+void JoinHashTable::DetectHeavyHitters(idx_t capacity) {
+	heavy_hitter_mask = 0;
+	heavy_hitter_offset = capacity;
+	const auto count = Count();
+	if (count < HEAVY_HITTER_MIN_COUNT) {
+		return;
+	}
+
+	// sample the hashes (stored where the pointers will go) at a fixed stride over all blocks
+	vector<hash_t> sample;
+	sample.reserve(HEAVY_HITTER_SAMPLE_SIZE + 1);
+	const idx_t stride = count / HEAVY_HITTER_SAMPLE_SIZE;
+	idx_t entry = 0;
+	for (auto &block : block_collection->blocks) {
+		auto handle = buffer_manager.Pin(block->block);
+		auto dataptr = handle.Ptr();
+		for (; entry < block->count; entry += stride) {
+			sample.push_back(Load<hash_t>(dataptr + entry * entry_size + pointer_offset));
+		}
+		entry -= block->count;
+	}
+
+	// find the hashes that occur often in the sample
+	std::sort(sample.begin(), sample.end());
+	vector<pair<idx_t, hash_t>> candidates;
+	for (idx_t i = 0; i < sample.size();) {
+		idx_t run_end = i + 1;
+		while (run_end < sample.size() && sample[run_end] == sample[i]) {
+			run_end++;
+		}
+		if (run_end - i >= HEAVY_HITTER_THRESHOLD) {
+			candidates.emplace_back(run_end - i, sample[i]);
+		}
+		i = run_end;
+	}
+	if (candidates.empty()) {
+		return;
+	}
+
+	// the most frequent hashes get a slot first, a hash that collides with an earlier slot stays in its bucket
+	std::sort(candidates.begin(), candidates.end(), std::greater<pair<idx_t, hash_t>>());
+	heavy_hitters.resize(HEAVY_HITTER_SLOTS);
+	for (auto &candidate : candidates) {
+		const auto hash = candidate.second;
+		const auto slot = (hash >> HEAVY_HITTER_SHIFT) & (HEAVY_HITTER_SLOTS - 1);
+		if ((heavy_hitter_mask >> slot) & 1) {
+			continue;
+		}
+		heavy_hitters[slot] = hash;
+		heavy_hitter_mask |= uint64_t(1) << slot;
+	}
 }
 
 void JoinHashTable::Finalize(idx_t block_idx_start, idx_t block_idx_end, bool parallel) {
@@ -366,6 +443,9 @@ void JoinHashTable::Finalize(idx_t block_idx_start, idx_t block_idx_end, bool pa
 				key_locations[i] = dataptr;
 				dataptr += entry_size;
 			}
+			if (bloom_filter) {
+				bloom_filter->Insert(hash_data, next);
+			}
 			// now insert into the hash table
 			InsertHashes(hashes, next, key_locations, parallel);
 
@@ -498,6 +578,7 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count)
 		auto idx = sel.get_index(i);
 		ptrs[idx] = Load<data_ptr_t>(ptrs[idx] + ht.pointer_offset);
 		if (ptrs[idx]) {
+			DUCKDB_PREFETCH(ptrs[idx]);
 			this->sel_vector.set_index(new_count++, idx);
 		}
 	}
@@ -512,6 +593,8 @@ void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_se
 		const auto idx = current_sel->get_index(i);
 		ptrs[idx] = Load<data_ptr_t>(ptrs[idx]);
 		if (ptrs[idx]) {
+			// the keys of the first entry in the chain are compared for the whole vector next, prefetch them
+			DUCKDB_PREFETCH(ptrs[idx]);
 			sel_vector.set_index(non_empty_count++, idx);
 		}
 	}
@@ -1082,6 +1165,47 @@ void JoinHashTable::Partition(JoinHashTable &global_ht) {
 	global_ht.Merge(*this);
 }
 
+bool JoinHashTable::PreparePartitionedBuild(ClientConfig &config, idx_t count) {
+	if (count < PARTITIONED_BUILD_THRESHOLD && !config.force_partitioned_join_build) {
+		return false;
+	}
+	// choose the number of radix bits such that the sub-table of each partition fits in the cache
+	radix_bits = 4;
+	const auto capacity = PointerTableCapacity(count);
+	while (radix_bits < 8 &&
+	       capacity / RadixPartitioning::NumberOfPartitions(radix_bits) > PARTITIONED_BUILD_SUB_TABLE_CAPACITY) {
+		radix_bits++;
+	}
+	return true;
+}
+
+void JoinHashTable::PreparePartitionedFinalize() {
+	D_ASSERT(!external);
+	D_ASSERT(Count() == 0 && SwizzledCount() == 0);
+	if (partition_block_collections.empty()) {
+		// nothing was partitioned
+		return;
+	}
+
+	// Move all partitions to the swizzled_... collections, keeping track of where each partition starts
+	const idx_t num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	D_ASSERT(partition_block_collections.size() == num_partitions);
+	partition_block_offsets.reserve(num_partitions + 1);
+	for (idx_t p = 0; p < num_partitions; p++) {
+		partition_block_offsets.push_back(swizzled_block_collection->blocks.size());
+		if (!layout.AllConstant()) {
+			swizzled_string_heap->Merge(*partition_string_heaps[p]);
+		}
+		swizzled_block_collection->Merge(*partition_block_collections[p]);
+	}
+	partition_block_offsets.push_back(swizzled_block_collection->blocks.size());
+	partition_block_collections.clear();
+	partition_string_heaps.clear();
+
+	// Unswizzle them, this keeps the order of the blocks intact
+	UnswizzleBlocks();
+}
+
 void JoinHashTable::Reset() {
 	pinned_handles.clear();
 	block_collection->Clear();
@@ -1089,9 +1213,15 @@ void JoinHashTable::Reset() {
 	finalized = false;
 }
 
+static bool CanBuildPartitionInParts(JoinType join_type) {
+	// the probe side is probed against every part of the partition, so we can only do this
+	// if we do not need to keep track of which probe-side tuples found a match
+	return join_type == JoinType::INNER || join_type == JoinType::RIGHT;
+}
+
 bool JoinHashTable::PrepareExternalFinalize() {
 	idx_t num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
-	if (partition_block_collections.empty() || partition_end == num_partitions) {
+	if (partition_block_collections.empty() || (partition_end == num_partitions && !PartitionIncomplete())) {
 		return false;
 	}
 
@@ -1100,9 +1230,10 @@ bool JoinHashTable::PrepareExternalFinalize() {
 	}
 
 	// Determine how many partitions we can do next (at least one)
+	// If the last partition of the previous round was not built entirely, we continue with the rest of it
 	idx_t next = 0;
 	idx_t count = 0;
-	partition_start = partition_end;
+	partition_start = PartitionIncomplete() ? partition_end - 1 : partition_end;
 	for (idx_t p = partition_start; p < num_partitions; p++) {
 		auto partition_count = partition_block_collections[p]->count;
 		if (partition_count != 0 && count != 0 && count + partition_count > tuples_per_round) {
@@ -1112,13 +1243,24 @@ bool JoinHashTable::PrepareExternalFinalize() {
 		}
 		next++;
 		count += partition_count;
+		if (count > tuples_per_round && CanBuildPartitionInParts(join_type)) {
+			// This partition is too large by itself, it is built in multiple parts
+			break;
+		}
 	}
-	partition_end += next;
+	partition_end = partition_start + next;
+	const bool build_in_parts = count > tuples_per_round && CanBuildPartitionInParts(join_type);
 
 	// Move specific partitions to the swizzled_... collections so they can be unswizzled
 	D_ASSERT(SwizzledCount() == 0);
 	for (idx_t p = partition_start; p < partition_end; p++) {
 		auto &p_block_collection = *partition_block_collections[p];
+		if (build_in_parts && p == partition_end - 1) {
+			// Move only as many blocks of the last partition as fit in this round
+			count -= p_block_collection.count;
+			count += MovePartitionBlocks(p, tuples_per_round);
+			break;
+		}
 		if (!layout.AllConstant()) {
 			auto &p_string_heap = *partition_string_heaps[p];
 			D_ASSERT(p_block_collection.count == p_string_heap.count);
@@ -1140,6 +1282,51 @@ bool JoinHashTable::PrepareExternalFinalize() {
 	return true;
 }
 
+idx_t JoinHashTable::MovePartitionBlocks(idx_t partition_idx, idx_t max_count) {
+	auto &p_block_collection = *partition_block_collections[partition_idx];
+	auto &blocks = p_block_collection.blocks;
+
+	// Determine how many blocks we can move (at least one)
+	idx_t block_count = 0;
+	idx_t count = 0;
+	for (; block_count < blocks.size(); block_count++) {
+		if (block_count != 0 && count + blocks[block_count]->count > max_count) {
+			break;
+		}
+		count += blocks[block_count]->count;
+	}
+	if (block_count == blocks.size()) {
+		// Everything fits after all
+		if (!layout.AllConstant()) {
+			swizzled_string_heap->Merge(*partition_string_heaps[partition_idx]);
+			partition_string_heaps[partition_idx] = nullptr;
+		}
+		swizzled_block_collection->Merge(p_block_collection);
+		partition_block_collections[partition_idx] = nullptr;
+		return count;
+	}
+
+	// Blocks of the string heap match the blocks of the (swizzled) data one-to-one
+	if (!layout.AllConstant()) {
+		auto &p_string_heap = *partition_string_heaps[partition_idx];
+		auto &heap_blocks = p_string_heap.blocks;
+		D_ASSERT(heap_blocks.size() == blocks.size());
+		for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+			swizzled_string_heap->blocks.push_back(move(heap_blocks[block_idx]));
+		}
+		heap_blocks.erase(heap_blocks.begin(), heap_blocks.begin() + block_count);
+		swizzled_string_heap->count += count;
+		p_string_heap.count -= count;
+	}
+	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+		swizzled_block_collection->blocks.push_back(move(blocks[block_idx]));
+	}
+	blocks.erase(blocks.begin(), blocks.begin() + block_count);
+	swizzled_block_collection->count += count;
+	p_block_collection.count -= count;
+	return count;
+}
+
 static void CreateSpillChunk(DataChunk &spill_chunk, DataChunk &keys, DataChunk &payload, Vector &hashes) {
 	spill_chunk.Reset();
 	idx_t spill_col_idx = 0;
@@ -1173,7 +1360,17 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, DataChun
 	CreateSpillChunk(spill_chunk, keys, payload, hashes);
 
 	// can't probe these values right now, append to spill
-	spill_chunk.Slice(false_sel, false_count);
+	if (PartitionIncomplete()) {
+		// we probe the last partition again in the next round, so we spill its values as well
+		SelectionVector spill_sel;
+		spill_sel.Initialize();
+		auto spill_count = keys.size() - RadixPartitioning::Select(hashes, FlatVector::IncrementalSelectionVector(),
+		                                                           keys.size(), radix_bits, partition_end - 1,
+		                                                           nullptr, &spill_sel);
+		spill_chunk.Slice(spill_sel, spill_count);
+	} else {
+		spill_chunk.Slice(false_sel, false_count);
+	}
 	spill_chunk.Verify();
 	probe_spill.Append(spill_chunk, spill_state);
 
@@ -1277,6 +1474,15 @@ void ProbeSpill::PrepareNextProbe() {
 			// Can't probe, just make an empty one
 			global_spill_collection =
 			    make_unique<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
+		} else if (ht.PartitionIncomplete()) {
+			// The last partition is probed again in the next round, so we scan it without consuming it
+			// The other partitions of this round are empty on the build side, their probe data can be thrown away
+			for (idx_t i = ht.partition_start; i + 1 < ht.partition_end; i++) {
+				partitions[i] = nullptr;
+			}
+			consumer = make_unique<ColumnDataConsumer>(*partitions[ht.partition_end - 1], column_ids, false);
+			consumer->InitializeScan();
+			return;
 		} else {
 			// Move specific partitions to the global spill collection
 			global_spill_collection = move(partitions[ht.partition_start]);
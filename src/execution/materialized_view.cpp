@@ -0,0 +1,542 @@
+#include "duckdb/execution/materialized_view.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/execution/column_binding_resolver.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/planner.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/transaction.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+struct MaterializedViewData::SinkState {
+	vector<unique_ptr<ExpressionExecutor>> step_executors;
+	vector<unique_ptr<DataChunk>> step_chunks;
+	SelectionVector sel;
+	unique_ptr<ExpressionExecutor> group_executor;
+	unique_ptr<ExpressionExecutor> payload_executor;
+	DataChunk group_chunk;
+	DataChunk payload_chunk;
+	//! The aggregates that are updated
+	vector<idx_t> filter;
+};
+
+MaterializedViewData::~MaterializedViewData() {
+}
+
+static void VerifyExpression(const Expression &expr) {
+	if (expr.expression_class == ExpressionClass::BOUND_FUNCTION) {
+		auto &function = (const BoundFunctionExpression &)expr;
+		if (function.function.side_effects == FunctionSideEffects::HAS_SIDE_EFFECTS) {
+			throw BinderException("Materialized views cannot contain functions with side effects (\"%s\")",
+			                      function.function.name);
+		}
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) { VerifyExpression(child); });
+}
+
+static void VerifyExpressions(const vector<unique_ptr<Expression>> &expressions) {
+	for (auto &expr : expressions) {
+		VerifyExpression(*expr);
+	}
+}
+
+//! Extracts the filter or projection, throws if the operator is neither
+static void ExtractStep(LogicalOperator &op, vector<unique_ptr<Expression>> &expressions, bool &is_filter) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_FILTER: {
+		D_ASSERT(!op.expressions.empty());
+		is_filter = true;
+		if (op.expressions.size() == 1) {
+			expressions.push_back(move(op.expressions[0]));
+			break;
+		}
+		auto conjunction = make_unique<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND);
+		conjunction->children = move(op.expressions);
+		expressions.push_back(move(conjunction));
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION:
+		is_filter = false;
+		expressions = move(op.expressions);
+		break;
+	default:
+		throw BinderException("Materialized views must be of the form SELECT ... FROM tbl [WHERE ...] GROUP BY ... "
+		                      "[HAVING ...]: %s is not supported",
+		                      LogicalOperatorToString(op.type));
+	}
+	VerifyExpressions(expressions);
+}
+
+shared_ptr<MaterializedViewData> MaterializedViewData::Bind(ClientContext &context, SelectStatement &query) {
+	Planner planner(context);
+	planner.CreatePlan(query.Copy());
+	auto plan = move(planner.plan);
+	// resolve the column bindings into references to the columns of the child of each operator
+	ColumnBindingResolver resolver;
+	resolver.VisitOperator(*plan);
+	plan->ResolveOperatorTypes();
+
+	auto result = shared_ptr<MaterializedViewData>(new MaterializedViewData());
+	result->types = plan->types;
+	// the filters (HAVING) and projections on top of the aggregate
+	auto op = plan.get();
+	while (op->type != LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		MaterializedViewStep step;
+		ExtractStep(*op, step.expressions, step.is_filter);
+		step.types = op->types;
+		result->output_steps.push_back(move(step));
+		op = op->children[0].get();
+	}
+	std::reverse(result->output_steps.begin(), result->output_steps.end());
+
+	auto &aggregate = (LogicalAggregate &)*op;
+	if (aggregate.grouping_sets.size() > 1 || !aggregate.grouping_functions.empty()) {
+		throw BinderException("Materialized views do not support GROUPING SETS, ROLLUP or CUBE");
+	}
+	VerifyExpressions(aggregate.groups);
+	for (auto &group : aggregate.groups) {
+		result->group_types.push_back(group->return_type);
+		result->groups.push_back(move(group));
+	}
+	if (result->groups.empty()) {
+		// an ungrouped aggregate is computed as a single (constant) group
+		result->group_types.push_back(LogicalType::BOOLEAN);
+	}
+	for (auto &expr : aggregate.expressions) {
+		D_ASSERT(expr->expression_class == ExpressionClass::BOUND_AGGREGATE);
+		auto &aggr = (BoundAggregateExpression &)*expr;
+		if (aggr.IsDistinct() || aggr.filter) {
+			throw BinderException("Materialized views do not support DISTINCT or FILTER in aggregates");
+		}
+		VerifyExpressions(aggr.children);
+		for (auto &child : aggr.children) {
+			result->payload_types.push_back(child->return_type);
+			result->payload_expressions.push_back(child->Copy());
+		}
+		result->aggregates.push_back(move(expr));
+	}
+
+	// the filters and projections between the scan and the aggregate
+	op = op->children[0].get();
+	while (op->type != LogicalOperatorType::LOGICAL_GET) {
+		MaterializedViewStep step;
+		ExtractStep(*op, step.expressions, step.is_filter);
+		step.types = op->types;
+		result->input_steps.push_back(move(step));
+		op = op->children[0].get();
+	}
+	std::reverse(result->input_steps.begin(), result->input_steps.end());
+
+	auto &get = (LogicalGet &)*op;
+	auto table = TableScanFunction::GetTableEntry(get.function, get.bind_data.get());
+	if (!table) {
+		throw BinderException("Materialized views can only be computed from a base table");
+	}
+	result->storage = table->storage;
+	result->table_info = table->storage->info;
+	result->column_ids = get.column_ids;
+	if (result->column_ids.empty()) {
+		// no columns are referenced (e.g. COUNT(*)): scan the first column to get the row count
+		result->column_ids.push_back(0);
+	}
+	for (auto &column_id : result->column_ids) {
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			throw BinderException("Materialized views cannot reference the rowid");
+		}
+		result->scan_types.push_back(table->storage->column_definitions[column_id].Type());
+	}
+	return result;
+}
+
+shared_ptr<MaterializedViewData> MaterializedViewData::Get(ClientContext &context, ViewCatalogEntry &view) {
+	D_ASSERT(view.materialized);
+	lock_guard<mutex> view_lock(view.materialized_lock);
+	// bind the query to find the table it reads from the catalog
+	auto data = Bind(context, *view.query);
+	if (data->types != view.types) {
+		throw BinderException("Contents of view were altered: types don't match!");
+	}
+	if (view.materialized_data) {
+		auto current_storage = view.materialized_data->storage.lock();
+		if (current_storage && current_storage == data->storage.lock()) {
+			return view.materialized_data;
+		}
+	}
+	// the view was not used yet, or its table was altered or re-created: maintain the view from the current table
+	auto info = data->table_info.lock();
+	D_ASSERT(info);
+	{
+		lock_guard<mutex> info_lock(info->materialized_views_lock);
+		info->materialized_views.push_back(data);
+	}
+	view.materialized_data = data;
+	return data;
+}
+
+static void InitializeSteps(ClientContext &context, vector<MaterializedViewData::MaterializedViewStep> &steps,
+                            vector<unique_ptr<ExpressionExecutor>> &executors, vector<unique_ptr<DataChunk>> &chunks) {
+	auto &allocator = Allocator::Get(context);
+	for (auto &step : steps) {
+		executors.push_back(make_unique<ExpressionExecutor>(context, step.expressions));
+		auto chunk = make_unique<DataChunk>();
+		if (!step.is_filter) {
+			chunk->Initialize(allocator, step.types);
+		}
+		chunks.push_back(move(chunk));
+	}
+}
+
+//! Applies the filters and projections to the input, returns nullptr if all rows are filtered out
+static DataChunk *ExecuteSteps(vector<MaterializedViewData::MaterializedViewStep> &steps,
+                               vector<unique_ptr<ExpressionExecutor>> &executors,
+                               vector<unique_ptr<DataChunk>> &chunks, SelectionVector &sel, DataChunk &input) {
+	auto current = &input;
+	for (idx_t i = 0; i < steps.size(); i++) {
+		if (steps[i].is_filter) {
+			auto count = executors[i]->SelectExpression(*current, sel);
+			if (count == 0) {
+				return nullptr;
+			}
+			if (count < current->size()) {
+				current->Slice(sel, count);
+			}
+		} else {
+			auto &chunk = *chunks[i];
+			chunk.Reset();
+			executors[i]->Execute(*current, chunk);
+			current = &chunk;
+		}
+	}
+	return current;
+}
+
+void MaterializedViewData::InitializeSink(ClientContext &context, SinkState &state) {
+	auto &allocator = Allocator::Get(context);
+	InitializeSteps(context, input_steps, state.step_executors, state.step_chunks);
+	state.sel.Initialize(STANDARD_VECTOR_SIZE);
+	state.group_chunk.Initialize(allocator, group_types);
+	if (!groups.empty()) {
+		state.group_executor = make_unique<ExpressionExecutor>(context, groups);
+	}
+	if (!payload_expressions.empty()) {
+		state.payload_chunk.Initialize(allocator, payload_types);
+		state.payload_executor = make_unique<ExpressionExecutor>(context, payload_expressions);
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		state.filter.push_back(i);
+	}
+}
+
+void MaterializedViewData::Sink(SinkState &state, DataChunk &input, GroupedAggregateHashTable &target) {
+	auto chunk = ExecuteSteps(input_steps, state.step_executors, state.step_chunks, state.sel, input);
+	if (!chunk) {
+		return;
+	}
+	state.group_chunk.Reset();
+	if (state.group_executor) {
+		state.group_executor->Execute(*chunk, state.group_chunk);
+	} else {
+		state.group_chunk.data[0].Reference(Value::BOOLEAN(true));
+		state.group_chunk.SetCardinality(*chunk);
+	}
+	state.payload_chunk.Reset();
+	if (state.payload_executor) {
+		state.payload_executor->Execute(*chunk, state.payload_chunk);
+	} else {
+		state.payload_chunk.SetCardinality(*chunk);
+	}
+	target.AddChunk(state.group_chunk, state.payload_chunk, state.filter);
+}
+
+unique_ptr<GroupedAggregateHashTable> MaterializedViewData::CreateHashTable(ClientContext &context) {
+	vector<BoundAggregateExpression *> bindings;
+	for (auto &aggregate : aggregates) {
+		bindings.push_back((BoundAggregateExpression *)aggregate.get());
+	}
+	auto &allocator = Allocator::Get(context);
+	auto result = make_unique<GroupedAggregateHashTable>(context, allocator, group_types, payload_types, bindings);
+	if (groups.empty()) {
+		// an ungrouped aggregate has a result row even if the table is empty
+		DataChunk group_chunk;
+		group_chunk.Initialize(allocator, group_types);
+		group_chunk.SetValue(0, 0, Value::BOOLEAN(true));
+		group_chunk.SetCardinality(1);
+		Vector addresses(LogicalType::POINTER);
+		result->FindOrCreateGroups(group_chunk, addresses);
+	}
+	return result;
+}
+
+unique_ptr<GroupedAggregateHashTable> MaterializedViewData::ComputeStates(ClientContext &context,
+                                                                          Transaction &transaction) {
+	auto table = storage.lock();
+	if (!table) {
+		throw CatalogException("The table of the materialized view was dropped");
+	}
+	auto result = CreateHashTable(context);
+	SinkState state;
+	InitializeSink(context, state);
+
+	TableScanState scan_state;
+	table->InitializeScan(transaction, scan_state, column_ids);
+	DataChunk chunk;
+	chunk.Initialize(Allocator::Get(context), scan_types);
+	while (true) {
+		chunk.Reset();
+		table->Scan(transaction, chunk, scan_state);
+		if (chunk.size() == 0) {
+			break;
+		}
+		Sink(state, chunk, *result);
+	}
+	return result;
+}
+
+void MaterializedViewData::ApplyAppends(ClientContext &context, const vector<AppendedRows> &appended) {
+	auto table = storage.lock();
+	if (!table) {
+		throw CatalogException("The table of the materialized view was dropped");
+	}
+	// aggregate the appended rows into a separate hash table, and combine it into the states of the view
+	auto delta = CreateHashTable(context);
+	SinkState state;
+	InitializeSink(context, state);
+
+	DataChunk chunk;
+	chunk.InitializeEmpty(scan_types);
+	for (auto &append : appended) {
+		table->ScanTableSegment(append.row_start, append.count, [&](DataChunk &table_chunk) {
+			for (idx_t i = 0; i < column_ids.size(); i++) {
+				chunk.data[i].Reference(table_chunk.data[column_ids[i]]);
+			}
+			chunk.SetCardinality(table_chunk);
+			Sink(state, chunk, *delta);
+		});
+	}
+	ht->Combine(*delta);
+}
+
+shared_ptr<ColumnDataCollection> MaterializedViewData::ComputeResult(ClientContext &context,
+                                                                     GroupedAggregateHashTable &states) {
+	auto &allocator = Allocator::Get(context);
+	auto collection = make_shared<ColumnDataCollection>(BufferManager::GetBufferManager(context), types);
+	ColumnDataAppendState append_state;
+	collection->InitializeAppend(append_state);
+
+	vector<unique_ptr<ExpressionExecutor>> executors;
+	vector<unique_ptr<DataChunk>> chunks;
+	InitializeSteps(context, output_steps, executors, chunks);
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+
+	// the hash table contains the groups followed by the aggregates
+	vector<LogicalType> ht_types = group_types;
+	vector<LogicalType> aggregate_types = groups.empty() ? vector<LogicalType>() : group_types;
+	for (auto &aggregate : aggregates) {
+		ht_types.push_back(aggregate->return_type);
+		aggregate_types.push_back(aggregate->return_type);
+	}
+	idx_t column_offset = ht_types.size() - aggregate_types.size();
+	DataChunk ht_chunk;
+	ht_chunk.Initialize(allocator, ht_types);
+	DataChunk aggregate_chunk;
+	aggregate_chunk.InitializeEmpty(aggregate_types);
+
+	AggregateHTScanState scan_state;
+	while (true) {
+		ht_chunk.Reset();
+		states.Scan(scan_state, ht_chunk);
+		if (ht_chunk.size() == 0) {
+			break;
+		}
+		for (idx_t i = 0; i < aggregate_chunk.ColumnCount(); i++) {
+			aggregate_chunk.data[i].Reference(ht_chunk.data[column_offset + i]);
+		}
+		aggregate_chunk.SetCardinality(ht_chunk);
+		auto chunk = ExecuteSteps(output_steps, executors, chunks, sel, aggregate_chunk);
+		if (chunk) {
+			collection->Append(append_state, *chunk);
+		}
+	}
+	return collection;
+}
+
+shared_ptr<ColumnDataCollection> MaterializedViewData::GetResult(ClientContext &context) {
+	auto &transaction = Transaction::GetTransaction(context);
+	lock_guard<mutex> glock(lock);
+	if (transaction.ChangesMade()) {
+		// the transaction could have changed the table itself
+		auto states = ComputeStates(context, transaction);
+		return ComputeResult(context, *states);
+	}
+	auto start_time = transaction.start_time;
+	bool recompute;
+	vector<AppendedRows> appended;
+	{
+		lock_guard<mutex> alock(append_lock);
+		recompute = stale || state_time > start_time;
+		if (!recompute) {
+			for (auto &append : appends) {
+				if (append.commit_id < start_time) {
+					appended.push_back(append);
+				}
+			}
+		}
+	}
+	if (recompute) {
+		auto states = ComputeStates(context, transaction);
+		{
+			lock_guard<mutex> alock(append_lock);
+			// only replace the states of the view if the transaction sees all deletes and updates of the table
+			recompute = stale && stale_commit_id < start_time;
+			if (recompute) {
+				stale = false;
+				state_time = start_time;
+				auto remaining = move(appends);
+				for (auto &append : remaining) {
+					if (append.commit_id >= start_time) {
+						appends.push_back(append);
+					}
+				}
+			}
+		}
+		if (!recompute) {
+			return ComputeResult(context, *states);
+		}
+		ht = move(states);
+		result.reset();
+	} else if (!appended.empty()) {
+		try {
+			ApplyAppends(context, appended);
+		} catch (...) {
+			lock_guard<mutex> alock(append_lock);
+			stale = true;
+			throw;
+		}
+		result.reset();
+		lock_guard<mutex> alock(append_lock);
+		auto remaining = move(appends);
+		for (auto &append : remaining) {
+			if (append.commit_id >= start_time) {
+				appends.push_back(append);
+			}
+		}
+		state_time = start_time;
+	} else {
+		lock_guard<mutex> alock(append_lock);
+		if (!stale) {
+			state_time = start_time;
+		}
+	}
+	if (!result) {
+		result = ComputeResult(context, *ht);
+	}
+	return result;
+}
+
+void MaterializedViewData::CommitAppend(DataTableInfo &info, transaction_t commit_id, idx_t row_start, idx_t count) {
+	lock_guard<mutex> info_lock(info.materialized_views_lock);
+	for (idx_t i = 0; i < info.materialized_views.size(); i++) {
+		auto view = info.materialized_views[i].lock();
+		if (!view) {
+			// the view was dropped
+			info.materialized_views.erase(info.materialized_views.begin() + i);
+			i--;
+			continue;
+		}
+		lock_guard<mutex> alock(view->append_lock);
+		view->appends.push_back(AppendedRows {commit_id, row_start, count});
+	}
+}
+
+void MaterializedViewData::RevertAppend(DataTableInfo &info, idx_t row_start, idx_t count) {
+	lock_guard<mutex> info_lock(info.materialized_views_lock);
+	for (auto &entry : info.materialized_views) {
+		auto view = entry.lock();
+		if (!view) {
+			continue;
+		}
+		lock_guard<mutex> alock(view->append_lock);
+		auto remaining = move(view->appends);
+		for (auto &append : remaining) {
+			if (append.row_start != row_start || append.count != count) {
+				view->appends.push_back(append);
+			}
+		}
+	}
+}
+
+void MaterializedViewData::Invalidate(DataTableInfo &info, transaction_t commit_id) {
+	lock_guard<mutex> info_lock(info.materialized_views_lock);
+	for (auto &entry : info.materialized_views) {
+		auto view = entry.lock();
+		if (!view) {
+			continue;
+		}
+		lock_guard<mutex> alock(view->append_lock);
+		view->stale = true;
+		view->stale_commit_id = MaxValue<transaction_t>(view->stale_commit_id, commit_id);
+	}
+}
+
+struct MaterializedViewScanData : public TableFunctionData {
+	explicit MaterializedViewScanData(shared_ptr<MaterializedViewData> view_p) : view(move(view_p)) {
+	}
+
+	shared_ptr<MaterializedViewData> view;
+
+public:
+	unique_ptr<FunctionData> Copy() const override {
+		return make_unique<MaterializedViewScanData>(view);
+	}
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = (const MaterializedViewScanData &)other_p;
+		return view == other.view;
+	}
+};
+
+struct MaterializedViewScanState : public GlobalTableFunctionState {
+	shared_ptr<ColumnDataCollection> result;
+	ColumnDataScanState scan_state;
+};
+
+static unique_ptr<GlobalTableFunctionState> MaterializedViewScanInit(ClientContext &context,
+                                                                     TableFunctionInitInput &input) {
+	auto &bind_data = (MaterializedViewScanData &)*input.bind_data;
+	auto result = make_unique<MaterializedViewScanState>();
+	result->result = bind_data.view->GetResult(context);
+	result->result->InitializeScan(result->scan_state);
+	return move(result);
+}
+
+static void MaterializedViewScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = (MaterializedViewScanState &)*data_p.global_state;
+	state.result->Scan(state.scan_state, output);
+}
+
+TableFunction MaterializedViewData::GetScanFunction() {
+	return TableFunction("materialized_view_scan", {}, MaterializedViewScanFunction, nullptr,
+	                     MaterializedViewScanInit);
+}
+
+unique_ptr<FunctionData> MaterializedViewData::GetScanData(shared_ptr<MaterializedViewData> view) {
+	return make_unique<MaterializedViewScanData>(move(view));
+}
+
+} // namespace duckdb
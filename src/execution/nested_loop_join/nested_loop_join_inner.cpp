@@ -14,6 +14,25 @@ struct ComparisonOperationWrapper {
 	}
 };
 
+//! Compares the LHS values [lpos, lpos + count) of a flat vector without NULL values against a single RHS value
+//! The comparisons are computed in a separate loop without branches, which the compiler can vectorize for fixed-width
+//! types, after which the matches are written to the selection vectors without branching on the comparison result
+template <class T, class OP>
+static idx_t CompareFlatNoNulls(const T *__restrict ldata, const T &rvalue, idx_t lpos, idx_t count, idx_t rpos,
+                                SelectionVector &lvector, SelectionVector &rvector, idx_t result_count) {
+	D_ASSERT(result_count + count <= STANDARD_VECTOR_SIZE);
+	bool matches[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < count; i++) {
+		matches[i] = OP::Operation(ldata[lpos + i], rvalue, false, false);
+	}
+	for (idx_t i = 0; i < count; i++) {
+		lvector.set_index(result_count, lpos + i);
+		rvector.set_index(result_count, rpos);
+		result_count += matches[i];
+	}
+	return result_count;
+}
+
 struct InitialNestedLoopJoin {
 	template <class T, class OP>
 	static idx_t Operation(Vector &left, Vector &right, idx_t left_size, idx_t right_size, idx_t &lpos, idx_t &rpos,
@@ -27,6 +46,24 @@ struct InitialNestedLoopJoin {
 		auto ldata = (T *)left_data.data;
 		auto rdata = (T *)right_data.data;
 		idx_t result_count = 0;
+		if (!left_data.sel->data() && left_data.validity.AllValid() && right_data.validity.AllValid()) {
+			// flat LHS without NULL values: compare blocks of the LHS against each RHS value
+			for (; rpos < right_size; rpos++) {
+				auto rvalue = rdata[right_data.sel->get_index(rpos)];
+				while (lpos < left_size) {
+					if (result_count == STANDARD_VECTOR_SIZE) {
+						// out of space!
+						return result_count;
+					}
+					auto count = MinValue<idx_t>(left_size - lpos, STANDARD_VECTOR_SIZE - result_count);
+					result_count =
+					    CompareFlatNoNulls<T, OP>(ldata, rvalue, lpos, count, rpos, lvector, rvector, result_count);
+					lpos += count;
+				}
+				lpos = 0;
+			}
+			return result_count;
+		}
 		for (; rpos < right_size; rpos++) {
 			idx_t right_position = right_data.sel->get_index(rpos);
 			bool right_is_valid = right_data.validity.RowIsValid(right_position);
@@ -65,6 +102,21 @@ struct RefineNestedLoopJoin {
 		auto ldata = (T *)left_data.data;
 		auto rdata = (T *)right_data.data;
 		idx_t result_count = 0;
+		if (left_data.validity.AllValid() && right_data.validity.AllValid()) {
+			// no NULL values: write every candidate and only advance the result on a match (the selection vectors are
+			// refined in-place, result_count never exceeds i)
+			for (idx_t i = 0; i < current_match_count; i++) {
+				auto lidx = lvector.get_index(i);
+				auto ridx = rvector.get_index(i);
+				auto left_idx = left_data.sel->get_index(lidx);
+				auto right_idx = right_data.sel->get_index(ridx);
+				auto match = OP::Operation(ldata[left_idx], rdata[right_idx], false, false);
+				lvector.set_index(result_count, lidx);
+				rvector.set_index(result_count, ridx);
+				result_count += match;
+			}
+			return result_count;
+		}
 		for (idx_t i = 0; i < current_match_count; i++) {
 			auto lidx = lvector.get_index(i);
 			auto ridx = rvector.get_index(i);
@@ -53,6 +53,8 @@ DistinctAggregateState::DistinctAggregateState(const DistinctAggregateData &data
 		// Get the global sinkstate for the aggregate
 		auto &radix_table = *data.radix_tables[table_idx];
 		radix_states[table_idx] = radix_table.GetGlobalSinkState(client);
+		// the distinct table is scanned exactly once, to feed its data into the aggregates
+		RadixPartitionedHashTable::SetSingleScan(*radix_states[table_idx]);
 
 		// Fill the chunk_types (group_by + children)
 		vector<LogicalType> chunk_types;
@@ -547,29 +547,32 @@ public:
 			aggregate_input_chunk.Initialize(context, gstate.payload_types);
 		}
 
-		idx_t payload_idx;
-		idx_t next_payload_idx = 0;
-
-		for (idx_t i = 0; i < op.grouped_aggregate_data.aggregates.size(); i++) {
-			auto &aggregate = (BoundAggregateExpression &)*aggregates[i];
-
-			// Forward the payload idx
-			payload_idx = next_payload_idx;
-			next_payload_idx = payload_idx + aggregate.children.size();
-
-			// If aggregate is not distinct, skip it
-			if (!data.IsDistinct(i)) {
+		for (idx_t table_idx = 0; table_idx < data.radix_tables.size(); table_idx++) {
+			auto &radix_table_p = data.radix_tables[table_idx];
+			if (!radix_table_p) {
 				continue;
 			}
-			D_ASSERT(data.info.table_map.count(i));
-			auto table_idx = data.info.table_map.at(i);
-			auto &radix_table_p = data.radix_tables[table_idx];
+			// Find all the aggregates that share this table, so we only have to scan it once
+			vector<idx_t> table_aggregates;
+			vector<idx_t> payload_indices;
+			idx_t payload_idx = 0;
+			for (idx_t i = 0; i < aggregates.size(); i++) {
+				auto &aggregate = (BoundAggregateExpression &)*aggregates[i];
+				if (data.IsDistinct(i) && data.info.table_map.at(i) == table_idx) {
+					table_aggregates.push_back(i);
+					payload_indices.push_back(payload_idx);
+				}
+				payload_idx += aggregate.children.size();
+			}
+			D_ASSERT(!table_aggregates.empty());
+			auto &grouped_aggregate_data = *data.grouped_aggregate_data[table_idx];
+			const idx_t child_count = grouped_aggregate_data.groups.size() - group_by_size;
 
 			// Create a duplicate of the output_chunk, because of multi-threading we cant alter the original
 			DataChunk output_chunk;
 			output_chunk.Initialize(context, state.distinct_output_chunks[table_idx]->GetTypes());
 
-			auto &global_source = global_sources[grouping_idx][i];
+			auto &global_source = global_sources[grouping_idx][table_idx];
 			auto local_source = radix_table_p->GetLocalSourceState(temp_exec_context);
 
 			// Fetch all the data from the aggregate ht, and Sink it into the main ht
@@ -584,8 +587,6 @@ public:
 					break;
 				}
 
-				auto &grouped_aggregate_data = *data.grouped_aggregate_data[table_idx];
-
 				for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
 					auto &group = grouped_aggregate_data.groups[group_idx];
 					auto &bound_ref_expr = (BoundReferenceExpression &)*group;
@@ -593,16 +594,17 @@ public:
 				}
 				group_chunk.SetCardinality(output_chunk);
 
-				for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size;
-				     child_idx++) {
-					aggregate_input_chunk.data[payload_idx + child_idx].Reference(
-					    output_chunk.data[group_by_size + child_idx]);
+				for (auto &aggregate_payload_idx : payload_indices) {
+					for (idx_t child_idx = 0; child_idx < child_count; child_idx++) {
+						aggregate_input_chunk.data[aggregate_payload_idx + child_idx].Reference(
+						    output_chunk.data[group_by_size + child_idx]);
+					}
 				}
 				aggregate_input_chunk.SetCardinality(output_chunk);
 
 				// Sink it into the main ht
 				grouping_data.table_data.Sink(temp_exec_context, table_state, *temp_local_state, group_chunk,
-				                              aggregate_input_chunk, {i});
+				                              aggregate_input_chunk, table_aggregates);
 			}
 		}
 		grouping_data.table_data.Combine(temp_exec_context, table_state, *temp_local_state);
@@ -641,7 +643,7 @@ public:
 	const PhysicalHashAggregate &op;
 	HashAggregateGlobalState &gstate;
 	ClientContext &context;
-	//! The GlobalSourceStates for all the radix tables of the distinct aggregates
+	//! The GlobalSourceStates for all the radix tables of the distinct aggregates (per grouping, per table)
 	vector<vector<unique_ptr<GlobalSourceState>>> global_sources;
 
 public:
@@ -674,24 +676,17 @@ private:
 			auto &grouping = op.groupings[grouping_idx];
 			auto &data = *grouping.distinct_data;
 
-			vector<unique_ptr<GlobalSourceState>> aggregate_sources;
-			aggregate_sources.reserve(op.grouped_aggregate_data.aggregates.size());
+			vector<unique_ptr<GlobalSourceState>> table_sources;
+			table_sources.reserve(data.radix_tables.size());
 
-			for (idx_t i = 0; i < op.grouped_aggregate_data.aggregates.size(); i++) {
-				auto &aggregate = op.grouped_aggregate_data.aggregates[i];
-				auto &aggr = (BoundAggregateExpression &)*aggregate;
-
-				if (!aggr.IsDistinct()) {
-					aggregate_sources.push_back(nullptr);
+			for (auto &radix_table_p : data.radix_tables) {
+				if (!radix_table_p) {
+					table_sources.push_back(nullptr);
 					continue;
 				}
-
-				D_ASSERT(data.info.table_map.count(i));
-				auto table_idx = data.info.table_map.at(i);
-				auto &radix_table_p = data.radix_tables[table_idx];
-				aggregate_sources.push_back(radix_table_p->GetGlobalSourceState(context));
+				table_sources.push_back(radix_table_p->GetGlobalSourceState(context));
 			}
-			grouping_sources.push_back(move(aggregate_sources));
+			grouping_sources.push_back(move(table_sources));
 		}
 		return grouping_sources;
 	}
@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/aggregate/physical_streaming_window.hpp"
 
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/parallel/thread_context.hpp"
@@ -22,6 +23,41 @@ public:
 	std::atomic<int64_t> row_number;
 };
 
+//! The most recent input rows of the arguments of a window function that reads previous rows
+class StreamingWindowHistory {
+public:
+	StreamingWindowHistory(Allocator &allocator, const vector<LogicalType> &types, idx_t keep_p)
+	    : keep(keep_p), first(0), rows(make_unique<DataChunk>()), next(make_unique<DataChunk>()) {
+		rows->Initialize(allocator, types, keep + STANDARD_VECTOR_SIZE);
+		next->Initialize(allocator, types, keep + STANDARD_VECTOR_SIZE);
+	}
+
+	//! Append the arguments of the next chunk, after the last (up to) keep rows of the previous ones
+	void Append(DataChunk &payload) {
+		const auto count = rows->size();
+		const auto kept = MinValue(count, keep);
+		next->Reset();
+		for (idx_t col_idx = 0; col_idx < rows->ColumnCount(); ++col_idx) {
+			VectorOperations::Copy(rows->data[col_idx], next->data[col_idx], count, count - kept, 0);
+			VectorOperations::Copy(payload.data[col_idx], next->data[col_idx], payload.size(), 0, kept);
+		}
+		next->SetCardinality(kept + payload.size());
+		first += count - kept;
+		rows.swap(next);
+	}
+
+	//! The number of previous rows that are kept
+	const idx_t keep;
+	//! The index of the first row of rows in the input
+	idx_t first;
+	//! The rows of the arguments
+	unique_ptr<DataChunk> rows;
+
+private:
+	//! The buffer for the next rows
+	unique_ptr<DataChunk> next;
+};
+
 class StreamingWindowState : public OperatorState {
 public:
 	using StateBuffer = vector<data_t>;
@@ -43,7 +79,11 @@ public:
 		const_vectors.resize(expressions.size());
 		aggregate_states.resize(expressions.size());
 		aggregate_dtors.resize(expressions.size(), nullptr);
+		histories.resize(expressions.size());
+		offsets.resize(expressions.size(), 0);
+		prev_frames.resize(expressions.size(), FrameBounds(0, 0));
 
+		auto &allocator = Allocator::Get(context);
 		for (idx_t expr_idx = 0; expr_idx < expressions.size(); expr_idx++) {
 			auto &expr = *expressions[expr_idx];
 			auto &wexpr = (BoundWindowExpression &)expr;
@@ -54,6 +94,30 @@ public:
 				aggregate_dtors[expr_idx] = aggregate.destructor;
 				state.resize(aggregate.state_size());
 				aggregate.initialize(state.data());
+				if (wexpr.start == WindowBoundary::EXPR_PRECEDING_ROWS) {
+					// Sliding frame: keep the rows that the previous frame covered
+					const auto preceding = GetOffset(context, wexpr.start_expr);
+					if (wexpr.end == WindowBoundary::EXPR_PRECEDING_ROWS) {
+						offsets[expr_idx] = GetOffset(context, wexpr.end_expr);
+					}
+					vector<LogicalType> payload_types;
+					for (auto &child : wexpr.children) {
+						payload_types.push_back(child->return_type);
+					}
+					histories[expr_idx] = make_unique<StreamingWindowHistory>(allocator, payload_types, preceding + 1);
+				}
+				break;
+			}
+			case ExpressionType::WINDOW_LAG: {
+				offsets[expr_idx] = wexpr.offset_expr ? GetOffset(context, wexpr.offset_expr) : 1;
+				histories[expr_idx] = make_unique<StreamingWindowHistory>(
+				    allocator, vector<LogicalType> {wexpr.children[0]->return_type}, offsets[expr_idx]);
+				Value default_value(wexpr.return_type);
+				if (wexpr.default_expr) {
+					default_value = ExpressionExecutor::EvaluateScalar(context, *wexpr.default_expr)
+					                    .CastAs(context, wexpr.return_type);
+				}
+				const_vectors[expr_idx] = make_unique<Vector>(default_value);
 				break;
 			}
 			case ExpressionType::WINDOW_FIRST_VALUE: {
@@ -83,10 +147,26 @@ public:
 		initialized = true;
 	}
 
+	static idx_t GetOffset(ClientContext &context, const unique_ptr<Expression> &expr) {
+		// The planner only streams constant offsets that are in range
+		const auto offset = ExpressionExecutor::EvaluateScalar(context, *expr).GetValue<int64_t>();
+		D_ASSERT(offset >= 0 && offset <= (int64_t)PhysicalStreamingWindow::MAX_STREAMING_OFFSET);
+		return offset;
+	}
+
 public:
 	bool initialized;
 	vector<unique_ptr<Vector>> const_vectors;
 
+	// LAG and sliding frames
+	vector<unique_ptr<StreamingWindowHistory>> histories;
+	//! The LAG offsets, or the number of rows that the end of a sliding frame precedes the current row
+	vector<idx_t> offsets;
+	//! The previous frames of the sliding aggregates
+	vector<FrameBounds> prev_frames;
+	//! The (empty) FILTER mask of the sliding aggregates
+	ValidityMask filter_mask;
+
 	// Aggregation
 	vector<StateBuffer> aggregate_states;
 	vector<aggregate_destructor_t> aggregate_dtors;
@@ -102,6 +182,19 @@ unique_ptr<OperatorState> PhysicalStreamingWindow::GetOperatorState(ExecutionCon
 	return make_unique<StreamingWindowState>();
 }
 
+static void ExecutePayload(ExecutionContext &context, BoundWindowExpression &wexpr, DataChunk &input,
+                           DataChunk &payload) {
+	ExpressionExecutor executor(context.client);
+	vector<LogicalType> payload_types;
+	for (auto &child : wexpr.children) {
+		payload_types.push_back(child->return_type);
+		executor.AddExpression(*child);
+	}
+
+	payload.Initialize(Allocator::Get(context.client), payload_types);
+	executor.Execute(input, payload);
+}
+
 OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
                                                     GlobalOperatorState &gstate_p, OperatorState &state_p) const {
 	auto &gstate = (StreamingWindowGlobalState &)gstate_p;
@@ -128,6 +221,34 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 			state.state_ptr = state.aggregate_states[expr_idx].data();
 			AggregateInputData aggr_input_data(wexpr.bind_info.get(), Allocator::DefaultAllocator());
 
+			// Sliding frames
+			if (state.histories[expr_idx]) {
+				auto &history = *state.histories[expr_idx];
+				DataChunk input_payload;
+				ExecutePayload(context, wexpr, input, input_payload);
+				history.Append(input_payload);
+
+				// The frame of row_idx is [row_idx - preceding, row_idx - end_offset]
+				auto &payload = *history.rows;
+				const auto preceding = history.keep - 1;
+				const auto end_offset = state.offsets[expr_idx];
+				auto &prev = state.prev_frames[expr_idx];
+				for (idx_t i = 0; i < count; ++i) {
+					const idx_t row_idx = gstate.row_number - 1 + i;
+					const auto begin = row_idx > preceding ? row_idx - preceding : 0;
+					const auto end = row_idx + 1 > end_offset ? row_idx + 1 - end_offset : 0;
+					if (begin >= end) {
+						FlatVector::SetNull(result, i, true);
+						continue;
+					}
+					const FrameBounds frame(begin, end);
+					aggregate.window(payload.data.data(), state.filter_mask, aggr_input_data, payload.ColumnCount(),
+					                 state.state_ptr, frame, prev, result, i, history.first);
+					prev = frame;
+				}
+				break;
+			}
+
 			// Check for COUNT(*)
 			if (wexpr.children.empty()) {
 				D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
@@ -141,16 +262,9 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 
 			// Compute the arguments
 			auto &allocator = Allocator::Get(context.client);
-			ExpressionExecutor executor(context.client);
-			vector<LogicalType> payload_types;
-			for (auto &child : wexpr.children) {
-				payload_types.push_back(child->return_type);
-				executor.AddExpression(*child);
-			}
-
 			DataChunk payload;
-			payload.Initialize(allocator, payload_types);
-			executor.Execute(input, payload);
+			ExecutePayload(context, wexpr, input, payload);
+			const auto payload_types = payload.GetTypes();
 
 			// Iterate through them using a single SV
 			payload.Flatten();
@@ -179,6 +293,28 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 			chunk.data[col_idx].Reference(*state.const_vectors[expr_idx]);
 			break;
 		}
+		case ExpressionType::WINDOW_LAG: {
+			auto &wexpr = (BoundWindowExpression &)expr;
+			auto &history = *state.histories[expr_idx];
+			DataChunk payload;
+			ExecutePayload(context, wexpr, input, payload);
+			history.Append(payload);
+
+			// The rows before the first row of the input get the default
+			const idx_t row_idx = gstate.row_number - 1;
+			const auto offset = state.offsets[expr_idx];
+			const auto defaults = row_idx < offset ? MinValue(offset - row_idx, count) : 0;
+			for (idx_t i = 0; i < defaults; ++i) {
+				VectorOperations::Copy(*state.const_vectors[expr_idx], result, 1, 0, i);
+			}
+			// The others are copied from the history
+			if (defaults < count) {
+				const auto source_offset = row_idx + defaults - offset - history.first;
+				VectorOperations::Copy(history.rows->data[0], result, source_offset + count - defaults, source_offset,
+				                       defaults);
+			}
+			break;
+		}
 		case ExpressionType::WINDOW_ROW_NUMBER: {
 			// Set row numbers
 			int64_t start_row = gstate.row_number;
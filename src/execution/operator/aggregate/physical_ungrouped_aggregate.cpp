@@ -14,6 +14,8 @@
 #include "duckdb/common/algorithm.hpp"
 #include <functional>
 #include "duckdb/execution/operator/aggregate/distinct_aggregate_data.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/transaction.hpp"
 
 namespace duckdb {
 
@@ -76,12 +78,43 @@ struct AggregateState {
 class UngroupedAggregateGlobalState : public GlobalSinkState {
 public:
 	UngroupedAggregateGlobalState(const PhysicalUngroupedAggregate &op, ClientContext &client)
-	    : state(op.aggregates), finished(false) {
+	    : state(op.aggregates), finished(false), from_statistics(false) {
 		if (op.distinct_data) {
 			distinct_state = make_unique<DistinctAggregateState>(*op.distinct_data, client);
 		}
+		if (op.statistics_table) {
+			InitializeFromStatistics(op, client);
+		}
 	}
 
+	void InitializeFromStatistics(const PhysicalUngroupedAggregate &op, ClientContext &client) {
+		vector<column_t> column_ids;
+		for (auto &column_id : op.statistics_columns) {
+			if (column_id != COLUMN_IDENTIFIER_ROW_ID) {
+				column_ids.push_back(column_id);
+			}
+		}
+		idx_t count;
+		vector<Value> min_values, max_values;
+		auto &transaction = Transaction::GetTransaction(client);
+		if (!op.statistics_table->GetExactStatistics(transaction, column_ids, count, min_values, max_values)) {
+			return;
+		}
+		idx_t column_idx = 0;
+		for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+			auto &aggr = (BoundAggregateExpression &)*op.aggregates[aggr_idx];
+			if (op.statistics_columns[aggr_idx] == COLUMN_IDENTIFIER_ROW_ID) {
+				statistics_result.push_back(Value::BIGINT(count));
+				continue;
+			}
+			auto &value = aggr.function.name == "min" ? min_values[column_idx] : max_values[column_idx];
+			statistics_result.push_back(value.DefaultCastAs(aggr.return_type));
+			column_idx++;
+		}
+		from_statistics = true;
+	}
+
+
 	//! The lock for updating the global aggregate state
 	mutex lock;
 	//! The global aggregate state
@@ -90,6 +123,10 @@ public:
 	bool finished;
 	//! The data related to the distinct aggregates (if there are any)
 	unique_ptr<DistinctAggregateState> distinct_state;
+	//! Whether or not the result was taken from the table statistics, in which case the input is not needed
+	bool from_statistics;
+	//! The aggregate values taken from the table statistics
+	vector<Value> statistics_result;
 };
 
 class UngroupedAggregateLocalState : public LocalSinkState {
@@ -218,6 +255,11 @@ void PhysicalUngroupedAggregate::SinkDistinct(ExecutionContext &context, GlobalS
 SinkResultType PhysicalUngroupedAggregate::Sink(ExecutionContext &context, GlobalSinkState &state,
                                                 LocalSinkState &lstate, DataChunk &input) const {
 	auto &sink = (UngroupedAggregateLocalState &)lstate;
+	auto &gstate = (UngroupedAggregateGlobalState &)state;
+	if (gstate.from_statistics) {
+		// the result is already known: stop the scan
+		return SinkResultType::FINISHED;
+	}
 
 	// perform the aggregation inside the local state
 	sink.Reset();
@@ -349,26 +391,22 @@ public:
 		ThreadContext temp_thread_context(context);
 		ExecutionContext temp_exec_context(context, temp_thread_context, nullptr);
 
-		idx_t payload_idx = 0;
-		idx_t next_payload_idx = 0;
-
-		for (idx_t i = 0; i < aggregates.size(); i++) {
-			auto &aggregate = (BoundAggregateExpression &)*aggregates[i];
-
-			// Forward the payload idx
-			payload_idx = next_payload_idx;
-			next_payload_idx = payload_idx + aggregate.children.size();
-
-			// If aggregate is not distinct, skip it
-			if (!distinct_data.IsDistinct(i)) {
+		for (idx_t table_idx = 0; table_idx < distinct_data.radix_tables.size(); table_idx++) {
+			auto &radix_table_p = distinct_data.radix_tables[table_idx];
+			if (!radix_table_p) {
 				continue;
 			}
+			// Find all the aggregates that share this table, so we only have to scan it once
+			vector<idx_t> table_aggregates;
+			for (idx_t i = 0; i < aggregates.size(); i++) {
+				if (distinct_data.IsDistinct(i) && distinct_data.info.table_map.at(i) == table_idx) {
+					table_aggregates.push_back(i);
+				}
+			}
+			D_ASSERT(!table_aggregates.empty());
 
 			DataChunk payload_chunk;
 
-			D_ASSERT(distinct_data.info.table_map.count(i));
-			auto table_idx = distinct_data.info.table_map.at(i);
-			auto &radix_table_p = distinct_data.radix_tables[table_idx];
 			auto &output_chunk = *distinct_state.distinct_output_chunks[table_idx];
 			auto &grouped_aggregate_data = *distinct_data.grouped_aggregate_data[table_idx];
 
@@ -389,20 +427,24 @@ public:
 				}
 
 				// We dont need to resolve the filter, we already did this in Sink
-				idx_t payload_cnt = aggregate.children.size();
+				idx_t payload_cnt = grouped_aggregate_data.group_types.size();
 				for (idx_t i = 0; i < payload_cnt; i++) {
 					payload_chunk.data[i].Reference(output_chunk.data[i]);
 				}
 				payload_chunk.SetCardinality(output_chunk);
-#ifdef DEBUG
-				gstate.state.counts[i] += payload_chunk.size();
-#endif
 
 				auto start_of_input = payload_cnt ? &payload_chunk.data[0] : nullptr;
-				//! Update the aggregate state
-				AggregateInputData aggr_input_data(aggregate.bind_info.get(), Allocator::DefaultAllocator());
-				aggregate.function.simple_update(start_of_input, aggr_input_data, payload_cnt,
-				                                 gstate.state.aggregates[i].get(), payload_chunk.size());
+				//! Update the states of all the aggregates that share this input
+				for (auto &aggr_idx : table_aggregates) {
+					auto &aggregate = (BoundAggregateExpression &)*aggregates[aggr_idx];
+					D_ASSERT(aggregate.children.size() == payload_cnt);
+#ifdef DEBUG
+					gstate.state.counts[aggr_idx] += payload_chunk.size();
+#endif
+					AggregateInputData aggr_input_data(aggregate.bind_info.get(), Allocator::DefaultAllocator());
+					aggregate.function.simple_update(start_of_input, aggr_input_data, payload_cnt,
+					                                 gstate.state.aggregates[aggr_idx].get(), payload_chunk.size());
+				}
 			}
 		}
 		D_ASSERT(!gstate.finished);
@@ -556,6 +598,13 @@ void PhysicalUngroupedAggregate::GetData(ExecutionContext &context, DataChunk &c
 
 	// initialize the result chunk with the aggregate values
 	chunk.SetCardinality(1);
+	if (gstate.from_statistics) {
+		for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+			chunk.SetValue(aggr_idx, 0, gstate.statistics_result[aggr_idx]);
+		}
+		state.finished = true;
+		return;
+	}
 	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
 		auto &aggregate = (BoundAggregateExpression &)*aggregates[aggr_idx];
 
@@ -14,6 +14,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
 
@@ -755,6 +756,14 @@ struct WindowInputColumn {
 		}
 	}
 
+	//! References the values of another column, which are only read
+	WindowInputColumn(WindowInputColumn &other, ClientContext &context)
+	    : input_expr(other.input_expr.expr, context), count(other.count), capacity(other.capacity) {
+		if (other.target) {
+			target = make_unique<Vector>(*other.target);
+		}
+	}
+
 	void Append(DataChunk &input_chunk) {
 		if (input_expr.expr && (!input_expr.scalar || !count)) {
 			input_expr.Execute(input_chunk);
@@ -818,6 +827,12 @@ struct WindowBoundariesState {
 	void Update(const idx_t row_idx, WindowInputColumn &range_collection, const idx_t source_offset,
 	            WindowInputExpression &boundary_start, WindowInputExpression &boundary_end,
 	            const ValidityMask &partition_mask, const ValidityMask &order_mask);
+	//! Restore the state as if Update had been called for all the rows before row_idx
+	void Seek(const idx_t row_idx, WindowInputColumn &range_collection, const ValidityMask &partition_mask,
+	          const ValidityMask &order_mask);
+	//! Compute the boundaries of the partition that starts at row_idx
+	void StartPartition(const idx_t row_idx, WindowInputColumn &range_collection, const ValidityMask &partition_mask,
+	                    const ValidityMask &order_mask);
 
 	// Cached lookups
 	const ExpressionType type;
@@ -981,6 +996,54 @@ static idx_t FindOrderedRangeBound(WindowInputColumn &over, const OrderType rang
 	}
 }
 
+void WindowBoundariesState::StartPartition(const idx_t row_idx, WindowInputColumn &range_collection,
+                                           const ValidityMask &partition_mask, const ValidityMask &order_mask) {
+	partition_start = row_idx;
+	peer_start = row_idx;
+
+	// find end of partition
+	partition_end = input_size;
+	if (partition_count) {
+		idx_t n = 1;
+		partition_end = FindNextStart(partition_mask, partition_start + 1, input_size, n);
+	}
+
+	// Find valid ordering values for the new partition
+	// so we can exclude NULLs from RANGE expression computations
+	valid_start = partition_start;
+	valid_end = partition_end;
+
+	if ((valid_start < valid_end) && has_preceding_range) {
+		// Exclude any leading NULLs
+		if (range_collection.CellIsNull(valid_start)) {
+			idx_t n = 1;
+			valid_start = FindNextStart(order_mask, valid_start + 1, valid_end, n);
+		}
+	}
+
+	if ((valid_start < valid_end) && has_following_range) {
+		// Exclude any trailing NULLs
+		if (range_collection.CellIsNull(valid_end - 1)) {
+			idx_t n = 1;
+			valid_end = FindPrevStart(order_mask, valid_start, valid_end, n);
+		}
+	}
+}
+
+void WindowBoundariesState::Seek(const idx_t row_idx, WindowInputColumn &range_collection,
+                                 const ValidityMask &partition_mask, const ValidityMask &order_mask) {
+	if (partition_count + order_count == 0 || row_idx == 0) {
+		// Update does not depend on the previous rows
+		return;
+	}
+
+	// the partition and the peer group of the previous row
+	idx_t n = 1;
+	StartPartition(FindPrevStart(partition_mask, 0, row_idx, n), range_collection, partition_mask, order_mask);
+	n = 1;
+	peer_start = FindPrevStart(order_mask, partition_start, row_idx, n);
+}
+
 void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range_collection, const idx_t expr_idx,
                                    WindowInputExpression &boundary_start, WindowInputExpression &boundary_end,
                                    const ValidityMask &partition_mask, const ValidityMask &order_mask) {
@@ -994,37 +1057,7 @@ void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range
 
 		// when the partition changes, recompute the boundaries
 		if (!bounds.is_same_partition) {
-			bounds.partition_start = row_idx;
-			bounds.peer_start = row_idx;
-
-			// find end of partition
-			bounds.partition_end = bounds.input_size;
-			if (bounds.partition_count) {
-				idx_t n = 1;
-				bounds.partition_end = FindNextStart(partition_mask, bounds.partition_start + 1, bounds.input_size, n);
-			}
-
-			// Find valid ordering values for the new partition
-			// so we can exclude NULLs from RANGE expression computations
-			bounds.valid_start = bounds.partition_start;
-			bounds.valid_end = bounds.partition_end;
-
-			if ((bounds.valid_start < bounds.valid_end) && bounds.has_preceding_range) {
-				// Exclude any leading NULLs
-				if (range_collection.CellIsNull(bounds.valid_start)) {
-					idx_t n = 1;
-					bounds.valid_start = FindNextStart(order_mask, bounds.valid_start + 1, bounds.valid_end, n);
-				}
-			}
-
-			if ((bounds.valid_start < bounds.valid_end) && bounds.has_following_range) {
-				// Exclude any trailing NULLs
-				if (range_collection.CellIsNull(bounds.valid_end - 1)) {
-					idx_t n = 1;
-					bounds.valid_end = FindPrevStart(order_mask, bounds.valid_start, bounds.valid_end, n);
-				}
-			}
-
+			bounds.StartPartition(row_idx, range_collection, partition_mask, order_mask);
 		} else if (!bounds.is_peer) {
 			bounds.peer_start = row_idx;
 		}
@@ -1147,10 +1180,15 @@ void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range
 
 struct WindowExecutor {
 	WindowExecutor(BoundWindowExpression *wexpr, ClientContext &context, const idx_t count);
+	//! Creates an executor that reads the (finalized) collections of another one,
+	//! so that both can evaluate rows of the same partition concurrently
+	WindowExecutor(WindowExecutor &shared, ClientContext &context);
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count);
 	void Finalize(WindowAggregationMode mode);
 
+	//! Prepare to evaluate the rows starting at row_idx, when the rows before it have not been evaluated
+	void Seek(idx_t row_idx, const ValidityMask &partition_mask, const ValidityMask &order_mask);
 	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, const ValidityMask &partition_mask,
 	              const ValidityMask &order_mask);
 
@@ -1226,6 +1264,22 @@ WindowExecutor::WindowExecutor(BoundWindowExpression *wexpr, ClientContext &cont
 	}
 }
 
+WindowExecutor::WindowExecutor(WindowExecutor &shared, ClientContext &context)
+    : wexpr(shared.wexpr), bounds(wexpr, shared.bounds.input_size), payload_collection(), payload_executor(context),
+      filter_executor(context), filter_mask(shared.filter_mask), leadlag_offset(wexpr->offset_expr.get(), context),
+      leadlag_default(wexpr->default_expr.get(), context), boundary_start(wexpr->start_expr.get(), context),
+      boundary_end(wexpr->end_expr.get(), context), range(shared.range, context), ignore_nulls(shared.ignore_nulls) {
+	auto types = shared.payload_collection.GetTypes();
+	if (!types.empty()) {
+		payload_collection.InitializeEmpty(types);
+		payload_collection.Reference(shared.payload_collection);
+	}
+
+	if (shared.segment_tree) {
+		segment_tree = make_unique<WindowSegmentTree>(*shared.segment_tree, &payload_collection, filter_mask);
+	}
+}
+
 void WindowExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) {
 	// Single pass over the input to produce the global data.
 	// Vectorisation for the win...
@@ -1301,6 +1355,22 @@ void WindowExecutor::Finalize(WindowAggregationMode mode) {
 	}
 }
 
+void WindowExecutor::Seek(idx_t row_idx, const ValidityMask &partition_mask, const ValidityMask &order_mask) {
+	bounds.Seek(row_idx, range, partition_mask, order_mask);
+	if (!WindowNeedsRank(wexpr) || row_idx == 0) {
+		return;
+	}
+
+	// the ranks of the previous row
+	idx_t n = 1;
+	const auto partition_begin = FindPrevStart(partition_mask, 0, row_idx, n);
+	n = 1;
+	const auto peer_begin = FindPrevStart(order_mask, partition_begin, row_idx, n);
+	dense_rank = 1 + order_mask.CountValid(peer_begin + 1) - order_mask.CountValid(partition_begin + 1);
+	rank = peer_begin - partition_begin + 1;
+	rank_equal = row_idx - peer_begin;
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, const ValidityMask &partition_mask,
                               const ValidityMask &order_mask) {
 	// Evaluate the row-level arguments
@@ -1521,7 +1591,7 @@ public:
 	bool TaskFinished() {
 		return finished;
 	}
-	void ExecuteTask();
+	void ExecuteTask(ClientContext &context);
 
 	WindowGlobalMergeState *merge_state;
 	WindowSortStage stage;
@@ -1553,7 +1623,7 @@ private:
 	idx_t tasks_completed;
 };
 
-void WindowLocalMergeState::ExecuteTask() {
+void WindowLocalMergeState::ExecuteTask(ClientContext &context) {
 	auto &global_sort = merge_state->sort_state;
 	switch (stage) {
 	case WindowSortStage::PREPARE:
@@ -1561,7 +1631,7 @@ void WindowLocalMergeState::ExecuteTask() {
 		break;
 	case WindowSortStage::MERGE: {
 		MergeSorter merge_sorter(global_sort, global_sort.buffer_manager);
-		merge_sorter.PerformInMergeRound();
+		merge_sorter.PerformInMergeRound(context);
 		break;
 	}
 	default:
@@ -1671,9 +1741,13 @@ TaskExecutionResult WindowMergeTask::ExecuteTask(TaskExecutionMode mode) {
 	// Loop until all hash groups are done
 	size_t sorted = 0;
 	while (sorted < hash_groups.states.size()) {
+		// Stop waiting for the other threads if the query was interrupted or one of them failed
+		if (executor.context.interrupted) {
+			throw InterruptException();
+		}
 		// First check if there is an unfinished task for this thread
 		if (!local_state.TaskFinished()) {
-			local_state.ExecuteTask();
+			local_state.ExecuteTask(executor.context);
 			continue;
 		}
 
@@ -1778,19 +1852,68 @@ SinkFinalizeType PhysicalWindow::Finalize(Pipeline &pipeline, Event &event, Clie
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
-class WindowGlobalSourceState : public GlobalSourceState {
+//	A single partition that is evaluated by all threads.
+//	One thread generates the partition, after which every thread evaluates runs of its row blocks
+//	with its own copies of the executors, which only read the shared collections.
+class WindowSharedPartition {
 public:
-	explicit WindowGlobalSourceState(const PhysicalWindow &op) : op(op), next_bin(0) {
+	using HashGroupPtr = unique_ptr<WindowGlobalHashGroup>;
+	using WindowExecutorPtr = unique_ptr<WindowExecutor>;
+
+	WindowSharedPartition() : task_blocks(1), next_task(0) {
 	}
 
+	HashGroupPtr hash_group;
+	//! The generated input chunks
+	unique_ptr<RowDataCollection> rows;
+	unique_ptr<RowDataCollection> heap;
+	bool external;
+	//! The partition boundary mask
+	vector<validity_t> partition_bits;
+	ValidityMask partition_mask;
+	//! The order boundary mask
+	vector<validity_t> order_bits;
+	ValidityMask order_mask;
+	//! The finalized execution functions
+	vector<WindowExecutorPtr> window_execs;
+	//! The index of the first row of each row block
+	vector<idx_t> block_starts;
+	//! The number of consecutive row blocks that are evaluated by a single task
+	idx_t task_blocks;
+	//! The next task
+	atomic<idx_t> next_task;
+};
+
+class WindowLocalSourceState;
+
+class WindowGlobalSourceState : public GlobalSourceState {
+public:
+	WindowGlobalSourceState(ClientContext &context, const PhysicalWindow &op);
+
 	const PhysicalWindow &op;
 	//! The output read position.
 	atomic<idx_t> next_bin;
+	//! The number of threads
+	const idx_t threads;
+	//! The hash bin of the partition that is evaluated by all threads (INVALID_INDEX if there is none)
+	idx_t shared_bin;
+	//! Lock for generating the shared partition
+	mutex lock;
+	//! The shared partition, once it has been generated
+	unique_ptr<WindowSharedPartition> shared_partition;
 
 public:
+	//! Get the shared partition, which is generated by the first thread that asks for it
+	WindowSharedPartition &GetSharedPartition(WindowLocalSourceState &lstate);
+
 	idx_t MaxThreads() override {
 		auto &state = (WindowGlobalSinkState &)*op.sink_state;
 
+		// The rows of a single partition are evaluated by all threads
+		if (shared_bin != DConstants::INVALID_INDEX) {
+			return threads;
+		}
+
 		// If there is only one partition, we have to process it on one thread.
 		if (state.hash_groups.empty()) {
 			return 1;
@@ -1807,6 +1930,28 @@ public:
 	}
 };
 
+WindowGlobalSourceState::WindowGlobalSourceState(ClientContext &context, const PhysicalWindow &op)
+    : op(op), next_bin(0), threads(TaskScheduler::GetScheduler(context).NumberOfThreads()),
+      shared_bin(DConstants::INVALID_INDEX) {
+	auto &gstate = (WindowGlobalSinkState &)*op.sink_state;
+
+	// If all the rows are in a single (sorted) hash group, we share it between the threads.
+	// Without partitions or orders rows have to be evaluated in input order, so we can not split them.
+	if (threads == 1 || op.is_order_dependent) {
+		return;
+	}
+	for (idx_t hash_bin = 0; hash_bin < gstate.hash_groups.size(); ++hash_bin) {
+		if (!gstate.hash_groups[hash_bin]) {
+			continue;
+		}
+		if (shared_bin != DConstants::INVALID_INDEX) {
+			shared_bin = DConstants::INVALID_INDEX;
+			break;
+		}
+		shared_bin = hash_bin;
+	}
+}
+
 // Per-thread read state
 class WindowLocalSourceState : public LocalSourceState {
 public:
@@ -1833,6 +1978,11 @@ public:
 	void GeneratePartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
 	void Scan(DataChunk &chunk);
 
+	//! Hand the generated partition over to all threads
+	unique_ptr<WindowSharedPartition> SharePartition(idx_t threads);
+	//! Start scanning the next row block of the shared partition, returns false if all blocks have been taken
+	bool NextSharedBlock(WindowSharedPartition &shared);
+
 	HashGroupPtr hash_group;
 	ClientContext &context;
 	Allocator &allocator;
@@ -1852,8 +2002,17 @@ public:
 
 	//! The read partition
 	idx_t hash_bin;
+	//! Whether the partition can be flushed to disk while it is scanned
+	bool external;
 	//! The read cursor
 	unique_ptr<RowDataCollectionScanner> scanner;
+	//! The row index of the first row of the read cursor
+	idx_t scan_offset = 0;
+	//! The shared partition that the executors read
+	WindowSharedPartition *shared_partition = nullptr;
+	//! The next row block of the shared partition, and the end of the run of blocks of the current task
+	idx_t block_idx = 0;
+	idx_t block_end = 0;
 	//! Buffer for the inputs
 	DataChunk input_chunk;
 	//! Buffer for window results
@@ -1941,7 +2100,7 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	order_mask.Initialize(order_bits.data());
 
 	// Scan the sorted data into new Collections
-	auto external = gstate.external;
+	external = gstate.external;
 	if (gstate.rows && !hash_bin) {
 		// Simple mask
 		partition_mask.SetValidUnsafe(0);
@@ -1988,6 +2147,85 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 
 	//	Second pass can flush
 	scanner = make_unique<RowDataCollectionScanner>(*rows, *heap, layout, external, true);
+	scan_offset = 0;
+}
+
+unique_ptr<WindowSharedPartition> WindowLocalSourceState::SharePartition(idx_t threads) {
+	auto result = make_unique<WindowSharedPartition>();
+	scanner.reset();
+	if (!rows) {
+		return result;
+	}
+
+	auto &shared = *result;
+	shared.hash_group = move(hash_group);
+	shared.rows = move(rows);
+	shared.heap = move(heap);
+	shared.external = external;
+	//	Moving the bits keeps the masks valid
+	shared.partition_bits = move(partition_bits);
+	shared.partition_mask = partition_mask;
+	shared.order_bits = move(order_bits);
+	shared.order_mask = order_mask;
+	shared.window_execs = move(window_execs);
+
+	idx_t row_idx = 0;
+	for (auto &block : shared.rows->blocks) {
+		shared.block_starts.emplace_back(row_idx);
+		row_idx += block->count;
+	}
+
+	//	A few runs of blocks per thread balances the load,
+	//	while keeping the number of times that the executors have to seek small.
+	shared.task_blocks = MaxValue<idx_t>(shared.block_starts.size() / (threads * 4), 1);
+
+	return result;
+}
+
+bool WindowLocalSourceState::NextSharedBlock(WindowSharedPartition &shared) {
+	if (shared_partition != &shared) {
+		//	Read the collections of the shared executors
+		shared_partition = &shared;
+		partition_mask = shared.partition_mask;
+		order_mask = shared.order_mask;
+		window_execs.clear();
+		for (auto &wexec : shared.window_execs) {
+			window_execs.emplace_back(make_unique<WindowExecutor>(*wexec, context));
+		}
+	}
+
+	const auto block_count = shared.block_starts.size();
+	if (block_idx >= block_end) {
+		block_idx = shared.next_task++ * shared.task_blocks;
+		if (block_idx >= block_count) {
+			scanner.reset();
+			return false;
+		}
+		block_end = MinValue(block_idx + shared.task_blocks, block_count);
+	}
+
+	//	The executors only have to seek if we did not evaluate the previous block
+	const auto row_idx = shared.block_starts[block_idx];
+	if (!scanner || scan_offset + scanner->Scanned() != row_idx) {
+		for (auto &wexec : window_execs) {
+			wexec->Seek(row_idx, partition_mask, order_mask);
+		}
+	}
+	scanner = make_unique<RowDataCollectionScanner>(*shared.rows, *shared.heap, layout, shared.external, block_idx++,
+	                                                true);
+	scan_offset = row_idx;
+
+	return true;
+}
+
+WindowSharedPartition &WindowGlobalSourceState::GetSharedPartition(WindowLocalSourceState &lstate) {
+	lock_guard<mutex> guard(lock);
+	if (!shared_partition) {
+		auto &gstate = (WindowGlobalSinkState &)*op.sink_state;
+		lstate.GeneratePartition(gstate, shared_bin);
+		shared_partition = lstate.SharePartition(threads);
+	}
+	return *shared_partition;
 }
 
 void WindowLocalSourceState::Scan(DataChunk &result) {
@@ -1997,7 +2235,7 @@ void WindowLocalSourceState::Scan(DataChunk &result) {
 		return;
 	}
 
-	const auto position = scanner->Scanned();
+	const auto position = scan_offset + scanner->Scanned();
 	input_chunk.Reset();
 	scanner->Scan(input_chunk);
 
@@ -2026,7 +2264,7 @@ unique_ptr<LocalSourceState> PhysicalWindow::GetLocalSourceState(ExecutionContex
 }
 
 unique_ptr<GlobalSourceState> PhysicalWindow::GetGlobalSourceState(ClientContext &context) const {
-	return make_unique<WindowGlobalSourceState>(*this);
+	return make_unique<WindowGlobalSourceState>(context, *this);
 }
 
 void PhysicalWindow::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
@@ -2035,6 +2273,18 @@ void PhysicalWindow::GetData(ExecutionContext &context, DataChunk &chunk, Global
 	auto &global_source = (WindowGlobalSourceState &)gstate_p;
 	auto &gstate = (WindowGlobalSinkState &)*sink_state;
 
+	//	Evaluate the next row block of the shared partition if we are done.
+	if (global_source.shared_bin != DConstants::INVALID_INDEX) {
+		auto &shared = global_source.GetSharedPartition(state);
+		while (!state.scanner || !state.scanner->Remaining()) {
+			if (!state.NextSharedBlock(shared)) {
+				return;
+			}
+		}
+		state.Scan(chunk);
+		return;
+	}
+
 	const auto bin_count = gstate.hash_groups.empty() ? 1 : gstate.hash_groups.size();
 
 	//	Move to the next bin if we are done.
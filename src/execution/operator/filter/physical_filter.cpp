@@ -1,6 +1,8 @@
 #include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 namespace duckdb {
 
@@ -20,30 +22,166 @@ PhysicalFilter::PhysicalFilter(vector<LogicalType> types, vector<unique_ptr<Expr
 	}
 }
 
+//! Gathers the subexpressions of the filter that are evaluated for every input tuple, and are worth sharing
+static void GatherSharedCandidates(Expression &expr, vector<Expression *> &candidates) {
+	switch (expr.expression_class) {
+	case ExpressionClass::BOUND_CASE:
+	case ExpressionClass::BOUND_CONJUNCTION:
+		// only (part of) the children are evaluated for every tuple
+		return;
+	case ExpressionClass::BOUND_OPERATOR:
+		if (expr.type == ExpressionType::OPERATOR_COALESCE) {
+			return;
+		}
+		break;
+	case ExpressionClass::BOUND_FUNCTION:
+	case ExpressionClass::BOUND_CAST:
+		if (!expr.HasSideEffects() && !expr.IsFoldable()) {
+			candidates.push_back(&expr);
+			// the children of a candidate are shared as part of the candidate
+			return;
+		}
+		break;
+	default:
+		break;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { GatherSharedCandidates(child, candidates); });
+}
+
+static bool ContainsExpression(Expression &expr, const Expression &target) {
+	if (expr.Equals(&target)) {
+		return true;
+	}
+	bool found = false;
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) {
+		if (!found) {
+			found = ContainsExpression(child, target);
+		}
+	});
+	return found;
+}
+
+static void ReplaceSharedExpressions(unique_ptr<Expression> &expr, const vector<unique_ptr<Expression>> &shared,
+                                     idx_t column_offset) {
+	for (idx_t i = 0; i < shared.size(); i++) {
+		if (expr->Equals(shared[i].get())) {
+			expr = make_unique<BoundReferenceExpression>(expr->alias, expr->return_type, column_offset + i);
+			return;
+		}
+	}
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
+		ReplaceSharedExpressions(child, shared, column_offset);
+	});
+}
+
+void PhysicalFilter::FuseProjection(vector<LogicalType> types_p, vector<unique_ptr<Expression>> select_list) {
+	D_ASSERT(CanFuseProjection());
+	D_ASSERT(types_p.size() == select_list.size());
+	D_ASSERT(children.size() == 1);
+	types = move(types_p);
+	projections = move(select_list);
+
+	// find the (expensive) subexpressions of the filter that are computed again by the projection
+	vector<Expression *> candidates;
+	GatherSharedCandidates(*expression, candidates);
+	for (auto candidate : candidates) {
+		bool duplicate = false;
+		for (auto &shared : shared_expressions) {
+			duplicate = duplicate || shared->Equals(candidate);
+		}
+		bool in_projection = false;
+		for (auto &expr : projections) {
+			in_projection = in_projection || ContainsExpression(*expr, *candidate);
+		}
+		if (!duplicate && in_projection) {
+			shared_expressions.push_back(candidate->Copy());
+		}
+	}
+	if (shared_expressions.empty()) {
+		return;
+	}
+	// reference the shared expressions instead of computing them again
+	auto column_offset = children[0]->types.size();
+	ReplaceSharedExpressions(expression, shared_expressions, column_offset);
+	for (auto &expr : projections) {
+		ReplaceSharedExpressions(expr, shared_expressions, column_offset);
+	}
+}
+
 class FilterState : public CachingOperatorState {
 public:
-	explicit FilterState(ExecutionContext &context, Expression &expr)
-	    : executor(context.client, expr), sel(STANDARD_VECTOR_SIZE) {
+	explicit FilterState(ExecutionContext &context, const PhysicalFilter &op)
+	    : executor(context.client, *op.expression), projection_executor(context.client),
+	      shared_executor(context.client), sel(STANDARD_VECTOR_SIZE) {
+		for (auto &expr : op.projections) {
+			projection_executor.AddExpression(*expr);
+		}
+		if (!op.shared_expressions.empty()) {
+			vector<LogicalType> shared_types;
+			for (auto &expr : op.shared_expressions) {
+				shared_executor.AddExpression(*expr);
+				shared_types.push_back(expr->return_type);
+			}
+			shared_chunk.Initialize(Allocator::Get(context.client), shared_types);
+			auto input_types = op.children[0]->types;
+			input_types.insert(input_types.end(), shared_types.begin(), shared_types.end());
+			input_chunk.InitializeEmpty(input_types);
+		}
 	}
 
 	ExpressionExecutor executor;
+	//! Executes the fused projection (if any)
+	ExpressionExecutor projection_executor;
+	//! Executes the expressions that are shared between the filter and the fused projection (if any)
+	ExpressionExecutor shared_executor;
+	//! The result of the shared expressions
+	DataChunk shared_chunk;
+	//! The input columns followed by the shared columns
+	DataChunk input_chunk;
 	SelectionVector sel;
 
 public:
 	void Finalize(PhysicalOperator *op, ExecutionContext &context) override {
 		context.thread.profiler.Flush(op, &executor, "filter", 0);
+		if (!projection_executor.expressions.empty()) {
+			context.thread.profiler.Flush(op, &projection_executor, "projection", 1);
+		}
+		if (!shared_executor.expressions.empty()) {
+			context.thread.profiler.Flush(op, &shared_executor, "shared", 2);
+		}
 	}
 };
 
 unique_ptr<OperatorState> PhysicalFilter::GetOperatorState(ExecutionContext &context) const {
-	return make_unique<FilterState>(context, *expression);
+	return make_unique<FilterState>(context, *this);
 }
 
 OperatorResultType PhysicalFilter::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
                                                    GlobalOperatorState &gstate, OperatorState &state_p) const {
 	auto &state = (FilterState &)state_p;
-	idx_t result_count = state.executor.SelectExpression(input, state.sel);
-	if (result_count == input.size()) {
+	auto filter_input = &input;
+	if (!shared_expressions.empty()) {
+		// compute the shared expressions once, and append them to the input columns
+		state.shared_chunk.Reset();
+		state.shared_executor.Execute(input, state.shared_chunk);
+		for (idx_t i = 0; i < input.ColumnCount(); i++) {
+			state.input_chunk.data[i].Reference(input.data[i]);
+		}
+		for (idx_t i = 0; i < state.shared_chunk.ColumnCount(); i++) {
+			state.input_chunk.data[input.ColumnCount() + i].Reference(state.shared_chunk.data[i]);
+		}
+		state.input_chunk.SetCardinality(input);
+		filter_input = &state.input_chunk;
+	}
+	idx_t result_count = state.executor.SelectExpression(*filter_input, state.sel);
+	if (!projections.empty()) {
+		// evaluate the fused projection directly on the selected tuples of the input
+		if (result_count == input.size()) {
+			state.projection_executor.Execute(*filter_input, chunk);
+		} else {
+			state.projection_executor.Execute(*filter_input, state.sel, result_count, chunk);
+		}
+	} else if (result_count == input.size()) {
 		// nothing was filtered: skip adding any selection vectors
 		chunk.Reference(input);
 	} else {
@@ -53,7 +191,14 @@ OperatorResultType PhysicalFilter::ExecuteInternal(ExecutionContext &context, Da
 }
 
 string PhysicalFilter::ParamsToString() const {
-	return expression->GetName();
+	string extra_info = expression->GetName();
+	if (!projections.empty()) {
+		extra_info += "\n[INFOSEPARATOR]\n";
+		for (auto &expr : projections) {
+			extra_info += expr->GetName() + "\n";
+		}
+	}
+	return extra_info;
 }
 
 } // namespace duckdb
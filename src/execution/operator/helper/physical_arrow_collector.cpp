@@ -0,0 +1,149 @@
+#include "duckdb/execution/operator/helper/physical_arrow_collector.hpp"
+#include "duckdb/common/arrow/arrow_appender.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/arrow_query_result.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+PhysicalArrowCollector::PhysicalArrowCollector(PreparedStatementData &data, bool parallel, bool use_batch_index,
+                                               idx_t batch_size)
+    : PhysicalResultCollector(data), parallel(parallel), use_batch_index(use_batch_index), batch_size(batch_size) {
+	if (batch_size == 0) {
+		throw InvalidInputException("The batch size of Arrow arrays must be higher than 0");
+	}
+}
+
+unique_ptr<PhysicalResultCollector> PhysicalArrowCollector::Create(ClientContext &context, PreparedStatementData &data,
+                                                                   idx_t batch_size) {
+	if (!PhysicalPlanGenerator::PreserveInsertionOrder(context, *data.plan)) {
+		// the plan is not order preserving: the arrays can be created in any order
+		return make_unique_base<PhysicalResultCollector, PhysicalArrowCollector>(data, true, false, batch_size);
+	} else if (!PhysicalPlanGenerator::UseBatchIndex(context, *data.plan)) {
+		// the plan is order preserving, but we cannot use the batch index: convert in a single thread
+		return make_unique_base<PhysicalResultCollector, PhysicalArrowCollector>(data, false, false, batch_size);
+	} else {
+		// the arrays are converted in parallel and ordered by their batch index afterwards
+		return make_unique_base<PhysicalResultCollector, PhysicalArrowCollector>(data, true, true, batch_size);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+//! A finished Arrow array, together with the batch index of the chunks it was created from
+struct ArrowCollectorArray {
+	ArrowCollectorArray(idx_t batch_index, unique_ptr<ArrowArrayWrapper> array)
+	    : batch_index(batch_index), array(move(array)) {
+	}
+
+	idx_t batch_index;
+	unique_ptr<ArrowArrayWrapper> array;
+};
+
+class ArrowCollectorGlobalState : public GlobalSinkState {
+public:
+	mutex glock;
+	vector<ArrowCollectorArray> arrays;
+	unique_ptr<ArrowQueryResult> result;
+};
+
+class ArrowCollectorLocalState : public LocalSinkState {
+public:
+	//! The appender of the array that is currently being built (if any)
+	unique_ptr<ArrowAppender> appender;
+	//! The batch index of the chunks in the current array
+	idx_t current_batch_index = DConstants::INVALID_INDEX;
+	//! The amount of rows in the current array
+	idx_t row_count = 0;
+	//! The finished arrays of this thread
+	vector<ArrowCollectorArray> arrays;
+
+	void FinalizeArray() {
+		if (!appender) {
+			return;
+		}
+		auto array = make_unique<ArrowArrayWrapper>();
+		array->arrow_array = appender->Finalize();
+		arrays.emplace_back(current_batch_index, move(array));
+		appender.reset();
+		row_count = 0;
+	}
+};
+
+SinkResultType PhysicalArrowCollector::Sink(ExecutionContext &context, GlobalSinkState &gstate,
+                                            LocalSinkState &lstate_p, DataChunk &input) const {
+	auto &state = (ArrowCollectorLocalState &)lstate_p;
+	auto batch_index = use_batch_index ? state.batch_index : 0;
+	if (state.appender && batch_index != state.current_batch_index) {
+		// arrays never span multiple batches, otherwise they could not be ordered
+		state.FinalizeArray();
+	}
+	if (!state.appender) {
+		state.appender = make_unique<ArrowAppender>(types, batch_size);
+		state.current_batch_index = batch_index;
+	}
+	// the chunk is converted to Arrow here, i.e. in the thread that produced it
+	state.appender->Append(input);
+	state.row_count += input.size();
+	if (state.row_count >= batch_size) {
+		state.FinalizeArray();
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+void PhysicalArrowCollector::Combine(ExecutionContext &context, GlobalSinkState &gstate_p,
+                                     LocalSinkState &lstate_p) const {
+	auto &gstate = (ArrowCollectorGlobalState &)gstate_p;
+	auto &state = (ArrowCollectorLocalState &)lstate_p;
+	state.FinalizeArray();
+	if (state.arrays.empty()) {
+		return;
+	}
+
+	lock_guard<mutex> lock(gstate.glock);
+	for (auto &array : state.arrays) {
+		gstate.arrays.push_back(move(array));
+	}
+	state.arrays.clear();
+}
+
+SinkFinalizeType PhysicalArrowCollector::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                  GlobalSinkState &gstate_p) const {
+	auto &gstate = (ArrowCollectorGlobalState &)gstate_p;
+	if (use_batch_index) {
+		// every batch is converted by a single thread, so sorting on the batch index restores the order
+		std::stable_sort(gstate.arrays.begin(), gstate.arrays.end(),
+		                 [](const ArrowCollectorArray &a, const ArrowCollectorArray &b) {
+			                 return a.batch_index < b.batch_index;
+		                 });
+	}
+	vector<unique_ptr<ArrowArrayWrapper>> arrays;
+	arrays.reserve(gstate.arrays.size());
+	for (auto &array : gstate.arrays) {
+		arrays.push_back(move(array.array));
+	}
+	gstate.arrays.clear();
+	gstate.result = make_unique<ArrowQueryResult>(statement_type, properties, names, types, move(arrays),
+	                                              context.GetClientProperties());
+	return SinkFinalizeType::READY;
+}
+
+unique_ptr<LocalSinkState> PhysicalArrowCollector::GetLocalSinkState(ExecutionContext &context) const {
+	return make_unique<ArrowCollectorLocalState>();
+}
+
+unique_ptr<GlobalSinkState> PhysicalArrowCollector::GetGlobalSinkState(ClientContext &context) const {
+	return make_unique<ArrowCollectorGlobalState>();
+}
+
+unique_ptr<QueryResult> PhysicalArrowCollector::GetResult(GlobalSinkState &state) {
+	auto &gstate = (ArrowCollectorGlobalState &)state;
+	D_ASSERT(gstate.result);
+	return move(gstate.result);
+}
+
+} // namespace duckdb
@@ -13,26 +13,29 @@ PhysicalBatchCollector::PhysicalBatchCollector(PreparedStatementData &data) : Ph
 //===--------------------------------------------------------------------===//
 class BatchCollectorGlobalState : public GlobalSinkState {
 public:
-	BatchCollectorGlobalState(ClientContext &context, const PhysicalBatchCollector &op) : data(op.types) {
+	BatchCollectorGlobalState(ClientContext &context, const PhysicalBatchCollector &op) : data(context, op.types) {
 	}
 
 	mutex glock;
 	BatchedDataCollection data;
+	//! The collections of the threads, which are merged in Finalize
+	vector<unique_ptr<BatchedDataCollection>> local_data;
 	unique_ptr<MaterializedQueryResult> result;
 };
 
 class BatchCollectorLocalState : public LocalSinkState {
 public:
-	BatchCollectorLocalState(ClientContext &context, const PhysicalBatchCollector &op) : data(op.types) {
+	BatchCollectorLocalState(ClientContext &context, const PhysicalBatchCollector &op)
+	    : data(make_unique<BatchedDataCollection>(context, op.types)) {
 	}
 
-	BatchedDataCollection data;
+	unique_ptr<BatchedDataCollection> data;
 };
 
 SinkResultType PhysicalBatchCollector::Sink(ExecutionContext &context, GlobalSinkState &gstate,
                                             LocalSinkState &lstate_p, DataChunk &input) const {
 	auto &state = (BatchCollectorLocalState &)lstate_p;
-	state.data.Append(input, state.batch_index);
+	state.data->Append(input, state.batch_index);
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -41,13 +44,18 @@ void PhysicalBatchCollector::Combine(ExecutionContext &context, GlobalSinkState
 	auto &gstate = (BatchCollectorGlobalState &)gstate_p;
 	auto &state = (BatchCollectorLocalState &)lstate_p;
 
+	// only hand over the collection here: it is merged (without copying its data) by Finalize
 	lock_guard<mutex> lock(gstate.glock);
-	gstate.data.Merge(state.data);
+	gstate.local_data.push_back(move(state.data));
 }
 
 SinkFinalizeType PhysicalBatchCollector::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                   GlobalSinkState &gstate_p) const {
 	auto &gstate = (BatchCollectorGlobalState &)gstate_p;
+	for (auto &local_data : gstate.local_data) {
+		gstate.data.Merge(*local_data);
+	}
+	gstate.local_data.clear();
 	auto collection = gstate.data.FetchCollection();
 	D_ASSERT(collection);
 	auto result = make_unique<MaterializedQueryResult>(statement_type, properties, names, move(collection),
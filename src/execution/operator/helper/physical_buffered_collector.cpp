@@ -0,0 +1,179 @@
+#include "duckdb/execution/operator/helper/physical_buffered_collector.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+
+#include <condition_variable>
+#include <set>
+
+namespace duckdb {
+
+PhysicalBufferedCollector::PhysicalBufferedCollector(PreparedStatementData &data, bool parallel, bool use_batch_index,
+                                                     idx_t capacity)
+    : PhysicalResultCollector(data), parallel(parallel), use_batch_index(use_batch_index), capacity(capacity) {
+}
+
+unique_ptr<PhysicalResultCollector> PhysicalBufferedCollector::Create(ClientContext &context,
+                                                                      PreparedStatementData &data) {
+	// the buffer size is given in bytes, the capacity is the amount of rows of this result that fit in it
+	idx_t row_width = 0;
+	for (auto &type : data.types) {
+		row_width += GetTypeIdSize(type.InternalType());
+	}
+	auto buffer_size = ClientConfig::GetConfig(context).streaming_buffer_size;
+	auto capacity = MaxValue<idx_t>(STANDARD_VECTOR_SIZE, buffer_size / MaxValue<idx_t>(row_width, 1));
+	if (!PhysicalPlanGenerator::PreserveInsertionOrder(context, *data.plan)) {
+		// the plan is not order preserving: the chunks can be handed out in any order
+		return make_unique_base<PhysicalResultCollector, PhysicalBufferedCollector>(data, true, false, capacity);
+	} else if (!PhysicalPlanGenerator::UseBatchIndex(context, *data.plan) || data.plan->GetSources().size() != 1) {
+		// the plan is order preserving, but we cannot use the batch index: produce the chunks in a single thread
+		// plans with multiple sources (i.e. UNION ALL) run their pipelines concurrently, in which case a chunk could
+		// be handed out before a pipeline that has not started yet produces the chunks that precede it
+		return make_unique_base<PhysicalResultCollector, PhysicalBufferedCollector>(data, false, false, capacity);
+	} else {
+		// the chunks are produced in parallel and handed out in the order of their batch index
+		return make_unique_base<PhysicalResultCollector, PhysicalBufferedCollector>(data, true, true, capacity);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class BufferedCollectorGlobalState : public GlobalSinkState {
+public:
+	explicit BufferedCollectorGlobalState(idx_t capacity)
+	    : capacity(capacity), consumer(std::this_thread::get_id()) {
+	}
+
+	mutex glock;
+	//! Signalled whenever the buffer shrinks or the batch indexes of the producing threads change
+	std::condition_variable blocked_producers;
+	//! The buffered chunks, by batch index
+	map<idx_t, deque<unique_ptr<DataChunk>>> buffer;
+	//! The amount of buffered rows
+	idx_t buffered_count = 0;
+	//! The amount of rows that can be buffered before the producing threads block
+	idx_t capacity;
+	//! The current batch indexes of the threads that are producing chunks
+	std::multiset<idx_t> active_batches;
+	//! Whether or not all chunks have been produced
+	bool finished = false;
+	//! Whether or not the result has been closed
+	bool cancelled = false;
+	//! The thread that fetches the result, which must never block as it also executes tasks of the query
+	std::thread::id consumer;
+};
+
+class BufferedCollectorLocalState : public LocalSinkState {
+public:
+	//! The batch index of this thread in the set of active batches (only used with batch indexes)
+	std::multiset<idx_t>::iterator active_batch;
+};
+
+SinkResultType PhysicalBufferedCollector::Sink(ExecutionContext &context, GlobalSinkState &gstate_p,
+                                               LocalSinkState &lstate_p, DataChunk &input) const {
+	auto &gstate = (BufferedCollectorGlobalState &)gstate_p;
+	auto &lstate = (BufferedCollectorLocalState &)lstate_p;
+	auto batch_index = use_batch_index ? lstate.batch_index : 0;
+	auto chunk = make_unique<DataChunk>();
+	chunk->Initialize(Allocator::Get(context.client), input.GetTypes(), input.size());
+	input.Copy(*chunk);
+
+	unique_lock<mutex> guard(gstate.glock);
+	if (use_batch_index && *lstate.active_batch != batch_index) {
+		// this thread has moved on to a new batch: chunks of lower batches might be handed out now
+		gstate.active_batches.erase(lstate.active_batch);
+		lstate.active_batch = gstate.active_batches.insert(batch_index);
+		gstate.blocked_producers.notify_all();
+	}
+	if (std::this_thread::get_id() != gstate.consumer) {
+		// block while the buffer is full - unless the consumer is waiting for the chunks of this thread
+		gstate.blocked_producers.wait(guard, [&]() {
+			return gstate.cancelled || gstate.buffered_count < gstate.capacity ||
+			       (use_batch_index && batch_index <= *gstate.active_batches.begin());
+		});
+	}
+	if (gstate.cancelled) {
+		return SinkResultType::FINISHED;
+	}
+	gstate.buffered_count += chunk->size();
+	gstate.buffer[batch_index].push_back(move(chunk));
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+void PhysicalBufferedCollector::Combine(ExecutionContext &context, GlobalSinkState &gstate_p,
+                                        LocalSinkState &lstate_p) const {
+	auto &gstate = (BufferedCollectorGlobalState &)gstate_p;
+	auto &lstate = (BufferedCollectorLocalState &)lstate_p;
+	if (!use_batch_index) {
+		return;
+	}
+	lock_guard<mutex> guard(gstate.glock);
+	gstate.active_batches.erase(lstate.active_batch);
+	gstate.blocked_producers.notify_all();
+}
+
+SinkFinalizeType PhysicalBufferedCollector::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                     GlobalSinkState &gstate_p) const {
+	auto &gstate = (BufferedCollectorGlobalState &)gstate_p;
+	lock_guard<mutex> guard(gstate.glock);
+	gstate.finished = true;
+	return SinkFinalizeType::READY;
+}
+
+unique_ptr<LocalSinkState> PhysicalBufferedCollector::GetLocalSinkState(ExecutionContext &context) const {
+	auto &gstate = (BufferedCollectorGlobalState &)*sink_state;
+	auto result = make_unique<BufferedCollectorLocalState>();
+	if (use_batch_index) {
+		// the thread is registered before it fetches its first batch, so nothing is handed out until it has one
+		lock_guard<mutex> guard(gstate.glock);
+		result->active_batch = gstate.active_batches.insert(0);
+	}
+	return move(result);
+}
+
+unique_ptr<GlobalSinkState> PhysicalBufferedCollector::GetGlobalSinkState(ClientContext &context) const {
+	return make_unique<BufferedCollectorGlobalState>(capacity);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+unique_ptr<DataChunk> PhysicalBufferedCollector::FetchChunk(GlobalSinkState &state) const {
+	auto &gstate = (BufferedCollectorGlobalState &)state;
+	lock_guard<mutex> guard(gstate.glock);
+	gstate.consumer = std::this_thread::get_id();
+	if (gstate.buffer.empty()) {
+		return nullptr;
+	}
+	auto entry = gstate.buffer.begin();
+	if (use_batch_index && !gstate.finished && !gstate.active_batches.empty() &&
+	    entry->first > *gstate.active_batches.begin()) {
+		// a thread is still producing the chunks of a lower batch
+		return nullptr;
+	}
+	auto result = move(entry->second.front());
+	entry->second.pop_front();
+	if (entry->second.empty()) {
+		gstate.buffer.erase(entry);
+	}
+	gstate.buffered_count -= result->size();
+	gstate.blocked_producers.notify_all();
+	return result;
+}
+
+void PhysicalBufferedCollector::Cancel(GlobalSinkState &state) const {
+	auto &gstate = (BufferedCollectorGlobalState &)state;
+	lock_guard<mutex> guard(gstate.glock);
+	gstate.cancelled = true;
+	gstate.blocked_producers.notify_all();
+}
+
+unique_ptr<QueryResult> PhysicalBufferedCollector::GetResult(GlobalSinkState &state) {
+	throw InternalException("PhysicalBufferedCollector produces a streaming result, use FetchChunk instead");
+}
+
+} // namespace duckdb
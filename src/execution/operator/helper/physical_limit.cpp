@@ -1,6 +1,8 @@
 #include "duckdb/execution/operator/helper/physical_limit.hpp"
 
 #include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/limits.hpp"
 #include "duckdb/main/config.hpp"
 
 #include "duckdb/execution/expression_executor.hpp"
@@ -21,20 +23,25 @@ PhysicalLimit::PhysicalLimit(vector<LogicalType> types, idx_t limit, idx_t offse
 //===--------------------------------------------------------------------===//
 class LimitGlobalState : public GlobalSinkState {
 public:
-	explicit LimitGlobalState(ClientContext &context, const PhysicalLimit &op) : data(op.types) {
+	explicit LimitGlobalState(ClientContext &context, const PhysicalLimit &op) : data(context, op.types) {
 		limit = 0;
 		offset = 0;
+		max_batch_index = NumericLimits<idx_t>::Maximum();
 	}
 
 	mutex glock;
 	idx_t limit;
 	idx_t offset;
 	BatchedDataCollection data;
+	//! Once a thread has collected limit + offset rows, the rows of batches after its last batch cannot be part of the
+	//! result anymore: the threads that fetch such batches can stop
+	atomic<idx_t> max_batch_index;
 };
 
 class LimitLocalState : public LocalSinkState {
 public:
-	explicit LimitLocalState(ClientContext &context, const PhysicalLimit &op) : current_offset(0), data(op.types) {
+	explicit LimitLocalState(ClientContext &context, const PhysicalLimit &op)
+	    : current_offset(0), data(context, op.types) {
 		this->limit = op.limit_expression ? DConstants::INVALID_INDEX : op.limit_value;
 		this->offset = op.offset_expression ? DConstants::INVALID_INDEX : op.offset_value;
 	}
@@ -91,14 +98,18 @@ bool PhysicalLimit::ComputeOffset(ExecutionContext &context, DataChunk &input, i
 	return true;
 }
 
-SinkResultType PhysicalLimit::Sink(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate,
+SinkResultType PhysicalLimit::Sink(ExecutionContext &context, GlobalSinkState &gstate_p, LocalSinkState &lstate,
                                    DataChunk &input) const {
 
 	D_ASSERT(input.size() > 0);
+	auto &gstate = (LimitGlobalState &)gstate_p;
 	auto &state = (LimitLocalState &)lstate;
 	auto &limit = state.limit;
 	auto &offset = state.offset;
 
+	if (SinkFinished(gstate_p, lstate)) {
+		return SinkResultType::FINISHED;
+	}
 	idx_t max_element;
 	if (!ComputeOffset(context, input, limit, offset, state.current_offset, max_element, limit_expression.get(),
 	                   offset_expression.get())) {
@@ -110,9 +121,22 @@ SinkResultType PhysicalLimit::Sink(ExecutionContext &context, GlobalSinkState &g
 	}
 	state.data.Append(input, lstate.batch_index);
 	state.current_offset += input.size();
+	if (state.current_offset == max_element) {
+		// all rows of the result are in this or earlier batches: lower the batch index after which threads can stop
+		idx_t max_batch_index = gstate.max_batch_index;
+		while (lstate.batch_index < max_batch_index &&
+		       !gstate.max_batch_index.compare_exchange_weak(max_batch_index, lstate.batch_index)) {
+		}
+		return SinkResultType::FINISHED;
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+bool PhysicalLimit::SinkFinished(GlobalSinkState &gstate_p, LocalSinkState &lstate) const {
+	auto &gstate = (LimitGlobalState &)gstate_p;
+	return lstate.batch_index > gstate.max_batch_index;
+}
+
 void PhysicalLimit::Combine(ExecutionContext &context, GlobalSinkState &gstate_p, LocalSinkState &lstate_p) const {
 	auto &gstate = (LimitGlobalState &)gstate_p;
 	auto &state = (LimitLocalState &)lstate_p;
@@ -15,7 +15,8 @@ PhysicalMaterializedCollector::PhysicalMaterializedCollector(PreparedStatementDa
 class MaterializedCollectorGlobalState : public GlobalSinkState {
 public:
 	mutex glock;
-	unique_ptr<ColumnDataCollection> collection;
+	//! The collections of the threads, which are combined into a single collection by GetResult
+	vector<unique_ptr<ColumnDataCollection>> collections;
 	shared_ptr<ClientContext> context;
 };
 
@@ -40,12 +41,9 @@ void PhysicalMaterializedCollector::Combine(ExecutionContext &context, GlobalSin
 		return;
 	}
 
+	// only hand over the collection here: the segments of the collections are moved into the result by GetResult
 	lock_guard<mutex> l(gstate.glock);
-	if (!gstate.collection) {
-		gstate.collection = move(lstate.collection);
-	} else {
-		gstate.collection->Combine(*lstate.collection);
-	}
+	gstate.collections.push_back(move(lstate.collection));
 }
 
 unique_ptr<GlobalSinkState> PhysicalMaterializedCollector::GetGlobalSinkState(ClientContext &context) const {
@@ -56,17 +54,26 @@ unique_ptr<GlobalSinkState> PhysicalMaterializedCollector::GetGlobalSinkState(Cl
 
 unique_ptr<LocalSinkState> PhysicalMaterializedCollector::GetLocalSinkState(ExecutionContext &context) const {
 	auto state = make_unique<MaterializedCollectorLocalState>();
-	state->collection = make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), types);
+	state->collection = ColumnDataCollection::CreateMaterializedCollection(context.client, types);
 	state->collection->InitializeAppend(state->append_state);
 	return move(state);
 }
 
 unique_ptr<QueryResult> PhysicalMaterializedCollector::GetResult(GlobalSinkState &state) {
 	auto &gstate = (MaterializedCollectorGlobalState &)state;
-	if (!gstate.collection) {
-		gstate.collection = make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), types);
+	unique_ptr<ColumnDataCollection> collection;
+	for (auto &local_collection : gstate.collections) {
+		if (!collection) {
+			collection = move(local_collection);
+		} else {
+			collection->Combine(*local_collection);
+		}
+	}
+	gstate.collections.clear();
+	if (!collection) {
+		collection = ColumnDataCollection::CreateMaterializedCollection(*gstate.context, types);
 	}
-	auto result = make_unique<MaterializedQueryResult>(statement_type, properties, names, move(gstate.collection),
+	auto result = make_unique<MaterializedQueryResult>(statement_type, properties, names, move(collection),
 	                                                   gstate.context->GetClientProperties());
 	return move(result);
 }
@@ -60,6 +60,15 @@ OperatorResultType PhysicalStreamingLimit::Execute(ExecutionContext &context, Da
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
+bool PhysicalStreamingLimit::OperatorFinished(GlobalOperatorState &gstate_p) const {
+	if (limit_expression || offset_expression) {
+		return false;
+	}
+	auto &gstate = (StreamingLimitGlobalState &)gstate_p;
+	// the threads together have already claimed all rows that can be part of the result
+	return gstate.current_offset >= limit_value + offset_value;
+}
+
 bool PhysicalStreamingLimit::IsOrderDependent() const {
 	return !parallel;
 }
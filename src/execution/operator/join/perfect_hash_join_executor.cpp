@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
 
+#include "duckdb/common/types/hugeint.hpp"
 #include "duckdb/common/types/row_layout.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
@@ -11,7 +12,92 @@ PerfectHashJoinExecutor::PerfectHashJoinExecutor(const PhysicalHashJoin &join_p,
 }
 
 bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
-	return perfect_join_statistics.is_build_small;
+	if (perfect_join_statistics.is_build_small) {
+		return true;
+	}
+	if (!perfect_join_statistics.is_join_eligible) {
+		return false;
+	}
+	// the statistics were too wide (or missing): check the keys that actually ended up in the build side
+	return ComputeBuildRange();
+}
+
+bool PerfectHashJoinExecutor::ComputeBuildRange() {
+	const auto count = ht.Count();
+	if (count == 0 || count > MAX_BUILD_SIZE) {
+		// more keys than fit in the largest table we would construct, so there must be a duplicate or a wide range
+		return false;
+	}
+	// keep the blocks pinned while we read the keys
+	vector<BufferHandle> handles;
+	for (auto &block : ht.GetBlockCollection().blocks) {
+		handles.push_back(ht.buffer_manager.Pin(block->block));
+	}
+	Vector tuples_addresses(LogicalType::POINTER, count);
+	auto key_locations = FlatVector::GetData<data_ptr_t>(tuples_addresses);
+	JoinHTScanState state;
+	auto keys_count = ht.FillWithHTOffsets(key_locations, state);
+	auto &key_type = ht.equality_types[0];
+	Vector build_vector(key_type, keys_count);
+	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, keys_count, 0);
+
+	switch (key_type.InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedComputeBuildRange<int8_t>(build_vector, keys_count);
+	case PhysicalType::INT16:
+		return TemplatedComputeBuildRange<int16_t>(build_vector, keys_count);
+	case PhysicalType::INT32:
+		return TemplatedComputeBuildRange<int32_t>(build_vector, keys_count);
+	case PhysicalType::INT64:
+		return TemplatedComputeBuildRange<int64_t>(build_vector, keys_count);
+	case PhysicalType::UINT8:
+		return TemplatedComputeBuildRange<uint8_t>(build_vector, keys_count);
+	case PhysicalType::UINT16:
+		return TemplatedComputeBuildRange<uint16_t>(build_vector, keys_count);
+	case PhysicalType::UINT32:
+		return TemplatedComputeBuildRange<uint32_t>(build_vector, keys_count);
+	case PhysicalType::UINT64:
+		return TemplatedComputeBuildRange<uint64_t>(build_vector, keys_count);
+	default:
+		return false;
+	}
+}
+
+template <typename T>
+bool PerfectHashJoinExecutor::TemplatedComputeBuildRange(Vector &source, idx_t count) {
+	UnifiedVectorFormat vector_data;
+	source.ToUnifiedFormat(count, vector_data);
+	auto data = (const T *)vector_data.data;
+	bool has_value = false;
+	T min_value = 0;
+	T max_value = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto data_idx = vector_data.sel->get_index(i);
+		if (!vector_data.validity.RowIsValid(data_idx)) {
+			continue;
+		}
+		auto input_value = data[data_idx];
+		if (!has_value) {
+			min_value = input_value;
+			max_value = input_value;
+			has_value = true;
+		} else {
+			min_value = MinValue<T>(min_value, input_value);
+			max_value = MaxValue<T>(max_value, input_value);
+		}
+	}
+	if (!has_value) {
+		return false;
+	}
+	auto range = Hugeint::Convert(max_value) - Hugeint::Convert(min_value);
+	if (range > hugeint_t(MAX_BUILD_SIZE)) {
+		return false;
+	}
+	perfect_join_statistics.build_min = Value::CreateValue<T>(min_value);
+	perfect_join_statistics.build_max = Value::CreateValue<T>(max_value);
+	perfect_join_statistics.build_range = (idx_t)Hugeint::Cast<int64_t>(range);
+	perfect_join_statistics.is_build_small = true;
+	return true;
 }
 
 //===--------------------------------------------------------------------===//
@@ -3,13 +3,18 @@
 #include "duckdb/common/types/column_data_collection.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/meta_pipeline.hpp"
 #include "duckdb/parallel/pipeline.hpp"
 #include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
@@ -53,13 +58,17 @@ public:
 	HashJoinGlobalSinkState(const PhysicalHashJoin &op, ClientContext &context)
 	    : finalized(false), scanned_data(false) {
 		hash_table = op.InitializeHashTable(context);
+		if (op.bloom_filter) {
+			// the filter is (re-)built during Finalize
+			op.bloom_filter->Reset();
+		}
 
 		// for perfect hash join
 		perfect_join_executor = make_unique<PerfectHashJoinExecutor>(op, *hash_table, op.perfect_join_statistics);
 		// for external hash join
 		external = op.can_go_external && ClientConfig::GetConfig(context).force_external;
 		// memory usage per thread scales with max mem / num threads
-		double max_memory = BufferManager::GetBufferManager(context).GetMaxMemory();
+		double max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory(context);
 		double num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
 		// HT may not exceed 60% of memory
 		max_ht_size = max_memory * 0.6;
@@ -239,18 +248,25 @@ class HashJoinFinalizeTask : public ExecutorTask {
 public:
 	HashJoinFinalizeTask(shared_ptr<Event> event_p, ClientContext &context, HashJoinGlobalSinkState &sink,
 	                     idx_t block_idx_start, idx_t block_idx_end, bool parallel)
-	    : ExecutorTask(context), event(move(event_p)), sink(sink), block_idx_start(block_idx_start),
+	    : ExecutorTask(context), event(move(event_p)), context(context), sink(sink), block_idx_start(block_idx_start),
 	      block_idx_end(block_idx_end), parallel(parallel) {
 	}
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
-		sink.hash_table->Finalize(block_idx_start, block_idx_end, parallel);
+		// insert the blocks one at a time so an interrupted query does not have to wait for the whole range
+		for (idx_t block_idx = block_idx_start; block_idx < block_idx_end; block_idx++) {
+			if (context.interrupted) {
+				throw InterruptException();
+			}
+			sink.hash_table->Finalize(block_idx, block_idx + 1, parallel);
+		}
 		event->FinishTask();
 		return TaskExecutionResult::TASK_FINISHED;
 	}
 
 private:
 	shared_ptr<Event> event;
+	ClientContext &context;
 	HashJoinGlobalSinkState &sink;
 	idx_t block_idx_start;
 	idx_t block_idx_end;
@@ -274,7 +290,17 @@ public:
 		const auto &block_collection = ht.GetBlockCollection();
 		const auto &blocks = block_collection.blocks;
 		const auto num_blocks = blocks.size();
-		if (block_collection.count < PARALLEL_CONSTRUCT_THRESHOLD && !context.config.verify_parallelism) {
+		if (ht.PartitionedBuild()) {
+			// Partitioned finalize: every partition has its own sub-table, no synchronization between tasks needed
+			const auto &offsets = ht.GetPartitionBlockOffsets();
+			for (idx_t p = 0; p + 1 < offsets.size(); p++) {
+				if (offsets[p] == offsets[p + 1]) {
+					continue;
+				}
+				finalize_tasks.push_back(make_unique<HashJoinFinalizeTask>(shared_from_this(), context, sink,
+				                                                           offsets[p], offsets[p + 1], false));
+			}
+		} else if (block_collection.count < PARALLEL_CONSTRUCT_THRESHOLD && !context.config.verify_parallelism) {
 			// Single-threaded finalize
 			finalize_tasks.push_back(
 			    make_unique<HashJoinFinalizeTask>(shared_from_this(), context, sink, 0, num_blocks, false));
@@ -300,6 +326,9 @@ public:
 
 	void FinishEvent() override {
 		sink.hash_table->finalized = true;
+		if (sink.hash_table->bloom_filter) {
+			sink.hash_table->bloom_filter->SetReady();
+		}
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -366,7 +395,11 @@ public:
 
 	void FinishEvent() override {
 		local_hts.clear();
-		sink.hash_table->PrepareExternalFinalize();
+		if (sink.external) {
+			sink.hash_table->PrepareExternalFinalize();
+		} else {
+			sink.hash_table->PreparePartitionedFinalize();
+		}
 		sink.ScheduleFinalize(*pipeline, *this);
 	}
 };
@@ -384,12 +417,33 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 		event.InsertEvent(move(new_event));
 		sink.finalized = true;
 		return SinkFinalizeType::READY;
-	} else {
-		for (auto &local_ht : sink.local_hash_tables) {
-			sink.hash_table->Merge(*local_ht);
+	}
+
+	idx_t build_count = 0;
+	for (auto &local_ht : sink.local_hash_tables) {
+		build_count += local_ht->Count();
+	}
+	if (sink.hash_table->PreparePartitionedBuild(context.config, build_count)) {
+		// Large build side - radix partition the HT, so each partition can be inserted into a cache-sized sub-table
+		sink.perfect_join_executor.reset();
+		if (bloom_filter && build_count > 0) {
+			auto &allocator = BufferManager::GetBufferManager(context).GetBufferAllocator();
+			bloom_filter->Initialize(allocator, build_count);
+			sink.hash_table->bloom_filter = bloom_filter;
 		}
-		sink.local_hash_tables.clear();
+		auto new_event = make_shared<HashJoinPartitionEvent>(pipeline, sink, sink.local_hash_tables);
+		event.InsertEvent(move(new_event));
+		sink.finalized = true;
+		if (build_count == 0 && EmptyResultIfRHSIsEmpty()) {
+			return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
+		}
+		return SinkFinalizeType::READY;
+	}
+
+	for (auto &local_ht : sink.local_hash_tables) {
+		sink.hash_table->Merge(*local_ht);
 	}
+	sink.local_hash_tables.clear();
 
 	// check for possible perfect hash table
 	auto use_perfect_hash = sink.perfect_join_executor->CanDoPerfectHashJoin();
@@ -401,6 +455,12 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
+		if (bloom_filter && sink.hash_table->Count() > 0) {
+			// fill the bloom filter while constructing the pointer table
+			auto &allocator = BufferManager::GetBufferManager(context).GetBufferAllocator();
+			bloom_filter->Initialize(allocator, sink.hash_table->Count());
+			sink.hash_table->bloom_filter = bloom_filter;
+		}
 		sink.ScheduleFinalize(pipeline, event);
 	}
 	sink.finalized = true;
@@ -410,6 +470,150 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	return SinkFinalizeType::READY;
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Filter Pushdown
+//===--------------------------------------------------------------------===//
+//! Finds the table scan that produces the given columns of the operator. The scan is either on the probe side of the
+//! operator, or (through at most one INNER hash join whose build side produces all columns) on the build side of
+//! build_join.
+static PhysicalTableScan *FindProbeScan(PhysicalOperator &op, vector<idx_t> &columns, PhysicalHashJoin *&build_join) {
+	switch (op.type) {
+	case PhysicalOperatorType::TABLE_SCAN:
+		return (PhysicalTableScan *)&op;
+	case PhysicalOperatorType::FILTER:
+	case PhysicalOperatorType::PROJECTION: {
+		auto &select_list = op.type == PhysicalOperatorType::FILTER ? ((PhysicalFilter &)op).projections
+		                                                            : ((PhysicalProjection &)op).select_list;
+		// filters without a fused projection do not change the column layout
+		if (!select_list.empty()) {
+			for (auto &column : columns) {
+				auto &expr = *select_list[column];
+				if (expr.type != ExpressionType::BOUND_REF) {
+					return nullptr;
+				}
+				column = ((BoundReferenceExpression &)expr).index;
+				if (column >= op.children[0]->types.size()) {
+					// a column that is computed by the filter itself
+					return nullptr;
+				}
+			}
+		}
+		return FindProbeScan(*op.children[0], columns, build_join);
+	}
+	case PhysicalOperatorType::HASH_JOIN: {
+		// the probe-side columns are the first columns in the output of a hash join, followed by the build columns
+		auto &join = (PhysicalHashJoin &)op;
+		auto probe_count = op.children[0]->types.size();
+		idx_t build_columns = 0;
+		for (auto &column : columns) {
+			build_columns += column >= probe_count;
+		}
+		if (build_columns == 0) {
+			return FindProbeScan(*op.children[0], columns, build_join);
+		}
+		if (build_columns < columns.size() || build_join || join.join_type != JoinType::INNER) {
+			return nullptr;
+		}
+		// the keys are columns of the build side of an inner join: rows of the build side that cannot find a match
+		// would only produce join results that are removed later on
+		for (auto &column : columns) {
+			column -= probe_count;
+			if (!join.right_projection_map.empty()) {
+				column = join.right_projection_map[column];
+			}
+		}
+		build_join = &join;
+		return FindProbeScan(*op.children[1], columns, build_join);
+	}
+	default:
+		return nullptr;
+	}
+}
+
+//! Returns the first pipeline that builds the hash table of the join (or nullptr if it is not part of meta_pipeline)
+static shared_ptr<Pipeline> GetBuildPipeline(MetaPipeline &meta_pipeline, PhysicalHashJoin &join) {
+	vector<shared_ptr<MetaPipeline>> meta_pipelines;
+	meta_pipeline.GetMetaPipelines(meta_pipelines, true, true);
+	for (auto &child : meta_pipelines) {
+		if (child->GetSink() == &join) {
+			return child->GetBasePipeline();
+		}
+	}
+	return nullptr;
+}
+
+void PhysicalHashJoin::AddBuildDependency(MetaPipeline &meta_pipeline) {
+	D_ASSERT(bloom_filter_target);
+	auto build = GetBuildPipeline(meta_pipeline, *this);
+	auto target_build = GetBuildPipeline(meta_pipeline, *bloom_filter_target);
+	D_ASSERT(build && target_build);
+	// the base pipeline of a build completes after the hash table is finalized, i.e., after the filter is filled
+	target_build->AddDependency(build);
+}
+
+void PhysicalHashJoin::PushDownBloomFilter(Pipeline &current, MetaPipeline &meta_pipeline) {
+	if (bloom_filter) {
+		// already pushed down in a previous execution of this plan
+		bloom_filter->Reset();
+		if (bloom_filter_target) {
+			// the pipelines are rebuilt for every execution: so is the dependency between the builds
+			AddBuildDependency(meta_pipeline);
+		}
+		return;
+	}
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+		// probe-side rows without a match are not part of the result
+		break;
+	default:
+		return;
+	}
+	vector<idx_t> columns;
+	for (auto &cond : conditions) {
+		if (cond.comparison == ExpressionType::COMPARE_DISTINCT_FROM) {
+			return;
+		}
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL &&
+		    cond.comparison != ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			continue;
+		}
+		if (cond.left->type != ExpressionType::BOUND_REF) {
+			return;
+		}
+		columns.push_back(((BoundReferenceExpression &)*cond.left).index);
+	}
+	PhysicalHashJoin *build_join = nullptr;
+	auto scan = FindProbeScan(*children[0], columns, build_join);
+	if (!scan) {
+		return;
+	}
+	if (!build_join) {
+		// the scan has to be the source of the probe pipeline so it only starts after the build side is finalized
+		if (scan != current.GetSource()) {
+			return;
+		}
+	} else {
+		// the keys come from the build side of another join (e.g., a dimension table that is joined with a smaller
+		// dimension table in a snowflake schema): filter that build side instead. This makes it wait for our build,
+		// so we only do this if our build side is the smaller one
+		if (children[1]->estimated_cardinality > build_join->children[1]->estimated_cardinality ||
+		    meta_pipeline.HasRecursiveCTE()) {
+			return;
+		}
+		auto build = GetBuildPipeline(meta_pipeline, *this);
+		auto target_build = GetBuildPipeline(meta_pipeline, *build_join);
+		if (!build || !target_build || target_build->GetSource() != scan) {
+			return;
+		}
+		bloom_filter_target = build_join;
+		AddBuildDependency(meta_pipeline);
+	}
+	bloom_filter = make_shared<JoinBloomFilter>(move(columns));
+	scan->join_filters.push_back(bloom_filter);
+}
+
 //===--------------------------------------------------------------------===//
 // Operator
 //===--------------------------------------------------------------------===//
@@ -875,6 +1079,10 @@ void PhysicalHashJoin::GetData(ExecutionContext &context, DataChunk &chunk, Glob
 	// Any call to GetData must produce tuples, otherwise the pipeline executor thinks that we're done
 	// Therefore, we loop until we've produced tuples, or until the operator is actually done
 	while (gstate.global_stage != HashJoinSourceStage::DONE && chunk.size() == 0) {
+		// This thread may be waiting for the other threads to finish a stage, stop if the query was interrupted
+		if (context.client.interrupted) {
+			throw InterruptException();
+		}
 		if (!lstate.TaskFinished() || gstate.AssignTask(sink, lstate)) {
 			lstate.ExecuteTask(sink, gstate, chunk);
 		} else {
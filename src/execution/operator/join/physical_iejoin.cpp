@@ -192,6 +192,8 @@ OperatorResultType PhysicalIEJoin::ExecuteInternal(ExecutionContext &context, Da
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
+struct IEJoinSortedPair;
+
 struct IEJoinUnion {
 	using SortedTable = PhysicalRangeJoin::GlobalSortedTable;
 
@@ -234,8 +236,9 @@ struct IEJoinUnion {
 		return result;
 	}
 
-	IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1, SortedTable &t2,
-	            const idx_t b2);
+	//! Scans the range with the given index (of range_count) of the rows in L2 of the sorted pair of blocks
+	IEJoinUnion(const PhysicalIEJoin &op, shared_ptr<IEJoinSortedPair> sorted, const idx_t range_idx,
+	            const idx_t range_count);
 
 	idx_t SearchL1(idx_t pos);
 	bool NextRow();
@@ -243,15 +246,13 @@ struct IEJoinUnion {
 	//! Inverted loop
 	idx_t JoinComplexBlocks(SelectionVector &lsel, SelectionVector &rsel);
 
-	//! L1
-	unique_ptr<SortedTable> l1;
-	//! L2
-	unique_ptr<SortedTable> l2;
+	//! The sorted blocks (L1, L2, Li and P), which may be shared with other ranges
+	shared_ptr<IEJoinSortedPair> sorted;
 
 	//! Li
-	vector<int64_t> li;
+	const vector<int64_t> &li;
 	//! P
-	vector<idx_t> p;
+	const vector<idx_t> &p;
 
 	//! B
 	vector<validity_t> bit_array;
@@ -266,6 +267,7 @@ struct IEJoinUnion {
 	//! Iteration state
 	idx_t n;
 	idx_t i;
+	idx_t i_end;
 	idx_t j;
 	unique_ptr<SBIterator> op1;
 	unique_ptr<SBIterator> off1;
@@ -274,6 +276,31 @@ struct IEJoinUnion {
 	int64_t lrid;
 };
 
+//! The sorted L1 and L2 arrays of a pair of blocks
+/*!
+    The bit-array scan only depends on the rows of L2 that were visited before, so the rows of L2 can be split into
+    ranges that are scanned in parallel: the first row of a range sets all the bits of the rows before it.
+*/
+struct IEJoinSortedPair {
+	using SortedTable = PhysicalRangeJoin::GlobalSortedTable;
+
+	IEJoinSortedPair(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1,
+	                 SortedTable &t2, const idx_t b2);
+
+	//! L1
+	unique_ptr<SortedTable> l1;
+	//! L2
+	unique_ptr<SortedTable> l2;
+
+	//! Li
+	vector<int64_t> li;
+	//! P
+	vector<idx_t> p;
+
+	//! The number of rows in L1 and L2
+	idx_t n;
+};
+
 idx_t IEJoinUnion::AppendKey(SortedTable &table, ExpressionExecutor &executor, SortedTable &marked, int64_t increment,
                              int64_t base, const idx_t block_idx) {
 	LocalSortState local_sort_state;
@@ -343,9 +370,9 @@ idx_t IEJoinUnion::AppendKey(SortedTable &table, ExpressionExecutor &executor, S
 	return inserted;
 }
 
-IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1,
-                         SortedTable &t2, const idx_t b2)
-    : n(0), i(0) {
+IEJoinSortedPair::IEJoinSortedPair(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1,
+                                   SortedTable &t2, const idx_t b2)
+    : n(0) {
 	// input : query Q with 2 join predicates t1.X op1 t2.X' and t1.Y op2 t2.Y', tables T, T' of sizes m and n resp.
 	// output: a list of tuple pairs (ti , tj)
 	// Note that T/T' are already sorted on X/X' and contain the payload data
@@ -394,21 +421,18 @@ IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, Sorte
 	ExpressionExecutor l_executor(context);
 	l_executor.AddExpression(*order1.expression);
 	l_executor.AddExpression(*order2.expression);
-	AppendKey(t1, l_executor, *l1, 1, 1, b1);
+	IEJoinUnion::AppendKey(t1, l_executor, *l1, 1, 1, b1);
 
 	// RHS has negative rids
 	ExpressionExecutor r_executor(context);
 	r_executor.AddExpression(*op.rhs_orders[0][0].expression);
 	r_executor.AddExpression(*op.rhs_orders[1][0].expression);
-	AppendKey(t2, r_executor, *l1, -1, -1, b2);
-
-	Sort(*l1);
+	IEJoinUnion::AppendKey(t2, r_executor, *l1, -1, -1, b2);
 
-	op1 = make_unique<SBIterator>(l1->global_sort_state, cmp1);
-	off1 = make_unique<SBIterator>(l1->global_sort_state, cmp1);
+	IEJoinUnion::Sort(*l1);
 
 	// We don't actually need the L1 column, just its sort key, which is in the sort blocks
-	li = ExtractColumn<int64_t>(*l1, types.size() - 1);
+	li = IEJoinUnion::ExtractColumn<int64_t>(*l1, types.size() - 1);
 
 	// 4. if (op2 ∈ {>, ≥}) sort L2 in ascending order
 	// 5. else if (op2 ∈ {<, ≤}) sort L2 in descending order
@@ -429,18 +453,31 @@ IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, Sorte
 
 	l2 = make_unique<SortedTable>(context, orders, payload_layout);
 	for (idx_t base = 0, block_idx = 0; block_idx < l1->BlockCount(); ++block_idx) {
-		base += AppendKey(*l1, executor, *l2, 1, base, block_idx);
+		base += IEJoinUnion::AppendKey(*l1, executor, *l2, 1, base, block_idx);
 	}
 
-	Sort(*l2);
+	IEJoinUnion::Sort(*l2);
 
 	// We don't actually need the L2 column, just its sort key, which is in the sort blocks
 
 	// 6. compute the permutation array P of L2 w.r.t. L1
-	p = ExtractColumn<idx_t>(*l2, types.size() - 1);
+	p = IEJoinUnion::ExtractColumn<idx_t>(*l2, types.size() - 1);
+	n = l2->count.load();
+}
+
+IEJoinUnion::IEJoinUnion(const PhysicalIEJoin &op, shared_ptr<IEJoinSortedPair> sorted_p, const idx_t range_idx,
+                         const idx_t range_count)
+    : sorted(move(sorted_p)), li(sorted->li), p(sorted->p), n(sorted->n), i(0), i_end(0), j(0) {
+	if (!n) {
+		// No overlap
+		return;
+	}
+
+	const auto &cmp1 = op.conditions[0].comparison;
+	op1 = make_unique<SBIterator>(sorted->l1->global_sort_state, cmp1);
+	off1 = make_unique<SBIterator>(sorted->l1->global_sort_state, cmp1);
 
 	// 7. initialize bit-array B (|B| = n), and set all bits to 0
-	n = l2->count.load();
 	bit_array.resize(ValidityMask::EntryCount(n), 0);
 	bit_mask.Initialize(bit_array.data());
 
@@ -450,11 +487,12 @@ IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, Sorte
 	bloom_filter.Initialize(bloom_array.data());
 
 	// 11. for(i←1 to n) do
+	// We only scan our range of L2, the first row fills in B for all rows before it
 	const auto &cmp2 = op.conditions[1].comparison;
-	op2 = make_unique<SBIterator>(l2->global_sort_state, cmp2);
-	off2 = make_unique<SBIterator>(l2->global_sort_state, cmp2);
-	i = 0;
-	j = 0;
+	op2 = make_unique<SBIterator>(sorted->l2->global_sort_state, cmp2);
+	off2 = make_unique<SBIterator>(sorted->l2->global_sort_state, cmp2);
+	i = n * range_idx / range_count;
+	i_end = n * (range_idx + 1) / range_count;
 	(void)NextRow();
 }
 
@@ -506,7 +544,7 @@ idx_t IEJoinUnion::SearchL1(idx_t pos) {
 }
 
 bool IEJoinUnion::NextRow() {
-	for (; i < n; ++i) {
+	for (; i < i_end; ++i) {
 		// 12. pos ← P[i]
 		auto pos = p[i];
 		lrid = li[pos];
@@ -586,7 +624,7 @@ idx_t IEJoinUnion::JoinComplexBlocks(SelectionVector &lsel, SelectionVector &rse
 	idx_t result_count = 0;
 
 	// 11. for(i←1 to n) do
-	while (i < n) {
+	while (i < i_end) {
 		// 13. for (j ← pos+eqOff to n) do
 		for (;;) {
 			// 14. if B[j] = 1 then
@@ -775,9 +813,16 @@ void PhysicalIEJoin::ResolveComplexJoin(ExecutionContext &context, DataChunk &ch
 
 class IEJoinGlobalSourceState : public GlobalSourceState {
 public:
-	explicit IEJoinGlobalSourceState(const PhysicalIEJoin &op)
+	//! The state of a pair of blocks, whose sorted L1 and L2 arrays are shared by the ranges that scan it
+	struct PairState {
+		mutex lock;
+		shared_ptr<IEJoinSortedPair> sorted;
+		idx_t assigned = 0;
+	};
+
+	IEJoinGlobalSourceState(const PhysicalIEJoin &op, ClientContext &context)
 	    : op(op), initialized(false), next_pair(0), completed(0), left_outers(0), next_left(0), right_outers(0),
-	      next_right(0) {
+	      next_right(0), num_threads(TaskScheduler::GetScheduler(context).NumberOfThreads()) {
 	}
 
 	void Initialize(IEJoinGlobalState &sink_state) {
@@ -786,6 +831,14 @@ public:
 			return;
 		}
 
+		// Split every pair of blocks in ranges, if there are not enough pairs to keep all threads busy
+		const auto pair_count = sink_state.tables[0]->BlockCount() * sink_state.tables[1]->BlockCount();
+		ranges_per_pair = RangesPerPair(pair_count);
+		pairs.reserve(pair_count);
+		for (idx_t pair_idx = 0; pair_idx < pair_count; ++pair_idx) {
+			pairs.emplace_back(make_unique<PairState>());
+		}
+
 		// Compute the starting row for reach block
 		// (In theory these are all the same size, but you never know...)
 		auto &left_table = *sink_state.tables[0];
@@ -819,10 +872,33 @@ public:
 	}
 
 public:
+	idx_t RangesPerPair(idx_t pair_count) const {
+		if (pair_count == 0) {
+			return 1;
+		}
+		return MinValue<idx_t>(MaxValue<idx_t>(num_threads / pair_count, 1), MAX_RANGES_PER_PAIR);
+	}
+
 	idx_t MaxThreads() override {
-		// We can't leverage any more threads than block pairs.
+		// We can't leverage any more threads than ranges of block pairs.
 		const auto &sink_state = ((IEJoinGlobalState &)*op.sink_state);
-		return sink_state.tables[0]->BlockCount() * sink_state.tables[1]->BlockCount();
+		const auto pair_count = sink_state.tables[0]->BlockCount() * sink_state.tables[1]->BlockCount();
+		return pair_count * RangesPerPair(pair_count);
+	}
+
+	shared_ptr<IEJoinSortedPair> GetSortedPair(ClientContext &client, IEJoinGlobalState &gstate, idx_t pair_idx,
+	                                           idx_t b1, idx_t b2) {
+		// The first range of the pair sorts it, the last one to be assigned releases it
+		auto &pair = *pairs[pair_idx];
+		lock_guard<mutex> guard(pair.lock);
+		if (!pair.sorted) {
+			pair.sorted = make_shared<IEJoinSortedPair>(client, op, *gstate.tables[0], b1, *gstate.tables[1], b2);
+		}
+		auto result = pair.sorted;
+		if (++pair.assigned == ranges_per_pair) {
+			pair.sorted.reset();
+		}
+		return result;
 	}
 
 	void GetNextPair(ClientContext &client, IEJoinGlobalState &gstate, IEJoinLocalSourceState &lstate) {
@@ -832,12 +908,15 @@ public:
 		const auto left_blocks = left_table.BlockCount();
 		const auto right_blocks = right_table.BlockCount();
 		const auto pair_count = left_blocks * right_blocks;
+		const auto range_count = pair_count * ranges_per_pair;
 
-		// Regular block
+		// Regular block (ranges of different pairs first, so threads do not wait for the same pair to be sorted)
 		const auto i = next_pair++;
-		if (i < pair_count) {
-			const auto b1 = i / right_blocks;
-			const auto b2 = i % right_blocks;
+		if (i < range_count) {
+			const auto pair_idx = i % pair_count;
+			const auto range_idx = i / pair_count;
+			const auto b1 = pair_idx / right_blocks;
+			const auto b2 = pair_idx % right_blocks;
 
 			lstate.left_block_index = b1;
 			lstate.left_base = left_bases[b1];
@@ -845,7 +924,8 @@ public:
 			lstate.right_block_index = b2;
 			lstate.right_base = right_bases[b2];
 
-			lstate.joiner = make_unique<IEJoinUnion>(client, op, left_table, b1, right_table, b2);
+			auto sorted = GetSortedPair(client, gstate, pair_idx, b1, b2);
+			lstate.joiner = make_unique<IEJoinUnion>(op, move(sorted), range_idx, ranges_per_pair);
 			return;
 		} else {
 			--next_pair;
@@ -857,7 +937,7 @@ public:
 		}
 
 		// Spin wait for regular blocks to finish(!)
-		while (completed < pair_count) {
+		while (completed < range_count) {
 			std::this_thread::yield();
 		}
 
@@ -917,10 +997,16 @@ public:
 
 	idx_t right_outers;
 	std::atomic<idx_t> next_right;
+
+	// Ranges of block pairs
+	static constexpr const idx_t MAX_RANGES_PER_PAIR = 64;
+	const idx_t num_threads;
+	idx_t ranges_per_pair;
+	vector<unique_ptr<PairState>> pairs;
 };
 
 unique_ptr<GlobalSourceState> PhysicalIEJoin::GetGlobalSourceState(ClientContext &context) const {
-	return make_unique<IEJoinGlobalSourceState>(*this);
+	return make_unique<IEJoinGlobalSourceState>(*this, context);
 }
 
 unique_ptr<LocalSourceState> PhysicalIEJoin::GetLocalSourceState(ExecutionContext &context,
@@ -5,6 +5,7 @@
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -28,6 +29,9 @@ public:
 		}
 		if (!op.fetch_types.empty()) {
 			rhs_chunk.Initialize(allocator, op.fetch_types);
+			if (!op.index) {
+				row_chunk.Initialize(allocator, op.fetch_types, 1);
+			}
 		}
 		rhs_sel.Initialize(STANDARD_VECTOR_SIZE);
 	}
@@ -39,6 +43,8 @@ public:
 	vector<idx_t> result_sizes;
 	DataChunk join_keys;
 	DataChunk rhs_chunk;
+	//! A single fetched row (only used for row id joins)
+	DataChunk row_chunk;
 	SelectionVector rhs_sel;
 
 	//! Vector of rows that mush be fetched for every LHS key
@@ -70,8 +76,16 @@ PhysicalIndexJoin::PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOpe
 		condition_types.push_back(condition.left->return_type);
 	}
 	//! Only add to fetch_ids columns that are not indexed
-	for (auto &index_id : index->column_ids) {
-		index_ids.insert(index_id);
+	//! The conditions are ordered like the index key, and every index expression is a column reference
+	D_ASSERT(!index || index->unbound_expressions.size() == conditions.size());
+	//! A range condition does not determine the value of the indexed column: it has to be fetched
+	//! Without an index the keys are row ids, which are always fetched to find out whether their rows exist
+	if (index && conditions[0].comparison == ExpressionType::COMPARE_EQUAL) {
+		for (idx_t key_idx = 0; key_idx < index->unbound_expressions.size(); key_idx++) {
+			D_ASSERT(index->unbound_expressions[key_idx]->type == ExpressionType::BOUND_COLUMN_REF);
+			auto &colref = (BoundColumnRefExpression &)*index->unbound_expressions[key_idx];
+			index_ids[index->column_ids[colref.binding.column_index]] = key_idx;
+		}
 	}
 	for (idx_t column_id = 0; column_id < column_ids.size(); column_id++) {
 		auto it = index_ids.find(column_ids[column_id]);
@@ -130,6 +144,22 @@ void PhysicalIndexJoin::Output(ExecutionContext &context, DataChunk &input, Data
 		state.fetch_state = make_unique<ColumnFetchState>();
 		Vector row_ids(LogicalType::ROW_TYPE, (data_ptr_t)&fetch_rows[0]);
 		tbl->Fetch(transaction, state.rhs_chunk, fetch_ids, row_ids, output_sel_idx, *state.fetch_state);
+		if (state.rhs_chunk.size() < output_sel_idx) {
+			// some of the row ids do not exist (in this transaction): fetch the rows one by one to drop them
+			D_ASSERT(!index);
+			state.rhs_chunk.Reset();
+			idx_t found_count = 0;
+			for (idx_t i = 0; i < output_sel_idx; i++) {
+				state.row_chunk.Reset();
+				Vector row_id(LogicalType::ROW_TYPE, (data_ptr_t)&fetch_rows[i]);
+				tbl->Fetch(transaction, state.row_chunk, fetch_ids, row_id, 1, *state.fetch_state);
+				if (state.row_chunk.size() == 1) {
+					state.rhs_chunk.Append(state.row_chunk);
+					state.rhs_sel.set_index(found_count++, state.rhs_sel.get_index(i));
+				}
+			}
+			output_sel_idx = found_count;
+		}
 	}
 
 	//! Now we actually produce our result chunk
@@ -141,7 +171,7 @@ void PhysicalIndexJoin::Output(ExecutionContext &context, DataChunk &input, Data
 		if (it == index_ids.end()) {
 			chunk.data[right_offset + i].Reference(state.rhs_chunk.data[rhs_column_idx++]);
 		} else {
-			chunk.data[right_offset + i].Slice(state.join_keys.data[0], state.rhs_sel, output_sel_idx);
+			chunk.data[right_offset + i].Slice(state.join_keys.data[it->second], state.rhs_sel, output_sel_idx);
 		}
 	}
 	for (idx_t i = 0; i < left_projection_map.size(); i++) {
@@ -155,16 +185,40 @@ void PhysicalIndexJoin::Output(ExecutionContext &context, DataChunk &input, Data
 void PhysicalIndexJoin::GetRHSMatches(ExecutionContext &context, DataChunk &input, OperatorState &state_p) const {
 
 	auto &state = (IndexJoinOperatorState &)state_p;
+	if (!index) {
+		// the keys are the row ids of the rows to fetch
+		UnifiedVectorFormat row_ids;
+		state.join_keys.data[0].ToUnifiedFormat(input.size(), row_ids);
+		auto row_id_data = (const row_t *)row_ids.data;
+		for (idx_t i = 0; i < input.size(); i++) {
+			state.rhs_rows[i].clear();
+			auto idx = row_ids.sel->get_index(i);
+			if (row_ids.validity.RowIsValid(idx)) {
+				state.rhs_rows[i].push_back(row_id_data[idx]);
+			}
+			state.result_sizes[i] = state.rhs_rows[i].size();
+		}
+		for (idx_t i = input.size(); i < STANDARD_VECTOR_SIZE; i++) {
+			state.result_sizes[i] = 0;
+		}
+		return;
+	}
 	auto &art = (ART &)*index;
 
 	// generate the keys for this chunk
 	state.arena_allocator.Reset();
 	ART::GenerateKeys(state.arena_allocator, state.join_keys, state.keys);
 
+	auto comparison = conditions[0].comparison;
 	for (idx_t i = 0; i < input.size(); i++) {
 		state.rhs_rows[i].clear();
 		if (!state.keys[i].Empty()) {
-			if (fetch_types.empty()) {
+			if (comparison != ExpressionType::COMPARE_EQUAL) {
+				IndexLock lock;
+				index->InitializeLock(lock);
+				art.SearchRangeJoin(state.keys[i], comparison, state.rhs_rows[i]);
+				state.result_sizes[i] = state.rhs_rows[i].size();
+			} else if (fetch_types.empty()) {
 				IndexLock lock;
 				index->InitializeLock(lock);
 				art.SearchEqualJoinNoFetch(state.keys[i], state.result_sizes[i]);
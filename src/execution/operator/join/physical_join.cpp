@@ -63,6 +63,7 @@ void PhysicalJoin::BuildJoinPipelines(Pipeline &current, MetaPipeline &meta_pipe
 	if (join_op.type == PhysicalOperatorType::HASH_JOIN) {
 		auto &hash_join_op = (PhysicalHashJoin &)join_op;
 		hash_join_op.can_go_external = !meta_pipeline.HasRecursiveCTE();
+		hash_join_op.PushDownBloomFilter(current, meta_pipeline);
 		if (hash_join_op.can_go_external) {
 			add_child_pipeline = true;
 		}
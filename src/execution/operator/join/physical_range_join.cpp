@@ -62,6 +62,7 @@ PhysicalRangeJoin::GlobalSortedTable::GlobalSortedTable(ClientContext &context,
 	// Set external (can be forced with the PRAGMA)
 	auto &config = ClientConfig::GetConfig(context);
 	global_sort_state.external = config.force_external;
+	global_sort_state.memory_limit = BufferManager::GetBufferManager(context).GetQueryMaxMemory(context);
 	memory_per_thread = PhysicalRangeJoin::GetMaxThreadMemory(context);
 }
 
@@ -93,7 +94,7 @@ public:
 		// Initialize iejoin sorted and iterate until done
 		auto &global_sort_state = table.global_sort_state;
 		MergeSorter merge_sorter(global_sort_state, BufferManager::GetBufferManager(context));
-		merge_sorter.PerformInMergeRound();
+		merge_sorter.PerformInMergeRound(context);
 		event->FinishTask();
 
 		return TaskExecutionResult::TASK_FINISHED;
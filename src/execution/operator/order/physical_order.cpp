@@ -61,6 +61,7 @@ unique_ptr<GlobalSinkState> PhysicalOrder::GetGlobalSinkState(ClientContext &con
 	auto state = make_unique<OrderGlobalState>(BufferManager::GetBufferManager(context), *this, payload_layout);
 	// Set external (can be force with the PRAGMA)
 	state->global_sort_state.external = ClientConfig::GetConfig(context).force_external;
+	state->global_sort_state.memory_limit = BufferManager::GetBufferManager(context).GetQueryMaxMemory(context);
 	state->memory_per_thread = GetMaxThreadMemory(context);
 	return move(state);
 }
@@ -118,7 +119,7 @@ public:
 		// Initialize merge sorted and iterate until done
 		auto &global_sort_state = state.global_sort_state;
 		MergeSorter merge_sorter(global_sort_state, BufferManager::GetBufferManager(context));
-		merge_sorter.PerformInMergeRound();
+		merge_sorter.PerformInMergeRound(context);
 		event->FinishTask();
 		return TaskExecutionResult::TASK_FINISHED;
 	}
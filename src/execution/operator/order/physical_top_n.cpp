@@ -1,19 +1,27 @@
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
 
 #include "duckdb/common/assert.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/types/row_layout.hpp"
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/null_filter.hpp"
 
 namespace duckdb {
 
 PhysicalTopN::PhysicalTopN(vector<LogicalType> types, vector<BoundOrderByNode> orders, idx_t limit, idx_t offset,
                            idx_t estimated_cardinality)
     : PhysicalOperator(PhysicalOperatorType::TOP_N, move(types), estimated_cardinality), orders(move(orders)),
-      limit(limit), offset(offset) {
+      limit(limit), offset(offset), dynamic_filter_column(DConstants::INVALID_INDEX) {
 }
 
 //===--------------------------------------------------------------------===//
@@ -84,10 +92,16 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduces the heap to limit + offset entries once it is large enough, returns true if it did
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
+	vector<Value> GetBoundaryValues();
+	void SetBoundaryValues(const vector<Value> &values);
+	//! Whether the boundary "left" excludes more rows than the boundary "right"
+	static bool BoundaryIsTighter(const vector<BoundOrderByNode> &orders, const vector<Value> &left,
+	                              const vector<Value> &right);
 
 	void InitializeScan(TopNScanState &state, bool exclude_offset);
 	void Scan(TopNScanState &state, DataChunk &chunk);
@@ -275,11 +289,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5, 2 * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +320,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return true;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -328,6 +343,47 @@ void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_c
 	has_boundary_values = true;
 }
 
+vector<Value> TopNHeap::GetBoundaryValues() {
+	D_ASSERT(has_boundary_values);
+	vector<Value> values;
+	for (idx_t col_idx = 0; col_idx < boundary_values.ColumnCount(); col_idx++) {
+		values.push_back(boundary_values.GetValue(col_idx, 0));
+	}
+	return values;
+}
+
+void TopNHeap::SetBoundaryValues(const vector<Value> &values) {
+	D_ASSERT(values.size() == boundary_values.ColumnCount());
+	boundary_values.Reset();
+	for (idx_t col_idx = 0; col_idx < values.size(); col_idx++) {
+		boundary_values.SetValue(col_idx, 0, values[col_idx]);
+		boundary_values.data[col_idx].SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+	boundary_values.SetCardinality(1);
+	has_boundary_values = true;
+}
+
+bool TopNHeap::BoundaryIsTighter(const vector<BoundOrderByNode> &orders, const vector<Value> &left,
+                                 const vector<Value> &right) {
+	for (idx_t i = 0; i < orders.size(); i++) {
+		auto &l = left[i];
+		auto &r = right[i];
+		const bool nulls_first = orders[i].null_order == OrderByNullType::NULLS_FIRST;
+		if (l.IsNull() || r.IsNull()) {
+			if (l.IsNull() && r.IsNull()) {
+				continue;
+			}
+			// the boundary that comes first in the ordering is the tighter one
+			return l.IsNull() == nulls_first;
+		}
+		if (l == r) {
+			continue;
+		}
+		return (l < r) == (orders[i].type == OrderType::ASCENDING);
+	}
+	return false;
+}
+
 bool TopNHeap::CheckBoundaryValues(DataChunk &sort_chunk, DataChunk &payload) {
 	// we have boundary values
 	// from these boundary values, determine which values we should insert (if any)
@@ -403,25 +459,55 @@ void TopNHeap::Scan(TopNScanState &state, DataChunk &chunk) {
 	sort_state.Scan(state, chunk);
 }
 
+class TopNLocalState : public LocalSinkState {
+public:
+	TopNLocalState(ExecutionContext &context, const vector<LogicalType> &payload_types,
+	               const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
+	    : heap(context, payload_types, orders, limit, offset), boundary_version(0) {
+	}
+
+	TopNHeap heap;
+	//! The version of the shared boundary that was last seen by this thread
+	idx_t boundary_version;
+};
+
 class TopNGlobalState : public GlobalSinkState {
 public:
 	TopNGlobalState(ClientContext &context, const vector<LogicalType> &payload_types,
 	                const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
-	    : heap(context, payload_types, orders, limit, offset) {
+	    : heap(context, payload_types, orders, limit, offset), boundary_version(0) {
 	}
 
 	mutex lock;
 	TopNHeap heap;
-};
 
-class TopNLocalState : public LocalSinkState {
+	//! The tightest boundary of any local heap: every local heap holds limit + offset rows up to its own boundary,
+	//! so no row beyond any of these boundaries can be part of the result
+	mutex boundary_lock;
+	vector<Value> boundary;
+	//! Incremented whenever the shared boundary is tightened
+	atomic<idx_t> boundary_version;
+
 public:
-	TopNLocalState(ExecutionContext &context, const vector<LogicalType> &payload_types,
-	               const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
-	    : heap(context, payload_types, orders, limit, offset) {
+	//! Publishes the boundary of the local heap if it is tighter than the shared one, and adopts the shared
+	//! boundary in the local heap if it is tighter than the local one
+	void UpdateBoundary(const PhysicalTopN &op, TopNLocalState &lstate) {
+		auto &local_heap = lstate.heap;
+		lock_guard<mutex> l(boundary_lock);
+		if (local_heap.has_boundary_values) {
+			auto local_boundary = local_heap.GetBoundaryValues();
+			if (boundary.empty() || TopNHeap::BoundaryIsTighter(op.orders, local_boundary, boundary)) {
+				boundary = move(local_boundary);
+				boundary_version++;
+				op.SetDynamicFilter(boundary[0]);
+			}
+		}
+		if (!boundary.empty() && (!local_heap.has_boundary_values ||
+		                          TopNHeap::BoundaryIsTighter(op.orders, boundary, local_heap.GetBoundaryValues()))) {
+			local_heap.SetBoundaryValues(boundary);
+		}
+		lstate.boundary_version = boundary_version;
 	}
-
-	TopNHeap heap;
 };
 
 unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &context) const {
@@ -429,18 +515,109 @@ unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &con
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
+	if (dynamic_filters) {
+		// the filter of a previous execution of this plan does not apply anymore
+		dynamic_filters->Reset();
+	}
 	return make_unique<TopNGlobalState>(context, types, orders, limit, offset);
 }
 
+//===--------------------------------------------------------------------===//
+// Dynamic Filter
+//===--------------------------------------------------------------------===//
+void PhysicalTopN::PushDownDynamicFilter() {
+	D_ASSERT(children.size() == 1);
+	auto &first_order = *orders[0].expression;
+	if (limit == 0 || first_order.type != ExpressionType::BOUND_REF) {
+		return;
+	}
+	// look through filters and projections for the table scan that produces the first ORDER BY column
+	auto column = ((BoundReferenceExpression &)first_order).index;
+	auto op = children[0].get();
+	while (op->type != PhysicalOperatorType::TABLE_SCAN) {
+		const vector<unique_ptr<Expression>> *select_list;
+		if (op->type == PhysicalOperatorType::PROJECTION) {
+			select_list = &((PhysicalProjection &)*op).select_list;
+		} else if (op->type == PhysicalOperatorType::FILTER) {
+			// filters without a fused projection do not change the column layout
+			auto &filter = (PhysicalFilter &)*op;
+			select_list = filter.projections.empty() ? nullptr : &filter.projections;
+		} else {
+			return;
+		}
+		if (select_list) {
+			auto &expr = *(*select_list)[column];
+			if (expr.type != ExpressionType::BOUND_REF) {
+				return;
+			}
+			column = ((BoundReferenceExpression &)expr).index;
+			if (column >= op->children[0]->types.size()) {
+				// a column that is computed by the filter itself
+				return;
+			}
+		}
+		op = op->children[0].get();
+	}
+	auto &scan = (PhysicalTableScan &)*op;
+	if (!scan.function.filter_pushdown || scan.dynamic_filters) {
+		return;
+	}
+	// table filters refer to the column ids of the scan, not to the (projected) output columns
+	if (!scan.projection_ids.empty()) {
+		column = scan.projection_ids[column];
+	}
+	if (scan.column_ids[column] == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+	dynamic_filters = make_shared<DynamicTableFilterSet>();
+	dynamic_filter_column = column;
+	scan.dynamic_filters = dynamic_filters;
+}
+
+void PhysicalTopN::SetDynamicFilter(const Value &boundary) const {
+	if (!dynamic_filters) {
+		return;
+	}
+	auto &order = orders[0];
+	const bool nulls_first = order.null_order == OrderByNullType::NULLS_FIRST;
+	unique_ptr<TableFilter> filter;
+	if (boundary.IsNull()) {
+		if (!nulls_first) {
+			// every row comes before a NULL boundary
+			return;
+		}
+		filter = make_unique<IsNullFilter>();
+	} else {
+		// rows that are equal to the boundary are kept: they can still win on the next ORDER BY column
+		auto comparison = order.type == OrderType::ASCENDING ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+		                                                     : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+		filter = make_unique<ConstantFilter>(comparison, boundary);
+		if (nulls_first) {
+			auto or_filter = make_unique<ConjunctionOrFilter>();
+			or_filter->child_filters.push_back(move(filter));
+			or_filter->child_filters.push_back(make_unique<IsNullFilter>());
+			filter = move(or_filter);
+		}
+	}
+	auto filters = make_unique<TableFilterSet>();
+	filters->PushFilter(dynamic_filter_column, move(filter));
+	dynamic_filters->SetFilters(move(filters));
+}
+
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
 SinkResultType PhysicalTopN::Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
                                   DataChunk &input) const {
 	// append to the local sink state
+	auto &gstate = (TopNGlobalState &)state;
 	auto &sink = (TopNLocalState &)lstate;
 	sink.heap.Sink(input);
-	sink.heap.Reduce();
+	auto reduced = sink.heap.Reduce();
+	if (reduced || sink.boundary_version != gstate.boundary_version) {
+		// share the boundary of this thread with the other threads, or take theirs if it is tighter
+		gstate.UpdateBoundary(*this, sink);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
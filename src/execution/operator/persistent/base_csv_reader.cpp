@@ -5,6 +5,11 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/to_string.hpp"
 #include "duckdb/common/types/cast_helpers.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/interval.hpp"
+#include "duckdb/common/types/time.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/scalar/strftime.hpp"
@@ -135,6 +140,192 @@ bool TryCastTimestampVector(BufferedCSVReaderOptions &options, Vector &input_vec
 	                                                                         count, error_message);
 }
 
+//! Parses exactly count decimal digits
+static inline bool TryParseDigits(const char *buf, idx_t count, int32_t &result) {
+	result = 0;
+	for (idx_t i = 0; i < count; i++) {
+		uint8_t digit = buf[i] - '0';
+		if (digit > 9) {
+			return false;
+		}
+		result = result * 10 + digit;
+	}
+	return true;
+}
+
+//! The fast paths only accept the most common formats of CSV values, anything else (e.g. whitespace, exponents or
+//! other date formats) is left to the regular cast, which produces the same results for the accepted formats
+struct CSVFastCastInteger {
+	//! [-]digits, with at most 18 digits so the value can not overflow
+	template <class T>
+	static inline bool Operation(const char *buf, idx_t len, T &result) {
+		idx_t pos = len > 0 && buf[0] == '-' ? 1 : 0;
+		if (pos == len || len - pos > 18) {
+			return false;
+		}
+		int64_t value = 0;
+		for (idx_t i = pos; i < len; i++) {
+			uint8_t digit = buf[i] - '0';
+			if (digit > 9) {
+				return false;
+			}
+			value = value * 10 + digit;
+		}
+		value = pos > 0 ? -value : value;
+		if (value < NumericLimits<T>::Minimum() || value > NumericLimits<T>::Maximum()) {
+			return false;
+		}
+		result = T(value);
+		return true;
+	}
+};
+
+struct CSVFastCastDecimal {
+	//! [-]digits[.digits], with no more fractional digits than the scale (which would require rounding)
+	template <class T>
+	static inline bool Operation(const char *buf, idx_t len, T &result, uint8_t width, uint8_t scale) {
+		idx_t pos = len > 0 && buf[0] == '-' ? 1 : 0;
+		if (pos == len || len - pos > 19) {
+			return false;
+		}
+		uint64_t value = 0;
+		idx_t integer_digits = 0;
+		idx_t fraction_digits = 0;
+		bool in_fraction = false;
+		for (idx_t i = pos; i < len; i++) {
+			if (buf[i] == '.' && !in_fraction) {
+				in_fraction = true;
+				continue;
+			}
+			uint8_t digit = buf[i] - '0';
+			if (digit > 9) {
+				return false;
+			}
+			value = value * 10 + digit;
+			if (in_fraction) {
+				fraction_digits++;
+			} else {
+				integer_digits++;
+			}
+		}
+		if (integer_digits == 0 || (in_fraction && fraction_digits == 0) || integer_digits > idx_t(width - scale) ||
+		    fraction_digits > scale) {
+			return false;
+		}
+		auto decimal = int64_t(value) * NumericHelper::POWERS_OF_TEN[scale - fraction_digits];
+		result = T(pos > 0 ? -decimal : decimal);
+		return true;
+	}
+};
+
+struct CSVFastCastDate {
+	//! YYYY-MM-DD
+	static inline bool Operation(const char *buf, idx_t len, date_t &result) {
+		if (len != 10 || buf[4] != '-' || buf[7] != '-') {
+			return false;
+		}
+		int32_t year, month, day;
+		if (!TryParseDigits(buf, 4, year) || !TryParseDigits(buf + 5, 2, month) || !TryParseDigits(buf + 8, 2, day) ||
+		    year == 0) {
+			return false;
+		}
+		return Date::TryFromDate(year, month, day, result);
+	}
+};
+
+struct CSVFastCastTimestamp {
+	//! YYYY-MM-DD HH:MM:SS
+	static inline bool Operation(const char *buf, idx_t len, timestamp_t &result) {
+		if (len != 19 || buf[10] != ' ' || buf[13] != ':' || buf[16] != ':') {
+			return false;
+		}
+		date_t date;
+		int32_t hour, minute, second;
+		if (!CSVFastCastDate::Operation(buf, 10, date) || !TryParseDigits(buf + 11, 2, hour) ||
+		    !TryParseDigits(buf + 14, 2, minute) || !TryParseDigits(buf + 17, 2, second)) {
+			return false;
+		}
+		if (hour >= Interval::HOURS_PER_DAY || minute >= Interval::MINS_PER_HOUR ||
+		    second >= Interval::SECS_PER_MINUTE) {
+			return false;
+		}
+		return Timestamp::TryFromDatetime(date, Time::FromTime(hour, minute, second), result);
+	}
+};
+
+template <class T, class FUNC>
+static bool TemplatedTryFastCastVector(Vector &input_vector, Vector &result_vector, idx_t count, FUNC fun) {
+	D_ASSERT(input_vector.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto input_data = FlatVector::GetData<string_t>(input_vector);
+	auto &input_validity = FlatVector::Validity(input_vector);
+	result_vector.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result_vector);
+	for (idx_t i = 0; i < count; i++) {
+		if (!input_validity.RowIsValid(i)) {
+			continue;
+		}
+		if (!fun(input_data[i].GetDataUnsafe(), input_data[i].GetSize(), result_data[i])) {
+			return false;
+		}
+	}
+	FlatVector::SetValidity(result_vector, input_validity);
+	return true;
+}
+
+template <class T>
+static bool TryFastCastIntegerVector(Vector &input_vector, Vector &result_vector, idx_t count) {
+	return TemplatedTryFastCastVector<T>(input_vector, result_vector, count,
+	                                     [&](const char *buf, idx_t len, T &result) {
+		                                     return CSVFastCastInteger::Operation<T>(buf, len, result);
+	                                     });
+}
+
+template <class T>
+static bool TryFastCastDecimalVector(Vector &input_vector, Vector &result_vector, idx_t count, uint8_t width,
+                                     uint8_t scale) {
+	return TemplatedTryFastCastVector<T>(input_vector, result_vector, count,
+	                                     [&](const char *buf, idx_t len, T &result) {
+		                                     return CSVFastCastDecimal::Operation<T>(buf, len, result, width, scale);
+	                                     });
+}
+
+//! Casts the common formats of integers, decimals, dates and timestamps directly from the parsed values, without the
+//! overhead of the generic cast. Returns false if any value is not in one of these formats.
+static bool TryFastCastVector(Vector &input_vector, Vector &result_vector, idx_t count) {
+	auto &type = result_vector.GetType();
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+		return TryFastCastIntegerVector<int8_t>(input_vector, result_vector, count);
+	case LogicalTypeId::SMALLINT:
+		return TryFastCastIntegerVector<int16_t>(input_vector, result_vector, count);
+	case LogicalTypeId::INTEGER:
+		return TryFastCastIntegerVector<int32_t>(input_vector, result_vector, count);
+	case LogicalTypeId::BIGINT:
+		return TryFastCastIntegerVector<int64_t>(input_vector, result_vector, count);
+	case LogicalTypeId::DECIMAL: {
+		auto width = DecimalType::GetWidth(type);
+		auto scale = DecimalType::GetScale(type);
+		switch (type.InternalType()) {
+		case PhysicalType::INT16:
+			return TryFastCastDecimalVector<int16_t>(input_vector, result_vector, count, width, scale);
+		case PhysicalType::INT32:
+			return TryFastCastDecimalVector<int32_t>(input_vector, result_vector, count, width, scale);
+		case PhysicalType::INT64:
+			return TryFastCastDecimalVector<int64_t>(input_vector, result_vector, count, width, scale);
+		default:
+			return false;
+		}
+	}
+	case LogicalTypeId::DATE:
+		return TemplatedTryFastCastVector<date_t>(input_vector, result_vector, count, CSVFastCastDate::Operation);
+	case LogicalTypeId::TIMESTAMP:
+		return TemplatedTryFastCastVector<timestamp_t>(input_vector, result_vector, count,
+		                                               CSVFastCastTimestamp::Operation);
+	default:
+		return false;
+	}
+}
+
 bool BaseCSVReader::TryCastVector(Vector &parse_chunk_col, idx_t size, const LogicalType &sql_type) {
 	// try vector-cast from string to sql_type
 	Vector dummy_result(sql_type);
@@ -179,6 +370,12 @@ void BaseCSVReader::AddValue(string_t str_val, idx_t &column, vector<idx_t> &esc
 			    GetLineNumberStr(linenr, linenr_estimated).c_str(), sql_types.size(), options.ToString());
 		}
 	}
+	if (mode == ParserMode::PARSING && !skipped_cols.empty() && skipped_cols[column]) {
+		// the column is not used by the query
+		escape_positions.clear();
+		column++;
+		return;
+	}
 
 	// insert the line number into the chunk
 	idx_t row_entry = parse_chunk.size();
@@ -284,6 +481,26 @@ void BaseCSVReader::SetNullUnionCols(DataChunk &insert_chunk) {
 	}
 }
 
+void BaseCSVReader::SetProjection(const vector<column_t> &column_ids) {
+	skipped_cols.clear();
+	if (options.ignore_errors) {
+		// rows with values that cannot be converted are skipped: every column has to be converted
+		return;
+	}
+	unordered_set<column_t> used_cols(column_ids.begin(), column_ids.end());
+	bool any_skipped = false;
+	vector<bool> result(sql_types.size(), false);
+	for (idx_t col = 0; col < sql_types.size(); col++) {
+		if (used_cols.find(insert_cols_idx[col]) == used_cols.end()) {
+			result[col] = true;
+			any_skipped = true;
+		}
+	}
+	if (any_skipped) {
+		skipped_cols = move(result);
+	}
+}
+
 void BaseCSVReader::VerifyUTF8(idx_t col_idx, idx_t row_idx, DataChunk &chunk, int64_t offset) {
 	D_ASSERT(col_idx < chunk.data.size());
 	D_ASSERT(row_idx < chunk.size());
@@ -326,7 +543,12 @@ bool BaseCSVReader::Flush(DataChunk &insert_chunk, bool try_add_line) {
 	// convert the columns in the parsed chunk to the types of the table
 	insert_chunk.SetCardinality(parse_chunk);
 	for (idx_t col_idx = 0; col_idx < sql_types.size(); col_idx++) {
-		if (sql_types[col_idx].id() == LogicalTypeId::VARCHAR) {
+		if (!skipped_cols.empty() && skipped_cols[col_idx]) {
+			// the column is not used by the query: its values were not stored
+			auto &insert_col = insert_chunk.data[insert_cols_idx[col_idx]];
+			insert_col.SetVectorType(VectorType::CONSTANT_VECTOR);
+			ConstantVector::SetNull(insert_col, true);
+		} else if (sql_types[col_idx].id() == LogicalTypeId::VARCHAR) {
 			// target type is varchar: no need to convert
 			// just test that all strings are valid utf-8 strings
 			VerifyUTF8(col_idx);
@@ -345,6 +567,10 @@ bool BaseCSVReader::Flush(DataChunk &insert_chunk, bool try_add_line) {
 				success = TryCastTimestampVector(options, parse_chunk.data[col_idx],
 				                                 insert_chunk.data[insert_cols_idx[col_idx]], parse_chunk.size(),
 				                                 error_message);
+			} else if (TryFastCastVector(parse_chunk.data[col_idx], insert_chunk.data[insert_cols_idx[col_idx]],
+			                             parse_chunk.size())) {
+				// all values are in a common format that was parsed directly
+				success = true;
 			} else {
 				// target type is not varchar: perform a cast
 				success = VectorOperations::DefaultTryCast(parse_chunk.data[col_idx],
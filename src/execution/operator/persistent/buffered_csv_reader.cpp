@@ -7,6 +7,7 @@
 #include "duckdb/common/types/cast_helpers.hpp"
 #include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/operator/persistent/csv_character_search.hpp"
 #include "duckdb/function/scalar/strftime.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/column_definition.hpp"
@@ -1113,6 +1114,14 @@ bool BufferedCSVReader::TryParseSimpleCSV(DataChunk &insert_chunk, string &error
 	idx_t offset = 0;
 	bool has_quotes = false;
 	vector<idx_t> escape_positions;
+	// the characters that end an unquoted value, and the characters that are special within a quoted value
+	CSVCharacterSearch value_search;
+	value_search.AddCharacter(options.delimiter[0]);
+	value_search.AddCharacter('\n');
+	value_search.AddCharacter('\r');
+	CSVCharacterSearch quoted_search;
+	quoted_search.AddCharacter(options.quote[0]);
+	quoted_search.AddCharacter(options.escape[0]);
 
 	// read values into the buffer (if any)
 	if (position >= buffer_size) {
@@ -1140,11 +1149,12 @@ normal:
 	/* state: normal parsing state */
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
 	do {
-		for (; position < buffer_size; position++) {
+		position = value_search.Find(buffer.get(), position, buffer_size);
+		if (position < buffer_size) {
 			if (buffer[position] == options.delimiter[0]) {
 				// delimiter: end the value and add it to the chunk
 				goto add_value;
-			} else if (StringUtil::CharacterIsNewline(buffer[position])) {
+			} else {
 				// newline: add row
 				goto add_row;
 			}
@@ -1193,11 +1203,12 @@ in_quotes:
 	has_quotes = true;
 	position++;
 	do {
-		for (; position < buffer_size; position++) {
+		position = quoted_search.Find(buffer.get(), position, buffer_size);
+		if (position < buffer_size) {
 			if (buffer[position] == options.quote[0]) {
 				// quote: move to unquoted state
 				goto unquote;
-			} else if (buffer[position] == options.escape[0]) {
+			} else {
 				// escape: store the escaped position and move to handle_escape state
 				escape_positions.push_back(position - start);
 				goto handle_escape;
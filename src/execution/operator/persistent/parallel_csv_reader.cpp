@@ -24,6 +24,84 @@
 
 namespace duckdb {
 
+CSVRowScanner::CSVRowScanner(const BufferedCSVReaderOptions &options)
+    : state(ScannerState::ROW_START), delimiter(options.delimiter[0]), quote(options.quote[0]),
+      quote_escapes_quote(options.escape.empty() || options.escape[0] == options.quote[0]) {
+	value_search.AddCharacter(delimiter);
+	value_search.AddCharacter('\n');
+	value_search.AddCharacter('\r');
+	quoted_search.AddCharacter(quote);
+	quoted_search.AddCharacter(options.escape[0]);
+}
+
+void CSVRowScanner::Reset() {
+	state = ScannerState::ROW_START;
+}
+
+bool CSVRowScanner::NextRowStart(const char *data, idx_t &position, idx_t end, idx_t target, idx_t &row_count) {
+	while (position < end) {
+		switch (state) {
+		case ScannerState::ROW_START:
+			if (position >= target) {
+				return true;
+			}
+			DUCKDB_EXPLICIT_FALLTHROUGH;
+		case ScannerState::VALUE_START:
+			if (data[position] == quote) {
+				position++;
+				state = ScannerState::IN_QUOTES;
+			} else {
+				state = ScannerState::NORMAL;
+			}
+			break;
+		case ScannerState::NORMAL: {
+			position = value_search.Find(data, position, end);
+			if (position >= end) {
+				break;
+			}
+			auto c = data[position++];
+			if (c == delimiter) {
+				state = ScannerState::VALUE_START;
+			} else {
+				row_count++;
+				state = c == '\r' ? ScannerState::CARRIAGE_RETURN : ScannerState::ROW_START;
+			}
+			break;
+		}
+		case ScannerState::IN_QUOTES:
+			position = quoted_search.Find(data, position, end);
+			if (position >= end) {
+				break;
+			}
+			state = data[position++] == quote ? ScannerState::UNQUOTE : ScannerState::ESCAPE;
+			break;
+		case ScannerState::UNQUOTE:
+			if (data[position] == quote && quote_escapes_quote) {
+				// escaped quote: the value remains quoted
+				position++;
+				state = ScannerState::IN_QUOTES;
+			} else {
+				state = ScannerState::NORMAL;
+			}
+			break;
+		case ScannerState::ESCAPE:
+			// skip the escaped character
+			position++;
+			state = ScannerState::IN_QUOTES;
+			break;
+		case ScannerState::CARRIAGE_RETURN:
+			// \r\n is a single newline
+			if (data[position] == '\n') {
+				position++;
+			}
+			state = ScannerState::ROW_START;
+			break;
+		}
+	}
+	position = end;
+	return state == ScannerState::ROW_START && position >= target;
+}
+
 ParallelCSVReader::ParallelCSVReader(ClientContext &context, BufferedCSVReaderOptions options_p,
                                      unique_ptr<CSVBufferRead> buffer_p, const vector<LogicalType> &requested_types)
     : BaseCSVReader(context, move(options_p), requested_types) {
@@ -32,6 +110,11 @@ ParallelCSVReader::ParallelCSVReader(ClientContext &context, BufferedCSVReaderOp
 	if (options.delimiter.size() > 1 || options.escape.size() > 1 || options.quote.size() > 1) {
 		throw InternalException("Parallel CSV reader cannot handle CSVs with multi-byte delimiters/escapes/quotes");
 	}
+	value_search.AddCharacter(options.delimiter[0]);
+	value_search.AddCharacter('\n');
+	value_search.AddCharacter('\r');
+	quoted_search.AddCharacter(options.quote[0]);
+	quoted_search.AddCharacter(options.escape[0]);
 }
 
 ParallelCSVReader::~ParallelCSVReader() {
@@ -43,56 +126,6 @@ void ParallelCSVReader::Initialize(const vector<LogicalType> &requested_types) {
 	InitInsertChunkIdx(sql_types.size());
 }
 
-bool ParallelCSVReader::SetPosition(DataChunk &insert_chunk) {
-	if (buffer->buffer->IsCSVFileFirstBuffer() && start_buffer == position_buffer &&
-	    start_buffer == buffer->buffer->GetStart()) {
-		// First buffer doesn't need any setting
-		// Unless we have a header
-		if (options.header && options.auto_detect) {
-			for (; position_buffer < end_buffer; position_buffer++) {
-				if (StringUtil::CharacterIsNewline((*buffer)[position_buffer])) {
-					position_buffer++;
-					return true;
-				}
-			}
-			return false;
-		}
-		return true;
-	}
-
-	// We have to move position up to next new line
-	idx_t end_buffer_real = end_buffer;
-	// Check if we already start in a valid line
-	string error_message;
-	bool successfully_read_first_line = false;
-	while (!successfully_read_first_line) {
-		DataChunk first_line_chunk;
-		first_line_chunk.Initialize(allocator, insert_chunk.GetTypes());
-		for (; position_buffer < end_buffer; position_buffer++) {
-			if (StringUtil::CharacterIsNewline((*buffer)[position_buffer])) {
-				position_buffer++;
-				break;
-			}
-		}
-		D_ASSERT(position_buffer <= end_buffer);
-		if (position_buffer == end_buffer && !StringUtil::CharacterIsNewline((*buffer)[position_buffer - 1])) {
-			break;
-		}
-		idx_t position_set = position_buffer;
-		start_buffer = position_buffer;
-		// We check if we can add this line
-		successfully_read_first_line = TryParseSimpleCSV(first_line_chunk, error_message, true);
-		start_buffer = position_set;
-		end_buffer = end_buffer_real;
-		position_buffer = position_set;
-		if (end_buffer == position_buffer) {
-			break;
-		}
-	}
-
-	return successfully_read_first_line;
-}
-
 void ParallelCSVReader::SetBufferRead(unique_ptr<CSVBufferRead> buffer_read_p) {
 	if (!buffer_read_p->buffer) {
 		throw InternalException("ParallelCSVReader::SetBufferRead - CSVBufferRead does not have a buffer to read");
@@ -105,33 +138,14 @@ void ParallelCSVReader::SetBufferRead(unique_ptr<CSVBufferRead> buffer_read_p) {
 	} else {
 		buffer_size = buffer_read_p->buffer->GetBufferSize();
 	}
-	linenr = buffer_read_p->estimated_linenr;
+	// the pieces start at row boundaries that were found by the global state, so the line number is exact
+	linenr = buffer_read_p->linenr;
+	linenr_estimated = false;
 	buffer = move(buffer_read_p);
-
-	linenr_estimated = true;
-	reached_remainder_state = false;
 	D_ASSERT(end_buffer <= buffer_size);
 }
 
-// If BufferRemainder returns false, it means we are done scanning this buffer and should go to the end_state
-bool ParallelCSVReader::BufferRemainder() {
-	if (position_buffer >= end_buffer && !reached_remainder_state) {
-		// First time we finish the buffer piece we should scan here, we set the variables
-		// to allow this piece to be scanned up to the end of the buffer or the next new line
-		reached_remainder_state = true;
-		// end_buffer is allowed to go to buffer size to finish its last line
-		end_buffer = buffer_size;
-	}
-	if (position_buffer >= end_buffer) {
-		// buffer ends, return false
-		return false;
-	}
-	// we can still scan stuff, return true
-	return true;
-}
-
-bool ParallelCSVReader::TryParseSimpleCSV(DataChunk &insert_chunk, string &error_message, bool try_add_line) {
-
+bool ParallelCSVReader::TryParseSimpleCSV(DataChunk &insert_chunk, string &error_message) {
 	// used for parsing algorithm
 	D_ASSERT(end_buffer <= buffer_size);
 	bool finished_chunk = false;
@@ -139,24 +153,17 @@ bool ParallelCSVReader::TryParseSimpleCSV(DataChunk &insert_chunk, string &error
 	idx_t offset = 0;
 	bool has_quotes = false;
 	vector<idx_t> escape_positions;
-	if (start_buffer == buffer->buffer_start && !try_add_line) {
-		// First time reading this buffer piece
-		if (!SetPosition(insert_chunk)) {
-			// This means the buffer size does not contain a new line
-			return true;
-		}
-	}
+	idx_t line_start = position_buffer;
 
+	if (position_buffer >= end_buffer) {
+		goto final_state;
+	}
 	// start parsing the first value
 	goto value_start;
 
-value_start : {
-	/* state: value_start */
-	if (!BufferRemainder()) {
-		goto final_state;
-	}
+value_start:
 	offset = 0;
-
+	/* state: value_start */
 	// this state parses the first character of a value
 	if ((*buffer)[position_buffer] == options.quote[0]) {
 		// quote: actual value starts in the next position
@@ -168,69 +175,44 @@ value_start : {
 		start_buffer = position_buffer;
 		goto normal;
 	}
-};
-
-normal : {
+normal:
 	/* state: normal parsing state */
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
-	for (; position_buffer < end_buffer; position_buffer++) {
-		auto c = (*buffer)[position_buffer];
-		if (c == options.delimiter[0]) {
-			// delimiter: end the value and add it to the chunk
-			goto add_value;
-		} else if (StringUtil::CharacterIsNewline(c)) {
-			// newline: add row
-			if (column > 0 || try_add_line) {
-				goto add_row;
-			}
-		}
-	}
-	if (!BufferRemainder()) {
+	position_buffer = buffer->Find(value_search, position_buffer, end_buffer);
+	if (position_buffer >= end_buffer) {
+		// the piece ends during normal scan: go to end state
 		goto final_state;
-	} else {
-		goto normal;
 	}
-};
-
-add_value : {
-	/* state: Add value to string vector */
+	if ((*buffer)[position_buffer] == options.delimiter[0]) {
+		// delimiter: end the value and add it to the chunk
+		goto add_value;
+	}
+	// newline: add row
+	goto add_row;
+add_value:
 	AddValue(buffer->GetValue(start_buffer, position_buffer, offset), column, escape_positions, has_quotes);
 	// increase position by 1 and move start to the new position
 	offset = 0;
 	has_quotes = false;
 	start_buffer = ++position_buffer;
-	if (!BufferRemainder()) {
+	if (position_buffer >= end_buffer) {
+		// the piece ends right after the delimiter, go to final state
 		goto final_state;
 	}
 	goto value_start;
-};
-
 add_row : {
-	/* state: Add Row to Parse chunk */
 	// check type of newline (\r or \n)
 	bool carriage_return = (*buffer)[position_buffer] == '\r';
-
+	VerifyLineLength(line_start);
 	AddValue(buffer->GetValue(start_buffer, position_buffer, offset), column, escape_positions, has_quotes);
-	if (try_add_line) {
-		bool success = column == insert_chunk.ColumnCount();
-		if (success) {
-			AddRow(insert_chunk, column);
-			success = Flush(insert_chunk);
-		}
-		reached_remainder_state = false;
-		parse_chunk.Reset();
-		return success;
-	} else {
-		finished_chunk = AddRow(insert_chunk, column);
-	}
+	finished_chunk = AddRow(insert_chunk, column);
 	// increase position by 1 and move start to the new position
 	offset = 0;
 	has_quotes = false;
 	start_buffer = ++position_buffer;
-	if (reached_remainder_state || finished_chunk) {
-		goto final_state;
-	}
-	if (!BufferRemainder()) {
+	line_start = position_buffer;
+	if (position_buffer >= end_buffer) {
+		// the piece ends right after the newline, go to final state
 		goto final_state;
 	}
 	if (carriage_return) {
@@ -239,49 +221,36 @@ add_row : {
 	} else {
 		// \n newline, move to value start
 		if (finished_chunk) {
-			goto final_state;
+			return true;
 		}
 		goto value_start;
 	}
 }
 in_quotes:
-	/* state: in_quotes this state parses the remainder of a quoted value*/
+	/* state: in_quotes */
+	// this state parses the remainder of a quoted value
 	has_quotes = true;
-	position_buffer++;
-	for (; position_buffer < end_buffer; position_buffer++) {
-		auto c = (*buffer)[position_buffer];
-		if (c == options.quote[0]) {
-			// quote: move to unquoted state
-			goto unquote;
-		} else if (c == options.escape[0]) {
-			// escape: store the escaped position and move to handle_escape state
-			escape_positions.push_back(position_buffer - start_buffer);
-			goto handle_escape;
-		}
+	position_buffer = buffer->Find(quoted_search, position_buffer + 1, end_buffer);
+	if (position_buffer >= end_buffer) {
+		// pieces never end within a quoted value, so the quotes are not terminated in the file
+		throw InvalidInputException("Error in file \"%s\" on line %s: unterminated quotes. (%s)", options.file_path,
+		                            GetLineNumberStr(linenr, linenr_estimated).c_str(), options.ToString());
 	}
-	if (!BufferRemainder()) {
-		if (buffer->buffer->IsCSVFileLastBuffer()) {
-			if (try_add_line) {
-				return false;
-			}
-			// still in quoted state at the end of the file or at the end of a buffer when running multithreaded, error:
-			throw InvalidInputException("Error in file \"%s\" on line %s: unterminated quotes. (%s)", options.file_path,
-			                            GetLineNumberStr(linenr, linenr_estimated).c_str(), options.ToString());
-		} else {
-			goto final_state;
-		}
-	} else {
-		position_buffer--;
-		goto in_quotes;
+	if ((*buffer)[position_buffer] == options.quote[0]) {
+		// quote: move to unquoted state
+		goto unquote;
 	}
-
+	// escape: store the escaped position and move to handle_escape state
+	escape_positions.push_back(position_buffer - start_buffer);
+	goto handle_escape;
 unquote : {
-	/* state: unquote: this state handles the state directly after we unquote*/
-	//
+	/* state: unquote */
+	// this state handles the state directly after we unquote
 	// in this state we expect either another quote (entering the quoted state again, and escaping the quote)
 	// or a delimiter/newline, ending the current value and moving on to the next value
 	position_buffer++;
-	if (!BufferRemainder()) {
+	if (position_buffer >= end_buffer) {
+		// the piece ends right after unquote, go to final state
 		offset = 1;
 		goto final_state;
 	}
@@ -296,34 +265,21 @@ unquote : {
 		goto add_value;
 	} else if (StringUtil::CharacterIsNewline(c)) {
 		offset = 1;
-		D_ASSERT(column == insert_chunk.ColumnCount() - 1);
 		goto add_row;
-	} else if (position_buffer >= end_buffer) {
-		// reached end of buffer
-		offset = 1;
-		goto final_state;
 	} else {
 		error_message = StringUtil::Format(
 		    "Error in file \"%s\" on line %s: quote should be followed by end of value, end of "
-		    "row or another quote. (%s). ",
+		    "row or another quote. (%s)",
 		    options.file_path, GetLineNumberStr(linenr, linenr_estimated).c_str(), options.ToString());
 		return false;
 	}
 }
-handle_escape : {
+handle_escape:
 	/* state: handle_escape */
 	// escape should be followed by a quote or another escape character
 	position_buffer++;
-	if (!BufferRemainder()) {
-		goto final_state;
-	}
-	if (position_buffer >= buffer_size && buffer->buffer->IsCSVFileLastBuffer()) {
-		error_message = StringUtil::Format(
-		    "Error in file \"%s\" on line %s: neither QUOTE nor ESCAPE is proceeded by ESCAPE. (%s)", options.file_path,
-		    GetLineNumberStr(linenr, linenr_estimated).c_str(), options.ToString());
-		return false;
-	}
-	if ((*buffer)[position_buffer] != options.quote[0] && (*buffer)[position_buffer] != options.escape[0]) {
+	if (position_buffer >= end_buffer || ((*buffer)[position_buffer] != options.quote[0] &&
+	                                      (*buffer)[position_buffer] != options.escape[0])) {
 		error_message = StringUtil::Format(
 		    "Error in file \"%s\" on line %s: neither QUOTE nor ESCAPE is proceeded by ESCAPE. (%s)", options.file_path,
 		    GetLineNumberStr(linenr, linenr_estimated).c_str(), options.ToString());
@@ -331,54 +287,46 @@ handle_escape : {
 	}
 	// escape was followed by quote or escape, go back to quoted state
 	goto in_quotes;
-}
-
-carriage_return : {
+carriage_return:
 	/* state: carriage_return */
 	// this stage optionally skips a newline (\n) character, which allows \r\n to be interpreted as a single line
 	if ((*buffer)[position_buffer] == '\n') {
 		// newline after carriage return: skip
 		// increase position by 1 and move start to the new position
 		start_buffer = ++position_buffer;
-		if (position_buffer >= buffer_size) {
-			// file ends right after delimiter, go to final state
+		line_start = position_buffer;
+		if (position_buffer >= end_buffer) {
+			// the piece ends right after the newline, go to final state
 			goto final_state;
 		}
 	}
+	if (finished_chunk) {
+		return true;
+	}
 	goto value_start;
-}
-final_state : {
-	/* state: final_stage reached after we finished reading the end_buffer of the csv buffer */
-	// reset end buffer
-	end_buffer = buffer->buffer_end;
+final_state:
+	/* state: final_state reached after we finished reading the piece of the buffer */
 	if (finished_chunk) {
 		return true;
 	}
-	// If this is the last buffer, we have to read the last value
-	if (buffer->buffer->IsCSVFileLastBuffer() || (buffer->next_buffer->IsCSVFileLastBuffer())) {
-		if (column > 0 || try_add_line) {
-			// remaining values to be added to the chunk
-			AddValue(buffer->GetValue(start_buffer, position_buffer, offset), column, escape_positions, has_quotes);
-			if (try_add_line) {
-				bool success = column == sql_types.size();
-				if (success) {
-					AddRow(insert_chunk, column);
-					success = Flush(insert_chunk);
-				}
-				parse_chunk.Reset();
-				reached_remainder_state = false;
-				return success;
-			} else {
-				AddRow(insert_chunk, column);
-			}
-		}
+	if (column > 0 || position_buffer > start_buffer) {
+		// the last row of the file does not end with a newline: add its remaining values to the chunk
+		VerifyLineLength(line_start);
+		AddValue(buffer->GetValue(start_buffer, position_buffer, offset), column, escape_positions, has_quotes);
+		finished_chunk = AddRow(insert_chunk, column);
 	}
 	// flush the parsed chunk and finalize parsing
 	if (mode == ParserMode::PARSING) {
 		Flush(insert_chunk);
 	}
 	return true;
-};
+}
+
+void ParallelCSVReader::VerifyLineLength(idx_t line_start) {
+	if (position_buffer - line_start > options.maximum_line_size) {
+		throw InvalidInputException("Maximum line size of %llu bytes exceeded on line %s!", options.maximum_line_size,
+		                            GetLineNumberStr(linenr, linenr_estimated));
+	}
 }
 
 void ParallelCSVReader::ParseCSV(DataChunk &insert_chunk) {
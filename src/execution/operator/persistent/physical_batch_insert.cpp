@@ -238,6 +238,7 @@ public:
 	unique_ptr<RowGroupCollection> current_collection;
 	OptimisticDataWriter *writer;
 	bool written_to_disk;
+	unique_ptr<ConstraintState> constraint_state;
 
 	void FlushToDisk() {
 		if (!current_collection) {
@@ -300,7 +301,10 @@ SinkResultType PhysicalBatchInsert::Sink(ExecutionContext &context, GlobalSinkSt
 		lstate.CreateNewCollection(table, insert_types);
 	}
 	lstate.current_index = lstate.batch_index;
-	table->storage->VerifyAppendConstraints(*table, context.client, lstate.insert_chunk);
+	if (!lstate.constraint_state) {
+		lstate.constraint_state = make_unique<ConstraintState>(*table, context.client);
+	}
+	table->storage->VerifyAppendConstraints(*lstate.constraint_state, context.client, lstate.insert_chunk);
 	auto new_row_group = lstate.current_collection->Append(lstate.insert_chunk, lstate.current_append_state);
 	if (new_row_group) {
 		lstate.writer->CheckFlushToDisk(*lstate.current_collection);
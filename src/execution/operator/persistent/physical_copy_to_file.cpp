@@ -1,6 +1,10 @@
 #include "duckdb/execution/operator/persistent/physical_copy_to_file.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/hive_partitioning.hpp"
+#include "duckdb/common/types/batched_data_collection.hpp"
+#include "duckdb/common/types/partitioned_column_data.hpp"
+#include "duckdb/parallel/thread_context.hpp"
 
 #include <algorithm>
 
@@ -9,18 +13,36 @@ namespace duckdb {
 class CopyToFunctionGlobalState : public GlobalSinkState {
 public:
 	explicit CopyToFunctionGlobalState(unique_ptr<GlobalFunctionData> global_state)
-	    : rows_copied(0), global_state(move(global_state)) {
+	    : rows_copied(0), global_state(move(global_state)), partition_file_count(0) {
 	}
 
-	idx_t rows_copied;
+	atomic<idx_t> rows_copied;
+	//! The state of the copy function, only used if the output is not partitioned
 	unique_ptr<GlobalFunctionData> global_state;
+
+	//! Protects the set of created directories
+	mutex lock;
+	//! The partition directories that have been created
+	unordered_set<string> created_directories;
+	//! Used to give every file that is written for a partition a unique name
+	atomic<idx_t> partition_file_count;
+	//! The rows collected by all threads, by batch index (only used if use_batch_index is set)
+	unique_ptr<BatchedDataCollection> batches;
 };
 
 class CopyToFunctionLocalState : public LocalSinkState {
 public:
 	explicit CopyToFunctionLocalState(unique_ptr<LocalFunctionData> local_state) : local_state(move(local_state)) {
 	}
+	//! The state of the copy function, only used if the output is not partitioned
 	unique_ptr<LocalFunctionData> local_state;
+
+	//! The rows of this thread, partitioned on the values of the partition columns
+	unique_ptr<HivePartitionedColumnData> partition_data;
+	PartitionedColumnDataAppendState partition_append_state;
+
+	//! The rows of this thread, by batch index (only used if use_batch_index is set)
+	unique_ptr<BatchedDataCollection> batches;
 };
 
 //===--------------------------------------------------------------------===//
@@ -38,7 +60,60 @@ void MoveTmpFile(ClientContext &context, const string &tmp_file_path) {
 PhysicalCopyToFile::PhysicalCopyToFile(vector<LogicalType> types, CopyFunction function_p,
                                        unique_ptr<FunctionData> bind_data, idx_t estimated_cardinality)
     : PhysicalOperator(PhysicalOperatorType::COPY_TO_FILE, move(types), estimated_cardinality),
-      function(move(function_p)), bind_data(move(bind_data)) {
+      function(move(function_p)), bind_data(move(bind_data)), parallel(false), use_batch_index(false),
+      rows_per_file(0) {
+}
+
+//! Returns the directory of a partition, creating it (and its parents) if it does not exist yet
+static string GetPartitionDirectory(ClientContext &context, CopyToFunctionGlobalState &g, const string &path,
+                                    const vector<string> &names, const vector<idx_t> &partition_columns,
+                                    const vector<Value> &partition_key) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto directory = path;
+	lock_guard<mutex> glock(g.lock);
+	for (idx_t i = 0; i < partition_columns.size(); i++) {
+		auto value = partition_key[i].ToString();
+		if (value.find('/') != string::npos || value.find('\\') != string::npos) {
+			throw InvalidInputException("PARTITION_BY value \"%s\" of column \"%s\" contains a path separator", value,
+			                            names[partition_columns[i]]);
+		}
+		directory = fs.JoinPath(directory, names[partition_columns[i]] + "=" + value);
+		if (g.created_directories.find(directory) == g.created_directories.end()) {
+			if (!fs.DirectoryExists(directory)) {
+				fs.CreateDirectory(directory);
+			}
+			g.created_directories.insert(directory);
+		}
+	}
+	return directory;
+}
+
+void PhysicalCopyToFile::WritePartitionFile(ExecutionContext &context, GlobalSinkState &gstate,
+                                            const vector<Value> &partition_key,
+                                            ColumnDataCollection &collection) const {
+	auto &g = (CopyToFunctionGlobalState &)gstate;
+	auto directory = GetPartitionDirectory(context.client, g, file_path, names, partition_columns, partition_key);
+	auto &fs = FileSystem::GetFileSystem(context.client);
+	auto path = fs.JoinPath(directory, "data_" + to_string(g.partition_file_count++) + "." + function.extension);
+
+	// the partition columns are not written to the file
+	vector<column_t> column_ids;
+	for (idx_t col_idx = 0; col_idx < names.size(); col_idx++) {
+		if (std::find(partition_columns.begin(), partition_columns.end(), col_idx) == partition_columns.end()) {
+			column_ids.push_back(col_idx);
+		}
+	}
+	auto global_state = function.copy_to_initialize_global(context.client, *bind_data, path);
+	auto local_state = function.copy_to_initialize_local(context, *bind_data);
+	for (auto &chunk : collection.Chunks(column_ids)) {
+		function.copy_to_sink(context, *bind_data, *global_state, *local_state, chunk);
+	}
+	if (function.copy_to_combine) {
+		function.copy_to_combine(context, *bind_data, *global_state, *local_state);
+	}
+	if (function.copy_to_finalize) {
+		function.copy_to_finalize(context.client, *bind_data, *global_state);
+	}
 }
 
 SinkResultType PhysicalCopyToFile::Sink(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate,
@@ -47,6 +122,25 @@ SinkResultType PhysicalCopyToFile::Sink(ExecutionContext &context, GlobalSinkSta
 	auto &l = (CopyToFunctionLocalState &)lstate;
 
 	g.rows_copied += input.size();
+	if (!partition_columns.empty()) {
+		l.partition_data->Append(l.partition_append_state, input);
+		if (rows_per_file > 0) {
+			// write the partitions that have reached the file size to a file of their own
+			auto &partitions = l.partition_data->GetPartitions();
+			for (idx_t partition_idx = 0; partition_idx < partitions.size(); partition_idx++) {
+				if (partitions[partition_idx]->Count() < rows_per_file) {
+					continue;
+				}
+				auto collection = l.partition_data->TakePartition(l.partition_append_state, partition_idx);
+				WritePartitionFile(context, gstate, l.partition_data->GetPartitionKey(partition_idx), *collection);
+			}
+		}
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+	if (use_batch_index) {
+		l.batches->Append(input, l.batch_index);
+		return SinkResultType::NEED_MORE_INPUT;
+	}
 	function.copy_to_sink(context, *bind_data, *g.global_state, *l.local_state, input);
 	return SinkResultType::NEED_MORE_INPUT;
 }
@@ -55,6 +149,24 @@ void PhysicalCopyToFile::Combine(ExecutionContext &context, GlobalSinkState &gst
 	auto &g = (CopyToFunctionGlobalState &)gstate;
 	auto &l = (CopyToFunctionLocalState &)lstate;
 
+	if (!partition_columns.empty()) {
+		// write the remaining rows of every partition of this thread
+		l.partition_data->FlushAppendState(l.partition_append_state);
+		auto &partitions = l.partition_data->GetPartitions();
+		for (idx_t partition_idx = 0; partition_idx < partitions.size(); partition_idx++) {
+			if (partitions[partition_idx]->Count() == 0) {
+				continue;
+			}
+			WritePartitionFile(context, gstate, l.partition_data->GetPartitionKey(partition_idx),
+			                   *partitions[partition_idx]);
+		}
+		return;
+	}
+	if (use_batch_index) {
+		lock_guard<mutex> glock(g.lock);
+		g.batches->Merge(*l.batches);
+		return;
+	}
 	if (function.copy_to_combine) {
 		function.copy_to_combine(context, *bind_data, *g.global_state, *l.local_state);
 	}
@@ -63,6 +175,30 @@ void PhysicalCopyToFile::Combine(ExecutionContext &context, GlobalSinkState &gst
 SinkFinalizeType PhysicalCopyToFile::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                               GlobalSinkState &gstate_p) const {
 	auto &gstate = (CopyToFunctionGlobalState &)gstate_p;
+	if (!partition_columns.empty()) {
+		// every partition file has been finalized by the thread that wrote it
+		return SinkFinalizeType::READY;
+	}
+	if (use_batch_index) {
+		// write the batches in order
+		ThreadContext thread(context);
+		ExecutionContext exec_context(context, thread, &pipeline);
+		auto local_state = function.copy_to_initialize_local(exec_context, *bind_data);
+		BatchedChunkScanState scan_state;
+		gstate.batches->InitializeScan(scan_state);
+		DataChunk chunk;
+		chunk.Initialize(Allocator::Get(context), children[0]->types);
+		while (true) {
+			gstate.batches->Scan(scan_state, chunk);
+			if (chunk.size() == 0) {
+				break;
+			}
+			function.copy_to_sink(exec_context, *bind_data, *gstate.global_state, *local_state, chunk);
+		}
+		if (function.copy_to_combine) {
+			function.copy_to_combine(exec_context, *bind_data, *gstate.global_state, *local_state);
+		}
+	}
 	if (function.copy_to_finalize) {
 		function.copy_to_finalize(context, *bind_data, *gstate.global_state);
 
@@ -74,10 +210,35 @@ SinkFinalizeType PhysicalCopyToFile::Finalize(Pipeline &pipeline, Event &event,
 }
 
 unique_ptr<LocalSinkState> PhysicalCopyToFile::GetLocalSinkState(ExecutionContext &context) const {
+	if (!partition_columns.empty()) {
+		auto state = make_unique<CopyToFunctionLocalState>(nullptr);
+		state->partition_data =
+		    make_unique<HivePartitionedColumnData>(context.client, children[0]->types, partition_columns);
+		state->partition_data->InitializeAppendState(state->partition_append_state);
+		return move(state);
+	}
+	if (use_batch_index) {
+		auto state = make_unique<CopyToFunctionLocalState>(nullptr);
+		state->batches = make_unique<BatchedDataCollection>(context.client, children[0]->types);
+		return move(state);
+	}
 	return make_unique<CopyToFunctionLocalState>(function.copy_to_initialize_local(context, *bind_data));
 }
 unique_ptr<GlobalSinkState> PhysicalCopyToFile::GetGlobalSinkState(ClientContext &context) const {
-	return make_unique<CopyToFunctionGlobalState>(function.copy_to_initialize_global(context, *bind_data, file_path));
+	if (!partition_columns.empty()) {
+		// the files are written into the directory of their partition below the target directory
+		auto &fs = FileSystem::GetFileSystem(context);
+		if (!fs.DirectoryExists(file_path)) {
+			fs.CreateDirectory(file_path);
+		}
+		return make_unique<CopyToFunctionGlobalState>(nullptr);
+	}
+	auto state =
+	    make_unique<CopyToFunctionGlobalState>(function.copy_to_initialize_global(context, *bind_data, file_path));
+	if (use_batch_index) {
+		state->batches = make_unique<BatchedDataCollection>(context, children[0]->types);
+	}
+	return move(state);
 }
 
 //===--------------------------------------------------------------------===//
@@ -16,16 +16,17 @@ namespace duckdb {
 PhysicalInsert::PhysicalInsert(vector<LogicalType> types, TableCatalogEntry *table,
                                physical_index_vector_t<idx_t> column_index_map,
                                vector<unique_ptr<Expression>> bound_defaults, idx_t estimated_cardinality,
-                               bool return_chunk, bool parallel)
+                               bool return_chunk, bool parallel, OnConflictAction action_type)
     : PhysicalOperator(PhysicalOperatorType::INSERT, move(types), estimated_cardinality),
       column_index_map(std::move(column_index_map)), insert_table(table), insert_types(table->GetTypes()),
-      bound_defaults(move(bound_defaults)), return_chunk(return_chunk), parallel(parallel) {
+      bound_defaults(move(bound_defaults)), return_chunk(return_chunk), parallel(parallel), action_type(action_type) {
 }
 
 PhysicalInsert::PhysicalInsert(LogicalOperator &op, SchemaCatalogEntry *schema, unique_ptr<BoundCreateTableInfo> info_p,
                                idx_t estimated_cardinality, bool parallel)
     : PhysicalOperator(PhysicalOperatorType::CREATE_TABLE_AS, op.types, estimated_cardinality), insert_table(nullptr),
-      return_chunk(false), schema(schema), info(move(info_p)), parallel(parallel) {
+      return_chunk(false), schema(schema), info(move(info_p)), parallel(parallel),
+      action_type(OnConflictAction::THROW) {
 	GetInsertInfo(*info, insert_types, bound_defaults);
 }
 
@@ -68,6 +69,7 @@ public:
 	TableAppendState local_append_state;
 	unique_ptr<RowGroupCollection> local_collection;
 	OptimisticDataWriter *writer;
+	unique_ptr<ConstraintState> constraint_state;
 };
 
 unique_ptr<GlobalSinkState> PhysicalInsert::GetGlobalSinkState(ClientContext &context) const {
@@ -134,12 +136,16 @@ SinkResultType PhysicalInsert::Sink(ExecutionContext &context, GlobalSinkState &
 			table->storage->InitializeLocalAppend(gstate.append_state, context.client);
 			gstate.initialized = true;
 		}
+		if (action_type == OnConflictAction::NOTHING) {
+			// skip the rows that conflict with existing rows or with the preceding rows of the chunk
+			table->storage->FilterUniqueConflicts(context.client, lstate.insert_chunk);
+		}
 		table->storage->LocalAppend(gstate.append_state, *table, context.client, lstate.insert_chunk);
 
 		if (return_chunk) {
 			gstate.return_collection.Append(lstate.insert_chunk);
 		}
-		gstate.insert_count += chunk.size();
+		gstate.insert_count += lstate.insert_chunk.size();
 	} else {
 		D_ASSERT(!return_chunk);
 		// parallel append
@@ -153,7 +159,10 @@ SinkResultType PhysicalInsert::Sink(ExecutionContext &context, GlobalSinkState &
 			lstate.local_collection->InitializeAppend(lstate.local_append_state);
 			lstate.writer = gstate.table->storage->CreateOptimisticWriter(context.client);
 		}
-		table->storage->VerifyAppendConstraints(*table, context.client, lstate.insert_chunk);
+		if (!lstate.constraint_state) {
+			lstate.constraint_state = make_unique<ConstraintState>(*table, context.client);
+		}
+		table->storage->VerifyAppendConstraints(*lstate.constraint_state, context.client, lstate.insert_chunk);
 		auto new_row_group = lstate.local_collection->Append(lstate.insert_chunk, lstate.local_append_state);
 		if (new_row_group) {
 			lstate.writer->CheckFlushToDisk(*lstate.local_collection);
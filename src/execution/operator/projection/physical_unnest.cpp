@@ -1,7 +1,7 @@
 #include "duckdb/execution/operator/projection/physical_unnest.hpp"
 
-#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_unnest_expression.hpp"
@@ -11,7 +11,8 @@ namespace duckdb {
 class UnnestOperatorState : public OperatorState {
 public:
 	UnnestOperatorState(ClientContext &context, const vector<unique_ptr<Expression>> &select_list)
-	    : parent_position(0), list_position(0), list_length(-1), first_fetch(true), executor(context) {
+	    : parent_position(0), list_position(0), list_length(-1), first_fetch(true), has_null_list(false),
+	      executor(context) {
 		vector<LogicalType> list_data_types;
 		for (auto &exp : select_list) {
 			D_ASSERT(exp->type == ExpressionType::BOUND_UNNEST);
@@ -23,18 +24,18 @@ public:
 		list_data.Initialize(allocator, list_data_types);
 
 		list_vector_data.resize(list_data.ColumnCount());
-		list_child_data.resize(list_data.ColumnCount());
 	}
 
 	idx_t parent_position;
 	idx_t list_position;
 	int64_t list_length;
 	bool first_fetch;
+	//! Whether any of the unnested expressions is NULL (UNNEST(NULL)), in which case no rows are produced
+	bool has_null_list;
 
 	ExpressionExecutor executor;
 	DataChunk list_data;
 	vector<UnifiedVectorFormat> list_vector_data;
-	vector<UnifiedVectorFormat> list_child_data;
 };
 
 // this implements a sorted window functions variant
@@ -44,115 +45,6 @@ PhysicalUnnest::PhysicalUnnest(vector<LogicalType> types, vector<unique_ptr<Expr
 	D_ASSERT(!this->select_list.empty());
 }
 
-static void UnnestNull(idx_t start, idx_t end, Vector &result) {
-	auto &validity = FlatVector::Validity(result);
-	for (idx_t i = start; i < end; i++) {
-		validity.SetInvalid(i);
-	}
-	if (result.GetType().InternalType() == PhysicalType::STRUCT) {
-		auto &struct_children = StructVector::GetEntries(result);
-		for (auto &child : struct_children) {
-			UnnestNull(start, end, *child);
-		}
-	}
-}
-
-template <class T>
-static void TemplatedUnnest(UnifiedVectorFormat &vdata, idx_t start, idx_t end, Vector &result) {
-	auto source_data = (T *)vdata.data;
-	auto &source_mask = vdata.validity;
-	auto result_data = FlatVector::GetData<T>(result);
-	auto &result_mask = FlatVector::Validity(result);
-
-	for (idx_t i = start; i < end; i++) {
-		auto source_idx = vdata.sel->get_index(i);
-		auto target_idx = i - start;
-		if (source_mask.RowIsValid(source_idx)) {
-			result_data[target_idx] = source_data[source_idx];
-			result_mask.SetValid(target_idx);
-		} else {
-			result_mask.SetInvalid(target_idx);
-		}
-	}
-}
-
-static void UnnestValidity(UnifiedVectorFormat &vdata, idx_t start, idx_t end, Vector &result) {
-	auto &source_mask = vdata.validity;
-	auto &result_mask = FlatVector::Validity(result);
-
-	for (idx_t i = start; i < end; i++) {
-		auto source_idx = vdata.sel->get_index(i);
-		auto target_idx = i - start;
-		result_mask.Set(target_idx, source_mask.RowIsValid(source_idx));
-	}
-}
-
-static void UnnestVector(UnifiedVectorFormat &vdata, Vector &source, idx_t list_size, idx_t start, idx_t end,
-                         Vector &result) {
-	switch (result.GetType().InternalType()) {
-	case PhysicalType::BOOL:
-	case PhysicalType::INT8:
-		TemplatedUnnest<int8_t>(vdata, start, end, result);
-		break;
-	case PhysicalType::INT16:
-		TemplatedUnnest<int16_t>(vdata, start, end, result);
-		break;
-	case PhysicalType::INT32:
-		TemplatedUnnest<int32_t>(vdata, start, end, result);
-		break;
-	case PhysicalType::INT64:
-		TemplatedUnnest<int64_t>(vdata, start, end, result);
-		break;
-	case PhysicalType::INT128:
-		TemplatedUnnest<hugeint_t>(vdata, start, end, result);
-		break;
-	case PhysicalType::UINT8:
-		TemplatedUnnest<uint8_t>(vdata, start, end, result);
-		break;
-	case PhysicalType::UINT16:
-		TemplatedUnnest<uint16_t>(vdata, start, end, result);
-		break;
-	case PhysicalType::UINT32:
-		TemplatedUnnest<uint32_t>(vdata, start, end, result);
-		break;
-	case PhysicalType::UINT64:
-		TemplatedUnnest<uint64_t>(vdata, start, end, result);
-		break;
-	case PhysicalType::FLOAT:
-		TemplatedUnnest<float>(vdata, start, end, result);
-		break;
-	case PhysicalType::DOUBLE:
-		TemplatedUnnest<double>(vdata, start, end, result);
-		break;
-	case PhysicalType::INTERVAL:
-		TemplatedUnnest<interval_t>(vdata, start, end, result);
-		break;
-	case PhysicalType::VARCHAR:
-		TemplatedUnnest<string_t>(vdata, start, end, result);
-		break;
-	case PhysicalType::LIST: {
-		auto &target = ListVector::GetEntry(result);
-		target.Reference(ListVector::GetEntry(source));
-		ListVector::SetListSize(result, ListVector::GetListSize(source));
-		TemplatedUnnest<list_entry_t>(vdata, start, end, result);
-		break;
-	}
-	case PhysicalType::STRUCT: {
-		auto &source_entries = StructVector::GetEntries(source);
-		auto &target_entries = StructVector::GetEntries(result);
-		UnnestValidity(vdata, start, end, result);
-		for (idx_t i = 0; i < source_entries.size(); i++) {
-			UnifiedVectorFormat sdata;
-			source_entries[i]->ToUnifiedFormat(list_size, sdata);
-			UnnestVector(sdata, *source_entries[i], list_size, start, end, *target_entries[i]);
-		}
-		break;
-	}
-	default:
-		throw InternalException("Unimplemented type for UNNEST");
-	}
-}
-
 unique_ptr<OperatorState> PhysicalUnnest::GetOperatorState(ExecutionContext &context) const {
 	return PhysicalUnnest::GetState(context, select_list);
 }
@@ -167,131 +59,134 @@ OperatorResultType PhysicalUnnest::ExecuteInternal(ExecutionContext &context, Da
                                                    const vector<unique_ptr<Expression>> &select_list,
                                                    bool include_input) {
 	auto &state = (UnnestOperatorState &)state_p;
-	do {
-		if (state.first_fetch) {
-			// get the list data to unnest
-			state.list_data.Reset();
-			state.executor.Execute(input, state.list_data);
-
-			// paranoia aplenty
-			state.list_data.Verify();
-			D_ASSERT(input.size() == state.list_data.size());
-			D_ASSERT(state.list_data.ColumnCount() == select_list.size());
-			D_ASSERT(state.list_vector_data.size() == state.list_data.ColumnCount());
-			D_ASSERT(state.list_child_data.size() == state.list_data.ColumnCount());
-
-			// initialize UnifiedVectorFormat object so the nullmask can accessed
-			for (idx_t col_idx = 0; col_idx < state.list_data.ColumnCount(); col_idx++) {
-				auto &list_vector = state.list_data.data[col_idx];
-				list_vector.ToUnifiedFormat(state.list_data.size(), state.list_vector_data[col_idx]);
-
-				if (list_vector.GetType() == LogicalType::SQLNULL) {
-					// UNNEST(NULL)
-					auto &child_vector = list_vector;
-					child_vector.ToUnifiedFormat(0, state.list_child_data[col_idx]);
-				} else {
-					auto list_size = ListVector::GetListSize(list_vector);
-					auto &child_vector = ListVector::GetEntry(list_vector);
-					child_vector.ToUnifiedFormat(list_size, state.list_child_data[col_idx]);
-				}
+	if (state.first_fetch) {
+		// get the list data to unnest
+		state.list_data.Reset();
+		state.executor.Execute(input, state.list_data);
+
+		// paranoia aplenty
+		state.list_data.Verify();
+		D_ASSERT(input.size() == state.list_data.size());
+		D_ASSERT(state.list_data.ColumnCount() == select_list.size());
+		D_ASSERT(state.list_vector_data.size() == state.list_data.ColumnCount());
+
+		// initialize UnifiedVectorFormat object so the list entries and the nullmask can accessed
+		state.has_null_list = false;
+		for (idx_t col_idx = 0; col_idx < state.list_data.ColumnCount(); col_idx++) {
+			auto &list_vector = state.list_data.data[col_idx];
+			list_vector.ToUnifiedFormat(state.list_data.size(), state.list_vector_data[col_idx]);
+			if (list_vector.GetType() == LogicalType::SQLNULL) {
+				state.has_null_list = true;
 			}
-			state.first_fetch = false;
-		}
-		if (state.parent_position >= input.size()) {
-			// finished with this input chunk
-			state.parent_position = 0;
-			state.list_position = 0;
-			state.list_length = -1;
-			state.first_fetch = true;
-			return OperatorResultType::NEED_MORE_INPUT;
 		}
+		state.first_fetch = false;
+	}
+	auto column_count = state.list_data.ColumnCount();
+
+	// every output row refers to a row of the input and to an element of each of the unnested lists
+	// lists that are shorter than the longest list of their row are padded with NULL values
+	SelectionVector parent_sel(STANDARD_VECTOR_SIZE);
+	vector<SelectionVector> child_sels;
+	vector<SelectionVector> null_sels;
+	vector<idx_t> null_counts(column_count, 0);
+	for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+		child_sels.emplace_back(STANDARD_VECTOR_SIZE);
+		null_sels.emplace_back(STANDARD_VECTOR_SIZE);
+	}
 
+	idx_t result_count = 0;
+	while (!state.has_null_list && state.parent_position < input.size() && result_count < STANDARD_VECTOR_SIZE) {
 		// need to figure out how many times we need to repeat for current row
 		if (state.list_length < 0) {
-			for (idx_t col_idx = 0; col_idx < state.list_data.ColumnCount(); col_idx++) {
+			for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
 				auto &vdata = state.list_vector_data[col_idx];
 				auto current_idx = vdata.sel->get_index(state.parent_position);
-
-				int64_t list_length;
-				// deal with NULL values
-				if (!vdata.validity.RowIsValid(current_idx)) {
-					list_length = 0;
-				} else {
-					auto list_data = (list_entry_t *)vdata.data;
-					auto list_entry = list_data[current_idx];
-					list_length = (int64_t)list_entry.length;
+				// NULL lists are treated as empty lists
+				if (vdata.validity.RowIsValid(current_idx)) {
+					auto list_entry = ((list_entry_t *)vdata.data)[current_idx];
+					state.list_length = MaxValue<int64_t>(state.list_length, list_entry.length);
 				}
-
-				if (list_length > state.list_length) {
-					state.list_length = list_length;
+			}
+			state.list_length = MaxValue<int64_t>(state.list_length, 0);
+		}
+		auto row_count =
+		    MinValue<idx_t>(STANDARD_VECTOR_SIZE - result_count, state.list_length - state.list_position);
+		for (idx_t i = 0; i < row_count; i++) {
+			parent_sel.set_index(result_count + i, state.parent_position);
+		}
+		for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+			auto &vdata = state.list_vector_data[col_idx];
+			auto current_idx = vdata.sel->get_index(state.parent_position);
+
+			idx_t list_count = 0;
+			idx_t list_offset = 0;
+			if (vdata.validity.RowIsValid(current_idx)) {
+				auto list_entry = ((list_entry_t *)vdata.data)[current_idx];
+				if (list_entry.length > state.list_position) {
+					list_count = MinValue<idx_t>(row_count, list_entry.length - state.list_position);
 				}
+				list_offset = list_entry.offset + state.list_position;
+			}
+			auto &child_sel = child_sels[col_idx];
+			for (idx_t i = 0; i < list_count; i++) {
+				child_sel.set_index(result_count + i, list_offset + i);
+			}
+			auto &null_sel = null_sels[col_idx];
+			auto &null_count = null_counts[col_idx];
+			for (idx_t i = list_count; i < row_count; i++) {
+				child_sel.set_index(result_count + i, 0);
+				null_sel.set_index(null_count++, result_count + i);
 			}
 		}
+		result_count += row_count;
+		state.list_position += row_count;
+		if ((int64_t)state.list_position == state.list_length) {
+			state.parent_position++;
+			state.list_length = -1;
+			state.list_position = 0;
+		}
+	}
 
-		D_ASSERT(state.list_length >= 0);
-
-		auto this_chunk_len = MinValue<idx_t>(STANDARD_VECTOR_SIZE, state.list_length - state.list_position);
-
-		// first cols are from child, last n cols from unnest
-		chunk.SetCardinality(this_chunk_len);
-
+	// first cols are from child, last n cols from unnest
+	chunk.SetCardinality(result_count);
+	if (result_count > 0) {
 		idx_t output_offset = 0;
 		if (include_input) {
 			for (idx_t col_idx = 0; col_idx < input.ColumnCount(); col_idx++) {
-				ConstantVector::Reference(chunk.data[col_idx], input.data[col_idx], state.parent_position,
-				                          input.size());
+				chunk.data[col_idx].Slice(input.data[col_idx], parent_sel, result_count);
 			}
 			output_offset = input.ColumnCount();
 		}
-
-		for (idx_t col_idx = 0; col_idx < state.list_data.ColumnCount(); col_idx++) {
+		for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
 			auto &result_vector = chunk.data[col_idx + output_offset];
-
-			if (state.list_data.data[col_idx].GetType() == LogicalType::SQLNULL) {
-				// UNNEST(NULL)
-				chunk.SetCardinality(0);
+			auto &list_vector = state.list_data.data[col_idx];
+			auto &child_vector = ListVector::GetEntry(list_vector);
+			auto null_count = null_counts[col_idx];
+			if (null_count == 0) {
+				// every row is an element of the list: reference the elements instead of copying them
+				result_vector.Slice(child_vector, child_sels[col_idx], result_count);
+			} else if (null_count == result_count || ListVector::GetListSize(list_vector) == 0) {
+				result_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
+				ConstantVector::SetNull(result_vector, true);
 			} else {
-				auto &vdata = state.list_vector_data[col_idx];
-				auto &child_data = state.list_child_data[col_idx];
-				auto current_idx = vdata.sel->get_index(state.parent_position);
-
-				auto list_data = (list_entry_t *)vdata.data;
-				auto list_entry = list_data[current_idx];
-
-				idx_t list_count;
-				if (state.list_position >= list_entry.length) {
-					list_count = 0;
-				} else {
-					list_count = MinValue<idx_t>(this_chunk_len, list_entry.length - state.list_position);
+				VectorOperations::Copy(child_vector, result_vector, child_sels[col_idx], result_count, 0, 0);
+				auto &null_sel = null_sels[col_idx];
+				for (idx_t i = 0; i < null_count; i++) {
+					FlatVector::SetNull(result_vector, null_sel.get_index(i), true);
 				}
-
-				if (list_entry.length > state.list_position) {
-					if (!vdata.validity.RowIsValid(current_idx)) {
-						UnnestNull(0, list_count, result_vector);
-					} else {
-						auto &list_vector = state.list_data.data[col_idx];
-						auto &child_vector = ListVector::GetEntry(list_vector);
-						auto list_size = ListVector::GetListSize(list_vector);
-
-						auto base_offset = list_entry.offset + state.list_position;
-						UnnestVector(child_data, child_vector, list_size, base_offset, base_offset + list_count,
-						             result_vector);
-					}
-				}
-
-				UnnestNull(list_count, this_chunk_len, result_vector);
 			}
 		}
-
-		state.list_position += this_chunk_len;
-		if ((int64_t)state.list_position == state.list_length) {
-			state.parent_position++;
-			state.list_length = -1;
-			state.list_position = 0;
-		}
-
-		chunk.Verify();
-	} while (chunk.size() == 0);
+	}
+	chunk.Verify();
+
+	if (state.has_null_list || state.parent_position >= input.size()) {
+		// finished with this input chunk
+		state.parent_position = 0;
+		state.list_position = 0;
+		state.list_length = -1;
+		state.first_fetch = true;
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
 	return OperatorResultType::HAVE_MORE_OUTPUT;
 }
 
@@ -8,30 +8,67 @@ namespace duckdb {
 
 class PhysicalColumnDataScanState : public GlobalSourceState {
 public:
-	explicit PhysicalColumnDataScanState() : initialized(false) {
+	explicit PhysicalColumnDataScanState(const PhysicalColumnDataScan &op) : op(op), initialized(false) {
 	}
 
+	const PhysicalColumnDataScan &op;
 	//! The current position in the scan
-	ColumnDataScanState scan_state;
+	ColumnDataParallelScanState scan_state;
 	bool initialized;
+	//! The batch index of the next chunk
+	idx_t next_batch_index = 0;
+
+	idx_t MaxThreads() override {
+		return op.collection ? op.collection->ChunkCount() : 1;
+	}
+};
+
+class PhysicalColumnDataScanLocalState : public LocalSourceState {
+public:
+	ColumnDataLocalScanState scan_state;
+	//! The batch index of the last chunk that was scanned
+	idx_t batch_index = 0;
 };
 
 unique_ptr<GlobalSourceState> PhysicalColumnDataScan::GetGlobalSourceState(ClientContext &context) const {
-	return make_unique<PhysicalColumnDataScanState>();
+	return make_unique<PhysicalColumnDataScanState>(*this);
+}
+
+unique_ptr<LocalSourceState> PhysicalColumnDataScan::GetLocalSourceState(ExecutionContext &context,
+                                                                         GlobalSourceState &gstate) const {
+	return make_unique<PhysicalColumnDataScanLocalState>();
 }
 
 void PhysicalColumnDataScan::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
                                      LocalSourceState &lstate) const {
 	auto &state = (PhysicalColumnDataScanState &)gstate;
+	auto &local_state = (PhysicalColumnDataScanLocalState &)lstate;
 	D_ASSERT(collection);
 	if (collection->Count() == 0) {
 		return;
 	}
-	if (!state.initialized) {
-		collection->InitializeScan(state.scan_state);
-		state.initialized = true;
+	idx_t chunk_index;
+	idx_t segment_index;
+	idx_t row_index;
+	{
+		// claim the next chunk and number it while holding the lock, so the batch indexes follow the collection
+		lock_guard<mutex> guard(state.scan_state.lock);
+		if (!state.initialized) {
+			collection->InitializeScan(state.scan_state);
+			state.initialized = true;
+		}
+		if (!collection->NextScanIndex(state.scan_state.scan_state, chunk_index, segment_index, row_index)) {
+			return;
+		}
+		local_state.batch_index = state.next_batch_index++;
 	}
-	collection->Scan(state.scan_state, chunk);
+	collection->ScanAtIndex(state.scan_state, local_state.scan_state, chunk, chunk_index, segment_index, row_index);
+}
+
+idx_t PhysicalColumnDataScan::GetBatchIndex(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
+                                            LocalSourceState &lstate) const {
+	auto &local_state = (PhysicalColumnDataScanLocalState &)lstate;
+	return local_state.batch_index;
 }
 
 //===--------------------------------------------------------------------===//
@@ -2,6 +2,8 @@
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/executor.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
@@ -33,7 +35,8 @@ class TableScanGlobalSourceState : public GlobalSourceState {
 public:
 	TableScanGlobalSourceState(ClientContext &context, const PhysicalTableScan &op) {
 		if (op.function.init_global) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get());
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get(),
+			                             op.dynamic_filters.get(), op.sample_options.get());
 			global_state = op.function.init_global(context, input);
 			if (global_state) {
 				max_threads = global_state->MaxThreads();
@@ -51,17 +54,36 @@ public:
 	}
 };
 
+//! Keeps track of how selective a pushed down join filter is, so filters that remove (almost) nothing are skipped
+struct JoinFilterStatistics {
+	idx_t checked = 0;
+	idx_t passed = 0;
+	bool enabled = true;
+};
+
 class TableScanLocalSourceState : public LocalSourceState {
 public:
 	TableScanLocalSourceState(ExecutionContext &context, TableScanGlobalSourceState &gstate,
-	                          const PhysicalTableScan &op) {
+	                          const PhysicalTableScan &op)
+	    : join_filter_hashes(LogicalType::HASH) {
 		if (op.function.init_local) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get());
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get(),
+			                             op.dynamic_filters.get(), op.sample_options.get());
 			local_state = op.function.init_local(context, input, gstate.global_state.get());
 		}
+		if (!op.join_filters.empty()) {
+			join_filter_stats.resize(op.join_filters.size());
+			join_filter_sel[0].Initialize(STANDARD_VECTOR_SIZE);
+			join_filter_sel[1].Initialize(STANDARD_VECTOR_SIZE);
+		}
 	}
 
 	unique_ptr<LocalTableFunctionState> local_state;
+
+	//! State for checking the pushed down join filters
+	Vector join_filter_hashes;
+	SelectionVector join_filter_sel[2];
+	vector<JoinFilterStatistics> join_filter_stats;
 };
 
 unique_ptr<LocalSourceState> PhysicalTableScan::GetLocalSourceState(ExecutionContext &context,
@@ -81,6 +103,63 @@ void PhysicalTableScan::GetData(ExecutionContext &context, DataChunk &chunk, Glo
 
 	TableFunctionInput data(bind_data.get(), state.local_state.get(), gstate.global_state.get());
 	function.function(context.client, data, chunk);
+	// an empty chunk signals that the scan is exhausted: keep scanning until a row passes the join filters
+	while (!join_filters.empty() && chunk.size() > 0 && !ApplyJoinFilters(state, chunk)) {
+		chunk.Reset();
+		function.function(context.client, data, chunk);
+	}
+	Executor::Get(context.client).rows_scanned += chunk.size();
+}
+
+bool PhysicalTableScan::ApplyJoinFilters(TableScanLocalSourceState &state, DataChunk &chunk) const {
+	// the filters are only checked once we have seen enough rows to know whether they are worth it
+	static constexpr const idx_t JOIN_FILTER_SAMPLE_COUNT = 32 * STANDARD_VECTOR_SIZE;
+	static constexpr const double JOIN_FILTER_MAX_SELECTIVITY = 0.9;
+
+	const SelectionVector *current_sel = FlatVector::IncrementalSelectionVector();
+	idx_t count = chunk.size();
+	idx_t sel_idx = 0;
+	for (idx_t filter_idx = 0; filter_idx < join_filters.size(); filter_idx++) {
+		auto &filter = *join_filters[filter_idx];
+		auto &stats = state.join_filter_stats[filter_idx];
+		if (!stats.enabled || !filter.IsReady()) {
+			continue;
+		}
+		auto &hashes = state.join_filter_hashes;
+		auto &columns = filter.probe_columns;
+		if (count == chunk.size()) {
+			VectorOperations::Hash(chunk.data[columns[0]], hashes, count);
+			for (idx_t i = 1; i < columns.size(); i++) {
+				VectorOperations::CombineHash(hashes, chunk.data[columns[i]], count);
+			}
+		} else {
+			VectorOperations::Hash(chunk.data[columns[0]], hashes, *current_sel, count);
+			for (idx_t i = 1; i < columns.size(); i++) {
+				VectorOperations::CombineHash(hashes, chunk.data[columns[i]], *current_sel, count);
+			}
+		}
+		auto &result_sel = state.join_filter_sel[sel_idx];
+		auto result_count = filter.Filter(hashes, *current_sel, count, result_sel);
+
+		stats.checked += count;
+		stats.passed += result_count;
+		if (stats.checked >= JOIN_FILTER_SAMPLE_COUNT &&
+		    double(stats.passed) > double(stats.checked) * JOIN_FILTER_MAX_SELECTIVITY) {
+			// the filter barely removes anything: stop checking it
+			stats.enabled = false;
+		}
+
+		current_sel = &result_sel;
+		count = result_count;
+		sel_idx = 1 - sel_idx;
+		if (count == 0) {
+			return false;
+		}
+	}
+	if (count < chunk.size()) {
+		chunk.Slice(*current_sel, count);
+	}
+	return true;
 }
 
 double PhysicalTableScan::GetProgress(ClientContext &context, GlobalSourceState &gstate_p) const {
@@ -135,6 +214,11 @@ string PhysicalTableScan::ParamsToString() const {
 			}
 		}
 	}
+	if (sample_options) {
+		result += "\n[INFOSEPARATOR]\n";
+		result += "Sample: " + SampleMethodToString(sample_options->method) + " " +
+		          sample_options->sample_size.ToString() + "%";
+	}
 	result += "\nEC=" + to_string(estimated_cardinality) + "\n";
 	return result;
 }
@@ -153,6 +237,9 @@ bool PhysicalTableScan::Equals(const PhysicalOperator &other_p) const {
 	if (!FunctionData::Equals(bind_data.get(), other.bind_data.get())) {
 		return false;
 	}
+	if (!SampleOptions::Equals(sample_options.get(), other.sample_options.get())) {
+		return false;
+	}
 	return true;
 }
 
@@ -28,11 +28,13 @@ PhysicalRecursiveCTE::~PhysicalRecursiveCTE() {
 class RecursiveCTEState : public GlobalSinkState {
 public:
 	explicit RecursiveCTEState(ClientContext &context, const PhysicalRecursiveCTE &op)
-	    : intermediate_table(context, op.GetTypes()), new_groups(STANDARD_VECTOR_SIZE) {
+	    : intermediate_table(context, op.GetTypes()) {
 		ht = make_unique<GroupedAggregateHashTable>(context, Allocator::Get(context), op.types, vector<LogicalType>(),
 		                                            vector<BoundAggregateExpression *>());
 	}
 
+	//! Lock protecting the hash table and the intermediate table
+	mutex lock;
 	unique_ptr<GroupedAggregateHashTable> ht;
 
 	bool intermediate_empty = true;
@@ -40,6 +42,18 @@ public:
 	ColumnDataScanState scan_state;
 	bool initialized = false;
 	bool finished_scan = false;
+};
+
+class RecursiveCTELocalState : public LocalSinkState {
+public:
+	explicit RecursiveCTELocalState(ClientContext &context, const PhysicalRecursiveCTE &op)
+	    : intermediate_table(context, op.GetTypes()), new_groups(STANDARD_VECTOR_SIZE) {
+		intermediate_table.InitializeAppend(append_state);
+	}
+
+	//! The rows found by this thread in the current iteration
+	ColumnDataCollection intermediate_table;
+	ColumnDataAppendState append_state;
 	SelectionVector new_groups;
 };
 
@@ -47,32 +61,47 @@ unique_ptr<GlobalSinkState> PhysicalRecursiveCTE::GetGlobalSinkState(ClientConte
 	return make_unique<RecursiveCTEState>(context, *this);
 }
 
-idx_t PhysicalRecursiveCTE::ProbeHT(DataChunk &chunk, RecursiveCTEState &state) const {
+unique_ptr<LocalSinkState> PhysicalRecursiveCTE::GetLocalSinkState(ExecutionContext &context) const {
+	return make_unique<RecursiveCTELocalState>(context.client, *this);
+}
+
+idx_t PhysicalRecursiveCTE::ProbeHT(DataChunk &chunk, RecursiveCTEState &state, RecursiveCTELocalState &lstate) const {
 	Vector dummy_addresses(LogicalType::POINTER);
 
 	// Use the HT to eliminate duplicate rows
-	idx_t new_group_count = state.ht->FindOrCreateGroups(chunk, dummy_addresses, state.new_groups);
+	idx_t new_group_count;
+	{
+		lock_guard<mutex> guard(state.lock);
+		new_group_count = state.ht->FindOrCreateGroups(chunk, dummy_addresses, lstate.new_groups);
+	}
 
 	// we only return entries we have not seen before (i.e. new groups)
-	chunk.Slice(state.new_groups, new_group_count);
+	chunk.Slice(lstate.new_groups, new_group_count);
 
 	return new_group_count;
 }
 
-SinkResultType PhysicalRecursiveCTE::Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
+SinkResultType PhysicalRecursiveCTE::Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate_p,
                                           DataChunk &input) const {
 	auto &gstate = (RecursiveCTEState &)state;
+	auto &lstate = (RecursiveCTELocalState &)lstate_p;
 	if (!union_all) {
-		idx_t match_count = ProbeHT(input, gstate);
-		if (match_count > 0) {
-			gstate.intermediate_table.Append(input);
+		idx_t match_count = ProbeHT(input, gstate, lstate);
+		if (match_count == 0) {
+			return SinkResultType::NEED_MORE_INPUT;
 		}
-	} else {
-		gstate.intermediate_table.Append(input);
 	}
+	lstate.intermediate_table.Append(lstate.append_state, input);
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+void PhysicalRecursiveCTE::Combine(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate_p) const {
+	auto &gstate = (RecursiveCTEState &)state;
+	auto &lstate = (RecursiveCTELocalState &)lstate_p;
+	lock_guard<mutex> guard(gstate.lock);
+	gstate.intermediate_table.Combine(lstate.intermediate_table);
+}
+
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
@@ -49,7 +49,8 @@ PartitionableHashTable::PartitionableHashTable(ClientContext &context, Allocator
                                                vector<LogicalType> payload_types_p,
                                                vector<BoundAggregateExpression *> bindings_p)
     : context(context), allocator(allocator), group_types(move(group_types_p)), payload_types(move(payload_types_p)),
-      bindings(move(bindings_p)), is_partitioned(false), partition_info(partition_info_p), hashes(LogicalType::HASH),
+      bindings(move(bindings_p)), is_partitioned(false), skip_lookups(false), partitioned_tuples(0),
+      partitioned_groups(0), partition_info(partition_info_p), hashes(LogicalType::HASH),
       hashes_subset(LogicalType::HASH) {
 
 	sel_vectors.resize(partition_info.n_partitions);
@@ -72,13 +73,42 @@ idx_t PartitionableHashTable::ListAddChunk(HashTableList &list, DataChunk &group
 		if (!list.empty()) {
 			// early release first part of ht and prevent adding of more data
 			list.back()->Finalize();
+			if (list.back()->CanUnpin()) {
+				list.back()->Unpin();
+			}
 		}
 		list.push_back(make_unique<GroupedAggregateHashTable>(context, allocator, group_types, payload_types, bindings,
 		                                                      HtEntryType::HT_WIDTH_32));
+		if (skip_lookups) {
+			list.back()->Finalize();
+		}
+	}
+	if (skip_lookups) {
+		return list.back()->AppendChunk(groups, group_hashes, payload, filter);
 	}
 	return list.back()->AddChunk(groups, group_hashes, payload, filter);
 }
 
+void PartitionableHashTable::UpdateAdaptiveAggregation(idx_t tuple_count, idx_t group_count) {
+	if (skip_lookups) {
+		return;
+	}
+	partitioned_tuples += tuple_count;
+	partitioned_groups += group_count;
+	if (partitioned_tuples < ADAPTIVE_MIN_TUPLES ||
+	    partitioned_groups * 100 <= partitioned_tuples * ADAPTIVE_MAX_GROUP_PERCENTAGE) {
+		return;
+	}
+	// (almost) every row creates a new group: the lookups are pure overhead, the groups are merged later anyway
+	// finalize the HTs we have so far (which drops their pointer table), and only append to them from now on
+	for (auto &ht_list : radix_partitioned_hts) {
+		for (auto &ht : ht_list.second) {
+			ht->Finalize();
+		}
+	}
+	skip_lookups = true;
+}
+
 idx_t PartitionableHashTable::AddChunk(DataChunk &groups, DataChunk &payload, bool do_partition,
                                        const vector<idx_t> &filter) {
 	groups.Hash(hashes);
@@ -129,6 +159,7 @@ idx_t PartitionableHashTable::AddChunk(DataChunk &groups, DataChunk &payload, bo
 
 		group_count += ListAddChunk(radix_partitioned_hts[r], group_subset, hashes_subset, payload_subset, filter);
 	}
+	UpdateAdaptiveAggregation(groups.size(), group_count);
 	return group_count;
 }
 
@@ -172,12 +203,18 @@ void PartitionableHashTable::Finalize() {
 			for (auto &ht : ht_list.second) {
 				D_ASSERT(ht);
 				ht->Finalize();
+				if (ht->CanUnpin()) {
+					ht->Unpin();
+				}
 			}
 		}
 	} else {
 		for (auto &ht : unpartitioned_hts) {
 			D_ASSERT(ht);
 			ht->Finalize();
+			if (ht->CanUnpin()) {
+				ht->Unpin();
+			}
 		}
 	}
 }
@@ -8,7 +8,11 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/storage/statistics/numeric_statistics.hpp"
 namespace duckdb {
 
@@ -38,6 +42,10 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 		case PhysicalType::INT16:
 		case PhysicalType::INT32:
 		case PhysicalType::INT64:
+		case PhysicalType::UINT8:
+		case PhysicalType::UINT16:
+		case PhysicalType::UINT32:
+		case PhysicalType::UINT64:
 			break;
 		default:
 			// we only support simple integer types for perfect hashing
@@ -45,15 +53,41 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 		}
 		// check if the group has stats available
 		auto &group_type = group->return_type;
+		if (group_type.id() == LogicalTypeId::ENUM && (!stats || ((NumericStatistics &)*stats).min.IsNull())) {
+			// the domain of an enum is given by its dictionary: the values are the indexes in [0, size)
+			auto enum_size = EnumType::GetSize(group_type);
+			if (enum_size == 0) {
+				return false;
+			}
+			auto has_null = !stats || !stats->validity_stats || stats->validity_stats->CanHaveNull();
+			Value min, max;
+			switch (group_type.InternalType()) {
+			case PhysicalType::UINT8:
+				min = Value::UTINYINT(0);
+				max = Value::UTINYINT(enum_size - 1);
+				break;
+			case PhysicalType::UINT16:
+				min = Value::USMALLINT(0);
+				max = Value::USMALLINT(enum_size - 1);
+				break;
+			case PhysicalType::UINT32:
+				min = Value::UINTEGER(0);
+				max = Value::UINTEGER(enum_size - 1);
+				break;
+			default:
+				throw InternalException("Unsupported internal type for ENUM");
+			}
+			stats = make_unique<NumericStatistics>(group_type, move(min), move(max), StatisticsType::LOCAL_STATS);
+			stats->validity_stats = make_unique<ValidityStatistics>(has_null);
+		}
 		if (!stats) {
 			// no stats, but we might still be able to use perfect hashing if the type is small enough
 			// for small types we can just set the stats to [type_min, type_max]
 			switch (group_type.InternalType()) {
 			case PhysicalType::INT8:
-				stats = make_unique<NumericStatistics>(group_type, Value::MinimumValue(group_type),
-				                                       Value::MaximumValue(group_type), StatisticsType::LOCAL_STATS);
-				break;
 			case PhysicalType::INT16:
+			case PhysicalType::UINT8:
+			case PhysicalType::UINT16:
 				stats = make_unique<NumericStatistics>(group_type, Value::MinimumValue(group_type),
 				                                       Value::MaximumValue(group_type), StatisticsType::LOCAL_STATS);
 				break;
@@ -89,6 +123,24 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 				return false;
 			}
 			break;
+		case PhysicalType::UINT8:
+			range = int64_t(nstats.max.GetValueUnsafe<uint8_t>()) - int64_t(nstats.min.GetValueUnsafe<uint8_t>());
+			break;
+		case PhysicalType::UINT16:
+			range = int64_t(nstats.max.GetValueUnsafe<uint16_t>()) - int64_t(nstats.min.GetValueUnsafe<uint16_t>());
+			break;
+		case PhysicalType::UINT32:
+			range = int64_t(nstats.max.GetValueUnsafe<uint32_t>()) - int64_t(nstats.min.GetValueUnsafe<uint32_t>());
+			break;
+		case PhysicalType::UINT64: {
+			auto max_value = nstats.max.GetValueUnsafe<uint64_t>();
+			auto min_value = nstats.min.GetValueUnsafe<uint64_t>();
+			if (max_value - min_value >= (uint64_t)NumericLimits<int32_t>::Maximum()) {
+				return false;
+			}
+			range = int64_t(max_value - min_value);
+			break;
+		}
 		default:
 			throw InternalException("Unsupported type for perfect hash (should be caught before)");
 		}
@@ -117,10 +169,53 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Checks if the ungrouped aggregate computes only MIN/MAX of numeric columns and COUNT(*) directly over a base table
+//! scan without filters, in which case the result can be taken from the table statistics when they are exact
+static DataTable *CanAggregateFromStatistics(LogicalAggregate &op, vector<column_t> &statistics_columns) {
+	if (!op.groups.empty() || op.expressions.empty() || op.children[0]->type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	auto &get = (LogicalGet &)*op.children[0];
+	if (get.function.name != "seq_scan" || !get.table_filters.filters.empty()) {
+		return nullptr;
+	}
+	auto table = get.GetTable();
+	if (!table) {
+		return nullptr;
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggr = (BoundAggregateExpression &)*expression;
+		if (aggr.IsDistinct() || aggr.filter) {
+			return nullptr;
+		}
+		if (aggr.function.name == "count_star" && aggr.children.empty()) {
+			statistics_columns.push_back(COLUMN_IDENTIFIER_ROW_ID);
+			continue;
+		}
+		if ((aggr.function.name != "min" && aggr.function.name != "max") || aggr.children.size() != 1 ||
+		    aggr.children[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+			return nullptr;
+		}
+		auto &colref = (BoundColumnRefExpression &)*aggr.children[0];
+		D_ASSERT(colref.binding.table_index == get.table_index);
+		auto column_id = get.column_ids[colref.binding.column_index];
+		// only integral types: the statistics of strings are truncated, and floating points have special values
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID || !TypeIsIntegral(colref.return_type.InternalType()) ||
+		    colref.return_type != aggr.return_type) {
+			return nullptr;
+		}
+		statistics_columns.push_back(column_id);
+	}
+	return table->storage.get();
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
+	vector<column_t> statistics_columns;
+	auto statistics_table = CanAggregateFromStatistics(op, statistics_columns);
+
 	auto plan = CreatePlan(*op.children[0]);
 
 	plan = ExtractAggregateExpressions(move(plan), op.expressions, op.groups);
@@ -138,8 +233,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 			}
 		}
 		if (use_simple_aggregation) {
-			groupby = make_unique_base<PhysicalOperator, PhysicalUngroupedAggregate>(op.types, move(op.expressions),
-			                                                                         op.estimated_cardinality);
+			auto aggregate =
+			    make_unique<PhysicalUngroupedAggregate>(op.types, move(op.expressions), op.estimated_cardinality);
+			aggregate->statistics_table = statistics_table;
+			aggregate->statistics_columns = move(statistics_columns);
+			groupby = move(aggregate);
 		} else {
 			groupby = make_unique_base<PhysicalOperator, PhysicalHashAggregate>(context, op.types, move(op.expressions),
 			                                                                    op.estimated_cardinality);
@@ -15,6 +15,7 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/join/physical_blockwise_nl_join.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 
 namespace duckdb {
 
@@ -69,10 +70,6 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	if (op.conditions.size() != 1) {
 		return;
 	}
-	// with propagated statistics
-	if (op.join_stats.empty()) {
-		return;
-	}
 	for (auto &type : op.children[1]->types) {
 		switch (type.InternalType()) {
 		case PhysicalType::STRUCT:
@@ -88,6 +85,17 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 			return;
 		}
 	}
+	// on an integral key
+	auto key_type = op.conditions[0].right->return_type.InternalType();
+	if (!TypeIsInteger(key_type) || key_type == PhysicalType::INT128) {
+		return;
+	}
+	// the join can still switch to a perfect hash table once the build keys are known
+	join_state.is_join_eligible = true;
+	// with propagated statistics
+	if (op.join_stats.empty()) {
+		return;
+	}
 	// with integral internal types
 	for (auto &&join_stat : op.join_stats) {
 		if (!TypeIsInteger(join_stat->type.InternalType()) || join_stat->type.InternalType() == PhysicalType::INT128) {
@@ -113,15 +121,13 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	// Fill join_stats for invisible join
 	auto stats_probe = reinterpret_cast<NumericStatistics *>(op.join_stats[1].get()); // rhs stats
 
-	// The max size our build must have to run the perfect HJ
-	const idx_t MAX_BUILD_SIZE = 1000000;
 	join_state.probe_min = stats_probe->min;
 	join_state.probe_max = stats_probe->max;
 	join_state.build_min = stats_build->min;
 	join_state.build_max = stats_build->max;
 	join_state.estimated_cardinality = op.estimated_cardinality;
 	join_state.build_range = build_range;
-	if (join_state.build_range > MAX_BUILD_SIZE || stats_probe->max.IsNull() || stats_probe->min.IsNull()) {
+	if (join_state.build_range > PerfectHashJoinExecutor::MAX_BUILD_SIZE || stats_probe->max.IsNull() || stats_probe->min.IsNull()) {
 		return;
 	}
 	if (stats_build->min <= stats_probe->min && stats_probe->max <= stats_build->max) {
@@ -131,43 +137,110 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	return;
 }
 
-static void CanUseIndexJoin(TableScanBindData *tbl, Expression &expr, Index **result_index) {
+static void CanUseIndexJoin(TableScanBindData *tbl, vector<JoinCondition> &conditions, bool use_left,
+                            Index **result_index, vector<idx_t> &key_order) {
 	tbl->table->storage->info->indexes.Scan([&](Index &index) {
-		if (index.unbound_expressions.size() != 1) {
+		if (index.unbound_expressions.size() != conditions.size()) {
 			return false;
 		}
-		if (expr.alias == index.unbound_expressions[0]->alias) {
-			*result_index = &index;
-			return true;
+		// every column of the index key has to be bound by exactly one condition
+		vector<idx_t> order;
+		for (auto &index_expr : index.unbound_expressions) {
+			if (index_expr->type != ExpressionType::BOUND_COLUMN_REF) {
+				return false;
+			}
+			idx_t match = DConstants::INVALID_INDEX;
+			for (idx_t cond_idx = 0; cond_idx < conditions.size(); cond_idx++) {
+				auto &expr = use_left ? *conditions[cond_idx].left : *conditions[cond_idx].right;
+				if (expr.alias == index_expr->alias && expr.return_type == index_expr->return_type &&
+				    std::find(order.begin(), order.end(), cond_idx) == order.end()) {
+					match = cond_idx;
+					break;
+				}
+			}
+			if (match == DConstants::INVALID_INDEX) {
+				return false;
+			}
+			order.push_back(match);
 		}
-		return false;
+		*result_index = &index;
+		key_order = move(order);
+		return true;
 	});
 }
 
 void TransformIndexJoin(ClientContext &context, LogicalComparisonJoin &op, Index **left_index, Index **right_index,
-                        PhysicalOperator *left, PhysicalOperator *right) {
+                        vector<idx_t> &left_key_order, vector<idx_t> &right_key_order, PhysicalOperator *left,
+                        PhysicalOperator *right) {
 	auto &transaction = Transaction::GetTransaction(context);
-	// check if one of the tables has an index on column
-	if (op.join_type == JoinType::INNER && op.conditions.size() == 1) {
-		// check if one of the children are table scans and if they have an index in the join attribute
-		// (op.condition)
-		if (left->type == PhysicalOperatorType::TABLE_SCAN) {
-			auto &tbl_scan = (PhysicalTableScan &)*left;
-			auto tbl = dynamic_cast<TableScanBindData *>(tbl_scan.bind_data.get());
-			if (CanPlanIndexJoin(transaction, tbl, tbl_scan)) {
-				CanUseIndexJoin(tbl, *op.conditions[0].left, left_index);
+	// check if one of the tables has an index on the join columns
+	if (op.join_type != JoinType::INNER) {
+		return;
+	}
+	// either equality conditions on all columns of the index key, or a single range condition on a single column key
+	for (auto &cond : op.conditions) {
+		switch (cond.comparison) {
+		case ExpressionType::COMPARE_EQUAL:
+			break;
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			if (op.conditions.size() != 1) {
+				return;
 			}
+			break;
+		default:
+			return;
 		}
-		if (right->type == PhysicalOperatorType::TABLE_SCAN) {
-			auto &tbl_scan = (PhysicalTableScan &)*right;
-			auto tbl = dynamic_cast<TableScanBindData *>(tbl_scan.bind_data.get());
-			if (CanPlanIndexJoin(transaction, tbl, tbl_scan)) {
-				CanUseIndexJoin(tbl, *op.conditions[0].right, right_index);
-			}
+	}
+	// check if one of the children are table scans and if they have an index in the join attributes
+	// (op.conditions)
+	if (left->type == PhysicalOperatorType::TABLE_SCAN) {
+		auto &tbl_scan = (PhysicalTableScan &)*left;
+		auto tbl = dynamic_cast<TableScanBindData *>(tbl_scan.bind_data.get());
+		if (CanPlanIndexJoin(transaction, tbl, tbl_scan)) {
+			CanUseIndexJoin(tbl, op.conditions, true, left_index, left_key_order);
+		}
+	}
+	if (right->type == PhysicalOperatorType::TABLE_SCAN) {
+		auto &tbl_scan = (PhysicalTableScan &)*right;
+		auto tbl = dynamic_cast<TableScanBindData *>(tbl_scan.bind_data.get());
+		if (CanPlanIndexJoin(transaction, tbl, tbl_scan)) {
+			CanUseIndexJoin(tbl, op.conditions, false, right_index, right_key_order);
 		}
 	}
 }
 
+//! Whether the join fetches rows of the table scanned on its right side by their row id
+static bool CanUseRowIdJoin(ClientContext &context, LogicalComparisonJoin &op, PhysicalOperator &right) {
+	if (op.join_type != JoinType::INNER || op.conditions.size() != 1 ||
+	    op.conditions[0].comparison != ExpressionType::COMPARE_EQUAL ||
+	    right.type != PhysicalOperatorType::TABLE_SCAN) {
+		return false;
+	}
+	auto &tbl_scan = (PhysicalTableScan &)right;
+	auto tbl = dynamic_cast<TableScanBindData *>(tbl_scan.bind_data.get());
+	if (!tbl_scan.projection_ids.empty() || !CanPlanIndexJoin(Transaction::GetTransaction(context), tbl, tbl_scan)) {
+		return false;
+	}
+	auto &key = *op.conditions[0].right;
+	if (key.type != ExpressionType::BOUND_REF) {
+		return false;
+	}
+	auto &ref = (BoundReferenceExpression &)key;
+	return tbl_scan.column_ids[ref.index] == COLUMN_IDENTIFIER_ROW_ID;
+}
+
+//! Order the join conditions like the columns of the index key
+static vector<JoinCondition> OrderIndexJoinConditions(vector<JoinCondition> conditions, const vector<idx_t> &key_order) {
+	vector<JoinCondition> result;
+	for (auto &cond_idx : key_order) {
+		result.push_back(move(conditions[cond_idx]));
+	}
+	return result;
+}
+
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	if (expr.type == ExpressionType::BOUND_REF) {
 		auto &ref = (BoundReferenceExpression &)expr;
@@ -215,25 +288,44 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalComparison
 		}
 	}
 
+	Index *left_index {}, *right_index {};
+	vector<idx_t> left_key_order, right_key_order;
+	TransformIndexJoin(context, op, &left_index, &right_index, left_key_order, right_key_order, left.get(),
+	                   right.get());
+	if (left_index &&
+	    (ClientConfig::GetConfig(context).force_index_join || rhs_cardinality < 0.01 * lhs_cardinality)) {
+		auto &tbl_scan = (PhysicalTableScan &)*left;
+		for (auto &cond : op.conditions) {
+			swap(cond.left, cond.right);
+			cond.comparison = FlipComparisionExpression(cond.comparison);
+		}
+		auto conditions = OrderIndexJoinConditions(move(op.conditions), left_key_order);
+		return make_unique<PhysicalIndexJoin>(op, move(right), move(left), move(conditions), op.join_type,
+		                                      op.right_projection_map, op.left_projection_map, tbl_scan.column_ids,
+		                                      left_index, false, op.estimated_cardinality);
+	}
+	if (right_index &&
+	    (ClientConfig::GetConfig(context).force_index_join || lhs_cardinality < 0.01 * rhs_cardinality)) {
+		auto &tbl_scan = (PhysicalTableScan &)*right;
+		auto conditions = OrderIndexJoinConditions(move(op.conditions), right_key_order);
+		return make_unique<PhysicalIndexJoin>(op, move(left), move(right), move(conditions), op.join_type,
+		                                      op.left_projection_map, op.right_projection_map, tbl_scan.column_ids,
+		                                      right_index, true, op.estimated_cardinality);
+	}
+
+	// the late materialization of a TopN relies on the row id join to keep the order of the sorted rows
+	if (CanUseRowIdJoin(context, op, *right) &&
+	    (ClientConfig::GetConfig(context).force_index_join || lhs_cardinality < 0.01 * rhs_cardinality ||
+	     op.children[0]->type == LogicalOperatorType::LOGICAL_TOP_N)) {
+		// the keys are row ids of the table on the right side: fetch the rows instead of scanning the table
+		auto &tbl_scan = (PhysicalTableScan &)*right;
+		return make_unique<PhysicalIndexJoin>(op, move(left), move(right), move(op.conditions), op.join_type,
+		                                      op.left_projection_map, op.right_projection_map, tbl_scan.column_ids,
+		                                      nullptr, true, op.estimated_cardinality);
+	}
+
 	unique_ptr<PhysicalOperator> plan;
 	if (has_equality) {
-		Index *left_index {}, *right_index {};
-		TransformIndexJoin(context, op, &left_index, &right_index, left.get(), right.get());
-		if (left_index &&
-		    (ClientConfig::GetConfig(context).force_index_join || rhs_cardinality < 0.01 * lhs_cardinality)) {
-			auto &tbl_scan = (PhysicalTableScan &)*left;
-			swap(op.conditions[0].left, op.conditions[0].right);
-			return make_unique<PhysicalIndexJoin>(op, move(right), move(left), move(op.conditions), op.join_type,
-			                                      op.right_projection_map, op.left_projection_map, tbl_scan.column_ids,
-			                                      left_index, false, op.estimated_cardinality);
-		}
-		if (right_index &&
-		    (ClientConfig::GetConfig(context).force_index_join || lhs_cardinality < 0.01 * rhs_cardinality)) {
-			auto &tbl_scan = (PhysicalTableScan &)*right;
-			return make_unique<PhysicalIndexJoin>(op, move(left), move(right), move(op.conditions), op.join_type,
-			                                      op.left_projection_map, op.right_projection_map, tbl_scan.column_ids,
-			                                      right_index, true, op.estimated_cardinality);
-		}
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
@@ -17,6 +17,14 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCopyToFile
 	auto copy = make_unique<PhysicalCopyToFile>(op.types, op.function, move(op.bind_data), op.estimated_cardinality);
 	copy->file_path = op.file_path;
 	copy->use_tmp_file = use_tmp_file;
+	copy->partition_columns = move(op.partition_columns);
+	copy->names = move(op.names);
+	copy->rows_per_file = op.rows_per_file;
+	// the copy functions write the data of every thread to the file under a lock
+	// partitioned output is spread over many files, so there is no insertion order to preserve there
+	copy->parallel = !copy->partition_columns.empty() || !PreserveInsertionOrder(*plan);
+	// if the order has to be preserved, the rows can still be collected in parallel if the sources number their batches
+	copy->use_batch_index = !copy->parallel && UseBatchIndex(*plan);
 
 	copy->children.push_back(move(plan));
 	return move(copy);
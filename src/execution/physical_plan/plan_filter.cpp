@@ -26,9 +26,14 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalFilter &op
 		for (idx_t i = 0; i < op.projection_map.size(); i++) {
 			select_list.push_back(make_unique<BoundReferenceExpression>(op.types[i], op.projection_map[i]));
 		}
-		auto proj = make_unique<PhysicalProjection>(op.types, move(select_list), op.estimated_cardinality);
-		proj->children.push_back(move(plan));
-		plan = move(proj);
+		if (plan->type == PhysicalOperatorType::FILTER && ((PhysicalFilter &)*plan).CanFuseProjection()) {
+			// the filter emits the projected columns directly
+			((PhysicalFilter &)*plan).FuseProjection(op.types, move(select_list));
+		} else {
+			auto proj = make_unique<PhysicalProjection>(op.types, move(select_list), op.estimated_cardinality);
+			proj->children.push_back(move(plan));
+			plan = move(proj);
+		}
 	}
 	return plan;
 }
@@ -29,14 +29,51 @@ unique_ptr<TableFilterSet> CreateTableFilterSet(TableFilterSet &table_filters, v
 	return table_filter_set;
 }
 
+//! Projects the columns of a node that produces all columns of a table function onto the column ids of the scan
+static unique_ptr<PhysicalOperator> ProjectColumnIds(LogicalGet &op, unique_ptr<PhysicalOperator> node) {
+	// first check if an additional projection is necessary
+	if (op.column_ids.size() == op.returned_types.size()) {
+		bool projection_necessary = false;
+		for (idx_t i = 0; i < op.column_ids.size(); i++) {
+			if (op.column_ids[i] != i) {
+				projection_necessary = true;
+				break;
+			}
+		}
+		if (!projection_necessary) {
+			// a projection is not necessary if all columns have been requested in-order
+			// in that case we just return the node
+			return node;
+		}
+	}
+	// push a projection on top that does the projection
+	vector<LogicalType> types;
+	vector<unique_ptr<Expression>> expressions;
+	for (auto &column_id : op.column_ids) {
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			types.emplace_back(LogicalType::BIGINT);
+			expressions.push_back(make_unique<BoundConstantExpression>(Value::BIGINT(0)));
+		} else {
+			auto type = op.returned_types[column_id];
+			types.push_back(type);
+			expressions.push_back(make_unique<BoundReferenceExpression>(type, column_id));
+		}
+	}
+
+	auto projection = make_unique<PhysicalProjection>(move(types), move(expressions), op.estimated_cardinality);
+	projection->children.push_back(move(node));
+	return move(projection);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalGet &op) {
 	if (!op.children.empty()) {
 		// this is for table producing functions that consume subquery results
+		// these functions produce all their columns: unused columns are projected out on top of the function
 		D_ASSERT(op.children.size() == 1);
 		auto node = make_unique<PhysicalTableInOutFunction>(op.returned_types, op.function, move(op.bind_data),
 		                                                    op.column_ids, op.estimated_cardinality);
 		node->children.push_back(CreatePlan(move(op.children[0])));
-		return move(node);
+		return ProjectColumnIds(op, move(node));
 	}
 
 	unique_ptr<TableFilterSet> table_filters;
@@ -53,39 +90,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalGet &op) {
 		auto node = make_unique<PhysicalTableScan>(op.returned_types, op.function, move(op.bind_data),
 		                                           op.returned_types, op.column_ids, vector<column_t>(), op.names,
 		                                           move(table_filters), op.estimated_cardinality);
-		// first check if an additional projection is necessary
-		if (op.column_ids.size() == op.returned_types.size()) {
-			bool projection_necessary = false;
-			for (idx_t i = 0; i < op.column_ids.size(); i++) {
-				if (op.column_ids[i] != i) {
-					projection_necessary = true;
-					break;
-				}
-			}
-			if (!projection_necessary) {
-				// a projection is not necessary if all columns have been requested in-order
-				// in that case we just return the node
-
-				return move(node);
-			}
-		}
-		// push a projection on top that does the projection
-		vector<LogicalType> types;
-		vector<unique_ptr<Expression>> expressions;
-		for (auto &column_id : op.column_ids) {
-			if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
-				types.emplace_back(LogicalType::BIGINT);
-				expressions.push_back(make_unique<BoundConstantExpression>(Value::BIGINT(0)));
-			} else {
-				auto type = op.returned_types[column_id];
-				types.push_back(type);
-				expressions.push_back(make_unique<BoundReferenceExpression>(type, column_id));
-			}
-		}
-
-		auto projection = make_unique<PhysicalProjection>(move(types), move(expressions), op.estimated_cardinality);
-		projection->children.push_back(move(node));
-		return move(projection);
+		return ProjectColumnIds(op, move(node));
 	} else {
 		return make_unique<PhysicalTableScan>(op.types, op.function, move(op.bind_data), op.returned_types,
 		                                      op.column_ids, op.projection_ids, op.names, move(table_filters),
@@ -54,8 +54,8 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalInsert &op
 	bool parallel_streaming_insert = !PreserveInsertionOrder(*plan);
 	bool use_batch_index = UseBatchIndex(*plan);
 	auto num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
-	if (op.return_chunk) {
-		// not supported for RETURNING (yet?)
+	if (op.return_chunk || op.action_type != OnConflictAction::THROW) {
+		// not supported for RETURNING or ON CONFLICT (yet?)
 		parallel_streaming_insert = false;
 		use_batch_index = false;
 	}
@@ -66,7 +66,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalInsert &op
 	} else {
 		insert = make_unique<PhysicalInsert>(op.types, op.table, op.column_index_map, move(op.bound_defaults),
 		                                     op.estimated_cardinality, op.return_chunk,
-		                                     parallel_streaming_insert && num_threads > 1);
+		                                     parallel_streaming_insert && num_threads > 1, op.action_type);
 	}
 	if (plan) {
 		insert->children.push_back(move(plan));
@@ -1,15 +1,47 @@
 #include "duckdb/execution/operator/helper/physical_limit.hpp"
 #include "duckdb/execution/operator/helper/physical_streaming_limit.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 
 namespace duckdb {
 
+//! Pushes a constant OFFSET into an unfiltered sequential scan below the limit, which skips the row groups and vectors
+//! that only contain rows of the offset without scanning them
+static bool PushdownOffset(PhysicalOperator &plan, idx_t offset) {
+	auto op = &plan;
+	while (op->type == PhysicalOperatorType::PROJECTION) {
+		op = op->children[0].get();
+	}
+	if (op->type != PhysicalOperatorType::TABLE_SCAN) {
+		return false;
+	}
+	auto &scan = (PhysicalTableScan &)*op;
+	if (scan.function.name != "seq_scan" || !scan.bind_data) {
+		return false;
+	}
+	if ((scan.table_filters && !scan.table_filters->filters.empty()) || !scan.join_filters.empty() ||
+	    scan.dynamic_filters || scan.sample_options) {
+		// filters and samples remove rows from the scan: we cannot tell which rows are part of the offset
+		return false;
+	}
+	auto &bind_data = (TableScanBindData &)*scan.bind_data;
+	if (bind_data.is_index_scan || bind_data.is_create_index) {
+		return false;
+	}
+	bind_data.offset = offset;
+	return true;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalLimit &op) {
 	D_ASSERT(op.children.size() == 1);
 
 	auto plan = CreatePlan(*op.children[0]);
+	if (!op.offset && op.offset_val > 0 && PushdownOffset(*plan, op.offset_val)) {
+		op.offset_val = 0;
+	}
 
 	unique_ptr<PhysicalOperator> limit;
 	if (!PreserveInsertionOrder(*plan)) {
@@ -1,3 +1,4 @@
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/planner/operator/logical_projection.hpp"
@@ -36,6 +37,15 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalProjection
 		}
 	}
 
+	if (plan->type == PhysicalOperatorType::FILTER) {
+		auto &filter = (PhysicalFilter &)*plan;
+		if (filter.CanFuseProjection()) {
+			// evaluate the projection as part of the filter, only for the tuples that pass the filter
+			filter.FuseProjection(op.types, move(op.expressions));
+			return plan;
+		}
+	}
+
 	auto projection = make_unique<PhysicalProjection>(op.types, move(op.expressions), op.estimated_cardinality);
 	projection->children.push_back(move(plan));
 	return move(projection);
@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/helper/physical_reservoir_sample.hpp"
 #include "duckdb/execution/operator/helper/physical_streaming_sample.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/planner/operator/logical_sample.hpp"
 
@@ -22,6 +23,15 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalSample &op
 			                      "reservoir sampling or use a sample_size",
 			                      SampleMethodToString(op.sample_options->method));
 		}
+		if (op.sample_options->method == SampleMethod::SYSTEM_SAMPLE &&
+		    plan->type == PhysicalOperatorType::TABLE_SCAN) {
+			auto &scan = (PhysicalTableScan &)*plan;
+			if (scan.function.sampling_pushdown && !scan.sample_options) {
+				// push the sample into the scan, which skips reading the parts of the table that are not sampled
+				scan.sample_options = move(op.sample_options);
+				return plan;
+			}
+		}
 		sample = make_unique<PhysicalStreamingSample>(op.types, op.sample_options->method,
 		                                              op.sample_options->sample_size.GetValue<double>(),
 		                                              op.sample_options->seed, op.estimated_cardinality);
@@ -12,6 +12,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op)
 	auto top_n =
 	    make_unique<PhysicalTopN>(op.types, move(op.orders), (idx_t)op.limit, op.offset, op.estimated_cardinality);
 	top_n->children.push_back(move(plan));
+	top_n->PushDownDynamicFilter();
 	return move(top_n);
 }
 
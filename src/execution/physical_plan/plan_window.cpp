@@ -1,30 +1,126 @@
 #include "duckdb/execution/operator/aggregate/physical_streaming_window.hpp"
 #include "duckdb/execution/operator/aggregate/physical_window.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
 #include "duckdb/planner/operator/logical_window.hpp"
 
+#include <algorithm>
 #include <numeric>
 
 namespace duckdb {
 
-static bool IsStreamingWindow(unique_ptr<Expression> &expr) {
+//! Evaluates a constant, non-negative offset of a streaming window function
+static bool GetStreamingOffset(ClientContext &context, const unique_ptr<Expression> &expr, idx_t &offset) {
+	if (!expr) {
+		offset = 1;
+		return true;
+	}
+	Value value;
+	if (!expr->IsFoldable() || !ExpressionExecutor::TryEvaluateScalar(context, *expr, value) || value.IsNull()) {
+		return false;
+	}
+	const auto result = value.GetValue<int64_t>();
+	if (result < 0 || result > (int64_t)PhysicalStreamingWindow::MAX_STREAMING_OFFSET) {
+		return false;
+	}
+	offset = result;
+	return true;
+}
+
+//! Whether the (single) input of the window operator is already sorted by the ORDER BY of the window function
+static bool IsOrderedInput(LogicalOperator &input, BoundWindowExpression &wexpr) {
+	for (idx_t order_idx = 0; order_idx < wexpr.orders.size(); ++order_idx) {
+		auto &order = wexpr.orders[order_idx];
+		if (order.expression->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		auto col_idx = ((BoundReferenceExpression &)*order.expression).index;
+
+		// Projections of columns keep the order of their input
+		auto child = &input;
+		while (child->type == LogicalOperatorType::LOGICAL_PROJECTION) {
+			auto &expr = *child->expressions[col_idx];
+			if (expr.type != ExpressionType::BOUND_REF) {
+				return false;
+			}
+			col_idx = ((BoundReferenceExpression &)expr).index;
+			child = child->children[0].get();
+		}
+		if (child->type != LogicalOperatorType::LOGICAL_ORDER_BY) {
+			return false;
+		}
+		auto &sort = (LogicalOrder &)*child;
+		if (order_idx >= sort.orders.size()) {
+			return false;
+		}
+		auto &sort_order = sort.orders[order_idx];
+		if (!sort.projections.empty()) {
+			col_idx = sort.projections[col_idx];
+		}
+		if (sort_order.type != order.type || sort_order.null_order != order.null_order ||
+		    sort_order.expression->type != ExpressionType::BOUND_REF ||
+		    ((BoundReferenceExpression &)*sort_order.expression).index != col_idx) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool IsStreamingWindow(ClientContext &context, unique_ptr<Expression> &expr, LogicalOperator *ordered_input) {
 	auto wexpr = reinterpret_cast<BoundWindowExpression *>(expr.get());
-	if (!wexpr->partitions.empty() || !wexpr->orders.empty() || wexpr->ignore_nulls) {
+	if (!wexpr->partitions.empty() || wexpr->ignore_nulls) {
+		return false;
+	}
+	// We can only stream ordered windows if the input is already sorted
+	const auto has_orders = !wexpr->orders.empty();
+	if (has_orders && (!ordered_input || !IsOrderedInput(*ordered_input, *wexpr))) {
 		return false;
 	}
+	idx_t offset;
 	switch (wexpr->type) {
 	// TODO: add more expression types here?
 	case ExpressionType::WINDOW_AGGREGATE:
-		// We can stream aggregates if they are "running totals" and don't use filters
-		return wexpr->start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr->end == WindowBoundary::CURRENT_ROW_ROWS &&
-		       !wexpr->filter_expr;
+		if (wexpr->filter_expr) {
+			return false;
+		}
+		// We can stream aggregates if they are "running totals"
+		if (wexpr->start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr->end == WindowBoundary::CURRENT_ROW_ROWS) {
+			return true;
+		}
+		// or if they move a frame over the previous rows, and the aggregate can do that without a segment tree
+		if (wexpr->start != WindowBoundary::EXPR_PRECEDING_ROWS || !GetStreamingOffset(context, wexpr->start_expr, offset)) {
+			return false;
+		}
+		if (wexpr->end != WindowBoundary::CURRENT_ROW_ROWS &&
+		    (wexpr->end != WindowBoundary::EXPR_PRECEDING_ROWS || !GetStreamingOffset(context, wexpr->end_expr, offset))) {
+			return false;
+		}
+		return wexpr->aggregate->window && DBConfig::GetConfig(context).options.window_mode == WindowAggregationMode::WINDOW;
+	case ExpressionType::WINDOW_LAG:
+		// The previous values are buffered, as long as the frame can not be empty
+		if (wexpr->start != WindowBoundary::UNBOUNDED_PRECEDING) {
+			return false;
+		}
+		switch (wexpr->end) {
+		case WindowBoundary::CURRENT_ROW_ROWS:
+		case WindowBoundary::CURRENT_ROW_RANGE:
+		case WindowBoundary::UNBOUNDED_FOLLOWING:
+			break;
+		default:
+			return false;
+		}
+		return GetStreamingOffset(context, wexpr->offset_expr, offset) &&
+		       (!wexpr->default_expr || wexpr->default_expr->IsFoldable());
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
 	case ExpressionType::WINDOW_RANK_DENSE:
+		return !has_orders;
 	case ExpressionType::WINDOW_ROW_NUMBER:
 		return true;
 	default:
@@ -35,7 +131,6 @@ static bool IsStreamingWindow(unique_ptr<Expression> &expr) {
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op) {
 	D_ASSERT(op.children.size() == 1);
 
-	auto plan = CreatePlan(*op.children[0]);
 #ifdef DEBUG
 	for (auto &expr : op.expressions) {
 		D_ASSERT(expr->IsWindow());
@@ -51,12 +146,27 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 	vector<idx_t> blocking_windows;
 	vector<idx_t> streaming_windows;
 	for (idx_t expr_idx = 0; expr_idx < op.expressions.size(); expr_idx++) {
-		if (IsStreamingWindow(op.expressions[expr_idx])) {
+		if (IsStreamingWindow(context, op.expressions[expr_idx], op.children[0].get())) {
 			streaming_windows.push_back(expr_idx);
 		} else {
 			blocking_windows.push_back(expr_idx);
 		}
 	}
+	// Blocking windows are evaluated first and change the order of the rows
+	if (!blocking_windows.empty()) {
+		vector<idx_t> unordered_windows;
+		for (const auto &expr_idx : streaming_windows) {
+			if (IsStreamingWindow(context, op.expressions[expr_idx], nullptr)) {
+				unordered_windows.push_back(expr_idx);
+			} else {
+				blocking_windows.push_back(expr_idx);
+			}
+		}
+		streaming_windows.swap(unordered_windows);
+		std::sort(blocking_windows.begin(), blocking_windows.end());
+	}
+
+	auto plan = CreatePlan(*op.children[0]);
 
 	// Process the window functions by sharing the partition/order definitions
 	vector<idx_t> evaluation_order;
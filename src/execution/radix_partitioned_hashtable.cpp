@@ -99,6 +99,11 @@ void RadixPartitionedHashTable::SetMultiScan(GlobalSinkState &state) {
 	gstate.multi_scan = true;
 }
 
+void RadixPartitionedHashTable::SetSingleScan(GlobalSinkState &state) {
+	auto &gstate = (RadixHTGlobalState &)state;
+	gstate.multi_scan = false;
+}
+
 unique_ptr<GlobalSinkState> RadixPartitionedHashTable::GetGlobalSinkState(ClientContext &context) const {
 	return make_unique<RadixHTGlobalState>(context);
 }
@@ -280,6 +285,10 @@ public:
 			}
 		}
 		gstate.finalized_hts[radix]->Finalize();
+		if (gstate.finalized_hts[radix]->CanUnpin()) {
+			// the partition is complete: allow it to be spilled until it is scanned
+			gstate.finalized_hts[radix]->Unpin();
+		}
 	}
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
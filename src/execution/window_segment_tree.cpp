@@ -11,7 +11,7 @@ WindowSegmentTree::WindowSegmentTree(AggregateFunction &aggregate, FunctionData
                                      const ValidityMask &filter_mask_p, WindowAggregationMode mode_p)
     : aggregate(aggregate), bind_info(bind_info), result_type(result_type_p), state(aggregate.state_size()),
       statep(Value::POINTER((idx_t)state.data())), frame(0, 0), statev(Value::POINTER((idx_t)state.data())),
-      internal_nodes(0), input_ref(input), filter_mask(filter_mask_p), mode(mode_p) {
+      levels_flat(nullptr), internal_nodes(0), input_ref(input), filter_mask(filter_mask_p), mode(mode_p) {
 	statep.Flatten(input->size());
 	statev.SetVectorType(VectorType::FLAT_VECTOR); // Prevent conversion of results to constants
 
@@ -31,6 +31,30 @@ WindowSegmentTree::WindowSegmentTree(AggregateFunction &aggregate, FunctionData
 	}
 }
 
+WindowSegmentTree::WindowSegmentTree(const WindowSegmentTree &shared, DataChunk *input,
+                                     const ValidityMask &filter_mask_p)
+    : aggregate(shared.aggregate), bind_info(shared.bind_info), result_type(shared.result_type),
+      state(aggregate.state_size()), statep(Value::POINTER((idx_t)state.data())), frame(0, 0),
+      statev(Value::POINTER((idx_t)state.data())), levels_flat(shared.levels_flat),
+      levels_flat_start(shared.levels_flat_start), internal_nodes(0), input_ref(input), filter_mask(filter_mask_p),
+      mode(shared.mode) {
+	D_ASSERT(input->size() == shared.input_ref->size());
+	statep.Flatten(input->size());
+	statev.SetVectorType(VectorType::FLAT_VECTOR); // Prevent conversion of results to constants
+
+	if (input_ref && input_ref->ColumnCount() > 0) {
+		filter_sel.Initialize(input->size());
+		inputs.Initialize(Allocator::DefaultAllocator(), input_ref->GetTypes());
+		// the window API keeps a state per tree, the nodes of the tree are only read
+		if (aggregate.window && UseWindowAPI()) {
+			AggregateInit();
+			inputs.Reference(*input_ref);
+		} else {
+			inputs.SetCapacity(*input_ref);
+		}
+	}
+}
+
 WindowSegmentTree::~WindowSegmentTree() {
 	if (!aggregate.destructor) {
 		// nothing to destroy
@@ -110,7 +134,7 @@ void WindowSegmentTree::WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end)
 		aggregate.update(&inputs.data[0], aggr_input_data, input_ref->ColumnCount(), s, inputs.size());
 	} else {
 		// find out where the states begin
-		data_ptr_t begin_ptr = levels_flat_native.get() + state.size() * (begin + levels_flat_start[l_idx - 1]);
+		data_ptr_t begin_ptr = levels_flat + state.size() * (begin + levels_flat_start[l_idx - 1]);
 		// set up a vector of pointers that point towards the set of states
 		Vector v(LogicalType::POINTER, count);
 		auto pdata = FlatVector::GetData<data_ptr_t>(v);
@@ -135,6 +159,7 @@ void WindowSegmentTree::ConstructTree() {
 		internal_nodes += level_nodes;
 	} while (level_nodes > 1);
 	levels_flat_native = unique_ptr<data_t[]>(new data_t[internal_nodes * state.size()]);
+	levels_flat = levels_flat_native.get();
 	levels_flat_start.push_back(0);
 
 	idx_t levels_flat_offset = 0;
@@ -70,6 +70,12 @@ struct AverageSetOperation {
 	static void AddValues(STATE *state, idx_t count) {
 		state->count += count;
 	}
+	template <class STATE>
+	static bool WindowValues(STATE *state, idx_t added, idx_t removed) {
+		state->count += added;
+		state->count -= removed;
+		return true;
+	}
 };
 
 template <class T>
@@ -152,16 +158,27 @@ struct KahanAverageOperation : public BaseSumOperation<AverageSetOperation, Kaha
 AggregateFunction GetAverageAggregate(PhysicalType type) {
 	switch (type) {
 	case PhysicalType::INT16: {
-		return AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
+		auto function = AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
 		    LogicalType::SMALLINT, LogicalType::DOUBLE);
+		function.window = AggregateFunction::UnaryWindow<AvgState<int64_t>, int16_t, double,
+		                                                 IntegerSumWindowOperation<IntegerAverageOperation>>;
+		return function;
 	}
 	case PhysicalType::INT32: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::INTEGER, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::INTEGER, LogicalType::DOUBLE);
+		function.window = AggregateFunction::UnaryWindow<AvgState<hugeint_t>, int32_t, double,
+		                                                 IntegerSumWindowOperation<IntegerAverageOperationHugeint>>;
+		return function;
 	}
 	case PhysicalType::INT64: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::BIGINT, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::BIGINT, LogicalType::DOUBLE);
+		function.window = AggregateFunction::UnaryWindow<AvgState<hugeint_t>, int64_t, double,
+		                                                 IntegerSumWindowOperation<IntegerAverageOperationHugeint>>;
+		return function;
 	}
 	case PhysicalType::INT128: {
 		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
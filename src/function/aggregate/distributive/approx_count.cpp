@@ -114,6 +114,90 @@ static void ApproxCountDistinctUpdateFunction(Vector inputs[], AggregateInputDat
 	HyperLogLog::AddToLogs(vdata, count, indices, counts, (HyperLogLog ***)states, sdata.sel);
 }
 
+//! The sketch functions share the state and the update of approx_count_distinct, but return the HLL itself
+struct HLLSketchFunction : public ApproxCountDistinctFunction {
+	template <class T, class STATE>
+	static void Finalize(Vector &result, AggregateInputData &, STATE *state, T *target, ValidityMask &mask, idx_t idx) {
+		if (state->log) {
+			target[idx] = state->log->ToBlob(result);
+		} else {
+			HyperLogLog empty_log;
+			target[idx] = empty_log.ToBlob(result);
+		}
+	}
+};
+
+static void HLLMergeBlob(ApproxDistinctCountState &state, const string_t &blob) {
+	auto log = HyperLogLog::FromBlob(blob);
+	if (!state.log) {
+		state.log = log.release();
+		return;
+	}
+	auto new_log = state.log->MergePointer(*log);
+	delete state.log;
+	state.log = new_log;
+}
+
+static void HLLMergeSimpleUpdateFunction(Vector inputs[], AggregateInputData &, idx_t input_count, data_ptr_t state,
+                                         idx_t count) {
+	D_ASSERT(input_count == 1);
+	auto agg_state = (ApproxDistinctCountState *)state;
+
+	UnifiedVectorFormat vdata;
+	inputs[0].ToUnifiedFormat(count, vdata);
+	auto blobs = (string_t *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (vdata.validity.RowIsValid(idx)) {
+			HLLMergeBlob(*agg_state, blobs[idx]);
+		}
+	}
+}
+
+static void HLLMergeUpdateFunction(Vector inputs[], AggregateInputData &, idx_t input_count, Vector &state_vector,
+                                   idx_t count) {
+	D_ASSERT(input_count == 1);
+
+	UnifiedVectorFormat sdata;
+	state_vector.ToUnifiedFormat(count, sdata);
+	auto states = (ApproxDistinctCountState **)sdata.data;
+
+	UnifiedVectorFormat vdata;
+	inputs[0].ToUnifiedFormat(count, vdata);
+	auto blobs = (string_t *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (vdata.validity.RowIsValid(idx)) {
+			HLLMergeBlob(*states[sdata.sel->get_index(i)], blobs[idx]);
+		}
+	}
+}
+
+static AggregateFunction GetHLLSketchFunction(const LogicalType &input_type) {
+	auto fun = AggregateFunction(
+	    {input_type}, LogicalType::BLOB, AggregateFunction::StateSize<ApproxDistinctCountState>,
+	    AggregateFunction::StateInitialize<ApproxDistinctCountState, ApproxCountDistinctFunction>,
+	    ApproxCountDistinctUpdateFunction,
+	    AggregateFunction::StateCombine<ApproxDistinctCountState, ApproxCountDistinctFunction>,
+	    AggregateFunction::StateFinalize<ApproxDistinctCountState, string_t, HLLSketchFunction>,
+	    ApproxCountDistinctSimpleUpdateFunction, nullptr,
+	    AggregateFunction::StateDestroy<ApproxDistinctCountState, ApproxCountDistinctFunction>);
+	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return fun;
+}
+
+static AggregateFunction GetHLLMergeFunction() {
+	auto fun = AggregateFunction(
+	    {LogicalType::BLOB}, LogicalType::BLOB, AggregateFunction::StateSize<ApproxDistinctCountState>,
+	    AggregateFunction::StateInitialize<ApproxDistinctCountState, ApproxCountDistinctFunction>,
+	    HLLMergeUpdateFunction, AggregateFunction::StateCombine<ApproxDistinctCountState, ApproxCountDistinctFunction>,
+	    AggregateFunction::StateFinalize<ApproxDistinctCountState, string_t, HLLSketchFunction>,
+	    HLLMergeSimpleUpdateFunction, nullptr,
+	    AggregateFunction::StateDestroy<ApproxDistinctCountState, ApproxCountDistinctFunction>);
+	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return fun;
+}
+
 AggregateFunction GetApproxCountDistinctFunction(const LogicalType &input_type) {
 	auto fun = AggregateFunction(
 	    {input_type}, LogicalTypeId::BIGINT, AggregateFunction::StateSize<ApproxDistinctCountState>,
@@ -127,22 +211,31 @@ AggregateFunction GetApproxCountDistinctFunction(const LogicalType &input_type)
 	return fun;
 }
 
+static vector<LogicalType> GetApproxCountDistinctTypes() {
+	return {LogicalType::UTINYINT, LogicalType::USMALLINT, LogicalType::UINTEGER,  LogicalType::UBIGINT,
+	        LogicalType::TINYINT,  LogicalType::SMALLINT,  LogicalType::BIGINT,    LogicalType::HUGEINT,
+	        LogicalType::FLOAT,    LogicalType::DOUBLE,    LogicalType::VARCHAR,   LogicalType::TIMESTAMP,
+	        LogicalType::TIMESTAMP_TZ};
+}
+
 void ApproxCountDistinctFun::RegisterFunction(BuiltinFunctions &set) {
 	AggregateFunctionSet approx_count("approx_count_distinct");
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UTINYINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::USMALLINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UINTEGER));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UBIGINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::TINYINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::SMALLINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::BIGINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::HUGEINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::FLOAT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::DOUBLE));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::VARCHAR));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::TIMESTAMP));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::TIMESTAMP_TZ));
+	for (auto &type : GetApproxCountDistinctTypes()) {
+		approx_count.AddFunction(GetApproxCountDistinctFunction(type));
+	}
 	set.AddFunction(approx_count);
 }
 
+void HLLSketchFun::RegisterFunction(BuiltinFunctions &set) {
+	AggregateFunctionSet hll_sketch("hll_sketch");
+	for (auto &type : GetApproxCountDistinctTypes()) {
+		hll_sketch.AddFunction(GetHLLSketchFunction(type));
+	}
+	set.AddFunction(hll_sketch);
+
+	AggregateFunctionSet hll_merge("hll_merge");
+	hll_merge.AddFunction(GetHLLMergeFunction());
+	set.AddFunction(hll_merge);
+}
+
 } // namespace duckdb
@@ -47,6 +47,31 @@ struct CountFunction : public BaseCountFunction {
 		*state += count;
 	}
 
+	template <class STATE, class INPUT_TYPE, class RESULT_TYPE>
+	static void Window(const INPUT_TYPE *data, const ValidityMask &fmask, const ValidityMask &dmask,
+	                   AggregateInputData &, STATE *state, const FrameBounds &frame, const FrameBounds &prev,
+	                   Vector &result, idx_t rid, idx_t bias) {
+		auto count_valid = [&](idx_t begin, idx_t end) {
+			STATE count = 0;
+			for (auto i = begin; i < end; ++i) {
+				count += fmask.RowIsValid(i) && dmask.RowIsValid(i - bias);
+			}
+			return count;
+		};
+		// the count of the frame is moved, rather than recomputed, when the frame slides
+		auto add = [&](idx_t begin, idx_t end) {
+			*state += count_valid(begin, end);
+		};
+		auto remove = [&](idx_t begin, idx_t end) {
+			*state -= count_valid(begin, end);
+		};
+		if (!AggregateExecutor::SlideFrame(frame, prev, add, remove)) {
+			*state = count_valid(frame.first, frame.second);
+		}
+		auto rdata = FlatVector::GetData<RESULT_TYPE>(result);
+		rdata[rid] = *state;
+	}
+
 	static bool IgnoreNull() {
 		return true;
 	}
@@ -55,6 +80,7 @@ struct CountFunction : public BaseCountFunction {
 AggregateFunction CountFun::GetFunction() {
 	auto fun = AggregateFunction::UnaryAggregate<int64_t, int64_t, int64_t, CountFunction>(
 	    LogicalType(LogicalTypeId::ANY), LogicalType::BIGINT);
+	fun.window = AggregateFunction::UnaryWindow<int64_t, int64_t, int64_t, CountFunction>;
 	fun.name = "count";
 	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
 	return fun;
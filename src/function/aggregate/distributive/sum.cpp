@@ -21,6 +21,17 @@ struct SumSetOperation {
 	static void AddValues(STATE *state, idx_t count) {
 		state->isset = true;
 	}
+	template <class STATE>
+	static bool WindowValues(STATE *state, idx_t added, idx_t removed) {
+		if (added > 0) {
+			state->isset = true;
+		} else if (removed > 0) {
+			// we can not tell whether the frame still holds any values
+			state->isset = false;
+			return false;
+		}
+		return true;
+	}
 };
 
 struct IntegerSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd> {
@@ -45,6 +56,42 @@ struct SumToHugeintOperation : public BaseSumOperation<SumSetOperation, HugeintA
 	}
 };
 
+//! Sums a vector of integers into a hugeint state. Without NULL values, the vector is first summed in 64-bit integers
+//! in a loop the compiler can vectorize, which also tracks the minimum and maximum value: if these show the 64-bit sum
+//! cannot have overflowed, it is added to the hugeint at once. Otherwise every value is added to the hugeint
+//! separately.
+template <class T>
+static void SumToHugeintUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                               data_ptr_t state_p, idx_t count) {
+	D_ASSERT(input_count == 1);
+	auto &input = inputs[0];
+	if (count == 0 || input.GetVectorType() != VectorType::FLAT_VECTOR || !FlatVector::Validity(input).AllValid()) {
+		AggregateFunction::UnaryUpdate<SumState<hugeint_t>, T, SumToHugeintOperation>(inputs, aggr_input_data,
+		                                                                              input_count, state_p, count);
+		return;
+	}
+	auto data = FlatVector::GetData<T>(input);
+	// unsigned arithmetic wraps around on overflow, in which case the sum is discarded below
+	uint64_t sum = 0;
+	T min = data[0];
+	T max = data[0];
+	for (idx_t i = 0; i < count; i++) {
+		sum += uint64_t(int64_t(data[i]));
+		min = MinValue<T>(min, data[i]);
+		max = MaxValue<T>(max, data[i]);
+	}
+	auto bound = NumericLimits<int64_t>::Maximum() / int64_t(count);
+	if (int64_t(min) < -bound || int64_t(max) > bound) {
+		// the 64-bit sum might have overflowed
+		AggregateFunction::UnaryUpdate<SumState<hugeint_t>, T, SumToHugeintOperation>(inputs, aggr_input_data,
+		                                                                              input_count, state_p, count);
+		return;
+	}
+	auto state = (SumState<hugeint_t> *)state_p;
+	state->isset = true;
+	HugeintAdd::AddNumber<SumState<hugeint_t>, int64_t>(*state, int64_t(sum));
+}
+
 template <class ADD_OPERATOR>
 struct DoubleSumOperation : public BaseSumOperation<SumSetOperation, ADD_OPERATOR> {
 	template <class T, class STATE>
@@ -115,6 +162,8 @@ AggregateFunction SumFun::GetSumAggregate(PhysicalType type) {
 	case PhysicalType::INT16: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::SMALLINT, LogicalType::HUGEINT);
+		function.window = AggregateFunction::UnaryWindow<SumState<int64_t>, int16_t, hugeint_t,
+		                                                 IntegerSumWindowOperation<IntegerSumOperation>>;
 		return function;
 	}
 
@@ -122,6 +171,9 @@ AggregateFunction SumFun::GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int32_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::INTEGER, LogicalType::HUGEINT);
+		function.simple_update = SumToHugeintUpdate<int32_t>;
+		function.window = AggregateFunction::UnaryWindow<SumState<hugeint_t>, int32_t, hugeint_t,
+		                                                 IntegerSumWindowOperation<SumToHugeintOperation>>;
 		function.statistics = SumPropagateStats;
 		return function;
 	}
@@ -129,6 +181,9 @@ AggregateFunction SumFun::GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int64_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::BIGINT, LogicalType::HUGEINT);
+		function.simple_update = SumToHugeintUpdate<int64_t>;
+		function.window = AggregateFunction::UnaryWindow<SumState<hugeint_t>, int64_t, hugeint_t,
+		                                                 IntegerSumWindowOperation<SumToHugeintOperation>>;
 		function.statistics = SumPropagateStats;
 		return function;
 	}
@@ -148,12 +203,16 @@ AggregateFunction SumFun::GetSumAggregateNoOverflow(PhysicalType type) {
 	case PhysicalType::INT32: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int32_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::INTEGER, LogicalType::HUGEINT);
+		function.window = AggregateFunction::UnaryWindow<SumState<int64_t>, int32_t, hugeint_t,
+		                                                 IntegerSumWindowOperation<IntegerSumOperation>>;
 		function.name = "sum_no_overflow";
 		return function;
 	}
 	case PhysicalType::INT64: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int64_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::BIGINT, LogicalType::HUGEINT);
+		function.window = AggregateFunction::UnaryWindow<SumState<int64_t>, int64_t, hugeint_t,
+		                                                 IntegerSumWindowOperation<IntegerSumOperation>>;
 		function.name = "sum_no_overflow";
 		return function;
 	}
@@ -18,6 +18,7 @@ void BuiltinFunctions::RegisterDistributiveAggregates() {
 	Register<SumFun>();
 	Register<StringAggFun>();
 	Register<ApproxCountDistinctFun>();
+	Register<HLLSketchFun>();
 	Register<ProductFun>();
 	Register<BoolOrFun>();
 	Register<BoolAndFun>();
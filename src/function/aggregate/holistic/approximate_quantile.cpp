@@ -4,6 +4,7 @@
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/field_writer.hpp"
+#include "duckdb/common/vector_operations/binary_executor.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -347,6 +348,129 @@ AggregateFunction GetApproxQuantileListAggregate(const LogicalType &type) {
 	return fun;
 }
 
+//===--------------------------------------------------------------------===//
+// Mergeable t-digest sketches
+//===--------------------------------------------------------------------===//
+// A sketch holds a version byte and the compression, followed by the (mean, weight) pairs of the compressed digest
+static constexpr const uint8_t TDIGEST_SKETCH_VERSION = 1;
+static constexpr const double TDIGEST_SKETCH_COMPRESSION = 100;
+
+static string_t TDigestToBlob(duckdb_tdigest::TDigest *digest, Vector &result) {
+	idx_t centroid_count = 0;
+	if (digest) {
+		digest->compress();
+		centroid_count = digest->processed().size();
+	}
+	auto blob_size = sizeof(uint8_t) + sizeof(double) + centroid_count * 2 * sizeof(double);
+	auto blob = StringVector::EmptyString(result, blob_size);
+	auto ptr = (data_ptr_t)blob.GetDataWriteable();
+	Store<uint8_t>(TDIGEST_SKETCH_VERSION, ptr);
+	ptr += sizeof(uint8_t);
+	Store<double>(digest ? digest->compression() : TDIGEST_SKETCH_COMPRESSION, ptr);
+	ptr += sizeof(double);
+	for (idx_t i = 0; i < centroid_count; i++) {
+		auto &centroid = digest->processed()[i];
+		Store<double>(centroid.mean(), ptr);
+		Store<double>(centroid.weight(), ptr + sizeof(double));
+		ptr += 2 * sizeof(double);
+	}
+	blob.Finalize();
+	return blob;
+}
+
+static unique_ptr<duckdb_tdigest::TDigest> TDigestFromBlob(const string_t &blob) {
+	const idx_t header_size = sizeof(uint8_t) + sizeof(double);
+	auto size = blob.GetSize();
+	auto ptr = (const_data_ptr_t)blob.GetDataUnsafe();
+	if (size < header_size || (size - header_size) % (2 * sizeof(double)) != 0 ||
+	    Load<uint8_t>(ptr) != TDIGEST_SKETCH_VERSION) {
+		throw InvalidInputException("Invalid t-digest sketch: the blob was not created by tdigest_sketch");
+	}
+	auto compression = Load<double>(ptr + sizeof(uint8_t));
+	if (!(compression > 0)) {
+		throw InvalidInputException("Invalid t-digest sketch: the blob was not created by tdigest_sketch");
+	}
+	ptr += header_size;
+	auto centroid_count = (size - header_size) / (2 * sizeof(double));
+	vector<duckdb_tdigest::Centroid> centroids;
+	centroids.reserve(centroid_count);
+	for (idx_t i = 0; i < centroid_count; i++) {
+		auto mean = Load<double>(ptr);
+		auto weight = Load<double>(ptr + sizeof(double));
+		if (!(weight > 0) || (!centroids.empty() && mean < centroids.back().mean())) {
+			throw InvalidInputException("Invalid t-digest sketch: the blob was not created by tdigest_sketch");
+		}
+		centroids.emplace_back(mean, weight);
+		ptr += 2 * sizeof(double);
+	}
+	vector<duckdb_tdigest::Centroid> unprocessed;
+	return make_unique<duckdb_tdigest::TDigest>(move(centroids), move(unprocessed), compression, 0, 0);
+}
+
+struct TDigestSketchOperation : public ApproxQuantileOperation {
+	template <class TARGET_TYPE, class STATE>
+	static void Finalize(Vector &result, AggregateInputData &, STATE *state, TARGET_TYPE *target, ValidityMask &mask,
+	                     idx_t idx) {
+		target[idx] = TDigestToBlob(state->h, result);
+	}
+};
+
+struct TDigestMergeOperation : public TDigestSketchOperation {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE *state, AggregateInputData &aggr_input_data, INPUT_TYPE *input,
+	                              ValidityMask &mask, idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			Operation<INPUT_TYPE, STATE, OP>(state, aggr_input_data, input, mask, 0);
+		}
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE *state, AggregateInputData &, INPUT_TYPE *data, ValidityMask &mask, idx_t idx) {
+		auto digest = TDigestFromBlob(data[idx]);
+		if (digest->processed().empty()) {
+			return;
+		}
+		if (!state->h) {
+			state->h = new duckdb_tdigest::TDigest(digest->compression());
+		}
+		state->h->merge(digest.get());
+		state->pos += digest->totalWeight();
+	}
+};
+
+static void TDigestQuantileFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::ExecuteWithNulls<string_t, double, double>(
+	    args.data[0], args.data[1], result, args.size(),
+	    [&](string_t blob, double quantile, ValidityMask &mask, idx_t idx) {
+		    if (quantile < 0 || quantile > 1) {
+			    throw InvalidInputException("tdigest_quantile can only take quantiles in range [0, 1]");
+		    }
+		    auto digest = TDigestFromBlob(blob);
+		    if (digest->processed().empty()) {
+			    mask.SetInvalid(idx);
+			    return 0.0;
+		    }
+		    return digest->quantile(quantile);
+	    });
+}
+
+void TDigestSketchFun::RegisterFunction(BuiltinFunctions &set) {
+	AggregateFunctionSet tdigest_sketch("tdigest_sketch");
+	tdigest_sketch.AddFunction(
+	    AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, double, string_t, TDigestSketchOperation>(
+	        LogicalType::DOUBLE, LogicalType::BLOB));
+	set.AddFunction(tdigest_sketch);
+
+	AggregateFunctionSet tdigest_merge("tdigest_merge");
+	tdigest_merge.AddFunction(
+	    AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, string_t, string_t, TDigestMergeOperation>(
+	        LogicalType::BLOB, LogicalType::BLOB));
+	set.AddFunction(tdigest_merge);
+
+	set.AddFunction(ScalarFunction("tdigest_quantile", {LogicalType::BLOB, LogicalType::DOUBLE}, LogicalType::DOUBLE,
+	                               TDigestQuantileFunction));
+}
+
 void ApproximateQuantileFun::RegisterFunction(BuiltinFunctions &set) {
 	AggregateFunctionSet approx_quantile("approx_quantile");
 	approx_quantile.AddFunction(AggregateFunction({LogicalTypeId::DECIMAL, LogicalType::FLOAT}, LogicalTypeId::DECIMAL,
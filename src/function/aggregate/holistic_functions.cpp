@@ -6,6 +6,7 @@ void BuiltinFunctions::RegisterHolisticAggregates() {
 	Register<QuantileFun>();
 	Register<ModeFun>();
 	Register<ApproximateQuantileFun>();
+	Register<TDigestSketchFun>();
 	Register<ReservoirQuantileFun>();
 }
 
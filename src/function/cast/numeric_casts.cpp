@@ -75,4 +75,58 @@ BoundCastInfo DefaultCasts::NumericCastSwitch(BindCastInput &input, const Logica
 	}
 }
 
+struct UncheckedIntegerCast {
+	template <class SRC, class DST>
+	static inline DST Operation(SRC input) {
+		return DST(input);
+	}
+};
+
+template <class SRC>
+static cast_function_t InternalUncheckedIntegerCastSwitch(const LogicalType &target) {
+	switch (target.id()) {
+	case LogicalTypeId::TINYINT:
+		return &VectorCastHelpers::TemplatedCastLoop<SRC, int8_t, UncheckedIntegerCast>;
+	case LogicalTypeId::SMALLINT:
+		return &VectorCastHelpers::TemplatedCastLoop<SRC, int16_t, UncheckedIntegerCast>;
+	case LogicalTypeId::INTEGER:
+		return &VectorCastHelpers::TemplatedCastLoop<SRC, int32_t, UncheckedIntegerCast>;
+	case LogicalTypeId::BIGINT:
+		return &VectorCastHelpers::TemplatedCastLoop<SRC, int64_t, UncheckedIntegerCast>;
+	case LogicalTypeId::UTINYINT:
+		return &VectorCastHelpers::TemplatedCastLoop<SRC, uint8_t, UncheckedIntegerCast>;
+	case LogicalTypeId::USMALLINT:
+		return &VectorCastHelpers::TemplatedCastLoop<SRC, uint16_t, UncheckedIntegerCast>;
+	case LogicalTypeId::UINTEGER:
+		return &VectorCastHelpers::TemplatedCastLoop<SRC, uint32_t, UncheckedIntegerCast>;
+	case LogicalTypeId::UBIGINT:
+		return &VectorCastHelpers::TemplatedCastLoop<SRC, uint64_t, UncheckedIntegerCast>;
+	default:
+		return nullptr;
+	}
+}
+
+cast_function_t DefaultCasts::GetUncheckedIntegerCast(const LogicalType &source, const LogicalType &target) {
+	switch (source.id()) {
+	case LogicalTypeId::TINYINT:
+		return InternalUncheckedIntegerCastSwitch<int8_t>(target);
+	case LogicalTypeId::SMALLINT:
+		return InternalUncheckedIntegerCastSwitch<int16_t>(target);
+	case LogicalTypeId::INTEGER:
+		return InternalUncheckedIntegerCastSwitch<int32_t>(target);
+	case LogicalTypeId::BIGINT:
+		return InternalUncheckedIntegerCastSwitch<int64_t>(target);
+	case LogicalTypeId::UTINYINT:
+		return InternalUncheckedIntegerCastSwitch<uint8_t>(target);
+	case LogicalTypeId::USMALLINT:
+		return InternalUncheckedIntegerCastSwitch<uint16_t>(target);
+	case LogicalTypeId::UINTEGER:
+		return InternalUncheckedIntegerCastSwitch<uint32_t>(target);
+	case LogicalTypeId::UBIGINT:
+		return InternalUncheckedIntegerCastSwitch<uint64_t>(target);
+	default:
+		return nullptr;
+	}
+}
+
 } // namespace duckdb
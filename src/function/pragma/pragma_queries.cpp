@@ -2,6 +2,9 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parser/parser.hpp"
+#include "duckdb/parser/statement/create_statement.hpp"
 
 namespace duckdb {
 
@@ -65,9 +68,9 @@ string PragmaImportDatabase(ClientContext &context, const FunctionParameters &pa
 	auto &fs = FileSystem::GetFileSystem(context);
 	auto *opener = FileSystem::GetFileOpener(context);
 
-	string query;
 	// read the "shema.sql" and "load.sql" files
 	vector<string> files = {"schema.sql", "load.sql"};
+	vector<string> contents;
 	for (auto &file : files) {
 		auto file_path = fs.JoinPath(parameters.values[0].ToString(), file);
 		auto handle = fs.OpenFile(file_path, FileFlags::FILE_FLAGS_READ, FileSystem::DEFAULT_LOCK,
@@ -76,8 +79,25 @@ string PragmaImportDatabase(ClientContext &context, const FunctionParameters &pa
 		auto buffer = unique_ptr<char[]>(new char[fsize]);
 		fs.Read(*handle, buffer.get(), fsize);
 
-		query += string(buffer.get(), fsize);
+		contents.emplace_back(buffer.get(), fsize);
+	}
+	// the indexes are created after the tables are loaded: building an index over all rows of a table at once (from
+	// the sorted keys) is much faster than inserting every loaded chunk into the index
+	Parser parser(context.GetParserOptions());
+	parser.ParseQuery(contents[0]);
+	string query;
+	string create_indexes;
+	for (auto &statement : parser.statements) {
+		auto statement_sql = contents[0].substr(statement->stmt_location, statement->stmt_length) + ";\n";
+		if (statement->type == StatementType::CREATE_STATEMENT &&
+		    ((CreateStatement &)*statement).info->type == CatalogType::INDEX_ENTRY) {
+			create_indexes += statement_sql;
+		} else {
+			query += statement_sql;
+		}
 	}
+	query += contents[1];
+	query += create_indexes;
 	return query;
 }
 
@@ -0,0 +1,23 @@
+#include "duckdb/function/scalar/blob_functions.hpp"
+#include "duckdb/common/types/hyperloglog.hpp"
+
+namespace duckdb {
+
+struct HLLEstimateOperator {
+	template <class INPUT_TYPE, class RESULT_TYPE>
+	static RESULT_TYPE Operation(INPUT_TYPE input) {
+		auto log = HyperLogLog::FromBlob(input);
+		return (RESULT_TYPE)log->Count();
+	}
+};
+
+static void HLLEstimateFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::Execute<string_t, int64_t, HLLEstimateOperator>(args.data[0], result, args.size());
+}
+
+void HLLEstimateFun::RegisterFunction(BuiltinFunctions &set) {
+	// hll_estimate returns the distinct count of a sketch created with hll_sketch or hll_merge
+	set.AddFunction(ScalarFunction("hll_estimate", {LogicalType::BLOB}, LogicalType::BIGINT, HLLEstimateFunction));
+}
+
+} // namespace duckdb
@@ -27,6 +27,16 @@ struct DateTrunc {
 		UnaryExecutor::Execute<TA, TR>(left, result, count, UnaryFunction<TA, TR, OP>);
 	}
 
+	//! Truncates a timestamp to a multiple of a unit that evenly divides a day, timestamps before the epoch are rounded
+	//! down as well
+	static inline timestamp_t TruncateMicros(timestamp_t input, int64_t unit) {
+		auto remainder = input.value % unit;
+		if (remainder < 0) {
+			remainder += unit;
+		}
+		return timestamp_t(input.value - remainder);
+	}
+
 	struct MillenniumOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
@@ -99,49 +109,28 @@ struct DateTrunc {
 	struct HourOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, 0, 0, 0));
+			return TruncateMicros(input, Interval::MICROS_PER_HOUR);
 		}
 	};
 
 	struct MinuteOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, min, 0, 0));
+			return TruncateMicros(input, Interval::MICROS_PER_MINUTE);
 		}
 	};
 
 	struct SecondOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, min, sec, 0));
+			return TruncateMicros(input, Interval::MICROS_PER_SEC);
 		}
 	};
 
 	struct MillisecondOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			micros -= micros % Interval::MICROS_PER_MSEC;
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, min, sec, micros));
+			return TruncateMicros(input, Interval::MICROS_PER_MSEC);
 		}
 	};
 
@@ -511,26 +500,103 @@ struct DateTruncBinaryOperator {
 	}
 };
 
+//! Truncates to buckets of a number of months, consecutive values often fall into the same bucket: once two
+//! consecutive truncations have the same result, the end of the bucket is computed and the result is reused for all
+//! values up to it
+template <typename TA, typename TR, class OP, int32_t MONTHS>
+struct DateTruncBucketExecutor {
+	static inline date_t GetDate(date_t input) {
+		return input;
+	}
+
+	static inline date_t GetDate(timestamp_t input) {
+		return Timestamp::GetDate(input);
+	}
+
+	static inline void SetResult(date_t bucket, date_t &result) {
+		result = bucket;
+	}
+
+	static inline void SetResult(date_t bucket, timestamp_t &result) {
+		result = Timestamp::FromDatetime(bucket, dtime_t(0));
+	}
+
+	//! Returns the end of the bucket that starts at the given date, or the start of the bucket if it can not be used
+	static date_t GetBucketEnd(date_t bucket_start) {
+		int32_t yyyy, mm, dd;
+		Date::Convert(bucket_start, yyyy, mm, dd);
+		int64_t month_index = int64_t(yyyy) * Interval::MONTHS_PER_YEAR + (mm - 1) + MONTHS;
+		auto year = month_index / Interval::MONTHS_PER_YEAR;
+		auto month = month_index % Interval::MONTHS_PER_YEAR;
+		if (month < 0) {
+			year--;
+			month += Interval::MONTHS_PER_YEAR;
+		}
+		date_t bucket_end;
+		if (!Date::TryFromDate(year, month + 1, 1, bucket_end)) {
+			return bucket_start;
+		}
+		// truncation is monotonic: if the last day of the bucket is truncated to its start, all of its days are
+		if (OP::template Operation<date_t, date_t>(bucket_end - 1) != bucket_start) {
+			return bucket_start;
+		}
+		return bucket_end;
+	}
+
+	static void Execute(Vector &left, Vector &result, idx_t count) {
+		date_t bucket_start(0);
+		date_t bucket_end(0);
+		TR bucket_result;
+		date_t previous(0);
+		UnaryExecutor::Execute<TA, TR>(left, result, count, [&](TA input) {
+			if (!Value::IsFinite(input)) {
+				return Cast::template Operation<TA, TR>(input);
+			}
+			auto date = GetDate(input);
+			if (date >= bucket_start && date < bucket_end) {
+				return bucket_result;
+			}
+			auto truncated = OP::template Operation<date_t, date_t>(date);
+			if (truncated == previous) {
+				bucket_start = truncated;
+				bucket_end = GetBucketEnd(truncated);
+				SetResult(truncated, bucket_result);
+			}
+			previous = truncated;
+			TR truncated_result;
+			SetResult(truncated, truncated_result);
+			return truncated_result;
+		});
+	}
+};
+
+template <class OP, int32_t MONTHS>
+struct DateTruncBucketExecutor<interval_t, interval_t, OP, MONTHS> {
+	static void Execute(Vector &left, Vector &result, idx_t count) {
+		DateTrunc::UnaryExecute<interval_t, interval_t, OP>(left, result, count);
+	}
+};
+
 template <typename TA, typename TR>
 static void DateTruncUnaryExecutor(DatePartSpecifier type, Vector &left, Vector &result, idx_t count) {
 	switch (type) {
 	case DatePartSpecifier::MILLENNIUM:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::MillenniumOperator>(left, result, count);
+		DateTruncBucketExecutor<TA, TR, DateTrunc::MillenniumOperator, 12000>::Execute(left, result, count);
 		break;
 	case DatePartSpecifier::CENTURY:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::CenturyOperator>(left, result, count);
+		DateTruncBucketExecutor<TA, TR, DateTrunc::CenturyOperator, 1200>::Execute(left, result, count);
 		break;
 	case DatePartSpecifier::DECADE:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::DecadeOperator>(left, result, count);
+		DateTruncBucketExecutor<TA, TR, DateTrunc::DecadeOperator, 120>::Execute(left, result, count);
 		break;
 	case DatePartSpecifier::YEAR:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::YearOperator>(left, result, count);
+		DateTruncBucketExecutor<TA, TR, DateTrunc::YearOperator, 12>::Execute(left, result, count);
 		break;
 	case DatePartSpecifier::QUARTER:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::QuarterOperator>(left, result, count);
+		DateTruncBucketExecutor<TA, TR, DateTrunc::QuarterOperator, 3>::Execute(left, result, count);
 		break;
 	case DatePartSpecifier::MONTH:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::MonthOperator>(left, result, count);
+		DateTruncBucketExecutor<TA, TR, DateTrunc::MonthOperator, 1>::Execute(left, result, count);
 		break;
 	case DatePartSpecifier::WEEK:
 	case DatePartSpecifier::YEARWEEK:
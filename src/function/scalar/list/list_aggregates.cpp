@@ -1,7 +1,9 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/aggregate/nested_functions.hpp"
+#include "duckdb/function/aggregate/sum_helpers.hpp"
 #include "duckdb/function/scalar/nested_functions.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
@@ -142,6 +144,198 @@ struct UniqueFunctor {
 	}
 };
 
+//===--------------------------------------------------------------------===//
+// Numeric fast paths
+//===--------------------------------------------------------------------===//
+// sum, min, max and count of numeric lists are computed one list at a time with the state on the stack, instead of
+// scattering the values into a state per list that has to be initialized, updated and finalized by the aggregate
+template <class T, class ADD_OPERATION>
+struct ListSumOperation {
+	using STATE = SumState<T>;
+
+	static void Initialize(STATE &state) {
+		state.isset = false;
+		state.value = 0;
+	}
+
+	template <class INPUT_TYPE>
+	static void Update(STATE &state, INPUT_TYPE input) {
+		state.isset = true;
+		ADD_OPERATION::template AddNumber<STATE, INPUT_TYPE>(state, input);
+	}
+
+	template <class RESULT_TYPE>
+	static bool Finalize(STATE &state, RESULT_TYPE &target) {
+		if (!state.isset) {
+			return false;
+		}
+		if (!Value::IsFinite(state.value)) {
+			throw OutOfRangeException("SUM is out of range!");
+		}
+		target = RESULT_TYPE(state.value);
+		return true;
+	}
+};
+
+template <class T, class COMPARISON_OPERATOR>
+struct ListMinMaxOperation {
+	struct STATE {
+		bool isset;
+		T value;
+	};
+
+	static void Initialize(STATE &state) {
+		state.isset = false;
+	}
+
+	static void Update(STATE &state, T input) {
+		if (!state.isset || COMPARISON_OPERATOR::Operation(input, state.value)) {
+			state.isset = true;
+			state.value = input;
+		}
+	}
+
+	static bool Finalize(STATE &state, T &target) {
+		target = state.value;
+		return state.isset;
+	}
+};
+
+template <class INPUT_TYPE, class RESULT_TYPE, class OP>
+static void ListAggregateNumeric(Vector &lists, idx_t count, Vector &result) {
+	auto &child_vector = ListVector::GetEntry(lists);
+	UnifiedVectorFormat child_data;
+	child_vector.ToUnifiedFormat(ListVector::GetListSize(lists), child_data);
+	auto child_values = (INPUT_TYPE *)child_data.data;
+
+	UnifiedVectorFormat lists_data;
+	lists.ToUnifiedFormat(count, lists_data);
+	auto list_entries = (list_entry_t *)lists_data.data;
+
+	auto result_data = FlatVector::GetData<RESULT_TYPE>(result);
+	auto &result_validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto lists_index = lists_data.sel->get_index(i);
+		if (!lists_data.validity.RowIsValid(lists_index)) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		const auto &list_entry = list_entries[lists_index];
+		typename OP::STATE state;
+		OP::Initialize(state);
+		for (idx_t child_idx = 0; child_idx < list_entry.length; child_idx++) {
+			auto source_idx = child_data.sel->get_index(list_entry.offset + child_idx);
+			if (child_data.validity.RowIsValid(source_idx)) {
+				OP::Update(state, child_values[source_idx]);
+			}
+		}
+		if (!OP::Finalize(state, result_data[i])) {
+			result_validity.SetInvalid(i);
+		}
+	}
+}
+
+static void ListCount(Vector &lists, idx_t count, Vector &result) {
+	auto &child_vector = ListVector::GetEntry(lists);
+	UnifiedVectorFormat child_data;
+	child_vector.ToUnifiedFormat(ListVector::GetListSize(lists), child_data);
+
+	UnifiedVectorFormat lists_data;
+	lists.ToUnifiedFormat(count, lists_data);
+	auto list_entries = (list_entry_t *)lists_data.data;
+
+	auto result_data = FlatVector::GetData<int64_t>(result);
+	auto &result_validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto lists_index = lists_data.sel->get_index(i);
+		if (!lists_data.validity.RowIsValid(lists_index)) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		const auto &list_entry = list_entries[lists_index];
+		int64_t value_count = list_entry.length;
+		if (!child_data.validity.AllValid()) {
+			value_count = 0;
+			for (idx_t child_idx = 0; child_idx < list_entry.length; child_idx++) {
+				auto source_idx = child_data.sel->get_index(list_entry.offset + child_idx);
+				value_count += child_data.validity.RowIsValid(source_idx);
+			}
+		}
+		result_data[i] = value_count;
+	}
+}
+
+template <class T>
+static bool TryListMinMax(const string &name, Vector &lists, idx_t count, Vector &result) {
+	if (name == "min") {
+		ListAggregateNumeric<T, T, ListMinMaxOperation<T, LessThan>>(lists, count, result);
+	} else {
+		ListAggregateNumeric<T, T, ListMinMaxOperation<T, GreaterThan>>(lists, count, result);
+	}
+	return true;
+}
+
+//! Computes the aggregate directly if it is sum, min, max or count over a numeric list, returns false otherwise
+static bool TryListAggregateNumeric(BoundAggregateExpression &aggr, Vector &lists, idx_t count, Vector &result) {
+	auto &function = aggr.function;
+	if (function.arguments.size() != 1) {
+		return false;
+	}
+	auto &input_type = function.arguments[0];
+	if (function.name == "count") {
+		ListCount(lists, count, result);
+		return true;
+	}
+	if (function.name == "sum") {
+		// the sum of decimals is bound with a different return type and is not handled here
+		switch (input_type.id()) {
+		case LogicalTypeId::SMALLINT:
+			ListAggregateNumeric<int16_t, hugeint_t, ListSumOperation<int64_t, RegularAdd>>(lists, count, result);
+			return true;
+		case LogicalTypeId::INTEGER:
+			ListAggregateNumeric<int32_t, hugeint_t, ListSumOperation<hugeint_t, HugeintAdd>>(lists, count, result);
+			return true;
+		case LogicalTypeId::BIGINT:
+			ListAggregateNumeric<int64_t, hugeint_t, ListSumOperation<hugeint_t, HugeintAdd>>(lists, count, result);
+			return true;
+		case LogicalTypeId::DOUBLE:
+			ListAggregateNumeric<double, double, ListSumOperation<double, RegularAdd>>(lists, count, result);
+			return true;
+		default:
+			return false;
+		}
+	}
+	if ((function.name != "min" && function.name != "max") || function.return_type != input_type) {
+		return false;
+	}
+	switch (input_type.InternalType()) {
+	case PhysicalType::INT8:
+		return TryListMinMax<int8_t>(function.name, lists, count, result);
+	case PhysicalType::INT16:
+		return TryListMinMax<int16_t>(function.name, lists, count, result);
+	case PhysicalType::INT32:
+		return TryListMinMax<int32_t>(function.name, lists, count, result);
+	case PhysicalType::INT64:
+		return TryListMinMax<int64_t>(function.name, lists, count, result);
+	case PhysicalType::INT128:
+		return TryListMinMax<hugeint_t>(function.name, lists, count, result);
+	case PhysicalType::UINT8:
+		return TryListMinMax<uint8_t>(function.name, lists, count, result);
+	case PhysicalType::UINT16:
+		return TryListMinMax<uint16_t>(function.name, lists, count, result);
+	case PhysicalType::UINT32:
+		return TryListMinMax<uint32_t>(function.name, lists, count, result);
+	case PhysicalType::UINT64:
+		return TryListMinMax<uint64_t>(function.name, lists, count, result);
+	case PhysicalType::FLOAT:
+		return TryListMinMax<float>(function.name, lists, count, result);
+	case PhysicalType::DOUBLE:
+		return TryListMinMax<double>(function.name, lists, count, result);
+	default:
+		return false;
+	}
+}
+
 template <class FUNCTION_FUNCTOR, bool IS_AGGR = false>
 static void ListAggregatesFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 
@@ -161,8 +355,15 @@ static void ListAggregatesFunction(DataChunk &args, ExpressionState &state, Vect
 	auto &func_expr = (BoundFunctionExpression &)state.expr;
 	auto &info = (ListAggregatesBindData &)*func_expr.bind_info;
 	auto &aggr = (BoundAggregateExpression &)*info.aggr_expr;
-	AggregateInputData aggr_input_data(aggr.bind_info.get(), Allocator::DefaultAllocator());
 
+	if (IS_AGGR && TryListAggregateNumeric(aggr, lists, count, result)) {
+		if (args.AllConstant()) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		}
+		return;
+	}
+
+	AggregateInputData aggr_input_data(aggr.bind_info.get(), Allocator::DefaultAllocator());
 	D_ASSERT(aggr.function.update);
 
 	auto lists_size = ListVector::GetListSize(lists);
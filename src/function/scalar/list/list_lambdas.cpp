@@ -43,6 +43,39 @@ bool ListLambdaBindData::Equals(const FunctionData &other_p) const {
 ListLambdaBindData::~ListLambdaBindData() {
 }
 
+struct ListLambdaLocalState : public FunctionLocalState {
+	ListLambdaLocalState(ClientContext &context, const Expression &lambda_expr, const vector<LogicalType> &types)
+	    : expr_executor(context, lambda_expr) {
+		input_chunk.InitializeEmpty(types);
+		lambda_chunk.Initialize(Allocator::DefaultAllocator(), {lambda_expr.return_type});
+	}
+
+	//! Executes the lambda expression, its expression state is reused for all chunks
+	ExpressionExecutor expr_executor;
+	//! References the list children and the captured columns that the lambda expression is executed on
+	DataChunk input_chunk;
+	//! Holds the result of the lambda expression
+	DataChunk lambda_chunk;
+};
+
+static unique_ptr<FunctionLocalState> ListLambdaInitLocalState(ExpressionState &state,
+                                                               const BoundFunctionExpression &expr,
+                                                               FunctionData *bind_data) {
+	auto &list_type = expr.children[0]->return_type;
+	if (list_type.id() == LogicalTypeId::SQLNULL) {
+		return nullptr;
+	}
+	auto &info = (ListLambdaBindData &)*bind_data;
+
+	// the list children, followed by the captured columns
+	vector<LogicalType> types;
+	types.push_back(ListType::GetChildType(list_type));
+	for (idx_t i = 1; i < expr.children.size(); i++) {
+		types.push_back(expr.children[i]->return_type);
+	}
+	return make_unique<ListLambdaLocalState>(state.GetContext(), *info.lambda_expr, types);
+}
+
 static void AppendTransformedToResult(Vector &lambda_vector, idx_t &elem_cnt, Vector &result) {
 
 	// append the lambda_vector to the result list
@@ -53,12 +86,15 @@ static void AppendTransformedToResult(Vector &lambda_vector, idx_t &elem_cnt, Ve
 
 static void AppendFilteredToResult(Vector &lambda_vector, list_entry_t *result_entries, idx_t &elem_cnt, Vector &result,
                                    idx_t &curr_list_len, idx_t &curr_list_offset, idx_t &appended_lists_cnt,
-                                   vector<idx_t> &lists_len, idx_t &curr_original_list_len, DataChunk &input_chunk) {
+                                   vector<idx_t> &lists_len, idx_t &curr_original_list_len, Vector &child_vector,
+                                   SelectionVector &sel) {
 
+	// true_sel points to the list children that are kept
 	idx_t true_count = 0;
 	SelectionVector true_sel(elem_cnt);
-	auto lambda_values = FlatVector::GetData<bool>(lambda_vector);
-	auto &lambda_validity = FlatVector::Validity(lambda_vector);
+	UnifiedVectorFormat lambda_data;
+	lambda_vector.ToUnifiedFormat(elem_cnt, lambda_data);
+	auto lambda_values = (bool *)lambda_data.data;
 
 	// compute the new lengths and offsets, and create a selection vector
 	for (idx_t i = 0; i < elem_cnt; i++) {
@@ -70,9 +106,10 @@ static void AppendFilteredToResult(Vector &lambda_vector, list_entry_t *result_e
 		}
 
 		// found a true value
-		if (lambda_validity.RowIsValid(i)) {
-			if (lambda_values[i] > 0) {
-				true_sel.set_index(true_count++, i);
+		auto lambda_idx = lambda_data.sel->get_index(i);
+		if (lambda_data.validity.RowIsValid(lambda_idx)) {
+			if (lambda_values[lambda_idx] > 0) {
+				true_sel.set_index(true_count++, sel.get_index(i));
 				curr_list_len++;
 			}
 		}
@@ -94,33 +131,37 @@ static void AppendFilteredToResult(Vector &lambda_vector, list_entry_t *result_e
 		appended_lists_cnt++;
 	}
 
-	// slice to get the new lists and append them to the result
-	Vector new_lists(input_chunk.data[0], true_sel, true_count);
-	new_lists.Flatten(true_count);
-	UnifiedVectorFormat new_lists_child_data;
-	new_lists.ToUnifiedFormat(true_count, new_lists_child_data);
-	ListVector::Append(result, new_lists, *new_lists_child_data.sel, true_count, 0);
+	// append the list children that are kept to the result directly
+	ListVector::Append(result, child_vector, true_sel, true_count, 0);
 }
 
-static void ExecuteExpression(vector<LogicalType> &types, vector<LogicalType> &result_types, idx_t &elem_cnt,
-                              SelectionVector &sel, vector<SelectionVector> &sel_vectors, DataChunk &input_chunk,
-                              DataChunk &lambda_chunk, Vector &child_vector, DataChunk &args,
+static void ExecuteExpression(idx_t &elem_cnt, SelectionVector &sel, vector<SelectionVector> &sel_vectors,
+                              DataChunk &input_chunk, DataChunk &lambda_chunk, Vector &child_vector, DataChunk &args,
                               ExpressionExecutor &expr_executor) {
 
 	input_chunk.SetCardinality(elem_cnt);
 	lambda_chunk.SetCardinality(elem_cnt);
 
-	// set the list child vector
-	Vector slice(child_vector, sel, elem_cnt);
-	slice.Flatten(elem_cnt);
-	input_chunk.data[0].Reference(slice);
+	// set the list child vector, the list children are referenced without copying them if they are stored
+	// one after another
+	bool contiguous = elem_cnt > 0;
+	for (idx_t i = 1; i < elem_cnt && contiguous; i++) {
+		contiguous = sel.get_index(i) == sel.get_index(0) + i;
+	}
+	if (contiguous) {
+		input_chunk.data[0].Slice(child_vector, sel.get_index(0), sel.get_index(0) + elem_cnt);
+	} else {
+		input_chunk.data[0].Slice(child_vector, sel, elem_cnt);
+	}
 
-	// set the other vectors
-	vector<Vector> slices;
+	// set the other vectors, constant columns are broadcast to all list children as they are
 	for (idx_t col_idx = 0; col_idx < args.ColumnCount() - 1; col_idx++) {
-		slices.emplace_back(Vector(args.data[col_idx + 1], sel_vectors[col_idx], elem_cnt));
-		slices[col_idx].Flatten(elem_cnt);
-		input_chunk.data[col_idx + 1].Reference(slices[col_idx]);
+		auto &column = args.data[col_idx + 1];
+		if (column.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+			input_chunk.data[col_idx + 1].Reference(column);
+		} else {
+			input_chunk.data[col_idx + 1].Slice(column, sel_vectors[col_idx], elem_cnt);
+		}
 	}
 
 	// execute the lambda expression
@@ -159,10 +200,11 @@ static void ListLambdaFunction(DataChunk &args, ExpressionState &state, Vector &
 	lists.ToUnifiedFormat(count, lists_data);
 	auto list_entries = (list_entry_t *)lists_data.data;
 
-	// get the lambda expression
-	auto &func_expr = (BoundFunctionExpression &)state.expr;
-	auto &info = (ListLambdaBindData &)*func_expr.bind_info;
-	auto &lambda_expr = info.lambda_expr;
+	// get the lambda expression state
+	auto &lstate = (ListLambdaLocalState &)*ExecuteFunctionState::GetFunctionState(state);
+	auto &expr_executor = lstate.expr_executor;
+	auto &input_chunk = lstate.input_chunk;
+	auto &lambda_chunk = lstate.lambda_chunk;
 
 	// get the child vector and child data
 	auto lists_size = ListVector::GetListSize(lists);
@@ -174,30 +216,19 @@ static void ListLambdaFunction(DataChunk &args, ExpressionState &state, Vector &
 	// to slice the child vector
 	SelectionVector sel(STANDARD_VECTOR_SIZE);
 
-	// this vector never contains more than one element
-	vector<LogicalType> result_types;
-	result_types.push_back(lambda_expr->return_type);
-
 	// non-lambda parameter columns
 	vector<UnifiedVectorFormat> columns;
 	vector<idx_t> indexes;
 	vector<SelectionVector> sel_vectors;
 
-	vector<LogicalType> types;
-	types.push_back(child_vector.GetType());
-
 	// skip the list column
 	for (idx_t i = 1; i < args.ColumnCount(); i++) {
 		columns.emplace_back(UnifiedVectorFormat());
 		args.data[i].ToUnifiedFormat(count, columns[i - 1]);
 		indexes.push_back(0);
 		sel_vectors.emplace_back(SelectionVector(STANDARD_VECTOR_SIZE));
-		types.push_back(args.data[i].GetType());
 	}
 
-	// get the expression executor
-	ExpressionExecutor expr_executor(state.GetContext(), *lambda_expr);
-
 	// these are only for the list_filter
 	vector<idx_t> lists_len;
 	idx_t curr_list_len = 0;
@@ -209,11 +240,6 @@ static void ListLambdaFunction(DataChunk &args, ExpressionState &state, Vector &
 		lists_len.reserve(count);
 	}
 
-	DataChunk input_chunk;
-	DataChunk lambda_chunk;
-	input_chunk.InitializeEmpty(types);
-	lambda_chunk.Initialize(Allocator::DefaultAllocator(), result_types);
-
 	// loop over the child entries and create chunks to be executed by the expression executor
 	idx_t elem_cnt = 0;
 	idx_t offset = 0;
@@ -255,8 +281,8 @@ static void ListLambdaFunction(DataChunk &args, ExpressionState &state, Vector &
 			// reached STANDARD_VECTOR_SIZE elements
 			if (elem_cnt == STANDARD_VECTOR_SIZE) {
 				lambda_chunk.Reset();
-				ExecuteExpression(types, result_types, elem_cnt, sel, sel_vectors, input_chunk, lambda_chunk,
-				                  child_vector, args, expr_executor);
+				ExecuteExpression(elem_cnt, sel, sel_vectors, input_chunk, lambda_chunk, child_vector, args,
+				                  expr_executor);
 
 				auto &lambda_vector = lambda_chunk.data[0];
 
@@ -265,7 +291,7 @@ static void ListLambdaFunction(DataChunk &args, ExpressionState &state, Vector &
 				} else {
 					AppendFilteredToResult(lambda_vector, result_entries, elem_cnt, result, curr_list_len,
 					                       curr_list_offset, appended_lists_cnt, lists_len, curr_original_list_len,
-					                       input_chunk);
+					                       child_vector, sel);
 				}
 				elem_cnt = 0;
 			}
@@ -283,15 +309,14 @@ static void ListLambdaFunction(DataChunk &args, ExpressionState &state, Vector &
 	}
 
 	lambda_chunk.Reset();
-	ExecuteExpression(types, result_types, elem_cnt, sel, sel_vectors, input_chunk, lambda_chunk, child_vector, args,
-	                  expr_executor);
+	ExecuteExpression(elem_cnt, sel, sel_vectors, input_chunk, lambda_chunk, child_vector, args, expr_executor);
 	auto &lambda_vector = lambda_chunk.data[0];
 
 	if (IS_TRANSFORM) {
 		AppendTransformedToResult(lambda_vector, elem_cnt, result);
 	} else {
 		AppendFilteredToResult(lambda_vector, result_entries, elem_cnt, result, curr_list_len, curr_list_offset,
-		                       appended_lists_cnt, lists_len, curr_original_list_len, input_chunk);
+		                       appended_lists_cnt, lists_len, curr_original_list_len, child_vector, sel);
 	}
 
 	if (args.AllConstant()) {
@@ -364,7 +389,8 @@ static unique_ptr<FunctionData> ListFilterBind(ClientContext &context, ScalarFun
 void ListTransformFun::RegisterFunction(BuiltinFunctions &set) {
 
 	ScalarFunction fun("list_transform", {LogicalType::LIST(LogicalType::ANY), LogicalType::LAMBDA},
-	                   LogicalType::LIST(LogicalType::ANY), ListTransformFunction, ListTransformBind, nullptr, nullptr);
+	                   LogicalType::LIST(LogicalType::ANY), ListTransformFunction, ListTransformBind, nullptr, nullptr,
+	                   ListLambdaInitLocalState);
 	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
 	fun.serialize = ListLambdaBindData::Serialize;
 	fun.deserialize = ListLambdaBindData::Deserialize;
@@ -381,7 +407,8 @@ void ListTransformFun::RegisterFunction(BuiltinFunctions &set) {
 void ListFilterFun::RegisterFunction(BuiltinFunctions &set) {
 
 	ScalarFunction fun("list_filter", {LogicalType::LIST(LogicalType::ANY), LogicalType::LAMBDA},
-	                   LogicalType::LIST(LogicalType::ANY), ListFilterFunction, ListFilterBind, nullptr, nullptr);
+	                   LogicalType::LIST(LogicalType::ANY), ListFilterFunction, ListFilterBind, nullptr, nullptr,
+	                   ListLambdaInitLocalState);
 	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
 	fun.serialize = ListLambdaBindData::Serialize;
 	fun.deserialize = ListLambdaBindData::Deserialize;
@@ -4,9 +4,12 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
 
 #include "duckdb/common/sort/sort.hpp"
 
+#include <algorithm>
+
 namespace duckdb {
 
 struct ListSortBindData : public FunctionData {
@@ -98,6 +101,101 @@ void SinkDataChunk(Vector *child_vector, SelectionVector &sel, idx_t offset_list
 	data_to_sort = true;
 }
 
+// sort the lists of fixed-size values in place, one list after the other, without building sort keys
+template <class T>
+static void SortFixedSizeLists(Vector &result, idx_t count, OrderType order_type, OrderByNullType null_order) {
+	auto lists_size = ListVector::GetListSize(result);
+	auto &child_vector = ListVector::GetEntry(result);
+	child_vector.Flatten(lists_size);
+	auto child_values = FlatVector::GetData<T>(child_vector);
+	auto &child_validity = FlatVector::Validity(child_vector);
+
+	UnifiedVectorFormat lists_data;
+	result.ToUnifiedFormat(count, lists_data);
+	auto list_entries = (list_entry_t *)lists_data.data;
+
+	for (idx_t i = 0; i < count; i++) {
+		auto lists_index = lists_data.sel->get_index(i);
+		if (!lists_data.validity.RowIsValid(lists_index)) {
+			continue;
+		}
+		const auto &list_entry = list_entries[lists_index];
+		auto values = child_values + list_entry.offset;
+
+		// move the values to the front of the list, the NULL values are put back in place after sorting
+		idx_t value_count = list_entry.length;
+		if (!child_validity.AllValid()) {
+			value_count = 0;
+			for (idx_t child_idx = 0; child_idx < list_entry.length; child_idx++) {
+				if (child_validity.RowIsValid(list_entry.offset + child_idx)) {
+					values[value_count++] = values[child_idx];
+				}
+			}
+		}
+
+		if (order_type == OrderType::ASCENDING) {
+			std::sort(values, values + value_count, LessThan::Operation<T>);
+		} else {
+			std::sort(values, values + value_count, GreaterThan::Operation<T>);
+		}
+
+		if (value_count == list_entry.length) {
+			continue;
+		}
+		idx_t null_start = value_count;
+		if (null_order == OrderByNullType::NULLS_FIRST) {
+			null_start = 0;
+			std::copy_backward(values, values + value_count, values + list_entry.length);
+		}
+		for (idx_t child_idx = 0; child_idx < list_entry.length; child_idx++) {
+			auto is_null = child_idx >= null_start && child_idx < null_start + list_entry.length - value_count;
+			child_validity.Set(list_entry.offset + child_idx, !is_null);
+		}
+	}
+}
+
+static bool TrySortFixedSizeLists(Vector &result, idx_t count, const ListSortBindData &info) {
+	switch (info.child_type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		SortFixedSizeLists<int8_t>(result, count, info.order_type, info.null_order);
+		return true;
+	case PhysicalType::INT16:
+		SortFixedSizeLists<int16_t>(result, count, info.order_type, info.null_order);
+		return true;
+	case PhysicalType::INT32:
+		SortFixedSizeLists<int32_t>(result, count, info.order_type, info.null_order);
+		return true;
+	case PhysicalType::INT64:
+		SortFixedSizeLists<int64_t>(result, count, info.order_type, info.null_order);
+		return true;
+	case PhysicalType::INT128:
+		SortFixedSizeLists<hugeint_t>(result, count, info.order_type, info.null_order);
+		return true;
+	case PhysicalType::UINT8:
+		SortFixedSizeLists<uint8_t>(result, count, info.order_type, info.null_order);
+		return true;
+	case PhysicalType::UINT16:
+		SortFixedSizeLists<uint16_t>(result, count, info.order_type, info.null_order);
+		return true;
+	case PhysicalType::UINT32:
+		SortFixedSizeLists<uint32_t>(result, count, info.order_type, info.null_order);
+		return true;
+	case PhysicalType::UINT64:
+		SortFixedSizeLists<uint64_t>(result, count, info.order_type, info.null_order);
+		return true;
+	case PhysicalType::FLOAT:
+		SortFixedSizeLists<float>(result, count, info.order_type, info.null_order);
+		return true;
+	case PhysicalType::DOUBLE:
+		SortFixedSizeLists<double>(result, count, info.order_type, info.null_order);
+		return true;
+	default:
+		// strings, intervals and nested types are sorted on their sort keys
+		return false;
+	}
+}
+
 static void ListSortFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	D_ASSERT(args.ColumnCount() >= 1 && args.ColumnCount() <= 3);
 	auto count = args.size();
@@ -114,6 +212,16 @@ static void ListSortFunction(DataChunk &args, ExpressionState &state, Vector &re
 	auto &func_expr = (BoundFunctionExpression &)state.expr;
 	auto &info = (ListSortBindData &)*func_expr.bind_info;
 
+	// this ensures that we do not change the order of the entries in the input chunk
+	VectorOperations::Copy(input_lists, result, count, 0, 0);
+
+	if (TrySortFixedSizeLists(result, count, info)) {
+		if (args.AllConstant()) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		}
+		return;
+	}
+
 	// initialize the global and local sorting state
 	auto &buffer_manager = BufferManager::GetBufferManager(info.context);
 	info.global_sort_state = make_unique<GlobalSortState>(buffer_manager, info.orders, info.payload_layout);
@@ -121,9 +229,6 @@ static void ListSortFunction(DataChunk &args, ExpressionState &state, Vector &re
 	LocalSortState local_sort_state;
 	local_sort_state.Initialize(global_sort_state, buffer_manager);
 
-	// this ensures that we do not change the order of the entries in the input chunk
-	VectorOperations::Copy(input_lists, result, count, 0, 0);
-
 	// get the child vector
 	auto lists_size = ListVector::GetListSize(result);
 	auto &child_vector = ListVector::GetEntry(result);
@@ -9,6 +9,7 @@
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/multiply.hpp"
 
 namespace duckdb {
 
@@ -39,11 +40,18 @@ struct CurrentSequenceValueOperator {
 		result = seq->last_value;
 		return result;
 	}
+
+	static void Operation(Transaction &transaction, SequenceCatalogEntry *seq, int64_t *result, idx_t count) {
+		auto value = Operation(transaction, seq);
+		for (idx_t i = 0; i < count; i++) {
+			result[i] = value;
+		}
+	}
 };
 
 struct NextSequenceValueOperator {
-	static int64_t Operation(Transaction &transaction, SequenceCatalogEntry *seq) {
-		lock_guard<mutex> seqlock(seq->lock);
+	//! Advances the sequence and returns its next value, the lock of the sequence must be held
+	static int64_t NextValue(SequenceCatalogEntry *seq) {
 		int64_t result;
 		result = seq->counter;
 		bool overflow = !TryAddOperator::Operation(seq->counter, seq->increment, seq->counter);
@@ -65,13 +73,65 @@ struct NextSequenceValueOperator {
 				                        seq->max_value);
 			}
 		}
-		seq->last_value = result;
-		seq->usage_count++;
+		return result;
+	}
+
+	//! Records that count values of the sequence were used, the lock of the sequence must be held
+	static void UpdateUsage(Transaction &transaction, SequenceCatalogEntry *seq, int64_t last_value, idx_t count) {
+		seq->last_value = last_value;
+		seq->usage_count += count;
 		if (!seq->temporary) {
 			transaction.sequence_usage[seq] = SequenceValue(seq->usage_count, seq->counter);
 		}
+	}
+
+	static int64_t Operation(Transaction &transaction, SequenceCatalogEntry *seq) {
+		lock_guard<mutex> seqlock(seq->lock);
+		auto result = NextValue(seq);
+		UpdateUsage(transaction, seq, result, 1);
 		return result;
 	}
+
+	//! Fills the result with the next count values of the sequence. If the values do not cross the bounds of the
+	//! sequence, the entire range is claimed at once: the lock is held for a constant amount of time, instead of once
+	//! for every value, so parallel inserts do not serialize on the sequence.
+	static void Operation(Transaction &transaction, SequenceCatalogEntry *seq, int64_t *result, idx_t count) {
+		if (count == 0) {
+			return;
+		}
+		int64_t start;
+		int64_t increment;
+		{
+			lock_guard<mutex> seqlock(seq->lock);
+			start = seq->counter;
+			increment = seq->increment;
+			int64_t range;
+			int64_t end;
+			bool claimed_range = false;
+			if (!seq->cycle && start >= seq->min_value && start <= seq->max_value &&
+			    TryMultiplyOperator::Operation(int64_t(count), increment, range) &&
+			    TryAddOperator::Operation(start, range, end)) {
+				// the values lie between start and end: they are all valid if the last value is
+				auto last_value = end - increment;
+				if (last_value >= seq->min_value && last_value <= seq->max_value) {
+					seq->counter = end;
+					UpdateUsage(transaction, seq, last_value, count);
+					claimed_range = true;
+				}
+			}
+			if (!claimed_range) {
+				// the sequence cycles or runs out of values within the range: advance it one value at a time
+				for (idx_t i = 0; i < count; i++) {
+					result[i] = NextValue(seq);
+					UpdateUsage(transaction, seq, result[i], 1);
+				}
+				return;
+			}
+		}
+		for (idx_t i = 0; i < count; i++) {
+			result[i] = start + int64_t(i) * increment;
+		}
+	}
 };
 
 struct NextValData {
@@ -96,10 +156,7 @@ static void NextValFunction(DataChunk &args, ExpressionState &state, Vector &res
 		// increment the sequence
 		result.SetVectorType(VectorType::FLAT_VECTOR);
 		auto result_data = FlatVector::GetData<int64_t>(result);
-		for (idx_t i = 0; i < args.size(); i++) {
-			// get the next value from the sequence
-			result_data[i] = OP::Operation(transaction, info.sequence);
-		}
+		OP::Operation(transaction, info.sequence, result_data, args.size());
 	} else {
 		NextValData next_val_input(info, transaction);
 		// sequence to use comes from the input
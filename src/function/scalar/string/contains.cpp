@@ -1,11 +1,15 @@
 #include "duckdb/function/scalar/string_functions.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/radix.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
 namespace duckdb {
 
+//! The haystack size from which on the needle is searched blockwise
+static constexpr idx_t CONTAINS_BLOCKWISE_THRESHOLD = 32;
+
 template <class UNSIGNED, int NEEDLE_SIZE>
 static idx_t ContainsUnaligned(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
                                idx_t base_offset) {
@@ -98,6 +102,64 @@ idx_t ContainsGeneric(const unsigned char *haystack, idx_t haystack_size, const
 	}
 }
 
+static inline bool MatchesAt(const unsigned char *haystack, const unsigned char *needle, idx_t needle_size) {
+	return haystack[0] == needle[0] && haystack[needle_size - 1] == needle[needle_size - 1] &&
+	       memcmp(haystack + 1, needle + 1, needle_size - 2) == 0;
+}
+
+//! Returns the position of the first candidate byte in a word, in which only the high bits of candidates are set
+static inline idx_t FirstCandidate(uint64_t candidates) {
+#if defined(__GNUC__) || defined(__clang__)
+	if (Radix::IsLittleEndian()) {
+		return __builtin_ctzll(candidates) / 8;
+	}
+#endif
+	auto bytes = (const uint8_t *)&candidates;
+	idx_t position = 0;
+	while (bytes[position] == 0) {
+		position++;
+	}
+	return position;
+}
+
+static idx_t ContainsBlockwise(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
+                               idx_t needle_size, idx_t base_offset) {
+	D_ASSERT(needle_size >= 2);
+	// contains for long haystacks; this implementation is inspired by Wojciech Mula's SIMD-friendly strstr
+	// a position can only match if both the first and the last character of the needle match at that position
+	// we check this for 8 positions at a time by comparing entire words of the haystack (SIMD within a register)
+	// only the positions where both characters match are compared with the entire needle
+	const uint64_t low_bits = 0x7F7F7F7F7F7F7F7FULL;
+	const uint64_t first = 0x0101010101010101ULL * needle[0];
+	const uint64_t last = 0x0101010101010101ULL * needle[needle_size - 1];
+	idx_t offset = 0;
+	for (; offset + needle_size - 1 + sizeof(uint64_t) <= haystack_size; offset += sizeof(uint64_t)) {
+		// a byte in diff is zero if both the first and the last character match at the corresponding position
+		auto diff = (Load<uint64_t>(haystack + offset) ^ first) |
+		            (Load<uint64_t>(haystack + offset + needle_size - 1) ^ last);
+		// the high bit of every zero byte of diff is set in candidates, and all other bits are zero
+		auto candidates = ~(((diff & low_bits) + low_bits) | diff | low_bits);
+		if (candidates == 0) {
+			continue;
+		}
+		// verify the candidates in order of their position
+		do {
+			auto i = FirstCandidate(candidates);
+			if (memcmp(haystack + offset + i + 1, needle + 1, needle_size - 2) == 0) {
+				return base_offset + offset + i;
+			}
+			((uint8_t *)&candidates)[i] = 0;
+		} while (candidates != 0);
+	}
+	// check the final positions that do not fill up a word
+	for (; offset + needle_size <= haystack_size; offset++) {
+		if (MatchesAt(haystack + offset, needle, needle_size)) {
+			return base_offset + offset;
+		}
+	}
+	return DConstants::INVALID_INDEX;
+}
+
 idx_t ContainsFun::Find(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
                         idx_t needle_size) {
 	D_ASSERT(needle_size > 0);
@@ -109,6 +171,10 @@ idx_t ContainsFun::Find(const unsigned char *haystack, idx_t haystack_size, cons
 	idx_t base_offset = (const unsigned char *)location - haystack;
 	haystack_size -= base_offset;
 	haystack = (const unsigned char *)location;
+	if (needle_size > 1 && haystack_size >= CONTAINS_BLOCKWISE_THRESHOLD) {
+		// long haystack: search for the needle 8 positions at a time
+		return ContainsBlockwise(haystack, haystack_size, needle, needle_size, base_offset);
+	}
 	// switch algorithm depending on needle size
 	switch (needle_size) {
 	case 1:
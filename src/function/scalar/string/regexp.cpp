@@ -8,6 +8,8 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "re2/regexp.h"
+#include "utf8proc.hpp"
 #include "utf8proc_wrapper.hpp"
 
 namespace duckdb {
@@ -36,6 +38,100 @@ static inline duckdb_re2::StringPiece CreateStringPiece(string_t &input) {
 	return duckdb_re2::StringPiece(input.GetDataUnsafe(), input.GetSize());
 }
 
+//! Collects the literals that every match of the regex contains
+static void ExtractRequiredLiterals(duckdb_re2::Regexp *re, bool latin1, vector<string> &result) {
+	switch (re->op()) {
+	case duckdb_re2::kRegexpLiteral:
+	case duckdb_re2::kRegexpLiteralString: {
+		if (re->parse_flags() & duckdb_re2::Regexp::FoldCase) {
+			// case-insensitive literal
+			return;
+		}
+		auto rune = re->op() == duckdb_re2::kRegexpLiteral ? re->rune() : 0;
+		auto runes = re->op() == duckdb_re2::kRegexpLiteral ? &rune : re->runes();
+		auto rune_count = re->op() == duckdb_re2::kRegexpLiteral ? 1 : re->nrunes();
+		string literal;
+		for (idx_t i = 0; i < idx_t(rune_count); i++) {
+			if (latin1) {
+				literal += char(runes[i]);
+				continue;
+			}
+			char buffer[4];
+			int size;
+			if (!utf8proc_codepoint_to_utf8(runes[i], size, buffer)) {
+				return;
+			}
+			literal += string(buffer, size);
+		}
+		result.push_back(move(literal));
+		break;
+	}
+	case duckdb_re2::kRegexpConcat: {
+		// adjacent literals of a concatenation are required as a whole
+		string literal;
+		for (idx_t i = 0; i < idx_t(re->nsub()); i++) {
+			vector<string> child_literals;
+			ExtractRequiredLiterals(re->sub()[i], latin1, child_literals);
+			auto child_op = re->sub()[i]->op();
+			if ((child_op == duckdb_re2::kRegexpLiteral || child_op == duckdb_re2::kRegexpLiteralString) &&
+			    !child_literals.empty()) {
+				literal += child_literals[0];
+				continue;
+			}
+			if (!literal.empty()) {
+				result.push_back(move(literal));
+				literal = string();
+			}
+			for (auto &child_literal : child_literals) {
+				result.push_back(move(child_literal));
+			}
+		}
+		if (!literal.empty()) {
+			result.push_back(move(literal));
+		}
+		break;
+	}
+	case duckdb_re2::kRegexpCapture:
+	case duckdb_re2::kRegexpPlus:
+		ExtractRequiredLiterals(re->sub()[0], latin1, result);
+		break;
+	case duckdb_re2::kRegexpRepeat:
+		if (re->min() > 0) {
+			ExtractRequiredLiterals(re->sub()[0], latin1, result);
+		}
+		break;
+	default:
+		// alternations and optional parts do not require any literal
+		break;
+	}
+}
+
+RegexLocalState::RegexLocalState(RegexpBaseBindData &info)
+    : constant_pattern(duckdb_re2::StringPiece(info.constant_string.c_str(), info.constant_string.size()),
+                       info.options) {
+	D_ASSERT(info.constant_pattern);
+	if (!constant_pattern.ok()) {
+		return;
+	}
+	vector<string> literals;
+	ExtractRequiredLiterals(constant_pattern.Regexp(),
+	                        info.options.encoding() == duckdb_re2::RE2::Options::EncodingLatin1, literals);
+	for (auto &literal : literals) {
+		if (literal.size() > required_literal.size()) {
+			required_literal = move(literal);
+		}
+	}
+}
+
+bool RegexLocalState::MayMatch(const string_t &input) const {
+	if (required_literal.empty()) {
+		return true;
+	}
+	return ContainsFun::Find((const unsigned char *)input.GetDataUnsafe(), input.GetSize(),
+	                         (const unsigned char *)required_literal.c_str(),
+	                         required_literal.size()) != DConstants::INVALID_INDEX;
+}
+
 unique_ptr<FunctionLocalState> RegexInitLocalState(ExpressionState &state, const BoundFunctionExpression &expr,
                                                    FunctionData *bind_data) {
 	auto &info = (RegexpBaseBindData &)*bind_data;
@@ -183,7 +279,7 @@ static void RegexpMatchesFunction(DataChunk &args, ExpressionState &state, Vecto
 	if (info.constant_pattern) {
 		auto &lstate = (RegexLocalState &)*ExecuteFunctionState::GetFunctionState(state);
 		UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
-			return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
+			return lstate.MayMatch(input) && OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
 		});
 	} else {
 		BinaryExecutor::Execute<string_t, string_t, bool>(strings, patterns, result, args.size(),
@@ -336,6 +432,9 @@ static void RegexExtractFunction(DataChunk &args, ExpressionState &state, Vector
 	if (info.constant_pattern) {
 		auto &lstate = (RegexLocalState &)*ExecuteFunctionState::GetFunctionState(state);
 		UnaryExecutor::Execute<string_t, string_t>(strings, result, args.size(), [&](string_t input) {
+			if (!lstate.MayMatch(input)) {
+				return string_t("", 0);
+			}
 			return Extract(input, result, lstate.constant_pattern, info.rewrite);
 		});
 	} else {
@@ -41,6 +41,7 @@ void BuiltinFunctions::RegisterStringFunctions() {
 	// blob functions
 	Register<Base64Fun>();
 	Register<EncodeFun>();
+	Register<HLLEstimateFun>();
 
 	// uuid functions
 	Register<UUIDFun>();
@@ -225,7 +225,8 @@ unique_ptr<FunctionData> ArrowTableFunction::ArrowScanBind(ClientContext &contex
 }
 
 unique_ptr<ArrowArrayStreamWrapper> ProduceArrowScan(const ArrowScanFunctionData &function,
-                                                     const vector<column_t> &column_ids, TableFilterSet *filters) {
+                                                     const vector<column_t> &column_ids, TableFilterSet *filters,
+                                                     vector<unique_ptr<ArrowArrayStreamWrapper>> &partitions) {
 	//! Generate Projection Pushdown Vector
 	ArrowStreamParameters parameters;
 	D_ASSERT(!column_ids.empty());
@@ -238,31 +239,89 @@ unique_ptr<ArrowArrayStreamWrapper> ProduceArrowScan(const ArrowScanFunctionData
 		}
 	}
 	parameters.filters = filters;
-	return function.scanner_producer(function.stream_factory_ptr, parameters);
+	auto stream = function.scanner_producer(function.stream_factory_ptr, parameters);
+	partitions = move(parameters.partitions);
+	if (!stream && partitions.empty()) {
+		throw InvalidInputException("arrow_scan: the producer did not return a stream");
+	}
+	return stream;
 }
 
 idx_t ArrowTableFunction::ArrowScanMaxThreads(ClientContext &context, const FunctionData *bind_data_p) {
 	return context.db->NumberOfThreads();
 }
 
+static shared_ptr<ArrowArrayWrapper> GetNextNonEmptyChunk(ArrowArrayStreamWrapper &stream) {
+	auto current_chunk = stream.GetNextChunk();
+	while (current_chunk->arrow_array.length == 0 && current_chunk->arrow_array.release) {
+		current_chunk = stream.GetNextChunk();
+	}
+	return current_chunk;
+}
+
+static void SetScanChunk(ArrowScanLocalState &state, shared_ptr<ArrowArrayWrapper> chunk, idx_t start, idx_t end,
+                         idx_t batch_index) {
+	if (state.chunk != chunk) {
+		// dictionaries belong to the chunk they were read from
+		state.arrow_dictionary_vectors.clear();
+		state.chunk = move(chunk);
+	}
+	state.chunk_offset = start;
+	state.chunk_end = end;
+	state.batch_index = batch_index;
+}
+
+static bool ArrowScanNextPartitionChunk(ArrowScanLocalState &state, ArrowScanGlobalState &parallel_state) {
+	while (true) {
+		if (state.stream) {
+			// the partition of this thread is read without holding the lock
+			auto current_chunk = GetNextNonEmptyChunk(*state.stream);
+			if (current_chunk->arrow_array.release) {
+				// the batch index orders the batches by partition first
+				auto length = (idx_t)current_chunk->arrow_array.length;
+				auto batch_index = (state.partition_index << 32) + ++state.partition_batch_index;
+				SetScanChunk(state, move(current_chunk), 0, length, batch_index);
+				return true;
+			}
+			state.stream.reset();
+		}
+		lock_guard<mutex> parallel_lock(parallel_state.main_mutex);
+		if (parallel_state.next_partition >= parallel_state.partitions.size()) {
+			return false;
+		}
+		state.partition_index = parallel_state.next_partition++;
+		state.partition_batch_index = 0;
+		state.stream = move(parallel_state.partitions[state.partition_index]);
+	}
+}
+
 bool ArrowTableFunction::ArrowScanParallelStateNext(ClientContext &context, const FunctionData *bind_data_p,
                                                     ArrowScanLocalState &state, ArrowScanGlobalState &parallel_state) {
-	lock_guard<mutex> parallel_lock(parallel_state.main_mutex);
-	if (parallel_state.done) {
-		return false;
+	if (!parallel_state.partitions.empty()) {
+		return ArrowScanNextPartitionChunk(state, parallel_state);
 	}
-	state.chunk_offset = 0;
-	state.batch_index = ++parallel_state.batch_index;
-
-	auto current_chunk = parallel_state.stream->GetNextChunk();
-	while (current_chunk->arrow_array.length == 0 && current_chunk->arrow_array.release) {
-		current_chunk = parallel_state.stream->GetNextChunk();
+	lock_guard<mutex> parallel_lock(parallel_state.main_mutex);
+	if (!parallel_state.chunk) {
+		if (parallel_state.done) {
+			return false;
+		}
+		auto current_chunk = GetNextNonEmptyChunk(*parallel_state.stream);
+		//! have we run out of chunks? we are done
+		if (!current_chunk->arrow_array.release) {
+			parallel_state.done = true;
+			return false;
+		}
+		parallel_state.chunk = move(current_chunk);
+		parallel_state.chunk_offset = 0;
 	}
-	state.chunk = move(current_chunk);
-	//! have we run out of chunks? we are done
-	if (!state.chunk->arrow_array.release) {
-		parallel_state.done = true;
-		return false;
+	// hand out the next slice of the current chunk, so other threads can convert the rest of it concurrently
+	auto length = (idx_t)parallel_state.chunk->arrow_array.length;
+	auto start = parallel_state.chunk_offset;
+	auto end = MinValue<idx_t>(length, start + ArrowScanGlobalState::SLICE_SIZE);
+	SetScanChunk(state, parallel_state.chunk, start, end, ++parallel_state.batch_index);
+	parallel_state.chunk_offset = end;
+	if (end == length) {
+		parallel_state.chunk.reset();
 	}
 	return true;
 }
@@ -271,8 +330,11 @@ unique_ptr<GlobalTableFunctionState> ArrowTableFunction::ArrowScanInitGlobal(Cli
                                                                              TableFunctionInitInput &input) {
 	auto &bind_data = (const ArrowScanFunctionData &)*input.bind_data;
 	auto result = make_unique<ArrowScanGlobalState>();
-	result->stream = ProduceArrowScan(bind_data, input.column_ids, input.filters);
+	result->stream = ProduceArrowScan(bind_data, input.column_ids, input.filters, result->partitions);
 	result->max_threads = ArrowScanMaxThreads(context, input.bind_data);
+	if (!result->partitions.empty()) {
+		result->max_threads = MinValue<idx_t>(result->max_threads, result->partitions.size());
+	}
 	if (input.CanRemoveFilterColumns()) {
 		result->projection_ids = input.projection_ids;
 		for (const auto &col_idx : input.column_ids) {
@@ -312,13 +374,13 @@ void ArrowTableFunction::ArrowScanFunction(ClientContext &context, TableFunction
 	auto &state = (ArrowScanLocalState &)*data_p.local_state;
 	auto &global_state = (ArrowScanGlobalState &)*data_p.global_state;
 
-	//! Out of tuples in this chunk
-	if (state.chunk_offset >= (idx_t)state.chunk->arrow_array.length) {
+	//! Out of tuples in this slice
+	if (state.chunk_offset >= state.chunk_end) {
 		if (!ArrowScanParallelStateNext(context, data_p.bind_data, state, global_state)) {
 			return;
 		}
 	}
-	int64_t output_size = MinValue<int64_t>(STANDARD_VECTOR_SIZE, state.chunk->arrow_array.length - state.chunk_offset);
+	int64_t output_size = MinValue<idx_t>(STANDARD_VECTOR_SIZE, state.chunk_end - state.chunk_offset);
 	data.lines_read += output_size;
 	if (global_state.CanRemoveFilterColumns()) {
 		state.all_columns.Reset();
@@ -4,10 +4,12 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
+#include "duckdb/common/preserved_error.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "duckdb/parallel/task_counter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 
 #include <limits>
@@ -41,8 +43,73 @@ void ReadCSVData::FinalizeRead(ClientContext &context) {
 		// not supported for parallel CSV reading
 		single_threaded = true;
 	}
+	if (options.union_by_name || options.include_file_name || options.include_parsed_hive_partitions) {
+		// the parallel CSV reader does not produce these columns
+		single_threaded = true;
+	}
+	if (initial_reader && files.size() == 1 && initial_reader->end_of_file_reached &&
+	    !initial_reader->cached_chunks.empty()) {
+		// sniffing already parsed the entire file: emit the cached chunks instead of parsing the file again
+		single_threaded = true;
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+	for (idx_t i = 0; i < files.size() && !single_threaded; i++) {
+		// pipes can only be read from start to end, and might return fewer bytes than requested before they end
+		bool is_local_file = files[i].find("://") == string::npos;
+		if (is_local_file && fs.IsPipe(files[i])) {
+			single_threaded = true;
+		}
+	}
 }
 
+struct CSVSniffState {
+	explicit CSVSniffState(TaskScheduler &scheduler) : counter(scheduler) {
+	}
+
+	vector<unique_ptr<BufferedCSVReader>> readers;
+	TaskCounter counter;
+
+	mutex error_lock;
+	PreservedError error;
+
+public:
+	void PushError(PreservedError new_error) {
+		lock_guard<mutex> guard(error_lock);
+		if (!error) {
+			error = move(new_error);
+		}
+	}
+};
+
+//! Opens (and sniffs) the reader of a single file of a union_by_name read
+class CSVSniffTask : public Task {
+public:
+	CSVSniffTask(CSVSniffState &sniff_state, ClientContext &context, BufferedCSVReaderOptions options_p,
+	             idx_t file_idx)
+	    : sniff_state(sniff_state), context(context), options(move(options_p)), file_idx(file_idx) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			sniff_state.readers[file_idx] = make_unique<BufferedCSVReader>(context, move(options));
+		} catch (Exception &ex) {
+			sniff_state.PushError(PreservedError(ex));
+		} catch (std::exception &ex) {
+			sniff_state.PushError(PreservedError(ex));
+		} catch (...) { // LCOV_EXCL_START
+			sniff_state.PushError(PreservedError("Unknown exception while sniffing CSV file!"));
+		} // LCOV_EXCL_STOP
+		sniff_state.counter.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	CSVSniffState &sniff_state;
+	ClientContext &context;
+	BufferedCSVReaderOptions options;
+	idx_t file_idx;
+};
+
 static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, TableFunctionBindInput &input,
                                             vector<LogicalType> &return_types, vector<string> &names) {
 	auto &config = DBConfig::GetConfig(context);
@@ -127,9 +194,25 @@ static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, TableFunctio
 		vector<string> union_col_names;
 		vector<LogicalType> union_col_types;
 
+		// the files are sniffed in parallel, the reader of the first file was already sniffed above
+		CSVSniffState sniff_state(TaskScheduler::GetScheduler(context));
+		sniff_state.readers.resize(result->files.size());
+		for (idx_t file_idx = 0; file_idx < result->files.size(); ++file_idx) {
+			if (file_idx == 0 && result->initial_reader) {
+				sniff_state.readers[file_idx] = move(result->initial_reader);
+				continue;
+			}
+			auto file_options = options;
+			file_options.file_path = result->files[file_idx];
+			sniff_state.counter.AddTask(make_unique<CSVSniffTask>(sniff_state, context, move(file_options), file_idx));
+		}
+		sniff_state.counter.Finish();
+		if (sniff_state.error) {
+			sniff_state.error.Throw();
+		}
+
 		for (idx_t file_idx = 0; file_idx < result->files.size(); ++file_idx) {
-			options.file_path = result->files[file_idx];
-			auto reader = make_unique<BufferedCSVReader>(context, options);
+			auto reader = move(sniff_state.readers[file_idx]);
 			auto &col_names = reader->col_names;
 			auto &sql_types = reader->sql_types;
 			D_ASSERT(col_names.size() == sql_types.size());
@@ -205,19 +288,14 @@ static unique_ptr<FunctionData> ReadCSVAutoBind(ClientContext &context, TableFun
 //===--------------------------------------------------------------------===//
 // Parallel CSV Reader CSV Global State
 //===--------------------------------------------------------------------===//
-//===--------------------------------------------------------------------===//
-// Read CSV Global State
-//===--------------------------------------------------------------------===//
 struct ParallelCSVGlobalState : public GlobalTableFunctionState {
 public:
 	ParallelCSVGlobalState(ClientContext &context, unique_ptr<CSVFileHandle> file_handle_p,
 	                       vector<string> &files_path_p, idx_t system_threads_p, idx_t buffer_size_p,
-	                       idx_t rows_to_skip)
-	    : file_handle(move(file_handle_p)), system_threads(system_threads_p), buffer_size(buffer_size_p) {
-		for (idx_t i = 0; i < rows_to_skip; i++) {
-			file_handle->ReadLine();
-		}
-		estimated_linenr = rows_to_skip;
+	                       idx_t rows_to_skip_p, const BufferedCSVReaderOptions &options)
+	    : file_handle(move(file_handle_p)), row_scanner(make_unique<CSVRowScanner>(options)),
+	      rows_to_skip(rows_to_skip_p), system_threads(system_threads_p), buffer_size(buffer_size_p) {
+		StartFile(context);
 		file_size = file_handle->FileSize();
 		first_file_size = file_size;
 		bytes_read = 0;
@@ -226,8 +304,7 @@ public:
 		} else {
 			bytes_per_local_state = file_size / MaxThreads();
 		}
-		current_buffer = make_shared<CSVBuffer>(context, buffer_size, *file_handle);
-		next_buffer = current_buffer->Next(*file_handle, buffer_size);
+		bytes_per_local_state = MaxValue<idx_t>(bytes_per_local_state, 1);
 	}
 	ParallelCSVGlobalState() {
 	}
@@ -243,6 +320,11 @@ public:
 	idx_t file_size;
 
 private:
+	//! Skips the rows before the first row of the current file, and reads its first buffers
+	void StartFile(ClientContext &context);
+	//! Moves on to the next buffer (of the next file, if the current file is finished)
+	void NextBuffer(ClientContext &context, ReadCSVData &bind_data);
+
 	//! File Handle for current file
 	unique_ptr<CSVFileHandle> file_handle;
 
@@ -253,11 +335,15 @@ private:
 
 	//! Mutex to lock when getting next batch of bytes (Parallel Only)
 	mutex main_mutex;
-	//! Byte set from for last thread
+	//! Byte set from for last thread, this is always the start of a row
 	idx_t next_byte = 0;
 
-	//! The current estimated line number
-	idx_t estimated_linenr;
+	//! The line number of the row that starts at next_byte
+	idx_t linenr = 0;
+	//! Finds the row boundaries at which the buffers are split
+	unique_ptr<CSVRowScanner> row_scanner;
+	//! The amount of lines that are skipped at the start of every file (skipped rows and header)
+	idx_t rows_to_skip = 0;
 
 	//! How many bytes we should execute per local state
 	idx_t bytes_per_local_state;
@@ -270,6 +356,10 @@ private:
 	idx_t buffer_size;
 	//! Current batch index
 	idx_t batch_index = 0;
+
+public:
+	//! The columns that are used by the query
+	vector<column_t> column_ids;
 };
 
 idx_t ParallelCSVGlobalState::MaxThreads() const {
@@ -286,38 +376,70 @@ bool ParallelCSVGlobalState::Finished() {
 	return !current_buffer;
 }
 
+void ParallelCSVGlobalState::StartFile(ClientContext &context) {
+	// blocks of compressed files can be decompressed in parallel, as long as they fit in a buffer
+	file_handle->EnableParallelDecompression(TaskScheduler::GetScheduler(context), buffer_size);
+	// the file is only read once, from start to end: there is no need to cache what was read to reset it
+	file_handle->DisableReset();
+	for (idx_t i = 0; i < rows_to_skip; i++) {
+		file_handle->ReadLine();
+	}
+	current_buffer = make_shared<CSVBuffer>(context, buffer_size, *file_handle);
+	next_buffer = current_buffer->Next(*file_handle, buffer_size);
+	next_byte = current_buffer->GetStart();
+	linenr = rows_to_skip;
+}
+
+void ParallelCSVGlobalState::NextBuffer(ClientContext &context, ReadCSVData &bind_data) {
+	bytes_read += current_buffer->GetBufferSize();
+	current_buffer = next_buffer;
+	if (current_buffer) {
+		// Next buffer gets the next-next buffer
+		next_buffer = current_buffer->Next(*file_handle, buffer_size);
+	} else if (file_index < bind_data.files.size()) {
+		// This means we are done with the current file, we need to go to the next one (if exists).
+		bind_data.options.file_path = bind_data.files[file_index++];
+		file_handle = ReadCSV::OpenCSV(bind_data.options, context);
+		StartFile(context);
+	}
+}
+
 unique_ptr<CSVBufferRead> ParallelCSVGlobalState::Next(ClientContext &context, ReadCSVData &bind_data) {
 	lock_guard<mutex> parallel_lock(main_mutex);
+	// skip the buffers that have been read completely (or that are empty)
+	while (current_buffer && next_byte >= current_buffer->GetBufferSize()) {
+		next_byte -= current_buffer->GetBufferSize();
+		NextBuffer(context, bind_data);
+	}
 	if (!current_buffer) {
 		// We are done scanning.
 		return nullptr;
 	}
-	// set up the current buffer
-	auto result = make_unique<CSVBufferRead>(current_buffer, next_buffer, next_byte, next_byte + bytes_per_local_state,
-	                                         batch_index++, estimated_linenr);
-	// move the byte index of the CSV reader to the next buffer
-	next_byte += bytes_per_local_state;
-	estimated_linenr += bytes_per_local_state / (bind_data.sql_types.size() * 5); // estimate 5 bytes per column
-	if (next_byte >= current_buffer->GetBufferSize()) {
-		// We replace the current buffer with the next buffer
-		next_byte = 0;
-		bytes_read += current_buffer->GetBufferSize();
-		current_buffer = next_buffer;
-		if (next_buffer) {
-			// Next buffer gets the next-next buffer
-			next_buffer = next_buffer->Next(*file_handle, buffer_size);
-		}
-	}
-	if (current_buffer && !next_buffer) {
-		// This means we are done with the current file, we need to go to the next one (if exists).
-		if (file_index < bind_data.files.size()) {
-			bind_data.options.file_path = bind_data.files[file_index++];
-			file_handle = ReadCSV::OpenCSV(bind_data.options, context);
-			next_buffer = make_shared<CSVBuffer>(context, buffer_size, *file_handle);
+	// the piece ends at the first row that starts after the requested amount of bytes
+	// rows are scanned with the quote rules of the parser, so that quoted newlines are never used as a boundary
+	auto current_size = current_buffer->GetBufferSize();
+	auto target = MinValue<idx_t>(next_byte + bytes_per_local_state, current_size);
+	idx_t end = next_byte;
+	idx_t row_count = 0;
+	row_scanner->Reset();
+	if (!row_scanner->NextRowStart(current_buffer->Ptr(), end, current_size, target, row_count) && next_buffer) {
+		// the last row of the piece continues in the next buffer
+		idx_t next_end = 0;
+		if (!row_scanner->NextRowStart(next_buffer->Ptr(), next_end, next_buffer->GetBufferSize(), 0, row_count) &&
+		    !next_buffer->IsCSVFileLastBuffer()) {
+			throw InvalidInputException(
+			    "Error in file \"%s\" on line %llu: the row does not fit in the CSV buffer, increase the BUFFER_SIZE "
+			    "option (currently %llu bytes)",
+			    bind_data.options.file_path, linenr + row_count + 1, buffer_size);
 		}
+		end = current_size + next_end;
 	}
+	auto result = make_unique<CSVBufferRead>(current_buffer, next_buffer, next_byte, end, batch_index++, linenr);
+	next_byte = end;
+	linenr += row_count;
 	return result;
 }
+
 static unique_ptr<GlobalTableFunctionState> ParallelCSVInitGlobal(ClientContext &context,
                                                                   TableFunctionInitInput &input) {
 	auto &bind_data = (ReadCSVData &)*input.bind_data;
@@ -330,10 +452,12 @@ static unique_ptr<GlobalTableFunctionState> ParallelCSVInitGlobal(ClientContext
 	bind_data.options.file_path = bind_data.files[0];
 	file_handle = ReadCSV::OpenCSV(bind_data.options, context);
 
-	idx_t rows_to_skip = bind_data.options.skip_rows + (bind_data.options.has_header ? 1 : 0);
-	return make_unique<ParallelCSVGlobalState>(context, move(file_handle), bind_data.files,
-	                                           context.db->NumberOfThreads(), bind_data.options.buffer_size,
-	                                           rows_to_skip);
+	idx_t rows_to_skip = bind_data.options.skip_rows + (bind_data.options.header ? 1 : 0);
+	auto result = make_unique<ParallelCSVGlobalState>(context, move(file_handle), bind_data.files,
+	                                                  context.db->NumberOfThreads(), bind_data.options.buffer_size,
+	                                                  rows_to_skip, bind_data.options);
+	result->column_ids = input.column_ids;
+	return move(result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -361,6 +485,7 @@ unique_ptr<LocalTableFunctionState> ReadCSVInitLocal(ExecutionContext &context,
 	if (next_local_buffer) {
 		csv_reader = make_unique<ParallelCSVReader>(context.client, csv_data.options, move(next_local_buffer),
 		                                            csv_data.sql_types);
+		csv_reader->SetProjection(global_state.column_ids);
 	}
 	auto new_local_state = make_unique<ParallelCSVLocalState>(move(csv_reader));
 	return move(new_local_state);
@@ -392,16 +517,6 @@ static void ParallelReadCSVFunction(ClientContext &context, TableFunctionInput &
 		csv_local_state.csv_reader->ParseCSV(output);
 
 	} while (true);
-
-	if (bind_data.options.union_by_name) {
-		throw InternalException("FIXME: union by name");
-	}
-	if (bind_data.options.include_file_name) {
-		throw InternalException("FIXME: output file name");
-	}
-	if (bind_data.options.include_parsed_hive_partitions) {
-		throw InternalException("FIXME: hive partitions");
-	}
 }
 
 static idx_t CSVReaderGetBatchIndex(ClientContext &context, const FunctionData *bind_data_p,
@@ -426,6 +541,8 @@ struct SingleThreadedCSVState : public GlobalTableFunctionState {
 	idx_t file_size;
 	//! How many bytes were read up to this point
 	atomic<idx_t> bytes_read;
+	//! The columns that are used by the query
+	vector<column_t> column_ids;
 
 	idx_t MaxThreads() const override {
 		return 1;
@@ -445,6 +562,8 @@ static unique_ptr<GlobalTableFunctionState> SingleThreadedCSVInit(ClientContext
 		bind_data.options.file_path = bind_data.files[0];
 		result->csv_reader = make_unique<BufferedCSVReader>(context, bind_data.options, bind_data.sql_types);
 	}
+	result->column_ids = input.column_ids;
+	result->csv_reader->SetProjection(result->column_ids);
 	result->file_size = result->csv_reader->file_handle->FileSize();
 	result->file_index = 1;
 	return move(result);
@@ -473,6 +592,7 @@ static void SingleThreadedCSVFunction(ClientContext &context, TableFunctionInput
 				data.csv_reader =
 				    make_unique<BufferedCSVReader>(context, bind_data.options, data.csv_reader->sql_types);
 			}
+			data.csv_reader->SetProjection(data.column_ids);
 			data.file_index++;
 		} else {
 			break;
@@ -575,8 +695,9 @@ double CSVReaderProgress(ClientContext &context, const FunctionData *bind_data_p
 	if (file_size == 0) {
 		return 100;
 	}
+	// the size of compressed files is their compressed size
 	auto percentage = (bytes_read * 100.0) / file_size;
-	return percentage;
+	return MinValue<double>(percentage, 100);
 }
 
 void CSVComplexFilterPushdown(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
@@ -0,0 +1,99 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/query_history.hpp"
+
+namespace duckdb {
+
+struct DuckDBQueryHistoryData : public GlobalTableFunctionState {
+	DuckDBQueryHistoryData() : offset(0) {
+	}
+
+	vector<QueryHistoryEntry> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBQueryHistoryBind(ClientContext &context, TableFunctionBindInput &input,
+                                                       vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("query_id");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("query");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("start_time");
+	return_types.emplace_back(LogicalType::TIMESTAMP);
+
+	names.emplace_back("latency");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("success");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("rows_scanned");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("bytes_read");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("peak_memory");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("spilled_bytes");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("cpu_time");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBQueryHistoryInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_unique<DuckDBQueryHistoryData>();
+	result->entries = QueryHistory::Get(context).GetEntries();
+	return move(result);
+}
+
+void DuckDBQueryHistoryFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = (DuckDBQueryHistoryData &)*data_p.global_state;
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+
+		// return values:
+		// query_id, LogicalType::UBIGINT
+		output.SetValue(0, count, Value::UBIGINT(entry.query_id));
+		// query, LogicalType::VARCHAR
+		output.SetValue(1, count, Value(entry.query));
+		// start_time, LogicalType::TIMESTAMP
+		output.SetValue(2, count, Value::TIMESTAMP(entry.start_time));
+		// latency, LogicalType::DOUBLE
+		output.SetValue(3, count, Value::DOUBLE(entry.latency));
+		// success, LogicalType::BOOLEAN
+		output.SetValue(4, count, Value::BOOLEAN(entry.success));
+		// rows_scanned, LogicalType::UBIGINT
+		output.SetValue(5, count, Value::UBIGINT(entry.rows_scanned));
+		// bytes_read, LogicalType::UBIGINT
+		output.SetValue(6, count, Value::UBIGINT(entry.bytes_read));
+		// peak_memory, LogicalType::UBIGINT
+		output.SetValue(7, count, Value::UBIGINT(entry.peak_memory));
+		// spilled_bytes, LogicalType::UBIGINT
+		output.SetValue(8, count, Value::UBIGINT(entry.spilled_bytes));
+		// cpu_time, LogicalType::DOUBLE
+		output.SetValue(9, count, Value::DOUBLE(entry.cpu_time));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBQueryHistoryFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_query_history", {}, DuckDBQueryHistoryFunction, DuckDBQueryHistoryBind,
+	                              DuckDBQueryHistoryInit));
+}
+
+} // namespace duckdb
@@ -6,10 +6,13 @@
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/optimizer/matcher/expression_matcher.hpp"
+#include "duckdb/parser/parsed_data/sample_options.hpp"
 #include "duckdb/planner/expression/bound_between_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/transaction/local_storage.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
@@ -26,6 +29,8 @@ struct TableScanLocalState : public LocalTableFunctionState {
 	TableScanState scan_state;
 	//! The DataChunk containing all read columns (even filter columns that are immediately removed)
 	DataChunk all_columns;
+	//! The amount of rows at the start of the scan that still have to be skipped
+	idx_t skip_rows = 0;
 };
 
 static storage_t GetStorageIndex(TableCatalogEntry &table, column_t column_id) {
@@ -51,6 +56,11 @@ struct TableScanGlobalState : public GlobalTableFunctionState {
 
 	vector<idx_t> projection_ids;
 	vector<LogicalType> scanned_types;
+	//! The runtime statistics of the table filters, shared between the threads of the scan
+	shared_ptr<AdaptiveFilterStatistics> filter_statistics;
+	//! The rows of the offset that could not be skipped in the storage: these are skipped by the thread that scans
+	//! the first morsel
+	idx_t skip_rows = 0;
 
 	idx_t MaxThreads() const override {
 		return max_threads;
@@ -70,10 +80,15 @@ static unique_ptr<LocalTableFunctionState> TableScanInitLocal(ExecutionContext &
 		auto storage_idx = GetStorageIndex(*bind_data.table, col);
 		col = storage_idx;
 	}
-	result->scan_state.Initialize(move(column_ids), input.filters);
+	auto &tsgs = (TableScanGlobalState &)*gstate;
+	result->scan_state.Initialize(move(column_ids), input.filters, input.dynamic_filters, tsgs.filter_statistics);
+	if (input.sample_options) {
+		auto &sample_options = *input.sample_options;
+		D_ASSERT(sample_options.method == SampleMethod::SYSTEM_SAMPLE && sample_options.is_percentage);
+		result->scan_state.InitializeSample(sample_options.sample_size.GetValue<double>() / 100, sample_options.seed);
+	}
 	TableScanParallelStateNext(context.client, input.bind_data, result.get(), gstate);
 	if (input.CanRemoveFilterColumns()) {
-		auto &tsgs = (TableScanGlobalState &)*gstate;
 		result->all_columns.Initialize(context.client, tsgs.scanned_types);
 	}
 	return move(result);
@@ -85,6 +100,14 @@ unique_ptr<GlobalTableFunctionState> TableScanInitGlobal(ClientContext &context,
 	auto &bind_data = (const TableScanBindData &)*input.bind_data;
 	auto result = make_unique<TableScanGlobalState>(context, input.bind_data);
 	bind_data.table->storage->InitializeParallelScan(context, result->state);
+	if (bind_data.offset > 0) {
+		D_ASSERT(!input.filters || input.filters->filters.empty());
+		auto skipped = bind_data.table->storage->SkipParallelScan(context, result->state, bind_data.offset);
+		result->skip_rows = bind_data.offset - skipped;
+	}
+	if (input.filters) {
+		result->filter_statistics = make_shared<AdaptiveFilterStatistics>();
+	}
 	if (input.CanRemoveFilterColumns()) {
 		result->projection_ids = input.projection_ids;
 		const auto &columns = bind_data.table->columns;
@@ -128,7 +151,19 @@ static void TableScanFunc(ClientContext &context, TableFunctionInput &data_p, Da
 		}
 		if (output.size() > 0) {
 			gstate.row_count += output.size();
-			return;
+			if (state.skip_rows == 0) {
+				return;
+			}
+			// remove the rows at the start of the scan that are part of the offset
+			if (state.skip_rows < output.size()) {
+				SelectionVector sel(state.skip_rows, output.size() - state.skip_rows);
+				output.Slice(sel, output.size() - state.skip_rows);
+				state.skip_rows = 0;
+				return;
+			}
+			state.skip_rows -= output.size();
+			output.Reset();
+			continue;
 		}
 		if (!TableScanParallelStateNext(context, data_p.bind_data, data_p.local_state, data_p.global_state)) {
 			return;
@@ -143,7 +178,13 @@ bool TableScanParallelStateNext(ClientContext &context, const FunctionData *bind
 	auto &state = (TableScanLocalState &)*local_state;
 
 	lock_guard<mutex> parallel_lock(parallel_state.lock);
-	return bind_data.table->storage->NextParallelScan(context, parallel_state.state, state.scan_state);
+	if (!bind_data.table->storage->NextParallelScan(context, parallel_state.state, state.scan_state)) {
+		return false;
+	}
+	// the first morsel that is handed out contains the remainder of the offset
+	state.skip_rows += parallel_state.skip_rows;
+	parallel_state.skip_rows = 0;
+	return true;
 }
 
 double TableScanProgress(ClientContext &context, const FunctionData *bind_data_p,
@@ -389,9 +430,114 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 	});
 }
 
+static bool SupportsOrderedIndexScan(PhysicalType type) {
+	// types for which the order of the ART keys matches the order of ORDER BY
+	switch (type) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool TableScanFunction::TryOrderedIndexScan(ClientContext &context, LogicalGet &get, idx_t column_index,
+                                            OrderType order_type, OrderByNullType null_order, idx_t count) {
+	if (get.function.name != "seq_scan" || !get.table_filters.filters.empty()) {
+		return false;
+	}
+	auto &bind_data = (TableScanBindData &)*get.bind_data;
+	if (bind_data.is_index_scan || bind_data.is_create_index || count == 0 || count > STANDARD_VECTOR_SIZE) {
+		return false;
+	}
+	auto &config = ClientConfig::GetConfig(context);
+	if (!config.enable_optimizer) {
+		return false;
+	}
+	auto column_id = get.column_ids[column_index];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID || !SupportsOrderedIndexScan(get.returned_types[column_id].InternalType())) {
+		return false;
+	}
+	auto &storage = *bind_data.table->storage;
+	// find an ART on exactly this column
+	ART *art = nullptr;
+	storage.info->indexes.Scan([&](Index &index) {
+		if (index.type != IndexType::ART || index.unbound_expressions.size() != 1 ||
+		    index.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		auto &colref = (BoundColumnRefExpression &)*index.unbound_expressions[0];
+		if (index.column_ids[colref.binding.column_index] != column_id) {
+			return false;
+		}
+		art = (ART *)&index;
+		return true;
+	});
+	if (!art) {
+		return false;
+	}
+	// NULL values are not part of the index: they can only be ignored if they are ordered after the indexed values
+	auto stats = storage.GetStatistics(context, column_id);
+	bool can_have_null = !stats || stats->CanHaveNull();
+	if (can_have_null && null_order != OrderByNullType::NULLS_LAST) {
+		return false;
+	}
+
+	// collect the row ids of the first keys in index order until enough of them are visible to this transaction
+	auto &transaction = Transaction::GetTransaction(context);
+	bool descending = order_type == OrderType::DESCENDING;
+	vector<column_t> fetch_columns {COLUMN_IDENTIFIER_ROW_ID};
+	DataChunk fetch_chunk;
+	fetch_chunk.Initialize(Allocator::Get(context), {LogicalType::ROW_TYPE});
+	idx_t scan_count = count;
+	vector<row_t> row_ids;
+	while (true) {
+		row_ids.clear();
+		bool exhausted = !art->ScanOrdered(descending, scan_count, row_ids);
+		if (row_ids.size() > STANDARD_VECTOR_SIZE) {
+			return false;
+		}
+		if (!row_ids.empty()) {
+			fetch_chunk.Reset();
+			ColumnFetchState fetch_state;
+			Vector row_id_vector(LogicalType::ROW_TYPE, (data_ptr_t)row_ids.data());
+			storage.Fetch(transaction, fetch_chunk, fetch_columns, row_id_vector, row_ids.size(), fetch_state);
+		}
+		if (!row_ids.empty() && fetch_chunk.size() >= count) {
+			break;
+		}
+		if (exhausted) {
+			if (can_have_null) {
+				// the result might contain NULL values that are not in the index
+				return false;
+			}
+			break;
+		}
+		if (scan_count >= STANDARD_VECTOR_SIZE) {
+			return false;
+		}
+		scan_count = MinValue<idx_t>(scan_count * 2, STANDARD_VECTOR_SIZE);
+	}
+	bind_data.result_ids = move(row_ids);
+	bind_data.is_index_scan = true;
+	get.function = TableScanFunction::GetIndexScanFunction();
+	return true;
+}
+
 string TableScanToString(const FunctionData *bind_data_p) {
 	auto &bind_data = (const TableScanBindData &)*bind_data_p;
 	string result = bind_data.table->name;
+	if (bind_data.offset > 0) {
+		result += "\nOffset: " + to_string(bind_data.offset);
+	}
 	return result;
 }
 
@@ -458,6 +604,7 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = true;
 	scan_function.filter_prune = true;
+	scan_function.sampling_pushdown = true;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
 	return scan_function;
@@ -18,7 +18,8 @@ TableFunction::TableFunction(string name, vector<LogicalType> arguments, table_f
       init_local(init_local), function(function), in_out_function(nullptr), in_out_function_final(nullptr),
       statistics(nullptr), dependency(nullptr), cardinality(nullptr), pushdown_complex_filter(nullptr),
       to_string(nullptr), table_scan_progress(nullptr), get_batch_index(nullptr), serialize(nullptr),
-      deserialize(nullptr), projection_pushdown(false), filter_pushdown(false), filter_prune(false) {
+      deserialize(nullptr), projection_pushdown(false), filter_pushdown(false), filter_prune(false),
+      sampling_pushdown(false) {
 }
 
 TableFunction::TableFunction(const vector<LogicalType> &arguments, table_function_t function,
@@ -31,7 +32,7 @@ TableFunction::TableFunction()
       in_out_function(nullptr), statistics(nullptr), dependency(nullptr), cardinality(nullptr),
       pushdown_complex_filter(nullptr), to_string(nullptr), table_scan_progress(nullptr), get_batch_index(nullptr),
       serialize(nullptr), deserialize(nullptr), projection_pushdown(false), filter_pushdown(false),
-      filter_prune(false) {
+      filter_prune(false), sampling_pushdown(false) {
 }
 
 } // namespace duckdb
@@ -192,6 +192,14 @@ typedef struct {
 	idx_t size;
 } duckdb_blob;
 
+//! The progress of the query that is running on a connection, see duckdb_query_progress
+typedef struct {
+	double percentage;
+	uint64_t rows_processed;
+	uint64_t total_rows_to_process;
+	uint64_t bytes_read;
+} duckdb_query_progress_type;
+
 typedef struct {
 #if DUCKDB_API_VERSION < DUCKDB_API_0_3_2
 	void *data;
@@ -308,6 +316,19 @@ Closes the specified connection and de-allocates all memory allocated for that c
 */
 DUCKDB_API void duckdb_disconnect(duckdb_connection *connection);
 
+/*!
+Returns the progress of the query that is running on the connection. The progress is only tracked while the progress
+bar is enabled (`SET enable_progress_bar=true`), and can be read from another thread while the query runs.
+
+The percentage weights the pipelines of the query by their estimated cardinality. `rows_processed` is the amount of
+rows the pipelines have processed so far, and `total_rows_to_process` the estimated amount they process in total.
+`bytes_read` is the amount of bytes read from files since the query started (including reads of concurrent queries).
+
+* connection: The connection running the query.
+* returns: The progress of the query. The percentage is -1 if no query with progress tracking is running.
+*/
+DUCKDB_API duckdb_query_progress_type duckdb_query_progress(duckdb_connection connection);
+
 /*!
 Returns the version of the linked DuckDB, with a version postfix for dev versions
 
@@ -2015,6 +2036,51 @@ If the append is successful, DuckDBSuccess is returned.
 */
 DUCKDB_API duckdb_state duckdb_append_data_chunk(duckdb_appender appender, duckdb_data_chunk chunk);
 
+/*!
+Sets the data of a column for the next call to `duckdb_appender_append_columns`.
+
+The values must be stored in the internal layout of the column type (e.g. `int32_t` for INTEGER, `duckdb_timestamp`
+for TIMESTAMP). The data is not copied, it must stay valid until `duckdb_appender_append_columns` is called.
+For VARCHAR and BLOB columns, `duckdb_appender_set_string_column` must be used instead.
+
+* appender: The appender to append to.
+* col_idx: The column index.
+* data: The array of values.
+* validity: The validity mask of the values (bit `i % 64` of entry `i / 64` is set if row `i` is valid), or `NULL` if
+all values are valid.
+* returns: The return state.
+*/
+DUCKDB_API duckdb_state duckdb_appender_set_column(duckdb_appender appender, idx_t col_idx, const void *data,
+                                                   const uint64_t *validity);
+
+/*!
+Sets the data of a VARCHAR or BLOB column for the next call to `duckdb_appender_append_columns`.
+
+String `i` consists of the bytes from `offsets[i]` up to `offsets[i + 1]` in `data`. The data is not copied, it must
+stay valid until `duckdb_appender_append_columns` is called.
+
+* appender: The appender to append to.
+* col_idx: The column index.
+* data: The concatenated bytes of the strings.
+* offsets: The offsets of the strings (one entry more than the amount of rows).
+* validity: The validity mask of the values, or `NULL` if all values are valid.
+* returns: The return state.
+*/
+DUCKDB_API duckdb_state duckdb_appender_set_string_column(duckdb_appender appender, idx_t col_idx, const char *data,
+                                                          const uint32_t *offsets, const uint64_t *validity);
+
+/*!
+Appends `count` rows from the column data that was set for every column of the table.
+
+This avoids the per-value overhead of appending values one by one: the values are appended directly to the table,
+without first being gathered in the appender. Rows that were appended with the row-based functions are flushed first.
+
+* appender: The appender to append to.
+* count: The amount of rows to append.
+* returns: The return state.
+*/
+DUCKDB_API duckdb_state duckdb_appender_append_columns(duckdb_appender appender, idx_t count);
+
 //===--------------------------------------------------------------------===//
 // Arrow Interface
 //===--------------------------------------------------------------------===//
@@ -192,6 +192,9 @@ private:
 	//! A variation of GetEntry that returns an associated schema as well.
 	CatalogEntryLookup LookupEntry(ClientContext &context, CatalogType type, const string &schema, const string &name,
 	                               bool if_exists = false, QueryErrorContext error_context = QueryErrorContext());
+	//! Looks up an entry in the given schema, using the lookups cached by the current transaction if possible
+	CatalogEntryLookup LookupEntryInSchema(ClientContext &context, CatalogType type, const string &schema,
+	                                       const string &name);
 
 	//! Return an exception with did-you-mean suggestion.
 	CatalogException CreateMissingEntryException(ClientContext &context, const string &entry_name, CatalogType type,
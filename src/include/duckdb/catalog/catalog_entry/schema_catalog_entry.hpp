@@ -73,6 +73,9 @@ public:
 	void Scan(ClientContext &context, CatalogType type, const std::function<void(CatalogEntry *)> &callback);
 	//! Scan the specified catalog set, invoking the callback method for every committed entry
 	void Scan(CatalogType type, const std::function<void(CatalogEntry *)> &callback);
+	//! Sets the generator that creates the entries of the specified catalog set when they are first used, e.g. to
+	//! register the entries of an extension lazily
+	DUCKDB_API void SetDefaultGenerator(CatalogType type, unique_ptr<DefaultGenerator> generator);
 
 	//! Serialize the meta information of the SchemaCatalogEntry a serializer
 	virtual void Serialize(Serializer &serializer);
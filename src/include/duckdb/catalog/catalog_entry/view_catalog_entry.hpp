@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/catalog/standard_entry.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/vector.hpp"
@@ -16,6 +17,7 @@
 namespace duckdb {
 
 class DataTable;
+class MaterializedViewData;
 struct CreateViewInfo;
 
 //! A view catalog entry
@@ -32,6 +34,11 @@ public:
 	vector<string> aliases;
 	//! The returned types of the view
 	vector<LogicalType> types;
+	//! Whether the results of the view are materialized
+	bool materialized;
+	//! The data of the materialized view (if it was used)
+	shared_ptr<MaterializedViewData> materialized_data;
+	mutex materialized_lock;
 
 public:
 	unique_ptr<CatalogEntry> AlterEntry(ClientContext &context, AlterInfo *info) override;
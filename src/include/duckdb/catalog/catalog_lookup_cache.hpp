@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/catalog/catalog_lookup_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/catalog_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class CatalogEntry;
+class SchemaCatalogEntry;
+
+//! The CatalogLookupCache holds the catalog entries a transaction has looked up in a specific schema (including
+//! lookups that found nothing). The entries that are visible to a transaction only change when the catalog is
+//! modified, so the cached lookups remain valid as long as the catalog version does not change.
+class CatalogLookupCache {
+public:
+	//! Returns the cached lookup of the entry, if there is one that is valid for the given catalog version
+	bool Get(idx_t catalog_version, CatalogType type, const string &schema_name, const string &name,
+	         SchemaCatalogEntry *&schema, CatalogEntry *&entry) {
+		lock_guard<mutex> glock(lock);
+		if (catalog_version != version) {
+			return false;
+		}
+		auto lookup = lookups.find(GetKey(type, schema_name, name));
+		if (lookup == lookups.end()) {
+			return false;
+		}
+		schema = lookup->second.first;
+		entry = lookup->second.second;
+		return true;
+	}
+
+	//! Caches the lookup of the entry, which was made at the given catalog version
+	void Put(idx_t catalog_version, CatalogType type, const string &schema_name, const string &name,
+	         SchemaCatalogEntry *schema, CatalogEntry *entry) {
+		lock_guard<mutex> glock(lock);
+		if (catalog_version != version) {
+			// the catalog was modified: the previously cached lookups are no longer valid
+			lookups.clear();
+			version = catalog_version;
+		}
+		lookups[GetKey(type, schema_name, name)] = make_pair(schema, entry);
+	}
+
+private:
+	static string GetKey(CatalogType type, const string &schema_name, const string &name) {
+		string key;
+		key.reserve(schema_name.size() + name.size() + 2);
+		key += char(type);
+		key += schema_name;
+		key += '\0';
+		key += name;
+		return key;
+	}
+
+private:
+	mutex lock;
+	//! The catalog version the cached lookups were made at
+	idx_t version = 0;
+	unordered_map<string, pair<SchemaCatalogEntry *, CatalogEntry *>> lookups;
+};
+
+} // namespace duckdb
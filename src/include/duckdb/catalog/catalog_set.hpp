@@ -80,6 +80,9 @@ public:
 
 	void CleanupEntry(CatalogEntry *catalog_entry);
 
+	//! Sets the generator of the default entries of the catalog set, which creates them when they are first accessed
+	DUCKDB_API void SetDefaultGenerator(unique_ptr<DefaultGenerator> defaults);
+
 	//! Returns the entry with the specified name
 	DUCKDB_API CatalogEntry *GetEntry(ClientContext &context, const string &name);
 
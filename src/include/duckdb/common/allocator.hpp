@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 
 namespace duckdb {
@@ -63,6 +64,8 @@ private:
 class Allocator {
 	// 281TB ought to be enough for anybody
 	static constexpr const idx_t MAXIMUM_ALLOC_SIZE = 281474976710656ULL;
+	//! The size of a (transparent) huge page
+	static constexpr const idx_t HUGE_PAGE_SIZE = 2097152ULL;
 
 public:
 	DUCKDB_API Allocator();
@@ -96,6 +99,14 @@ public:
 		return private_data.get();
 	}
 
+	//! Whether or not allocations of at least HUGE_PAGE_SIZE bytes should be backed by transparent huge pages
+	void SetHugePages(bool enable) {
+		huge_pages = enable;
+	}
+	bool UsesHugePages() const {
+		return huge_pages;
+	}
+
 	static Allocator &DefaultAllocator();
 	static shared_ptr<Allocator> &DefaultAllocatorReference();
 
@@ -105,6 +116,11 @@ private:
 	reallocate_function_ptr_t reallocate_function;
 
 	unique_ptr<PrivateAllocatorData> private_data;
+	//! Whether or not large allocations are advised to use huge pages
+	atomic<bool> huge_pages;
+
+	//! Advise the OS to back the huge page aligned part of the allocation with huge pages
+	static void AdviseHugePages(data_ptr_t pointer, idx_t size);
 };
 
 template <class T>
@@ -13,6 +13,7 @@
 
 namespace duckdb {
 class CompressedFile;
+class TaskScheduler;
 
 struct StreamData {
 	// various buffers & pointers
@@ -38,6 +39,14 @@ struct StreamWrapper {
 	DUCKDB_API virtual void Close() = 0;
 };
 
+//! A part of a compressed file that can be decompressed independently of the rest of the file
+struct CompressedFileBlock {
+	//! The position of the block in the compressed file
+	idx_t compressed_offset;
+	idx_t compressed_size;
+	idx_t uncompressed_size;
+};
+
 class CompressedFileSystem : public FileSystem {
 public:
 	DUCKDB_API int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
@@ -53,6 +62,13 @@ public:
 	DUCKDB_API virtual unique_ptr<StreamWrapper> CreateStream() = 0;
 	DUCKDB_API virtual idx_t InBufferSize() = 0;
 	DUCKDB_API virtual idx_t OutBufferSize() = 0;
+
+	//! Finds the independently compressed blocks of a file (e.g. the members of a blocked gzip file), if the file
+	//! stores the uncompressed size of every block. Returns false if the file can not be split into blocks.
+	DUCKDB_API virtual bool FindBlocks(FileHandle &child_handle, vector<CompressedFileBlock> &blocks);
+	//! Decompresses a single block that was found by FindBlocks into a buffer of block.uncompressed_size bytes
+	DUCKDB_API virtual void DecompressBlock(const_data_ptr_t compressed_data, const CompressedFileBlock &block,
+	                                        data_ptr_t target);
 };
 
 class CompressedFile : public FileHandle {
@@ -76,4 +92,53 @@ private:
 	unique_ptr<StreamWrapper> stream_wrapper;
 };
 
+//! CompressedBlockReader reads a compressed file that consists of independently compressed blocks
+/*!
+   Instead of decompressing the file as one sequential stream, all blocks that are needed for a read are decompressed
+   in parallel by the tasks of the scheduler, directly into the target buffer.
+*/
+class CompressedBlockReader {
+public:
+	//! The minimum amount of uncompressed bytes that are decompressed by a single task
+	static constexpr const idx_t MINIMUM_TASK_SIZE = 1 << 20;
+
+	CompressedBlockReader(TaskScheduler &scheduler, CompressedFile &file, vector<CompressedFileBlock> blocks);
+
+	//! Creates a reader if the handle is a compressed file that consists of multiple blocks of at most max_block_size
+	//! uncompressed bytes, or returns nullptr otherwise
+	static unique_ptr<CompressedBlockReader> TryCreate(TaskScheduler &scheduler, FileHandle &handle,
+	                                                   idx_t max_block_size);
+
+	//! Reads the next nr_bytes uncompressed bytes, returns the amount of bytes that were read
+	idx_t Read(data_ptr_t buffer, idx_t nr_bytes);
+	//! Restarts reading at the start of the file
+	void Reset();
+	//! The total size of the uncompressed file
+	idx_t UncompressedSize() const {
+		return uncompressed_size;
+	}
+
+	//! Decompresses the blocks [begin, end), compressed_data contains the file from position compressed_start
+	void DecompressBlocks(const_data_ptr_t compressed_data, idx_t compressed_start, idx_t begin, idx_t end,
+	                      data_ptr_t target);
+
+private:
+	//! Reads the compressed data of the blocks [begin, end) and decompresses them in parallel into target
+	void ReadBlocks(idx_t begin, idx_t end, data_ptr_t target);
+
+	TaskScheduler &scheduler;
+	CompressedFile &file;
+	vector<CompressedFileBlock> blocks;
+	idx_t uncompressed_size;
+	//! The next block that has not been read yet
+	idx_t block_index;
+	//! A block that has only been partially read, and the position in that block
+	unique_ptr<data_t[]> partial_block;
+	idx_t partial_block_size;
+	idx_t partial_block_position;
+	//! Buffer for the compressed data of the blocks that are decompressed
+	unique_ptr<data_t[]> compressed_buffer;
+	idx_t compressed_buffer_capacity;
+};
+
 } // namespace duckdb
@@ -22,7 +22,8 @@ enum class CompressionType : uint8_t {
 	COMPRESSION_BITPACKING = 6,
 	COMPRESSION_FSST = 7,
 	COMPRESSION_CHIMP = 8,
-	COMPRESSION_PATAS = 9
+	COMPRESSION_PATAS = 9,
+	COMPRESSION_ALP = 10
 };
 
 CompressionType CompressionTypeFromString(const string &str);
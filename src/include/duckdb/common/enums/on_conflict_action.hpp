@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/on_conflict_action.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! What an INSERT does with tuples that violate a UNIQUE or PRIMARY KEY constraint
+enum class OnConflictAction : uint8_t {
+	//! Throw a constraint exception (default)
+	THROW = 0,
+	//! Skip the conflicting tuples (ON CONFLICT DO NOTHING)
+	NOTHING = 1
+};
+
+} // namespace duckdb
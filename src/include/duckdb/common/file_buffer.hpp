@@ -25,6 +25,9 @@ public:
 	//! DIRECT_IO
 	FileBuffer(Allocator &allocator, FileBufferType type, uint64_t user_size);
 	FileBuffer(FileBuffer &source, FileBufferType type);
+	//! Wraps memory that is owned elsewhere (e.g. a memory-mapped file), including the buffer header. The memory is not
+	//! freed when the FileBuffer is destroyed.
+	FileBuffer(Allocator &allocator, FileBufferType type, data_ptr_t internal_buffer, uint64_t internal_size);
 
 	virtual ~FileBuffer();
 
@@ -42,6 +45,8 @@ public:
 	//! Read into the FileBuffer from the specified location. Automatically verifies the checksum, and throws an
 	//! exception if the checksum does not match correctly.
 	virtual void ReadAndChecksum(FileHandle &handle, uint64_t location);
+	//! Verifies the checksum stored in the header of the buffer, and throws an exception if it does not match
+	void VerifyChecksum();
 	//! Write the contents of the FileBuffer to the specified location.
 	void Write(FileHandle &handle, uint64_t location);
 	//! Write the contents of the FileBuffer to the specified location. Automatically adds a checksum of the contents of
@@ -57,6 +62,10 @@ public:
 	uint64_t AllocSize() const {
 		return internal_size;
 	}
+	//! Whether or not the buffer wraps memory that is not owned by the FileBuffer
+	bool IsExternal() const {
+		return internal_buffer && !malloced_buffer;
+	}
 
 	struct MemoryRequirement {
 		idx_t alloc_size;
@@ -46,6 +46,13 @@ enum class FileType {
 	FILE_TYPE_INVALID,
 };
 
+//! A range of a file that is read into a buffer
+struct FileReadRange {
+	data_ptr_t buffer;
+	idx_t nr_bytes;
+	idx_t location;
+};
+
 struct FileHandle {
 public:
 	DUCKDB_API FileHandle(FileSystem &file_system, string path);
@@ -55,11 +62,13 @@ public:
 	DUCKDB_API int64_t Read(void *buffer, idx_t nr_bytes);
 	DUCKDB_API int64_t Write(void *buffer, idx_t nr_bytes);
 	DUCKDB_API void Read(void *buffer, idx_t nr_bytes, idx_t location);
+	DUCKDB_API void ReadRanges(const vector<FileReadRange> &ranges);
 	DUCKDB_API void Write(void *buffer, idx_t nr_bytes, idx_t location);
 	DUCKDB_API void Seek(idx_t location);
 	DUCKDB_API void Reset();
 	DUCKDB_API idx_t SeekPosition();
 	DUCKDB_API void Sync();
+	DUCKDB_API void Prefetch(idx_t location, idx_t nr_bytes);
 	DUCKDB_API void Truncate(int64_t new_size);
 	DUCKDB_API string ReadLine();
 
@@ -108,6 +117,10 @@ public:
 	DUCKDB_API static FileSystem &GetFileSystem(ClientContext &context);
 	DUCKDB_API static FileSystem &GetFileSystem(DatabaseInstance &db);
 	DUCKDB_API static FileOpener *GetFileOpener(ClientContext &context);
+	//! Returns the total amount of bytes read through file handles by this process
+	DUCKDB_API static idx_t GetTotalBytesRead();
+	//! Returns the total amount of bytes written through file handles by this process
+	DUCKDB_API static idx_t GetTotalBytesWritten();
 
 	DUCKDB_API virtual unique_ptr<FileHandle> OpenFile(const string &path, uint8_t flags,
 	                                                   FileLockType lock = DEFAULT_LOCK,
@@ -117,6 +130,9 @@ public:
 	//! Read exactly nr_bytes from the specified location in the file. Fails if nr_bytes could not be read. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Read().
 	DUCKDB_API virtual void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! Read all of the given ranges of the file. The default implementation reads them one by one, file systems with a
+	//! high latency per request can issue the reads concurrently.
+	DUCKDB_API virtual void ReadRanges(FileHandle &handle, const vector<FileReadRange> &ranges);
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	DUCKDB_API virtual void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
@@ -156,6 +172,9 @@ public:
 	DUCKDB_API virtual void RemoveFile(const string &filename);
 	//! Sync a file handle to disk
 	DUCKDB_API virtual void FileSync(FileHandle &handle);
+	//! Hint that nr_bytes at the specified location in the file will be read soon. This does not block, and file
+	//! systems that cannot read ahead ignore it.
+	DUCKDB_API virtual void Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes);
 	//! Sets the working directory
 	DUCKDB_API static void SetWorkingDirectory(const string &path);
 	//! Gets the working directory
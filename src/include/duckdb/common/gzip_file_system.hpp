@@ -31,6 +31,11 @@ public:
 	unique_ptr<StreamWrapper> CreateStream() override;
 	idx_t InBufferSize() override;
 	idx_t OutBufferSize() override;
+
+	//! Finds the members of a blocked gzip (BGZF) file, which store their size in an extra field of the header
+	bool FindBlocks(FileHandle &child_handle, vector<CompressedFileBlock> &blocks) override;
+	void DecompressBlock(const_data_ptr_t compressed_data, const CompressedFileBlock &block,
+	                     data_ptr_t target) override;
 };
 
 static constexpr const uint8_t GZIP_COMPRESSION_DEFLATE = 0x08;
@@ -43,8 +48,10 @@ static constexpr const uint8_t GZIP_FLAG_COMMENT = 0x10;
 static constexpr const uint8_t GZIP_FLAG_ENCRYPT = 0x20;
 
 static constexpr const uint8_t GZIP_HEADER_MINSIZE = 10;
+//! The size of the header of a BGZF member, which has a single extra field with the size of the member
+static constexpr const uint8_t BGZF_HEADER_SIZE = 18;
 
 static constexpr const unsigned char GZIP_FLAG_UNSUPPORTED =
-    GZIP_FLAG_ASCII | GZIP_FLAG_MULTIPART | GZIP_FLAG_EXTRA | GZIP_FLAG_COMMENT | GZIP_FLAG_ENCRYPT;
+    GZIP_FLAG_ASCII | GZIP_FLAG_MULTIPART | GZIP_FLAG_COMMENT | GZIP_FLAG_ENCRYPT;
 
 } // namespace duckdb
@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/hardware_counters.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The values of the hardware counters of a thread
+struct HardwareCounterValues {
+	//! Elapsed CPU cycles
+	uint64_t cycles = 0;
+	//! Retired instructions
+	uint64_t instructions = 0;
+	//! Last level cache misses
+	uint64_t cache_misses = 0;
+	//! Mispredicted branches
+	uint64_t branch_misses = 0;
+
+	//! Whether any of the counters has a value
+	bool HasValues() const {
+		return cycles > 0 || instructions > 0 || cache_misses > 0 || branch_misses > 0;
+	}
+	HardwareCounterValues &operator+=(const HardwareCounterValues &other) {
+		cycles += other.cycles;
+		instructions += other.instructions;
+		cache_misses += other.cache_misses;
+		branch_misses += other.branch_misses;
+		return *this;
+	}
+	HardwareCounterValues operator-(const HardwareCounterValues &other) const {
+		HardwareCounterValues result;
+		result.cycles = cycles - other.cycles;
+		result.instructions = instructions - other.instructions;
+		result.cache_misses = cache_misses - other.cache_misses;
+		result.branch_misses = branch_misses - other.branch_misses;
+		return result;
+	}
+};
+
+//! The HardwareCounters read the hardware performance counters of the calling thread through perf_event. The
+//! counters are only available on Linux, and only if the kernel allows the process to open them
+//! (see perf_event_paranoid); otherwise all counters read as zero
+class HardwareCounters {
+public:
+	static constexpr const idx_t COUNTER_COUNT = 4;
+
+	HardwareCounters();
+	~HardwareCounters();
+
+	//! Returns the counters of the calling thread, which are opened on first use
+	static HardwareCounters &Get();
+
+	//! Whether any of the counters could be opened
+	bool IsAvailable() const;
+	//! Reads the current values of the counters
+	HardwareCounterValues Read() const;
+
+private:
+	//! The file descriptors of the counters, the first opened counter leads the group
+	int fds[COUNTER_COUNT];
+	//! The file descriptor of the group leader, or -1 if no counter could be opened
+	int leader;
+	//! The position of each counter in the values read from the group, or INVALID_INDEX
+	idx_t positions[COUNTER_COUNT];
+};
+
+} // namespace duckdb
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/types/partitioned_column_data.hpp"
 #include "duckdb/optimizer/statistics_propagator.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/execution/expression_executor.hpp"
@@ -34,4 +35,32 @@ public:
 	DUCKDB_API static const string REGEX_STRING;
 };
 
+//! HivePartitionedColumnData partitions the input on the distinct values of a set of columns. The partitions are
+//! created on the fly as new values are encountered, so the partition indexes are local to this object: it can not be
+//! combined with other instances
+class HivePartitionedColumnData : public PartitionedColumnData {
+public:
+	HivePartitionedColumnData(ClientContext &context, vector<LogicalType> types, vector<idx_t> partition_columns);
+	~HivePartitionedColumnData() override;
+
+public:
+	//! Returns the values of the partition columns of the rows in a partition
+	const vector<Value> &GetPartitionKey(idx_t partition_index) const;
+	//! Takes the rows that have been appended to a partition so far, and continues with an empty partition
+	unique_ptr<ColumnDataCollection> TakePartition(PartitionedColumnDataAppendState &state, idx_t partition_index);
+
+protected:
+	void ComputePartitionIndices(PartitionedColumnDataAppendState &state, DataChunk &input) override;
+
+private:
+	//! Returns the index of the partition of the given key, creating the partition if it does not exist yet
+	idx_t GetPartitionIndex(PartitionedColumnDataAppendState &state, vector<Value> key);
+
+private:
+	vector<idx_t> partition_columns;
+	//! Maps the partition keys to the partition indexes
+	unordered_map<string, idx_t> partition_map;
+	vector<vector<Value>> partition_keys;
+};
+
 } // namespace duckdb
@@ -60,6 +60,8 @@ public:
 	void RemoveFile(const string &filename) override;
 	//! Sync a file handle to disk
 	void FileSync(FileHandle &handle) override;
+	//! Ask the OS to asynchronously read ahead a range of the file into the page cache
+	void Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes) override;
 
 	//! Runs a glob on the file system, returning a list of matching files
 	vector<string> Glob(const string &path, FileOpener *opener = nullptr) override;
@@ -0,0 +1,15 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#if __GNUC__
+#define DUCKDB_PREFETCH(addr) (__builtin_prefetch((const void *)(addr)))
+#else
+#define DUCKDB_PREFETCH(addr) ((void)(addr))
+#endif
@@ -25,6 +25,14 @@ public:
 	void Update(bool final);
 	//! Gets current percentage
 	double GetCurrentPercentage();
+	//! Gets the amount of rows the pipelines of the query have processed
+	idx_t GetRowsProcessed() {
+		return rows_processed;
+	}
+	//! Gets the (estimated) amount of rows the pipelines of the query process in total
+	idx_t GetTotalRowsToProcess() {
+		return total_rows_to_process;
+	}
 
 private:
 	static constexpr const idx_t PARTIAL_BLOCK_COUNT = 8;
@@ -58,9 +66,10 @@ private:
 	idx_t show_progress_after;
 	//! The current progress percentage
 	double current_percentage;
+	//! The amount of rows processed, and the estimated total amount of rows to process
+	idx_t rows_processed = 0;
+	idx_t total_rows_to_process = 0;
 	//! Whether or not we print the progress bar
 	bool print_progress;
-	//! Whether or not profiling is supported for the current query
-	bool supported = true;
 };
 } // namespace duckdb
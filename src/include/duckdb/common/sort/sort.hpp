@@ -14,6 +14,7 @@
 
 namespace duckdb {
 
+class ClientContext;
 class RowLayout;
 struct LocalSortState;
 
@@ -22,6 +23,10 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! The default size of a string in the radix-sortable key (including the NULL byte)
+	static constexpr idx_t STRING_PREFIX_SIZE = 12;
+	//! Strings are stored in the key completely (so ties never have to be broken) if they fit in this size
+	static constexpr idx_t MAX_CONSTANT_STRING_SIZE = 24;
 };
 
 struct SortLayout {
@@ -61,6 +66,9 @@ public:
 	void PrepareMergePhase();
 	//! Initializes the global sort state for another round of merging
 	void InitializeMergeRound();
+	//! Concatenates the sorted blocks if their key ranges do not overlap (e.g., because the input was sorted already),
+	//! so they do not have to be merged
+	void ConcatenateDisjointBlocks();
 	//! Completes the cascaded merge sort round.
 	//! Pass true if you wish to use the radix data for further comparisons.
 	void CompleteMergeRound(bool keep_radix_data = false);
@@ -90,6 +98,8 @@ public:
 	idx_t block_capacity;
 	//! Whether we are doing an external sort
 	bool external;
+	//! The memory that the sort may use, used to decide whether to do an external sort (default: the memory limit)
+	idx_t memory_limit;
 
 	//! Progress in merge path stage
 	idx_t pair_idx;
@@ -114,8 +124,8 @@ public:
 	static unique_ptr<RowDataBlock> ConcatenateBlocks(RowDataCollection &row_data);
 
 private:
-	//! Sorts the data in the newly created SortedBlock
-	void SortInMemory();
+	//! Sorts the data in the newly created SortedBlock, returns false if the data was sorted already
+	bool SortInMemory();
 	//! Re-order the local state after sorting
 	void ReOrder(GlobalSortState &gstate, bool reorder_heap);
 	//! Re-order a SortedData object after sorting
@@ -153,6 +163,8 @@ public:
 
 	//! Finds and merges partitions until the current cascaded merge round is finished
 	void PerformInMergeRound();
+	//! Same as above, but stops with an InterruptException between partitions if the query is interrupted
+	void PerformInMergeRound(ClientContext &context);
 
 private:
 	//! The global sorting state
@@ -171,6 +183,8 @@ private:
 	SortedBlock *result;
 
 private:
+	//! Claims the next partition of the current merge round, returns false if there are none left
+	bool NextPartition();
 	//! Computes the left and right block that will be merged next (Merge Path partition)
 	void GetNextPartition();
 	//! Finds the boundary of the next partition using binary search
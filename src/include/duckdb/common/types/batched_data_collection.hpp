@@ -25,6 +25,8 @@ struct BatchedChunkScanState {
 class BatchedDataCollection {
 public:
 	DUCKDB_API BatchedDataCollection(vector<LogicalType> types);
+	//! Constructs a batched collection that can spill to disk (see ColumnDataCollection::CreateMaterializedCollection)
+	DUCKDB_API BatchedDataCollection(ClientContext &context, vector<LogicalType> types);
 
 	//! Appends a datachunk with the given batch index to the batched collection
 	DUCKDB_API void Append(DataChunk &input, idx_t batch_index);
@@ -51,6 +53,11 @@ private:
 		ColumnDataAppendState append_state;
 	};
 
+	//! Creates a new (empty) collection to append to
+	unique_ptr<ColumnDataCollection> CreateCollection();
+
+	//! The client context used to create buffer-managed collections (if any)
+	ClientContext *context = nullptr;
 	vector<LogicalType> types;
 	//! The data of the batched chunk collection - a set of batch_index -> ColumnDataCollection pointers
 	map<idx_t, unique_ptr<ColumnDataCollection>> data;
@@ -29,6 +29,9 @@ public:
 	ColumnDataAllocator(Allocator &allocator);
 	ColumnDataAllocator(BufferManager &buffer_manager);
 	ColumnDataAllocator(ClientContext &context, ColumnDataAllocatorType allocator_type);
+	//! Constructs a buffer-managed allocator that keeps the database alive, for collections that can outlive the
+	//! database they were created in (e.g. query results)
+	explicit ColumnDataAllocator(shared_ptr<DatabaseInstance> database);
 
 	//! Returns an allocator object to allocate with. This returns the allocator in IN_MEMORY_ALLOCATOR, and a buffer
 	//! allocator in case of BUFFER_MANAGER_ALLOCATOR.
@@ -43,6 +46,11 @@ public:
 	idx_t BlockCount() const {
 		return blocks.size();
 	}
+	//! The total size of the blocks of the allocator
+	idx_t SizeInBytes() const;
+	//! Whether or not vectors can keep the memory of this allocator alive, even after the collection and the
+	//! database it was created in are destroyed
+	bool CanKeepAlive() const;
 
 public:
 	void AllocateData(idx_t size, uint32_t &block_id, uint32_t &offset, ChunkManagementState *chunk_state);
@@ -53,11 +61,12 @@ public:
 
 	//! Deletes the block with the given id
 	void DeleteBlock(uint32_t block_id);
+	//! Pins the block with the given id (if this is a BUFFER_MANAGER_ALLOCATOR)
+	BufferHandle Pin(uint32_t block_id);
 
 private:
 	void AllocateEmptyBlock(idx_t size);
 	BufferHandle AllocateBlock();
-	BufferHandle Pin(uint32_t block_id);
 	BufferHandle PinInternal(uint32_t block_id);
 
 	bool HasBlocks() const {
@@ -70,6 +79,8 @@ private:
 	void AssignPointer(uint32_t &block_id, uint32_t &offset, data_ptr_t pointer);
 
 private:
+	//! The database that is kept alive by this allocator (if any). This is destroyed after the blocks.
+	shared_ptr<DatabaseInstance> database;
 	ColumnDataAllocatorType type;
 	union {
 		//! The allocator object (if this is a IN_MEMORY_ALLOCATOR)
@@ -42,6 +42,11 @@ public:
 	DUCKDB_API ColumnDataCollection(shared_ptr<ColumnDataAllocator> allocator, vector<LogicalType> types);
 	DUCKDB_API ~ColumnDataCollection();
 
+	//! Creates a collection for data that is materialized by a query and can outlive it (e.g. the query result). The
+	//! collection is buffer-managed, so it can be spilled to the temporary directory, if the database has one.
+	DUCKDB_API static unique_ptr<ColumnDataCollection> CreateMaterializedCollection(ClientContext &context,
+	                                                                                vector<LogicalType> types);
+
 public:
 	//! The types of columns in the ColumnDataCollection
 	DUCKDB_API vector<LogicalType> &Types() {
@@ -106,6 +111,8 @@ public:
 
 	//! Returns the number of data chunks present in the ColumnDataCollection
 	DUCKDB_API idx_t ChunkCount() const;
+	//! The total size of the memory held by the collection
+	DUCKDB_API idx_t SizeInBytes() const;
 	//! Fetch an individual chunk from the ColumnDataCollection
 	DUCKDB_API void FetchChunk(idx_t chunk_idx, DataChunk &result) const;
 
@@ -58,10 +58,16 @@ struct VectorMetaData {
 struct ChunkMetaData {
 	//! The set of vectors of the chunk
 	vector<VectorDataIndex> vector_data;
-	//! The block ids referenced by the chunk
-	unordered_set<uint32_t> block_ids;
+	//! The block ids referenced by the chunk (without duplicates). A chunk references very few blocks, for which a
+	//! vector is much cheaper to maintain than a set
+	vector<uint32_t> block_ids;
 	//! The number of entries in the chunk
 	uint16_t count;
+
+	//! Adds a block id to the block ids referenced by the chunk
+	void AddBlock(uint32_t block_id);
+	//! Whether or not the chunk references the given block id
+	bool HasBlock(uint32_t block_id) const;
 };
 
 class ColumnDataCollectionSegment {
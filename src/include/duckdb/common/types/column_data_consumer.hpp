@@ -21,6 +21,7 @@ struct ColumnDataConsumerScanState {
 };
 
 //! ColumnDataConsumer can scan a ColumnDataCollection, and consume it in the process, i.e., read blocks are deleted
+//! (unless "consume" is false, in which case the collection can be scanned again afterwards)
 class ColumnDataConsumer {
 public:
 	struct ChunkReference {
@@ -42,7 +43,7 @@ public:
 	};
 
 public:
-	ColumnDataConsumer(ColumnDataCollection &collection, vector<column_t> column_ids);
+	ColumnDataConsumer(ColumnDataCollection &collection, vector<column_t> column_ids, bool consume = true);
 
 	idx_t ChunkCount() const {
 		return chunk_count;
@@ -67,6 +68,8 @@ private:
 	ColumnDataCollection &collection;
 	//! The column ids to scan
 	vector<column_t> column_ids;
+	//! Whether read blocks are deleted
+	const bool consume;
 	//! The number of chunk references
 	idx_t chunk_count;
 	//! The chunks (in order) to be scanned
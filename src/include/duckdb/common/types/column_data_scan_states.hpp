@@ -30,7 +30,11 @@ enum class ColumnDataScanProperties : uint8_t {
 	ALLOW_ZERO_COPY,
 	//! Disallow zero-copy scans, always copying data into the target vector
 	//! As a result, data scanned will be valid even after the column data collection is destroyed
-	DISALLOW_ZERO_COPY
+	DISALLOW_ZERO_COPY,
+	//! Allow zero copy scans only where the resulting vector can keep the memory it points to alive (i.e. for
+	//! fixed-size types, if the allocator supports it), and copy otherwise
+	//! As with DISALLOW_ZERO_COPY, data scanned will be valid even after the column data collection is destroyed
+	KEEP_ALIVE_ZERO_COPY
 };
 
 struct ChunkManagementState {
@@ -38,6 +38,12 @@ hash_t Hash(T value) {
 	return murmurhash32(value);
 }
 
+//! Hashes a string that is short enough to be inlined from its inlined representation, which consists of two words:
+//! the length and the first characters, followed by the remaining characters (zero-padded)
+inline hash_t HashInlinedString(uint64_t header, uint64_t tail) {
+	return murmurhash64(header ^ murmurhash64(tail));
+}
+
 //! Combine two hashes by XORing them
 inline hash_t CombineHash(hash_t left, hash_t right) {
 	return left ^ right;
@@ -45,6 +45,10 @@ public:
 	//! (De)Serialize the HLL
 	void Serialize(FieldWriter &writer) const;
 	static unique_ptr<HyperLogLog> Deserialize(FieldReader &reader);
+	//! Write the HLL to a blob in the result vector, so it can be stored and merged later
+	string_t ToBlob(Vector &result) const;
+	//! Read a HLL from a blob that was created with ToBlob, throws an InvalidInputException if it is not a sketch
+	static unique_ptr<HyperLogLog> FromBlob(const string_t &blob);
 
 public:
 	//! Compute HLL hashes over vdata, and store them in 'hashes'
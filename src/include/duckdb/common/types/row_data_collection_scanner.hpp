@@ -50,6 +50,10 @@ public:
 	RowDataCollectionScanner(RowDataCollection &rows, RowDataCollection &heap, const RowLayout &layout, bool external,
 	                         bool flush = true);
 
+	//! Scans a single row block, so that multiple threads can scan (disjoint blocks of) the same collection
+	RowDataCollectionScanner(RowDataCollection &rows, RowDataCollection &heap, const RowLayout &layout, bool external,
+	                         idx_t block_idx, bool flush);
+
 	//! The type layout of the payload
 	inline const vector<LogicalType> &GetTypes() const {
 		return layout.GetTypes();
@@ -101,6 +105,10 @@ private:
 	const bool flush;
 	//! Whether we are unswizzling the blocks
 	const bool unswizzling;
+	//! The first block that is scanned
+	const idx_t block_begin;
+	//! The block after the last block that is scanned
+	const idx_t block_end;
 
 	//! Checks that the newest block is valid
 	void ValidateUnscannedBlock() const;
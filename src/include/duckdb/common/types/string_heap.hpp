@@ -22,6 +22,8 @@ public:
 
 	void Destroy();
 	void Move(StringHeap &other);
+	//! Removes all strings from the heap, keeping (only) the most recently allocated block of memory for reuse
+	void Reset();
 
 	//! Add a string to the string heap, returns a pointer to the string
 	string_t AddString(const char *data, idx_t len);
@@ -37,6 +39,8 @@ public:
 	string_t AddBlob(const char *data, idx_t len);
 	//! Allocates space for an empty string of size "len" on the heap
 	string_t EmptyString(idx_t len);
+	//! The total size of the memory allocated by the heap
+	idx_t SizeInBytes() const;
 
 private:
 	ArenaAllocator allocator;
@@ -281,6 +281,12 @@ struct FlatVector {
 		D_ASSERT(vector.GetVectorType() == VectorType::FLAT_VECTOR);
 		vector.data = data;
 	}
+	//! Sets the data of the vector to memory that is kept alive by the given buffer
+	static inline void SetData(Vector &vector, data_ptr_t data, buffer_ptr<VectorBuffer> buffer) {
+		D_ASSERT(vector.GetVectorType() == VectorType::FLAT_VECTOR);
+		vector.data = data;
+		vector.buffer = move(buffer);
+	}
 	template <class T>
 	static inline T GetValue(Vector &vector, idx_t idx) {
 		D_ASSERT(vector.GetVectorType() == VectorType::FLAT_VECTOR);
@@ -29,7 +29,8 @@ enum class VectorBufferType : uint8_t {
 	STRUCT_BUFFER,       // struct buffer, holds a ordered mapping from name to child vector
 	LIST_BUFFER,         // list buffer, holds a single flatvector child
 	MANAGED_BUFFER,      // managed buffer, holds a buffer managed by the buffermanager
-	OPAQUE_BUFFER        // opaque buffer, can be created for example by the parquet reader
+	OPAQUE_BUFFER,       // opaque buffer, can be created for example by the parquet reader
+	SHARED_BUFFER        // shared buffer, keeps immutable memory that is owned by another object alive
 };
 
 enum class VectorAuxiliaryDataType : uint8_t {
@@ -153,6 +154,16 @@ public:
 		references.push_back(move(heap));
 	}
 
+	//! Removes all strings and heap references from the buffer, so its memory can be reused for a new vector
+	void Reset() {
+		heap.Reset();
+		references.clear();
+	}
+	//! The size of the memory allocated by the string heap
+	idx_t SizeInBytes() const {
+		return heap.SizeInBytes();
+	}
+
 private:
 	//! The string heap of this buffer
 	StringHeap heap;
@@ -228,6 +239,21 @@ private:
 	unique_ptr<Vector> child;
 };
 
+//! The SharedVectorBuffer keeps immutable memory alive that a flat vector points to, but that is owned by another
+//! object (e.g. the allocator of a ColumnDataCollection). The data of such vectors can be exported without copying.
+class SharedVectorBuffer : public VectorBuffer {
+public:
+	explicit SharedVectorBuffer(shared_ptr<void> owner_p, BufferHandle handle_p = BufferHandle())
+	    : VectorBuffer(VectorBufferType::SHARED_BUFFER), owner(move(owner_p)), handle(move(handle_p)) {
+	}
+
+private:
+	//! The owner of the memory
+	shared_ptr<void> owner;
+	//! The pin of the memory, if it is managed by the buffer manager
+	BufferHandle handle;
+};
+
 //! The ManagedVectorBuffer holds a buffer handle
 class ManagedVectorBuffer : public VectorBuffer {
 public:
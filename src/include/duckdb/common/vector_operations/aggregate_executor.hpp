@@ -352,6 +352,29 @@ public:
 		                                                    frame, prev, result, rid, bias);
 	}
 
+	//! Moves an invertible window aggregate from the previous frame to the current one, by calling remove for the row
+	//! ranges that left the frame and add for the ranges that entered it. Returns false without calling either if the
+	//! frames do not overlap, or if moving the frame touches more rows than computing it from scratch.
+	template <class ADD, class REMOVE>
+	static bool SlideFrame(const FrameBounds &frame, const FrameBounds &prev, ADD &&add, REMOVE &&remove) {
+		const auto overlap_begin = MaxValue(frame.first, prev.first);
+		const auto overlap_end = MinValue(frame.second, prev.second);
+		if (overlap_begin >= overlap_end) {
+			return false;
+		}
+		const auto overlap = overlap_end - overlap_begin;
+		const auto frame_size = frame.second - frame.first;
+		const auto prev_size = prev.second - prev.first;
+		if ((frame_size - overlap) + (prev_size - overlap) > frame_size) {
+			return false;
+		}
+		remove(prev.first, overlap_begin);
+		remove(overlap_end, prev.second);
+		add(frame.first, overlap_begin);
+		add(overlap_end, frame.second);
+		return true;
+	}
+
 	template <class STATE_TYPE, class OP>
 	static void Destroy(Vector &states, idx_t count) {
 		auto sdata = FlatVector::GetData<STATE_TYPE *>(states);
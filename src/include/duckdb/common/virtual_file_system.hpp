@@ -26,6 +26,10 @@ public:
 		handle.file_system.Read(handle, buffer, nr_bytes, location);
 	};
 
+	void ReadRanges(FileHandle &handle, const vector<FileReadRange> &ranges) override {
+		handle.file_system.ReadRanges(handle, ranges);
+	}
+
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override {
 		handle.file_system.Write(handle, buffer, nr_bytes, location);
 	}
@@ -56,6 +60,10 @@ public:
 		handle.file_system.FileSync(handle);
 	}
 
+	void Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes) override {
+		handle.file_system.Prefetch(handle, location, nr_bytes);
+	}
+
 	// need to look up correct fs for this
 	bool DirectoryExists(const string &directory) override {
 		return FindFileSystem(directory)->DirectoryExists(directory);
@@ -8,30 +8,75 @@
 
 #pragma once
 
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/planner/expression/list.hpp"
 
-#include <random>
 namespace duckdb {
 
+//! The runtime statistics of a single filter
+struct FilterRuntimeStatistics {
+	FilterRuntimeStatistics() : tuple_count(0), eliminated_count(0), runtime(0) {
+	}
+
+	//! The amount of tuples the filter was evaluated on
+	idx_t tuple_count;
+	//! The amount of tuples that were decided by the filter, i.e. that no longer need to be evaluated by the
+	//! filters after it
+	idx_t eliminated_count;
+	//! The total runtime of the filter (in seconds)
+	double runtime;
+
+public:
+	void Merge(const FilterRuntimeStatistics &other) {
+		tuple_count += other.tuple_count;
+		eliminated_count += other.eliminated_count;
+		runtime += other.runtime;
+	}
+	//! The expected cost of the filter per tuple that it decides, filters with a lower rank are evaluated first
+	double GetRank() const;
+};
+
+//! The runtime statistics of a set of filters that are shared between all threads that evaluate these filters
+struct AdaptiveFilterStatistics {
+	mutex lock;
+	vector<FilterRuntimeStatistics> filters;
+};
+
+//! AdaptiveFilter reorders a set of filters at runtime, based on how expensive every filter is and how many tuples it
+//! eliminates
 class AdaptiveFilter {
 public:
 	explicit AdaptiveFilter(const Expression &expr);
-	explicit AdaptiveFilter(TableFilterSet *table_filters);
-	void AdaptRuntimeStatistics(double duration);
+	explicit AdaptiveFilter(TableFilterSet *table_filters, shared_ptr<AdaptiveFilterStatistics> shared_statistics);
+
+	//! The order in which the filters are evaluated (indexes of the conjunction children, or table filter columns)
 	vector<idx_t> permutation;
 
+public:
+	//! Adds the runtime statistics of the filter at position 'idx' of the permutation
+	void AddFilterRuntime(idx_t idx, idx_t tuple_count, idx_t eliminated_count, double runtime);
+	//! Should be called after all filters have been evaluated for a chunk, periodically reorders the filters
+	void AdaptRuntimeStatistics();
+
 private:
-	//! used for adaptive expression reordering
+	//! The amount of chunks after which the filters are reordered
+	static constexpr const idx_t ADAPT_INTERVAL = 8;
+	//! The amount of tuples after which old statistics are decayed, so the order adapts to changes in the data
+	static constexpr const idx_t DECAY_TUPLE_COUNT = 1048576;
+
+	//! The filter identifiers in their original order
+	vector<idx_t> filter_ids;
+	//! The positions (in filter_ids) of the filters in the order in which they are evaluated
+	vector<idx_t> order;
+	//! The runtime statistics gathered since the filters were last reordered, by position in filter_ids
+	vector<FilterRuntimeStatistics> local_statistics;
+	//! The runtime statistics of all previous evaluations, by position in filter_ids
+	vector<FilterRuntimeStatistics> statistics;
+	//! The statistics shared with the other threads (if any)
+	shared_ptr<AdaptiveFilterStatistics> shared_statistics;
 	idx_t iteration_count;
-	idx_t swap_idx;
-	idx_t right_random_border;
-	idx_t observe_interval;
-	idx_t execute_interval;
-	double runtime_sum;
-	double prev_mean;
-	bool observe;
-	bool warmup;
-	vector<idx_t> swap_likeliness;
-	std::default_random_engine generator;
+
+private:
+	void Initialize();
 };
 } // namespace duckdb
@@ -88,6 +88,9 @@ public:
 	idx_t AddChunk(DataChunk &groups, DataChunk &payload, const vector<idx_t> &filter);
 	idx_t AddChunk(DataChunk &groups, Vector &group_hashes, DataChunk &payload, const vector<idx_t> &filter);
 	idx_t AddChunk(DataChunk &groups, DataChunk &payload, AggregateType filter);
+	//! Add every row of the given data as a new entry, without looking for existing groups. Only possible once the
+	//! HT is finalized: the duplicate groups are merged when the HT is combined into another one.
+	idx_t AppendChunk(DataChunk &groups, Vector &group_hashes, DataChunk &payload, const vector<idx_t> &filter);
 
 	//! Scan the HT starting from the scan_position until the result and group
 	//! chunks are filled. scan_position will be updated by this function.
@@ -118,6 +121,13 @@ public:
 
 	void Finalize();
 
+	//! Whether the payload of the HT can be unpinned. This requires the HT to be finalized (so there are no pointers
+	//! into the payload left), and the groups to be fixed-size (so the payload has no pointers into the string heap).
+	bool CanUnpin() const;
+	//! Unpin the payload blocks, so the buffer manager can spill them to disk while the HT waits to be combined or
+	//! scanned. The blocks are pinned again the next time the HT is used.
+	void Unpin();
+
 private:
 	HtEntryType entry_type;
 
@@ -133,6 +143,8 @@ private:
 	//! The data of the HT
 	vector<BufferHandle> payload_hds;
 	vector<data_ptr_t> payload_hds_ptrs;
+	//! The payload blocks, while they are unpinned
+	vector<shared_ptr<BlockHandle>> unpinned_blocks;
 
 	//! The hashes of the HT
 	BufferHandle hashes_hdl;
@@ -168,7 +180,11 @@ private:
 	void Verify();
 
 	void FlushMove(FlushMoveState &state, Vector &source_addresses, Vector &source_hashes, idx_t count);
+	//! Update the aggregate states at the given addresses (which point to the first aggregate) with the payload
+	void UpdateAggregates(Vector &addresses, DataChunk &payload, const vector<idx_t> &filter);
 	void NewBlock();
+	//! Pin the payload blocks again after they were unpinned
+	void Pin();
 
 	template <class ENTRY>
 	void VerifyInternal();
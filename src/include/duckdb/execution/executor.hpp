@@ -13,6 +13,7 @@
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/unordered_map.hpp"
+#include "duckdb/parallel/execution_trace.hpp"
 #include "duckdb/parallel/pipeline.hpp"
 
 namespace duckdb {
@@ -70,8 +71,9 @@ public:
 	//! Flush a thread context into the client context
 	void Flush(ThreadContext &context);
 
-	//! Returns the progress of the pipelines
-	bool GetPipelinesProgress(double &current_progress);
+	//! Returns the progress of the query (in percent), in which the pipelines are weighted by their estimated
+	//! cardinality, together with the amount of rows the pipelines have processed and are estimated to process
+	double GetPipelinesProgress(idx_t &rows_processed, idx_t &total_rows);
 
 	void CompletePipeline() {
 		completed_pipelines++;
@@ -88,6 +90,18 @@ public:
 	bool HasResultCollector();
 	//! Returns the query result - can only be used if `HasResultCollector` returns true
 	unique_ptr<QueryResult> GetResult();
+	//! Whether or not the result collector streams the result while the query is executed in parallel
+	bool HasStreamingResultCollector();
+
+	//! The amount of rows produced by the table scans of the query
+	atomic<idx_t> rows_scanned;
+	//! The CPU time spent by all threads on the tasks of the query (in nanoseconds)
+	atomic<uint64_t> cpu_time;
+
+	//! Returns the trace of the execution, or nullptr if the execution is not traced
+	ExecutionTrace *GetTrace() {
+		return trace.get();
+	}
 
 private:
 	void InitializeInternal(PhysicalOperator *physical_plan);
@@ -144,5 +158,10 @@ private:
 	PendingExecutionResult execution_result;
 	//! The current task in process (if any)
 	unique_ptr<Task> task;
+
+	//! The trace of the threads executing the query (if enabled)
+	unique_ptr<ExecutionTrace> trace;
+	//! The time at which the thread driving the query started waiting for a task (if it is waiting)
+	uint64_t trace_wait_start;
 };
 } // namespace duckdb
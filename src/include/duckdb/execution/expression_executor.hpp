@@ -52,6 +52,9 @@ public:
 	inline void Execute(DataChunk &result) {
 		Execute(nullptr, result);
 	}
+	//! Execute the set of expressions for the rows of the input chunk in the selection vector only, the result has
+	//! 'count' rows
+	DUCKDB_API void Execute(DataChunk &input, const SelectionVector &sel, idx_t count, DataChunk &result);
 
 	//! Execute the ExpressionExecutor and put the result in the result vector; this should only be used for expression
 	//! executors with a single expression
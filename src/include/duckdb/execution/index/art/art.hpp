@@ -79,6 +79,8 @@ public:
 	bool Append(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
 	//! Verify that data can be appended to the index
 	void VerifyAppend(DataChunk &chunk) override;
+	//! Verify that data can be appended to the index, storing an error message for every conflicting row
+	void VerifyAppend(DataChunk &chunk, string *err_msg_ptr) override;
 	//! Verify that data can be appended to the index for foreign key constraint
 	void VerifyAppendForeignKey(DataChunk &chunk, string *err_msg_ptr) override;
 	//! Verify that data can be delete from the index for foreign key constraint
@@ -88,13 +90,20 @@ public:
 	//! Insert data into the index.
 	bool Insert(IndexLock &lock, DataChunk &data, Vector &row_ids) override;
 
+	//! The number of sorted keys from which ConstructAndMerge builds an ART at once
+	static constexpr idx_t CONSTRUCT_BATCH_SIZE = STANDARD_VECTOR_SIZE * 128;
 	//! Construct ARTs from sorted chunks and merge them.
 	void ConstructAndMerge(IndexLock &lock, PayloadScanner &scanner, Allocator &allocator) override;
 
 	//! Search Equal and fetches the row IDs
 	bool SearchEqual(Key &key, idx_t max_count, vector<row_t> &result_ids);
+	//! Collect the row ids of the smallest (or, if descending, the largest) keys in key order, until at least
+	//! max_count row ids are collected. Returns false if the index contains fewer than max_count row ids
+	bool ScanOrdered(bool descending, idx_t max_count, vector<row_t> &result_ids);
 	//! Search Equal used for Joins that do not need to fetch data
 	void SearchEqualJoinNoFetch(Key &key, idx_t &result_size);
+	//! Search the row ids of all keys that satisfy "key <comparison> indexed key", used for range index joins
+	void SearchRangeJoin(Key &key, ExpressionType comparison, vector<row_t> &result_ids);
 	//! Serialized the ART
 	BlockPointer Serialize(duckdb::MetaBlockWriter &writer) override;
 
@@ -104,6 +113,9 @@ public:
 	static void GenerateKeys(ArenaAllocator &allocator, DataChunk &input, vector<Key> &keys);
 	//! Returns the string representation of an ART
 	string ToString() override;
+	//! Reserve the memory of key_count keys in the buffer manager, so that the index is counted against the
+	//! memory limit. Used for inserted and constructed keys, and for leaves that are loaded from storage
+	void ReserveKeyMemory(idx_t key_count);
 
 private:
 	//! Insert a row id into a leaf node
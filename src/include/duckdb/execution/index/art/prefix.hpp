@@ -13,7 +13,9 @@
 
 namespace duckdb {
 class Prefix {
-	static constexpr idx_t PREFIX_INLINE_BYTES = 8;
+	//! Prefixes of up to 16 bytes are stored inline. The bytes are not pointer-aligned, so the prefix fills the
+	//! padding after the header of a node and inlining them does not increase the node size
+	static constexpr idx_t PREFIX_INLINE_BYTES = 16;
 
 public:
 	Prefix();
@@ -56,13 +58,13 @@ public:
 
 private:
 	uint32_t size;
-	union {
-		uint8_t *ptr;
-		uint8_t inlined[8];
-	} value;
+	//! The inlined prefix, or the pointer to the prefix data if the prefix is not inlined
+	uint8_t value[PREFIX_INLINE_BYTES];
 
 private:
 	bool IsInlined() const;
+	uint8_t *GetPointer() const;
+	void SetPointer(uint8_t *ptr);
 	uint8_t *AllocatePrefix(uint32_t size);
 	void Overwrite(uint32_t new_size, uint8_t *data);
 	void Destroy();
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/join_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! JoinBloomFilter is a blocked Bloom filter over the hashes of the build-side keys of a hash join
+/*!
+   The filter is filled while the pointer table of the JoinHashTable is constructed, and is checked by a table scan
+   on the probe side of the join, so rows that cannot find a match are thrown away before they flow through the
+   rest of the pipeline. Every hash sets three bits in a single 64-bit word, so a lookup touches one cache line.
+*/
+class JoinBloomFilter {
+public:
+	//! Bits that are reserved per build-side key (rounded up to a power of two)
+	static constexpr const idx_t BITS_PER_KEY = 16;
+
+	explicit JoinBloomFilter(vector<idx_t> probe_columns);
+
+	//! The output columns of the probe-side scan that hold the equality keys of the join (in condition order)
+	const vector<idx_t> probe_columns;
+
+public:
+	//! Allocate (and clear) the filter so that it can hold the given number of keys
+	void Initialize(Allocator &allocator, idx_t count);
+	//! Insert the given hashes, may be called concurrently by multiple threads
+	void Insert(const hash_t hashes[], idx_t count);
+	//! Marks the filter as complete, after which it can be used to filter the probe side
+	void SetReady();
+	//! Marks the filter as incomplete, e.g., because the plan is executed again
+	void Reset();
+	//! Whether the filter holds the hashes of the entire build side
+	bool IsReady() const {
+		return ready;
+	}
+
+	//! Check the hashes of the (selected) rows against the filter, returns the number of rows that might match
+	idx_t Filter(Vector &hashes, const SelectionVector &sel, idx_t count, SelectionVector &result) const;
+
+private:
+	static inline uint64_t GetMask(hash_t hash) {
+		return (uint64_t(1) << (hash & 63)) | (uint64_t(1) << ((hash >> 6) & 63)) |
+		       (uint64_t(1) << ((hash >> 12) & 63));
+	}
+	inline idx_t GetWord(hash_t hash) const {
+		return (hash >> 32) & word_mask;
+	}
+
+	//! The words of the filter
+	AllocatedData data;
+	//! Bitmask for getting the word from the (upper bits of the) hash
+	idx_t word_mask;
+	//! Whether the filter is complete
+	atomic<bool> ready;
+};
+
+} // namespace duckdb
@@ -17,6 +17,7 @@
 #include "duckdb/common/types/row_layout.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/execution/join_bloom_filter.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
@@ -192,6 +193,17 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! For a partitioned build, the radix bits of the hash select the sub-table of the pointer table
+	idx_t partition_shift;
+	uint64_t partition_mask;
+	//! Hashes of the build-side keys that occur so often that they get their own chain outside of the buckets
+	vector<hash_t> heavy_hitters;
+	//! Bitmask of the slots in heavy_hitters that are in use
+	uint64_t heavy_hitter_mask;
+	//! The index of the first heavy hitter chain in the pointer table (after all buckets)
+	idx_t heavy_hitter_offset;
+	//! Bloom filter that is filled with the hashes of the build side during Finalize (if any)
+	shared_ptr<JoinBloomFilter> bloom_filter;
 
 	struct {
 		mutex mj_lock;
@@ -217,6 +229,18 @@ private:
 	//! Apply a bitmask to the hashes
 	void ApplyBitmask(Vector &hashes, idx_t count);
 	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
+	//! Get the index in the pointer table of the chain for the given hash
+	inline idx_t GetPointerTableIndex(hash_t hash) const {
+		if (heavy_hitter_mask != 0) {
+			const auto slot = (hash >> HEAVY_HITTER_SHIFT) & (HEAVY_HITTER_SLOTS - 1);
+			if ((heavy_hitter_mask >> slot) & 1 && heavy_hitters[slot] == hash) {
+				return heavy_hitter_offset + slot;
+			}
+		}
+		return (hash & bitmask) | ((hash >> partition_shift) & partition_mask);
+	}
+	//! Sample the hashes of the build side and give the most frequent ones their own chain
+	void DetectHeavyHitters(idx_t capacity);
 
 private:
 	//! Insert the given set of locations into the HT with the given set of hashes
@@ -323,6 +347,40 @@ public:
 		return MaxValue<idx_t>(NextPowerOfTwo(count * 2), 1 << 10);
 	}
 
+	//===--------------------------------------------------------------------===//
+	// Partitioned Build
+	//===--------------------------------------------------------------------===//
+	//! Number of tuples from which on the build side is radix partitioned
+	static constexpr const idx_t PARTITIONED_BUILD_THRESHOLD = 1048576;
+	//! Number of entries that the pointer table of a single partition should hold (i.e., 256KB, fits in L2 cache)
+	static constexpr const idx_t PARTITIONED_BUILD_SUB_TABLE_CAPACITY = 32768;
+
+	//! Decides whether the build side with the given count is radix partitioned, and sets the number of radix bits
+	bool PreparePartitionedBuild(ClientConfig &config, idx_t count);
+	//! Moves the radix partitions back into this HT so they can be inserted into their sub-table one by one
+	void PreparePartitionedFinalize();
+	//! Whether the build side is radix partitioned, with every partition inserted into its own sub-table
+	bool PartitionedBuild() const {
+		return !partition_block_offsets.empty();
+	}
+	//! The first block of each partition in the block collection (for a partitioned build)
+	const vector<idx_t> &GetPartitionBlockOffsets() const {
+		return partition_block_offsets;
+	}
+
+	//===--------------------------------------------------------------------===//
+	// Heavy Hitters
+	//===--------------------------------------------------------------------===//
+	//! Number of tuples from which on the build side is checked for heavy hitters
+	static constexpr const idx_t HEAVY_HITTER_MIN_COUNT = 262144;
+	//! Number of build-side hashes that are sampled to detect heavy hitters
+	static constexpr const idx_t HEAVY_HITTER_SAMPLE_SIZE = 4096;
+	//! A hash that occurs this many times in the sample is a heavy hitter
+	static constexpr const idx_t HEAVY_HITTER_THRESHOLD = 64;
+	//! Number of heavy hitter chains at the end of the pointer table, and the hash bits that select one
+	static constexpr const idx_t HEAVY_HITTER_SLOTS = 64;
+	static constexpr const idx_t HEAVY_HITTER_SHIFT = 40;
+
 	//! Swizzle the blocks in this HT (moves from block_collection and string_heap to swizzled_...)
 	void SwizzleBlocks();
 	//! Unswizzle the blocks in this HT (moves from swizzled_... to block_collection and string_heap)
@@ -337,11 +395,18 @@ public:
 	void Reset();
 	//! Build HT for the next partitioned probe round
 	bool PrepareExternalFinalize();
+	//! Whether the last partition of the current round did not fit, and the rest of it is built in the next round(s)
+	bool PartitionIncomplete() const {
+		return partition_end != 0 && partition_block_collections[partition_end - 1];
+	}
 	//! Probe whatever we can, sink the rest into a thread-local HT
 	unique_ptr<ScanStructure> ProbeAndSpill(DataChunk &keys, DataChunk &payload, ProbeSpill &probe_spill,
 	                                        ProbeSpillLocalAppendState &spill_state, DataChunk &spill_chunk);
 
 private:
+	//! Moves (at least one) blocks of a partition with up to max_count tuples to the swizzled_... collections
+	idx_t MovePartitionBlocks(idx_t partition_idx, idx_t max_count);
+
 	//! First and last partition of the current probe round
 	idx_t partition_start;
 	idx_t partition_end;
@@ -354,6 +419,8 @@ private:
 	mutex partitioned_data_lock;
 	vector<unique_ptr<RowDataCollection>> partition_block_collections;
 	vector<unique_ptr<RowDataCollection>> partition_string_heaps;
+	//! Block offsets of the partitions, with one extra entry marking the end (only for a partitioned build)
+	vector<idx_t> partition_block_offsets;
 };
 
 } // namespace duckdb
@@ -0,0 +1,125 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/materialized_view.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+class ClientContext;
+class ColumnDataCollection;
+class DataTable;
+class GroupedAggregateHashTable;
+class SelectStatement;
+class Transaction;
+class ViewCatalogEntry;
+struct DataTableInfo;
+
+//! MaterializedViewData holds the contents of a materialized view of the form
+//! SELECT ... FROM tbl [WHERE ...] GROUP BY ... [HAVING ...]
+/*!
+   The view keeps the aggregate states of its groups in a hash table. The rows that committed transactions append to
+   the table are recorded, and are aggregated into a separate hash table that is combined into the states of the view
+   the next time it is read. Deletes and updates of the table (and failed incremental maintenance) mark the view as
+   stale, in which case the states are recomputed from a scan of the table.
+*/
+class MaterializedViewData {
+public:
+	~MaterializedViewData();
+
+	//! Binds the query of a materialized view, throws a BinderException if it cannot be maintained incrementally
+	static shared_ptr<MaterializedViewData> Bind(ClientContext &context, SelectStatement &query);
+	//! Returns the data of the materialized view, (re)binding it if the table it reads was created or altered
+	static shared_ptr<MaterializedViewData> Get(ClientContext &context, ViewCatalogEntry &view);
+	//! The table function that scans the contents of a materialized view
+	static TableFunction GetScanFunction();
+	static unique_ptr<FunctionData> GetScanData(shared_ptr<MaterializedViewData> view);
+
+	//! Returns the contents of the view as seen by the current transaction of the client context
+	shared_ptr<ColumnDataCollection> GetResult(ClientContext &context);
+
+	//! Records that a transaction committed the rows [row_start, row_start + count) to the table
+	static void CommitAppend(DataTableInfo &info, transaction_t commit_id, idx_t row_start, idx_t count);
+	//! Reverts CommitAppend when the commit fails
+	static void RevertAppend(DataTableInfo &info, idx_t row_start, idx_t count);
+	//! Marks the views of the table as stale because a transaction committed a delete or update to it
+	static void Invalidate(DataTableInfo &info, transaction_t commit_id);
+
+	//! A filter or projection that is applied to the input or the output of the aggregate
+	struct MaterializedViewStep {
+		//! The (single) filter expression, or the projection list
+		vector<unique_ptr<Expression>> expressions;
+		bool is_filter;
+		//! The output types of the projection
+		vector<LogicalType> types;
+	};
+
+private:
+	struct AppendedRows {
+		transaction_t commit_id;
+		idx_t row_start;
+		idx_t count;
+	};
+	struct SinkState;
+
+	MaterializedViewData() = default;
+	unique_ptr<GroupedAggregateHashTable> CreateHashTable(ClientContext &context);
+	void InitializeSink(ClientContext &context, SinkState &state);
+	void Sink(SinkState &state, DataChunk &input, GroupedAggregateHashTable &ht);
+	//! Aggregates the rows of the table that are visible to the transaction
+	unique_ptr<GroupedAggregateHashTable> ComputeStates(ClientContext &context, Transaction &transaction);
+	//! Aggregates the appended rows into the states of the view
+	void ApplyAppends(ClientContext &context, const vector<AppendedRows> &appends);
+	//! Finalizes the aggregate states and computes the contents of the view
+	shared_ptr<ColumnDataCollection> ComputeResult(ClientContext &context, GroupedAggregateHashTable &ht);
+
+private:
+	//! The table the view is computed from
+	weak_ptr<DataTable> storage;
+	weak_ptr<DataTableInfo> table_info;
+	//! The (storage) columns that are read from the table
+	vector<column_t> column_ids;
+	vector<LogicalType> scan_types;
+	//! The filters and projections between the scan and the aggregate
+	vector<MaterializedViewStep> input_steps;
+	//! The groups (empty for an ungrouped aggregate) and the aggregates of the view
+	vector<unique_ptr<Expression>> groups;
+	vector<unique_ptr<Expression>> aggregates;
+	vector<LogicalType> group_types;
+	//! The inputs of the aggregates
+	vector<unique_ptr<Expression>> payload_expressions;
+	vector<LogicalType> payload_types;
+	//! The filters and projections that compute the view from the groups and aggregates
+	vector<MaterializedViewStep> output_steps;
+	//! The types of the view
+	vector<LogicalType> types;
+
+	//! Lock held while the states or the result are computed
+	mutex lock;
+	//! The aggregate states of the view
+	unique_ptr<GroupedAggregateHashTable> ht;
+	//! The finalized contents of the view (if computed)
+	shared_ptr<ColumnDataCollection> result;
+	//! The states contain exactly the rows that are visible to transactions that start at state_time
+	transaction_t state_time = 0;
+
+	//! Lock protecting the appends and invalidations recorded by committing transactions
+	mutex append_lock;
+	//! The appends that are not aggregated into the states yet
+	vector<AppendedRows> appends;
+	//! Whether the states have to be recomputed from the table
+	bool stale = true;
+	//! The last commit that marked the view as stale
+	transaction_t stale_commit_id = 0;
+};
+
+} // namespace duckdb
@@ -13,8 +13,13 @@
 
 namespace duckdb {
 
-//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause)
+//! PhysicalStreamingWindow implements streaming window functions, i.e. functions without PARTITION BY that are
+//! evaluated in the order of the input (either without ORDER BY, or if the input is already sorted)
 class PhysicalStreamingWindow : public PhysicalOperator {
+public:
+	//! The maximum number of previous rows that LAG and sliding frames can read
+	static constexpr const idx_t MAX_STREAMING_OFFSET = STANDARD_VECTOR_SIZE;
+
 public:
 	PhysicalStreamingWindow(vector<LogicalType> types, vector<unique_ptr<Expression>> select_list,
 	                        idx_t estimated_cardinality,
@@ -17,6 +17,7 @@
 #include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
+class DataTable;
 
 //! PhysicalUngroupedAggregate is an aggregate operator that can only perform aggregates (1) without any groups, (2)
 //! without any DISTINCT aggregates, and (3) when all aggregates are combineable
@@ -29,6 +30,11 @@ public:
 	vector<unique_ptr<Expression>> aggregates;
 	unique_ptr<DistinctAggregateData> distinct_data;
 	unique_ptr<DistinctAggregateCollectionInfo> distinct_collection_info;
+	//! If set, the aggregates are MIN, MAX and COUNT(*) directly over a scan of this table, and are answered from the
+	//! table statistics instead if they are exact for the executing transaction
+	DataTable *statistics_table = nullptr;
+	//! The table column that each aggregate is computed over (or COLUMN_IDENTIFIER_ROW_ID for COUNT(*))
+	vector<column_t> statistics_columns;
 
 public:
 	// Source interface
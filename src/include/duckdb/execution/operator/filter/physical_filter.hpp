@@ -16,12 +16,27 @@ namespace duckdb {
 //! PhysicalFilter represents a filter operator. It removes non-matching tuples
 //! from the result. Note that it does not physically change the data, it only
 //! adds a selection vector to the chunk.
+//! A projection on top of the filter can be fused into it, in which case the projection is only evaluated for the
+//! tuples that pass the filter and the filter emits the projected columns directly.
 class PhysicalFilter : public CachingPhysicalOperator {
 public:
 	PhysicalFilter(vector<LogicalType> types, vector<unique_ptr<Expression>> select_list, idx_t estimated_cardinality);
 
 	//! The filter expression
 	unique_ptr<Expression> expression;
+	//! The fused projection (if any), evaluated on the tuples that pass the filter
+	vector<unique_ptr<Expression>> projections;
+	//! Expressions that occur in both the filter and the fused projection. These are evaluated once before the
+	//! filter, and are referenced by the filter and projection as the columns following the input columns
+	vector<unique_ptr<Expression>> shared_expressions;
+
+public:
+	//! Whether or not a projection can be fused into this filter
+	bool CanFuseProjection() const {
+		return projections.empty();
+	}
+	//! Fuse a projection on top of this filter into the filter
+	void FuseProjection(vector<LogicalType> types, vector<unique_ptr<Expression>> select_list);
 
 public:
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
@@ -0,0 +1,59 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/helper/physical_arrow_collector.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+
+namespace duckdb {
+
+//! The PhysicalArrowCollector converts the result to Arrow arrays in the threads that produce it
+//! If insertion order is preserved, the arrays are put back in order using the batch indexes of the chunks
+class PhysicalArrowCollector : public PhysicalResultCollector {
+public:
+	PhysicalArrowCollector(PreparedStatementData &data, bool parallel, bool use_batch_index, idx_t batch_size);
+
+	//! Whether or not the collector is run in parallel
+	bool parallel;
+	//! Whether or not the arrays are ordered by the batch index
+	bool use_batch_index;
+	//! The (maximum) amount of rows in an array
+	idx_t batch_size;
+
+public:
+	//! Creates an Arrow collector for the prepared statement - can be used as ClientConfig::result_collector
+	static unique_ptr<PhysicalResultCollector> Create(ClientContext &context, PreparedStatementData &data,
+	                                                  idx_t batch_size);
+
+	unique_ptr<QueryResult> GetResult(GlobalSinkState &state) override;
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
+	                    DataChunk &input) const override;
+	void Combine(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          GlobalSinkState &gstate) const override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool RequiresBatchIndex() const override {
+		return use_batch_index;
+	}
+
+	bool IsSink() const override {
+		return true;
+	}
+
+	bool ParallelSink() const override {
+		return parallel;
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/helper/physical_buffered_collector.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+
+namespace duckdb {
+
+//! The PhysicalBufferedCollector is used for streaming results that are executed in parallel
+//! The worker threads keep executing the query and push their chunks into a bounded buffer, from which the client
+//! fetches the result. Threads block when the buffer is full. If insertion order is preserved, chunks are only handed
+//! out once no thread can produce chunks of a lower batch index anymore.
+class PhysicalBufferedCollector : public PhysicalResultCollector {
+public:
+	PhysicalBufferedCollector(PreparedStatementData &data, bool parallel, bool use_batch_index, idx_t capacity);
+
+	//! Whether or not the collector is run in parallel
+	bool parallel;
+	//! Whether or not the chunks are ordered by the batch index
+	bool use_batch_index;
+	//! The amount of rows that can be buffered before the producing threads block
+	idx_t capacity;
+
+public:
+	//! Creates a buffered collector for the prepared statement, sized after the streaming_buffer_size setting
+	static unique_ptr<PhysicalResultCollector> Create(ClientContext &context, PreparedStatementData &data);
+
+	unique_ptr<QueryResult> GetResult(GlobalSinkState &state) override;
+
+	bool IsStreaming() const override {
+		return true;
+	}
+	//! Fetches the next chunk of the result, or returns nullptr if no chunk can be handed out (yet)
+	unique_ptr<DataChunk> FetchChunk(GlobalSinkState &state) const;
+	//! Wakes up all blocked threads and makes them stop producing chunks
+	void Cancel(GlobalSinkState &state) const;
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
+	                    DataChunk &input) const override;
+	void Combine(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          GlobalSinkState &gstate) const override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool RequiresBatchIndex() const override {
+		return use_batch_index;
+	}
+
+	bool IsSink() const override {
+		return true;
+	}
+
+	bool ParallelSink() const override {
+		return parallel;
+	}
+};
+
+} // namespace duckdb
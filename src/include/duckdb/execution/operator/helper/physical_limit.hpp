@@ -55,6 +55,8 @@ public:
 		return true;
 	}
 
+	bool SinkFinished(GlobalSinkState &gstate, LocalSinkState &lstate) const override;
+
 public:
 	static bool ComputeOffset(ExecutionContext &context, DataChunk &input, idx_t &limit, idx_t &offset,
 	                          idx_t current_offset, idx_t &max_element, Expression *limit_expression,
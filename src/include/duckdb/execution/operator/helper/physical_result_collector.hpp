@@ -30,6 +30,10 @@ public:
 public:
 	//! The final method used to fetch the query result from this operator
 	virtual unique_ptr<QueryResult> GetResult(GlobalSinkState &state) = 0;
+	//! Whether or not the result is fetched from this operator while the query is still executing
+	virtual bool IsStreaming() const {
+		return false;
+	}
 
 	bool IsSink() const override {
 		return true;
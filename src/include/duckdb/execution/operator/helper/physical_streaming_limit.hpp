@@ -31,6 +31,7 @@ public:
 	unique_ptr<GlobalOperatorState> GetGlobalOperatorState(ClientContext &context) const override;
 	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+	bool OperatorFinished(GlobalOperatorState &gstate) const override;
 
 	bool IsOrderDependent() const override;
 	bool ParallelOperator() const override;
@@ -27,6 +27,8 @@ struct PerfectHashJoinStats {
 	bool is_build_small = false;
 	bool is_build_dense = false;
 	bool is_probe_in_domain = false;
+	//! Whether the join could use a perfect hash table, given a small enough range of build keys
+	bool is_join_eligible = false;
 	idx_t build_range = 0;
 	idx_t estimated_cardinality = 0;
 };
@@ -36,6 +38,9 @@ class PerfectHashJoinExecutor {
 	using PerfectHashTable = std::vector<Vector>;
 
 public:
+	//! The maximum range of build keys for which a perfect hash table is constructed
+	static constexpr const idx_t MAX_BUILD_SIZE = 1000000;
+
 	explicit PerfectHashJoinExecutor(const PhysicalHashJoin &join, JoinHashTable &ht, PerfectHashJoinStats pjoin_stats);
 
 public:
@@ -60,6 +65,11 @@ private:
 	                                       idx_t count);
 	bool FullScanHashTable(JoinHTScanState &state, LogicalType &key_type);
 
+	//! Compute the range of the keys in the build side, for joins where the statistics were not usable
+	bool ComputeBuildRange();
+	template <typename T>
+	bool TemplatedComputeBuildRange(Vector &source, idx_t count);
+
 private:
 	const PhysicalHashJoin &join;
 	JoinHashTable &ht;
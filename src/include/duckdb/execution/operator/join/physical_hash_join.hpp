@@ -43,6 +43,20 @@ public:
 	PerfectHashJoinStats perfect_join_statistics;
 	//! Whether we can go external (can't yet if recursive CTE)
 	bool can_go_external;
+	//! Bloom filter over the build-side keys that is pushed into the table scan on the probe side (if any)
+	shared_ptr<JoinBloomFilter> bloom_filter;
+	//! If the keys are build-side columns of another join on the probe side, the Bloom filter is pushed into the
+	//! build-side table scan of that join instead
+	PhysicalHashJoin *bloom_filter_target = nullptr;
+
+public:
+	//! Push a Bloom filter over the build-side keys into the table scan that is the source of the probe pipeline, or
+	//! into the table scan that builds bloom_filter_target
+	void PushDownBloomFilter(Pipeline &current, MetaPipeline &meta_pipeline);
+
+private:
+	//! Makes the build of bloom_filter_target wait until the hash table (and Bloom filter) of this join is built
+	void AddBuildDependency(MetaPipeline &meta_pipeline);
 
 public:
 	// Operator Interface
@@ -17,6 +17,7 @@
 namespace duckdb {
 
 //! PhysicalIndexJoin represents an index join between two tables
+//! Without an index, the join is a row id join: the keys of the LHS are row ids of the RHS table, which are fetched
 class PhysicalIndexJoin : public CachingPhysicalOperator {
 public:
 	PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
@@ -30,8 +31,8 @@ public:
 	vector<column_t> fetch_ids;
 	//! Types of fetch columns
 	vector<LogicalType> fetch_types;
-	//! Columns indexed by index
-	unordered_set<column_t> index_ids;
+	//! Columns indexed by index, mapped to their position in the index key
+	unordered_map<column_t, idx_t> index_ids;
 	//! Projected ids from LHS
 	vector<column_t> left_projection_map;
 	//! Projected ids from RHS
@@ -40,7 +41,7 @@ public:
 	vector<LogicalType> condition_types;
 	//! The types of all conditions
 	vector<LogicalType> build_types;
-	//! Index used for join
+	//! Index used for join, or nullptr if the keys are row ids
 	Index *index;
 
 	vector<JoinCondition> conditions;
@@ -61,7 +62,8 @@ protected:
 	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
 
 	bool IsOrderPreserving() const override {
-		return false;
+		// a row id join produces at most one row per LHS row, in the order of the LHS
+		return !index;
 	}
 
 public:
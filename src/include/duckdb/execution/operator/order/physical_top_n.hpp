@@ -11,6 +11,7 @@
 #include "duckdb/common/types/chunk_collection.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/bound_query_node.hpp"
+#include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
 
@@ -24,6 +25,10 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The boundary value of the first ORDER BY column is pushed into the table scan below (if any) as a filter
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The (scan) column the boundary filter applies to
+	idx_t dynamic_filter_column;
 
 public:
 	// Source interface
@@ -48,6 +53,11 @@ public:
 	}
 
 	string ParamsToString() const override;
+
+	//! Pushes the boundary value of the first ORDER BY column into the table scan that feeds this Top-N (if any)
+	void PushDownDynamicFilter();
+	//! Sets the boundary filter of the table scan to the given boundary value
+	void SetDynamicFilter(const Value &boundary) const;
 };
 
 } // namespace duckdb
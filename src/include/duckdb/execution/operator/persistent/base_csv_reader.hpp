@@ -51,6 +51,9 @@ public:
 	//! union_by_name option on insert_chunk may have more cols
 	vector<idx_t> insert_cols_idx;
 	vector<idx_t> insert_nulls_idx;
+	//! Whether the parse_chunk cols are not used by the query (empty if all cols are used), the values of these cols
+	//! are neither stored nor converted
+	vector<bool> skipped_cols;
 
 	idx_t linenr = 0;
 	bool linenr_estimated = false;
@@ -73,6 +76,8 @@ public:
 public:
 	//! Fill nulls into the cols that mismtach union names
 	void SetNullUnionCols(DataChunk &insert_chunk);
+	//! Sets the insert_chunk cols that are used by the query, the other cols are filled with nulls
+	void SetProjection(const vector<column_t> &column_ids);
 
 protected:
 	//! Initializes the parse_chunk with varchar columns and aligns info with new number of cols
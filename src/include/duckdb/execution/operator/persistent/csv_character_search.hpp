@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/persistent/csv_character_search.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/common.hpp"
+
+#include <cstring>
+
+namespace duckdb {
+
+//! CSVCharacterSearch finds the next occurrence of any of a small set of characters (e.g. delimiter and newlines)
+/*!
+   The buffer is scanned eight bytes at a time: every byte of a 64-bit word is compared against all characters at
+   once (SIMD within a register), so that long runs of ordinary characters are skipped without branching on every
+   byte. Only the word that contains a match, and the tail of the buffer, are inspected one byte at a time.
+*/
+class CSVCharacterSearch {
+public:
+	//! The maximum amount of characters that can be searched for at once
+	static constexpr const idx_t MAX_CHARACTERS = 4;
+
+	CSVCharacterSearch() : character_count(0) {
+		memset(is_special, 0, sizeof(is_special));
+	}
+
+	void AddCharacter(char c) {
+		auto byte = (uint8_t)c;
+		if (is_special[byte]) {
+			return;
+		}
+		D_ASSERT(character_count < MAX_CHARACTERS);
+		is_special[byte] = true;
+		patterns[character_count++] = 0x0101010101010101ULL * byte;
+	}
+
+	//! Returns the position of the first searched character in buffer[position, end), or end if there is none
+	idx_t Find(const char *buffer, idx_t position, idx_t end) const {
+		while (position + sizeof(uint64_t) <= end) {
+			uint64_t word;
+			memcpy(&word, buffer + position, sizeof(uint64_t));
+			uint64_t matches = 0;
+			for (idx_t i = 0; i < character_count; i++) {
+				matches |= ZeroBytes(word ^ patterns[i]);
+			}
+			if (matches != 0) {
+				// the match is found by the byte-wise loop below
+				break;
+			}
+			position += sizeof(uint64_t);
+		}
+		for (; position < end; position++) {
+			if (is_special[(uint8_t)buffer[position]]) {
+				return position;
+			}
+		}
+		return end;
+	}
+
+private:
+	//! Sets the high bit of every byte of the word that is zero (without false positives)
+	static inline uint64_t ZeroBytes(uint64_t word) {
+		const uint64_t low_bits = 0x7F7F7F7F7F7F7F7FULL;
+		return ~(((word & low_bits) + low_bits) | word | low_bits);
+	}
+
+	//! The searched characters, each repeated in all bytes of a word
+	uint64_t patterns[MAX_CHARACTERS];
+	idx_t character_count;
+	//! Whether or not a byte is one of the searched characters
+	bool is_special[256];
+};
+
+} // namespace duckdb
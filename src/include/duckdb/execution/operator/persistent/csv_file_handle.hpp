@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/compressed_file_system.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/mutex.hpp"
 
@@ -59,9 +60,23 @@ public:
 	}
 
 	bool FinishedReading() {
+		if (!can_seek && !block_reader) {
+			// the size of the file is not known (e.g. compressed files): read until the end of the file is reached
+			return end_of_file;
+		}
 		return requested_bytes >= file_size;
 	}
 
+	//! Decompresses the file in parallel if it is a compressed file that consists of independently compressed blocks
+	//! (e.g. blocked gzip or multi-frame zstd files), this must be called before anything is read
+	void EnableParallelDecompression(TaskScheduler &scheduler, idx_t max_block_size) {
+		D_ASSERT(requested_bytes == 0);
+		block_reader = CompressedBlockReader::TryCreate(scheduler, *file_handle, max_block_size);
+		if (block_reader) {
+			file_size = block_reader->UncompressedSize();
+		}
+	}
+
 	idx_t Read(void *buffer, idx_t nr_bytes) {
 		requested_bytes += nr_bytes;
 		if (!plain_file_source) {
@@ -86,7 +101,10 @@ public:
 			}
 			// we have data left to read from the file
 			// read directly into the buffer
-			auto bytes_read = file_handle->Read((char *)buffer + result_offset, nr_bytes - result_offset);
+			auto bytes_read = ReadFile((char *)buffer + result_offset, nr_bytes - result_offset);
+			if (bytes_read < nr_bytes - result_offset) {
+				end_of_file = true;
+			}
 			read_position += bytes_read;
 			if (reset_enabled) {
 				// if reset caching is enabled, we need to cache the bytes that we have read
@@ -146,6 +164,14 @@ public:
 	mutex main_mutex;
 	idx_t count = 0;
 
+private:
+	idx_t ReadFile(void *buffer, idx_t nr_bytes) {
+		if (block_reader) {
+			return block_reader->Read((data_ptr_t)buffer, nr_bytes);
+		}
+		return file_handle->Read(buffer, nr_bytes);
+	}
+
 private:
 	unique_ptr<FileHandle> file_handle;
 	bool reset_enabled = true;
@@ -158,6 +184,9 @@ private:
 	idx_t buffer_size = 0;
 	idx_t buffer_capacity = 0;
 	idx_t requested_bytes = 0;
+	bool end_of_file = false;
+	//! Decompresses the blocks of a compressed file in parallel (if enabled)
+	unique_ptr<CompressedBlockReader> block_reader;
 };
 
 } // namespace duckdb
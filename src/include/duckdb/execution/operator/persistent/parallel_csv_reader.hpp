@@ -12,20 +12,57 @@
 #include "duckdb/execution/operator/persistent/csv_reader_options.hpp"
 #include "duckdb/execution/operator/persistent/csv_file_handle.hpp"
 #include "duckdb/execution/operator/persistent/csv_buffer.hpp"
+#include "duckdb/execution/operator/persistent/csv_character_search.hpp"
 
 #include <sstream>
 #include <utility>
 
 namespace duckdb {
 
+//! CSVRowScanner finds the positions at which rows of a CSV file start, taking quoted values into account
+/*!
+   The scanner follows the same states as the parser (a quote only starts a quoted value at the start of a value), so
+   that a newline within a quoted value is never mistaken for the end of a row. The scanner can be resumed on the next
+   buffer when a row continues past the end of the data that was scanned.
+*/
+class CSVRowScanner {
+public:
+	explicit CSVRowScanner(const BufferedCSVReaderOptions &options);
+
+	//! Resets the scanner to the start of a row
+	void Reset();
+	//! Scans data[position, end) for the first row that starts at or after target, and sets position to its start.
+	//! Returns false (with position set to end) if no such row starts within the data.
+	//! The amount of rows that were ended while scanning is added to row_count.
+	bool NextRowStart(const char *data, idx_t &position, idx_t end, idx_t target, idx_t &row_count);
+
+private:
+	enum class ScannerState : uint8_t { ROW_START, VALUE_START, NORMAL, IN_QUOTES, UNQUOTE, ESCAPE, CARRIAGE_RETURN };
+
+	ScannerState state;
+	char delimiter;
+	char quote;
+	//! Whether or not a doubled quote within a quoted value is an escaped quote
+	bool quote_escapes_quote;
+	CSVCharacterSearch value_search;
+	CSVCharacterSearch quoted_search;
+};
+
 struct CSVBufferRead {
 	CSVBufferRead(shared_ptr<CSVBuffer> buffer_p, idx_t buffer_start_p, idx_t buffer_end_p, idx_t batch_index,
-	              idx_t estimated_linenr)
-	    : buffer(move(buffer_p)), buffer_start(buffer_start_p), buffer_end(buffer_end_p), batch_index(batch_index),
-	      estimated_linenr(estimated_linenr) {
+	              idx_t linenr)
+	    : CSVBufferRead(move(buffer_p), nullptr, buffer_start_p, buffer_end_p, batch_index, linenr) {
+	}
+
+	CSVBufferRead(shared_ptr<CSVBuffer> buffer_p, shared_ptr<CSVBuffer> nxt_buffer_p, idx_t buffer_start_p,
+	              idx_t buffer_end_p, idx_t batch_index, idx_t linenr)
+	    : buffer(move(buffer_p)), next_buffer(move(nxt_buffer_p)), buffer_start(buffer_start_p),
+	      buffer_end(buffer_end_p), batch_index(batch_index), linenr(linenr) {
 		if (buffer) {
-			if (buffer_end > buffer->GetBufferSize()) {
-				buffer_end = buffer->GetBufferSize();
+			// the piece can end in the next buffer, if its last row continues there
+			auto total_size = buffer->GetBufferSize() + (next_buffer ? next_buffer->GetBufferSize() : 0);
+			if (buffer_end > total_size) {
+				buffer_end = total_size;
 			}
 		} else {
 			buffer_start = 0;
@@ -33,12 +70,6 @@ struct CSVBufferRead {
 		}
 	}
 
-	CSVBufferRead(shared_ptr<CSVBuffer> buffer_p, shared_ptr<CSVBuffer> nxt_buffer_p, idx_t buffer_start_p,
-	              idx_t buffer_end_p, idx_t batch_index, idx_t estimated_linenr)
-	    : CSVBufferRead(std::move(buffer_p), buffer_start_p, buffer_end_p, batch_index, estimated_linenr) {
-		next_buffer = std::move(nxt_buffer_p);
-	}
-
 	CSVBufferRead() : buffer_start(0), buffer_end(NumericLimits<idx_t>::Maximum()) {};
 
 	const char &operator[](size_t i) const {
@@ -50,6 +81,19 @@ struct CSVBufferRead {
 		return next_ptr[i - buffer->GetBufferSize()];
 	}
 
+	//! Returns the position of the first searched character in [position, end), or end if there is none
+	idx_t Find(const CSVCharacterSearch &search, idx_t position, idx_t end) {
+		auto current_size = buffer->GetBufferSize();
+		if (position < current_size) {
+			auto current_end = MinValue<idx_t>(end, current_size);
+			position = search.Find(buffer->Ptr(), position, current_end);
+			if (position < current_end || end <= current_size) {
+				return position;
+			}
+		}
+		return current_size + search.Find(next_buffer->Ptr(), position - current_size, end - current_size);
+	}
+
 	string_t GetValue(idx_t start_buffer, idx_t position_buffer, idx_t offset) {
 		idx_t length = position_buffer - start_buffer - offset;
 		// 1) It's all in the current buffer
@@ -88,7 +132,8 @@ struct CSVBufferRead {
 	idx_t buffer_start;
 	idx_t buffer_end;
 	idx_t batch_index;
-	idx_t estimated_linenr;
+	//! The line number of the first row of the piece
+	idx_t linenr;
 };
 
 //! Buffered CSV reader is a class that reads values from a stream and parses them as a CSV file
@@ -108,9 +153,6 @@ public:
 	//! The actual buffer size
 	idx_t buffer_size = 0;
 
-	//! If this flag is set, it means we are about to try to read our last row.
-	bool reached_remainder_state = false;
-
 	unique_ptr<CSVBufferRead> buffer;
 
 public:
@@ -127,15 +169,16 @@ private:
 	bool TryParseCSV(ParserMode mode);
 	//! Extract a single DataChunk from the CSV file and stores it in insert_chunk
 	bool TryParseCSV(ParserMode mode, DataChunk &insert_chunk, string &error_message);
-	//! Sets Position depending on the byte_start of this thread
-	bool SetPosition(DataChunk &insert_chunk);
-	//! When a buffer finishes reading its piece, it still can try to scan up to the real end of the buffer
-	//! Up to finding a new line. This function sets the buffer_end and marks a boolean variable
-	//! when changing the buffer end the first time.
-	//! It returns FALSE if the parser should jump to the final state of parsing or not
-	bool BufferRemainder();
 	//! Parses a CSV file with a one-byte delimiter, escape and quote character
-	bool TryParseSimpleCSV(DataChunk &insert_chunk, string &error_message, bool try_add_line = false);
+	//! The piece of the buffer always starts and ends at row boundaries
+	bool TryParseSimpleCSV(DataChunk &insert_chunk, string &error_message);
+	//! Throws an exception if the line that starts at line_start and ends at the current position is too long
+	void VerifyLineLength(idx_t line_start);
+
+	//! The characters that end an unquoted value
+	CSVCharacterSearch value_search;
+	//! The characters that are special within a quoted value
+	CSVCharacterSearch quoted_search;
 };
 
 } // namespace duckdb
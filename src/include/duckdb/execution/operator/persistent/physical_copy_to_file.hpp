@@ -13,6 +13,7 @@
 #include "duckdb/function/copy_function.hpp"
 
 namespace duckdb {
+class ColumnDataCollection;
 
 //! Copy the contents of a query into a table
 class PhysicalCopyToFile : public PhysicalOperator {
@@ -24,6 +25,18 @@ public:
 	unique_ptr<FunctionData> bind_data;
 	string file_path;
 	bool use_tmp_file;
+	//! Whether or not the rows can be written by multiple threads, i.e. insertion order does not have to be preserved
+	bool parallel;
+	//! Whether the rows are collected in parallel per batch index, and written in the order of the batches when the
+	//! sink is finalized (preserves insertion order without running the pipeline on a single thread)
+	bool use_batch_index;
+	//! The columns that the output is partitioned on (if any). Every partition is written to its own (hive-style)
+	//! directory below file_path, by the thread that collected its rows
+	vector<idx_t> partition_columns;
+	//! The names of the columns of the source
+	vector<string> names;
+	//! The (approximate) maximum amount of rows in a file of a partition, 0 if there is no maximum
+	idx_t rows_per_file;
 
 public:
 	// Source interface
@@ -45,8 +58,21 @@ public:
 		return true;
 	}
 
+	bool ParallelSink() const override {
+		return parallel || use_batch_index;
+	}
+
+	bool RequiresBatchIndex() const override {
+		return use_batch_index;
+	}
+
 	bool IsOrderDependent() const override {
-		return true;
+		return !parallel && !use_batch_index;
 	}
+
+private:
+	//! Writes the rows of a partition to a new file in the directory of the partition
+	void WritePartitionFile(ExecutionContext &context, GlobalSinkState &gstate, const vector<Value> &partition_key,
+	                        ColumnDataCollection &collection) const;
 };
 } // namespace duckdb
@@ -49,6 +49,10 @@ public:
 	bool IsSink() const override {
 		return true;
 	}
+	//! The tables are exported by independent COPY pipelines: they can run concurrently in any order
+	bool IsOrderPreserving() const override {
+		return false;
+	}
 
 public:
 	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
@@ -12,6 +12,7 @@
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/common/index_vector.hpp"
+#include "duckdb/common/enums/on_conflict_action.hpp"
 
 namespace duckdb {
 
@@ -21,7 +22,7 @@ public:
 	//! INSERT INTO
 	PhysicalInsert(vector<LogicalType> types, TableCatalogEntry *table, physical_index_vector_t<idx_t> column_index_map,
 	               vector<unique_ptr<Expression>> bound_defaults, idx_t estimated_cardinality, bool return_chunk,
-	               bool parallel);
+	               bool parallel, OnConflictAction action_type);
 	//! CREATE TABLE AS
 	PhysicalInsert(LogicalOperator &op, SchemaCatalogEntry *schema, unique_ptr<BoundCreateTableInfo> info,
 	               idx_t estimated_cardinality, bool parallel);
@@ -43,6 +44,8 @@ public:
 	//! Whether or not the INSERT can be executed in parallel
 	//! This insert is not order preserving if executed in parallel
 	bool parallel;
+	//! What to do with tuples that violate a UNIQUE or PRIMARY KEY constraint
+	OnConflictAction action_type;
 
 public:
 	// Source interface
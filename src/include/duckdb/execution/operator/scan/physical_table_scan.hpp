@@ -8,13 +8,17 @@
 
 #pragma once
 
+#include "duckdb/execution/join_bloom_filter.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/function/table_function.hpp"
+#include "duckdb/parser/parsed_data/sample_options.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
 
+class TableScanLocalSourceState;
+
 //! Represents a scan of a base table
 class PhysicalTableScan : public PhysicalOperator {
 public:
@@ -41,6 +45,13 @@ public:
 	vector<string> names;
 	//! The table filters
 	unique_ptr<TableFilterSet> table_filters;
+	//! Bloom filters pushed down by hash joins on top of this scan, checked against every scanned chunk
+	vector<shared_ptr<JoinBloomFilter>> join_filters;
+	//! Filters set while the query is running by operators on top of this scan (e.g. a Top-N), checked against the
+	//! zonemaps of the row groups that have not been scanned yet
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The system sample pushed into the scan (if any)
+	unique_ptr<SampleOptions> sample_options;
 
 public:
 	string GetName() const override;
@@ -66,6 +77,10 @@ public:
 	}
 
 	double GetProgress(ClientContext &context, GlobalSourceState &gstate) const override;
+
+private:
+	//! Check the scanned chunk against the pushed down join filters, returns false if no rows remain
+	bool ApplyJoinFilters(TableScanLocalSourceState &state, DataChunk &chunk) const;
 };
 
 } // namespace duckdb
@@ -14,6 +14,7 @@
 namespace duckdb {
 
 class RecursiveCTEState;
+class RecursiveCTELocalState;
 
 class PhysicalRecursiveCTE : public PhysicalOperator {
 public:
@@ -35,12 +36,19 @@ public:
 	SinkResultType Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
 	                    DataChunk &input) const override;
 
+	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate) const override;
+
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
 
 	bool IsSink() const override {
 		return true;
 	}
 
+	bool ParallelSink() const override {
+		return true;
+	}
+
 public:
 	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
 
@@ -48,7 +56,7 @@ public:
 
 private:
 	//! Probe Hash Table and eliminate duplicate rows
-	idx_t ProbeHT(DataChunk &chunk, RecursiveCTEState &state) const;
+	idx_t ProbeHT(DataChunk &chunk, RecursiveCTEState &state, RecursiveCTELocalState &lstate) const;
 
 	void ExecuteRecursivePipelines(ExecutionContext &context) const;
 };
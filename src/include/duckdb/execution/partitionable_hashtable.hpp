@@ -27,6 +27,12 @@ struct RadixPartitionInfo {
 typedef vector<unique_ptr<GroupedAggregateHashTable>> HashTableList; // NOLINT
 
 class PartitionableHashTable {
+public:
+	//! The number of partitioned rows after which we check whether the local aggregation reduces the data
+	static constexpr const idx_t ADAPTIVE_MIN_TUPLES = 131072;
+	//! The local aggregation is skipped when more than this percentage of the rows creates a new group
+	static constexpr const idx_t ADAPTIVE_MAX_GROUP_PERCENTAGE = 95;
+
 public:
 	PartitionableHashTable(ClientContext &context, Allocator &allocator, RadixPartitionInfo &partition_info_p,
 	                       vector<LogicalType> group_types_p, vector<LogicalType> payload_types_p,
@@ -49,6 +55,12 @@ private:
 	vector<BoundAggregateExpression *> bindings;
 
 	bool is_partitioned;
+	//! Whether rows are appended to the partitions without looking for their group, because the local aggregation
+	//! hardly reduces the data (e.g., for near-unique groups). The groups are merged when the partitions are combined.
+	bool skip_lookups;
+	//! The number of rows, and the number of new groups they created, since the HT was partitioned
+	idx_t partitioned_tuples;
+	idx_t partitioned_groups;
 	RadixPartitionInfo &partition_info;
 	vector<SelectionVector> sel_vectors;
 	vector<idx_t> sel_vector_sizes;
@@ -61,5 +73,7 @@ private:
 private:
 	idx_t ListAddChunk(HashTableList &list, DataChunk &groups, Vector &group_hashes, DataChunk &payload,
 	                   const vector<idx_t> &filter);
+	//! Measure the reduction of the local aggregation, and stop aggregating locally if it does not pay off
+	void UpdateAdaptiveAggregation(idx_t tuple_count, idx_t group_count);
 };
 } // namespace duckdb
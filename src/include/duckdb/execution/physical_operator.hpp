@@ -153,6 +153,12 @@ public:
 		return false;
 	}
 
+	//! Whether or not further input can no longer change the output of the operator in any thread, in which case the
+	//! pipelines feeding it stop fetching from their source
+	virtual bool OperatorFinished(GlobalOperatorState &gstate) const {
+		return false;
+	}
+
 public:
 	// Source interface
 	virtual unique_ptr<LocalSourceState> GetLocalSourceState(ExecutionContext &context,
@@ -217,6 +223,12 @@ public:
 		return false;
 	}
 
+	//! Whether or not further input of this thread can no longer change the result of the sink, in which case the
+	//! pipeline executor stops fetching from the source
+	virtual bool SinkFinished(GlobalSinkState &gstate, LocalSinkState &lstate) const {
+		return false;
+	}
+
 public:
 	// Pipeline construction
 	virtual vector<const PhysicalOperator *> GetSources() const;
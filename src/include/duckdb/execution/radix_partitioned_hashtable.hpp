@@ -57,6 +57,8 @@ public:
 	             LocalSourceState &lstate_p) const;
 
 	static void SetMultiScan(GlobalSinkState &state);
+	//! Release the finalized HTs while they are scanned, for tables that are only scanned once
+	static void SetSingleScan(GlobalSinkState &state);
 	bool ForceSingleHT(GlobalSinkState &state) const;
 
 private:
@@ -21,6 +21,9 @@ public:
 
 	WindowSegmentTree(AggregateFunction &aggregate, FunctionData *bind_info, const LogicalType &result_type,
 	                  DataChunk *input, const ValidityMask &filter_mask, WindowAggregationMode mode);
+	//! Creates a tree that reads the nodes of another (fully constructed) tree, so that both can compute frames
+	//! concurrently. The input and filter mask must hold the same rows as the ones of the other tree.
+	WindowSegmentTree(const WindowSegmentTree &shared, DataChunk *input, const ValidityMask &filter_mask);
 	~WindowSegmentTree();
 
 	//! First row contains the result.
@@ -64,10 +67,12 @@ private:
 
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
 	unique_ptr<data_t[]> levels_flat_native;
+	//! The intermediate nodes that are read, either levels_flat_native or the nodes of a shared tree
+	data_ptr_t levels_flat;
 	//! For each level, the starting location in the levels_flat_native array
 	vector<idx_t> levels_flat_start;
 
-	//! The total number of internal nodes of the tree, stored in levels_flat_native
+	//! The total number of internal nodes of the tree, stored in levels_flat_native (0 if the nodes are shared)
 	idx_t internal_nodes;
 
 	//! The (sorted) input chunk collection on which the tree is built
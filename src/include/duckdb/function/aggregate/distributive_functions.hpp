@@ -60,6 +60,11 @@ struct ApproxCountDistinctFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+//! hll_sketch and hll_merge, which produce a HyperLogLog sketch that can be stored and merged later
+struct HLLSketchFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct ArgMinFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
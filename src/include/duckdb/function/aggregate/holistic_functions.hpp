@@ -29,4 +29,9 @@ struct ReservoirQuantileFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+//! tdigest_sketch, tdigest_merge and tdigest_quantile, which expose the t-digest of approx_quantile as a BLOB
+struct TDigestSketchFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 } // namespace duckdb
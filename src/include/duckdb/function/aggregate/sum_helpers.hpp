@@ -11,6 +11,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/aggregate_executor.hpp"
 
 namespace duckdb {
 
@@ -63,6 +64,11 @@ struct RegularAdd {
 	static void AddConstant(STATE &state, T input, idx_t count) {
 		state.value += input * count;
 	}
+
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value -= input;
+	}
 };
 
 struct KahanAdd {
@@ -101,6 +107,11 @@ struct HugeintAdd {
 		AddValue(state.value, uint64_t(input), input >= 0);
 	}
 
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value -= hugeint_t(input);
+	}
+
 	template <class STATE, class T>
 	static void AddConstant(STATE &state, T input, idx_t count) {
 		// add a constant X number of times
@@ -132,6 +143,9 @@ struct HugeintAdd {
 
 template <class STATEOP, class ADDOP>
 struct BaseSumOperation {
+	using STATE_OPERATION = STATEOP;
+	using ADD_OPERATION = ADDOP;
+
 	template <class STATE>
 	static void Initialize(STATE *state) {
 		state->value = 0;
@@ -161,4 +175,56 @@ struct BaseSumOperation {
 	}
 };
 
+//! Sums over integers are exact when values are subtracted again, so their window frames are moved by subtracting the
+//! rows that left the frame and adding the rows that entered it, instead of being recomputed from the segment tree
+template <class OP>
+struct IntegerSumWindowOperation : public OP {
+	template <class STATE, class INPUT_TYPE, class RESULT_TYPE>
+	static void Window(const INPUT_TYPE *data, const ValidityMask &fmask, const ValidityMask &dmask,
+	                   AggregateInputData &aggr_input_data, STATE *state, const FrameBounds &frame,
+	                   const FrameBounds &prev, Vector &result, idx_t rid, idx_t bias) {
+		using STATEOP = typename OP::STATE_OPERATION;
+		using ADDOP = typename OP::ADD_OPERATION;
+
+		auto included = [&](idx_t i) {
+			return fmask.RowIsValid(i) && dmask.RowIsValid(i - bias);
+		};
+		idx_t added = 0;
+		idx_t removed = 0;
+		auto add = [&](idx_t begin, idx_t end) {
+			for (auto i = begin; i < end; ++i) {
+				if (included(i)) {
+					ADDOP::template AddNumber<STATE, INPUT_TYPE>(*state, data[i]);
+					added++;
+				}
+			}
+		};
+		auto remove = [&](idx_t begin, idx_t end) {
+			for (auto i = begin; i < end; ++i) {
+				if (included(i)) {
+					ADDOP::template SubtractNumber<STATE, INPUT_TYPE>(*state, data[i]);
+					removed++;
+				}
+			}
+		};
+		if (!AggregateExecutor::SlideFrame(frame, prev, add, remove)) {
+			OP::template Initialize<STATE>(state);
+			add(frame.first, frame.second);
+		}
+		if (!STATEOP::template WindowValues<STATE>(state, added, removed)) {
+			// the state does not know whether any valid rows are left in the frame
+			for (auto i = frame.first; i < frame.second; ++i) {
+				if (included(i)) {
+					STATEOP::template AddValues<STATE>(state, 1);
+					break;
+				}
+			}
+		}
+
+		auto rdata = FlatVector::GetData<RESULT_TYPE>(result);
+		OP::template Finalize<RESULT_TYPE, STATE>(result, aggr_input_data, state, rdata, FlatVector::Validity(result),
+		                                          rid);
+	}
+};
+
 } // namespace duckdb
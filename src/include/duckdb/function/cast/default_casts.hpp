@@ -111,6 +111,9 @@ struct DefaultCasts {
 	static bool NopCast(Vector &source, Vector &result, idx_t count, CastParameters &parameters);
 	static bool TryVectorNullCast(Vector &source, Vector &result, idx_t count, CastParameters &parameters);
 	static bool ReinterpretCast(Vector &source, Vector &result, idx_t count, CastParameters &parameters);
+	//! Gets a cast between integer types that does not check for overflow (if any), for inputs that are known to fit
+	//! in the target type
+	static cast_function_t GetUncheckedIntegerCast(const LogicalType &source, const LogicalType &target);
 
 private:
 	static BoundCastInfo BlobCastSwitch(BindCastInput &input, const LogicalType &source, const LogicalType &target);
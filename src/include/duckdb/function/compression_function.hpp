@@ -21,6 +21,7 @@ class ColumnData;
 class ColumnDataCheckpointer;
 class ColumnSegment;
 class SegmentStatistics;
+class TableFilter;
 
 struct ColumnFetchState;
 struct ColumnScanState;
@@ -91,6 +92,12 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for reading an entire vector (like scan_vector) while evaluating a filter directly on the
+//! compressed data, e.g. once per run or dictionary entry. The selection is restricted to the rows that pass the
+//! filter. The values of NULL rows are not known to the segment: the caller removes those rows afterwards.
+typedef void (*compression_select_t)(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                     Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+                                     const TableFilter &filter);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -118,7 +125,7 @@ public:
 	      init_compression(init_compression), compress(compress), compress_finalize(compress_finalize),
 	      init_scan(init_scan), scan_vector(scan_vector), scan_partial(scan_partial), fetch_row(fetch_row), skip(skip),
 	      init_segment(init_segment), init_append(init_append), append(append), finalize_append(finalize_append),
-	      revert_append(revert_append) {
+	      revert_append(revert_append), select(nullptr) {
 	}
 
 	//! Compression type
@@ -174,6 +181,9 @@ public:
 	compression_finalize_append_t finalize_append;
 	//! Revert append (optional)
 	compression_revert_append_t revert_append;
+
+	//! Scan a vector while evaluating a filter on the compressed data (optional)
+	compression_select_t select;
 };
 
 //! The set of compression functions
@@ -20,4 +20,8 @@ struct EncodeFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct HLLEstimateFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 } // namespace duckdb
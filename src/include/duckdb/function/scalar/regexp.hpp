@@ -61,13 +61,15 @@ struct RegexpExtractBindData : public RegexpBaseBindData {
 };
 
 struct RegexLocalState : public FunctionLocalState {
-	explicit RegexLocalState(RegexpBaseBindData &info)
-	    : constant_pattern(duckdb_re2::StringPiece(info.constant_string.c_str(), info.constant_string.size()),
-	                       info.options) {
-		D_ASSERT(info.constant_pattern);
-	}
+	explicit RegexLocalState(RegexpBaseBindData &info);
 
 	RE2 constant_pattern;
+	//! The longest literal that every match of the pattern contains (if any)
+	string required_literal;
+
+public:
+	//! Prefilter for the pattern: returns false if the input cannot contain a match, without running the regex
+	bool MayMatch(const string_t &input) const;
 };
 
 unique_ptr<FunctionLocalState> RegexInitLocalState(ExpressionState &state, const BoundFunctionExpression &expr,
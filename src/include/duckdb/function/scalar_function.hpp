@@ -80,7 +80,8 @@ public:
 	init_local_state_t init_local_state;
 	//! The dependency function (if any)
 	dependency_function_t dependency;
-	//! The statistics propagation function (if any)
+	//! The statistics propagation function (if any), which can also replace the function of the expression with a
+	//! cheaper implementation that is valid for the statistics of its input
 	function_statistics_t statistics;
 
 	function_serialize_t serialize;
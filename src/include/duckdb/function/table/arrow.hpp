@@ -54,6 +54,9 @@ struct ArrowProjectedColumns {
 struct ArrowStreamParameters {
 	ArrowProjectedColumns projected_columns;
 	TableFilterSet *filters;
+	//! Producers that consist of independent partitions (e.g., the fragments of a dataset) can add a stream per
+	//! partition here instead of returning a single stream, the partitions are then read concurrently
+	vector<unique_ptr<ArrowArrayStreamWrapper>> partitions;
 };
 
 typedef unique_ptr<ArrowArrayStreamWrapper> (*stream_factory_produce_t)(uintptr_t stream_factory_ptr,
@@ -80,9 +83,14 @@ struct ArrowScanLocalState : public LocalTableFunctionState {
 	explicit ArrowScanLocalState(unique_ptr<ArrowArrayWrapper> current_chunk) : chunk(move(current_chunk)) {
 	}
 
+	//! The stream of the partition that is read by this thread (if the producer is partitioned)
 	unique_ptr<ArrowArrayStreamWrapper> stream;
+	idx_t partition_index = 0;
+	idx_t partition_batch_index = 0;
 	shared_ptr<ArrowArrayWrapper> chunk;
 	idx_t chunk_offset = 0;
+	//! The end of the slice of the chunk that is scanned by this thread
+	idx_t chunk_end = 0;
 	idx_t batch_index = 0;
 	vector<column_t> column_ids;
 	//! Store child vectors for Arrow Dictionary Vectors (col-idx,vector)
@@ -93,11 +101,20 @@ struct ArrowScanLocalState : public LocalTableFunctionState {
 };
 
 struct ArrowScanGlobalState : public GlobalTableFunctionState {
+	//! Chunks are handed out to threads in slices of this size, so large chunks are converted in parallel
+	static constexpr idx_t SLICE_SIZE = 16 * STANDARD_VECTOR_SIZE;
+
 	unique_ptr<ArrowArrayStreamWrapper> stream;
 	mutex main_mutex;
 	idx_t max_threads = 1;
 	idx_t batch_index = 0;
 	bool done = false;
+	//! The chunk of which slices are still being handed out
+	shared_ptr<ArrowArrayWrapper> chunk;
+	idx_t chunk_offset = 0;
+	//! The streams of the partitions of the producer, each partition is read by a single thread
+	vector<unique_ptr<ArrowArrayStreamWrapper>> partitions;
+	idx_t next_partition = 0;
 
 	vector<idx_t> projection_ids;
 	vector<LogicalType> scanned_types;
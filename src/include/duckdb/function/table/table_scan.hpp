@@ -10,12 +10,15 @@
 
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/enums/order_type.hpp"
 
 namespace duckdb {
 class TableCatalogEntry;
+class LogicalGet;
 
 struct TableScanBindData : public TableFunctionData {
-	explicit TableScanBindData(TableCatalogEntry *table) : table(table), is_index_scan(false), is_create_index(false) {
+	explicit TableScanBindData(TableCatalogEntry *table)
+	    : table(table), is_index_scan(false), is_create_index(false), offset(0) {
 	}
 
 	//! The table to scan
@@ -27,11 +30,13 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_create_index;
 	//! The row ids to fetch (in case of an index scan)
 	vector<row_t> result_ids;
+	//! The amount of rows at the start of the table that are skipped (pushed down from an OFFSET)
+	idx_t offset;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = (const TableScanBindData &)other_p;
-		return other.table == table && result_ids == other.result_ids;
+		return other.table == table && result_ids == other.result_ids && other.offset == offset;
 	}
 };
 
@@ -41,6 +46,10 @@ struct TableScanFunction {
 	static TableFunction GetFunction();
 	static TableFunction GetIndexScanFunction();
 	static TableCatalogEntry *GetTableEntry(const TableFunction &function, const FunctionData *bind_data);
+	//! Try to turn the scan into an index scan that only fetches the first count rows in the order of the column,
+	//! which is used when the scan is below a Top-N on that column
+	static bool TryOrderedIndexScan(ClientContext &context, LogicalGet &get, idx_t column_index, OrderType order_type,
+	                                OrderByNullType null_order, idx_t count);
 };
 
 } // namespace duckdb
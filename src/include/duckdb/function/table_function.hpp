@@ -19,7 +19,9 @@ namespace duckdb {
 
 class BaseStatistics;
 class LogicalGet;
+class DynamicTableFilterSet;
 class TableFilterSet;
+struct SampleOptions;
 
 struct TableFunctionInfo {
 	DUCKDB_API virtual ~TableFunctionInfo();
@@ -59,14 +61,21 @@ struct TableFunctionBindInput {
 
 struct TableFunctionInitInput {
 	TableFunctionInitInput(const FunctionData *bind_data_p, const vector<column_t> &column_ids_p,
-	                       const vector<idx_t> &projection_ids_p, TableFilterSet *filters_p)
-	    : bind_data(bind_data_p), column_ids(column_ids_p), projection_ids(projection_ids_p), filters(filters_p) {
+	                       const vector<idx_t> &projection_ids_p, TableFilterSet *filters_p,
+	                       DynamicTableFilterSet *dynamic_filters_p = nullptr,
+	                       SampleOptions *sample_options_p = nullptr)
+	    : bind_data(bind_data_p), column_ids(column_ids_p), projection_ids(projection_ids_p), filters(filters_p),
+	      dynamic_filters(dynamic_filters_p), sample_options(sample_options_p) {
 	}
 
 	const FunctionData *bind_data;
 	const vector<column_t> &column_ids;
 	const vector<idx_t> projection_ids;
 	TableFilterSet *filters;
+	//! Filters that are set while the query is running (if any)
+	DynamicTableFilterSet *dynamic_filters;
+	//! The system sample of the table function to produce (if any)
+	SampleOptions *sample_options;
 
 	bool CanRemoveFilterColumns() const {
 		if (projection_ids.empty()) {
@@ -189,6 +198,9 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! Whether or not the table function supports sampling pushdown. If supported, a system sample (with a percentage)
+	//! directly on top of the function is pushed into it, so that it can skip reading the unsampled parts of its input
+	bool sampling_pushdown;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 };
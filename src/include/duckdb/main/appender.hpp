@@ -25,6 +25,17 @@ enum class AppenderType : uint8_t {
 	PHYSICAL // Cast input -> PhysicalType
 };
 
+//! The data of a column in a columnar layout, which is appended without converting the values one by one
+struct AppenderColumnData {
+	//! The values in the internal layout of the column type (e.g. int32_t for INTEGER, timestamp_t for TIMESTAMP)
+	//! For VARCHAR and BLOB columns these are the concatenated bytes of the strings
+	const void *data = nullptr;
+	//! The offsets of the strings in the data (count + 1 entries), only used for VARCHAR and BLOB columns
+	const uint32_t *offsets = nullptr;
+	//! The validity mask of the values (bit i is set if row i is valid), or nullptr if all rows are valid
+	const validity_t *validity = nullptr;
+};
+
 //! The Appender class can be used to append elements to a table.
 class BaseAppender {
 protected:
@@ -84,10 +95,15 @@ public:
 		return column;
 	}
 	DUCKDB_API void AppendDataChunk(DataChunk &value);
+	//! Appends count rows from the data of every column. The values are not buffered in the appender, but appended
+	//! directly to the table, the data only needs to stay valid during the call.
+	DUCKDB_API void AppendColumns(const vector<AppenderColumnData> &columns, idx_t count);
 
 protected:
 	void Destructor();
 	virtual void FlushInternal(ColumnDataCollection &collection) = 0;
+	//! Appends the chunks filled by the callback to the table, until the callback returns false
+	virtual void AppendChunksInternal(const std::function<bool(DataChunk &chunk)> &next_chunk) = 0;
 	void InitializeChunk();
 	void FlushChunk();
 
@@ -124,6 +140,7 @@ public:
 
 protected:
 	void FlushInternal(ColumnDataCollection &collection) override;
+	void AppendChunksInternal(const std::function<bool(DataChunk &chunk)> &next_chunk) override;
 };
 
 class InternalAppender : public BaseAppender {
@@ -138,6 +155,7 @@ public:
 
 protected:
 	void FlushInternal(ColumnDataCollection &collection) override;
+	void AppendChunksInternal(const std::function<bool(DataChunk &chunk)> &next_chunk) override;
 };
 
 template <>
@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/arrow_query_result.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/arrow/arrow_wrapper.hpp"
+#include "duckdb/common/winapi.hpp"
+#include "duckdb/main/query_result.hpp"
+
+namespace duckdb {
+
+//! The ArrowQueryResult holds a result that was converted to Arrow arrays while the query was executed
+class ArrowQueryResult : public QueryResult {
+public:
+	//! Creates a successful query result with the specified names and types
+	DUCKDB_API ArrowQueryResult(StatementType statement_type, StatementProperties properties, vector<string> names,
+	                            vector<LogicalType> types, vector<unique_ptr<ArrowArrayWrapper>> arrays,
+	                            ClientProperties client_properties);
+	//! Creates an unsuccessful query result with error condition
+	DUCKDB_API explicit ArrowQueryResult(PreservedError error);
+
+public:
+	//! The result has already been converted to Arrow, and can not be fetched as DataChunks
+	DUCKDB_API unique_ptr<DataChunk> FetchRaw() override;
+	//! Converts the QueryResult to a string
+	DUCKDB_API string ToString() override;
+
+	//! Moves the next array of the result into "out", returns the amount of rows in the array (0 if there are none)
+	DUCKDB_API idx_t FetchArray(ArrowArray *out);
+	DUCKDB_API idx_t RowCount() const;
+
+private:
+	//! The arrays of the result, in order
+	vector<unique_ptr<ArrowArrayWrapper>> arrays;
+	//! The index of the next array to fetch
+	idx_t fetch_index;
+};
+
+} // namespace duckdb
@@ -46,6 +46,8 @@ struct ArrowResultWrapper {
 struct AppenderWrapper {
 	unique_ptr<Appender> appender;
 	string error;
+	//! The column data set for the next columnar append
+	vector<AppenderColumnData> columns;
 };
 
 enum class CAPIResultSetType : uint8_t {
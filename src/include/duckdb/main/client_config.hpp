@@ -13,6 +13,7 @@
 #include "duckdb/common/enums/output_type.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/parallel/task.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -29,11 +30,15 @@ struct ClientConfig {
 	bool enable_profiler = false;
 	//! If detailed query profiling is enabled
 	bool enable_detailed_profiling = false;
+	//! If the query profiler measures hardware counters per operator
+	bool enable_profiling_counters = false;
 	//! The format to print query profiling information in (default: query_tree), if enabled.
 	ProfilerPrintFormat profiler_print_format = ProfilerPrintFormat::QUERY_TREE;
 	//! The file to save query profiling information to, instead of printing it to the console
 	//! (empty = print to console)
 	string profiler_save_location;
+	//! The file to write a trace of the threads executing each query to (empty = no trace)
+	string trace_save_location;
 
 	//! Allows suppressing profiler output, even if enabled. We turn on the profiler on all test runs but don't want
 	//! to output anything
@@ -66,11 +71,23 @@ struct ClientConfig {
 	bool force_index_join = false;
 	//! Force out-of-core computation for operators that support it, used for testing
 	bool force_external = false;
+	//! Force radix partitioning of the build side of hash joins, independent of its size, used for testing
+	bool force_partitioned_join_build = false;
 	//! Force disable cross product generation when hyper graph isn't connected, used for testing
 	bool force_no_cross_product = false;
 	//! Maximum bits allowed for using a perfect hash table (i.e. the perfect HT can hold up to 2^perfect_ht_threshold
 	//! elements)
 	idx_t perfect_ht_threshold = 12;
+	//! The maximum number of threads that a single pipeline of a query of this connection runs on (0 = no limit)
+	idx_t max_query_threads = 0;
+	//! The priority of the tasks of the queries of this connection
+	TaskPriority query_priority = TaskPriority::NORMAL;
+	//! The maximum amount of memory that the operators of a query of this connection plan to use before spilling to
+	//! disk (default: no limit other than the memory limit of the database)
+	idx_t query_memory_limit = DConstants::INVALID_INDEX;
+	//! The size of the buffer that worker threads fill while a streaming result is fetched (0 = the result is
+	//! produced by the fetching thread only)
+	idx_t streaming_buffer_size = 0;
 
 	//! The explain output type used when none is specified (default: PHYSICAL_ONLY)
 	ExplainOutputType explain_output_type = ExplainOutputType::PHYSICAL_ONLY;
@@ -51,6 +51,29 @@ struct PendingQueryParameters {
 	bool allow_stream_result = false;
 };
 
+//! The progress of the query that is executed by a client context. The progress is updated by the thread executing
+//! the query, and can be read by any thread while the query runs.
+struct QueryProgress {
+	QueryProgress() {
+		Initialize();
+	}
+	void Initialize() {
+		percentage = -1;
+		rows_processed = 0;
+		total_rows_to_process = 0;
+		bytes_read = 0;
+	}
+
+	//! The progress of the query in percent, or -1 if no query with progress tracking is running
+	atomic<double> percentage;
+	//! The amount of rows the pipelines of the query have processed
+	atomic<idx_t> rows_processed;
+	//! The (estimated) amount of rows the pipelines of the query process in total
+	atomic<idx_t> total_rows_to_process;
+	//! The amount of bytes read from files since the query started
+	atomic<idx_t> bytes_read;
+};
+
 //! The ClientContext holds information relevant to the current client session
 //! during execution
 class ClientContext : public std::enable_shared_from_this<ClientContext> {
@@ -108,6 +131,8 @@ public:
 	DUCKDB_API unique_ptr<TableDescription> TableInfo(const string &schema_name, const string &table_name);
 	//! Appends a DataChunk to the specified table. Returns whether or not the append was successful.
 	DUCKDB_API void Append(TableDescription &description, ColumnDataCollection &collection);
+	//! Appends the chunks filled by the callback to the specified table, until the callback returns false
+	DUCKDB_API void Append(TableDescription &description, const std::function<bool(DataChunk &chunk)> &next_chunk);
 	//! Try to bind a relation in the current client context; either throws an exception or fills the result_columns
 	//! list with the set of returned columns
 	DUCKDB_API void TryBindRelation(Relation &relation, vector<ColumnDefinition> &result_columns);
@@ -133,9 +158,15 @@ public:
 	                                           vector<Value> &values, bool allow_stream_result = true);
 	DUCKDB_API unique_ptr<QueryResult> Execute(const string &query, shared_ptr<PreparedStatementData> &prepared,
 	                                           PendingQueryParameters parameters);
+	//! Execute a prepared statement for every row of the parameters, where column i holds the values of parameter
+	//! i + 1. All executions run in a single transaction, and their results are combined into a single result.
+	DUCKDB_API unique_ptr<QueryResult> ExecuteBatch(const string &query, shared_ptr<PreparedStatementData> &prepared,
+	                                                DataChunk &parameters);
 
-	//! Gets current percentage of the query's progress, returns 0 in case the progress bar is disabled.
+	//! Gets current percentage of the query's progress, returns -1 in case the progress bar is disabled.
 	DUCKDB_API double GetProgress();
+	//! Gets the progress of the current query, which is only tracked while the progress bar is enabled
+	DUCKDB_API const QueryProgress &GetQueryProgress();
 
 	//! Register function in the temporary schema
 	DUCKDB_API void RegisterFunction(CreateFunctionInfo *info);
@@ -225,6 +256,8 @@ private:
 	void BeginTransactionInternal(ClientContextLock &lock, bool requires_valid_transaction);
 	void BeginQueryInternal(ClientContextLock &lock, const string &query);
 	PreservedError EndQueryInternal(ClientContextLock &lock, bool success, bool invalidate_transaction);
+	//! Adds the metrics of the active query to the query history of the database
+	void AddQueryHistoryInternal(ClientContextLock &lock, bool success);
 
 	PendingExecutionResult ExecuteTaskInternal(ClientContextLock &lock, PendingQueryResult &result);
 
@@ -235,6 +268,8 @@ private:
 	unique_ptr<PendingQueryResult> PendingQueryPreparedInternal(ClientContextLock &lock, const string &query,
 	                                                            shared_ptr<PreparedStatementData> &prepared,
 	                                                            PendingQueryParameters parameters);
+	unique_ptr<QueryResult> ExecuteBatchInternal(ClientContextLock &lock, const string &query,
+	                                             shared_ptr<PreparedStatementData> &prepared, DataChunk &parameters);
 
 private:
 	//! Lock on using the ClientContext in parallel
@@ -242,7 +277,7 @@ private:
 	//! The currently active query context
 	unique_ptr<ActiveQueryContext> active_query;
 	//! The current query progress
-	atomic<double> query_progress;
+	QueryProgress query_progress;
 };
 
 class ClientContextLock {
@@ -40,6 +40,13 @@ struct DBConfig;
 
 enum class AccessMode : uint8_t { UNDEFINED = 0, AUTOMATIC = 1, READ_ONLY = 2, READ_WRITE = 3 };
 
+enum class BufferEvictionPolicy : uint8_t {
+	//! Evict the least recently used blocks first
+	LRU = 0,
+	//! Evict the blocks that have only been used once since they were loaded first, then the least recently used
+	TWO_QUEUE = 1
+};
+
 enum class CheckpointAbort : uint8_t {
 	NO_ABORT = 0,
 	DEBUG_ABORT_BEFORE_TRUNCATE = 1,
@@ -61,15 +68,21 @@ struct ConfigurationOption {
 };
 
 typedef void (*set_option_callback_t)(ClientContext &context, SetScope scope, Value &parameter);
+typedef Value (*get_option_default_callback_t)(DatabaseInstance &db);
 
 struct ExtensionOption {
-	ExtensionOption(string description_p, LogicalType type_p, set_option_callback_t set_function_p)
-	    : description(move(description_p)), type(move(type_p)), set_function(set_function_p) {
+	ExtensionOption(string description_p, LogicalType type_p, set_option_callback_t set_function_p,
+	                get_option_default_callback_t default_function_p = nullptr)
+	    : description(move(description_p)), type(move(type_p)), set_function(set_function_p),
+	      default_function(default_function_p) {
 	}
 
 	string description;
 	LogicalType type;
 	set_option_callback_t set_function;
+	//! Computes the default value of the option when it is first read (if set). This allows extensions to defer
+	//! expensive initialization until the option is actually used.
+	get_option_default_callback_t default_function;
 };
 
 struct DBConfigOptions {
@@ -79,8 +92,27 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether or not the automatic checkpoint runs on a background thread (default: true). If false, the transaction
+	//! that commits when the WAL reaches checkpoint_wal_size performs the checkpoint
+	bool background_checkpoint = true;
+	//! Whether or not to build Bloom filters for the string and UUID columns of row groups during a checkpoint
+	//! (default: false)
+	bool checkpoint_bloom_filters = false;
+	//! Whether or not a commit waits for the WAL to be synced to disk (default: true). If false, the WAL is synced
+	//! periodically by a background thread
+	bool synchronous_commit = true;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
+	//! Whether or not to memory-map the database file when it is opened read-only, so that blocks are read from the
+	//! OS page cache without being copied (default: false)
+	bool use_mmap = false;
+	//! Whether or not the checksum of a block is only verified the first time the block is read from the database
+	//! file, instead of every time it is loaded into memory (default: false)
+	bool verify_checksums_once = false;
+	//! Whether or not large allocations are advised to be backed by transparent huge pages (default: false)
+	bool allocator_huge_pages = false;
+	//! The policy used to select the blocks to evict from the buffer pool (default: LRU)
+	BufferEvictionPolicy buffer_eviction_policy = BufferEvictionPolicy::LRU;
 	//! Whether extensions should be loaded on start-up
 	bool load_extensions = true;
 	//! The maximum memory used by the database system (in bytes). Default: 80% of System available memory
@@ -89,10 +121,14 @@ struct DBConfigOptions {
 	idx_t maximum_threads = (idx_t)-1;
 	//! The number of external threads that work on DuckDB tasks. Default: none.
 	idx_t external_threads = 0;
+	//! Whether or not to pin the background threads to CPU cores. Default: no.
+	bool pin_threads = false;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress the blocks that are written to the temporary directory
+	bool compress_temporary_files = false;
 	//! The collation type of the database
 	string collation = string();
 	//! The order type used when none is specified (default: ASC)
@@ -102,7 +138,15 @@ struct DBConfigOptions {
 	//! enable COPY and related commands
 	bool enable_external_access = true;
 	//! Whether or not object cache is used
-	bool object_cache_enable = false;
+	bool object_cache_enable = true;
+	//! The maximum memory used by the object cache
+	idx_t object_cache_size = 128ULL * 1000ULL * 1000ULL;
+	//! The maximum amount of prepared statements kept in the database-wide prepared statement cache (0 = disabled)
+	idx_t prepared_statement_cache_size = 0;
+	//! The maximum memory used by the database-wide query result cache (0 = disabled)
+	idx_t query_result_cache_size = 0;
+	//! The maximum amount of finished queries kept in the query history (0 = disabled)
+	idx_t query_history_size = 1024;
 	//! Force checkpoint when CHECKPOINT is called or on shutdown, even if no changes have been made
 	bool force_checkpoint = false;
 	//! Run a checkpoint on successful shutdown and delete the WAL, to leave only a single database file behind
@@ -126,8 +170,8 @@ struct DBConfigOptions {
 	bool allow_unsigned_extensions = false;
 	//! Enable emitting FSST Vectors
 	bool enable_fsst_vectors = false;
-	//! Experimental parallel CSV reader
-	bool experimental_parallel_csv_reader = false;
+	//! Whether or not CSV files are read in parallel (if the options of the read allow it)
+	bool experimental_parallel_csv_reader = true;
 
 	bool operator==(const DBConfigOptions &other) const;
 };
@@ -178,7 +222,8 @@ public:
 	DUCKDB_API static vector<string> GetOptionNames();
 
 	DUCKDB_API void AddExtensionOption(string name, string description, LogicalType parameter,
-	                                   set_option_callback_t function = nullptr);
+	                                   set_option_callback_t function = nullptr,
+	                                   get_option_default_callback_t default_function = nullptr);
 	//! Fetch an option by index. Returns a pointer to the option, or nullptr if out of range
 	DUCKDB_API static ConfigurationOption *GetOptionByIndex(idx_t index);
 	//! Fetch an option by name. Returns a pointer to the option, or nullptr if none exists.
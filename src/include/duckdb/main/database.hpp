@@ -21,6 +21,9 @@ class ConnectionManager;
 class FileSystem;
 class TaskScheduler;
 class ObjectCache;
+class PreparedStatementCache;
+class QueryResultCache;
+class QueryHistory;
 
 class DatabaseInstance : public std::enable_shared_from_this<DatabaseInstance> {
 	friend class DuckDB;
@@ -38,6 +41,9 @@ public:
 	DUCKDB_API TransactionManager &GetTransactionManager();
 	DUCKDB_API TaskScheduler &GetScheduler();
 	DUCKDB_API ObjectCache &GetObjectCache();
+	DUCKDB_API PreparedStatementCache &GetPreparedStatementCache();
+	DUCKDB_API QueryResultCache &GetQueryResultCache();
+	DUCKDB_API QueryHistory &GetQueryHistory();
 	DUCKDB_API ConnectionManager &GetConnectionManager();
 	DUCKDB_API ValidChecker &GetValidChecker();
 	DUCKDB_API void SetExtensionLoaded(const std::string &extension_name);
@@ -52,6 +58,8 @@ public:
 
 private:
 	void Initialize(const char *path, DBConfig *config);
+	//! Computes the default value of an extension option that has not been set yet
+	bool TryGetExtensionOptionDefault(const std::string &key, Value &result);
 
 	void Configure(DBConfig &config);
 
@@ -61,6 +69,9 @@ private:
 	unique_ptr<TransactionManager> transaction_manager;
 	unique_ptr<TaskScheduler> scheduler;
 	unique_ptr<ObjectCache> object_cache;
+	unique_ptr<PreparedStatementCache> prepared_statement_cache;
+	unique_ptr<QueryResultCache> query_result_cache;
+	unique_ptr<QueryHistory> query_history;
 	unique_ptr<ConnectionManager> connection_manager;
 	unordered_set<std::string> loaded_extensions;
 	ValidChecker db_validity;
@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/parallel_appender.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/main/appender.hpp"
+
+namespace duckdb {
+
+class ParallelAppender;
+struct LocalAppenderState;
+
+//! The LocalAppender appends the data of a single thread of a ParallelAppender
+class LocalAppender : public BaseAppender {
+	friend class ParallelAppender;
+
+public:
+	DUCKDB_API LocalAppender(ParallelAppender &parent, unique_ptr<LocalAppenderState> state);
+	//! Flushes the remaining data and merges the data of this appender into the transaction of the ParallelAppender
+	DUCKDB_API ~LocalAppender() override;
+
+protected:
+	void FlushInternal(ColumnDataCollection &collection) override;
+	void AppendChunksInternal(const std::function<bool(DataChunk &chunk)> &next_chunk) override;
+
+private:
+	void AppendChunk(DataChunk &chunk);
+
+private:
+	ParallelAppender &parent;
+	unique_ptr<LocalAppenderState> state;
+};
+
+//! The ParallelAppender can be used to append to a table from multiple threads within a single transaction
+/*!
+    Every thread appends through its own LocalAppender, which appends to a thread-local row group collection without
+    any locking (similar to a parallel INSERT). When a LocalAppender is destroyed its row groups are merged into the
+    transaction-local storage of the table, and Commit() commits all of them at once. The order of the rows appended
+    by different threads is not preserved.
+*/
+class ParallelAppender {
+	friend class LocalAppender;
+
+public:
+	//! Begins a transaction on the connection, which can not be used for anything else until Commit() is called
+	DUCKDB_API ParallelAppender(Connection &con, const string &schema_name, const string &table_name);
+	DUCKDB_API ParallelAppender(Connection &con, const string &table_name);
+	//! Rolls back the transaction if it was not committed
+	DUCKDB_API ~ParallelAppender();
+
+	//! Creates an appender for a single thread, all local appenders must be destroyed before Commit() is called
+	DUCKDB_API unique_ptr<LocalAppender> CreateLocalAppender();
+	//! Commits the data of all local appenders
+	DUCKDB_API void Commit();
+
+private:
+	void MergeLocalState(LocalAppenderState &local_state);
+	void SetError(const string &error);
+
+private:
+	//! The client context of the connection that runs the transaction
+	shared_ptr<ClientContext> context;
+	//! The table that is appended to
+	TableCatalogEntry *table;
+	mutex lock;
+	//! The amount of local appenders that have not been destroyed yet
+	idx_t active_appenders = 0;
+	//! Whether the transaction was committed or rolled back
+	bool finished = false;
+	//! The first error that occurred in a local appender
+	string error;
+};
+
+} // namespace duckdb
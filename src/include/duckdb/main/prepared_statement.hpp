@@ -78,6 +78,10 @@ public:
 	//! Execute the prepared statement with the given set of values
 	DUCKDB_API unique_ptr<QueryResult> Execute(vector<Value> &values, bool allow_stream_result = true);
 
+	//! Execute the prepared statement once for every row of the parameters, where column i holds the values of
+	//! parameter i + 1. The executions run in a single transaction and return a single (materialized) result.
+	DUCKDB_API unique_ptr<QueryResult> ExecuteBatch(DataChunk &parameters);
+
 private:
 	unique_ptr<PendingQueryResult> PendingQueryRecursive(vector<Value> &values) {
 		return PendingQuery(values);
@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/prepared_statement_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class PreparedStatementData;
+
+//! The PreparedStatementCache is a database-wide LRU cache of prepared statements, shared by all connections. Entries
+//! are keyed by the normalized statement text (see GetCacheKey) and are only valid for the catalog version they were
+//! bound at: any modification of the catalog invalidates them.
+class PreparedStatementCache {
+public:
+	//! Returns the cached prepared statement data for the given key, or nullptr if there is none. Entries bound at a
+	//! different catalog version are evicted. Entries that are still in use by another prepared statement are not
+	//! returned, as the bound parameters of the statement data cannot be shared between concurrent executions.
+	shared_ptr<PreparedStatementData> Get(const string &key, idx_t catalog_version);
+	//! Adds the prepared statement data to the cache (unless an entry already exists for the key), evicting the least
+	//! recently used entries beyond the capacity
+	void Put(const string &key, shared_ptr<PreparedStatementData> data, idx_t capacity);
+	//! Evicts the least recently used entries until at most capacity entries remain
+	void Evict(idx_t capacity);
+	//! The amount of entries in the cache
+	idx_t Count();
+
+	//! Returns the cache key of the query in the given client context, or an empty string if the query cannot be
+	//! cached in this context
+	DUCKDB_API static string GetCacheKey(ClientContext &context, const string &query);
+	DUCKDB_API static PreparedStatementCache &Get(ClientContext &context);
+
+private:
+	void EvictInternal(idx_t capacity);
+
+private:
+	struct CacheEntry {
+		shared_ptr<PreparedStatementData> data;
+		list<string>::iterator lru_position;
+	};
+	mutex lock;
+	//! The cached entries
+	unordered_map<string, CacheEntry> entries;
+	//! The keys of the cached entries, from most to least recently used
+	list<string> lru;
+};
+
+} // namespace duckdb
@@ -20,6 +20,7 @@ class CatalogEntry;
 class ClientContext;
 class PhysicalOperator;
 class SQLStatement;
+struct DataTableInfo;
 
 class PreparedStatementData {
 public:
@@ -46,6 +47,12 @@ public:
 	//! If this version is lower than the current catalog version, we have to rebind the prepared statement
 	idx_t catalog_version;
 
+	//! Whether the result of the statement only depends on the rows of the tables in result_tables, so it can be
+	//! served from the query result cache
+	bool result_cacheable = false;
+	//! The tables the result of the statement is computed from
+	vector<weak_ptr<DataTableInfo>> result_tables;
+
 public:
 	void CheckParameterCount(idx_t parameter_count);
 	//! Whether or not the prepared statement data requires the query to rebound for the given parameters
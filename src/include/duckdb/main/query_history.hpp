@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_history.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+
+//! The metrics of a single finished query
+struct QueryHistoryEntry {
+	//! The sequence number of the query within the database
+	idx_t query_id = 0;
+	//! The query text
+	string query;
+	//! The time at which the query started
+	timestamp_t start_time;
+	//! The wall-clock time between the start and the end of the query (in seconds)
+	double latency = 0;
+	//! Whether or not the query finished successfully
+	bool success = false;
+	//! The amount of rows produced by the table scans of the query
+	idx_t rows_scanned = 0;
+	//! The amount of bytes read from files while the query ran
+	idx_t bytes_read = 0;
+	//! The peak memory reserved by the buffer manager while the query ran
+	idx_t peak_memory = 0;
+	//! The amount of bytes written to temporary files while the query ran
+	idx_t spilled_bytes = 0;
+	//! The CPU time spent on the tasks of the query (in seconds)
+	double cpu_time = 0;
+};
+
+//! The QueryHistory keeps the metrics of the most recently finished queries of all connections to the database, so
+//! they can be inspected with the duckdb_query_history() table function. The metrics that are tracked database-wide
+//! (bytes read, peak memory and spilled bytes) are attributed to a query as the change over its runtime, and are
+//! therefore approximate when several queries run concurrently.
+class QueryHistory {
+public:
+	QueryHistory();
+
+	//! Called when a query starts
+	void BeginQuery(DatabaseInstance &db);
+	//! Called when a query ends: adds the entry to the history, evicting the oldest entries beyond the capacity
+	void EndQuery(QueryHistoryEntry entry, idx_t capacity);
+	//! Evicts the oldest entries until at most capacity entries remain
+	void Evict(idx_t capacity);
+	//! Returns a copy of the entries in the history, from oldest to newest
+	vector<QueryHistoryEntry> GetEntries();
+
+	DUCKDB_API static QueryHistory &Get(ClientContext &context);
+
+private:
+	mutex lock;
+	//! The finished queries, from oldest to newest
+	deque<QueryHistoryEntry> entries;
+	//! The amount of queries that have finished
+	idx_t query_count;
+	//! The amount of queries that are currently running
+	atomic<idx_t> active_queries;
+};
+
+} // namespace duckdb
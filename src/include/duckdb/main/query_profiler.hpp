@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/hardware_counters.hpp"
 #include "duckdb/common/profiler.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -17,6 +18,7 @@
 #include "duckdb/common/winapi.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/execution/expression_executor_state.hpp"
+#include "duckdb/storage/buffer/memory_statistics.hpp"
 #include <stack>
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/deque.hpp"
@@ -88,6 +90,10 @@ struct OperatorInformation {
 
 	double time = 0;
 	idx_t elements = 0;
+	//! The hardware counters measured while the operator was active
+	HardwareCounterValues counters;
+	//! The buffer pool usage of the operator
+	OperatorMemoryStatistics memory;
 	string name;
 	//! A vector of Expression Executor Info
 	vector<unique_ptr<ExpressionExecutorInfo>> executors_info;
@@ -98,7 +104,7 @@ class OperatorProfiler {
 	friend class QueryProfiler;
 
 public:
-	DUCKDB_API explicit OperatorProfiler(bool enabled);
+	DUCKDB_API explicit OperatorProfiler(bool enabled, bool counters_enabled = false);
 
 	DUCKDB_API void StartOperator(const PhysicalOperator *phys_op);
 	DUCKDB_API void EndOperator(DataChunk *chunk);
@@ -109,12 +115,19 @@ public:
 	}
 
 private:
-	void AddTiming(const PhysicalOperator *op, double time, idx_t elements);
+	void AddTiming(const PhysicalOperator *op, double time, idx_t elements, const HardwareCounterValues &counters,
+	               const MemoryStatistics &memory_end);
 
 	//! Whether or not the profiler is enabled
 	bool enabled;
+	//! Whether or not the hardware counters are measured per operator
+	bool counters_enabled;
 	//! The timer used to time the execution time of the individual Physical Operators
 	Profiler op;
+	//! The hardware counters at the start of the active operator
+	HardwareCounterValues counters_start;
+	//! The memory statistics of the thread at the start of the active operator
+	MemoryStatistics memory_start;
 	//! The stack of Physical Operators that are currently active
 	const PhysicalOperator *active_operator;
 	//! A mapping of physical operators to recorded timings
@@ -148,6 +161,7 @@ private:
 public:
 	DUCKDB_API bool IsEnabled() const;
 	DUCKDB_API bool IsDetailedEnabled() const;
+	DUCKDB_API bool IsCountersEnabled() const;
 	DUCKDB_API ProfilerPrintFormat GetPrintFormat() const;
 	DUCKDB_API bool PrintOptimizerOutput() const;
 	DUCKDB_API string GetSaveLocation() const;
@@ -161,6 +175,8 @@ public:
 
 	//! Adds the timings gathered by an OperatorProfiler to this query profiler
 	DUCKDB_API void Flush(OperatorProfiler &profiler);
+	//! Adds memory statistics gathered outside of an OperatorProfiler (e.g. while finalizing a sink) to an operator
+	DUCKDB_API void AddMemoryStatistics(const PhysicalOperator *op, const OperatorMemoryStatistics &memory);
 
 	DUCKDB_API void StartPhase(string phase);
 	DUCKDB_API void EndPhase();
@@ -211,19 +227,22 @@ public:
 		return tree_map;
 	}
 
+public:
+	//! A mapping of the phase names to the timings
+	using PhaseTimingStorage = unordered_map<string, double>;
+	using PhaseTimingItem = PhaseTimingStorage::value_type;
+
+	//! Returns the timings of the phases of the last query, ordered by phase name. Nested phases are reported as
+	//! "phase > nested_phase".
+	DUCKDB_API vector<PhaseTimingItem> GetOrderedPhaseTimings() const;
+
 private:
 	//! The timer used to time the individual phases of the planning process
 	Profiler phase_profiler;
-	//! A mapping of the phase names to the timings
-	using PhaseTimingStorage = unordered_map<string, double>;
 	PhaseTimingStorage phase_timings;
-	using PhaseTimingItem = PhaseTimingStorage::value_type;
 	//! The stack of currently active phases
 	vector<string> phase_stack;
 
-private:
-	vector<PhaseTimingItem> GetOrderedPhaseTimings() const;
-
 	//! Check whether or not an operator type requires query profiling. If none of the ops in a query require profiling
 	//! no profiling information is output.
 	bool OperatorRequiresProfiling(PhysicalOperatorType op_type);
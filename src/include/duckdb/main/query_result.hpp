@@ -15,7 +15,7 @@
 
 namespace duckdb {
 
-enum class QueryResultType : uint8_t { MATERIALIZED_RESULT, STREAM_RESULT, PENDING_RESULT };
+enum class QueryResultType : uint8_t { MATERIALIZED_RESULT, STREAM_RESULT, PENDING_RESULT, ARROW_RESULT };
 
 //! A set of properties from the client context that can be used to interpret the query result
 struct ClientProperties {
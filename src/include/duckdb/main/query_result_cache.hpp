@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+class ClientContext;
+class ColumnDataCollection;
+class LogicalOperator;
+class PreparedStatementData;
+class Value;
+struct DataTableInfo;
+
+//! The QueryResultCache is a database-wide LRU cache of query results, shared by all connections. Entries are keyed by
+//! the normalized query text and its parameters (see GetCacheKey), and are only valid as long as the catalog and the
+//! tables the result was computed from are not modified. The results are stored in buffer-managed collections, the
+//! total size of which is limited by the query_result_cache_size setting.
+class QueryResultCache {
+public:
+	//! Returns the cached result for the given key, or nullptr if there is no result that is valid for the current
+	//! transaction of the client context. Entries that were invalidated by a commit or catalog change are evicted.
+	shared_ptr<ColumnDataCollection> Get(ClientContext &context, const string &key);
+	//! Adds a copy of the result of the prepared statement, as computed by the transaction that started at start_time,
+	//! to the cache. The result is not cached if any of its tables was changed by a commit the transaction did not see.
+	void Put(ClientContext &context, const string &key, const PreparedStatementData &prepared,
+	         transaction_t start_time, ColumnDataCollection &result, idx_t capacity);
+	//! Evicts the least recently used entries until the cached results use at most capacity bytes
+	void Evict(idx_t capacity);
+	//! The amount of entries in the cache
+	DUCKDB_API idx_t Count();
+	//! The total size of the cached results
+	DUCKDB_API idx_t SizeInBytes();
+
+	//! Returns the cache key of the query executed with the given parameters, or an empty string if its result cannot
+	//! be served from the cache in the current transaction of the client context
+	static string GetCacheKey(ClientContext &context, const string &query, const vector<Value> &parameters);
+	//! Determines whether the result of the (optimized) logical plan can be cached, and the tables it depends on
+	static void AnalyzePlan(LogicalOperator &plan, PreparedStatementData &result);
+	DUCKDB_API static QueryResultCache &Get(ClientContext &context);
+
+private:
+	void EvictInternal(idx_t capacity);
+
+private:
+	struct CacheEntry {
+		shared_ptr<ColumnDataCollection> result;
+		//! The catalog version the result was computed at
+		idx_t catalog_version;
+		//! The tables the result was computed from, with the commit id of the last change to each table
+		vector<pair<weak_ptr<DataTableInfo>, transaction_t>> tables;
+		//! The size of the result
+		idx_t size;
+		list<string>::iterator lru_position;
+	};
+	mutex lock;
+	//! The cached entries
+	unordered_map<string, CacheEntry> entries;
+	//! The keys of the cached entries, from most to least recently used
+	list<string> lru;
+	//! The total size of the cached results
+	idx_t total_size = 0;
+};
+
+} // namespace duckdb
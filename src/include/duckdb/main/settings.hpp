@@ -24,6 +24,44 @@ struct AccessModeSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct AllocatorHugePagesSetting {
+	static constexpr const char *Name = "allocator_huge_pages";
+	static constexpr const char *Description =
+	    "Whether or not large allocations (e.g. hash tables) should be backed by transparent huge pages";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct BackgroundCheckpointSetting {
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Whether or not the automatic checkpoint is performed by a background thread instead of the committing "
+	    "transaction";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct BufferEvictionPolicySetting {
+	static constexpr const char *Name = "buffer_eviction_policy";
+	static constexpr const char *Description =
+	    "The policy used to evict blocks from the buffer pool (lru, or the scan-resistant 2q)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct CheckpointBloomFiltersSetting {
+	static constexpr const char *Name = "checkpoint_bloom_filters";
+	static constexpr const char *Description =
+	    "Whether or not to build Bloom filters for string and UUID columns during a checkpoint, so that equality "
+	    "filters can skip row groups";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -33,6 +71,15 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct CompressTemporaryFilesSetting {
+	static constexpr const char *Name = "compress_temporary_files";
+	static constexpr const char *Description =
+	    "Whether or not to compress the blocks that are spilled to the temporary directory";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -51,6 +98,15 @@ struct DebugForceExternal {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct DebugForcePartitionedJoinBuild {
+	static constexpr const char *Name = "debug_force_partitioned_join_build";
+	static constexpr const char *Description =
+	    "DEBUG SETTING: force radix partitioning of the build side of hash joins, used for testing";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct DebugForceNoCrossProduct {
 	static constexpr const char *Name = "debug_force_no_cross_product";
 	static constexpr const char *Description =
@@ -156,7 +212,7 @@ struct EnableProgressBarSetting {
 
 struct ExperimentalParallelCSVSetting {
 	static constexpr const char *Name = "experimental_parallel_csv";
-	static constexpr const char *Description = "Whether or not to use the experimental parallel CSV reader";
+	static constexpr const char *Description = "Whether or not to read CSV files in parallel";
 	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
 	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 	static Value GetSetting(ClientContext &context);
@@ -229,6 +285,24 @@ struct MaximumMemorySetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct MaximumQueryThreadsSetting {
+	static constexpr const char *Name = "max_query_threads";
+	static constexpr const char *Description =
+	    "The maximum number of threads that a query of this connection runs on (0 = no limit)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct ObjectCacheSizeSetting {
+	static constexpr const char *Name = "object_cache_size";
+	static constexpr const char *Description =
+	    "The maximum memory used by the object cache, e.g. for the metadata of Parquet files (default: 128MB)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct PasswordSetting {
 	static constexpr const char *Name = "password";
 	static constexpr const char *Description = "The password to use. Ignored for legacy compatibility.";
@@ -245,6 +319,23 @@ struct PerfectHashThresholdSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct PinThreadsSetting {
+	static constexpr const char *Name = "pin_threads";
+	static constexpr const char *Description = "Whether or not to pin the background threads to CPU cores";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PreparedStatementCacheSizeSetting {
+	static constexpr const char *Name = "prepared_statement_cache_size";
+	static constexpr const char *Description =
+	    "The maximum amount of prepared statements that are cached and shared between connections (default: 0)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct PreserveIdentifierCase {
 	static constexpr const char *Name = "preserve_identifier_case";
 	static constexpr const char *Description =
@@ -281,6 +372,15 @@ struct ProfileOutputSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct ProfilingCountersSetting {
+	static constexpr const char *Name = "profiling_counters";
+	static constexpr const char *Description =
+	    "Whether the profiler measures hardware counters (cycles, instructions, cache and branch misses) per operator";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct ProfilingModeSetting {
 	static constexpr const char *Name = "profiling_mode";
 	static constexpr const char *Description = "The profiling mode (STANDARD or DETAILED)";
@@ -298,6 +398,42 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct QueryMemoryLimitSetting {
+	static constexpr const char *Name = "query_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory the operators of a query plan to use before spilling to disk (e.g. 1GB)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct QueryResultCacheSizeSetting {
+	static constexpr const char *Name = "query_result_cache_size";
+	static constexpr const char *Description = "The maximum memory used to cache query results that are shared between "
+	                                           "connections, e.g. 64MB (default: 0, disabled)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct QueryHistorySizeSetting {
+	static constexpr const char *Name = "query_history_size";
+	static constexpr const char *Description =
+	    "The maximum amount of finished queries kept in the history returned by duckdb_query_history() (default: 1024)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct QueryPrioritySetting {
+	static constexpr const char *Name = "query_priority";
+	static constexpr const char *Description =
+	    "The priority of the tasks of the queries of this connection. Either NORMAL or LOW.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -316,6 +452,26 @@ struct SearchPathSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct StreamingBufferSizeSetting {
+	static constexpr const char *Name = "streaming_buffer_size";
+	static constexpr const char *Description =
+	    "The size of the buffer that is filled in parallel while a streaming result is fetched (e.g. 64MB), 0 to "
+	    "produce streaming results in the fetching thread only";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct SynchronousCommitSetting {
+	static constexpr const char *Name = "synchronous_commit";
+	static constexpr const char *Description =
+	    "Whether or not a commit waits for the WAL to be synced to disk. If disabled, the WAL is synced in the "
+	    "background, and the most recent commits can be lost in case of a crash";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct TempDirectorySetting {
 	static constexpr const char *Name = "temp_directory";
 	static constexpr const char *Description = "Set the directory to which to write temp files";
@@ -332,6 +488,24 @@ struct ThreadsSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct TraceOutputSetting {
+	static constexpr const char *Name = "trace_output";
+	static constexpr const char *Description =
+	    "The file to which a Chrome trace of the threads executing each query is written, or empty to disable tracing";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct UseMmapSetting {
+	static constexpr const char *Name = "use_mmap";
+	static constexpr const char *Description =
+	    "Whether or not to memory-map database files that are opened in read-only mode instead of copying the blocks";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct UsernameSetting {
 	static constexpr const char *Name = "username";
 	static constexpr const char *Description = "The username to use. Ignored for legacy compatibility.";
@@ -340,4 +514,13 @@ struct UsernameSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct VerifyChecksumsOnceSetting {
+	static constexpr const char *Name = "verify_checksums_once";
+	static constexpr const char *Description =
+	    "Whether or not to only verify the checksum of a block the first time it is read from the database file";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static Value GetSetting(ClientContext &context);
+};
+
 } // namespace duckdb
@@ -96,6 +96,7 @@ public:
 	double EstimateCardinalityWithSet(JoinRelationSet *new_set);
 	void EstimateBaseTableCardinality(JoinNode *node, LogicalOperator *op);
 	double EstimateCrossProduct(const JoinNode *left, const JoinNode *right);
+	//! Computes the cost of joining left with right, where right is the build side of the join
 	static double ComputeCost(JoinNode *left, JoinNode *right, double expected_cardinality);
 
 private:
@@ -114,8 +115,10 @@ private:
 	void AddRelationTdom(FilterInfo *filter_info);
 	bool EmptyFilter(FilterInfo *filter_info);
 
+	//! Estimates the equality and range filters of the conjunction, range filters from the row group statistics of
+	//! the table (if any)
 	idx_t InspectConjunctionAND(idx_t cardinality, idx_t column_index, ConjunctionAndFilter *fil,
-	                            unique_ptr<BaseStatistics> base_stats);
+	                            unique_ptr<BaseStatistics> base_stats, DataTable *table, bool &has_range_estimate);
 	idx_t InspectConjunctionOR(idx_t cardinality, idx_t column_index, ConjunctionOrFilter *fil,
 	                           unique_ptr<BaseStatistics> base_stats);
 	idx_t InspectTableFilters(idx_t cardinality, LogicalOperator *op, TableFilterSet *table_filters);
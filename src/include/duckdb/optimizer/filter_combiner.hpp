@@ -56,6 +56,9 @@ private:
 	FilterResult AddBoundComparisonFilter(Expression *expr);
 	FilterResult AddTransitiveFilters(BoundComparisonExpression &comparison);
 	unique_ptr<Expression> FindTransitiveFilter(Expression *expr);
+	//! Generates a copy of an IN filter on a constant list for every other expression in the equivalence set of its
+	//! input, i.e. [X = Y and X IN (1, 2)] => [Y IN (1, 2)]
+	void TransferInFilter(Expression &filter, const std::function<void(unique_ptr<Expression> filter)> &callback);
 	// unordered_map<idx_t, std::pair<Value *, Value *>>
 	// FindZonemapChecks(vector<idx_t> &column_ids, unordered_set<idx_t> &not_constants, Expression *filter);
 	Expression *GetNode(Expression *expr);
@@ -24,6 +24,10 @@ namespace duckdb {
 
 class JoinOrderOptimizer {
 public:
+	//! The maximum amount of relations for which the linearized dynamic programming is used when the exact dynamic
+	//! programming times out
+	static constexpr const idx_t LINEARIZED_DP_THRESHOLD = 100;
+
 	explicit JoinOrderOptimizer(ClientContext &context)
 	    : context(context), cardinality_estimator(context), full_plan_found(false), must_update_full_plan(false) {
 	}
@@ -96,6 +100,12 @@ private:
 	//! Solve the join order exactly using dynamic programming. Returns true if it was completed successfully (i.e. did
 	//! not time-out)
 	bool SolveJoinOrderExactly();
+	//! Compute a left-deep order of all relations in which every relation is connected to the relations before it.
+	//! Returns false if there is no such order (i.e. the query graph is disconnected)
+	bool LinearizeJoinOrder(vector<idx_t> &order);
+	//! Solve the join order using dynamic programming over the intervals of a linearized join order (Neumann and
+	//! Radke, "Adaptive Optimization of Very Large Join Queries"). Returns false if no linear order could be found
+	bool SolveJoinOrderLinearized();
 	//! Solve the join order approximately using a greedy algorithm
 	void SolveJoinOrderApproximately();
 
@@ -90,6 +90,10 @@ private:
 	unique_ptr<BaseStatistics> PropagateExpression(BoundOperatorExpression &expr, unique_ptr<Expression> *expr_ptr);
 
 	void PropagateAndCompress(unique_ptr<Expression> &expr, unique_ptr<BaseStatistics> &stats);
+	//! Compresses the integral keys of the equality conditions of a join to the smallest type that fits both sides
+	void CompressJoinConditions(LogicalComparisonJoin &join);
+	//! Compresses the integral groups of an aggregate, and decompresses them in the projection on top of it
+	void CompressAggregateGroups(LogicalProjection &proj, LogicalAggregate &aggr);
 
 	void ReplaceWithEmptyResult(unique_ptr<LogicalOperator> &node);
 
@@ -11,13 +11,30 @@
 #include "duckdb/common/constants.hpp"
 
 namespace duckdb {
+class Binder;
+class ClientContext;
 class LogicalOperator;
+class LogicalTopN;
 class Optimizer;
 
 class TopN {
 public:
+	TopN(ClientContext &context, Binder &binder) : context(context), binder(binder) {
+	}
+
 	//! Optimize ORDER BY + LIMIT to TopN
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	ClientContext &context;
+	Binder &binder;
+
+private:
+	//! Turn the table scan below a TopN on an indexed column into an index scan of the first rows in key order
+	void PushdownOrderedIndexScan(LogicalTopN &topn);
+	//! Sort only the columns of the table scan below a TopN that the orders need, and fetch the other columns of the
+	//! remaining rows by their row id
+	unique_ptr<LogicalOperator> LateMaterialization(unique_ptr<LogicalOperator> op);
 };
 
 } // namespace duckdb
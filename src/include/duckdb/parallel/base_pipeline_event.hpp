@@ -23,6 +23,12 @@ public:
 		pipeline->Print();
 	}
 
+	idx_t EstimatedCost() const override;
+
+	string GetName() const override {
+		return "Event " + pipeline->GetName();
+	}
+
 	//! The pipeline that this event belongs to
 	shared_ptr<Pipeline> pipeline;
 };
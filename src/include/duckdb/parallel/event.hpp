@@ -52,6 +52,19 @@ public:
 	virtual void PrintPipeline() {
 	}
 
+	//! The name of the event in the execution trace
+	virtual string GetName() const {
+		return "Event";
+	}
+	//! Records the time at which the event is scheduled, if the execution is traced
+	void TraceSchedule();
+
+	//! The estimated amount of work of the event. Events that can start at the same time are scheduled from most to
+	//! least expensive.
+	virtual idx_t EstimatedCost() const {
+		return 0;
+	}
+
 protected:
 	Executor &executor;
 	//! The current threads working on the event
@@ -72,6 +85,8 @@ protected:
 
 	//! Whether or not the event is finished executing
 	atomic<bool> finished;
+	//! The time at which the event was scheduled in the execution trace
+	uint64_t trace_start;
 };
 
 } // namespace duckdb
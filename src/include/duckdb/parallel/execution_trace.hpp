@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/execution_trace.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/vector.hpp"
+
+#include <thread>
+
+namespace duckdb {
+
+//! A span of time that a thread spent on a task, an event or waiting
+struct TraceEvent {
+	string name;
+	//! The kind of span (task, event or wait)
+	const char *category;
+	//! The thread that recorded the span
+	idx_t thread;
+	//! The start of the span in microseconds since the start of the trace
+	uint64_t start;
+	//! The duration of the span in microseconds
+	uint64_t duration;
+};
+
+//! The ExecutionTrace records when each thread executed the tasks and events of a query, and when the thread that
+//! drives the query waited for others. It is written in the Chrome trace format, which can be viewed with
+//! chrome://tracing or Perfetto
+class ExecutionTrace {
+public:
+	ExecutionTrace();
+
+	//! Returns the microseconds since the start of the trace
+	uint64_t Now() const;
+	//! Adds a span that the calling thread spent between start and end
+	void AddEvent(string name, const char *category, uint64_t start, uint64_t end);
+
+	string ToJSON();
+	void WriteToFile(const string &path);
+
+private:
+	std::chrono::steady_clock::time_point trace_start;
+	mutex lock;
+	vector<TraceEvent> events;
+	//! The numbers of the threads, in the order in which they recorded their first span
+	unordered_map<std::thread::id, idx_t> threads;
+};
+
+//! Adds the time between its construction and destruction as a span to the trace, if there is one
+class TraceSpan {
+public:
+	TraceSpan(ExecutionTrace *trace, string name_p, const char *category)
+	    : trace(trace), name(move(name_p)), category(category), start(trace ? trace->Now() : 0) {
+	}
+	~TraceSpan() {
+		if (trace) {
+			trace->AddEvent(move(name), category, start, trace->Now());
+		}
+	}
+
+private:
+	ExecutionTrace *trace;
+	string name;
+	const char *category;
+	uint64_t start;
+};
+
+} // namespace duckdb
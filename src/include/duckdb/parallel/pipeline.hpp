@@ -73,11 +73,14 @@ public:
 	void Finalize(Event &event);
 
 	string ToString() const;
+	//! Returns a short name of the pipeline, i.e. its source and sink
+	string GetName() const;
 	void Print() const;
 	void PrintDependencies() const;
 
-	//! Returns query progress
-	bool GetProgress(double &current_percentage, idx_t &estimated_cardinality);
+	//! Returns the progress of the pipeline (in percent), the amount of rows its source has produced, and the
+	//! estimated amount of rows its source produces in total
+	void GetProgress(double &current_percentage, idx_t &rows_processed, idx_t &total_rows);
 
 	//! Returns a list of all operators (including source and sink) involved in this pipeline
 	vector<PhysicalOperator *> GetOperators() const;
@@ -98,6 +101,10 @@ private:
 	bool ready;
 	//! Whether or not the pipeline has been initialized
 	atomic<bool> initialized;
+	//! Whether or not all tasks of the pipeline have finished
+	atomic<bool> finished;
+	//! The amount of rows the source of the pipeline has produced
+	atomic<idx_t> source_rows;
 	//! The source of this pipeline
 	PhysicalOperator *source = nullptr;
 	//! The chain of intermediate operators
@@ -22,6 +22,10 @@ public:
 public:
 	void Schedule() override;
 	void FinalizeFinish() override;
+
+	string GetName() const override {
+		return "Complete";
+	}
 };
 
 } // namespace duckdb
@@ -20,6 +20,10 @@ public:
 public:
 	void Schedule() override;
 	void FinishEvent() override;
+
+	string GetName() const override {
+		return "Pipeline " + pipeline->GetName();
+	}
 };
 
 } // namespace duckdb
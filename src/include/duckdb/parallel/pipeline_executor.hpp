@@ -85,6 +85,10 @@ private:
 	int32_t finished_processing_idx = -1;
 	//! Whether or not this pipeline requires keeping track of the batch index of the source
 	bool requires_batch_index = false;
+	//! The maximum amount of rows pushed through the operators at once (see ComputeChunkSize)
+	idx_t chunk_size = STANDARD_VECTOR_SIZE;
+	//! The chunk that references a slice of the source chunk if the source chunk has more than chunk_size rows
+	DataChunk slice_chunk;
 
 private:
 	void StartOperator(PhysicalOperator *op);
@@ -96,6 +100,8 @@ private:
 
 	void FinishProcessing(int32_t operator_idx = -1);
 	bool IsFinished();
+	//! Finishes processing if any of the operators or the sink no longer need input, returns whether or not it did
+	bool TryFinishEarly();
 
 	OperatorResultType ExecutePushInternal(DataChunk &input, idx_t initial_idx = 0);
 	//! Pushes a chunk through the pipeline and returns a single result chunk
@@ -106,6 +112,10 @@ private:
 	void FlushCachingOperatorsPull(DataChunk &result);
 	void FlushCachingOperatorsPush();
 
+	//! Pushes a chunk fetched from the source through the pipeline, in slices of at most chunk_size rows
+	OperatorResultType ExecutePushSource(DataChunk &source_chunk);
+	//! Computes the amount of rows per chunk for which the intermediate chunks of the pipeline fit in the cache
+	idx_t ComputeChunkSize();
 	static bool CanCacheType(const LogicalType &type);
 	void CacheChunk(DataChunk &input, idx_t operator_idx);
 };
@@ -21,6 +21,10 @@ public:
 public:
 	void Schedule() override;
 	void FinishEvent() override;
+
+	string GetName() const override {
+		return "Initialize " + pipeline->GetName();
+	}
 };
 
 } // namespace duckdb
@@ -18,6 +18,10 @@ enum class TaskExecutionMode : uint8_t { PROCESS_ALL, PROCESS_PARTIAL };
 
 enum class TaskExecutionResult : uint8_t { TASK_FINISHED, TASK_NOT_FINISHED, TASK_ERROR };
 
+//! The priority of the tasks of a producer. Tasks of LOW priority are executed when there are no other tasks, but are
+//! given a share of the threads so that they do not starve.
+enum class TaskPriority : uint8_t { NORMAL, LOW };
+
 //! Generic parallel task
 class Task {
 public:
@@ -44,6 +48,11 @@ public:
 public:
 	virtual TaskExecutionResult ExecuteTask(TaskExecutionMode mode) = 0;
 	TaskExecutionResult Execute(TaskExecutionMode mode) override;
+
+	//! The name of the task in the execution trace
+	virtual string GetName() const {
+		return "Task";
+	}
 };
 
 } // namespace duckdb
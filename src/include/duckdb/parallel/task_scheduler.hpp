@@ -45,7 +45,7 @@ public:
 	static TaskScheduler &GetScheduler(ClientContext &context);
 	static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	unique_ptr<ProducerToken> CreateProducer(TaskPriority priority = TaskPriority::NORMAL);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, unique_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
@@ -63,6 +63,8 @@ public:
 	void SetThreads(int32_t n);
 	//! Returns the number of threads
 	int32_t NumberOfThreads();
+	//! Stops and relaunches the background threads, e.g. to (un)pin them after the pin_threads setting changed
+	void RelaunchThreads();
 
 	//! Send signals to n threads, signalling for them to wake up and attempt to execute a task
 	void Signal(idx_t n);
@@ -28,6 +28,8 @@ struct CreateViewInfo : public CreateInfo {
 	vector<LogicalType> types;
 	//! The SelectStatement of the view
 	unique_ptr<SelectStatement> query;
+	//! Whether the results of the view are materialized
+	bool materialized = false;
 
 public:
 	unique_ptr<CreateInfo> Copy() const override {
@@ -36,6 +38,7 @@ public:
 		result->aliases = aliases;
 		result->types = types;
 		result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
+		result->materialized = materialized;
 		return move(result);
 	}
 
@@ -48,6 +51,7 @@ public:
 		result->aliases = reader.ReadRequiredList<string>();
 		result->types = reader.ReadRequiredSerializableList<LogicalType, LogicalType>();
 		result->query = reader.ReadOptional<SelectStatement>(nullptr);
+		result->materialized = reader.ReadField<bool>(false);
 		reader.Finalize();
 
 		return result;
@@ -60,6 +64,7 @@ protected:
 		writer.WriteList<string>(aliases);
 		writer.WriteRegularSerializableList(types);
 		writer.WriteOptional(query);
+		writer.WriteField<bool>(materialized);
 		writer.Finalize();
 	}
 };
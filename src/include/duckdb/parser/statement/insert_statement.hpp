@@ -11,6 +11,7 @@
 #include "duckdb/parser/parsed_expression.hpp"
 #include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/parser/query_node.hpp"
+#include "duckdb/common/enums/on_conflict_action.hpp"
 
 namespace duckdb {
 class ExpressionListRef;
@@ -35,6 +36,11 @@ public:
 	//! CTEs
 	CommonTableExpressionMap cte_map;
 
+	//! What to do with tuples that violate a UNIQUE or PRIMARY KEY constraint
+	OnConflictAction on_conflict_action = OnConflictAction::THROW;
+	//! The columns of the constraint named in the ON CONFLICT clause (if any)
+	vector<string> on_conflict_columns;
+
 protected:
 	InsertStatement(const InsertStatement &other);
 
@@ -24,6 +24,12 @@ public:
 	std::string file_path;
 	bool use_tmp_file;
 	bool is_file_and_exists;
+	//! The columns that the output is partitioned on (if any), every partition is written to its own directory
+	vector<idx_t> partition_columns;
+	//! The names of the columns of the source
+	vector<string> names;
+	//! The (approximate) maximum amount of rows in a file of a partition, 0 if there is no maximum
+	idx_t rows_per_file = 0;
 
 public:
 	void Serialize(FieldWriter &writer) const override;
@@ -10,6 +10,7 @@
 
 #include "duckdb/planner/logical_operator.hpp"
 #include "duckdb/common/index_vector.hpp"
+#include "duckdb/common/enums/on_conflict_action.hpp"
 
 namespace duckdb {
 
@@ -18,7 +19,7 @@ class LogicalInsert : public LogicalOperator {
 public:
 	LogicalInsert(TableCatalogEntry *table, idx_t table_index)
 	    : LogicalOperator(LogicalOperatorType::LOGICAL_INSERT), table(table), table_index(table_index),
-	      return_chunk(false) {
+	      return_chunk(false), action_type(OnConflictAction::THROW) {
 	}
 
 	vector<vector<unique_ptr<Expression>>> insert_values;
@@ -33,6 +34,8 @@ public:
 	bool return_chunk;
 	//! The default statements used by the table
 	vector<unique_ptr<Expression>> bound_defaults;
+	//! What to do with tuples that violate a UNIQUE or PRIMARY KEY constraint
+	OnConflictAction action_type;
 
 public:
 	void Serialize(FieldWriter &writer) const override;
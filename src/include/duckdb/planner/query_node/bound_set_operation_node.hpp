@@ -22,6 +22,8 @@ public:
 
 	//! The type of set operation
 	SetOperationType setop_type = SetOperationType::NONE;
+	//! Whether the ALL modifier was specified (i.e. duplicates are not eliminated)
+	bool setop_all = false;
 	//! The left side of the set operation
 	unique_ptr<BoundQueryNode> left;
 	//! The right side of the set operation
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/enums/filter_propagate_result.hpp"
@@ -85,4 +86,20 @@ public:
 	static unique_ptr<TableFilterSet> Deserialize(Deserializer &source);
 };
 
+//! DynamicTableFilterSet holds table filters that are only known while the query is running (e.g. the boundary
+//! value of a Top-N). They are checked against the zonemaps of row groups that have not been scanned yet.
+class DynamicTableFilterSet {
+public:
+	//! Replaces the current filters
+	void SetFilters(unique_ptr<TableFilterSet> new_filters);
+	//! Removes the current filters, e.g. before the plan is executed again
+	void Reset();
+	//! Returns the current filters (if any)
+	shared_ptr<TableFilterSet> GetFilters();
+
+private:
+	mutex lock;
+	shared_ptr<TableFilterSet> filters;
+};
+
 } // namespace duckdb
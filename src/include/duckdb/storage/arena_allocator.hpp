@@ -41,6 +41,8 @@ public:
 	ArenaChunk *GetTail();
 
 	bool IsEmpty();
+	//! The total size of the allocated arena chunks
+	idx_t SizeInBytes() const;
 
 private:
 	//! Internal allocator that is used by the arena allocator
@@ -19,6 +19,8 @@ public:
 	Block(Allocator &allocator, block_id_t id);
 	Block(Allocator &allocator, block_id_t id, uint32_t internal_size);
 	Block(FileBuffer &source, block_id_t id);
+	//! Wraps a block of a memory-mapped file
+	Block(Allocator &allocator, block_id_t id, data_ptr_t mapped_buffer);
 
 	block_id_t id;
 };
@@ -46,10 +46,22 @@ public:
 	//! Increase the reference count of a block. The block should hold at least one reference before this method is
 	//! called.
 	virtual void IncreaseBlockReferenceCount(block_id_t block_id) = 0;
+	//! Mark a block that is referenced by data that is replayed from the WAL as used. If the block is already in use,
+	//! its reference count is increased instead.
+	virtual void MarkBlockAsUsed(block_id_t block_id) {
+	}
 	//! Get the first meta block id
 	virtual block_id_t GetMetaBlock() = 0;
 	//! Read the content of the block from disk
 	virtual void Read(Block &block) = 0;
+	//! Hint that the block will be read soon, so that reading it from disk can be started in the background
+	virtual void Prefetch(block_id_t block_id) {
+	}
+	//! Returns a block that directly references the block in the memory-mapped database file, or nullptr if the
+	//! block manager does not map its file
+	virtual unique_ptr<Block> ReadMapped(block_id_t block_id) {
+		return nullptr;
+	}
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
@@ -58,11 +70,19 @@ public:
 	}
 	//! Write the header; should be the final step of a checkpoint
 	virtual void WriteHeader(DatabaseHeader header) = 0;
+	//! Ensures that the blocks that have been written so far are persisted on disk
+	virtual void FileSync() {
+	}
 
 	//! Returns the number of total blocks
 	virtual idx_t TotalBlocks() = 0;
 	//! Returns the number of free blocks
 	virtual idx_t FreeBlocks() = 0;
+	//! Returns the block id from which blocks should be relocated to free blocks at the start of the file when they
+	//! are rewritten, or INVALID_BLOCK if there is no need to relocate any blocks
+	virtual block_id_t GetRelocationThreshold() {
+		return INVALID_BLOCK;
+	}
 
 	//! Register a block with the given block id in the base file
 	shared_ptr<BlockHandle> RegisterBlock(block_id_t block_id);
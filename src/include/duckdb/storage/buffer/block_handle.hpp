@@ -107,6 +107,8 @@ private:
 	unique_ptr<FileBuffer> buffer;
 	//! Internal eviction timestamp
 	atomic<idx_t> eviction_timestamp;
+	//! Whether or not the block was pinned again while it was loaded
+	atomic<bool> reused;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
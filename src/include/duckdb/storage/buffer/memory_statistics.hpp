@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/buffer/memory_statistics.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The MemoryStatistics accumulate the buffer pool activity of a thread: the buffer manager charges every change in
+//! reserved memory, every spilled buffer and every buffer read back from a temporary file to the statistics of the
+//! calling thread. The profiler attributes the activity to operators by taking the difference over their execution.
+struct MemoryStatistics {
+	//! The memory reserved minus the memory released by the thread. Releasing memory reserved by another thread
+	//! (e.g. by evicting its buffers) can make this negative.
+	int64_t current_memory = 0;
+	//! The peak of current_memory since the last call to ResetPeak
+	int64_t peak_memory = 0;
+	//! The total memory reserved (in bytes)
+	idx_t allocated_bytes = 0;
+	//! The amount of bytes written to temporary files
+	idx_t spilled_bytes = 0;
+	//! The amount of bytes read back from temporary files
+	idx_t read_bytes = 0;
+
+	void AddMemory(int64_t delta) {
+		current_memory += delta;
+		if (delta > 0) {
+			allocated_bytes += delta;
+		}
+		if (current_memory > peak_memory) {
+			peak_memory = current_memory;
+		}
+	}
+	void ResetPeak() {
+		peak_memory = current_memory;
+	}
+
+	//! Returns the statistics of the calling thread
+	static MemoryStatistics &Get();
+};
+
+//! The buffer pool usage of an operator
+struct OperatorMemoryStatistics {
+	//! The memory reserved minus the memory released by the operator (in bytes)
+	int64_t current_memory = 0;
+	//! The peak of current_memory (in bytes)
+	idx_t peak_memory = 0;
+	//! The total memory reserved by the operator (in bytes)
+	idx_t allocated_bytes = 0;
+	//! The amount of bytes spilled to temporary files by the operator
+	idx_t spilled_bytes = 0;
+	//! The amount of bytes read back from temporary files by the operator
+	idx_t read_bytes = 0;
+
+	//! Whether any of the statistics has a value
+	bool HasValues() const {
+		return peak_memory > 0 || allocated_bytes > 0 || spilled_bytes > 0 || read_bytes > 0;
+	}
+	//! Adds the activity of the thread between the start and the end snapshot, where the peak of the thread was reset
+	//! when the start snapshot was taken
+	void Add(const MemoryStatistics &start, const MemoryStatistics &end) {
+		auto peak = current_memory + end.peak_memory - start.current_memory;
+		if (peak > 0 && idx_t(peak) > peak_memory) {
+			peak_memory = peak;
+		}
+		current_memory += end.current_memory - start.current_memory;
+		allocated_bytes += end.allocated_bytes - start.allocated_bytes;
+		spilled_bytes += end.spilled_bytes - start.spilled_bytes;
+		read_bytes += end.read_bytes - start.read_bytes;
+	}
+	//! Merges the statistics of the same operator collected on another thread. As the threads run concurrently, the
+	//! peaks are summed, which gives an upper bound of the peak memory of the operator.
+	OperatorMemoryStatistics &operator+=(const OperatorMemoryStatistics &other) {
+		current_memory += other.current_memory;
+		peak_memory += other.peak_memory;
+		allocated_bytes += other.allocated_bytes;
+		spilled_bytes += other.spilled_bytes;
+		read_bytes += other.read_bytes;
+		return *this;
+	}
+};
+
+} // namespace duckdb
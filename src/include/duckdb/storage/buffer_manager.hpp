@@ -22,6 +22,7 @@ class BlockManager;
 class DatabaseInstance;
 class TemporaryDirectoryHandle;
 struct EvictionQueue;
+struct FreeBufferPool;
 
 //! The buffer manager is in charge of handling memory management for the database. It hands out memory buffers that can
 //! be used by the database internally.
@@ -52,6 +53,9 @@ public:
 
 	BufferHandle Pin(shared_ptr<BlockHandle> &handle);
 	void Unpin(shared_ptr<BlockHandle> &handle);
+	//! Hint that a block will be pinned soon. If the block is a persistent block or was written to a temporary file,
+	//! reading it is started in the background, so that the Pin does not have to wait for the disk.
+	void Prefetch(shared_ptr<BlockHandle> &handle);
 
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
 	//! blocks can be evicted
@@ -66,6 +70,28 @@ public:
 	idx_t GetMaxMemory() {
 		return maximum_memory;
 	}
+	//! Returns the amount of memory held by freed managed buffers that are kept around for re-use (in bytes)
+	idx_t GetPooledMemory() {
+		return pooled_memory;
+	}
+	//! Returns the peak amount of memory reserved through the buffer manager since the last ResetPeakMemory
+	idx_t GetPeakMemory() {
+		return peak_memory;
+	}
+	void ResetPeakMemory() {
+		peak_memory = current_memory.load();
+	}
+	//! Returns the total amount of bytes written to temporary files
+	idx_t GetSpilledBytes() {
+		return spilled_bytes;
+	}
+	//! Returns the total amount of bytes read back from temporary files
+	idx_t GetTemporaryReadBytes() {
+		return temporary_read_bytes;
+	}
+	//! Returns the maximum amount of memory that the operators of a single query of the client context plan to use
+	//! before spilling to disk, i.e. the memory limit capped at the query memory limit of the client
+	idx_t GetQueryMaxMemory(ClientContext &context);
 
 	const string &GetTemporaryDirectory() {
 		return temp_directory;
@@ -119,6 +145,14 @@ private:
 	//! Garbage collect eviction queue
 	void PurgeQueue();
 
+	//! Try to add the buffer of a managed block that is being destroyed to the pool of free buffers, so that it can be
+	//! re-used by a later allocation of the same size. On success the reservation is released and true is returned.
+	bool RecycleBuffer(unique_ptr<FileBuffer> &buffer, BufferPoolReservation &reservation);
+	//! Take a free buffer with the given allocation size from the pool, or nullptr if there is none
+	unique_ptr<FileBuffer> TakePooledBuffer(idx_t alloc_size);
+	//! Free one buffer from the pool, returns false if the pool is empty
+	bool ReleasePooledBuffer();
+
 	//! Write a temporary buffer to disk
 	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer);
 	//! Read a temporary buffer from disk
@@ -152,6 +186,14 @@ private:
 	atomic<idx_t> current_memory;
 	//! The maximum amount of memory that the buffer manager can keep (in bytes)
 	atomic<idx_t> maximum_memory;
+	//! The amount of memory held by the buffers in the free buffer pool (in bytes)
+	atomic<idx_t> pooled_memory;
+	//! The peak of current_memory since it was last reset (in bytes)
+	atomic<idx_t> peak_memory;
+	//! The total amount of bytes written to temporary files
+	atomic<idx_t> spilled_bytes;
+	//! The total amount of bytes read back from temporary files
+	atomic<idx_t> temporary_read_bytes;
 	//! The directory name where temporary files are stored
 	string temp_directory;
 	//! Lock for creating the temp handle
@@ -160,6 +202,8 @@ private:
 	unique_ptr<TemporaryDirectoryHandle> temp_directory_handle;
 	//! Eviction queue
 	unique_ptr<EvictionQueue> queue;
+	//! Pool of freed managed buffers, grouped by allocation size
+	unique_ptr<FreeBufferPool> free_buffers;
 	//! The temporary id used for managed buffers
 	atomic<block_id_t> temporary_id;
 	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
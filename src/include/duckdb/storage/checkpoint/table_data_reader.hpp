@@ -11,18 +11,20 @@
 #include "duckdb/storage/checkpoint_manager.hpp"
 
 namespace duckdb {
-struct BoundCreateTableInfo;
+class PersistentTableData;
 
 //! The table data reader is responsible for reading the data of a table from the block manager
 class TableDataReader {
 public:
-	TableDataReader(MetaBlockReader &reader, BoundCreateTableInfo &info);
+	TableDataReader(MetaBlockReader &reader, const vector<LogicalType> &types, PersistentTableData &data);
 
 	void ReadTableData();
 
 private:
 	MetaBlockReader &reader;
-	BoundCreateTableInfo &info;
+	//! The types of the physical columns of the table
+	const vector<LogicalType> &types;
+	PersistentTableData &data;
 };
 
 } // namespace duckdb
@@ -39,7 +39,7 @@ public:
 		auto &type = checkpointer.GetType();
 		auto &config = DBConfig::GetConfig(db);
 		function = config.GetCompressionFunction(CompressionType::COMPRESSION_CHIMP, type.InternalType());
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetRowStart());
 
 		// These buffers are recycled for every group, so they only have to be set once
 		state.AssignLeadingZeroBuffer((uint8_t *)leading_zero_blocks);
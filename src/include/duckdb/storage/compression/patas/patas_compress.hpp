@@ -63,7 +63,7 @@ public:
 		auto &type = checkpointer.GetType();
 		auto &config = DBConfig::GetConfig(db);
 		function = config.GetCompressionFunction(CompressionType::COMPRESSION_PATAS, type.InternalType());
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetRowStart());
 
 		state.data_ptr = (void *)this;
 		state.patas_state.packed_data_buffer.SetBuffer(packed_data);
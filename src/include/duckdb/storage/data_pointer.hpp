@@ -33,6 +33,8 @@ struct RowGroupPointer {
 	vector<BlockPointer> data_pointers;
 	//! The per-column statistics of the row group
 	vector<unique_ptr<BaseStatistics>> statistics;
+	//! The per-column Bloom filters of the row group (if any)
+	vector<shared_ptr<ColumnBloomFilter>> bloom_filters;
 	//! The versions information of the row group (if any)
 	shared_ptr<VersionNode> versions;
 };
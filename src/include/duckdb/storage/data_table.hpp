@@ -28,6 +28,8 @@ class ClientContext;
 class ColumnDataCollection;
 class ColumnDefinition;
 class DataTable;
+class Expression;
+class ExpressionExecutor;
 class OptimisticDataWriter;
 class RowGroup;
 class StorageManager;
@@ -37,6 +39,23 @@ class Transaction;
 class WriteAheadLog;
 class TableDataWriter;
 
+//! The state for verifying the constraints of the chunks that are appended to a table. The expressions of the
+//! generated columns are bound, and the expression executors are created, once per append instead of once per chunk.
+struct ConstraintState {
+	ConstraintState(TableCatalogEntry &table, ClientContext &context);
+	~ConstraintState();
+
+	TableCatalogEntry &table;
+	//! The bound expressions of the generated columns, and the columns they compute
+	vector<unique_ptr<Expression>> generated_expressions;
+	vector<column_t> generated_columns;
+	unique_ptr<ExpressionExecutor> generated_executor;
+	DataChunk generated_chunk;
+	//! The executor of the expressions of the CHECK constraints, in the order of the constraints
+	unique_ptr<ExpressionExecutor> check_executor;
+	DataChunk check_chunk;
+};
+
 //! DataTable represents a physical table on disk
 class DataTable {
 public:
@@ -74,6 +93,9 @@ public:
 	idx_t MaxThreads(ClientContext &context);
 	void InitializeParallelScan(ClientContext &context, ParallelTableScanState &state);
 	bool NextParallelScan(ClientContext &context, ParallelTableScanState &state, TableScanState &scan_state);
+	//! Skips the entire row groups and vectors of a parallel scan that only contain rows among the first count rows
+	//! of the table, returns the amount of skipped rows
+	idx_t SkipParallelScan(ClientContext &context, ParallelTableScanState &state, idx_t count);
 
 	//! Scans up to STANDARD_VECTOR_SIZE elements from the table starting
 	//! from offset and store them in result. Offset is incremented with how many
@@ -95,6 +117,9 @@ public:
 	void LocalAppend(TableCatalogEntry &table, ClientContext &context, DataChunk &chunk);
 	//! Append a column data collection to the transaction-local storage of this table
 	void LocalAppend(TableCatalogEntry &table, ClientContext &context, ColumnDataCollection &collection);
+	//! Append the chunks filled by the callback to the transaction-local storage of this table, until it returns false
+	void LocalAppend(TableCatalogEntry &table, ClientContext &context,
+	                 const std::function<bool(DataChunk &chunk)> &next_chunk);
 	//! Merge a row group collection into the transaction-local storage
 	void LocalMerge(ClientContext &context, RowGroupCollection &collection);
 	//! Creates an optimistic writer for this table - used for optimistically writing parallel appends
@@ -159,6 +184,13 @@ public:
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
 	//! Sets statistics of a physical column within the table
 	void SetStatistics(column_t column_id, const std::function<void(BaseStatistics &)> &set_fun);
+	//! Computes the number of rows visible to the transaction and the exact min and max of the given (numeric) columns
+	//! without scanning the table. Returns false if the statistics are not exact for the transaction
+	bool GetExactStatistics(Transaction &transaction, const vector<column_t> &column_ids, idx_t &visible_count,
+	                        vector<Value> &min_values, vector<Value> &max_values);
+	//! Estimates the fraction of the rows whose value in the column lies between lower and upper from the row group
+	//! statistics. Returns -1 if unknown
+	double EstimateRangeSelectivity(column_t column_id, const Value &lower, const Value &upper);
 
 	//! Checkpoint the table to the specified table data writer
 	void Checkpoint(TableDataWriter &writer);
@@ -177,6 +209,11 @@ public:
 
 	//! Verify constraints with a chunk from the Append containing all columns of the table
 	void VerifyAppendConstraints(TableCatalogEntry &table, ClientContext &context, DataChunk &chunk);
+	//! Verify constraints with a chunk from the Append, reusing the state of the previous chunks of the append
+	void VerifyAppendConstraints(ConstraintState &state, ClientContext &context, DataChunk &chunk);
+	//! Removes the rows that violate a UNIQUE or PRIMARY KEY constraint from the chunk (ON CONFLICT DO NOTHING).
+	//! Rows are checked against the committed data, the transaction-local data and the preceding rows of the chunk
+	void FilterUniqueConflicts(ClientContext &context, DataChunk &chunk);
 
 private:
 	//! Verify the new added constraints against current persistent&local data
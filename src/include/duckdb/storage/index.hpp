@@ -72,6 +72,9 @@ public:
 	bool Append(DataChunk &entries, Vector &row_identifiers);
 	//! Verify that data can be appended to the index
 	virtual void VerifyAppend(DataChunk &chunk) = 0;
+	//! Verify that data can be appended to the index, storing an error message for every conflicting row instead of
+	//! throwing. Rows whose key already occurs earlier in the chunk conflict as well
+	virtual void VerifyAppend(DataChunk &chunk, string *err_msg_ptr) = 0;
 	//! Verify that data can be appended to the index for foreign key constraint
 	virtual void VerifyAppendForeignKey(DataChunk &chunk, string *err_msg_ptr) = 0;
 	//! Verify that data can be delete from the index for foreign key constraint
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/list.hpp"
 #include "duckdb/common/string.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -25,17 +27,27 @@ public:
 	}
 
 	virtual string GetObjectType() = 0;
+	//! The (estimated) amount of memory used by the entry, which counts towards the size limit of the cache
+	virtual idx_t EstimatedSize() {
+		return 0;
+	}
 };
 
+//! The ObjectCache is a database-wide LRU cache of objects, e.g. the metadata of Parquet files. The total (estimated)
+//! size of the cached objects is limited by the object_cache_size setting.
 class ObjectCache {
 public:
+	explicit ObjectCache(idx_t max_memory_p = NumericLimits<idx_t>::Maximum()) : max_memory(max_memory_p) {
+	}
+
 	shared_ptr<ObjectCacheEntry> GetObject(const string &key) {
 		lock_guard<mutex> glock(lock);
 		auto entry = cache.find(key);
 		if (entry == cache.end()) {
 			return nullptr;
 		}
-		return entry->second;
+		lru.splice(lru.begin(), lru, entry->second.lru_position);
+		return entry->second.object;
 	}
 
 	template <class T>
@@ -49,15 +61,63 @@ public:
 
 	void Put(string key, shared_ptr<ObjectCacheEntry> value) {
 		lock_guard<mutex> glock(lock);
-		cache[key] = move(value);
+		auto entry = cache.find(key);
+		if (entry != cache.end()) {
+			// replace the existing entry
+			memory_usage -= entry->second.size;
+			lru.erase(entry->second.lru_position);
+			cache.erase(entry);
+		}
+		CacheEntry new_entry;
+		new_entry.size = value->EstimatedSize();
+		new_entry.object = move(value);
+		lru.push_front(key);
+		new_entry.lru_position = lru.begin();
+		memory_usage += new_entry.size;
+		cache[move(key)] = move(new_entry);
+		EvictInternal();
+	}
+
+	//! Sets the maximum size of the cache, evicting the least recently used entries if it is exceeded
+	void SetMaxMemory(idx_t max_memory_p) {
+		lock_guard<mutex> glock(lock);
+		max_memory = max_memory_p;
+		EvictInternal();
+	}
+
+	//! The total (estimated) size of the cached objects
+	idx_t GetMemoryUsage() {
+		lock_guard<mutex> glock(lock);
+		return memory_usage;
 	}
 
 	DUCKDB_API static ObjectCache &GetObjectCache(ClientContext &context);
 	DUCKDB_API static bool ObjectCacheEnabled(ClientContext &context);
 
 private:
+	void EvictInternal() {
+		while (memory_usage > max_memory && !lru.empty()) {
+			auto entry = cache.find(lru.back());
+			D_ASSERT(entry != cache.end());
+			memory_usage -= entry->second.size;
+			cache.erase(entry);
+			lru.pop_back();
+		}
+	}
+
+private:
+	struct CacheEntry {
+		shared_ptr<ObjectCacheEntry> object;
+		idx_t size;
+		list<string>::iterator lru_position;
+	};
 	//! Object Cache
-	unordered_map<string, shared_ptr<ObjectCacheEntry>> cache;
+	unordered_map<string, CacheEntry> cache;
+	//! The keys of the cached objects, from most to least recently used
+	list<string> lru;
+	//! The maximum and the current total size of the cached objects
+	idx_t max_memory;
+	idx_t memory_usage = 0;
 	mutex lock;
 };
 
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/meta_block_writer.hpp"
 #include "duckdb/storage/data_pointer.hpp"
@@ -63,6 +64,8 @@ struct PartialBlockAllocation {
 //! Enables sharing blocks across some scope. Scope is whatever we want to share
 //! blocks across. It may be an entire checkpoint or just a single row group.
 //! In any case, they must share a block manager.
+//! The partial block manager can be used by multiple threads at the same time (e.g. when row groups are
+//! checkpointed in parallel): a partial block is handed out to a single writer until it is registered again.
 class PartialBlockManager {
 public:
 	// 20% free / 80% utilization
@@ -94,6 +97,8 @@ public:
 
 protected:
 	BlockManager &block_manager;
+	//! Lock protecting the set of partially filled blocks
+	mutex partial_block_lock;
 	//! A map of (available space -> PartialBlock) for partially filled blocks
 	//! This is a multimap because there might be outstanding partial blocks with
 	//! the same amount of left-over space
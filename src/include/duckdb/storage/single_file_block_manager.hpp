@@ -23,9 +23,12 @@ class DatabaseInstance;
 class SingleFileBlockManager : public BlockManager {
 	//! The location in the file where the block writing starts
 	static constexpr uint64_t BLOCK_START = Storage::FILE_HEADER_SIZE * 3;
+	//! Blocks are relocated to the start of the file once at least 1/RELOCATION_FREE_RATIO of the blocks are free
+	static constexpr idx_t RELOCATION_FREE_RATIO = 4;
 
 public:
 	SingleFileBlockManager(DatabaseInstance &db, string path, bool read_only, bool create_new, bool use_direct_io);
+	~SingleFileBlockManager() override;
 
 	//! Creates a new Block using the specified block_id and returns a pointer
 	unique_ptr<Block> CreateBlock(block_id_t block_id, FileBuffer *source_buffer) override;
@@ -39,28 +42,40 @@ public:
 	void MarkBlockAsModified(block_id_t block_id) override;
 	//! Increase the reference count of a block. The block should hold at least one reference
 	void IncreaseBlockReferenceCount(block_id_t block_id) override;
+	void MarkBlockAsUsed(block_id_t block_id) override;
 	//! Return the meta block id
 	block_id_t GetMetaBlock() override;
 	//! Read the content of the block from disk
 	void Read(Block &block) override;
+	//! Returns a block that references the memory-mapped database file, if the file is mapped
+	unique_ptr<Block> ReadMapped(block_id_t block_id) override;
+	//! Start reading the block from disk in the background
+	void Prefetch(block_id_t block_id) override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
 	void WriteHeader(DatabaseHeader header) override;
+	void FileSync() override;
 
 	//! Returns the number of total blocks
 	idx_t TotalBlocks() override;
 	//! Returns the number of free blocks
 	idx_t FreeBlocks() override;
+	//! Returns the block id from which blocks should be relocated, if a large part of the file is free
+	block_id_t GetRelocationThreshold() override;
 
 private:
 	//! Load the free list from the file
 	void LoadFreeList();
 
 	void Initialize(DatabaseHeader &header);
+	//! Map the database file into memory, only used for read-only databases
+	void MapFile();
 
 	//! Return the blocks to which we will write the free list and modified blocks
 	vector<block_id_t> GetFreeListBlocks();
+	//! Remove the free blocks at the end of the file from the free list and truncate the file
+	void TruncateFreeBlocks();
 
 private:
 	DatabaseInstance &db;
@@ -92,7 +107,21 @@ private:
 	bool read_only;
 	//! Whether or not to use Direct IO to read the blocks
 	bool use_direct_io;
+	//! The memory-mapped database file (if any)
+	data_ptr_t mapped_file;
+	//! The size of the memory-mapped region
+	idx_t mapped_size;
 	//! Lock for performing various operations in the single file block manager
 	mutex block_lock;
+	//! The blocks of which the checksum was verified since they were last written (if verify_checksums_once is set)
+	unordered_set<block_id_t> verified_blocks;
+	//! Lock for the verified blocks
+	mutex verified_lock;
+
+private:
+	//! Verifies the checksum of a block that was read from the file, unless it was verified before
+	void VerifyChecksum(FileBuffer &block, block_id_t block_id);
+	//! Forgets that the checksum of the block was verified, because its contents are changed
+	void ResetVerified(block_id_t block_id);
 };
 } // namespace duckdb
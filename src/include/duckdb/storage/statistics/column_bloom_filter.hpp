@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/column_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class Serializer;
+class Deserializer;
+class Vector;
+
+//! ColumnBloomFilter is a blocked Bloom filter over the hashes of the values of a column in a row group
+/*!
+   The filters are built during a checkpoint and allow equality filters on high-cardinality columns, for which the
+   min/max statistics cannot prune anything, to skip the row groups that cannot contain the constant. Like the
+   JoinBloomFilter, every hash sets three bits in a single 64-bit word.
+*/
+class ColumnBloomFilter {
+public:
+	//! Bits that are reserved per row when the filter is built (rounded up to a power of two)
+	static constexpr const idx_t BITS_PER_ROW = 8;
+	//! The filter is halved in size for as long as at most this percentage of its bits would be set
+	static constexpr const idx_t COMPACT_FILL_PERCENTAGE = 25;
+	//! Filters that have more than this percentage of their bits set are not kept
+	static constexpr const idx_t MAX_FILL_PERCENTAGE = 50;
+
+	explicit ColumnBloomFilter(idx_t row_count);
+	explicit ColumnBloomFilter(vector<uint64_t> words);
+
+public:
+	//! Whether or not Bloom filters are built for columns of the given type
+	static bool SupportsType(const LogicalType &type);
+
+	//! Insert the given (flat) hashes into the filter
+	void Insert(Vector &hashes, idx_t count);
+	//! Returns false if the value is certainly not part of the filter
+	bool MightContain(const Value &value) const;
+	//! Shrinks the filter for as long as it stays sparse, returns false if the filter is too full to be useful
+	bool Finalize();
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<ColumnBloomFilter> Deserialize(Deserializer &source);
+
+private:
+	static inline uint64_t GetMask(hash_t hash) {
+		return (uint64_t(1) << (hash & 63)) | (uint64_t(1) << ((hash >> 6) & 63)) |
+		       (uint64_t(1) << ((hash >> 12) & 63));
+	}
+	inline idx_t GetWord(hash_t hash) const {
+		return (hash >> 32) & (words.size() - 1);
+	}
+	//! Returns the number of set bits in the first word_count words of the filter, after folding it to that size
+	idx_t CountBits(idx_t word_count) const;
+
+	//! The words of the filter, the number of words is a power of two
+	vector<uint64_t> words;
+};
+
+} // namespace duckdb
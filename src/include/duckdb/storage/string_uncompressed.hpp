@@ -31,6 +31,9 @@ struct StringDictionaryContainer {
 
 struct StringScanState : public SegmentScanState {
 	BufferHandle handle;
+	//! A second pin on the segment block that is shared with every vector whose strings point into the block, so the
+	//! scan can emit strings without copying them and the block stays loaded for as long as those vectors are alive
+	buffer_ptr<VectorBuffer> block_reference;
 };
 
 struct UncompressedStringStorage {
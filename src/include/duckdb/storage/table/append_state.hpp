@@ -17,6 +17,7 @@
 
 namespace duckdb {
 class ColumnSegment;
+struct ConstraintState;
 class DataTable;
 class LocalTableStorage;
 class RowGroup;
@@ -74,6 +75,8 @@ struct TableAppendState {
 struct LocalAppendState {
 	TableAppendState append_state;
 	LocalTableStorage *storage;
+	//! The state for verifying the constraints of the appended chunks (created on the first append)
+	unique_ptr<ConstraintState> constraint_state;
 };
 
 } // namespace duckdb
@@ -71,6 +71,9 @@ private:
 
 class ChunkVectorInfo : public ChunkInfo {
 public:
+	//! The number of 64-bit words in the deleted_mask
+	static constexpr const idx_t DELETE_MASK_WORDS = (STANDARD_VECTOR_SIZE + 63) / 64;
+
 	ChunkVectorInfo(idx_t start);
 
 	//! The transaction ids of the transactions that inserted the tuples (if any)
@@ -81,6 +84,11 @@ public:
 	//! The transaction ids of the transactions that deleted the tuples (if any)
 	atomic<transaction_t> deleted[STANDARD_VECTOR_SIZE];
 	atomic<bool> any_deleted;
+	//! Bitmask of the tuples whose delete is committed and visible to every transaction
+	uint64_t deleted_mask[DELETE_MASK_WORDS];
+	//! The number of deleted tuples that are not part of the deleted_mask yet. While this is zero, scans only have to
+	//! check the deleted_mask instead of the delete version of every tuple
+	atomic<idx_t> pending_deletes;
 
 public:
 	idx_t GetSelVector(transaction_t start_time, transaction_t transaction_id, SelectionVector &sel_vector,
@@ -100,6 +108,10 @@ public:
 	//! i.e. after calling this function, rows will hold [0..actual_delete_count] row ids of the actually deleted tuples
 	idx_t Delete(transaction_t transaction_id, row_t rows[], idx_t count);
 	void CommitDelete(transaction_t commit_id, row_t rows[], idx_t count);
+	//! Reverts a delete that was not committed
+	void RollbackDelete(row_t rows[], idx_t count);
+	//! Adds committed deletes that are visible to every transaction to the deleted_mask
+	void CleanupDelete(row_t rows[], idx_t count);
 
 	void Serialize(Serializer &serialize) override;
 	static unique_ptr<ChunkInfo> Deserialize(Deserializer &source);
@@ -108,6 +120,11 @@ private:
 	template <class OP>
 	idx_t TemplatedGetSelVector(transaction_t start_time, transaction_t transaction_id, SelectionVector &sel_vector,
 	                            idx_t max_count);
+	//! Fills the selection vector with the tuples that are not part of the deleted_mask
+	idx_t GetUndeletedSelVector(SelectionVector &sel_vector, idx_t max_count);
+	void SetDeleted(idx_t row) {
+		deleted_mask[row / 64] |= uint64_t(1) << (row % 64);
+	}
 };
 
 } // namespace duckdb
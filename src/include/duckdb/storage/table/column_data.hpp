@@ -107,6 +107,8 @@ public:
 	virtual void UpdateColumn(TransactionData transaction, const vector<column_t> &column_path, Vector &update_vector,
 	                          row_t *row_ids, idx_t update_count, idx_t depth);
 	virtual unique_ptr<BaseStatistics> GetUpdateStatistics();
+	//! Whether or not any updates were made to the column data
+	bool HasUpdates();
 
 	virtual void CommitDropColumn();
 
@@ -119,6 +121,11 @@ public:
 	                            Vector &scan_vector);
 
 	virtual void DeserializeColumn(Deserializer &source);
+	//! Whether or not all the data of the column is stored in persistent segments without updates
+	virtual bool IsPersistent();
+	//! Serializes the data pointers of the persistent segments of the column in the format that is read by
+	//! DeserializeColumn, and adds the blocks that are referenced by the segments to "blocks" (once per segment)
+	virtual void SerializePersistentColumn(Serializer &serializer, vector<block_id_t> &blocks);
 	static shared_ptr<ColumnData> Deserialize(BlockManager &block_manager, DataTableInfo &info, idx_t column_index,
 	                                          idx_t start_row, Deserializer &source, const LogicalType &type,
 	                                          ColumnData *parent);
@@ -138,8 +145,16 @@ protected:
 	//! Append a transient segment
 	void AppendTransientSegment(SegmentLock &l, idx_t start_row);
 
+	//! Prepares the scan state for scanning the vector starting at state.row_index
+	void BeginScanVector(ColumnScanState &state);
 	//! Scans a base vector from the column
 	idx_t ScanVector(ColumnScanState &state, Vector &result, idx_t remaining);
+	//! Scans a base vector from the column while evaluating the filter on the compressed data of its segment. Returns
+	//! false without scanning if that is not possible, in which case the vector has to be scanned and filtered instead
+	bool SelectVector(ColumnScanState &state, Vector &result, SelectionVector &sel, idx_t &count,
+	                  const TableFilter &filter, idx_t &scan_count);
+	//! Issues read-ahead for the blocks of the segments following the segment that is currently scanned
+	void PrefetchSegments(ColumnScanState &state);
 	//! Scans a vector from the column merged with any potential updates
 	//! If ALLOW_UPDATES is set to false, the function will instead throw an exception if any updates are found
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
@@ -153,7 +168,7 @@ protected:
 	//! The updates for this column segment
 	unique_ptr<UpdateSegment> updates;
 	//! The internal version of the column data
-	idx_t version;
+	atomic<idx_t> version;
 };
 
 } // namespace duckdb
@@ -14,6 +14,13 @@
 namespace duckdb {
 
 class ColumnDataCheckpointer {
+public:
+	//! Columns with more vectors than this pick their compression method based on a sample of their vectors
+	static constexpr const idx_t ANALYZE_SAMPLE_THRESHOLD = 16;
+	//! The sample consists of ANALYZE_SAMPLE_RUN consecutive vectors out of every ANALYZE_SAMPLE_STRIDE vectors
+	static constexpr const idx_t ANALYZE_SAMPLE_RUN = 4;
+	static constexpr const idx_t ANALYZE_SAMPLE_STRIDE = 16;
+
 public:
 	ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup &row_group_p, ColumnCheckpointState &state_p,
 	                       ColumnCheckpointInfo &checkpoint_info);
@@ -23,15 +30,26 @@ public:
 	const LogicalType &GetType() const;
 	ColumnData &GetColumnData();
 	RowGroup &GetRowGroup();
+	//! The first row of the segments that are being written
+	idx_t GetRowStart();
 	ColumnCheckpointState &GetCheckpointState();
 
-	void Checkpoint(vector<SegmentNode> nodes);
+	void Checkpoint(vector<SegmentNode> all_nodes);
 
 private:
-	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback);
+	//! Scans the vectors of the segments, or only the vectors that are part of the analyze sample if sample is true
+	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback, bool sample = false);
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
+	//! Runs the analyze step of the given (non-null) compression functions, and returns the best one
+	//! Functions that cannot be used to compress the data are set to nullptr
+	unique_ptr<AnalyzeState> AnalyzeCompression(vector<CompressionFunction *> &functions, bool sample,
+	                                            CompressionType forced_method, idx_t &compression_idx);
+	//! Returns the index of the compression function that was used for the data that is being rewritten in a
+	//! previous checkpoint, or DConstants::INVALID_INDEX if there is none
+	idx_t GetCompressionHint();
+	idx_t GetVectorCount();
 	void WriteToDisk();
-	bool HasChanges();
+	bool HasChanges(ColumnSegment &segment);
 	void WritePersistentSegments();
 
 private:
@@ -43,6 +61,9 @@ private:
 	vector<SegmentNode> nodes;
 	vector<CompressionFunction *> compression_functions;
 	ColumnCheckpointInfo &checkpoint_info;
+	//! Persistent segments stored in blocks from this block id onwards are rewritten so they move to the start of
+	//! the file (INVALID_BLOCK if no segments need to be relocated)
+	block_id_t relocation_threshold;
 };
 
 } // namespace duckdb
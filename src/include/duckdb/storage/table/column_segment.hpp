@@ -71,6 +71,17 @@ public:
 
 	static idx_t FilterSelection(SelectionVector &sel, Vector &result, const TableFilter &filter,
 	                             idx_t &approved_tuple_count, ValidityMask &mask);
+	//! Whether or not the segment can evaluate the filter on its compressed data
+	bool CanSelect(const TableFilter &filter) const;
+	//! Scan one entire vector from this segment, evaluating the filter on the compressed data
+	void Select(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+	            idx_t &approved_tuple_count, const TableFilter &filter);
+	//! Evaluates the filter on the first 'count' values of the entries vector (e.g. the runs or the dictionary of a
+	//! compressed segment), and sets passes[i] to whether or not entry i passes the filter
+	static void FilterEntries(Vector &entries, idx_t count, const TableFilter &filter, bool passes[]);
+	//! Restricts the selection to the rows whose entry (row_entries[row]) passed the filter
+	static void SelectEntries(SelectionVector &sel, idx_t &approved_tuple_count, const sel_t row_entries[],
+	                          const bool passes[]);
 
 	//! Skip a scan forward to the row_index specified in the scan state
 	void Skip(ColumnScanState &state);
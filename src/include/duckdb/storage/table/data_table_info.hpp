@@ -10,15 +10,18 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/table/table_index_list.hpp"
 
 namespace duckdb {
 class DatabaseInstance;
+class MaterializedViewData;
 class TableIOManager;
 
 struct DataTableInfo {
 	DataTableInfo(DatabaseInstance &db, shared_ptr<TableIOManager> table_io_manager_p, string schema, string table)
-	    : db(db), table_io_manager(move(table_io_manager_p)), cardinality(0), schema(move(schema)), table(move(table)) {
+	    : db(db), table_io_manager(move(table_io_manager_p)), cardinality(0), last_commit_id(0), schema(move(schema)),
+	      table(move(table)) {
 	}
 
 	//! The database instance of the table
@@ -28,6 +31,9 @@ struct DataTableInfo {
 	//! The amount of elements in the table. Note that this number signifies the amount of COMMITTED entries in the
 	//! table. It can be inaccurate inside of transactions. More work is needed to properly support that.
 	atomic<idx_t> cardinality;
+	//! The commit id of the last transaction that inserted, deleted or updated rows of the table (0 if none did since
+	//! the table was loaded)
+	atomic<transaction_t> last_commit_id;
 	// schema of the table
 	string schema;
 	// name of the table
@@ -35,6 +41,11 @@ struct DataTableInfo {
 
 	TableIndexList indexes;
 
+	//! Lock protecting the materialized views
+	mutex materialized_views_lock;
+	//! The materialized views that are maintained from the rows that are appended to the table
+	vector<weak_ptr<MaterializedViewData>> materialized_views;
+
 	bool IsTemporary() {
 		return schema == TEMP_SCHEMA;
 	}
@@ -57,6 +57,8 @@ public:
 	                                             ColumnCheckpointInfo &checkpoint_info) override;
 
 	void DeserializeColumn(Deserializer &source) override;
+	bool IsPersistent() override;
+	void SerializePersistentColumn(Serializer &serializer, vector<block_id_t> &blocks) override;
 
 	void GetStorageInfo(idx_t row_group_index, vector<idx_t> col_path, vector<vector<Value>> &result) override;
 
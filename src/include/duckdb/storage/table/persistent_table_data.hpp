@@ -23,6 +23,14 @@ public:
 
 	vector<RowGroupPointer> row_groups;
 	vector<unique_ptr<BaseStatistics>> column_stats;
+	//! The location of the table data in the metadata. If set, the row groups and statistics have not been read yet:
+	//! they are read when the table is first accessed, so that opening a database does not read the data of all tables
+	BlockPointer table_pointer;
+
+public:
+	bool IsLazy() const {
+		return table_pointer.block_id != INVALID_BLOCK;
+	}
 };
 
 } // namespace duckdb
@@ -20,6 +20,7 @@
 
 namespace duckdb {
 class BlockManager;
+class ColumnBloomFilter;
 class ColumnData;
 class DatabaseInstance;
 class DataTable;
@@ -37,6 +38,7 @@ struct VersionNode;
 struct RowGroupWriteData {
 	vector<unique_ptr<ColumnCheckpointState>> states;
 	vector<unique_ptr<BaseStatistics>> statistics;
+	vector<shared_ptr<ColumnBloomFilter>> bloom_filters;
 };
 
 class RowGroup : public SegmentBase {
@@ -68,6 +70,9 @@ private:
 	vector<shared_ptr<ColumnData>> columns;
 	//! The segment statistics for each of the columns
 	vector<shared_ptr<SegmentStatistics>> stats;
+	//! The Bloom filters of the columns that were built during the last checkpoint (if any), these are dropped as
+	//! soon as the row group is appended to or updated
+	vector<shared_ptr<ColumnBloomFilter>> bloom_filters;
 
 public:
 	DatabaseInstance &GetDatabase() {
@@ -114,6 +119,10 @@ public:
 	idx_t GetSelVector(TransactionData transaction, idx_t vector_idx, SelectionVector &sel_vector, idx_t max_count);
 	idx_t GetCommittedSelVector(transaction_t start_time, transaction_t transaction_id, idx_t vector_idx,
 	                            SelectionVector &sel_vector, idx_t max_count);
+	//! Returns the number of rows of the row group that are visible to the transaction
+	idx_t GetVisibleCount(TransactionData transaction);
+	//! Returns the number of rows of the row group that are deleted and no longer visible to any transaction
+	idx_t GetPermanentlyDeletedCount();
 
 	//! For a specific row, returns true if it should be used for the transaction and false otherwise.
 	bool Fetch(TransactionData transaction, idx_t row);
@@ -132,9 +141,19 @@ public:
 	idx_t Delete(TransactionData transaction, DataTable *table, row_t *row_ids, idx_t count);
 
 	RowGroupWriteData WriteToDisk(PartialBlockManager &manager, const vector<CompressionType> &compression_types);
-	RowGroupPointer Checkpoint(RowGroupWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats);
+	//! Writes the metadata of the row group, after its columns were written to disk with WriteToDisk
+	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer,
+	                           vector<unique_ptr<BaseStatistics>> &global_stats);
 	static void Serialize(RowGroupPointer &pointer, Serializer &serializer);
-	static RowGroupPointer Deserialize(Deserializer &source, const ColumnList &columns);
+	static RowGroupPointer Deserialize(Deserializer &source, const vector<LogicalType> &types);
+	//! Whether or not all the data of the row group is stored in persistent segments without updates
+	bool IsPersistent();
+	//! Serializes the row group as pointers to its persistent segments (e.g. to write it to the WAL), and adds the
+	//! blocks that are referenced by the segments to "blocks" (once per segment)
+	void SerializePersistent(Serializer &serializer, vector<block_id_t> &blocks);
+	static unique_ptr<RowGroup> DeserializePersistent(DatabaseInstance &db, BlockManager &block_manager,
+	                                                  DataTableInfo &table_info, const vector<LogicalType> &types,
+	                                                  Deserializer &source);
 
 	void InitializeAppend(RowGroupAppendState &append_state);
 	void Append(RowGroupAppendState &append_state, DataChunk &chunk, idx_t append_count);
@@ -148,7 +167,11 @@ public:
 
 	void MergeStatistics(idx_t column_idx, const BaseStatistics &other);
 	void MergeIntoStatistics(idx_t column_idx, BaseStatistics &other);
+	//! Returns the Bloom filter of the column, or nullptr if there is none
+	shared_ptr<ColumnBloomFilter> GetBloomFilter(idx_t column_idx);
 	unique_ptr<BaseStatistics> GetStatistics(idx_t column_idx);
+	//! Whether or not any updates were made to the column; the statistics of an updated column are only a bound
+	bool HasUpdates(idx_t column_idx);
 
 	void GetStorageInfo(idx_t row_group_index, vector<vector<Value>> &result);
 
@@ -158,6 +181,10 @@ public:
 
 private:
 	ChunkInfo *GetChunkInfo(idx_t vector_idx);
+	//! Builds a Bloom filter over the committed values of the column
+	unique_ptr<ColumnBloomFilter> BuildBloomFilter(idx_t column_idx);
+	//! Drops the Bloom filter of the column, or the Bloom filters of all columns if column_idx is INVALID_INDEX
+	void InvalidateBloomFilters(idx_t column_idx = DConstants::INVALID_INDEX);
 
 	template <TableScanType TYPE>
 	void TemplatedScan(TransactionData transaction, RowGroupScanState &state, DataChunk &result);
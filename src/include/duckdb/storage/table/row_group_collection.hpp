@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/storage/block.hpp"
 #include "duckdb/storage/table/row_group.hpp"
 #include "duckdb/storage/table/segment_tree.hpp"
 #include "duckdb/storage/statistics/column_statistics.hpp"
@@ -22,6 +23,10 @@ class TableIndexList;
 class TableStatistics;
 
 class RowGroupCollection {
+public:
+	//! The minimum number of vectors that a parallel scan hands out at once, when row groups are split up
+	static constexpr const idx_t MIN_MORSEL_VECTOR_COUNT = 8;
+
 public:
 	RowGroupCollection(shared_ptr<DataTableInfo> info, BlockManager &block_manager, vector<LogicalType> types,
 	                   idx_t row_start, idx_t total_rows = 0);
@@ -31,13 +36,20 @@ public:
 	Allocator &GetAllocator() const;
 
 	void Initialize(PersistentTableData &data);
+	//! Initializes the collection with the table data stored at the given location in the metadata. The table data is
+	//! only read when the collection is first accessed.
+	void InitializeLazy(BlockPointer pointer);
 	void InitializeEmpty();
 
 	bool IsEmpty() const;
 
 	void AppendRowGroup(SegmentLock &l, idx_t start_row);
+	//! Adds an existing row group (that starts at the end of the collection) to the collection
+	void AddRowGroup(unique_ptr<RowGroup> row_group);
 	//! Get the nth row-group, negative numbers start from the back (so -1 is the last row group, etc)
 	RowGroup *GetRowGroup(int64_t index);
+	//! Get the row group that contains the given row
+	RowGroup *GetRowGroupForRow(idx_t row_number);
 	void Verify();
 
 	void InitializeScan(CollectionScanState &state, const vector<column_t> &column_ids, TableFilterSet *table_filters);
@@ -48,6 +60,9 @@ public:
 	                                     idx_t max_row);
 	void InitializeParallelScan(ParallelCollectionScanState &state);
 	bool NextParallelScan(ClientContext &context, ParallelCollectionScanState &state, CollectionScanState &scan_state);
+	//! Moves a parallel scan that has not handed out any morsels yet past entire row groups and vectors, of which the
+	//! rows visible to the transaction are among the first count rows. Returns the amount of skipped rows.
+	idx_t SkipParallelScan(TransactionData transaction, ParallelCollectionScanState &state, idx_t count);
 
 	bool Scan(Transaction &transaction, const vector<column_t> &column_ids,
 	          const std::function<bool(DataChunk &chunk)> &fun);
@@ -77,6 +92,9 @@ public:
 	                  DataChunk &updates);
 
 	void Checkpoint(TableDataWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats);
+	//! Rewrites the row groups at the end of the collection if at least half of their rows are permanently deleted,
+	//! so that the deleted rows are no longer stored. Note that this changes the row ids of the rewritten rows.
+	void VacuumDeletes();
 
 	void CommitDropColumn(idx_t index);
 	void CommitDropTable();
@@ -93,9 +111,19 @@ public:
 
 	unique_ptr<BaseStatistics> CopyStats(column_t column_id);
 	void SetStatistics(column_t column_id, const std::function<void(BaseStatistics &)> &set_fun);
+	//! Computes the number of rows visible to the transaction from the version info, and the exact min and max of the
+	//! given (numeric) columns from the row group statistics. Returns false if the statistics of the columns are not
+	//! exact for the transaction, i.e. if any rows are deleted, updated or invisible to it
+	bool GetExactStatistics(TransactionData transaction, const vector<column_t> &column_ids, idx_t &visible_count,
+	                        vector<Value> &min_values, vector<Value> &max_values);
+	//! Estimates the fraction of the rows whose value in the (numeric) column lies between lower and upper (a NULL
+	//! bound is unbounded), using the min and max of every row group as a histogram. Returns -1 if unknown
+	double EstimateRangeSelectivity(column_t column_id, const Value &lower, const Value &upper);
 
 private:
 	bool IsEmpty(SegmentLock &) const;
+	//! Reads the table data of a lazily initialized collection, if it has not been read yet
+	void LoadTableData();
 
 private:
 	//! BlockManager
@@ -109,6 +137,12 @@ private:
 	shared_ptr<SegmentTree> row_groups;
 	//! Table statistics
 	TableStatistics stats;
+	//! Whether or not any appends were reverted; the statistics of reverted appends remain in the row groups
+	atomic<bool> appends_reverted;
+	//! Whether the table data still has to be read from table_pointer
+	atomic<bool> lazy_load;
+	BlockPointer table_pointer;
+	mutex load_lock;
 };
 
 } // namespace duckdb
@@ -12,6 +12,7 @@
 #include "duckdb/storage/buffer/buffer_handle.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/scan_options.hpp"
+#include "duckdb/common/random_engine.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/storage/table/segment_lock.hpp"
 
@@ -27,6 +28,7 @@ class TableScanState;
 class ColumnSegment;
 class ValiditySegment;
 class TableFilterSet;
+class DynamicTableFilterSet;
 class ColumnData;
 
 struct SegmentScanState {
@@ -56,6 +58,8 @@ struct ColumnScanState {
 	bool initialized = false;
 	//! If this segment has already been checked for skipping purposes
 	bool segment_checked = false;
+	//! The last segment for which read-ahead was issued
+	ColumnSegment *prefetched = nullptr;
 	//! The version of the column data that we are scanning.
 	//! This is used to detect if the ColumnData has been changed out from under us during a scan
 	//! If this is the case, we re-initialize the scan
@@ -100,8 +104,11 @@ public:
 public:
 	const vector<column_t> &GetColumnIds();
 	TableFilterSet *GetFilters();
+	DynamicTableFilterSet *GetDynamicFilters();
 	AdaptiveFilter *GetAdaptiveFilter();
 	idx_t GetParentMaxRow();
+	//! Whether the current vector is not part of the sample of the scan (if any), and should be skipped
+	bool SkipSampledVector();
 
 private:
 	//! The parent scan state
@@ -123,7 +130,9 @@ public:
 public:
 	const vector<column_t> &GetColumnIds();
 	TableFilterSet *GetFilters();
+	DynamicTableFilterSet *GetDynamicFilters();
 	AdaptiveFilter *GetAdaptiveFilter();
+	bool SkipSampledVector();
 	bool Scan(Transaction &transaction, DataChunk &result);
 	bool ScanCommitted(DataChunk &result, TableScanType type);
 
@@ -133,7 +142,7 @@ private:
 
 class TableScanState {
 public:
-	TableScanState() : table_state(*this), local_state(*this), table_filters(nullptr) {};
+	TableScanState() : table_state(*this), local_state(*this), table_filters(nullptr), dynamic_filters(nullptr) {};
 
 	//! The underlying table scan state
 	CollectionScanState table_state;
@@ -141,19 +150,30 @@ public:
 	CollectionScanState local_state;
 
 public:
-	void Initialize(vector<column_t> column_ids, TableFilterSet *table_filters = nullptr);
+	void Initialize(vector<column_t> column_ids, TableFilterSet *table_filters = nullptr,
+	                DynamicTableFilterSet *dynamic_filters = nullptr,
+	                shared_ptr<AdaptiveFilterStatistics> filter_statistics = nullptr);
+	//! Only scan a system sample of the table: every vector is scanned with the given probability (between 0 and 1)
+	void InitializeSample(double probability, int64_t seed);
 
 	const vector<column_t> &GetColumnIds();
 	TableFilterSet *GetFilters();
+	DynamicTableFilterSet *GetDynamicFilters();
 	AdaptiveFilter *GetAdaptiveFilter();
+	bool SkipSampledVector();
 
 private:
 	//! The column identifiers of the scan
 	vector<column_t> column_ids;
 	//! The table filters (if any)
 	TableFilterSet *table_filters;
+	//! The filters that are set while the scan is running (if any)
+	DynamicTableFilterSet *dynamic_filters;
 	//! Adaptive filter info (if any)
 	unique_ptr<AdaptiveFilter> adaptive_filter;
+	//! The probability with which a vector is part of the sample, and the random engine used to sample (if any)
+	double sample_probability = 1;
+	unique_ptr<RandomEngine> sample_random;
 };
 
 struct ParallelCollectionScanState {
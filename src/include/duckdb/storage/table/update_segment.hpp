@@ -44,6 +44,9 @@ public:
 	void RollbackUpdate(UpdateInfo *info);
 	void CleanupUpdateInternal(const StorageLockKey &lock, UpdateInfo *info);
 	void CleanupUpdate(UpdateInfo *info);
+	//! Merges adjacent committed versions in the version chain of the given vector that no active transaction can
+	//! tell apart, given the start times of the active transactions in ascending order
+	void CompactUpdates(idx_t vector_index, const vector<transaction_t> &active_start_times);
 
 	unique_ptr<BaseStatistics> GetStatistics();
 	StringHeap &GetStringHeap() {
@@ -93,6 +96,15 @@ private:
 private:
 	void InitializeUpdateInfo(UpdateInfo &info, row_t *ids, const SelectionVector &sel, idx_t count, idx_t vector_index,
 	                          idx_t vector_offset);
+	//! Merges the old values stored in "source" into "target", the values of the oldest version take precedence
+	void MergeVersions(UpdateInfo *target, UpdateInfo *source, sel_t merged_tuples[], data_ptr_t merged_data);
+	//! Returns the version that keeps its values in the column segment if the transaction has to see it
+	UpdateInfo *GetSegmentVersion(TransactionData transaction, UpdateInfo *base_info);
+	//! Replaces a version that keeps its values in the column segment with a version that stores the old values, so
+	//! that the transaction can update more tuples of the vector
+	UpdateInfo *MaterializeVersion(TransactionData transaction, UpdateInfo *info, Vector &base_data);
+	//! Whether or not the first version of a vector can keep its old values in the column segment
+	bool CanKeepValuesInSegment() const;
 };
 
 struct UpdateNodeData {
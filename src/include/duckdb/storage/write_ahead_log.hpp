@@ -9,6 +9,9 @@
 #pragma once
 
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
@@ -18,6 +21,8 @@
 #include "duckdb/catalog/catalog_entry/scalar_macro_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -34,12 +39,17 @@ class TableCatalogEntry;
 class Transaction;
 class TransactionManager;
 
+class RowGroup;
+
+class ReplayInsertState;
+
 class ReplayState {
 public:
-	ReplayState(DatabaseInstance &db, ClientContext &context, Deserializer &source)
-	    : db(db), context(context), source(source), current_table(nullptr), deserialize_only(false),
-	      checkpoint_id(INVALID_BLOCK) {
-	}
+	//! The number of buffered insert rows after which the inserts are appended to their tables in parallel
+	static constexpr const idx_t INSERT_BATCH_SIZE = STANDARD_ROW_GROUPS_SIZE * 8;
+
+	ReplayState(DatabaseInstance &db, ClientContext &context, Deserializer &source);
+	~ReplayState();
 
 	DatabaseInstance &db;
 	ClientContext &context;
@@ -47,9 +57,17 @@ public:
 	TableCatalogEntry *current_table;
 	bool deserialize_only;
 	block_id_t checkpoint_id;
+	//! The blocks that are referenced by the row groups in the WAL (once per segment)
+	vector<block_id_t> referenced_blocks;
+	//! The inserts that are buffered and appended to their tables by the task scheduler
+	unique_ptr<ReplayInsertState> insert_state;
 
 public:
 	void ReplayEntry(WALType entry_type);
+	//! Appends all buffered inserts to their tables and waits for the appends to finish
+	void FlushInserts();
+	//! Waits for the running appends without throwing their errors (used before rolling back)
+	void WaitForInserts();
 
 protected:
 	virtual void ReplayCreateTable();
@@ -79,15 +97,25 @@ protected:
 	void ReplayInsert();
 	void ReplayDelete();
 	void ReplayUpdate();
+	void ReplayRowGroupData();
 	void ReplayCheckpoint();
+
+private:
+	//! Schedules the buffered inserts on the task scheduler, after the previously scheduled appends are finished
+	void ScheduleInserts();
 };
 
 //! The WriteAheadLog (WAL) is a log that is used to provide durability. Prior
 //! to committing a transaction it writes the changes the transaction made to
 //! the database to the log, which can then be replayed upon startup in case the
 //! server crashes or is shut down.
+//! Commits write their entries to the file while holding the transaction lock, but sync the file only after
+//! releasing it: the commits that wait for a sync at the same time are made durable by a single sync (group commit).
 class WriteAheadLog {
 public:
+	//! The interval at which the background thread syncs the WAL if synchronous_commit is disabled
+	static constexpr const int64_t BACKGROUND_SYNC_INTERVAL_MS = 200;
+
 	//! Initialize the WAL in the specified directory
 	explicit WriteAheadLog(DatabaseInstance &database, const string &path);
 	virtual ~WriteAheadLog();
@@ -141,12 +169,24 @@ public:
 	//! -> 1 (second subcolumn of struct)
 	//! -> 0 (first subcolumn of INT)
 	void WriteUpdate(DataChunk &chunk, const vector<column_t> &column_path);
+	//! Write a row group whose data has already been written to the database file, as pointers to its blocks
+	void WriteRowGroupData(RowGroup &row_group);
 
 	//! Truncate the WAL to a previous size, and clear anything currently set in the writer
 	void Truncate(int64_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Writes a flush entry and syncs the WAL
 	void Flush();
+	//! Writes a flush entry and writes the buffered entries to the file without syncing it. Returns the position up
+	//! to which the WAL has to be synced to make the entries durable.
+	idx_t WriteFlush();
+	//! Makes the entries up to the given position durable: syncs the WAL or, if synchronous_commit is disabled, leaves
+	//! it to the background thread
+	void SyncCommit(idx_t position);
+	//! Syncs the WAL up to (at least) the given position. If another thread is already syncing, waits for it and
+	//! only syncs again if that did not cover the position.
+	void Sync(idx_t position);
 
 	void WriteCheckpoint(block_id_t meta_block);
 
@@ -154,6 +194,28 @@ protected:
 	DatabaseInstance &database;
 	unique_ptr<BufferedFileWriter> writer;
 	string wal_path;
+
+private:
+	void StartBackgroundSync();
+	void StopBackgroundSync();
+	void BackgroundSync();
+
+	//! Protects the sync state, and prevents the WAL from being truncated or deleted while it is synced
+	mutex sync_lock;
+	//! Notified whenever a sync finishes
+	std::condition_variable sync_finished;
+	//! Whether or not a thread is currently syncing the file
+	bool sync_in_progress;
+	//! The position up to which the WAL has been written to the file
+	atomic<idx_t> written_position;
+	//! The position up to which the WAL is known to be synced
+	idx_t synced_position;
+	//! The thread that syncs the WAL if synchronous_commit is disabled (if any)
+	unique_ptr<thread> background_sync;
+	//! Notified to wake up the background thread when it has to stop
+	std::condition_variable background_sync_wakeup;
+	//! Whether or not the background thread has to stop
+	bool stop_background_sync;
 };
 
 } // namespace duckdb
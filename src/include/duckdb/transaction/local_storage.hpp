@@ -81,6 +81,8 @@ public:
 	void CheckFlushToDisk();
 	//! Flushes the final row group to disk (if any)
 	void FlushToDisk();
+	//! Flushes the final row group to disk if the storage is merged into the table on commit as a bulk append
+	void PrepareCommit();
 	void Rollback();
 	idx_t EstimatedSize();
 
@@ -102,6 +104,7 @@ public:
 	idx_t EstimatedSize();
 	bool IsEmpty();
 	void InsertEntry(DataTable *table, shared_ptr<LocalTableStorage> entry);
+	void PrepareCommit();
 
 private:
 	mutex table_storage_lock;
@@ -131,6 +134,8 @@ public:
 	void Scan(CollectionScanState &state, const vector<column_t> &column_ids, DataChunk &result);
 
 	void InitializeParallelScan(DataTable *table, ParallelCollectionScanState &state);
+	//! Skips the transaction-local rows of a parallel scan that are among the first count rows
+	idx_t SkipParallelScan(DataTable *table, ParallelCollectionScanState &state, idx_t count);
 	bool NextParallelScan(ClientContext &context, DataTable *table, ParallelCollectionScanState &state,
 	                      CollectionScanState &scan_state);
 
@@ -150,6 +155,9 @@ public:
 	//! Update a set of rows in the local storage
 	void Update(DataTable *table, Vector &row_ids, const vector<PhysicalIndex> &column_ids, DataChunk &data);
 
+	//! Writes the data that is merged into the tables on commit to disk. This happens before the commit obtains the
+	//! transaction lock, so that concurrent commits only have to link the written row groups into their tables.
+	void PrepareCommit();
 	//! Commits the local storage, writing it to the WAL and completing the commit
 	void Commit(LocalStorage::CommitState &commit_state, Transaction &transaction);
 	//! Rollback the local storage
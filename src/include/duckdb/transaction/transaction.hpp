@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/catalog/catalog_entry/sequence_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_lookup_cache.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/transaction/undo_buffer.hpp"
@@ -48,6 +49,8 @@ public:
 	transaction_t transaction_id;
 	//! The commit id of this transaction, if it has successfully been committed
 	transaction_t commit_id;
+	//! The position up to which the WAL has to be synced to make the commit durable (or 0 if nothing was written)
+	idx_t wal_sync_position;
 	//! Highest active query when the transaction finished, used for cleaning up
 	transaction_t highest_active_query;
 	//! The current active query for the transaction. Set to MAXIMUM_QUERY_ID if
@@ -63,6 +66,8 @@ public:
 	ValidChecker transaction_validity;
 	//! A pointer to the temporary objects of the client context
 	shared_ptr<SchemaCatalogEntry> temporary_objects;
+	//! The catalog entries that were looked up by the transaction
+	CatalogLookupCache catalog_lookups;
 
 public:
 	static Transaction &GetTransaction(ClientContext &context);
@@ -70,6 +75,9 @@ public:
 
 	void PushCatalogEntry(CatalogEntry *entry, data_ptr_t extra_data = nullptr, idx_t extra_data_size = 0);
 
+	//! Prepares the commit of the transaction: this is called before the transaction lock is obtained. Returns an
+	//! error message if the preparation failed, or an empty string if it was successful
+	string PrepareCommit() noexcept;
 	//! Commit the current transaction with the given commit identifier. Returns an error message if the transaction
 	//! commit failed, or an empty string if the commit was sucessful
 	string Commit(DatabaseInstance &db, transaction_t commit_id, bool checkpoint) noexcept;
@@ -80,8 +88,14 @@ public:
 	void Rollback() noexcept;
 	//! Cleanup the undo buffer
 	void Cleanup();
+	//! Compact the update chains that contain the (committed) updates of this transaction, given the start times of
+	//! the other active transactions in ascending order
+	void CompactUpdates(const vector<transaction_t> &active_start_times);
 
 	bool ChangesMade();
+	//! Whether or not the transaction is read-only: it has made no changes and has not used any sequences, so there
+	//! is nothing to commit or roll back
+	bool IsReadOnly();
 
 	timestamp_t GetCurrentTransactionStartTimestamp() {
 		return start_timestamp;
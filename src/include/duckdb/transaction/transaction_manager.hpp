@@ -11,10 +11,13 @@
 #include "duckdb/catalog/catalog_set.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/vector.hpp"
 
 #include "duckdb/common/atomic.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 class ClientContext;
@@ -29,6 +32,9 @@ class TransactionManager {
 	friend struct CheckpointLock;
 
 public:
+	//! The interval at which the background thread retries a checkpoint that was blocked by running transactions
+	static constexpr const int64_t BACKGROUND_CHECKPOINT_RETRY_MS = 100;
+
 	explicit TransactionManager(DatabaseInstance &db);
 	~TransactionManager();
 
@@ -50,6 +56,8 @@ public:
 	}
 
 	void Checkpoint(ClientContext &context, bool force = false);
+	//! Stops the background checkpoint thread, if it is running
+	void StopBackgroundCheckpoint();
 
 	static TransactionManager &Get(ClientContext &context);
 	static TransactionManager &Get(DatabaseInstance &db);
@@ -63,22 +71,40 @@ private:
 	bool CanCheckpoint(Transaction *current = nullptr);
 	//! Remove the given transaction from the list of active transactions
 	void RemoveTransaction(Transaction *transaction) noexcept;
-	void LockClients(vector<ClientLockWrapper> &client_locks, ClientContext &context);
+	//! Remove the given transaction from the set of active transactions, and obtain the lowest active query of the
+	//! remaining transactions. Requires only the active transactions lock
+	unique_ptr<Transaction> RemoveActiveTransaction(Transaction *transaction,
+	                                                transaction_t &lowest_active_query) noexcept;
+	//! Ends a read-only transaction, which has nothing to commit or roll back
+	void EndReadOnlyTransaction(Transaction *transaction) noexcept;
+	//! Locks all clients except the given one (if any)
+	void LockClients(vector<ClientLockWrapper> &client_locks, ClientContext *context);
+
+	//! Wakes up the background thread (starting it if required) to checkpoint once the WAL is large enough
+	void ScheduleBackgroundCheckpoint();
+	void BackgroundCheckpoint();
+	//! Attempts an automatic checkpoint from the background thread, returns false if it has to be retried later
+	bool TryBackgroundCheckpoint();
 
 	//! The database instance
 	DatabaseInstance &db;
 	//! The current query number
 	atomic<transaction_t> current_query_number;
-	//! The current start timestamp used by transactions
+	//! The next timestamp handed out to commits (protected by the transaction lock)
 	transaction_t current_start_timestamp;
-	//! The current transaction ID used by transactions
+	//! The start time of transactions that start now: all commits with a lower commit id have completed
+	atomic<transaction_t> snapshot_timestamp;
+	//! The current transaction ID used by transactions (protected by the active transactions lock)
 	transaction_t current_transaction_id;
 	//! The lowest active transaction id
 	atomic<transaction_t> lowest_active_id;
 	//! The lowest active transaction timestamp
 	atomic<transaction_t> lowest_active_start;
-	//! Set of currently running transactions
+	//! Set of currently running transactions, ordered on start time (and transaction id)
 	vector<unique_ptr<Transaction>> active_transactions;
+	//! The lock protecting the set of active transactions. Starting a transaction only takes this lock, which is
+	//! held briefly, instead of the transaction lock, which is held for the duration of a commit
+	mutex active_transactions_lock;
 	//! Set of recently committed transactions
 	vector<unique_ptr<Transaction>> recently_committed_transactions;
 	//! Transactions awaiting GC
@@ -87,6 +113,17 @@ private:
 	mutex transaction_lock;
 
 	bool thread_is_checkpointing;
+
+	//! The lock protecting the state of the background checkpoint thread
+	mutex background_checkpoint_lock;
+	//! The thread that performs the automatic checkpoints if background_checkpoint is enabled
+	unique_ptr<thread> background_checkpoint;
+	//! Notified to wake up the background thread when a checkpoint is requested or when it has to stop
+	std::condition_variable background_checkpoint_wakeup;
+	//! Whether or not the WAL has reached the size at which an automatic checkpoint should be performed
+	bool checkpoint_requested;
+	//! Whether or not the background thread has to stop
+	bool stop_background_checkpoint;
 };
 
 } // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/undo_flags.hpp"
+#include "duckdb/common/vector.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
@@ -39,6 +40,8 @@ public:
 
 	//! Cleanup the undo buffer
 	void Cleanup();
+	//! Compact the version chains of the vectors that are updated in this UndoBuffer
+	void CompactUpdates(const vector<transaction_t> &active_start_times);
 	//! Commit the changes made in the UndoBuffer: should be called on commit
 	void Commit(UndoBuffer::IteratorState &iterator_state, WriteAheadLog *log, transaction_t commit_id);
 	//! Revert committed changes made in the UndoBuffer up until the currently committed state
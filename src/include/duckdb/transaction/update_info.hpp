@@ -34,6 +34,10 @@ struct UpdateInfo {
 	sel_t *tuples;
 	//! The data of the tuples
 	data_ptr_t tuple_data;
+	//! Whether or not the old values of the tuples are the values stored in the column segment. This is the case for
+	//! the first version of a vector, which is then created without copying the old values (tuple_data is empty).
+	//! Such a version is always the oldest version in the chain
+	bool values_in_segment;
 	//! The previous update info (or nullptr if it is the base)
 	UpdateInfo *prev;
 	//! The next update info in the chain (or nullptr if it is the last)
@@ -45,7 +49,9 @@ struct UpdateInfo {
 	static void UpdatesForTransaction(UpdateInfo *current, transaction_t start_time, transaction_t transaction_id,
 	                                  T &&callback) {
 		while (current) {
-			if (current->version_number > start_time && current->version_number != transaction_id) {
+			// the values of a version that is stored in the column segment are restored by the UpdateSegment
+			if (current->version_number > start_time && current->version_number != transaction_id &&
+			    !current->values_in_segment) {
 				// these tuples were either committed AFTER this transaction started or are not committed yet, use
 				// tuples stored in this version
 				callback(current);
@@ -11,6 +11,7 @@
 #include "duckdb/common/operator/string_cast.hpp"
 #include "duckdb/common/types/column_data_collection.hpp"
 #include "duckdb/common/operator/decimal_cast_operators.hpp"
+#include "utf8proc_wrapper.hpp"
 
 namespace duckdb {
 
@@ -325,6 +326,81 @@ void BaseAppender::AppendDataChunk(DataChunk &chunk) {
 	}
 }
 
+static void SetColumnData(Vector &vector, const AppenderColumnData &column, idx_t offset, idx_t count) {
+	auto &type = vector.GetType();
+	auto &validity = FlatVector::Validity(vector);
+	if (column.validity) {
+		if (offset % ValidityMask::BITS_PER_VALUE == 0) {
+			validity.Initialize((validity_t *)column.validity + offset / ValidityMask::BITS_PER_VALUE);
+		} else {
+			ValidityMask source_validity((validity_t *)column.validity);
+			for (idx_t i = 0; i < count; i++) {
+				if (!source_validity.RowIsValid(offset + i)) {
+					validity.SetInvalid(i);
+				}
+			}
+		}
+	}
+	if (type.InternalType() != PhysicalType::VARCHAR) {
+		// fixed-size values are appended from the data of the caller without copying them first
+		auto type_size = GetTypeIdSize(type.InternalType());
+		FlatVector::SetData(vector, (data_ptr_t)column.data + offset * type_size);
+		return;
+	}
+	// the strings point into the data of the caller, they are copied when they are appended to the table
+	auto strings = FlatVector::GetData<string_t>(vector);
+	for (idx_t i = 0; i < count; i++) {
+		if (!validity.RowIsValid(i)) {
+			continue;
+		}
+		auto start = column.offsets[offset + i];
+		auto end = column.offsets[offset + i + 1];
+		if (end < start) {
+			throw InvalidInputException("AppendColumns: the string offsets of row %llu are decreasing", offset + i);
+		}
+		auto str = (const char *)column.data + start;
+		if (type.id() == LogicalTypeId::VARCHAR && Utf8Proc::Analyze(str, end - start) == UnicodeType::INVALID) {
+			throw InvalidInputException("AppendColumns: row %llu contains invalid UTF8", offset + i);
+		}
+		strings[i] = string_t(str, end - start);
+	}
+}
+
+void BaseAppender::AppendColumns(const vector<AppenderColumnData> &columns, idx_t count) {
+	if (columns.size() != types.size()) {
+		throw InvalidInputException("AppendColumns: expected data for %llu columns, but got %llu", types.size(),
+		                            columns.size());
+	}
+	for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+		auto &type = types[col_idx];
+		if (!columns[col_idx].data) {
+			throw InvalidInputException("AppendColumns: no data for column %llu", col_idx);
+		}
+		if (type.InternalType() == PhysicalType::VARCHAR) {
+			if (!columns[col_idx].offsets) {
+				throw InvalidInputException("AppendColumns: no string offsets for column %llu", col_idx);
+			}
+		} else if (!TypeIsConstantSize(type.InternalType())) {
+			throw NotImplementedException("AppendColumns: unsupported column type %s", type.ToString());
+		}
+	}
+	// rows that were appended one by one are flushed first, so the rows stay in the order they were appended in
+	Flush();
+	idx_t offset = 0;
+	AppendChunksInternal([&](DataChunk &chunk) {
+		if (offset >= count) {
+			return false;
+		}
+		auto chunk_count = MinValue<idx_t>(count - offset, STANDARD_VECTOR_SIZE);
+		for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+			SetColumnData(chunk.data[col_idx], columns[col_idx], offset, chunk_count);
+		}
+		chunk.SetCardinality(chunk_count);
+		offset += chunk_count;
+		return true;
+	});
+}
+
 void BaseAppender::FlushChunk() {
 	if (chunk.size() == 0) {
 		return;
@@ -360,6 +436,14 @@ void InternalAppender::FlushInternal(ColumnDataCollection &collection) {
 	table.storage->LocalAppend(table, context, collection);
 }
 
+void Appender::AppendChunksInternal(const std::function<bool(DataChunk &chunk)> &next_chunk) {
+	context->Append(*description, next_chunk);
+}
+
+void InternalAppender::AppendChunksInternal(const std::function<bool(DataChunk &chunk)> &next_chunk) {
+	table.storage->LocalAppend(table, context, next_chunk);
+}
+
 void BaseAppender::Close() {
 	if (column == 0 || column == types.size()) {
 		Flush();
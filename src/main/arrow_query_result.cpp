@@ -0,0 +1,55 @@
+#include "duckdb/main/arrow_query_result.hpp"
+#include "duckdb/common/to_string.hpp"
+
+namespace duckdb {
+
+ArrowQueryResult::ArrowQueryResult(StatementType statement_type, StatementProperties properties,
+                                   vector<string> names_p, vector<LogicalType> types_p,
+                                   vector<unique_ptr<ArrowArrayWrapper>> arrays_p, ClientProperties client_properties)
+    : QueryResult(QueryResultType::ARROW_RESULT, statement_type, properties, move(types_p), move(names_p),
+                  move(client_properties)),
+      arrays(move(arrays_p)), fetch_index(0) {
+}
+
+ArrowQueryResult::ArrowQueryResult(PreservedError error)
+    : QueryResult(QueryResultType::ARROW_RESULT, move(error)), fetch_index(0) {
+}
+
+unique_ptr<DataChunk> ArrowQueryResult::FetchRaw() {
+	throw InvalidInputException("Rows can not be fetched from a result that was converted to Arrow");
+}
+
+string ArrowQueryResult::ToString() {
+	if (!success) {
+		return GetError() + "\n";
+	}
+	string result = HeaderToString();
+	result += "[ Rows: " + to_string(RowCount()) + ", Arrays: " + to_string(arrays.size()) + "]\n";
+	return result;
+}
+
+idx_t ArrowQueryResult::FetchArray(ArrowArray *out) {
+	if (HasError()) {
+		throw InvalidInputException("Attempting to fetch from an unsuccessful query result\n: Error %s", GetError());
+	}
+	if (fetch_index >= arrays.size()) {
+		return 0;
+	}
+	// ownership of the array is transferred to the caller
+	auto &array = arrays[fetch_index++];
+	*out = array->arrow_array;
+	array->arrow_array.release = nullptr;
+	auto count = (idx_t)out->length;
+	array.reset();
+	return count;
+}
+
+idx_t ArrowQueryResult::RowCount() const {
+	idx_t count = 0;
+	for (idx_t i = fetch_index; i < arrays.size(); i++) {
+		count += arrays[i]->arrow_array.length;
+	}
+	return count;
+}
+
+} // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/main/capi/capi_internal.hpp"
 
 using duckdb::Appender;
+using duckdb::AppenderColumnData;
 using duckdb::AppenderWrapper;
 using duckdb::Connection;
 using duckdb::date_t;
@@ -206,3 +207,46 @@ duckdb_state duckdb_append_data_chunk(duckdb_appender appender, duckdb_data_chun
 	auto data_chunk = (duckdb::DataChunk *)chunk;
 	return duckdb_appender_run_function(appender, [&](Appender &appender) { appender.AppendDataChunk(*data_chunk); });
 }
+
+static duckdb_state duckdb_appender_set_column_internal(duckdb_appender appender, idx_t col_idx,
+                                                       const AppenderColumnData &column) {
+	return duckdb_appender_run_function(appender, [&](Appender &appender_p) {
+		auto &types = appender_p.GetTypes();
+		if (col_idx >= types.size()) {
+			throw duckdb::InvalidInputException("Column index %llu out of range", col_idx);
+		}
+		auto &columns = ((AppenderWrapper *)appender)->columns;
+		columns.resize(types.size());
+		columns[col_idx] = column;
+	});
+}
+
+duckdb_state duckdb_appender_set_column(duckdb_appender appender, idx_t col_idx, const void *data,
+                                        const uint64_t *validity) {
+	AppenderColumnData column;
+	column.data = data;
+	column.validity = validity;
+	return duckdb_appender_set_column_internal(appender, col_idx, column);
+}
+
+duckdb_state duckdb_appender_set_string_column(duckdb_appender appender, idx_t col_idx, const char *data,
+                                               const uint32_t *offsets, const uint64_t *validity) {
+	if (!offsets) {
+		return DuckDBError;
+	}
+	AppenderColumnData column;
+	column.data = data;
+	column.offsets = offsets;
+	column.validity = validity;
+	return duckdb_appender_set_column_internal(appender, col_idx, column);
+}
+
+duckdb_state duckdb_appender_append_columns(duckdb_appender appender, idx_t count) {
+	return duckdb_appender_run_function(appender, [&](Appender &appender_p) {
+		// the column data is only used for a single append, since it is owned by the caller
+		auto &columns = ((AppenderWrapper *)appender)->columns;
+		auto append_columns = move(columns);
+		columns.clear();
+		appender_p.AppendColumns(append_columns, count);
+	});
+}
@@ -62,6 +62,24 @@ void duckdb_disconnect(duckdb_connection *connection) {
 	}
 }
 
+duckdb_query_progress_type duckdb_query_progress(duckdb_connection connection) {
+	duckdb_query_progress_type result;
+	result.percentage = -1;
+	result.rows_processed = 0;
+	result.total_rows_to_process = 0;
+	result.bytes_read = 0;
+	if (!connection) {
+		return result;
+	}
+	Connection *conn = (Connection *)connection;
+	auto &progress = conn->context->GetQueryProgress();
+	result.percentage = progress.percentage;
+	result.rows_processed = progress.rows_processed;
+	result.total_rows_to_process = progress.total_rows_to_process;
+	result.bytes_read = progress.bytes_read;
+	return result;
+}
+
 duckdb_state duckdb_query(duckdb_connection connection, const char *query, duckdb_result *out) {
 	Connection *conn = (Connection *)connection;
 	auto result = conn->Query(query);
@@ -10,6 +10,9 @@
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/prepared_statement_cache.hpp"
+#include "duckdb/main/query_history.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/stream_query_result.hpp"
@@ -20,6 +23,8 @@
 #include "duckdb/parser/parsed_data/create_function_info.hpp"
 #include "duckdb/parser/statement/drop_statement.hpp"
 #include "duckdb/parser/statement/explain_statement.hpp"
+#include "duckdb/parser/statement/insert_statement.hpp"
+#include "duckdb/parser/tableref/expressionlistref.hpp"
 #include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/planner/operator/logical_execute.hpp"
 #include "duckdb/planner/planner.hpp"
@@ -35,6 +40,8 @@
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/execution/column_binding_resolver.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/helper/physical_buffered_collector.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
 #include "duckdb/parser/query_node/select_node.hpp"
 #include "duckdb/parser/parsed_expression_iterator.hpp"
 #include "duckdb/parser/statement/prepare_statement.hpp"
@@ -42,6 +49,8 @@
 #include "duckdb/common/types/column_data_collection.hpp"
 #include "duckdb/common/preserved_error.hpp"
 #include "duckdb/common/progress_bar.hpp"
+#include "duckdb/common/profiler.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 
 namespace duckdb {
@@ -57,6 +66,20 @@ struct ActiveQueryContext {
 	unique_ptr<Executor> executor;
 	//! The progress bar
 	unique_ptr<ProgressBar> progress_bar;
+	//! Whether or not the query is tracked in the query history
+	bool track_history = false;
+	//! The wall-clock timer of the query
+	Profiler timer;
+	//! The time at which the query started
+	timestamp_t start_time;
+	//! The database-wide amount of bytes read from files when the query started
+	idx_t bytes_read_start = 0;
+	//! The database-wide amount of bytes spilled to disk when the query started
+	idx_t spilled_bytes_start = 0;
+	//! The key under which the result of the query is added to the query result cache (if any)
+	string result_cache_key;
+	//! The cached result that is scanned by the query (if any)
+	shared_ptr<ColumnDataCollection> cached_result;
 };
 
 ClientContext::ClientContext(shared_ptr<DatabaseInstance> database)
@@ -146,12 +169,44 @@ void ClientContext::BeginQueryInternal(ClientContextLock &lock, const string &qu
 	BeginTransactionInternal(lock, false);
 	LogQueryInternal(lock, query);
 	active_query->query = query;
-	query_progress = -1;
+	query_progress.Initialize();
 	ActiveTransaction().active_query = db->GetTransactionManager().GetQueryNumber();
+
+	// start tracking the metrics of the query for the query history
+	auto &buffer_manager = BufferManager::GetBufferManager(*db);
+	active_query->timer.Start();
+	active_query->start_time = Timestamp::GetCurrentTimestamp();
+	active_query->bytes_read_start = FileSystem::GetTotalBytesRead();
+	active_query->spilled_bytes_start = buffer_manager.GetSpilledBytes();
+	active_query->track_history = true;
+	db->GetQueryHistory().BeginQuery(*db);
+}
+
+void ClientContext::AddQueryHistoryInternal(ClientContextLock &lock, bool success) {
+	D_ASSERT(active_query);
+	if (!active_query->track_history) {
+		return;
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(*db);
+	QueryHistoryEntry entry;
+	entry.query = active_query->query;
+	entry.start_time = active_query->start_time;
+	entry.latency = active_query->timer.Elapsed();
+	entry.success = success;
+	if (active_query->executor) {
+		entry.rows_scanned = active_query->executor->rows_scanned;
+		entry.cpu_time = double(active_query->executor->cpu_time.load()) / 1e9;
+	}
+	entry.bytes_read = FileSystem::GetTotalBytesRead() - active_query->bytes_read_start;
+	entry.peak_memory = buffer_manager.GetPeakMemory();
+	entry.spilled_bytes = buffer_manager.GetSpilledBytes() - active_query->spilled_bytes_start;
+	active_query->track_history = false;
+	db->GetQueryHistory().EndQuery(move(entry), db->config.options.query_history_size);
 }
 
 PreservedError ClientContext::EndQueryInternal(ClientContextLock &lock, bool success, bool invalidate_transaction) {
 	client_data->profiler->EndQuery();
+	AddQueryHistoryInternal(lock, success);
 
 	D_ASSERT(active_query.get());
 	PreservedError error;
@@ -192,7 +247,7 @@ PreservedError ClientContext::EndQueryInternal(ClientContextLock &lock, bool suc
 		error = PreservedError("Unhandled exception!");
 	} // LCOV_EXCL_STOP
 	active_query.reset();
-	query_progress = -1;
+	query_progress.Initialize();
 	return error;
 }
 
@@ -241,9 +296,9 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	auto &prepared = *active_query->prepared;
 	bool create_stream_result = prepared.properties.allow_stream_result && pending.allow_stream_result;
 	if (create_stream_result) {
-		D_ASSERT(!executor.HasResultCollector());
+		D_ASSERT(!executor.HasResultCollector() || executor.HasStreamingResultCollector());
 		active_query->progress_bar.reset();
-		query_progress = -1;
+		query_progress.Initialize();
 
 		// successfully compiled SELECT clause, and it is the last statement
 		// return a StreamQueryResult so the client can call Fetch() on it and stream the result
@@ -252,6 +307,10 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 		active_query->open_result = stream_result.get();
 		return move(stream_result);
 	}
+	// CleanupInternal resets the active query - keep what we need to add the result to the query result cache
+	auto result_cache_key = move(active_query->result_cache_key);
+	auto result_prepared = active_query->prepared;
+	auto result_start_time = ActiveTransaction().start_time;
 	unique_ptr<QueryResult> result;
 	if (executor.HasResultCollector()) {
 		// we have a result collector - fetch the result directly from the result collector
@@ -259,7 +318,7 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 		CleanupInternal(lock, result.get(), false);
 	} else {
 		// no result collector - create a materialized result by continuously fetching
-		auto result_collection = make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), pending.types);
+		auto result_collection = ColumnDataCollection::CreateMaterializedCollection(*this, pending.types);
 		D_ASSERT(!result_collection->Types().empty());
 		auto materialized_result = make_unique<MaterializedQueryResult>(
 		    pending.statement_type, pending.properties, pending.names, move(result_collection), GetClientProperties());
@@ -284,6 +343,12 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 		}
 		result = move(materialized_result);
 	}
+	if (!result_cache_key.empty() && !result->HasError() && result->type == QueryResultType::MATERIALIZED_RESULT) {
+		auto &materialized = (MaterializedQueryResult &)*result;
+		auto &db_config = DBConfig::GetConfig(*this);
+		QueryResultCache::Get(*this).Put(*this, result_cache_key, *result_prepared, result_start_time,
+		                                 materialized.Collection(), db_config.options.query_result_cache_size);
+	}
 	return result;
 }
 
@@ -342,6 +407,10 @@ shared_ptr<PreparedStatementData> ClientContext::CreatePreparedStatement(ClientC
 		plan->Verify(*this);
 #endif
 	}
+	if (DBConfig::GetConfig(*this).options.query_result_cache_size > 0 &&
+	    statement_type == StatementType::SELECT_STATEMENT) {
+		QueryResultCache::AnalyzePlan(*plan, *result);
+	}
 
 	profiler.StartPhase("physical_planner");
 	// now convert logical query plan into a physical query plan
@@ -357,7 +426,11 @@ shared_ptr<PreparedStatementData> ClientContext::CreatePreparedStatement(ClientC
 }
 
 double ClientContext::GetProgress() {
-	return query_progress.load();
+	return query_progress.percentage.load();
+}
+
+const QueryProgress &ClientContext::GetQueryProgress() {
+	return query_progress;
 }
 
 unique_ptr<PendingQueryResult> ClientContext::PendingPreparedStatement(ClientContextLock &lock,
@@ -377,12 +450,35 @@ unique_ptr<PendingQueryResult> ClientContext::PendingPreparedStatement(ClientCon
 	// bind the bound values before execution
 	statement.Bind(parameters.parameters ? *parameters.parameters : vector<Value>());
 
+	if (db_config.options.query_result_cache_size > 0 && statement.result_cacheable) {
+		auto key = QueryResultCache::GetCacheKey(*this, active_query->query,
+		                                         parameters.parameters ? *parameters.parameters : vector<Value>());
+		auto cached_result = key.empty() ? nullptr : QueryResultCache::Get(*this).Get(*this, key);
+		if (cached_result) {
+			// the result is cached - replace the plan with a scan of the cached result
+			auto cached_statement = make_shared<PreparedStatementData>(statement.statement_type);
+			cached_statement->names = statement.names;
+			cached_statement->types = statement.types;
+			cached_statement->properties = statement.properties;
+			cached_statement->catalog_version = statement.catalog_version;
+			auto scan = make_unique<PhysicalColumnDataScan>(statement.types, PhysicalOperatorType::COLUMN_DATA_SCAN,
+			                                                cached_result->Count());
+			scan->collection = cached_result.get();
+			cached_statement->plan = move(scan);
+			active_query->cached_result = move(cached_result);
+			return PendingPreparedStatement(lock, move(cached_statement), parameters);
+		}
+		active_query->result_cache_key = move(key);
+	}
+
+	auto &profiler = QueryProfiler::Get(*this);
+	profiler.StartPhase("executor_initialize");
 	active_query->executor = make_unique<Executor>(*this);
 	auto &executor = *active_query->executor;
 	if (config.enable_progress_bar) {
 		active_query->progress_bar = make_unique<ProgressBar>(executor, config.wait_time, config.print_progress_bar);
 		active_query->progress_bar->Start();
-		query_progress = 0;
+		query_progress.percentage = 0;
 	}
 	auto stream_result = parameters.allow_stream_result && statement.properties.allow_stream_result;
 	if (!stream_result && statement.properties.return_type == StatementReturnType::QUERY_RESULT) {
@@ -393,9 +489,14 @@ unique_ptr<PendingQueryResult> ClientContext::PendingPreparedStatement(ClientCon
 		collector = get_method(*this, statement);
 		D_ASSERT(collector->type == PhysicalOperatorType::RESULT_COLLECTOR);
 		executor.Initialize(move(collector));
+	} else if (stream_result && statement.properties.return_type == StatementReturnType::QUERY_RESULT &&
+	           config.streaming_buffer_size > 0) {
+		// the result is streamed, but produced by all threads into a bounded buffer
+		executor.Initialize(PhysicalBufferedCollector::Create(*this, statement));
 	} else {
 		executor.Initialize(statement.plan.get());
 	}
+	profiler.EndPhase();
 	auto types = executor.GetTypes();
 	D_ASSERT(types == statement.types);
 	D_ASSERT(!active_query->open_result);
@@ -410,10 +511,18 @@ PendingExecutionResult ClientContext::ExecuteTaskInternal(ClientContextLock &loc
 	D_ASSERT(active_query);
 	D_ASSERT(active_query->open_result == &result);
 	try {
+		if (active_query->executor->HasStreamingResultCollector()) {
+			// the query is executed while the streaming result is fetched
+			return PendingExecutionResult::RESULT_READY;
+		}
 		auto result = active_query->executor->ExecuteTask();
 		if (active_query->progress_bar) {
-			active_query->progress_bar->Update(result == PendingExecutionResult::RESULT_READY);
-			query_progress = active_query->progress_bar->GetCurrentPercentage();
+			auto &progress_bar = *active_query->progress_bar;
+			progress_bar.Update(result == PendingExecutionResult::RESULT_READY);
+			query_progress.percentage = progress_bar.GetCurrentPercentage();
+			query_progress.rows_processed = progress_bar.GetRowsProcessed();
+			query_progress.total_rows_to_process = progress_bar.GetTotalRowsToProcess();
+			query_progress.bytes_read = FileSystem::GetTotalBytesRead() - active_query->bytes_read_start;
 		}
 		return result;
 	} catch (FatalException &ex) {
@@ -490,6 +599,19 @@ unique_ptr<LogicalOperator> ClientContext::ExtractPlan(const string &query) {
 	return plan;
 }
 
+//! Whether or not prepared statements of the given type can be shared through the prepared statement cache
+static bool CanCachePreparedStatement(StatementType type) {
+	switch (type) {
+	case StatementType::SELECT_STATEMENT:
+	case StatementType::INSERT_STATEMENT:
+	case StatementType::UPDATE_STATEMENT:
+	case StatementType::DELETE_STATEMENT:
+		return true;
+	default:
+		return false;
+	}
+}
+
 unique_ptr<PreparedStatement> ClientContext::PrepareInternal(ClientContextLock &lock,
                                                              unique_ptr<SQLStatement> statement) {
 	auto n_param = statement->n_param;
@@ -497,8 +619,32 @@ unique_ptr<PreparedStatement> ClientContext::PrepareInternal(ClientContextLock &
 	shared_ptr<PreparedStatementData> prepared_data;
 	auto unbound_statement = statement->Copy();
 	RunFunctionInTransactionInternal(
-	    lock, [&]() { prepared_data = CreatePreparedStatement(lock, statement_query, move(statement)); }, false);
-	prepared_data->unbound_statement = move(unbound_statement);
+	    lock,
+	    [&]() {
+		    // check if the statement was already prepared by any connection
+		    auto &cache = PreparedStatementCache::Get(*this);
+		    auto cache_size = DBConfig::GetConfig(*this).options.prepared_statement_cache_size;
+		    auto catalog_version = Catalog::GetCatalog(*this).GetCatalogVersion();
+		    string cache_key;
+		    if (cache_size > 0 && CanCachePreparedStatement(statement->type) &&
+		        Transaction::GetTransaction(*this).catalog_version == catalog_version) {
+			    cache_key = PreparedStatementCache::GetCacheKey(*this, statement_query);
+		    }
+		    if (!cache_key.empty()) {
+			    prepared_data = cache.Get(cache_key, catalog_version);
+			    if (prepared_data) {
+				    return;
+			    }
+		    }
+		    prepared_data = CreatePreparedStatement(lock, statement_query, move(statement));
+		    prepared_data->unbound_statement = move(unbound_statement);
+		    // only statements that were bound against the committed catalog can be shared
+		    if (!cache_key.empty() && prepared_data->properties.bound_all_parameters &&
+		        prepared_data->catalog_version == Catalog::GetCatalog(*this).GetCatalogVersion()) {
+			    cache.Put(cache_key, prepared_data, cache_size);
+		    }
+	    },
+	    false);
 	return make_unique<PreparedStatement>(shared_from_this(), move(prepared_data), move(statement_query), n_param);
 }
 
@@ -575,6 +721,147 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 	return Execute(query, prepared, parameters);
 }
 
+static void ReplaceParameters(unique_ptr<ParsedExpression> &expr, DataChunk &parameters, idx_t row) {
+	if (expr->type == ExpressionType::VALUE_PARAMETER) {
+		auto &parameter = (ParameterExpression &)*expr;
+		D_ASSERT(parameter.parameter_nr > 0 && parameter.parameter_nr <= parameters.ColumnCount());
+		expr = make_unique<ConstantExpression>(parameters.GetValue(parameter.parameter_nr - 1, row));
+		return;
+	}
+	ParsedExpressionIterator::EnumerateChildren(
+	    *expr, [&](unique_ptr<ParsedExpression> &child) { ReplaceParameters(child, parameters, row); });
+}
+
+//! Rewrites INSERT INTO tbl VALUES (?, ...) into a single INSERT of a row for every set of parameters
+//! Returns nullptr if the statement is not an INSERT of a single row of values that holds all parameters
+static unique_ptr<SQLStatement> CreateBatchInsert(PreparedStatementData &prepared, DataChunk &parameters) {
+	if (!prepared.unbound_statement || prepared.unbound_statement->type != StatementType::INSERT_STATEMENT ||
+	    parameters.size() == 0) {
+		return nullptr;
+	}
+	auto &insert = (InsertStatement &)*prepared.unbound_statement;
+	if (!insert.returning_list.empty() || !insert.cte_map.map.empty()) {
+		return nullptr;
+	}
+	auto values_list = insert.GetValuesList();
+	if (!values_list || values_list->values.size() != 1) {
+		return nullptr;
+	}
+	auto result = insert.Copy();
+	auto &result_values = *((InsertStatement &)*result).GetValuesList();
+	auto row = move(result_values.values[0]);
+	result_values.values.clear();
+	for (idx_t row_idx = 0; row_idx < parameters.size(); row_idx++) {
+		vector<unique_ptr<ParsedExpression>> new_row;
+		for (auto &expr : row) {
+			auto copy = expr->Copy();
+			ReplaceParameters(copy, parameters, row_idx);
+			new_row.push_back(move(copy));
+		}
+		result_values.values.push_back(move(new_row));
+	}
+	result->n_param = 0;
+	return result;
+}
+
+unique_ptr<QueryResult> ClientContext::ExecuteBatchInternal(ClientContextLock &lock, const string &query,
+                                                            shared_ptr<PreparedStatementData> &prepared,
+                                                            DataChunk &parameters) {
+	PendingQueryParameters pending_parameters;
+	pending_parameters.allow_stream_result = false;
+	auto batch_insert = CreateBatchInsert(*prepared, parameters);
+	if (batch_insert) {
+		// all parameter sets are inserted by a single statement
+		shared_ptr<PreparedStatementData> no_prepared;
+		auto pending = PendingStatementOrPreparedStatementInternal(lock, query, move(batch_insert), no_prepared,
+		                                                           pending_parameters);
+		if (pending->HasError()) {
+			return make_unique<MaterializedQueryResult>(pending->GetErrorObject());
+		}
+		return pending->ExecuteInternal(lock);
+	}
+	// execute the statement for every set of parameters, and combine the results
+	bool changed_rows = prepared->properties.return_type == StatementReturnType::CHANGED_ROWS;
+	int64_t changed_row_count = 0;
+	unique_ptr<ColumnDataCollection> collection;
+	vector<Value> values(parameters.ColumnCount());
+	pending_parameters.parameters = &values;
+	for (idx_t row_idx = 0; row_idx < parameters.size(); row_idx++) {
+		for (idx_t col_idx = 0; col_idx < parameters.ColumnCount(); col_idx++) {
+			values[col_idx] = parameters.GetValue(col_idx, row_idx);
+		}
+		auto pending = PendingQueryPreparedInternal(lock, query, prepared, pending_parameters);
+		if (pending->HasError()) {
+			return make_unique<MaterializedQueryResult>(pending->GetErrorObject());
+		}
+		auto result = pending->ExecuteInternal(lock);
+		if (result->HasError()) {
+			return result;
+		}
+		D_ASSERT(result->type == QueryResultType::MATERIALIZED_RESULT);
+		auto &materialized = (MaterializedQueryResult &)*result;
+		if (changed_rows) {
+			changed_row_count += materialized.GetValue(0, 0).GetValue<int64_t>();
+			continue;
+		}
+		if (!collection) {
+			collection = make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), materialized.types);
+		}
+		for (auto &chunk : materialized.Collection().Chunks()) {
+			collection->Append(chunk);
+		}
+	}
+	if (!collection) {
+		collection = make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), prepared->types);
+	}
+	if (changed_rows) {
+		DataChunk chunk;
+		chunk.Initialize(Allocator::DefaultAllocator(), prepared->types);
+		chunk.SetValue(0, 0, Value::BIGINT(changed_row_count));
+		chunk.SetCardinality(1);
+		collection->Append(chunk);
+	}
+	return make_unique<MaterializedQueryResult>(prepared->statement_type, prepared->properties, prepared->names,
+	                                            move(collection), GetClientProperties());
+}
+
+unique_ptr<QueryResult> ClientContext::ExecuteBatch(const string &query, shared_ptr<PreparedStatementData> &prepared,
+                                                    DataChunk &parameters) {
+	auto lock = LockContext();
+	if (parameters.ColumnCount() != prepared->properties.parameter_count) {
+		return make_unique<MaterializedQueryResult>(
+		    PreservedError(StringUtil::Format("Expected %llu parameter columns, but got %llu",
+		                                      prepared->properties.parameter_count, parameters.ColumnCount())));
+	}
+	try {
+		InitialCleanup(*lock);
+	} catch (std::exception &ex) {
+		return make_unique<MaterializedQueryResult>(PreservedError(ex));
+	}
+	// in auto-commit mode the executions run in a transaction of their own, instead of committing every execution
+	bool batch_transaction = transaction.IsAutoCommit() && !transaction.HasActiveTransaction();
+	if (batch_transaction) {
+		transaction.BeginTransaction();
+		transaction.SetAutoCommit(false);
+	}
+	auto result = ExecuteBatchInternal(*lock, query, prepared, parameters);
+	if (batch_transaction) {
+		transaction.SetAutoCommit(true);
+		try {
+			if (transaction.HasActiveTransaction()) {
+				if (result->HasError()) {
+					transaction.Rollback();
+				} else {
+					transaction.Commit();
+				}
+			}
+		} catch (std::exception &ex) {
+			return make_unique<MaterializedQueryResult>(PreservedError(ex));
+		}
+	}
+	return result;
+}
+
 unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientContextLock &lock, const string &query,
                                                                        unique_ptr<SQLStatement> statement,
                                                                        PendingQueryParameters parameters) {
@@ -696,7 +983,8 @@ unique_ptr<PendingQueryResult> ClientContext::PendingStatementOrPreparedStatemen
 				auto new_prepared =
 				    CreatePreparedStatement(lock, query, prepared->unbound_statement->Copy(), parameters.parameters);
 				D_ASSERT(new_prepared->properties.bound_all_parameters);
-				new_prepared->unbound_statement = move(prepared->unbound_statement);
+				// copy the unbound statement: the prepared statement data might be shared through the cache
+				new_prepared->unbound_statement = prepared->unbound_statement->Copy();
 				prepared = move(new_prepared);
 				prepared->properties.bound_all_parameters = false;
 			}
@@ -955,23 +1243,35 @@ unique_ptr<TableDescription> ClientContext::TableInfo(const string &schema_name,
 	return result;
 }
 
-void ClientContext::Append(TableDescription &description, ColumnDataCollection &collection) {
-	RunFunctionInTransaction([&]() {
-		auto &catalog = Catalog::GetCatalog(*this);
-		auto table_entry = catalog.GetEntry<TableCatalogEntry>(*this, description.schema, description.table);
-		// verify that the table columns and types match up
-		if (description.columns.size() != table_entry->columns.PhysicalColumnCount()) {
+static TableCatalogEntry *GetAppendTable(ClientContext &context, TableDescription &description) {
+	auto &catalog = Catalog::GetCatalog(context);
+	auto table_entry = catalog.GetEntry<TableCatalogEntry>(context, description.schema, description.table);
+	// verify that the table columns and types match up
+	if (description.columns.size() != table_entry->columns.PhysicalColumnCount()) {
+		throw Exception("Failed to append: table entry has different number of columns!");
+	}
+	for (idx_t i = 0; i < description.columns.size(); i++) {
+		if (description.columns[i].Type() != table_entry->columns.GetColumn(PhysicalIndex(i)).Type()) {
 			throw Exception("Failed to append: table entry has different number of columns!");
 		}
-		for (idx_t i = 0; i < description.columns.size(); i++) {
-			if (description.columns[i].Type() != table_entry->columns.GetColumn(PhysicalIndex(i)).Type()) {
-				throw Exception("Failed to append: table entry has different number of columns!");
-			}
-		}
+	}
+	return table_entry;
+}
+
+void ClientContext::Append(TableDescription &description, ColumnDataCollection &collection) {
+	RunFunctionInTransaction([&]() {
+		auto table_entry = GetAppendTable(*this, description);
 		table_entry->storage->LocalAppend(*table_entry, *this, collection);
 	});
 }
 
+void ClientContext::Append(TableDescription &description, const std::function<bool(DataChunk &chunk)> &next_chunk) {
+	RunFunctionInTransaction([&]() {
+		auto table_entry = GetAppendTable(*this, description);
+		table_entry->storage->LocalAppend(*table_entry, *this, next_chunk);
+	});
+}
+
 void ClientContext::TryBindRelation(Relation &relation, vector<ColumnDefinition> &result_columns) {
 #ifdef DEBUG
 	D_ASSERT(!relation.GetAlias().empty());
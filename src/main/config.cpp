@@ -24,9 +24,15 @@ namespace duckdb {
 	{ nullptr, nullptr, LogicalTypeId::INVALID, nullptr, nullptr, nullptr }
 
 static ConfigurationOption internal_options[] = {DUCKDB_GLOBAL(AccessModeSetting),
+                                                 DUCKDB_GLOBAL(AllocatorHugePagesSetting),
+                                                 DUCKDB_GLOBAL(BackgroundCheckpointSetting),
+                                                 DUCKDB_GLOBAL(BufferEvictionPolicySetting),
+                                                 DUCKDB_GLOBAL(CheckpointBloomFiltersSetting),
                                                  DUCKDB_GLOBAL(CheckpointThresholdSetting),
+                                                 DUCKDB_GLOBAL(CompressTemporaryFilesSetting),
                                                  DUCKDB_GLOBAL(DebugCheckpointAbort),
                                                  DUCKDB_LOCAL(DebugForceExternal),
+                                                 DUCKDB_LOCAL(DebugForcePartitionedJoinBuild),
                                                  DUCKDB_LOCAL(DebugForceNoCrossProduct),
                                                  DUCKDB_GLOBAL(DebugWindowMode),
                                                  DUCKDB_GLOBAL_LOCAL(DefaultCollationSetting),
@@ -50,20 +56,34 @@ static ConfigurationOption internal_options[] = {DUCKDB_GLOBAL(AccessModeSetting
                                                  DUCKDB_GLOBAL(MaximumMemorySetting),
                                                  DUCKDB_GLOBAL_ALIAS("memory_limit", MaximumMemorySetting),
                                                  DUCKDB_GLOBAL_ALIAS("null_order", DefaultNullOrderSetting),
+                                                 DUCKDB_LOCAL(MaximumQueryThreadsSetting),
+                                                 DUCKDB_GLOBAL(ObjectCacheSizeSetting),
                                                  DUCKDB_GLOBAL(PasswordSetting),
                                                  DUCKDB_LOCAL(PerfectHashThresholdSetting),
+                                                 DUCKDB_GLOBAL(PinThreadsSetting),
+                                                 DUCKDB_GLOBAL(PreparedStatementCacheSizeSetting),
                                                  DUCKDB_LOCAL(PreserveIdentifierCase),
                                                  DUCKDB_GLOBAL(PreserveInsertionOrder),
                                                  DUCKDB_LOCAL(ProfilerHistorySize),
                                                  DUCKDB_LOCAL(ProfileOutputSetting),
+                                                 DUCKDB_LOCAL(ProfilingCountersSetting),
                                                  DUCKDB_LOCAL(ProfilingModeSetting),
                                                  DUCKDB_LOCAL_ALIAS("profiling_output", ProfileOutputSetting),
                                                  DUCKDB_LOCAL(ProgressBarTimeSetting),
+                                                 DUCKDB_LOCAL(QueryMemoryLimitSetting),
+                                                 DUCKDB_GLOBAL(QueryResultCacheSizeSetting),
+                                                 DUCKDB_GLOBAL(QueryHistorySizeSetting),
+                                                 DUCKDB_LOCAL(QueryPrioritySetting),
                                                  DUCKDB_LOCAL(SchemaSetting),
                                                  DUCKDB_LOCAL(SearchPathSetting),
+                                                 DUCKDB_LOCAL(StreamingBufferSizeSetting),
+                                                 DUCKDB_GLOBAL(SynchronousCommitSetting),
                                                  DUCKDB_GLOBAL(TempDirectorySetting),
                                                  DUCKDB_GLOBAL(ThreadsSetting),
+                                                 DUCKDB_LOCAL(TraceOutputSetting),
+                                                 DUCKDB_GLOBAL(UseMmapSetting),
                                                  DUCKDB_GLOBAL(UsernameSetting),
+                                                 DUCKDB_GLOBAL(VerifyChecksumsOnceSetting),
                                                  DUCKDB_GLOBAL_ALIAS("user", UsernameSetting),
                                                  DUCKDB_GLOBAL_ALIAS("wal_autocheckpoint", CheckpointThresholdSetting),
                                                  DUCKDB_GLOBAL_ALIAS("worker_threads", ThreadsSetting),
@@ -132,8 +152,9 @@ void DBConfig::SetOption(const string &name, Value value) {
 }
 
 void DBConfig::AddExtensionOption(string name, string description, LogicalType parameter,
-                                  set_option_callback_t function) {
-	extension_parameters.insert(make_pair(move(name), ExtensionOption(move(description), move(parameter), function)));
+                                  set_option_callback_t function, get_option_default_callback_t default_function) {
+	extension_parameters.insert(
+	    make_pair(move(name), ExtensionOption(move(description), move(parameter), function, default_function)));
 }
 
 CastFunctionSet &DBConfig::GetCastFunctions() {
@@ -6,6 +6,9 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/object_cache.hpp"
+#include "duckdb/main/prepared_statement_cache.hpp"
+#include "duckdb/main/query_result_cache.hpp"
+#include "duckdb/main/query_history.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/function/compression_function.hpp"
@@ -51,6 +54,10 @@ DatabaseInstance::DatabaseInstance() {
 }
 
 DatabaseInstance::~DatabaseInstance() {
+	if (transaction_manager) {
+		// the background checkpoint thread must not run concurrently with the checkpoint on shutdown
+		transaction_manager->StopBackgroundCheckpoint();
+	}
 	if (Exception::UncaughtException()) {
 		return;
 	}
@@ -168,7 +175,10 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	catalog = make_unique<Catalog>(*this);
 	transaction_manager = make_unique<TransactionManager>(*this);
 	scheduler = make_unique<TaskScheduler>(*this);
-	object_cache = make_unique<ObjectCache>();
+	object_cache = make_unique<ObjectCache>(config.options.object_cache_size);
+	prepared_statement_cache = make_unique<PreparedStatementCache>();
+	query_result_cache = make_unique<QueryResultCache>();
+	query_history = make_unique<QueryHistory>();
 	connection_manager = make_unique<ConnectionManager>();
 
 	// initialize the database
@@ -221,6 +231,18 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+PreparedStatementCache &DatabaseInstance::GetPreparedStatementCache() {
+	return *prepared_statement_cache;
+}
+
+QueryResultCache &DatabaseInstance::GetQueryResultCache() {
+	return *query_result_cache;
+}
+
+QueryHistory &DatabaseInstance::GetQueryHistory() {
+	return *query_history;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *config.file_system;
 }
@@ -268,6 +290,7 @@ void DatabaseInstance::Configure(DBConfig &new_config) {
 	if (!config.allocator) {
 		config.allocator = make_unique<Allocator>();
 	}
+	config.allocator->SetHugePages(config.options.allocator_huge_pages);
 	config.replacement_scans = move(new_config.replacement_scans);
 	config.replacement_opens = move(new_config.replacement_opens);
 	config.parser_extensions = move(new_config.parser_extensions);
@@ -315,8 +338,27 @@ bool DatabaseInstance::TryGetCurrentSetting(const std::string &key, Value &resul
 	auto global_value = global_config_map.find(key);
 	bool found_global_value = global_value != global_config_map.end();
 	if (!found_global_value) {
+		return TryGetExtensionOptionDefault(key, result);
+	}
+	result = global_value->second;
+	return true;
+}
+
+bool DatabaseInstance::TryGetExtensionOptionDefault(const std::string &key, Value &result) {
+	auto &db_config = DBConfig::GetConfig(*this);
+	auto entry = db_config.extension_parameters.find(key);
+	if (entry == db_config.extension_parameters.end() || !entry->second.default_function) {
 		return false;
 	}
+	// compute the default value of the extension option on first use, and store it as the global value
+	auto default_value = entry->second.default_function(*this);
+	lock_guard<mutex> l(db_config.config_lock);
+	auto &global_config_map = db_config.options.set_variables;
+	auto global_value = global_config_map.find(key);
+	if (global_value == global_config_map.end()) {
+		// the option was not set in the meantime
+		global_value = global_config_map.insert(make_pair(key, move(default_value))).first;
+	}
 	result = global_value->second;
 	return true;
 }
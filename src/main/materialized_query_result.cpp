@@ -72,8 +72,9 @@ unique_ptr<DataChunk> MaterializedQueryResult::FetchRaw() {
 	auto result = make_unique<DataChunk>();
 	collection->InitializeScanChunk(*result);
 	if (!scan_initialized) {
-		// we disallow zero copy so the chunk is independently usable even after the result is destroyed
-		collection->InitializeScan(scan_state, ColumnDataScanProperties::DISALLOW_ZERO_COPY);
+		// the chunk has to be independently usable even after the result is destroyed
+		// zero copy is only used where the chunk can keep the memory it points to alive
+		collection->InitializeScan(scan_state, ColumnDataScanProperties::KEEP_ALIVE_ZERO_COPY);
 		scan_initialized = true;
 	}
 	collection->Scan(scan_state, *result);
@@ -0,0 +1,188 @@
+#include "duckdb/main/parallel_appender.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+#include "duckdb/transaction/transaction.hpp"
+
+namespace duckdb {
+
+struct LocalAppenderState {
+	//! The thread-local row groups
+	unique_ptr<RowGroupCollection> local_collection;
+	TableAppendState local_append_state;
+	//! Writes full row groups to disk while appending
+	OptimisticDataWriter *writer;
+	//! The state for verifying the constraints of the appended chunks
+	unique_ptr<ConstraintState> constraint_state;
+};
+
+//===--------------------------------------------------------------------===//
+// Parallel Appender
+//===--------------------------------------------------------------------===//
+ParallelAppender::ParallelAppender(Connection &con, const string &schema_name, const string &table_name)
+    : context(con.context), table(nullptr) {
+	auto result = context->Query("BEGIN TRANSACTION", false);
+	if (result->HasError()) {
+		result->ThrowError("Failed to create parallel appender: ");
+	}
+	try {
+		context->RunFunctionInTransaction([&]() {
+			auto &catalog = Catalog::GetCatalog(*context);
+			table = catalog.GetEntry<TableCatalogEntry>(*context, schema_name, table_name);
+		});
+	} catch (...) {
+		context->Query("ROLLBACK", false);
+		throw;
+	}
+}
+
+ParallelAppender::ParallelAppender(Connection &con, const string &table_name)
+    : ParallelAppender(con, DEFAULT_SCHEMA, table_name) {
+}
+
+ParallelAppender::~ParallelAppender() {
+	if (finished) {
+		return;
+	}
+	try {
+		context->Query("ROLLBACK", false);
+	} catch (...) {
+	}
+}
+
+unique_ptr<LocalAppender> ParallelAppender::CreateLocalAppender() {
+	lock_guard<mutex> guard(lock);
+	if (finished) {
+		throw InvalidInputException("Failed to create local appender: the parallel appender is already finished");
+	}
+	auto state = make_unique<LocalAppenderState>();
+	auto &block_manager = TableIOManager::Get(*table->storage).GetBlockManagerForRowData();
+	state->local_collection =
+	    make_unique<RowGroupCollection>(table->storage->info, block_manager, table->GetTypes(), MAX_ROW_ID);
+	state->local_collection->InitializeEmpty();
+	state->local_collection->InitializeAppend(state->local_append_state);
+	state->writer = table->storage->CreateOptimisticWriter(*context);
+	active_appenders++;
+	return make_unique<LocalAppender>(*this, move(state));
+}
+
+void ParallelAppender::MergeLocalState(LocalAppenderState &local_state) {
+	auto &collection = *local_state.local_collection;
+	TransactionData tdata(0, 0);
+	collection.FinalizeAppend(tdata, local_state.local_append_state);
+	auto append_count = collection.GetTotalRows();
+	if (append_count == 0) {
+		return;
+	}
+	if (append_count < LocalStorage::MERGE_THRESHOLD) {
+		// we have few rows - append to the local storage directly
+		lock_guard<mutex> guard(lock);
+		LocalAppendState append_state;
+		table->storage->InitializeLocalAppend(append_state, *context);
+		auto &transaction = Transaction::GetTransaction(*context);
+		collection.Scan(transaction, [&](DataChunk &chunk) {
+			table->storage->LocalAppend(append_state, *table, *context, chunk);
+			return true;
+		});
+		table->storage->FinalizeLocalAppend(append_state);
+	} else {
+		// we have many rows - flush the remaining row group to disk (if required) and merge the row groups into the
+		// transaction-local storage
+		local_state.writer->FlushToDisk(collection);
+		local_state.writer->FinalFlush();
+
+		lock_guard<mutex> guard(lock);
+		table->storage->LocalMerge(*context, collection);
+	}
+}
+
+void ParallelAppender::SetError(const string &error_p) {
+	lock_guard<mutex> guard(lock);
+	if (error.empty()) {
+		error = error_p;
+	}
+}
+
+void ParallelAppender::Commit() {
+	{
+		lock_guard<mutex> guard(lock);
+		if (finished) {
+			throw InvalidInputException("Failed to commit: the parallel appender is already finished");
+		}
+		if (active_appenders > 0) {
+			throw InvalidInputException("Failed to commit: %llu local appenders have not been destroyed yet",
+			                            active_appenders);
+		}
+		finished = true;
+	}
+	if (!error.empty()) {
+		context->Query("ROLLBACK", false);
+		throw InvalidInputException("Failed to commit: a local appender failed: %s", error);
+	}
+	auto result = context->Query("COMMIT", false);
+	if (result->HasError()) {
+		result->ThrowError("Failed to commit: ");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Local Appender
+//===--------------------------------------------------------------------===//
+LocalAppender::LocalAppender(ParallelAppender &parent_p, unique_ptr<LocalAppenderState> state_p)
+    : BaseAppender(Allocator::DefaultAllocator(), parent_p.table->GetTypes(), AppenderType::LOGICAL),
+      parent(parent_p), state(move(state_p)) {
+}
+
+LocalAppender::~LocalAppender() {
+	if (Exception::UncaughtException()) {
+		// the data of this appender is incomplete, so the transaction can not be committed
+		parent.SetError("the local appender was destroyed during exception handling");
+	} else {
+		try {
+			Close();
+			parent.MergeLocalState(*state);
+		} catch (std::exception &ex) {
+			parent.SetError(ex.what());
+		} catch (...) { // LCOV_EXCL_START
+			parent.SetError("unknown error");
+		} // LCOV_EXCL_STOP
+	}
+	lock_guard<mutex> guard(parent.lock);
+	parent.active_appenders--;
+}
+
+void LocalAppender::AppendChunk(DataChunk &chunk) {
+	auto &table = *parent.table;
+	if (!state->constraint_state) {
+		state->constraint_state = make_unique<ConstraintState>(table, *parent.context);
+	}
+	table.storage->VerifyAppendConstraints(*state->constraint_state, *parent.context, chunk);
+	auto new_row_group = state->local_collection->Append(chunk, state->local_append_state);
+	if (new_row_group) {
+		state->writer->CheckFlushToDisk(*state->local_collection);
+	}
+}
+
+void LocalAppender::FlushInternal(ColumnDataCollection &collection) {
+	for (auto &chunk : collection.Chunks()) {
+		AppendChunk(chunk);
+	}
+}
+
+void LocalAppender::AppendChunksInternal(const std::function<bool(DataChunk &chunk)> &next_chunk) {
+	DataChunk chunk;
+	chunk.Initialize(allocator, types);
+	while (next_chunk(chunk)) {
+		AppendChunk(chunk);
+		chunk.Reset();
+	}
+}
+
+} // namespace duckdb
@@ -59,6 +59,14 @@ unique_ptr<QueryResult> PreparedStatement::Execute(vector<Value> &values, bool a
 	return pending->Execute();
 }
 
+unique_ptr<QueryResult> PreparedStatement::ExecuteBatch(DataChunk &parameters) {
+	if (!success) {
+		throw InvalidInputException("Attempting to execute an unsuccessfully prepared statement!");
+	}
+	D_ASSERT(data);
+	return context->ExecuteBatch(query, data, parameters);
+}
+
 unique_ptr<PendingQueryResult> PreparedStatement::PendingQuery(vector<Value> &values, bool allow_stream_result) {
 	if (!success) {
 		throw InvalidInputException("Attempting to execute an unsuccessfully prepared statement!");
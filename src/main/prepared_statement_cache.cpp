@@ -0,0 +1,118 @@
+#include "duckdb/main/prepared_statement_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/parser/parser.hpp"
+
+namespace duckdb {
+
+shared_ptr<PreparedStatementData> PreparedStatementCache::Get(const string &key, idx_t catalog_version) {
+	lock_guard<mutex> glock(lock);
+	auto entry = entries.find(key);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	auto &data = entry->second.data;
+	if (data->catalog_version != catalog_version) {
+		// the catalog was modified since the statement was bound
+		lru.erase(entry->second.lru_position);
+		entries.erase(entry);
+		return nullptr;
+	}
+	if (data.use_count() > 1) {
+		// the statement data is in use by another prepared statement
+		return nullptr;
+	}
+	lru.splice(lru.begin(), lru, entry->second.lru_position);
+	return data;
+}
+
+void PreparedStatementCache::Put(const string &key, shared_ptr<PreparedStatementData> data, idx_t capacity) {
+	lock_guard<mutex> glock(lock);
+	auto entry = entries.find(key);
+	if (entry != entries.end()) {
+		// the cached statement was in use: keep it
+		lru.splice(lru.begin(), lru, entry->second.lru_position);
+		return;
+	}
+	lru.push_front(key);
+	auto &new_entry = entries[key];
+	new_entry.data = move(data);
+	new_entry.lru_position = lru.begin();
+	EvictInternal(capacity);
+}
+
+void PreparedStatementCache::Evict(idx_t capacity) {
+	lock_guard<mutex> glock(lock);
+	EvictInternal(capacity);
+}
+
+void PreparedStatementCache::EvictInternal(idx_t capacity) {
+	while (entries.size() > capacity) {
+		entries.erase(lru.back());
+		lru.pop_back();
+	}
+}
+
+idx_t PreparedStatementCache::Count() {
+	lock_guard<mutex> glock(lock);
+	return entries.size();
+}
+
+static bool HasTemporaryObjects(ClientContext &context) {
+	auto &temporary_objects = *ClientData::Get(context).temporary_objects;
+	bool found = false;
+	auto callback = [&](CatalogEntry *entry) {
+		found = true;
+	};
+	temporary_objects.Scan(context, CatalogType::TABLE_ENTRY, callback);
+	if (!found) {
+		temporary_objects.Scan(context, CatalogType::SEQUENCE_ENTRY, callback);
+	}
+	if (!found) {
+		temporary_objects.Scan(context, CatalogType::MACRO_ENTRY, callback);
+	}
+	return found;
+}
+
+string PreparedStatementCache::GetCacheKey(ClientContext &context, const string &query) {
+	if (HasTemporaryObjects(context)) {
+		// temporary objects are private to the connection and could shadow the objects a cached statement refers to
+		return string();
+	}
+	// the search path and identifier case affect how the statement is bound
+	string result;
+	for (auto &path : ClientData::Get(context).catalog_search_path->Get()) {
+		result += KeywordHelper::WriteOptionallyQuoted(path) + ",";
+	}
+	result += ClientConfig::GetConfig(context).preserve_identifier_case ? "1\n" : "0\n";
+	// normalize the query: remove comments, collapse whitespace and lowercase the keywords
+	auto tokens = Parser::Tokenize(query);
+	for (idx_t i = 0; i < tokens.size(); i++) {
+		auto &token = tokens[i];
+		if (token.type == SimplifiedTokenType::SIMPLIFIED_TOKEN_COMMENT) {
+			continue;
+		}
+		auto end = i + 1 < tokens.size() ? tokens[i + 1].start : query.size();
+		auto text = query.substr(token.start, end - token.start);
+		StringUtil::RTrim(text);
+		if (token.type == SimplifiedTokenType::SIMPLIFIED_TOKEN_KEYWORD) {
+			text = StringUtil::Lower(text);
+		}
+		result += text + " ";
+	}
+	return result;
+}
+
+PreparedStatementCache &PreparedStatementCache::Get(ClientContext &context) {
+	return context.db->GetPreparedStatementCache();
+}
+
+} // namespace duckdb
@@ -0,0 +1,49 @@
+#include "duckdb/main/query_history.hpp"
+
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+QueryHistory::QueryHistory() : query_count(0), active_queries(0) {
+}
+
+void QueryHistory::BeginQuery(DatabaseInstance &db) {
+	if (active_queries++ == 0) {
+		// no other query is running: start measuring the peak memory from the current memory usage
+		BufferManager::GetBufferManager(db).ResetPeakMemory();
+	}
+}
+
+void QueryHistory::EndQuery(QueryHistoryEntry entry, idx_t capacity) {
+	D_ASSERT(active_queries > 0);
+	active_queries--;
+	lock_guard<mutex> glock(lock);
+	entry.query_id = ++query_count;
+	if (capacity == 0) {
+		return;
+	}
+	entries.push_back(move(entry));
+	while (entries.size() > capacity) {
+		entries.pop_front();
+	}
+}
+
+void QueryHistory::Evict(idx_t capacity) {
+	lock_guard<mutex> glock(lock);
+	while (entries.size() > capacity) {
+		entries.pop_front();
+	}
+}
+
+vector<QueryHistoryEntry> QueryHistory::GetEntries() {
+	lock_guard<mutex> glock(lock);
+	return vector<QueryHistoryEntry>(entries.begin(), entries.end());
+}
+
+QueryHistory &QueryHistory::Get(ClientContext &context) {
+	return context.db->GetQueryHistory();
+}
+
+} // namespace duckdb
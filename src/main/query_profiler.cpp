@@ -30,6 +30,10 @@ bool QueryProfiler::IsDetailedEnabled() const {
 	return is_explain_analyze ? false : ClientConfig::GetConfig(context).enable_detailed_profiling;
 }
 
+bool QueryProfiler::IsCountersEnabled() const {
+	return IsEnabled() && ClientConfig::GetConfig(context).enable_profiling_counters;
+}
+
 ProfilerPrintFormat QueryProfiler::GetPrintFormat() const {
 	return ClientConfig::GetConfig(context).profiler_print_format;
 }
@@ -221,7 +225,8 @@ void QueryProfiler::Initialize(PhysicalOperator *root_op) {
 	}
 }
 
-OperatorProfiler::OperatorProfiler(bool enabled_p) : enabled(enabled_p), active_operator(nullptr) {
+OperatorProfiler::OperatorProfiler(bool enabled_p, bool counters_enabled_p)
+    : enabled(enabled_p), counters_enabled(enabled_p && counters_enabled_p), active_operator(nullptr) {
 }
 
 void OperatorProfiler::StartOperator(const PhysicalOperator *phys_op) {
@@ -237,6 +242,12 @@ void OperatorProfiler::StartOperator(const PhysicalOperator *phys_op) {
 
 	// start timing for current element
 	op.Start();
+	if (counters_enabled) {
+		counters_start = HardwareCounters::Get().Read();
+	}
+	auto &memory = MemoryStatistics::Get();
+	memory.ResetPeak();
+	memory_start = memory;
 }
 
 void OperatorProfiler::EndOperator(DataChunk *chunk) {
@@ -250,12 +261,17 @@ void OperatorProfiler::EndOperator(DataChunk *chunk) {
 
 	// finish timing for the current element
 	op.End();
+	HardwareCounterValues counters;
+	if (counters_enabled) {
+		counters = HardwareCounters::Get().Read() - counters_start;
+	}
 
-	AddTiming(active_operator, op.Elapsed(), chunk ? chunk->size() : 0);
+	AddTiming(active_operator, op.Elapsed(), chunk ? chunk->size() : 0, counters, MemoryStatistics::Get());
 	active_operator = nullptr;
 }
 
-void OperatorProfiler::AddTiming(const PhysicalOperator *op, double time, idx_t elements) {
+void OperatorProfiler::AddTiming(const PhysicalOperator *op, double time, idx_t elements,
+                                 const HardwareCounterValues &counters, const MemoryStatistics &memory_end) {
 	if (!enabled) {
 		return;
 	}
@@ -266,10 +282,14 @@ void OperatorProfiler::AddTiming(const PhysicalOperator *op, double time, idx_t
 	if (entry == timings.end()) {
 		// add new entry
 		timings[op] = OperatorInformation(time, elements);
+		timings[op].counters = counters;
+		timings[op].memory.Add(memory_start, memory_end);
 	} else {
 		// add to existing entry
 		entry->second.time += time;
 		entry->second.elements += elements;
+		entry->second.counters += counters;
+		entry->second.memory.Add(memory_start, memory_end);
 	}
 }
 void OperatorProfiler::Flush(const PhysicalOperator *phys_op, ExpressionExecutor *expression_executor,
@@ -286,6 +306,18 @@ void OperatorProfiler::Flush(const PhysicalOperator *phys_op, ExpressionExecutor
 	operator_timing.name = phys_op->GetName();
 }
 
+void QueryProfiler::AddMemoryStatistics(const PhysicalOperator *op, const OperatorMemoryStatistics &memory) {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	auto entry = tree_map.find(op);
+	if (entry == tree_map.end()) {
+		return;
+	}
+	entry->second->info.memory += memory;
+}
+
 void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	lock_guard<mutex> guard(flush_lock);
 	if (!IsEnabled() || !running) {
@@ -297,6 +329,8 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 
 		entry->second->info.time += node.second.time;
 		entry->second->info.elements += node.second.elements;
+		entry->second->info.counters += node.second.counters;
+		entry->second->info.memory += node.second.memory;
 		if (!IsDetailedEnabled()) {
 			continue;
 		}
@@ -490,6 +524,20 @@ static void ToJSONRecursive(QueryProfiler::TreeNode &node, std::ostream &ss, int
 	ss << string(depth * 3, ' ') << "   \"name\": \"" + JSONSanitize(node.name) + "\",\n";
 	ss << string(depth * 3, ' ') << "   \"timing\":" + to_string(node.info.time) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"cardinality\":" + to_string(node.info.elements) + ",\n";
+	if (node.info.counters.HasValues()) {
+		auto &counters = node.info.counters;
+		ss << string(depth * 3, ' ') << "   \"cycles\":" + to_string(counters.cycles) + ",\n";
+		ss << string(depth * 3, ' ') << "   \"instructions\":" + to_string(counters.instructions) + ",\n";
+		ss << string(depth * 3, ' ') << "   \"cache_misses\":" + to_string(counters.cache_misses) + ",\n";
+		ss << string(depth * 3, ' ') << "   \"branch_misses\":" + to_string(counters.branch_misses) + ",\n";
+	}
+	if (node.info.memory.HasValues()) {
+		auto &memory = node.info.memory;
+		ss << string(depth * 3, ' ') << "   \"peak_memory\":" + to_string(memory.peak_memory) + ",\n";
+		ss << string(depth * 3, ' ') << "   \"allocated_bytes\":" + to_string(memory.allocated_bytes) + ",\n";
+		ss << string(depth * 3, ' ') << "   \"spilled_bytes\":" + to_string(memory.spilled_bytes) + ",\n";
+		ss << string(depth * 3, ' ') << "   \"read_bytes\":" + to_string(memory.read_bytes) + ",\n";
+	}
 	ss << string(depth * 3, ' ') << "   \"extra_info\": \"" + JSONSanitize(node.extra_info) + "\",\n";
 	ss << string(depth * 3, ' ') << "   \"timings\": [";
 	int32_t function_counter = 1;
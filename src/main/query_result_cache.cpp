@@ -0,0 +1,232 @@
+#include "duckdb/main/query_result_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_cache.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/transaction.hpp"
+
+namespace duckdb {
+
+shared_ptr<ColumnDataCollection> QueryResultCache::Get(ClientContext &context, const string &key) {
+	auto &transaction = Transaction::GetTransaction(context);
+	auto catalog_version = Catalog::GetCatalog(context).GetCatalogVersion();
+
+	lock_guard<mutex> glock(lock);
+	auto entry = entries.find(key);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	auto &cache_entry = entry->second;
+	bool valid = cache_entry.catalog_version == catalog_version;
+	bool visible = true;
+	for (auto &table : cache_entry.tables) {
+		auto info = table.first.lock();
+		if (!info || info->last_commit_id != table.second) {
+			// the table was dropped, or its rows were changed after the result was computed
+			valid = false;
+			break;
+		}
+		if (table.second >= transaction.start_time) {
+			// the transaction does not see the last change to the table
+			visible = false;
+		}
+	}
+	if (!valid) {
+		total_size -= cache_entry.size;
+		lru.erase(cache_entry.lru_position);
+		entries.erase(entry);
+		return nullptr;
+	}
+	if (!visible) {
+		return nullptr;
+	}
+	lru.splice(lru.begin(), lru, cache_entry.lru_position);
+	return cache_entry.result;
+}
+
+void QueryResultCache::Put(ClientContext &context, const string &key, const PreparedStatementData &prepared,
+                           transaction_t start_time, ColumnDataCollection &result, idx_t capacity) {
+	if (prepared.catalog_version != Catalog::GetCatalog(context).GetCatalogVersion()) {
+		return;
+	}
+	auto size = result.SizeInBytes();
+	if (size > capacity) {
+		return;
+	}
+	CacheEntry new_entry;
+	new_entry.catalog_version = prepared.catalog_version;
+	for (auto &table : prepared.result_tables) {
+		auto info = table.lock();
+		if (!info) {
+			return;
+		}
+		transaction_t last_commit_id = info->last_commit_id;
+		if (last_commit_id >= start_time) {
+			// the table was changed by a commit the transaction did not see
+			return;
+		}
+		new_entry.tables.emplace_back(table, last_commit_id);
+	}
+	// copy the result into a collection that is owned by the database
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	new_entry.result = make_shared<ColumnDataCollection>(buffer_manager, result.Types());
+	ColumnDataAppendState append_state;
+	new_entry.result->InitializeAppend(append_state);
+	for (auto &chunk : result.Chunks()) {
+		new_entry.result->Append(append_state, chunk);
+	}
+	new_entry.size = new_entry.result->SizeInBytes();
+
+	lock_guard<mutex> glock(lock);
+	auto entry = entries.find(key);
+	if (entry != entries.end()) {
+		// replace the existing entry
+		total_size -= entry->second.size;
+		lru.erase(entry->second.lru_position);
+		entries.erase(entry);
+	}
+	lru.push_front(key);
+	new_entry.lru_position = lru.begin();
+	total_size += new_entry.size;
+	entries[key] = move(new_entry);
+	EvictInternal(capacity);
+}
+
+void QueryResultCache::Evict(idx_t capacity) {
+	lock_guard<mutex> glock(lock);
+	EvictInternal(capacity);
+}
+
+void QueryResultCache::EvictInternal(idx_t capacity) {
+	while (total_size > capacity) {
+		auto entry = entries.find(lru.back());
+		D_ASSERT(entry != entries.end());
+		total_size -= entry->second.size;
+		entries.erase(entry);
+		lru.pop_back();
+	}
+}
+
+idx_t QueryResultCache::Count() {
+	lock_guard<mutex> glock(lock);
+	return entries.size();
+}
+
+idx_t QueryResultCache::SizeInBytes() {
+	lock_guard<mutex> glock(lock);
+	return total_size;
+}
+
+string QueryResultCache::GetCacheKey(ClientContext &context, const string &query, const vector<Value> &parameters) {
+	auto &transaction = Transaction::GetTransaction(context);
+	if (transaction.ChangesMade() || transaction.catalog_version != Catalog::GetCatalog(context).GetCatalogVersion()) {
+		// the transaction does not see the committed state of the database
+		return string();
+	}
+	auto result = PreparedStatementCache::GetCacheKey(context, query);
+	if (result.empty()) {
+		return result;
+	}
+	// the settings that affect the result of a query
+	auto &config = DBConfig::GetConfig(context);
+	result += "\n" + to_string(uint8_t(config.options.default_order_type));
+	result += "," + to_string(uint8_t(config.options.default_null_order));
+	map<string, string> variables;
+	for (auto &entry : config.options.set_variables) {
+		variables[entry.first] = entry.second.ToSQLString();
+	}
+	for (auto &entry : ClientConfig::GetConfig(context).set_variables) {
+		variables[entry.first] = entry.second.ToSQLString();
+	}
+	for (auto &entry : variables) {
+		result += "\n" + entry.first + "=" + entry.second;
+	}
+	for (auto &parameter : parameters) {
+		result += "\n" + parameter.type().ToString() + ":" + parameter.ToSQLString();
+	}
+	return result;
+}
+
+static bool IsCacheableExpression(const Expression &expr) {
+	if (expr.expression_class == ExpressionClass::BOUND_FUNCTION) {
+		auto &function = (const BoundFunctionExpression &)expr;
+		if (function.function.side_effects == FunctionSideEffects::HAS_SIDE_EFFECTS) {
+			// e.g. random() or now()
+			return false;
+		}
+		auto &name = function.function.name;
+		if (name == "txid_current" || name == "current_setting") {
+			// the result depends on the transaction or the settings
+			return false;
+		}
+	}
+	bool cacheable = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		if (cacheable && !IsCacheableExpression(child)) {
+			cacheable = false;
+		}
+	});
+	return cacheable;
+}
+
+static bool IsCacheableOperator(LogicalOperator &op, vector<weak_ptr<DataTableInfo>> &tables) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = (LogicalGet &)op;
+		auto table = TableScanFunction::GetTableEntry(get.function, get.bind_data.get());
+		if (!table) {
+			// other table functions can read files or the state of the system
+			return false;
+		}
+		tables.push_back(table->storage->info);
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+		return false;
+	default:
+		break;
+	}
+	bool cacheable = true;
+	LogicalOperatorVisitor::EnumerateExpressions(op, [&](unique_ptr<Expression> *expr) {
+		if (cacheable && !IsCacheableExpression(**expr)) {
+			cacheable = false;
+		}
+	});
+	if (!cacheable) {
+		return false;
+	}
+	for (auto &child : op.children) {
+		if (!IsCacheableOperator(*child, tables)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void QueryResultCache::AnalyzePlan(LogicalOperator &plan, PreparedStatementData &result) {
+	vector<weak_ptr<DataTableInfo>> tables;
+	result.result_cacheable = IsCacheableOperator(plan, tables);
+	if (result.result_cacheable) {
+		result.result_tables = move(tables);
+	}
+}
+
+QueryResultCache &QueryResultCache::Get(ClientContext &context) {
+	return context.db->GetQueryResultCache();
+}
+
+} // namespace duckdb
@@ -5,11 +5,16 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_cache.hpp"
+#include "duckdb/main/query_result_cache.hpp"
+#include "duckdb/main/query_history.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/object_cache.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
 namespace duckdb {
@@ -45,6 +50,73 @@ Value AccessModeSetting::GetSetting(ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Allocator Huge Pages
+//===--------------------------------------------------------------------===//
+void AllocatorHugePagesSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.allocator_huge_pages = input.GetValue<bool>();
+	if (db) {
+		Allocator::Get(*db).SetHugePages(config.options.allocator_huge_pages);
+	}
+}
+
+Value AllocatorHugePagesSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.allocator_huge_pages);
+}
+
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+Value BackgroundCheckpointSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
+//===--------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===--------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "lru") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	} else if (parameter == "2q") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::TWO_QUEUE;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option BUFFER_EVICTION_POLICY \"%s\". Expected LRU or 2Q.", parameter);
+	}
+}
+
+Value BufferEvictionPolicySetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.buffer_eviction_policy) {
+	case BufferEvictionPolicy::LRU:
+		return "lru";
+	case BufferEvictionPolicy::TWO_QUEUE:
+		return "2q";
+	default:
+		throw InternalException("Unknown buffer eviction policy setting");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Checkpoint Bloom Filters
+//===--------------------------------------------------------------------===//
+void CheckpointBloomFiltersSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	// only takes effect for the row groups that are written by the next checkpoint
+	config.options.checkpoint_bloom_filters = input.GetValue<bool>();
+}
+
+Value CheckpointBloomFiltersSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.checkpoint_bloom_filters);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -58,6 +130,18 @@ Value CheckpointThresholdSetting::GetSetting(ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Compress Temporary Files
+//===--------------------------------------------------------------------===//
+void CompressTemporaryFilesSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.compress_temporary_files = input.GetValue<bool>();
+}
+
+Value CompressTemporaryFilesSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.compress_temporary_files);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -92,6 +176,17 @@ Value DebugForceExternal::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).force_external);
 }
 
+//===--------------------------------------------------------------------===//
+// Debug Force Partitioned Join Build
+//===--------------------------------------------------------------------===//
+void DebugForcePartitionedJoinBuild::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).force_partitioned_join_build = input.GetValue<bool>();
+}
+
+Value DebugForcePartitionedJoinBuild::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).force_partitioned_join_build);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Force NoCrossProduct
 //===--------------------------------------------------------------------===//
@@ -484,6 +579,36 @@ Value MaximumMemorySetting::GetSetting(ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.maximum_memory));
 }
 
+//===--------------------------------------------------------------------===//
+// Maximum Query Threads
+//===--------------------------------------------------------------------===//
+void MaximumQueryThreadsSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto threads = input.GetValue<int64_t>();
+	if (threads < 0) {
+		throw InvalidInputException("max_query_threads must be at least 0 (0 = no limit)");
+	}
+	ClientConfig::GetConfig(context).max_query_threads = threads;
+}
+
+Value MaximumQueryThreadsSetting::GetSetting(ClientContext &context) {
+	return Value::BIGINT(ClientConfig::GetConfig(context).max_query_threads);
+}
+
+//===--------------------------------------------------------------------===//
+// Object Cache Size
+//===--------------------------------------------------------------------===//
+void ObjectCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.object_cache_size = DBConfig::ParseMemoryLimit(input.ToString());
+	if (db) {
+		db->GetObjectCache().SetMaxMemory(config.options.object_cache_size);
+	}
+}
+
+Value ObjectCacheSizeSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.object_cache_size));
+}
+
 //===--------------------------------------------------------------------===//
 // Password Setting
 //===--------------------------------------------------------------------===//
@@ -510,6 +635,41 @@ Value PerfectHashThresholdSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).perfect_ht_threshold);
 }
 
+//===--------------------------------------------------------------------===//
+// Pin Threads
+//===--------------------------------------------------------------------===//
+void PinThreadsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto new_value = input.GetValue<bool>();
+	if (config.options.pin_threads == new_value) {
+		return;
+	}
+	config.options.pin_threads = new_value;
+	if (db) {
+		// the background threads are pinned when they are launched
+		TaskScheduler::GetScheduler(*db).RelaunchThreads();
+	}
+}
+
+Value PinThreadsSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.pin_threads);
+}
+
+//===--------------------------------------------------------------------===//
+// Prepared Statement Cache Size
+//===--------------------------------------------------------------------===//
+void PreparedStatementCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.prepared_statement_cache_size = input.GetValue<uint64_t>();
+	if (db) {
+		db->GetPreparedStatementCache().Evict(config.options.prepared_statement_cache_size);
+	}
+}
+
+Value PreparedStatementCacheSizeSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.prepared_statement_cache_size);
+}
+
 //===--------------------------------------------------------------------===//
 // PreserveIdentifierCase
 //===--------------------------------------------------------------------===//
@@ -563,6 +723,17 @@ Value ProfileOutputSetting::GetSetting(ClientContext &context) {
 	return Value(config.profiler_save_location);
 }
 
+//===--------------------------------------------------------------------===//
+// Profiling Counters
+//===--------------------------------------------------------------------===//
+void ProfilingCountersSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_profiling_counters = input.GetValue<bool>();
+}
+
+Value ProfilingCountersSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_profiling_counters);
+}
+
 //===--------------------------------------------------------------------===//
 // Profiling Mode
 //===--------------------------------------------------------------------===//
@@ -602,6 +773,78 @@ Value ProgressBarTimeSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).query_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+Value QueryMemoryLimitSetting::GetSetting(ClientContext &context) {
+	auto limit = ClientConfig::GetConfig(context).query_memory_limit;
+	if (limit == DConstants::INVALID_INDEX) {
+		return Value();
+	}
+	return Value(StringUtil::BytesToHumanReadableString(limit));
+}
+
+//===--------------------------------------------------------------------===//
+// Query Result Cache Size
+//===--------------------------------------------------------------------===//
+void QueryResultCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.query_result_cache_size = DBConfig::ParseMemoryLimit(input.ToString());
+	if (db) {
+		db->GetQueryResultCache().Evict(config.options.query_result_cache_size);
+	}
+}
+
+Value QueryResultCacheSizeSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.query_result_cache_size));
+}
+
+//===--------------------------------------------------------------------===//
+// Query History Size
+//===--------------------------------------------------------------------===//
+void QueryHistorySizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.query_history_size = input.GetValue<uint64_t>();
+	if (db) {
+		db->GetQueryHistory().Evict(config.options.query_history_size);
+	}
+}
+
+Value QueryHistorySizeSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.query_history_size);
+}
+
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	auto &config = ClientConfig::GetConfig(context);
+	if (parameter == "normal") {
+		config.query_priority = TaskPriority::NORMAL;
+	} else if (parameter == "low") {
+		config.query_priority = TaskPriority::LOW;
+	} else {
+		throw InvalidInputException("Unrecognized parameter for option QUERY_PRIORITY \"%s\". Expected NORMAL or LOW.",
+		                            parameter);
+	}
+}
+
+Value QueryPrioritySetting::GetSetting(ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).query_priority) {
+	case TaskPriority::NORMAL:
+		return "normal";
+	case TaskPriority::LOW:
+		return "low";
+	default:
+		throw InternalException("Unknown query priority");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -629,6 +872,32 @@ Value SearchPathSetting::GetSetting(ClientContext &context) {
 	return Value(StringUtil::Join(client_data.catalog_search_path->GetSetPaths(), ","));
 }
 
+//===--------------------------------------------------------------------===//
+// Streaming Buffer Size
+//===--------------------------------------------------------------------===//
+void StreamingBufferSizeSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto buffer_size = DBConfig::ParseMemoryLimit(input.ToString());
+	// "none" disables the buffer, i.e. the result is produced in the fetching thread again
+	ClientConfig::GetConfig(context).streaming_buffer_size =
+	    buffer_size == DConstants::INVALID_INDEX ? 0 : buffer_size;
+}
+
+Value StreamingBufferSizeSetting::GetSetting(ClientContext &context) {
+	return Value(StringUtil::BytesToHumanReadableString(ClientConfig::GetConfig(context).streaming_buffer_size));
+}
+
+//===--------------------------------------------------------------------===//
+// Synchronous Commit
+//===--------------------------------------------------------------------===//
+void SynchronousCommitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.synchronous_commit = input.GetValue<bool>();
+}
+
+Value SynchronousCommitSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.synchronous_commit);
+}
+
 //===--------------------------------------------------------------------===//
 // Temp Directory
 //===--------------------------------------------------------------------===//
@@ -661,6 +930,30 @@ Value ThreadsSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(config.options.maximum_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// Trace Output
+//===--------------------------------------------------------------------===//
+void TraceOutputSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).trace_save_location = input.ToString();
+}
+
+Value TraceOutputSetting::GetSetting(ClientContext &context) {
+	return Value(ClientConfig::GetConfig(context).trace_save_location);
+}
+
+//===--------------------------------------------------------------------===//
+// Use Mmap
+//===--------------------------------------------------------------------===//
+void UseMmapSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	// only takes effect when a database file is opened
+	config.options.use_mmap = input.GetValue<bool>();
+}
+
+Value UseMmapSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.use_mmap);
+}
+
 //===--------------------------------------------------------------------===//
 // Username Setting
 //===--------------------------------------------------------------------===//
@@ -672,4 +965,16 @@ Value UsernameSetting::GetSetting(ClientContext &context) {
 	return Value();
 }
 
+//===--------------------------------------------------------------------===//
+// Verify Checksums Once
+//===--------------------------------------------------------------------===//
+void VerifyChecksumsOnceSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.verify_checksums_once = input.GetValue<bool>();
+}
+
+Value VerifyChecksumsOnceSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.verify_checksums_once);
+}
+
 } // namespace duckdb
@@ -67,7 +67,7 @@ unique_ptr<MaterializedQueryResult> StreamQueryResult::Materialize() {
 	if (HasError() || !context) {
 		return make_unique<MaterializedQueryResult>(GetErrorObject());
 	}
-	auto collection = make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), types);
+	auto collection = ColumnDataCollection::CreateMaterializedCollection(*context, types);
 
 	ColumnDataAppendState append_state;
 	collection->InitializeAppend(append_state);
@@ -8,6 +8,8 @@
 #include "duckdb/storage/statistics/numeric_statistics.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 
+#include <cmath>
+
 namespace duckdb {
 
 static TableCatalogEntry *GetCatalogTableEntry(LogicalOperator *op) {
@@ -155,7 +157,8 @@ void CardinalityEstimator::InitTotalDomains() {
 }
 
 double CardinalityEstimator::ComputeCost(JoinNode *left, JoinNode *right, double expected_cardinality) {
-	return expected_cardinality + left->GetCost() + right->GetCost();
+	// the right side is the build side of the hash join: it is materialized into the hash table
+	return expected_cardinality + left->GetCost() + right->GetCost() + right->GetCardinality<double>();
 }
 
 double CardinalityEstimator::EstimateCrossProduct(const JoinNode *left, const JoinNode *right) {
@@ -471,15 +474,33 @@ TableFilterSet *CardinalityEstimator::GetTableFilters(LogicalOperator *op) {
 }
 
 idx_t CardinalityEstimator::InspectConjunctionAND(idx_t cardinality, idx_t column_index, ConjunctionAndFilter *filter,
-                                                  unique_ptr<BaseStatistics> base_stats) {
+                                                  unique_ptr<BaseStatistics> base_stats, DataTable *table,
+                                                  bool &has_range_estimate) {
 	auto has_equality_filter = false;
 	auto cardinality_after_filters = cardinality;
+	// the range [lower, upper] that the range filters restrict the column to (NULL is unbounded)
+	Value lower, upper;
 	for (auto &child_filter : filter->child_filters) {
 		if (child_filter->filter_type != TableFilterType::CONSTANT_COMPARISON) {
 			continue;
 		}
 		auto comparison_filter = (ConstantFilter &)*child_filter;
-		if (comparison_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+		switch (comparison_filter.comparison_type) {
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			if (lower.IsNull() || comparison_filter.constant > lower) {
+				lower = comparison_filter.constant;
+			}
+			continue;
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			if (upper.IsNull() || comparison_filter.constant < upper) {
+				upper = comparison_filter.constant;
+			}
+			continue;
+		case ExpressionType::COMPARE_EQUAL:
+			break;
+		default:
 			continue;
 		}
 		auto column_count = 0;
@@ -498,6 +519,14 @@ idx_t CardinalityEstimator::InspectConjunctionAND(idx_t cardinality, idx_t colum
 		}
 		has_equality_filter = true;
 	}
+	if (table && (!lower.IsNull() || !upper.IsNull())) {
+		auto selectivity = table->EstimateRangeSelectivity(column_index, lower, upper);
+		if (selectivity >= 0) {
+			auto range_card = MaxValue<idx_t>(ceil(cardinality * selectivity), 1);
+			cardinality_after_filters = MinValue(cardinality_after_filters, range_card);
+			has_range_estimate = true;
+		}
+	}
 	return cardinality_after_filters;
 }
 
@@ -532,16 +561,19 @@ idx_t CardinalityEstimator::InspectTableFilters(idx_t cardinality, LogicalOperat
 	idx_t cardinality_after_filters = cardinality;
 	auto get = GetLogicalGet(op);
 	unique_ptr<BaseStatistics> column_statistics;
+	DataTable *table = nullptr;
+	bool has_range_estimate = false;
 	for (auto &it : table_filters->filters) {
 		column_statistics = nullptr;
 		if (get->bind_data && get->function.name.compare("seq_scan") == 0) {
 			auto &table_scan_bind_data = (TableScanBindData &)*get->bind_data;
 			column_statistics = get->function.statistics(context, &table_scan_bind_data, it.first);
+			table = table_scan_bind_data.table->storage.get();
 		}
 		if (it.second->filter_type == TableFilterType::CONJUNCTION_AND) {
 			auto &filter = (ConjunctionAndFilter &)*it.second;
-			idx_t cardinality_with_and_filter =
-			    InspectConjunctionAND(cardinality, it.first, &filter, move(column_statistics));
+			idx_t cardinality_with_and_filter = InspectConjunctionAND(cardinality, it.first, &filter,
+			                                                          move(column_statistics), table, has_range_estimate);
 			cardinality_after_filters = MinValue(cardinality_after_filters, cardinality_with_and_filter);
 		} else if (it.second->filter_type == TableFilterType::CONJUNCTION_OR) {
 			auto &filter = (ConjunctionOrFilter &)*it.second;
@@ -550,10 +582,10 @@ idx_t CardinalityEstimator::InspectTableFilters(idx_t cardinality, LogicalOperat
 			cardinality_after_filters = MinValue(cardinality_after_filters, cardinality_with_or_filter);
 		}
 	}
-	// if the above code didn't find an equality filter (i.e country_code = "[us]")
-	// and there are other table filters, use default selectivity.
+	// if the above code didn't find an equality filter (i.e country_code = "[us]") or a range filter that could be
+	// estimated from the row group statistics, and there are other table filters, use default selectivity.
 	bool has_equality_filter = (cardinality_after_filters != cardinality);
-	if (!has_equality_filter && !table_filters->filters.empty()) {
+	if (!has_equality_filter && !has_range_estimate && !table_filters->filters.empty()) {
 		cardinality_after_filters = MaxValue<idx_t>(cardinality * DEFAULT_SELECTIVITY, 1);
 	}
 	return cardinality_after_filters;
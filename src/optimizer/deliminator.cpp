@@ -4,6 +4,7 @@
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
 #include "duckdb/planner/operator/logical_delim_get.hpp"
 #include "duckdb/planner/operator/logical_delim_join.hpp"
@@ -47,6 +48,11 @@ static bool IsEqualityJoinCondition(JoinCondition &cond) {
 	}
 }
 
+//! Whether a filter or window between a projection/aggregate and a join with a DelimGet can be skipped
+static bool OperatorCanBeSkipped(LogicalOperator &op) {
+	return op.type == LogicalOperatorType::LOGICAL_FILTER || op.type == LogicalOperatorType::LOGICAL_WINDOW;
+}
+
 static bool InequalityDelimJoinCanBeEliminated(JoinType &join_type) {
 	switch (join_type) {
 	case JoinType::ANTI:
@@ -131,11 +137,15 @@ void Deliminator::FindCandidates(unique_ptr<LogicalOperator> *op_ptr,
 	    op->type != LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
 		return;
 	}
-	// followed by a join
-	if (op->children[0]->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+	// followed by a join, possibly below filters and windows (e.g. the ROW_NUMBER() filter of a correlated LIMIT)
+	auto child = op->children[0].get();
+	while (OperatorCanBeSkipped(*child)) {
+		child = child->children[0].get();
+	}
+	if (child->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
 		return;
 	}
-	auto &join = *op->children[0];
+	auto &join = *child;
 	// with a DelimGet as a direct child (left or right)
 	if (join.children[0]->type == LogicalOperatorType::LOGICAL_DELIM_GET ||
 	    join.children[1]->type == LogicalOperatorType::LOGICAL_DELIM_GET) {
@@ -177,10 +187,75 @@ static bool ChildJoinTypeCanBeDeliminated(JoinType &join_type) {
 	}
 }
 
+//! Filters operate on single rows, so they are not affected by removing the join with the DelimGet. Windows are only
+//! unaffected if they are partitioned by the duplicate-eliminated columns, which holds for the windows that are created
+//! when flattening a correlated subquery
+static bool SkippedOperatorsCanBeDeliminated(const vector<LogicalOperator *> &skipped_ops,
+                                             const vector<Expression *> &delim_exprs) {
+	for (auto op : skipped_ops) {
+		if (op->type != LogicalOperatorType::LOGICAL_WINDOW) {
+			continue;
+		}
+		for (auto &expr : op->expressions) {
+			auto &window = (BoundWindowExpression &)*expr;
+			for (auto delim_expr : delim_exprs) {
+				bool found = false;
+				for (auto &partition : window.partitions) {
+					if (partition->Equals(delim_expr)) {
+						found = true;
+						break;
+					}
+				}
+				if (!found) {
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+//! Updates the projection map of a skipped filter after the DelimGet columns were removed from its input
+static void UpdateProjectionMap(LogicalFilter &filter, const vector<ColumnBinding> &old_bindings,
+                                const column_binding_map_t<ColumnBinding> &delim_replacements) {
+	auto child_bindings = filter.children[0]->GetColumnBindings();
+	vector<idx_t> projection_map;
+	auto add_binding = [&](const ColumnBinding &binding) {
+		for (idx_t i = 0; i < child_bindings.size(); i++) {
+			if (child_bindings[i] == binding) {
+				if (std::find(projection_map.begin(), projection_map.end(), i) == projection_map.end()) {
+					projection_map.push_back(i);
+				}
+				return true;
+			}
+		}
+		return false;
+	};
+	for (auto &binding : old_bindings) {
+		if (add_binding(binding)) {
+			continue;
+		}
+		// a removed DelimGet column: its references are replaced by the column it was joined with
+		auto entry = delim_replacements.find(binding);
+		D_ASSERT(entry != delim_replacements.end());
+		if (!add_binding(entry->second)) {
+			throw InternalException("Error in Deliminator: replacement column is not in the input of the filter");
+		}
+	}
+	filter.projection_map = move(projection_map);
+}
+
 bool Deliminator::RemoveCandidate(unique_ptr<LogicalOperator> *plan, unique_ptr<LogicalOperator> *candidate,
                                   DeliminatorPlanUpdater &updater) {
 	auto &proj_or_agg = **candidate;
-	auto &join = (LogicalComparisonJoin &)*proj_or_agg.children[0];
+	// skip over the filters and windows between the projection/aggregate and the join
+	vector<LogicalOperator *> skipped_ops;
+	auto join_ptr = &proj_or_agg.children[0];
+	while (OperatorCanBeSkipped(**join_ptr)) {
+		skipped_ops.push_back(join_ptr->get());
+		join_ptr = &(*join_ptr)->children[0];
+	}
+	auto &join = (LogicalComparisonJoin &)**join_ptr;
 	if (!ChildJoinTypeCanBeDeliminated(join.join_type)) {
 		return false;
 	}
@@ -201,6 +276,8 @@ bool Deliminator::RemoveCandidate(unique_ptr<LogicalOperator> *plan, unique_ptr<
 	// check if joining with the DelimGet is redundant, and collect relevant column information
 	bool all_equality_conditions = true;
 	vector<Expression *> nulls_are_not_equal_exprs;
+	vector<Expression *> delim_exprs;
+	column_binding_map_t<ColumnBinding> delim_replacements;
 	for (auto &cond : join.conditions) {
 		all_equality_conditions = all_equality_conditions && IsEqualityJoinCondition(cond);
 		auto delim_side = delim_idx == 0 ? cond.left.get() : cond.right.get();
@@ -211,11 +288,25 @@ bool Deliminator::RemoveCandidate(unique_ptr<LogicalOperator> *plan, unique_ptr<
 			return false;
 		}
 		updater.expr_map[delim_side] = other_side;
+		delim_exprs.push_back(delim_side);
+		if (!skipped_ops.empty()) {
+			if (other_side->type != ExpressionType::BOUND_COLUMN_REF) {
+				// the skipped operators have to be able to reference the replacement of the DelimGet column
+				return false;
+			}
+			delim_replacements[((BoundColumnRefExpression *)delim_side)->binding] =
+			    ((BoundColumnRefExpression *)other_side)->binding;
+		}
 		if (cond.comparison != ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
 			nulls_are_not_equal_exprs.push_back(other_side);
 		}
 	}
 
+	if (!skipped_ops.empty() &&
+	    (!all_equality_conditions || !SkippedOperatorsCanBeDeliminated(skipped_ops, delim_exprs))) {
+		return false;
+	}
+
 	// removed DelimGet columns are assigned a new ColumnBinding by Projection/Aggregation, keep track here
 	if (proj_or_agg.type == LogicalOperatorType::LOGICAL_PROJECTION) {
 		for (auto &cb : proj_or_agg.GetColumnBindings()) {
@@ -280,10 +371,26 @@ bool Deliminator::RemoveCandidate(unique_ptr<LogicalOperator> *plan, unique_ptr<
 		filter_op->children.push_back(move(join.children[1 - delim_idx]));
 		join.children[1 - delim_idx] = move(filter_op);
 	}
+	// the columns of the skipped operators change when the join is removed
+	vector<vector<ColumnBinding>> skipped_bindings;
+	for (auto op : skipped_ops) {
+		skipped_bindings.push_back(op->GetColumnBindings());
+	}
 	// temporarily save deleted operator so its expressions are still available
-	updater.temp_ptr = move(proj_or_agg.children[0]);
+	updater.temp_ptr = move(*join_ptr);
 	// replace the redundant join
-	proj_or_agg.children[0] = move(join.children[1 - delim_idx]);
+	*join_ptr = move(join.children[1 - delim_idx]);
+	// update the projection maps of the skipped filters, bottom-up
+	for (idx_t i = skipped_ops.size(); i > 0; i--) {
+		auto op = skipped_ops[i - 1];
+		if (op->type != LogicalOperatorType::LOGICAL_FILTER) {
+			continue;
+		}
+		auto &skipped_filter = (LogicalFilter &)*op;
+		if (!skipped_filter.projection_map.empty()) {
+			UpdateProjectionMap(skipped_filter, skipped_bindings[i - 1], delim_replacements);
+		}
+	}
 	return true;
 }
 
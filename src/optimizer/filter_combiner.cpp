@@ -9,6 +9,7 @@
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/operator/logical_empty_result.hpp"
 #include "duckdb/planner/operator/logical_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -103,6 +104,7 @@ FilterResult FilterCombiner::AddFilter(unique_ptr<Expression> expr) {
 void FilterCombiner::GenerateFilters(const std::function<void(unique_ptr<Expression> filter)> &callback) {
 	// first loop over the remaining filters
 	for (auto &filter : remaining_filters) {
+		TransferInFilter(*filter, callback);
 		callback(move(filter));
 	}
 	remaining_filters.clear();
@@ -166,6 +168,36 @@ void FilterCombiner::GenerateFilters(const std::function<void(unique_ptr<Express
 	equivalence_map.clear();
 }
 
+void FilterCombiner::TransferInFilter(Expression &filter,
+                                      const std::function<void(unique_ptr<Expression> filter)> &callback) {
+	if (filter.type != ExpressionType::COMPARE_IN) {
+		return;
+	}
+	auto &in_expr = (BoundOperatorExpression &)filter;
+	for (idx_t i = 1; i < in_expr.children.size(); i++) {
+		if (in_expr.children[i]->type != ExpressionType::VALUE_CONSTANT) {
+			return;
+		}
+	}
+	auto &input = *in_expr.children[0];
+	auto entry = stored_expressions.find(&input);
+	if (entry == stored_expressions.end()) {
+		return;
+	}
+	auto set_entry = equivalence_set_map.find(entry->second.get());
+	if (set_entry == equivalence_set_map.end()) {
+		return;
+	}
+	for (auto &equivalent : equivalence_map[set_entry->second]) {
+		if (equivalent == entry->second.get() || equivalent->return_type != input.return_type) {
+			continue;
+		}
+		auto copy = in_expr.Copy();
+		((BoundOperatorExpression &)*copy).children[0] = equivalent->Copy();
+		callback(move(copy));
+	}
+}
+
 bool FilterCombiner::HasFilters() {
 	bool has_filters = false;
 	GenerateFilters([&](unique_ptr<Expression> child) { has_filters = true; });
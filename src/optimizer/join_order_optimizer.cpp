@@ -665,12 +665,110 @@ void JoinOrderOptimizer::SolveJoinOrderApproximately() {
 	}
 }
 
+bool JoinOrderOptimizer::LinearizeJoinOrder(vector<idx_t> &order) {
+	// greedily build a left-deep join order: start with the smallest relation, then keep adding the connected relation
+	// that results in the smallest intermediate result
+	order.clear();
+	idx_t start = 0;
+	for (idx_t i = 1; i < relations.size(); i++) {
+		auto &current = plans[set_manager.GetJoinRelation(i)];
+		if (current->GetCardinality<double>() < plans[set_manager.GetJoinRelation(start)]->GetCardinality<double>()) {
+			start = i;
+		}
+	}
+	order.push_back(start);
+	auto prefix = set_manager.GetJoinRelation(start);
+	vector<bool> added(relations.size(), false);
+	added[start] = true;
+	while (order.size() < relations.size()) {
+		idx_t best = DConstants::INVALID_INDEX;
+		double best_cardinality = 0;
+		for (idx_t i = 0; i < relations.size(); i++) {
+			if (added[i]) {
+				continue;
+			}
+			auto relation = set_manager.GetJoinRelation(i);
+			if (query_graph.GetConnections(prefix, relation).empty()) {
+				continue;
+			}
+			auto cardinality = cardinality_estimator.EstimateCardinalityWithSet(set_manager.Union(prefix, relation));
+			if (best == DConstants::INVALID_INDEX || cardinality < best_cardinality) {
+				best = i;
+				best_cardinality = cardinality;
+			}
+		}
+		if (best == DConstants::INVALID_INDEX) {
+			// the remaining relations are not connected to the prefix
+			return false;
+		}
+		order.push_back(best);
+		added[best] = true;
+		prefix = set_manager.Union(prefix, set_manager.GetJoinRelation(best));
+	}
+	return true;
+}
+
+bool JoinOrderOptimizer::SolveJoinOrderLinearized() {
+	vector<idx_t> order;
+	if (!LinearizeJoinOrder(order)) {
+		return false;
+	}
+	// the plans of the aborted exact enumeration might be referenced by each other: replacing one of them would leave
+	// dangling children, so we start from the base relations only
+	for (auto it = plans.begin(); it != plans.end();) {
+		if (it->first->count > 1) {
+			it = plans.erase(it);
+		} else {
+			it++;
+		}
+	}
+	full_plan_found = false;
+	must_update_full_plan = false;
+	join_nodes_in_full_plan.clear();
+
+	// now run the dynamic programming over all intervals of the linear order, i.e. only consider joining [i, k] with
+	// [k + 1, j]. This is O(n^3) instead of exponential, and still allows bushy plans within the order
+	auto count = order.size();
+	vector<vector<JoinRelationSet *>> intervals(count, vector<JoinRelationSet *>(count, nullptr));
+	for (idx_t i = 0; i < count; i++) {
+		intervals[i][i] = set_manager.GetJoinRelation(order[i]);
+		for (idx_t j = i + 1; j < count; j++) {
+			intervals[i][j] = set_manager.Union(intervals[i][j - 1], set_manager.GetJoinRelation(order[j]));
+		}
+	}
+	for (idx_t length = 2; length <= count; length++) {
+		for (idx_t i = 0; i + length <= count; i++) {
+			auto j = i + length - 1;
+			for (idx_t k = i; k < j; k++) {
+				auto left = intervals[i][k];
+				auto right = intervals[k + 1][j];
+				if (plans.find(left) == plans.end() || plans.find(right) == plans.end()) {
+					// one of the sides is not connected
+					continue;
+				}
+				auto connections = query_graph.GetConnections(left, right);
+				if (!connections.empty()) {
+					EmitPair(left, right, connections);
+				}
+			}
+		}
+	}
+	// every prefix of the order is connected, so there is always a (left-deep) plan for the full set
+	D_ASSERT(plans.find(intervals[0][count - 1]) != plans.end());
+	return true;
+}
+
 void JoinOrderOptimizer::SolveJoinOrder() {
 	// first try to solve the join order exactly
-	if (!SolveJoinOrderExactly()) {
-		// otherwise, if that times out we resort to a greedy algorithm
-		SolveJoinOrderApproximately();
+	if (SolveJoinOrderExactly()) {
+		return;
+	}
+	// if that times out we run the dynamic programming over a linearized join order, as long as that is feasible
+	if (relations.size() <= LINEARIZED_DP_THRESHOLD && SolveJoinOrderLinearized()) {
+		return;
 	}
+	// otherwise we resort to a greedy algorithm
+	SolveJoinOrderApproximately();
 }
 
 void JoinOrderOptimizer::GenerateCrossProducts() {
@@ -1,4 +1,5 @@
 #include "duckdb/optimizer/filter_pushdown.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 
@@ -75,6 +76,27 @@ unique_ptr<LogicalOperator> FilterPushdown::PushdownMarkJoin(unique_ptr<LogicalO
 			}
 		}
 	}
+	if (join.join_type == JoinType::SEMI && op->type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		// the filters on the left side also hold for the right side of the equality conditions, i.e. for
+		// [X IN (SELECT Y ...) AND X > 5] we can push [Y > 5] into the RHS
+		// this is not possible for the mark join: removing rows from the RHS can change its NULL markers
+		FilterCombiner filter_combiner(optimizer);
+		for (auto &cond : comp_join.conditions) {
+			if (cond.comparison == ExpressionType::COMPARE_EQUAL) {
+				filter_combiner.AddFilter(
+				    make_unique<BoundComparisonExpression>(cond.comparison, cond.left->Copy(), cond.right->Copy()));
+			}
+		}
+		for (auto &filter : left_pushdown.filters) {
+			filter_combiner.AddFilter(filter->filter->Copy());
+		}
+		filter_combiner.GenerateFilters([&](unique_ptr<Expression> filter) {
+			if (JoinSide::GetJoinSide(*filter, left_bindings, right_bindings) == JoinSide::RIGHT) {
+				right_pushdown.AddFilter(move(filter));
+			}
+		});
+		right_pushdown.GenerateFilters();
+	}
 	op->children[0] = left_pushdown.Rewrite(move(op->children[0]));
 	op->children[1] = right_pushdown.Rewrite(move(op->children[1]));
 	return FinishPushdown(move(op));
@@ -277,6 +277,12 @@ void RemoveUnusedColumns::VisitOperator(LogicalOperator &op) {
 				get.column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
 			}
 		}
+		// table in-out functions consume every column of their input, but unused columns can still be removed from
+		// the subquery that computes the input
+		for (auto &child : op.children) {
+			RemoveUnusedColumns remove(binder, context, true);
+			remove.VisitOperator(*child);
+		}
 		return;
 	case LogicalOperatorType::LOGICAL_DISTINCT: {
 		// distinct, all projected columns are used for the DISTINCT computation
@@ -7,6 +7,14 @@
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/statistics/numeric_statistics.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
 
@@ -116,4 +124,140 @@ void StatisticsPropagator::PropagateAndCompress(unique_ptr<Expression> &expr, un
 	}
 }
 
+static bool CanCompress(const Expression &expr, BaseStatistics *stats) {
+	if (!stats || !expr.return_type.IsIntegral()) {
+		return false;
+	}
+	auto &num_stats = (NumericStatistics &)*stats;
+	return !num_stats.min.IsNull() && !num_stats.max.IsNull();
+}
+
+static bool IsIndexedTableScan(LogicalOperator &op) {
+	if (op.type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = (LogicalGet &)op;
+	auto bind_data = dynamic_cast<TableScanBindData *>(get.bind_data.get());
+	return bind_data && !bind_data->table->storage->info->indexes.Empty();
+}
+
+void StatisticsPropagator::CompressJoinConditions(LogicalComparisonJoin &join) {
+	if (join.type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return;
+	}
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::LEFT:
+	case JoinType::RIGHT:
+	case JoinType::OUTER:
+	case JoinType::SEMI:
+	case JoinType::ANTI:
+		break;
+	default:
+		return;
+	}
+	if (IsIndexedTableScan(*join.children[0]) || IsIndexedTableScan(*join.children[1])) {
+		// the keys of an index join have to be plain column references
+		return;
+	}
+	bool compressed = false;
+	for (auto &condition : join.conditions) {
+		if (condition.comparison != ExpressionType::COMPARE_EQUAL ||
+		    condition.left->return_type != condition.right->return_type) {
+			continue;
+		}
+		auto stats_left = PropagateExpression(condition.left);
+		auto stats_right = PropagateExpression(condition.right);
+		if (!CanCompress(*condition.left, stats_left.get()) || !CanCompress(*condition.right, stats_right.get())) {
+			continue;
+		}
+		// both sides are mapped to the range of their combined statistics, so equal keys stay equal
+		stats_left->Merge(*stats_right);
+		auto &num_stats = (NumericStatistics &)*stats_left;
+		auto original_type = condition.left->return_type;
+		condition.left = CastToSmallestType(move(condition.left), num_stats);
+		condition.right = CastToSmallestType(move(condition.right), num_stats);
+		compressed = compressed || condition.left->return_type != original_type;
+	}
+	if (!compressed) {
+		return;
+	}
+	// the statistics of the join keys are used to plan perfect hash joins: recompute them for the compressed keys
+	join.join_stats.clear();
+	for (auto &condition : join.conditions) {
+		auto stats_left = PropagateExpression(condition.left);
+		auto stats_right = PropagateExpression(condition.right);
+		if (stats_left && stats_right) {
+			join.join_stats.push_back(move(stats_left));
+			join.join_stats.push_back(move(stats_right));
+		}
+	}
+}
+
+struct CompressedGroup {
+	LogicalType type;
+	Value min;
+};
+
+static void DecompressGroups(unique_ptr<Expression> &expr, column_binding_map_t<CompressedGroup> &compressed_groups,
+                             const LogicalAggregate &aggr) {
+	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = (BoundColumnRefExpression &)*expr;
+		auto entry = compressed_groups.find(colref.binding);
+		if (entry == compressed_groups.end()) {
+			return;
+		}
+		// the compressed group is the offset from the minimum: add it back and cast to the original type
+		auto &group = entry->second;
+		auto compressed_ref = make_unique<BoundColumnRefExpression>(
+		    colref.alias, aggr.groups[colref.binding.column_index]->return_type, colref.binding, colref.depth);
+		vector<unique_ptr<Expression>> arguments;
+		arguments.push_back(BoundCastExpression::AddDefaultCastToType(move(compressed_ref), group.type));
+		arguments.push_back(make_unique<BoundConstantExpression>(group.min));
+		auto decompressed = make_unique<BoundFunctionExpression>(
+		    group.type, AddFun::GetFunction(group.type, group.type), move(arguments), nullptr, true);
+		decompressed->alias = colref.alias;
+		expr = move(decompressed);
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(
+	    *expr, [&](unique_ptr<Expression> &child) { DecompressGroups(child, compressed_groups, aggr); });
+}
+
+void StatisticsPropagator::CompressAggregateGroups(LogicalProjection &proj, LogicalAggregate &aggr) {
+	if (aggr.grouping_sets.size() > 1) {
+		return;
+	}
+	column_binding_map_t<CompressedGroup> compressed_groups;
+	for (idx_t group_idx = 0; group_idx < aggr.groups.size(); group_idx++) {
+		auto &group = aggr.groups[group_idx];
+		auto &stats = aggr.group_stats[group_idx];
+		if (!CanCompress(*group, stats.get())) {
+			continue;
+		}
+		auto &num_stats = (NumericStatistics &)*stats;
+		CompressedGroup compressed_group {group->return_type, num_stats.min};
+		group = CastToSmallestType(move(group), num_stats);
+		if (group->return_type == compressed_group.type) {
+			continue;
+		}
+		// the statistics of the group are used to plan perfect hash aggregates: replace them with the compressed ones
+		ColumnBinding group_binding(aggr.group_index, group_idx);
+		auto compressed_stats = PropagateExpression(group);
+		stats = compressed_stats ? compressed_stats->Copy() : nullptr;
+		if (compressed_stats) {
+			statistics_map[group_binding] = move(compressed_stats);
+		} else {
+			statistics_map.erase(group_binding);
+		}
+		compressed_groups.insert(make_pair(group_binding, move(compressed_group)));
+	}
+	if (compressed_groups.empty()) {
+		return;
+	}
+	for (auto &expr : proj.expressions) {
+		DecompressGroups(expr, compressed_groups, aggr);
+	}
+}
+
 } // namespace duckdb
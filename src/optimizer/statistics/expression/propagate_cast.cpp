@@ -1,3 +1,4 @@
+#include "duckdb/function/cast/default_casts.hpp"
 #include "duckdb/optimizer/statistics_propagator.hpp"
 #include "duckdb/planner/expression/bound_cast_expression.hpp"
 #include "duckdb/storage/statistics/numeric_statistics.hpp"
@@ -25,6 +26,10 @@ static unique_ptr<BaseStatistics> StatisticsNumericCastSwitch(const BaseStatisti
 	case PhysicalType::INT32:
 	case PhysicalType::INT64:
 	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
 	case PhysicalType::FLOAT:
 	case PhysicalType::DOUBLE:
 		return StatisticsOperationsNumericNumericCast(input, target);
@@ -46,6 +51,10 @@ unique_ptr<BaseStatistics> StatisticsPropagator::PropagateExpression(BoundCastEx
 	case PhysicalType::INT32:
 	case PhysicalType::INT64:
 	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
 	case PhysicalType::FLOAT:
 	case PhysicalType::DOUBLE:
 		result_stats = StatisticsNumericCastSwitch(child_stats.get(), cast.return_type);
@@ -53,6 +62,16 @@ unique_ptr<BaseStatistics> StatisticsPropagator::PropagateExpression(BoundCastEx
 	default:
 		return nullptr;
 	}
+	if (result_stats) {
+		auto &num_stats = (NumericStatistics &)*child_stats;
+		if (!num_stats.min.IsNull() && !num_stats.max.IsNull()) {
+			// all values fit in the target type: the cast does not need to check for overflow
+			auto unchecked_cast = DefaultCasts::GetUncheckedIntegerCast(cast.child->return_type, cast.return_type);
+			if (unchecked_cast) {
+				cast.bound_cast = BoundCastInfo(unchecked_cast);
+			}
+		}
+	}
 	if (cast.try_cast && result_stats) {
 		result_stats->validity_stats = make_unique<ValidityStatistics>(true, true);
 	}
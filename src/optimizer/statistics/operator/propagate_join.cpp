@@ -1,15 +1,87 @@
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/types/hugeint.hpp"
 #include "duckdb/optimizer/statistics_propagator.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/operator/logical_any_join.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/planner/operator/logical_cross_product.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_join.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
 #include "duckdb/storage/statistics/validity_statistics.hpp"
 
 namespace duckdb {
 
+//! Pushes the range of the keys on the other side of an equality condition as a filter into the scan of the keys, as
+//! rows outside of that range cannot find a join partner
+static void PushdownKeyRange(LogicalOperator &child, Expression &key, BaseStatistics &key_stats,
+                             BaseStatistics &other_stats) {
+	if (child.type != LogicalOperatorType::LOGICAL_GET || key.type != ExpressionType::BOUND_COLUMN_REF ||
+	    !key.return_type.IsNumeric() || key_stats.type != key.return_type || other_stats.type != key.return_type) {
+		return;
+	}
+	auto &get = (LogicalGet &)child;
+	auto &colref = (BoundColumnRefExpression &)key;
+	if (!get.function.filter_pushdown || colref.binding.table_index != get.table_index) {
+		return;
+	}
+	auto table = get.GetTable();
+	if (table && !table->storage->info->indexes.Empty()) {
+		// a filtered scan cannot be planned as the inner side of an index join
+		return;
+	}
+	auto column_index = colref.binding.column_index;
+	if (!get.projection_ids.empty()) {
+		column_index = get.projection_ids[column_index];
+	}
+	auto column_id = get.column_ids[column_index];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+	auto &key_range = (NumericStatistics &)key_stats;
+	auto &other_range = (NumericStatistics &)other_stats;
+	if (key_range.min.IsNull() || key_range.max.IsNull() || other_range.min.IsNull() || other_range.max.IsNull()) {
+		return;
+	}
+	if (other_range.min > key_range.min) {
+		get.table_filters.PushFilter(
+		    column_id, make_unique<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, other_range.min));
+	}
+	if (other_range.max < key_range.max) {
+		get.table_filters.PushFilter(
+		    column_id, make_unique<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, other_range.max));
+	}
+}
+
+//! Transfers the key ranges of an equality condition between the sides of the join whose rows can be dropped when
+//! they do not find a join partner
+static void PushdownKeyRanges(LogicalComparisonJoin &join, JoinCondition &condition, BaseStatistics &left_stats,
+                              BaseStatistics &right_stats) {
+	if (join.type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN ||
+	    condition.comparison != ExpressionType::COMPARE_EQUAL) {
+		return;
+	}
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+		PushdownKeyRange(*join.children[0], *condition.left, left_stats, right_stats);
+		PushdownKeyRange(*join.children[1], *condition.right, right_stats, left_stats);
+		break;
+	case JoinType::RIGHT:
+		PushdownKeyRange(*join.children[0], *condition.left, left_stats, right_stats);
+		break;
+	case JoinType::LEFT:
+	case JoinType::ANTI:
+		PushdownKeyRange(*join.children[1], *condition.right, right_stats, left_stats);
+		break;
+	default:
+		break;
+	}
+}
+
 void StatisticsPropagator::PropagateStatistics(LogicalComparisonJoin &join, unique_ptr<LogicalOperator> *node_ptr) {
 	for (idx_t i = 0; i < join.conditions.size(); i++) {
 		auto &condition = join.conditions[i];
@@ -23,6 +95,7 @@ void StatisticsPropagator::PropagateStatistics(LogicalComparisonJoin &join, uniq
 				// nothing to do here
 				continue;
 			}
+			PushdownKeyRanges(join, condition, *stats_left, *stats_right);
 			auto prune_result = PropagateComparison(*stats_left, *stats_right, condition.comparison);
 			// Add stats to logical_join for perfect hash join
 			join.join_stats.push_back(move(stats_left));
@@ -140,6 +213,7 @@ void StatisticsPropagator::PropagateStatistics(LogicalComparisonJoin &join, uniq
 			break;
 		}
 	}
+	CompressJoinConditions(join);
 }
 
 void StatisticsPropagator::PropagateStatistics(LogicalAnyJoin &join, unique_ptr<LogicalOperator> *node_ptr) {
@@ -1,4 +1,5 @@
 #include "duckdb/optimizer/statistics_propagator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
 #include "duckdb/planner/operator/logical_projection.hpp"
 
 namespace duckdb {
@@ -11,6 +12,10 @@ unique_ptr<NodeStatistics> StatisticsPropagator::PropagateStatistics(LogicalProj
 		ReplaceWithEmptyResult(*node_ptr);
 		return move(node_stats);
 	}
+	if (proj.children[0]->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		// the groups of the aggregate are only visible to this projection, so they can be compressed
+		CompressAggregateGroups(proj, (LogicalAggregate &)*proj.children[0]);
+	}
 
 	// then propagate to each of the expressions
 	for (idx_t i = 0; i < proj.expressions.size(); i++) {
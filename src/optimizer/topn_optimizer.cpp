@@ -3,9 +3,183 @@
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 #include "duckdb/common/limits.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+#include "duckdb/transaction/transaction.hpp"
 
 namespace duckdb {
 
+void TopN::PushdownOrderedIndexScan(LogicalTopN &topn) {
+	if (topn.orders.size() != 1 || topn.limit < 0 || topn.offset < 0 ||
+	    topn.limit + topn.offset > (int64_t)STANDARD_VECTOR_SIZE) {
+		return;
+	}
+	auto &order = topn.orders[0];
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF) {
+		return;
+	}
+	auto binding = ((BoundColumnRefExpression &)*order.expression).binding;
+	auto child = topn.children[0].get();
+	if (child->type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		// look through a projection that passes the order column through
+		auto &projection = (LogicalProjection &)*child;
+		if (binding.table_index != projection.table_index) {
+			return;
+		}
+		auto &expr = projection.expressions[binding.column_index];
+		if (expr->type != ExpressionType::BOUND_COLUMN_REF) {
+			return;
+		}
+		binding = ((BoundColumnRefExpression &)*expr).binding;
+		child = projection.children[0].get();
+	}
+	if (child->type != LogicalOperatorType::LOGICAL_GET) {
+		return;
+	}
+	auto &get = (LogicalGet &)*child;
+	if (get.table_index != binding.table_index || !get.bind_data ||
+	    TableScanFunction::GetTableEntry(get.function, get.bind_data.get()) == nullptr) {
+		return;
+	}
+	TableScanFunction::TryOrderedIndexScan(context, get, binding.column_index, order.type, order.null_order,
+	                                       topn.limit + topn.offset);
+}
+
+//! Collects the columns of the given table that are referenced by the expression, returns false if it references
+//! columns of other tables
+static bool CollectColumns(Expression &expr, idx_t table_index, unordered_set<idx_t> &columns) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = (BoundColumnRefExpression &)expr;
+		if (colref.depth > 0 || colref.binding.table_index != table_index) {
+			return false;
+		}
+		columns.insert(colref.binding.column_index);
+		return true;
+	}
+	bool result = true;
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](Expression &child) { result = CollectColumns(child, table_index, columns) && result; });
+	return result;
+}
+
+//! Replaces the references to the projection with its expressions, and the references to the scan below it with
+//! references to the scan of the keys
+static void ReplaceColumns(unique_ptr<Expression> &expr, LogicalProjection &projection, idx_t get_index,
+                           idx_t keys_index, unordered_map<idx_t, idx_t> &key_map) {
+	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = (BoundColumnRefExpression &)*expr;
+		if (colref.binding.table_index == projection.table_index) {
+			expr = projection.expressions[colref.binding.column_index]->Copy();
+			ReplaceColumns(expr, projection, get_index, keys_index, key_map);
+		} else if (colref.binding.table_index == get_index) {
+			colref.binding = ColumnBinding(keys_index, key_map[colref.binding.column_index]);
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
+		ReplaceColumns(child, projection, get_index, keys_index, key_map);
+	});
+}
+
+unique_ptr<LogicalOperator> TopN::LateMaterialization(unique_ptr<LogicalOperator> op) {
+	auto &topn = (LogicalTopN &)*op;
+	if (topn.limit < 0 || topn.offset < 0 || topn.limit + topn.offset > (int64_t)STANDARD_VECTOR_SIZE ||
+	    topn.children[0]->type != LogicalOperatorType::LOGICAL_PROJECTION) {
+		return op;
+	}
+	auto &projection = (LogicalProjection &)*topn.children[0];
+	if (projection.children[0]->type != LogicalOperatorType::LOGICAL_GET) {
+		return op;
+	}
+	auto &get = (LogicalGet &)*projection.children[0];
+	auto table = get.GetTable();
+	if (!table || !get.projection_ids.empty() || ((TableScanBindData &)*get.bind_data).is_index_scan) {
+		return op;
+	}
+	if (LocalStorage::Get(Transaction::GetTransaction(context)).Find(table->storage.get())) {
+		// transaction local rows cannot be fetched by their row id
+		return op;
+	}
+	// the rows are fetched one by one: only do this if the table is much larger than the amount of rows fetched
+	auto row_count = idx_t(topn.limit + topn.offset);
+	if (get.EstimateCardinality(context) <= 100 * MaxValue<idx_t>(row_count, 1)) {
+		return op;
+	}
+	// find the columns of the scan that the orders need
+	unordered_set<idx_t> order_columns;
+	for (auto &order : topn.orders) {
+		if (!CollectColumns(*order.expression, projection.table_index, order_columns)) {
+			return op;
+		}
+	}
+	unordered_set<idx_t> key_columns;
+	for (auto &column_idx : order_columns) {
+		auto &expr = *projection.expressions[column_idx];
+		// the expressions of the orders are evaluated twice: once for sorting, and once for the result
+		if (expr.HasSideEffects() || !CollectColumns(expr, get.table_index, key_columns)) {
+			return op;
+		}
+	}
+	// the keys are scanned together with the columns that are filtered on and the row id
+	vector<column_t> key_column_ids;
+	unordered_map<idx_t, idx_t> key_map;
+	for (idx_t column_idx = 0; column_idx < get.column_ids.size(); column_idx++) {
+		auto column_id = get.column_ids[column_idx];
+		if (key_columns.find(column_idx) != key_columns.end() ||
+		    get.table_filters.filters.find(column_id) != get.table_filters.filters.end()) {
+			key_map[column_idx] = key_column_ids.size();
+			key_column_ids.push_back(column_id);
+		}
+	}
+	if (key_column_ids.size() == get.column_ids.size()) {
+		// all columns are needed for sorting
+		return op;
+	}
+	auto keys_get = make_unique<LogicalGet>(binder.GenerateTableIndex(), get.function, get.bind_data->Copy(),
+	                                        get.returned_types, get.names);
+	keys_get->column_ids = move(key_column_ids);
+	keys_get->column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	keys_get->table_filters = move(get.table_filters);
+	get.table_filters.filters.clear();
+	keys_get->parameters = get.parameters;
+	keys_get->named_parameters = get.named_parameters;
+	for (auto &order : topn.orders) {
+		ReplaceColumns(order.expression, projection, get.table_index, keys_get->table_index, key_map);
+	}
+
+	// the other columns are fetched by joining the sorted rows with the table on their row id
+	idx_t row_id_idx = get.column_ids.size();
+	for (idx_t column_idx = 0; column_idx < get.column_ids.size(); column_idx++) {
+		if (get.column_ids[column_idx] == COLUMN_IDENTIFIER_ROW_ID) {
+			row_id_idx = column_idx;
+		}
+	}
+	if (row_id_idx == get.column_ids.size()) {
+		get.column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	}
+	JoinCondition condition;
+	condition.left = make_unique<BoundColumnRefExpression>(
+	    LogicalType::ROW_TYPE, ColumnBinding(keys_get->table_index, keys_get->column_ids.size() - 1));
+	condition.right =
+	    make_unique<BoundColumnRefExpression>(LogicalType::ROW_TYPE, ColumnBinding(get.table_index, row_id_idx));
+	condition.comparison = ExpressionType::COMPARE_EQUAL;
+
+	auto projection_ptr = move(topn.children[0]);
+	auto join = make_unique<LogicalComparisonJoin>(JoinType::INNER);
+	join->conditions.push_back(move(condition));
+	topn.children[0] = move(keys_get);
+	join->children.push_back(move(op));
+	join->children.push_back(move(projection.children[0]));
+	projection.children[0] = move(join);
+	return projection_ptr;
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (op->type == LogicalOperatorType::LOGICAL_LIMIT &&
 	    op->children[0]->type == LogicalOperatorType::LOGICAL_ORDER_BY) {
@@ -17,7 +191,8 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		if (limit.limit_val != NumericLimits<int64_t>::Maximum() || limit.offset) {
 			auto topn = make_unique<LogicalTopN>(move(order_by.orders), limit.limit_val, limit.offset_val);
 			topn->AddChild(move(order_by.children[0]));
-			op = move(topn);
+			PushdownOrderedIndexScan(*topn);
+			op = LateMaterialization(move(topn));
 		}
 	} else {
 		for (auto &child : op->children) {
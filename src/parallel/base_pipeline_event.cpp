@@ -10,4 +10,9 @@ BasePipelineEvent::BasePipelineEvent(Pipeline &pipeline_p)
     : Event(pipeline_p.executor), pipeline(pipeline_p.shared_from_this()) {
 }
 
+idx_t BasePipelineEvent::EstimatedCost() const {
+	auto source = pipeline->GetSource();
+	return source ? source->estimated_cardinality : 0;
+}
+
 } // namespace duckdb
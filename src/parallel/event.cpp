@@ -8,7 +8,14 @@ namespace duckdb {
 
 Event::Event(Executor &executor_p)
     : executor(executor_p), finished_tasks(0), total_tasks(0), finished_dependencies(0), total_dependencies(0),
-      finished(false) {
+      finished(false), trace_start(0) {
+}
+
+void Event::TraceSchedule() {
+	auto trace = executor.GetTrace();
+	if (trace) {
+		trace_start = trace->Now();
+	}
 }
 
 void Event::CompleteDependency() {
@@ -17,6 +24,7 @@ void Event::CompleteDependency() {
 	if (current_finished == total_dependencies) {
 		// all dependencies have been completed: schedule the event
 		D_ASSERT(total_tasks == 0);
+		TraceSchedule();
 		Schedule();
 		if (total_tasks == 0) {
 			Finish();
@@ -28,6 +36,10 @@ void Event::Finish() {
 	D_ASSERT(!finished);
 	FinishEvent();
 	finished = true;
+	auto trace = executor.GetTrace();
+	if (trace) {
+		trace->AddEvent(GetName(), "event", trace_start, trace->Now());
+	}
 	// finished processing the pipeline, now we can schedule pipelines that depend on this pipeline
 	for (auto &parent_entry : parents) {
 		auto parent = parent_entry.lock();
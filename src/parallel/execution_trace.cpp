@@ -0,0 +1,74 @@
+#include "duckdb/parallel/execution_trace.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/fstream.hpp"
+#include "duckdb/common/to_string.hpp"
+
+#include <cstring>
+#include <sstream>
+
+namespace duckdb {
+
+ExecutionTrace::ExecutionTrace() : trace_start(std::chrono::steady_clock::now()) {
+}
+
+uint64_t ExecutionTrace::Now() const {
+	auto elapsed = std::chrono::steady_clock::now() - trace_start;
+	return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+void ExecutionTrace::AddEvent(string name, const char *category, uint64_t start, uint64_t end) {
+	lock_guard<mutex> guard(lock);
+	auto entry = threads.find(std::this_thread::get_id());
+	if (entry == threads.end()) {
+		entry = threads.insert(make_pair(std::this_thread::get_id(), threads.size())).first;
+	}
+	TraceEvent event;
+	event.name = move(name);
+	event.category = category;
+	event.thread = entry->second;
+	event.start = start;
+	event.duration = end > start ? end - start : 0;
+	events.push_back(move(event));
+}
+
+static string TraceSanitize(const string &text) {
+	string result;
+	for (auto c : text) {
+		if (c == '"' || c == '\\') {
+			result += '\\';
+		}
+		result += c;
+	}
+	return result;
+}
+
+string ExecutionTrace::ToJSON() {
+	lock_guard<mutex> guard(lock);
+	std::stringstream ss;
+	ss << "{\"traceEvents\": [\n";
+	// name the threads in the order in which they started working on the query
+	for (idx_t thread = 0; thread < threads.size(); thread++) {
+		ss << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread
+		   << ", \"args\": {\"name\": \"Thread " << thread << "\"}},\n";
+	}
+	for (idx_t i = 0; i < events.size(); i++) {
+		auto &event = events[i];
+		ss << "{\"name\": \"" << TraceSanitize(event.name) << "\", \"cat\": \"" << event.category
+		   << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << event.thread << ", \"ts\": " << event.start
+		   << ", \"dur\": " << event.duration << "}" << (i + 1 < events.size() ? ",\n" : "\n");
+	}
+	ss << "],\n\"displayTimeUnit\": \"ms\"}\n";
+	return ss.str();
+}
+
+void ExecutionTrace::WriteToFile(const string &path) {
+	ofstream out(path);
+	out << ToJSON();
+	out.close();
+	// throw an IO exception if it fails to write the file
+	if (out.fail()) {
+		throw IOException(strerror(errno));
+	}
+}
+
+} // namespace duckdb
@@ -1,7 +1,7 @@
 #include "duckdb/execution/executor.hpp"
 
 #include "duckdb/execution/execution_context.hpp"
-#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/helper/physical_buffered_collector.hpp"
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -19,7 +19,7 @@
 
 namespace duckdb {
 
-Executor::Executor(ClientContext &context) : context(context) {
+Executor::Executor(ClientContext &context) : context(context), rows_scanned(0), cpu_time(0) {
 }
 
 Executor::~Executor() {
@@ -164,11 +164,21 @@ void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 	VerifyScheduledEvents(event_data);
 
 	// schedule the pipelines that do not have dependencies
+	// the tasks of a query are executed in the order in which they are scheduled: we schedule the most expensive
+	// pipelines first, so that the cheap ones fill up the threads that become idle at the end of the expensive ones,
+	// instead of an expensive pipeline running last with few other pipelines to overlap with
+	vector<Event *> root_events;
 	for (auto &event : events) {
 		if (!event->HasDependencies()) {
-			event->Schedule();
+			root_events.push_back(event.get());
 		}
 	}
+	std::stable_sort(root_events.begin(), root_events.end(),
+	                 [](Event *a, Event *b) { return a->EstimatedCost() > b->EstimatedCost(); });
+	for (auto &event : root_events) {
+		event->TraceSchedule();
+		event->Schedule();
+	}
 }
 
 void Executor::ScheduleEvents(const vector<shared_ptr<MetaPipeline>> &meta_pipelines) {
@@ -298,7 +308,11 @@ void Executor::InitializeInternal(PhysicalOperator *plan) {
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(physical_plan);
-		this->producer = scheduler.CreateProducer();
+		this->producer = scheduler.CreateProducer(ClientConfig::GetConfig(context).query_priority);
+		if (!ClientConfig::GetConfig(context).trace_save_location.empty()) {
+			trace = make_unique<ExecutionTrace>();
+			trace_wait_start = DConstants::INVALID_INDEX;
+		}
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -335,6 +349,13 @@ void Executor::InitializeInternal(PhysicalOperator *plan) {
 
 void Executor::CancelTasks() {
 	task.reset();
+	if (physical_plan && HasStreamingResultCollector()) {
+		// wake up the threads that are blocked on a full result buffer
+		auto &collector = (PhysicalBufferedCollector &)*physical_plan;
+		if (collector.sink_state) {
+			collector.Cancel(*collector.sink_state);
+		}
+	}
 	// we do this by creating weak pointers to all pipelines
 	// then clearing our references to the pipelines
 	// and waiting until all pipelines have been destroyed
@@ -386,6 +407,15 @@ PendingExecutionResult Executor::ExecuteTask() {
 		// there are! if we don't already have a task, fetch one
 		if (!task) {
 			scheduler.GetTaskFromProducer(*producer, task);
+			if (trace) {
+				// record how long this thread waits for the tasks of other threads to finish
+				if (!task && trace_wait_start == DConstants::INVALID_INDEX) {
+					trace_wait_start = trace->Now();
+				} else if (task && trace_wait_start != DConstants::INVALID_INDEX) {
+					trace->AddEvent("Wait", "wait", trace_wait_start, trace->Now());
+					trace_wait_start = DConstants::INVALID_INDEX;
+				}
+			}
 		}
 		if (task) {
 			// if we have a task, partially process it
@@ -417,6 +447,13 @@ PendingExecutionResult Executor::ExecuteTask() {
 		execution_result = PendingExecutionResult::EXECUTION_ERROR;
 		ThrowException();
 	} // LCOV_EXCL_STOP
+	if (trace) {
+		if (trace_wait_start != DConstants::INVALID_INDEX) {
+			trace->AddEvent("Wait", "wait", trace_wait_start, trace->Now());
+		}
+		// the trace is kept until the executor is reset, as other threads can still be finishing their tasks
+		trace->WriteToFile(ClientConfig::GetConfig(context).trace_save_location);
+	}
 	execution_result = PendingExecutionResult::RESULT_READY;
 	return execution_result;
 }
@@ -434,6 +471,9 @@ void Executor::Reset() {
 	exceptions.clear();
 	pipelines.clear();
 	events.clear();
+	trace.reset();
+	rows_scanned = 0;
+	cpu_time = 0;
 	execution_result = PendingExecutionResult::RESULT_NOT_READY;
 }
 
@@ -486,28 +526,26 @@ void Executor::Flush(ThreadContext &tcontext) {
 	profiler->Flush(tcontext.profiler);
 }
 
-bool Executor::GetPipelinesProgress(double &current_progress) { // LCOV_EXCL_START
-	lock_guard<mutex> elock(executor_lock);
-
-	vector<double> progress;
-	vector<idx_t> cardinality;
-	idx_t total_cardinality = 0;
+double Executor::GetPipelinesProgress(idx_t &rows_processed, idx_t &total_rows) { // LCOV_EXCL_START
+	// the pipelines are only (re)initialized by the thread that executes the query, which is the thread calling this
+	// method: we do not need to hold the executor lock here, the progress of the pipelines is tracked in atomics
+	rows_processed = 0;
+	total_rows = 0;
+	double weighted_progress = 0;
 	for (auto &pipeline : pipelines) {
-		double child_percentage;
-		idx_t child_cardinality;
-
-		if (!pipeline->GetProgress(child_percentage, child_cardinality)) {
-			return false;
-		}
-		progress.push_back(child_percentage);
-		cardinality.push_back(child_cardinality);
-		total_cardinality += child_cardinality;
+		double pipeline_progress;
+		idx_t pipeline_rows;
+		idx_t pipeline_total;
+		pipeline->GetProgress(pipeline_progress, pipeline_rows, pipeline_total);
+		// every pipeline is weighted by the amount of rows it (is estimated to) process
+		weighted_progress += pipeline_progress * double(pipeline_total);
+		rows_processed += pipeline_rows;
+		total_rows += pipeline_total;
 	}
-	current_progress = 0;
-	for (size_t i = 0; i < progress.size(); i++) {
-		current_progress += progress[i] * double(cardinality[i]) / double(total_cardinality);
+	if (total_rows == 0) {
+		return 0;
 	}
-	return true;
+	return weighted_progress / double(total_rows);
 } // LCOV_EXCL_STOP
 
 bool Executor::HasResultCollector() {
@@ -521,8 +559,26 @@ unique_ptr<QueryResult> Executor::GetResult() {
 	return result_collector.GetResult(*result_collector.sink_state);
 }
 
+bool Executor::HasStreamingResultCollector() {
+	return HasResultCollector() && ((PhysicalResultCollector &)*physical_plan).IsStreaming();
+}
+
 unique_ptr<DataChunk> Executor::FetchChunk() {
 	D_ASSERT(physical_plan);
+	if (HasStreamingResultCollector()) {
+		auto &collector = (PhysicalBufferedCollector &)*physical_plan;
+		while (true) {
+			auto chunk = collector.FetchChunk(*collector.sink_state);
+			if (chunk) {
+				return chunk;
+			}
+			// no chunk can be handed out yet: help executing the query
+			if (ExecuteTask() != PendingExecutionResult::RESULT_NOT_READY) {
+				chunk = collector.FetchChunk(*collector.sink_state);
+				return chunk ? move(chunk) : make_unique<DataChunk>();
+			}
+		}
+	}
 
 	auto chunk = make_unique<DataChunk>();
 	root_executor->InitializeChunk(*chunk);
@@ -1,6 +1,8 @@
 #include "duckdb/parallel/task.hpp"
 #include "duckdb/execution/executor.hpp"
 
+#include <time.h>
+
 namespace duckdb {
 
 ExecutorTask::ExecutorTask(Executor &executor_p) : executor(executor_p) {
@@ -12,9 +14,25 @@ ExecutorTask::ExecutorTask(ClientContext &context) : ExecutorTask(Executor::Get(
 ExecutorTask::~ExecutorTask() {
 }
 
+//! Returns the CPU time of the calling thread in nanoseconds, or 0 if it is not available
+static uint64_t ThreadCPUTime() {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+	struct timespec time;
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) == 0) {
+		return uint64_t(time.tv_sec) * 1000000000 + uint64_t(time.tv_nsec);
+	}
+#endif
+	return 0;
+}
+
 TaskExecutionResult ExecutorTask::Execute(TaskExecutionMode mode) {
+	auto trace = executor.GetTrace();
+	TraceSpan span(trace, trace ? GetName() : string(), "task");
+	auto cpu_start = ThreadCPUTime();
 	try {
-		return ExecuteTask(mode);
+		auto result = ExecuteTask(mode);
+		executor.cpu_time += ThreadCPUTime() - cpu_start;
+		return result;
 	} catch (Exception &ex) {
 		executor.PushError(PreservedError(ex));
 	} catch (std::exception &ex) {
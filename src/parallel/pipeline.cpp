@@ -9,6 +9,7 @@
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/query_profiler.hpp"
 #include "duckdb/parallel/pipeline_event.hpp"
 #include "duckdb/parallel/pipeline_executor.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -29,6 +30,10 @@ public:
 	unique_ptr<PipelineExecutor> pipeline_executor;
 
 public:
+	string GetName() const override {
+		return "Pipeline " + pipeline.GetName();
+	}
+
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
 		if (!pipeline_executor) {
 			pipeline_executor = make_unique<PipelineExecutor>(pipeline.GetClientContext(), pipeline);
@@ -48,23 +53,35 @@ public:
 };
 
 Pipeline::Pipeline(Executor &executor_p)
-    : executor(executor_p), ready(false), initialized(false), source(nullptr), sink(nullptr) {
+    : executor(executor_p), ready(false), initialized(false), finished(false), source_rows(0), source(nullptr),
+      sink(nullptr) {
 }
 
 ClientContext &Pipeline::GetClientContext() {
 	return executor.context;
 }
 
-bool Pipeline::GetProgress(double &current_percentage, idx_t &source_cardinality) {
+void Pipeline::GetProgress(double &current_percentage, idx_t &rows_processed, idx_t &total_rows) {
 	D_ASSERT(source);
-	source_cardinality = source->estimated_cardinality;
+	rows_processed = source_rows;
+	// the estimate is corrected when the source turns out to produce more rows
+	total_rows = MaxValue<idx_t>(source->estimated_cardinality, rows_processed);
+	if (finished) {
+		current_percentage = 100;
+		total_rows = rows_processed;
+		return;
+	}
 	if (!initialized) {
 		current_percentage = 0;
-		return true;
+		return;
+	}
+	current_percentage = source_state ? source->GetProgress(executor.context, *source_state) : -1;
+	if (current_percentage < 0) {
+		// the source cannot report its progress: estimate it from the amount of rows it has produced so far
+		current_percentage = total_rows == 0 ? 0 : 100.0 * double(rows_processed) / double(total_rows);
 	}
-	auto &client = executor.context;
-	current_percentage = source->GetProgress(client, *source_state);
-	return current_percentage >= 0;
+	// the pipeline is only complete once all of its tasks have finished
+	current_percentage = MinValue<double>(current_percentage, 99);
 }
 
 void Pipeline::ScheduleSequentialTask(shared_ptr<Event> &event) {
@@ -132,6 +149,11 @@ bool Pipeline::LaunchScanTasks(shared_ptr<Event> &event, idx_t max_threads) {
 	if (max_threads > active_threads) {
 		max_threads = active_threads;
 	}
+	// the connection can limit the number of threads its queries run on, leaving the others to other connections
+	auto max_query_threads = ClientConfig::GetConfig(executor.context).max_query_threads;
+	if (max_query_threads > 0 && max_threads > max_query_threads) {
+		max_threads = max_query_threads;
+	}
 	if (max_threads <= 1) {
 		// too small to parallelize
 		return false;
@@ -191,8 +213,23 @@ void Pipeline::Finalize(Event &event) {
 	}
 	D_ASSERT(ready);
 	try {
+		// attribute the memory used while finalizing to the sink
+		auto &profiler = QueryProfiler::Get(executor.context);
+		MemoryStatistics memory_start;
+		if (profiler.IsEnabled()) {
+			auto &thread_memory = MemoryStatistics::Get();
+			thread_memory.ResetPeak();
+			memory_start = thread_memory;
+		}
+
 		auto sink_state = sink->Finalize(*this, event, executor.context, *sink->sink_state);
 		sink->sink_state->state = sink_state;
+
+		if (profiler.IsEnabled()) {
+			OperatorMemoryStatistics memory;
+			memory.Add(memory_start, MemoryStatistics::Get());
+			profiler.AddMemoryStatistics(sink, memory);
+		}
 	} catch (Exception &ex) { // LCOV_EXCL_START
 		executor.PushError(PreservedError(ex));
 	} catch (std::exception &ex) {
@@ -213,6 +250,11 @@ string Pipeline::ToString() const {
 	return renderer.ToString(*this);
 }
 
+string Pipeline::GetName() const {
+	string result = source ? source->GetName() : "?";
+	return result + " -> " + (sink ? sink->GetName() : "RESULT");
+}
+
 void Pipeline::Print() const {
 	Printer::Print(ToString());
 }
@@ -22,6 +22,7 @@ void PipelineEvent::Schedule() {
 }
 
 void PipelineEvent::FinishEvent() {
+	pipeline->finished = true;
 }
 
 } // namespace duckdb
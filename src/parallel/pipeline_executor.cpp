@@ -7,11 +7,12 @@ namespace duckdb {
 PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_p)
     : pipeline(pipeline_p), thread(context_p), context(context_p, thread, &pipeline_p) {
 	D_ASSERT(pipeline.source_state);
-	local_source_state = pipeline.source->GetLocalSourceState(context, *pipeline.source_state);
+	// the local sink state is created before the local source state, which might already claim the first batch
 	if (pipeline.sink) {
 		local_sink_state = pipeline.sink->GetLocalSinkState(context);
 		requires_batch_index = pipeline.sink->RequiresBatchIndex() && pipeline.source->SupportsBatchIndex();
 	}
+	local_source_state = pipeline.source->GetLocalSourceState(context, *pipeline.source_state);
 
 	intermediate_chunks.reserve(pipeline.operators.size());
 	intermediate_states.reserve(pipeline.operators.size());
@@ -33,6 +34,81 @@ PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_
 		}
 	}
 	InitializeChunk(final_chunk);
+	chunk_size = ComputeChunkSize();
+	if (chunk_size < STANDARD_VECTOR_SIZE) {
+		slice_chunk.InitializeEmpty(pipeline.source->GetTypes());
+	}
+}
+
+//! The approximate size of the cache the intermediate chunks of a pipeline should fit in
+static constexpr const idx_t PIPELINE_CACHE_BUDGET = 512 * 1024;
+//! The minimum amount of rows pushed through a pipeline at once
+static constexpr const idx_t MINIMUM_CHUNK_SIZE = 128;
+
+static idx_t EstimateRowWidth(const vector<LogicalType> &types) {
+	idx_t row_width = 0;
+	for (auto &type : types) {
+		switch (type.InternalType()) {
+		case PhysicalType::STRUCT:
+			for (auto &child_type : StructType::GetChildTypes(type)) {
+				row_width += EstimateRowWidth({child_type.second});
+			}
+			break;
+		default:
+			row_width += GetTypeIdSize(type.InternalType());
+			break;
+		}
+	}
+	return row_width;
+}
+
+idx_t PipelineExecutor::ComputeChunkSize() {
+	if (pipeline.operators.empty()) {
+		// the source chunk is sunk directly: there are no intermediate chunks
+		return STANDARD_VECTOR_SIZE;
+	}
+	// the intermediate chunks of all operators are alive at the same time
+	idx_t row_width = 0;
+	for (auto &chunk : intermediate_chunks) {
+		row_width += EstimateRowWidth(chunk->GetTypes());
+	}
+	row_width += EstimateRowWidth(final_chunk.GetTypes());
+	if (row_width == 0 || row_width * STANDARD_VECTOR_SIZE <= PIPELINE_CACHE_BUDGET) {
+		return STANDARD_VECTOR_SIZE;
+	}
+	// use the largest power of two for which the intermediates fit in the budget
+	idx_t result = STANDARD_VECTOR_SIZE;
+	while (result > MINIMUM_CHUNK_SIZE && result * row_width > PIPELINE_CACHE_BUDGET) {
+		result /= 2;
+	}
+	return MaxValue<idx_t>(result, MINIMUM_CHUNK_SIZE);
+}
+
+OperatorResultType PipelineExecutor::ExecutePushSource(DataChunk &source_chunk) {
+	if (source_chunk.size() <= chunk_size) {
+		return ExecutePushInternal(source_chunk);
+	}
+	// the rows of the source chunk are too wide for their intermediates to fit in the cache:
+	// push the chunk through the operators in slices that reference the source chunk
+	for (idx_t offset = 0; offset < source_chunk.size(); offset += chunk_size) {
+		auto count = MinValue<idx_t>(chunk_size, source_chunk.size() - offset);
+		SelectionVector sel(offset, count);
+		for (idx_t col_idx = 0; col_idx < source_chunk.ColumnCount(); col_idx++) {
+			auto &source = source_chunk.data[col_idx];
+			auto vector_type = source.GetVectorType();
+			if (vector_type == VectorType::FLAT_VECTOR || vector_type == VectorType::CONSTANT_VECTOR) {
+				slice_chunk.data[col_idx].Slice(source, offset, offset + count);
+			} else {
+				slice_chunk.data[col_idx].Slice(source, sel, count);
+			}
+		}
+		slice_chunk.SetCardinality(count);
+		auto result = ExecutePushInternal(slice_chunk);
+		if (result == OperatorResultType::FINISHED) {
+			return result;
+		}
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
 }
 
 bool PipelineExecutor::Execute(idx_t max_chunks) {
@@ -40,7 +116,7 @@ bool PipelineExecutor::Execute(idx_t max_chunks) {
 	bool exhausted_source = false;
 	auto &source_chunk = pipeline.operators.empty() ? final_chunk : *intermediate_chunks[0];
 	for (idx_t i = 0; i < max_chunks; i++) {
-		if (IsFinished()) {
+		if (IsFinished() || TryFinishEarly()) {
 			break;
 		}
 		source_chunk.Reset();
@@ -49,7 +125,11 @@ bool PipelineExecutor::Execute(idx_t max_chunks) {
 			exhausted_source = true;
 			break;
 		}
-		auto result = ExecutePushInternal(source_chunk);
+		if (TryFinishEarly()) {
+			// the sink does not need the rows of the batch we fetched
+			break;
+		}
+		auto result = ExecutePushSource(source_chunk);
 		if (result == OperatorResultType::FINISHED) {
 			D_ASSERT(IsFinished());
 			break;
@@ -79,6 +159,24 @@ bool PipelineExecutor::IsFinished() {
 	return finished_processing_idx >= 0;
 }
 
+bool PipelineExecutor::TryFinishEarly() {
+	D_ASSERT(in_process_operators.empty());
+	// operators like LIMIT signal through their global state when they have seen enough rows in any of the threads
+	for (idx_t i = 0; i < pipeline.operators.size(); i++) {
+		auto op = pipeline.operators[i];
+		if (op->op_state && op->OperatorFinished(*op->op_state)) {
+			FinishProcessing(i + 1);
+			return true;
+		}
+	}
+	auto sink = pipeline.sink;
+	if (sink && local_sink_state && sink->SinkFinished(*sink->sink_state, *local_sink_state)) {
+		FinishProcessing();
+		return true;
+	}
+	return false;
+}
+
 OperatorResultType PipelineExecutor::ExecutePushInternal(DataChunk &input, idx_t initial_idx) {
 	D_ASSERT(pipeline.sink);
 	if (input.size() == 0) { // LCOV_EXCL_START
@@ -198,7 +296,9 @@ void PipelineExecutor::PushFinalize() {
 
 	D_ASSERT(local_sink_state);
 	// run the combine for the sink
+	StartOperator(pipeline.sink);
 	pipeline.sink->Combine(context, *pipeline.sink->sink_state, *local_sink_state);
+	EndOperator(pipeline.sink, nullptr);
 
 	// flush all query profiler info
 	for (idx_t i = 0; i < intermediate_states.size(); i++) {
@@ -358,6 +458,7 @@ OperatorResultType PipelineExecutor::Execute(DataChunk &input, DataChunk &result
 void PipelineExecutor::FetchFromSource(DataChunk &result) {
 	StartOperator(pipeline.source);
 	pipeline.source->GetData(context, result, *pipeline.source_state, *local_source_state);
+	pipeline.source_rows += result.size();
 	if (result.size() != 0 && requires_batch_index) {
 		auto next_batch_index =
 		    pipeline.source->GetBatchIndex(context, result, *pipeline.source_state, *local_source_state);
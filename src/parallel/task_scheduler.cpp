@@ -8,6 +8,10 @@
 #include "concurrentqueue.h"
 #include "lightweightsemaphore.h"
 #include "duckdb/common/thread.hpp"
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 #else
 #include <queue>
 #endif
@@ -29,6 +33,8 @@ typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
 struct ConcurrentQueue {
 	concurrent_queue_t q;
+	//! The tasks of producers with a low priority
+	concurrent_queue_t low_priority_q;
 	lightweight_semaphore_t semaphore;
 
 	void Enqueue(ProducerToken &token, unique_ptr<Task> task);
@@ -36,15 +42,44 @@ struct ConcurrentQueue {
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	QueueProducerToken(ConcurrentQueue &queue, TaskPriority priority)
+	    : q(priority == TaskPriority::LOW ? queue.low_priority_q : queue.q), queue_token(q) {
 	}
 
+	//! The queue that the tasks of this producer go into
+	concurrent_queue_t &q;
 	duckdb_moodycamel::ProducerToken queue_token;
 };
 
+//! Dequeues tasks for a single thread
+struct QueueConsumerToken {
+	//! Every LOW_PRIORITY_INTERVAL-th task is taken from the low priority tasks first, so that those tasks get a share
+	//! of the threads when the system is busy
+	static constexpr const idx_t LOW_PRIORITY_INTERVAL = 8;
+
+	explicit QueueConsumerToken(ConcurrentQueue &queue)
+	    : queue(queue), token(queue.q), low_priority_token(queue.low_priority_q), dequeue_count(0) {
+	}
+
+	bool Dequeue(unique_ptr<Task> &task) {
+		if (++dequeue_count % LOW_PRIORITY_INTERVAL == 0 && queue.low_priority_q.try_dequeue(low_priority_token, task)) {
+			return true;
+		}
+		return queue.q.try_dequeue(token, task) || queue.low_priority_q.try_dequeue(low_priority_token, task);
+	}
+
+	ConcurrentQueue &queue;
+	//! The consumer tokens make threads start at different producers, and each keeps taking tasks from the same
+	//! producer (i.e. the same pipeline) until that one runs dry or its quota is used up, instead of all threads
+	//! contending for the head of the queue
+	duckdb_moodycamel::ConsumerToken token;
+	duckdb_moodycamel::ConsumerToken low_priority_token;
+	idx_t dequeue_count;
+};
+
 void ConcurrentQueue::Enqueue(ProducerToken &token, unique_ptr<Task> task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, move(task))) {
+	if (token.token->q.enqueue(token.token->queue_token, move(task))) {
 		semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
@@ -53,7 +88,7 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, unique_ptr<Task> task) {
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	return token.token->q.try_dequeue_from_producer(token.token->queue_token, task);
 }
 
 #else
@@ -81,7 +116,7 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, unique_ptr<Task>
 }
 
 struct QueueProducerToken {
-	QueueProducerToken(ConcurrentQueue &queue) {
+	QueueProducerToken(ConcurrentQueue &queue, TaskPriority priority) {
 	}
 };
 #endif
@@ -110,8 +145,8 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_unique<QueueProducerToken>(*queue);
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(TaskPriority priority) {
+	auto token = make_unique<QueueProducerToken>(*queue, priority);
 	return make_unique<ProducerToken>(*this, move(token));
 }
 
@@ -127,11 +162,12 @@ bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, unique_ptr<Task> &
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
 	unique_ptr<Task> task;
+	QueueConsumerToken consumer_token(*queue);
 	// loop until the marker is set to false
 	while (*marker) {
 		// wait for a signal with a timeout
 		queue->semaphore.wait();
-		if (queue->q.try_dequeue(task)) {
+		if (consumer_token.Dequeue(task)) {
 			task->Execute(TaskExecutionMode::PROCESS_ALL);
 			task.reset();
 		}
@@ -144,10 +180,11 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	idx_t completed_tasks = 0;
+	QueueConsumerToken consumer_token(*queue);
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		unique_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!consumer_token.Dequeue(task)) {
 			return completed_tasks;
 		}
 		task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -163,9 +200,10 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	unique_ptr<Task> task;
+	QueueConsumerToken consumer_token(*queue);
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!consumer_token.Dequeue(task)) {
 			return;
 		}
 		try {
@@ -184,6 +222,22 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
 	scheduler->ExecuteForever(marker);
 }
+
+//! Pins a background thread to a single core. The cores are assigned round-robin, skipping core 0, which is left for
+//! the threads of the clients (that also execute tasks).
+static void PinThread(thread &worker_thread, idx_t thread_idx) {
+#if defined(__linux__)
+	auto core_count = thread::hardware_concurrency();
+	if (core_count <= 1) {
+		return;
+	}
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	CPU_SET(1 + thread_idx % (core_count - 1), &cpu_set);
+	// pinning is best-effort: e.g. in a container with a restricted cpuset the call fails and the thread is left as-is
+	pthread_setaffinity_np(worker_thread.native_handle(), sizeof(cpu_set_t), &cpu_set);
+#endif
+}
 #endif
 
 int32_t TaskScheduler::NumberOfThreads() {
@@ -206,6 +260,15 @@ void TaskScheduler::SetThreads(int32_t n) {
 #endif
 }
 
+void TaskScheduler::RelaunchThreads() {
+#ifndef DUCKDB_NO_THREADS
+	lock_guard<mutex> t(thread_lock);
+	auto n = threads.size() + 1;
+	SetThreadsInternal(1);
+	SetThreadsInternal(n);
+#endif
+}
+
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	queue->semaphore.signal(n);
@@ -234,11 +297,15 @@ void TaskScheduler::SetThreadsInternal(int32_t n) {
 	}
 	if (threads.size() < new_thread_count) {
 		// we are increasing the number of threads: launch them and run tasks on them
+		auto pin_threads = DBConfig::GetConfig(db).options.pin_threads;
 		idx_t create_new_threads = new_thread_count - threads.size();
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
 			auto worker_thread = make_unique<thread>(ThreadExecuteTasks, this, marker.get());
+			if (pin_threads) {
+				PinThread(*worker_thread, threads.size());
+			}
 			auto thread_wrapper = make_unique<SchedulerThread>(move(worker_thread));
 
 			threads.push_back(move(thread_wrapper));
@@ -24,12 +24,10 @@ string SetOperationNode::ToString() const {
 		result += is_distinct ? "UNION BY NAME" : "UNION ALL BY NAME";
 		break;
 	case SetOperationType::EXCEPT:
-		D_ASSERT(is_distinct);
-		result += "EXCEPT";
+		result += is_distinct ? "EXCEPT" : "EXCEPT ALL";
 		break;
 	case SetOperationType::INTERSECT:
-		D_ASSERT(is_distinct);
-		result += "INTERSECT";
+		result += is_distinct ? "INTERSECT" : "INTERSECT ALL";
 		break;
 	default:
 		throw InternalException("Unsupported set operation type");
@@ -49,6 +47,9 @@ bool SetOperationNode::Equals(const QueryNode *other_p) const {
 	if (setop_type != other->setop_type) {
 		return false;
 	}
+	if (setop_all != other->setop_all) {
+		return false;
+	}
 	if (!left->Equals(other->left.get())) {
 		return false;
 	}
@@ -61,6 +62,7 @@ bool SetOperationNode::Equals(const QueryNode *other_p) const {
 unique_ptr<QueryNode> SetOperationNode::Copy() const {
 	auto result = make_unique<SetOperationNode>();
 	result->setop_type = setop_type;
+	result->setop_all = setop_all;
 	result->left = left->Copy();
 	result->right = right->Copy();
 	this->CopyProperties(*result);
@@ -71,6 +73,7 @@ void SetOperationNode::Serialize(FieldWriter &writer) const {
 	writer.WriteField<SetOperationType>(setop_type);
 	writer.WriteSerializable(*left);
 	writer.WriteSerializable(*right);
+	writer.WriteField<bool>(setop_all);
 }
 
 unique_ptr<QueryNode> SetOperationNode::Deserialize(FieldReader &reader) {
@@ -78,6 +81,7 @@ unique_ptr<QueryNode> SetOperationNode::Deserialize(FieldReader &reader) {
 	result->setop_type = reader.ReadRequired<SetOperationType>();
 	result->left = reader.ReadRequiredSerializable<QueryNode>();
 	result->right = reader.ReadRequiredSerializable<QueryNode>();
+	result->setop_all = reader.ReadField<bool>(false);
 	return move(result);
 }
 
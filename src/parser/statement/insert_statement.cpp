@@ -10,7 +10,8 @@ InsertStatement::InsertStatement() : SQLStatement(StatementType::INSERT_STATEMEN
 InsertStatement::InsertStatement(const InsertStatement &other)
     : SQLStatement(other),
       select_statement(unique_ptr_cast<SQLStatement, SelectStatement>(other.select_statement->Copy())),
-      columns(other.columns), table(other.table), schema(other.schema) {
+      columns(other.columns), table(other.table), schema(other.schema), on_conflict_action(other.on_conflict_action),
+      on_conflict_columns(other.on_conflict_columns) {
 	cte_map = other.cte_map.Copy();
 }
 
@@ -40,6 +41,20 @@ string InsertStatement::ToString() const {
 	} else {
 		result += select_statement->ToString();
 	}
+	if (on_conflict_action == OnConflictAction::NOTHING) {
+		result += " ON CONFLICT";
+		if (!on_conflict_columns.empty()) {
+			result += " (";
+			for (idx_t i = 0; i < on_conflict_columns.size(); i++) {
+				if (i > 0) {
+					result += ", ";
+				}
+				result += KeywordHelper::WriteOptionallyQuoted(on_conflict_columns[i]);
+			}
+			result += ")";
+		}
+		result += " DO NOTHING";
+	}
 	if (!returning_list.empty()) {
 		result += " RETURNING ";
 		for (idx_t i = 0; i < returning_list.size(); i++) {
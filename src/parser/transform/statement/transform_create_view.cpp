@@ -1,3 +1,5 @@
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/statement/create_statement.hpp"
 #include "duckdb/parser/transformer.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -45,8 +47,23 @@ unique_ptr<CreateStatement> Transformer::TransformCreateView(duckdb_libpgquery::
 		}
 	}
 
-	if (stmt->options && stmt->options->length > 0) {
-		throw NotImplementedException("VIEW options");
+	if (stmt->options) {
+		duckdb_libpgquery::PGListCell *cell = nullptr;
+		for_each_cell(cell, stmt->options->head) {
+			auto def_elem = reinterpret_cast<duckdb_libpgquery::PGDefElem *>(cell->data.ptr_value);
+			if (StringUtil::Lower(def_elem->defname) != "materialized") {
+				throw NotImplementedException("VIEW option \"%s\"", def_elem->defname);
+			}
+			// WITH (materialized) or WITH (materialized = true/false)
+			info->materialized = true;
+			if (def_elem->arg) {
+				auto value = (duckdb_libpgquery::PGValue *)def_elem->arg;
+				if (value->type != duckdb_libpgquery::T_PGString) {
+					throw ParserException("Expected true or false for the VIEW option \"materialized\"");
+				}
+				info->materialized = TransformValue(*value)->value.DefaultCastAs(LogicalType::BOOLEAN).GetValue<bool>();
+			}
+		}
 	}
 
 	if (stmt->withCheckOption != duckdb_libpgquery::PGViewCheckOption::PG_NO_CHECK_OPTION) {
@@ -22,6 +22,7 @@ unique_ptr<SQLStatement> Transformer::TransformDrop(duckdb_libpgquery::PGNode *n
 		info.type = CatalogType::INDEX_ENTRY;
 		break;
 	case duckdb_libpgquery::PG_OBJECT_VIEW:
+	case duckdb_libpgquery::PG_OBJECT_MATVIEW:
 		info.type = CatalogType::VIEW_ENTRY;
 		break;
 	case duckdb_libpgquery::PG_OBJECT_SEQUENCE:
@@ -25,8 +25,8 @@ unique_ptr<TableRef> Transformer::TransformValuesList(duckdb_libpgquery::PGList
 unique_ptr<InsertStatement> Transformer::TransformInsert(duckdb_libpgquery::PGNode *node) {
 	auto stmt = reinterpret_cast<duckdb_libpgquery::PGInsertStmt *>(node);
 	D_ASSERT(stmt);
-	if (stmt->onConflictClause && stmt->onConflictClause->action != duckdb_libpgquery::PG_ONCONFLICT_NONE) {
-		throw ParserException("ON CONFLICT IGNORE/UPDATE clauses are not supported");
+	if (stmt->onConflictClause && stmt->onConflictClause->action == duckdb_libpgquery::PG_ONCONFLICT_UPDATE) {
+		throw ParserException("ON CONFLICT DO UPDATE clauses are not supported");
 	}
 	if (!stmt->selectStmt) {
 		throw ParserException("DEFAULT VALUES clause is not supported!");
@@ -54,6 +54,23 @@ unique_ptr<InsertStatement> Transformer::TransformInsert(duckdb_libpgquery::PGNo
 	auto qname = TransformQualifiedName(stmt->relation);
 	result->table = qname.name;
 	result->schema = qname.schema;
+
+	if (stmt->onConflictClause && stmt->onConflictClause->action == duckdb_libpgquery::PG_ONCONFLICT_NOTHING) {
+		result->on_conflict_action = OnConflictAction::NOTHING;
+		auto infer = stmt->onConflictClause->infer;
+		if (infer) {
+			if (infer->conname || infer->whereClause) {
+				throw ParserException("ON CONFLICT only supports a list of columns as the conflict target");
+			}
+			for (auto cell = infer->indexElems->head; cell != nullptr; cell = cell->next) {
+				auto index_element = (duckdb_libpgquery::PGIndexElem *)cell->data.ptr_value;
+				if (!index_element->name) {
+					throw ParserException("ON CONFLICT only supports a list of columns as the conflict target");
+				}
+				result->on_conflict_columns.emplace_back(index_element->name);
+			}
+		}
+	}
 	return result;
 }
 
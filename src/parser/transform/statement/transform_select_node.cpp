@@ -91,15 +91,18 @@ unique_ptr<QueryNode> Transformer::TransformSelectNode(duckdb_libpgquery::PGSele
 		}
 
 		bool select_distinct = true;
+		result->setop_all = stmt->all;
 		switch (stmt->op) {
 		case duckdb_libpgquery::PG_SETOP_UNION:
 			select_distinct = !stmt->all;
 			result->setop_type = SetOperationType::UNION;
 			break;
 		case duckdb_libpgquery::PG_SETOP_EXCEPT:
+			select_distinct = !stmt->all;
 			result->setop_type = SetOperationType::EXCEPT;
 			break;
 		case duckdb_libpgquery::PG_SETOP_INTERSECT:
+			select_distinct = !stmt->all;
 			result->setop_type = SetOperationType::INTERSECT;
 			break;
 		case duckdb_libpgquery::PG_SETOP_UNION_BY_NAME:
@@ -1,8 +1,10 @@
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/expression/bound_cast_expression.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_set_operation.hpp"
+#include "duckdb/planner/operator/logical_window.hpp"
 #include "duckdb/planner/query_node/bound_set_operation_node.hpp"
 
 namespace duckdb {
@@ -57,6 +59,25 @@ unique_ptr<LogicalOperator> Binder::CastLogicalOperatorToTypes(vector<LogicalTyp
 	}
 }
 
+//! Adds a ROW_NUMBER() OVER (PARTITION BY <all columns>) to the operator, so that the n-th duplicate of a row is only
+//! matched with the n-th duplicate of the row on the other side of an EXCEPT ALL or INTERSECT ALL
+static unique_ptr<LogicalOperator> AddDuplicateNumbers(Binder &binder, const vector<LogicalType> &types,
+                                                       unique_ptr<LogicalOperator> op) {
+	auto bindings = op->GetColumnBindings();
+	D_ASSERT(bindings.size() == types.size());
+	auto row_number = make_unique<BoundWindowExpression>(ExpressionType::WINDOW_ROW_NUMBER, LogicalType::BIGINT,
+	                                                     nullptr, nullptr);
+	for (idx_t i = 0; i < types.size(); i++) {
+		row_number->partitions.push_back(make_unique<BoundColumnRefExpression>(types[i], bindings[i]));
+	}
+	row_number->start = WindowBoundary::UNBOUNDED_PRECEDING;
+	row_number->end = WindowBoundary::CURRENT_ROW_ROWS;
+	auto window = make_unique<LogicalWindow>(binder.GenerateTableIndex());
+	window->expressions.push_back(move(row_number));
+	window->children.push_back(move(op));
+	return move(window);
+}
+
 unique_ptr<LogicalOperator> Binder::CreatePlan(BoundSetOperationNode &node) {
 	// Generate the logical plan for the left and right sides of the set operation
 	node.left_binder->plan_subquery = plan_subquery;
@@ -113,6 +134,23 @@ unique_ptr<LogicalOperator> Binder::CreatePlan(BoundSetOperationNode &node) {
 		break;
 	}
 
+	if (node.setop_all && logical_type != LogicalOperatorType::LOGICAL_UNION) {
+		// EXCEPT ALL/INTERSECT ALL: number the duplicates on both sides and perform the set operation on the numbered
+		// rows, the row numbers are projected out again afterwards
+		left_node = AddDuplicateNumbers(*this, node.types, move(left_node));
+		right_node = AddDuplicateNumbers(*this, node.types, move(right_node));
+		auto setop_index = GenerateTableIndex();
+		auto setop = make_unique<LogicalSetOperation>(setop_index, node.types.size() + 1, move(left_node),
+		                                              move(right_node), logical_type);
+		vector<unique_ptr<Expression>> select_list;
+		for (idx_t i = 0; i < node.types.size(); i++) {
+			select_list.push_back(make_unique<BoundColumnRefExpression>(node.types[i], ColumnBinding(setop_index, i)));
+		}
+		auto root = make_unique<LogicalProjection>(node.setop_index, move(select_list));
+		root->children.push_back(move(setop));
+		return VisitQueryNode(node, move(root));
+	}
+
 	auto root = make_unique<LogicalSetOperation>(node.setop_index, node.types.size(), move(left_node), move(right_node),
 	                                             logical_type);
 
@@ -40,21 +40,58 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt) {
 		throw NotImplementedException("COPY TO is not supported for FORMAT \"%s\"", stmt.info->format);
 	}
 	bool use_tmp_file = true;
-	for (auto &option : stmt.info->options) {
-		auto loption = StringUtil::Lower(option.first);
+	vector<idx_t> partition_columns;
+	idx_t rows_per_file = 0;
+	for (auto option = stmt.info->options.begin(); option != stmt.info->options.end();) {
+		auto loption = StringUtil::Lower(option->first);
 		if (loption == "use_tmp_file") {
-			use_tmp_file = option.second[0].CastAs(context, LogicalType::BOOLEAN).GetValue<bool>();
-			stmt.info->options.erase(option.first);
-			break;
+			use_tmp_file = option->second[0].CastAs(context, LogicalType::BOOLEAN).GetValue<bool>();
+		} else if (loption == "partition_by") {
+			for (auto &partition_column : option->second) {
+				auto name = partition_column.ToString();
+				idx_t col_idx;
+				for (col_idx = 0; col_idx < select_node.names.size(); col_idx++) {
+					if (StringUtil::Lower(select_node.names[col_idx]) == StringUtil::Lower(name)) {
+						break;
+					}
+				}
+				if (col_idx == select_node.names.size()) {
+					throw BinderException("PARTITION_BY column \"%s\" not found in the COPY source", name);
+				}
+				partition_columns.push_back(col_idx);
+			}
+		} else if (loption == "rows_per_file") {
+			rows_per_file = option->second[0].CastAs(context, LogicalType::UBIGINT).GetValue<uint64_t>();
+		} else {
+			option++;
+			continue;
 		}
+		option = stmt.info->options.erase(option);
 	}
-	auto function_data =
-	    copy_function->function.copy_to_bind(context, *stmt.info, select_node.names, select_node.types);
+	if (rows_per_file > 0 && partition_columns.empty()) {
+		throw BinderException("ROWS_PER_FILE can only be used together with PARTITION_BY");
+	}
+	// the partition columns are part of the directory names, they are not written to the files themselves
+	vector<string> names;
+	vector<LogicalType> types;
+	for (idx_t col_idx = 0; col_idx < select_node.names.size(); col_idx++) {
+		if (std::find(partition_columns.begin(), partition_columns.end(), col_idx) == partition_columns.end()) {
+			names.push_back(select_node.names[col_idx]);
+			types.push_back(select_node.types[col_idx]);
+		}
+	}
+	if (names.empty()) {
+		throw BinderException("COPY with PARTITION_BY requires at least one column that is not a partition column");
+	}
+	auto function_data = copy_function->function.copy_to_bind(context, *stmt.info, names, types);
 	// now create the copy information
 	auto copy = make_unique<LogicalCopyToFile>(copy_function->function, move(function_data));
 	copy->file_path = stmt.info->file_path;
-	copy->use_tmp_file = use_tmp_file;
+	copy->use_tmp_file = use_tmp_file && partition_columns.empty();
 	copy->is_file_and_exists = config.file_system->FileExists(copy->file_path);
+	copy->partition_columns = move(partition_columns);
+	copy->names = select_node.names;
+	copy->rows_per_file = rows_per_file;
 
 	copy->AddChild(move(select_node.plan));
 
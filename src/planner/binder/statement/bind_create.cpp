@@ -28,6 +28,7 @@
 #include "duckdb/parser/constraints/foreign_key_constraint.hpp"
 #include "duckdb/function/scalar_macro_function.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/execution/materialized_view.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/parser/constraints/unique_constraint.hpp"
 #include "duckdb/parser/constraints/list.hpp"
@@ -74,6 +75,10 @@ void Binder::BindCreateViewInfo(CreateViewInfo &base) {
 		base.aliases.push_back(query_node.names[i]);
 	}
 	base.types = query_node.types;
+	if (base.materialized) {
+		// verify that the view can be maintained incrementally
+		MaterializedViewData::Bind(context, *base.query);
+	}
 }
 
 SchemaCatalogEntry *Binder::BindCreateFunctionInfo(CreateInfo &info) {
@@ -11,6 +11,7 @@
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/expression_binder/returning_binder.hpp"
+#include "duckdb/planner/constraints/bound_unique_constraint.hpp"
 
 namespace duckdb {
 
@@ -25,6 +26,39 @@ static void CheckInsertColumnCountMismatch(int64_t expected_columns, int64_t res
 	}
 }
 
+static void BindOnConflictTarget(TableCatalogEntry &table, vector<string> &columns) {
+	if (columns.empty()) {
+		return;
+	}
+	logical_index_set_t target_set;
+	for (auto &name : columns) {
+		auto column_index = table.GetColumnIndex(name);
+		if (column_index.index == COLUMN_IDENTIFIER_ROW_ID) {
+			throw BinderException("Cannot use the rowid column as the ON CONFLICT target");
+		}
+		target_set.insert(column_index);
+	}
+	idx_t unique_count = 0;
+	bool found = false;
+	for (auto &constraint : table.bound_constraints) {
+		if (constraint->type != ConstraintType::UNIQUE) {
+			continue;
+		}
+		auto &unique = (BoundUniqueConstraint &)*constraint;
+		unique_count++;
+		found = found || unique.key_set == target_set;
+	}
+	if (!found) {
+		throw BinderException("The ON CONFLICT target does not match any PRIMARY KEY or UNIQUE constraint of table %s",
+		                      table.name);
+	}
+	if (unique_count > 1) {
+		// conflicts are detected on all unique indexes of the table
+		throw BinderException("ON CONFLICT with a conflict target is only supported for tables with a single PRIMARY "
+		                      "KEY or UNIQUE constraint");
+	}
+}
+
 BoundStatement Binder::Bind(InsertStatement &stmt) {
 	BoundStatement result;
 	result.names = {"Count"};
@@ -38,6 +72,8 @@ BoundStatement Binder::Bind(InsertStatement &stmt) {
 	}
 
 	auto insert = make_unique<LogicalInsert>(table, GenerateTableIndex());
+	BindOnConflictTarget(*table, stmt.on_conflict_columns);
+	insert->action_type = stmt.on_conflict_action;
 
 	// Add CTEs as bindable
 	AddCTEMap(stmt.cte_map);
@@ -13,6 +13,8 @@
 #include "duckdb/parser/tableref/table_function_ref.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/planner/tableref/bound_dummytableref.hpp"
+#include "duckdb/planner/tableref/bound_table_function.hpp"
+#include "duckdb/execution/materialized_view.hpp"
 
 namespace duckdb {
 
@@ -127,6 +129,20 @@ unique_ptr<BoundTableRef> Binder::Bind(BaseTableRef &ref) {
 	case CatalogType::VIEW_ENTRY: {
 		// the node is a view: get the query that the view represents
 		auto view_catalog_entry = (ViewCatalogEntry *)table_or_view;
+		if (view_catalog_entry->materialized) {
+			// the view is materialized: scan its (incrementally maintained) contents
+			auto view_data = MaterializedViewData::Get(context, *view_catalog_entry);
+			auto table_index = GenerateTableIndex();
+			auto alias = ref.alias.empty() ? ref.table_name : ref.alias;
+			auto names = BindContext::AliasColumnNames(alias, view_catalog_entry->aliases, ref.column_name_alias);
+			auto logical_get =
+			    make_unique<LogicalGet>(table_index, MaterializedViewData::GetScanFunction(),
+			                            MaterializedViewData::GetScanData(move(view_data)), view_catalog_entry->types,
+			                            view_catalog_entry->aliases);
+			bind_context.AddTableFunction(table_index, alias, names, view_catalog_entry->types,
+			                              logical_get->column_ids, logical_get->GetTable());
+			return make_unique_base<BoundTableRef, BoundTableFunction>(move(logical_get));
+		}
 		// We need to use a new binder for the view that doesn't reference any CTEs
 		// defined for this binder so there are no collisions between the CTEs defined
 		// for the view and for the current query
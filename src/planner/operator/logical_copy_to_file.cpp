@@ -10,6 +10,9 @@ void LogicalCopyToFile::Serialize(FieldWriter &writer) const {
 	writer.WriteString(file_path);
 	writer.WriteField(use_tmp_file);
 	writer.WriteField(is_file_and_exists);
+	writer.WriteList<idx_t>(partition_columns);
+	writer.WriteList<string>(names);
+	writer.WriteField(rows_per_file);
 
 	D_ASSERT(!function.name.empty());
 	writer.WriteString(function.name);
@@ -26,6 +29,9 @@ unique_ptr<LogicalOperator> LogicalCopyToFile::Deserialize(LogicalDeserializatio
 	auto file_path = reader.ReadRequired<string>();
 	auto use_tmp_file = reader.ReadRequired<bool>();
 	auto is_file_and_exists = reader.ReadRequired<bool>();
+	auto partition_columns = reader.ReadRequiredList<idx_t>();
+	auto names = reader.ReadRequiredList<string>();
+	auto rows_per_file = reader.ReadRequired<idx_t>();
 
 	auto copy_func_name = reader.ReadRequired<string>();
 
@@ -52,6 +58,9 @@ unique_ptr<LogicalOperator> LogicalCopyToFile::Deserialize(LogicalDeserializatio
 	result->file_path = file_path;
 	result->use_tmp_file = use_tmp_file;
 	result->is_file_and_exists = is_file_and_exists;
+	result->partition_columns = move(partition_columns);
+	result->names = move(names);
+	result->rows_per_file = rows_per_file;
 	return move(result);
 }
 
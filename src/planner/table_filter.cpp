@@ -25,6 +25,21 @@ void TableFilterSet::PushFilter(idx_t column_index, unique_ptr<TableFilter> filt
 	}
 }
 
+void DynamicTableFilterSet::SetFilters(unique_ptr<TableFilterSet> new_filters) {
+	lock_guard<mutex> l(lock);
+	filters = move(new_filters);
+}
+
+void DynamicTableFilterSet::Reset() {
+	lock_guard<mutex> l(lock);
+	filters.reset();
+}
+
+shared_ptr<TableFilterSet> DynamicTableFilterSet::GetFilters() {
+	lock_guard<mutex> l(lock);
+	return filters;
+}
+
 //! Serializes a LogicalType to a stand-alone binary blob
 void TableFilterSet::Serialize(Serializer &serializer) const {
 	serializer.Write<idx_t>(filters.size());
@@ -90,4 +90,12 @@ bool ArenaAllocator::IsEmpty() {
 	return head == nullptr;
 }
 
+idx_t ArenaAllocator::SizeInBytes() const {
+	idx_t result = 0;
+	for (auto chunk = head.get(); chunk; chunk = chunk->next.get()) {
+		result += chunk->maximum_size;
+	}
+	return result;
+}
+
 } // namespace duckdb
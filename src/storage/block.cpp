@@ -12,6 +12,10 @@ Block::Block(Allocator &allocator, block_id_t id, uint32_t internal_size)
 	D_ASSERT((GetMallocedSize() & (Storage::SECTOR_SIZE - 1)) == 0);
 }
 
+Block::Block(Allocator &allocator, block_id_t id, data_ptr_t mapped_buffer)
+    : FileBuffer(allocator, FileBufferType::BLOCK, mapped_buffer, Storage::BLOCK_ALLOC_SIZE), id(id) {
+}
+
 Block::Block(FileBuffer &source, block_id_t id) : FileBuffer(source, FileBufferType::BLOCK), id(id) {
 	D_ASSERT((GetMallocedSize() & (Storage::SECTOR_SIZE - 1)) == 0);
 }
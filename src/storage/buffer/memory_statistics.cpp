@@ -0,0 +1,10 @@
+#include "duckdb/storage/buffer/memory_statistics.hpp"
+
+namespace duckdb {
+
+MemoryStatistics &MemoryStatistics::Get() {
+	static thread_local MemoryStatistics statistics;
+	return statistics;
+}
+
+} // namespace duckdb
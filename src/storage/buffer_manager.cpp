@@ -2,11 +2,17 @@
 
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/map.hpp"
 #include "duckdb/common/set.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/database.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
+#include "duckdb/storage/buffer/memory_statistics.hpp"
 #include "duckdb/storage/in_memory_block_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
+#include "miniz.hpp"
+
 namespace duckdb {
 
 BufferPoolReservation::BufferPoolReservation(BufferPoolReservation &&src) noexcept {
@@ -29,6 +35,7 @@ void BufferPoolReservation::Resize(atomic<idx_t> &counter, idx_t new_size) {
 	D_ASSERT(delta > 0 || (int64_t)counter >= -delta);
 	counter += delta;
 	size = new_size;
+	MemoryStatistics::Get().AddMemory(delta);
 }
 
 void BufferPoolReservation::Merge(BufferPoolReservation &&src) {
@@ -45,7 +52,7 @@ struct BufferAllocatorData : PrivateAllocatorData {
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p)
     : block_manager(block_manager), readers(0), block_id(block_id_p), buffer(nullptr), eviction_timestamp(0),
-      can_destroy(false), unswizzled(nullptr) {
+      reused(false), can_destroy(false), unswizzled(nullptr) {
 	eviction_timestamp = 0;
 	state = BlockState::BLOCK_UNLOADED;
 	memory_usage = Storage::BLOCK_ALLOC_SIZE;
@@ -53,8 +60,8 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p)
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, unique_ptr<FileBuffer> buffer_p,
                          bool can_destroy_p, idx_t block_size, BufferPoolReservation &&reservation)
-    : block_manager(block_manager), readers(0), block_id(block_id_p), eviction_timestamp(0), can_destroy(can_destroy_p),
-      unswizzled(nullptr) {
+    : block_manager(block_manager), readers(0), block_id(block_id_p), eviction_timestamp(0), reused(false),
+      can_destroy(can_destroy_p), unswizzled(nullptr) {
 	buffer = move(buffer_p);
 	state = BlockState::BLOCK_LOADED;
 	memory_usage = block_size;
@@ -67,10 +74,12 @@ BlockHandle::~BlockHandle() {
 	auto &buffer_manager = block_manager.buffer_manager;
 	// no references remain to this block: erase
 	if (buffer && state == BlockState::BLOCK_LOADED) {
-		D_ASSERT(memory_charge.size > 0);
-		// the block is still loaded in memory: erase it
-		buffer.reset();
-		memory_charge.Resize(buffer_manager.current_memory, 0);
+		D_ASSERT(memory_charge.size > 0 || buffer->IsExternal());
+		// the block is still loaded in memory: hand the buffer to the free buffer pool, or erase it
+		if (!buffer_manager.RecycleBuffer(buffer, memory_charge)) {
+			buffer.reset();
+			memory_charge.Resize(buffer_manager.current_memory, 0);
+		}
 	} else {
 		D_ASSERT(memory_charge.size == 0);
 	}
@@ -118,14 +127,20 @@ BufferHandle BlockHandle::Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileB
 
 	auto &block_manager = handle->block_manager;
 	if (handle->block_id < MAXIMUM_BLOCK) {
-		auto block = AllocateBlock(block_manager, move(reusable_buffer), handle->block_id);
-		block_manager.Read(*block);
+		// if the database file is memory-mapped we reference the mapped block instead of copying it
+		auto block = block_manager.ReadMapped(handle->block_id);
+		if (!block) {
+			block = AllocateBlock(block_manager, move(reusable_buffer), handle->block_id);
+			block_manager.Read(*block);
+		}
 		handle->buffer = move(block);
 	} else {
 		if (handle->can_destroy) {
 			return BufferHandle();
 		} else {
 			handle->buffer = block_manager.buffer_manager.ReadTemporaryBuffer(handle->block_id, move(reusable_buffer));
+			block_manager.buffer_manager.temporary_read_bytes += handle->buffer->size;
+			MemoryStatistics::Get().read_bytes += handle->buffer->size;
 		}
 	}
 	handle->state = BlockState::BLOCK_LOADED;
@@ -146,6 +161,7 @@ unique_ptr<FileBuffer> BlockHandle::UnloadAndTakeBlock() {
 	}
 	memory_charge.Resize(block_manager.buffer_manager.current_memory, 0);
 	state = BlockState::BLOCK_UNLOADED;
+	reused = false;
 	return move(buffer);
 }
 
@@ -209,7 +225,21 @@ struct BufferEvictionNode {
 typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
 struct EvictionQueue {
+	//! The queue of blocks that have been pinned again while they were loaded
 	eviction_queue_t q;
+	//! The queue of blocks that have only been pinned once since they were loaded (e.g. by a sequential scan). Only
+	//! used by the 2Q eviction policy, blocks in this queue are evicted before any blocks in the main queue.
+	eviction_queue_t probation;
+};
+
+struct FreeBufferPool {
+	//! The maximum fraction of the memory limit that can be held by free buffers
+	static constexpr idx_t MAXIMUM_POOL_FRACTION = 8;
+
+	//! The lock for accessing the pool
+	mutex lock;
+	//! The free buffers, grouped by their allocation size
+	map<idx_t, vector<unique_ptr<FileBuffer>>> buffers;
 };
 
 class TemporaryFileManager;
@@ -235,8 +265,10 @@ void BufferManager::SetTemporaryDirectory(string new_dir) {
 }
 
 BufferManager::BufferManager(DatabaseInstance &db, string tmp, idx_t maximum_memory)
-    : db(db), current_memory(0), maximum_memory(maximum_memory), temp_directory(move(tmp)),
-      queue(make_unique<EvictionQueue>()), temporary_id(MAXIMUM_BLOCK), queue_insertions(0),
+    : db(db), current_memory(0), maximum_memory(maximum_memory), pooled_memory(0), peak_memory(0), spilled_bytes(0),
+      temporary_read_bytes(0), temp_directory(move(tmp)),
+      queue(make_unique<EvictionQueue>()), free_buffers(make_unique<FreeBufferPool>()), temporary_id(MAXIMUM_BLOCK),
+      queue_insertions(0),
       buffer_allocator(BufferAllocatorAllocate, BufferAllocatorFree, BufferAllocatorRealloc,
                        make_unique<BufferAllocatorData>(*this)) {
 	temp_block_manager = make_unique<InMemoryBlockManager>(*this);
@@ -385,6 +417,7 @@ BufferHandle BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
 			handle->readers++;
+			handle->reused = true;
 			return handle->Load(handle);
 		}
 		required_memory = handle->memory_usage;
@@ -399,6 +432,7 @@ BufferHandle BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	if (handle->state == BlockState::BLOCK_LOADED) {
 		// the block is loaded, increment the reader count and return a pointer to the handle
 		handle->readers++;
+		handle->reused = true;
 		reservation.Resize(current_memory, 0);
 		return handle->Load(handle);
 	}
@@ -415,6 +449,11 @@ BufferHandle BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		handle->memory_charge.Resize(current_memory, handle->memory_usage);
 	}
 	D_ASSERT(handle->memory_usage == handle->buffer->AllocSize());
+	if (handle->buffer->IsExternal()) {
+		// memory-mapped blocks live in the OS page cache, which is shared with all processes that map the same file:
+		// they do not take up any memory of the buffer pool
+		handle->memory_charge.Resize(current_memory, 0);
+	}
 	return buf;
 }
 
@@ -427,11 +466,22 @@ void BufferManager::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 	if ((++queue_insertions % INSERT_INTERVAL) == 0) {
 		PurgeQueue();
 	}
-	queue->q.enqueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp));
+	BufferEvictionNode node(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp);
+	if (!handle->reused && db.config.options.buffer_eviction_policy == BufferEvictionPolicy::TWO_QUEUE) {
+		// the block has only been used once since it was loaded: it is evicted before the frequently used blocks, so
+		// that a single large scan does not flush the blocks of the hot tables and indexes
+		queue->probation.enqueue(move(node));
+	} else {
+		queue->q.enqueue(move(node));
+	}
 }
 
 void BufferManager::VerifyZeroReaders(shared_ptr<BlockHandle> &handle) {
 #ifdef DUCKDB_DEBUG_DESTROY_BLOCKS
+	if (handle->buffer->IsExternal()) {
+		// memory-mapped blocks are read-only
+		return;
+	}
 	auto replacement_buffer = make_unique<FileBuffer>(Allocator::Get(db), handle->buffer->type,
 	                                                  handle->memory_usage - Storage::BLOCK_HEADER_SIZE);
 	memcpy(replacement_buffer->buffer, handle->buffer->buffer, handle->buffer->size);
@@ -457,9 +507,17 @@ BufferManager::EvictionResult BufferManager::EvictBlocks(idx_t extra_memory, idx
                                                          unique_ptr<FileBuffer> *buffer) {
 	BufferEvictionNode node;
 	TempBufferPoolReservation r(current_memory, extra_memory);
-	while (current_memory > memory_limit) {
-		// get a block to unpin from the queue
-		if (!queue->q.try_dequeue(node)) {
+	if (buffer) {
+		// a freed buffer of the right size can be re-used without going through the allocator
+		*buffer = TakePooledBuffer(extra_memory);
+	}
+	while (current_memory + pooled_memory > memory_limit) {
+		// under memory pressure the free buffers are the first to go
+		if (ReleasePooledBuffer()) {
+			continue;
+		}
+		// get a block to unpin from the queues, starting with the blocks that have only been used once
+		if (!queue->probation.try_dequeue(node) && !queue->q.try_dequeue(node)) {
 			// Failed to reserve. Adjust size of temp reservation to 0.
 			r.Resize(current_memory, 0);
 			return {false, move(r)};
@@ -476,7 +534,7 @@ BufferManager::EvictionResult BufferManager::EvictBlocks(idx_t extra_memory, idx
 			continue;
 		}
 		// hooray, we can unload the block
-		if (buffer && handle->buffer->AllocSize() == extra_memory) {
+		if (buffer && !*buffer && handle->buffer->AllocSize() == extra_memory && !handle->buffer->IsExternal()) {
 			// we can actually re-use the memory directly!
 			*buffer = handle->UnloadAndTakeBlock();
 			return {true, move(r)};
@@ -485,25 +543,94 @@ BufferManager::EvictionResult BufferManager::EvictBlocks(idx_t extra_memory, idx
 			handle->Unload();
 		}
 	}
+	// the memory is reserved: update the peak
+	idx_t current = current_memory;
+	idx_t peak = peak_memory;
+	while (current > peak && !peak_memory.compare_exchange_weak(peak, current)) {
+	}
 	return {true, move(r)};
 }
 
-void BufferManager::PurgeQueue() {
+bool BufferManager::RecycleBuffer(unique_ptr<FileBuffer> &buffer, BufferPoolReservation &reservation) {
+	auto alloc_size = buffer->AllocSize();
+	if (buffer->type != FileBufferType::MANAGED_BUFFER || alloc_size == Storage::BLOCK_ALLOC_SIZE) {
+		// only variable-size buffers are pooled: buffers of the standard block size are already re-used when evicting
+		return false;
+	}
+	D_ASSERT(alloc_size == reservation.size);
+	lock_guard<mutex> l_lock(free_buffers->lock);
+	if (current_memory + pooled_memory > maximum_memory ||
+	    pooled_memory + alloc_size > maximum_memory / FreeBufferPool::MAXIMUM_POOL_FRACTION) {
+		// the pool is full
+		return false;
+	}
+	free_buffers->buffers[alloc_size].push_back(move(buffer));
+	// the memory is now accounted for by the pool instead of by the block
+	pooled_memory += alloc_size;
+	reservation.Resize(current_memory, 0);
+	return true;
+}
+
+unique_ptr<FileBuffer> BufferManager::TakePooledBuffer(idx_t alloc_size) {
+	if (pooled_memory == 0) {
+		return nullptr;
+	}
+	lock_guard<mutex> l_lock(free_buffers->lock);
+	auto entry = free_buffers->buffers.find(alloc_size);
+	if (entry == free_buffers->buffers.end()) {
+		return nullptr;
+	}
+	auto result = move(entry->second.back());
+	entry->second.pop_back();
+	if (entry->second.empty()) {
+		free_buffers->buffers.erase(entry);
+	}
+	pooled_memory -= alloc_size;
+	return result;
+}
+
+bool BufferManager::ReleasePooledBuffer() {
+	unique_ptr<FileBuffer> released;
+	{
+		lock_guard<mutex> l_lock(free_buffers->lock);
+		if (free_buffers->buffers.empty()) {
+			return false;
+		}
+		// release the largest buffers first
+		auto entry = prev(free_buffers->buffers.end());
+		released = move(entry->second.back());
+		entry->second.pop_back();
+		if (entry->second.empty()) {
+			free_buffers->buffers.erase(entry);
+		}
+		pooled_memory -= released->AllocSize();
+	}
+	// free the memory outside of the lock
+	released.reset();
+	return true;
+}
+
+static void PurgeEvictionQueue(eviction_queue_t &q) {
 	BufferEvictionNode node;
 	while (true) {
-		if (!queue->q.try_dequeue(node)) {
+		if (!q.try_dequeue(node)) {
 			break;
 		}
 		auto handle = node.TryGetBlockHandle();
 		if (!handle) {
 			continue;
 		} else {
-			queue->q.enqueue(move(node));
+			q.enqueue(move(node));
 			break;
 		}
 	}
 }
 
+void BufferManager::PurgeQueue() {
+	PurgeEvictionQueue(queue->probation);
+	PurgeEvictionQueue(queue->q);
+}
+
 void BlockManager::UnregisterBlock(block_id_t block_id, bool can_destroy) {
 	if (block_id >= MAXIMUM_BLOCK) {
 		// in-memory buffer: destroy the buffer
@@ -518,6 +645,10 @@ void BlockManager::UnregisterBlock(block_id_t block_id, bool can_destroy) {
 	}
 }
 
+idx_t BufferManager::GetQueryMaxMemory(ClientContext &context) {
+	return MinValue<idx_t>(maximum_memory, ClientConfig::GetConfig(context).query_memory_limit);
+}
+
 void BufferManager::SetLimit(idx_t limit) {
 	lock_guard<mutex> l_lock(limit_lock);
 	// try to evict until the limit is reached
@@ -552,11 +683,13 @@ unique_ptr<FileBuffer> ReadTemporaryBufferInternal(BufferManager &buffer_manager
 struct TemporaryFileIndex {
 	explicit TemporaryFileIndex(idx_t file_index = DConstants::INVALID_INDEX,
 	                            idx_t block_index = DConstants::INVALID_INDEX)
-	    : file_index(file_index), block_index(block_index) {
+	    : file_index(file_index), block_index(block_index), compressed_size(0) {
 	}
 
 	idx_t file_index;
 	idx_t block_index;
+	//! The size of the compressed block in the file, or 0 if the block is stored uncompressed
+	idx_t compressed_size;
 
 public:
 	bool IsValid() {
@@ -658,25 +791,53 @@ public:
 		return TemporaryFileIndex(file_index, block_index);
 	}
 
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_data) {
 		D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+		if (index.compressed_size > 0) {
+			// only write the compressed block
+			handle->Write(compressed_data.get(), index.compressed_size, GetPositionInFile(index.block_index));
+			return;
+		}
 		buffer.Write(*handle, GetPositionInFile(index.block_index));
 	}
 
-	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, idx_t block_index,
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, TemporaryFileIndex index,
 	                                           unique_ptr<FileBuffer> reusable_buffer) {
-		auto buffer =
-		    ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-		                                Storage::BLOCK_SIZE, id, move(reusable_buffer));
+		unique_ptr<FileBuffer> buffer;
+		if (index.compressed_size > 0) {
+			// read the compressed block and decompress it into the buffer
+			auto &buffer_manager = BufferManager::GetBufferManager(db);
+			auto compressed_data = Allocator::Get(db).Allocate(index.compressed_size);
+			handle->Read(compressed_data.get(), index.compressed_size, GetPositionInFile(index.block_index));
+			buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, move(reusable_buffer));
+			duckdb_miniz::mz_ulong decompressed_size = buffer->size;
+			auto result = duckdb_miniz::mz_uncompress(buffer->buffer, &decompressed_size, compressed_data.get(),
+			                                          index.compressed_size);
+			if (result != duckdb_miniz::MZ_OK || decompressed_size != buffer->size) {
+				throw IOException("Failed to decompress temporary block %llu", id);
+			}
+		} else {
+			buffer = ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
+			                                     GetPositionInFile(index.block_index), Storage::BLOCK_SIZE, id,
+			                                     move(reusable_buffer));
+		}
 		{
 			// remove the block (and potentially truncate the temp file)
 			TemporaryFileLock lock(file_lock);
 			D_ASSERT(handle);
-			RemoveTempBlockIndex(lock, block_index);
+			RemoveTempBlockIndex(lock, index.block_index);
 		}
 		return buffer;
 	}
 
+	void Prefetch(idx_t block_index) {
+		TemporaryFileLock lock(file_lock);
+		if (!handle) {
+			return;
+		}
+		handle->Prefetch(GetPositionInFile(block_index), Storage::BLOCK_ALLOC_SIZE);
+	}
+
 	bool DeleteIfEmpty() {
 		TemporaryFileLock lock(file_lock);
 		if (index_manager.GetMaxIndex() > 0) {
@@ -743,6 +904,9 @@ public:
 		TemporaryFileIndex index;
 		TemporaryFileHandle *handle = nullptr;
 
+		// compress the block first (if enabled), so that we write (and later read) less data
+		AllocatedData compressed_data;
+		auto compressed_size = CompressBuffer(buffer, compressed_data);
 		{
 			TemporaryManagerLock lock(manager_lock);
 			// first check if we can write to an open existing file
@@ -763,12 +927,13 @@ public:
 
 				index = handle->TryGetBlockIndex();
 			}
+			index.compressed_size = compressed_size;
 			D_ASSERT(used_blocks.find(block_id) == used_blocks.end());
 			used_blocks[block_id] = index;
 		}
 		D_ASSERT(handle);
 		D_ASSERT(index.IsValid());
-		handle->WriteTemporaryFile(buffer, index);
+		handle->WriteTemporaryFile(buffer, index, compressed_data);
 	}
 
 	bool HasTemporaryBuffer(block_id_t block_id) {
@@ -784,7 +949,7 @@ public:
 			index = GetTempBlockIndex(lock, id);
 			handle = GetFileHandle(lock, index.file_index);
 		}
-		auto buffer = handle->ReadTemporaryBuffer(id, index.block_index, move(reusable_buffer));
+		auto buffer = handle->ReadTemporaryBuffer(id, index, move(reusable_buffer));
 		{
 			// remove the block (and potentially erase the temp file)
 			TemporaryManagerLock lock(manager_lock);
@@ -793,6 +958,17 @@ public:
 		return buffer;
 	}
 
+	void Prefetch(block_id_t id) {
+		TemporaryManagerLock lock(manager_lock);
+		auto entry = used_blocks.find(id);
+		if (entry == used_blocks.end()) {
+			// the buffer is larger than a block and was written to a separate file
+			return;
+		}
+		auto handle = GetFileHandle(lock, entry->second.file_index);
+		handle->Prefetch(entry->second.block_index);
+	}
+
 	void DeleteTemporaryBuffer(block_id_t id) {
 		TemporaryManagerLock lock(manager_lock);
 		auto index = GetTempBlockIndex(lock, id);
@@ -801,6 +977,25 @@ public:
 	}
 
 private:
+	//! Compresses the buffer into compressed_data if compression of temporary files is enabled, and returns the size
+	//! of the compressed data. Returns 0 if the buffer should be written uncompressed.
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_data) {
+		if (!db.config.options.compress_temporary_files) {
+			return 0;
+		}
+		auto bound = duckdb_miniz::mz_compressBound(buffer.size);
+		compressed_data = Allocator::Get(db).Allocate(bound);
+		duckdb_miniz::mz_ulong compressed_size = bound;
+		auto result = duckdb_miniz::mz_compress2(compressed_data.get(), &compressed_size, buffer.buffer, buffer.size,
+		                                         duckdb_miniz::MZ_BEST_SPEED);
+		if (result != duckdb_miniz::MZ_OK || compressed_size >= buffer.size) {
+			// the block is not compressible
+			compressed_data.Reset();
+			return 0;
+		}
+		return compressed_size;
+	}
+
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle, idx_t file_index) {
 		used_blocks.erase(id);
 		if (handle->DeleteIfEmpty()) {
@@ -876,6 +1071,8 @@ void BufferManager::RequireTemporaryDirectory() {
 
 void BufferManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	RequireTemporaryDirectory();
+	spilled_bytes += buffer.size;
+	MemoryStatistics::Get().spilled_bytes += buffer.size;
 	if (buffer.size == Storage::BLOCK_SIZE) {
 		temp_directory_handle->GetTempFile().WriteTemporaryBuffer(block_id, buffer);
 		return;
@@ -911,6 +1108,28 @@ unique_ptr<FileBuffer> BufferManager::ReadTemporaryBuffer(block_id_t id, unique_
 	return buffer;
 }
 
+void BufferManager::Prefetch(shared_ptr<BlockHandle> &handle) {
+	if (handle->state == BlockState::BLOCK_LOADED) {
+		return;
+	}
+	if (handle->block_id < MAXIMUM_BLOCK) {
+		// persistent block: let the block manager read ahead
+		handle->block_manager.Prefetch(handle->block_id);
+		return;
+	}
+	if (handle->can_destroy) {
+		// destroyed buffers are not written to the temporary directory, so there is nothing to read ahead
+		return;
+	}
+	{
+		lock_guard<mutex> temp_handle_guard(temp_handle_lock);
+		if (!temp_directory_handle) {
+			return;
+		}
+	}
+	temp_directory_handle->GetTempFile().Prefetch(handle->block_id);
+}
+
 void BufferManager::DeleteTemporaryFile(block_id_t id) {
 	if (temp_directory.empty()) {
 		// no temporary directory specified: nothing to delete
@@ -25,7 +25,6 @@
 #include "duckdb/planner/expression_binder/index_binder.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/storage/block_manager.hpp"
-#include "duckdb/storage/checkpoint/table_data_reader.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/meta_block_reader.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
@@ -463,11 +462,9 @@ void CheckpointReader::ReadTableData(ClientContext &context, MetaBlockReader &re
 	auto block_id = reader.Read<block_id_t>();
 	auto offset = reader.Read<uint64_t>();
 
-	MetaBlockReader table_data_reader(reader.block_manager, block_id);
-	table_data_reader.offset = offset;
-	TableDataReader data_reader(table_data_reader, bound_info);
-
-	data_reader.ReadTableData();
+	// the row groups and statistics of the table are only read when the table is first accessed
+	bound_info.data = make_unique<PersistentTableData>(bound_info.Base().columns.PhysicalColumnCount());
+	bound_info.data->table_pointer = BlockPointer(block_id, offset);
 
 	// Get any indexes block info
 	idx_t num_indexes = reader.Read<idx_t>();
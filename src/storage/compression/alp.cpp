@@ -0,0 +1,576 @@
+#include "duckdb/common/bitpacking.hpp"
+
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/types/null_value.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+
+#include <cmath>
+
+namespace duckdb {
+
+// ALP (adaptive lossless floating point) compression stores floating point values that are really decimals (prices,
+// sensor readings with a fixed precision) as integers: every group of values picks a decimal exponent e, and each value
+// v is stored as the integer digits d for which d / 10^e reproduces v exactly. The digits are bitpacked relative to the
+// smallest digits of the group. Values that cannot be reproduced this way (e.g. NaN, -0.0 or values with too many
+// decimals) are stored as exceptions next to the packed digits.
+//
+// Every group stores its metadata (bit width, exponent, exception count and frame of reference) at the end of the
+// segment, growing downwards, in the same layout as the bitpacking compression.
+static constexpr const idx_t ALP_GROUP_SIZE = 1024;
+
+static const double ALP_FACTORS[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8, 1e9,
+                                     1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+
+template <class T>
+struct AlpPrimitives {};
+
+template <>
+struct AlpPrimitives<float> {
+	//! Powers of ten up to 10^10 are exactly representable as a float
+	static constexpr const uint8_t MAX_EXPONENT = 10;
+};
+
+template <>
+struct AlpPrimitives<double> {
+	static constexpr const uint8_t MAX_EXPONENT = 18;
+};
+
+template <class T>
+struct Alp {
+	//! Digits are limited to the integers that a double can represent exactly
+	static constexpr const double MAX_DIGITS = 4503599627370496.0;
+
+	static inline T Decode(int64_t digits, uint8_t exponent) {
+		return T(digits) / T(ALP_FACTORS[exponent]);
+	}
+
+	static inline bool TryEncode(T value, uint8_t exponent, int64_t &digits) {
+		double scaled = double(value) * ALP_FACTORS[exponent];
+		// this also rejects NaN and infinity
+		if (!(scaled >= -MAX_DIGITS && scaled <= MAX_DIGITS)) {
+			return false;
+		}
+		digits = int64_t(std::round(scaled));
+		// compare the bit patterns, so that -0.0 is not stored as 0.0
+		auto decoded = Decode(digits, exponent);
+		return memcmp(&decoded, &value, sizeof(T)) == 0;
+	}
+
+	//! Returns the smallest exponent with which the value can be encoded, or MAX_EXPONENT + 1 if there is none
+	static inline uint8_t MinimumExponent(T value) {
+		int64_t ignore;
+		for (uint8_t exponent = 0; exponent <= AlpPrimitives<T>::MAX_EXPONENT; exponent++) {
+			if (TryEncode(value, exponent, ignore)) {
+				return exponent;
+			}
+		}
+		return AlpPrimitives<T>::MAX_EXPONENT + 1;
+	}
+
+	static inline idx_t ExceptionSize(idx_t exception_count) {
+		return AlignValue(exception_count * (sizeof(uint16_t) + sizeof(T)));
+	}
+
+	static inline idx_t MetadataSize() {
+		return sizeof(bitpacking_width_t) + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(int64_t);
+	}
+};
+
+struct EmptyAlpWriter {
+	template <class T>
+	static void Operation(T *values, bool *validity, int64_t *digits, bitpacking_width_t width, uint8_t exponent,
+	                      int64_t frame_of_reference, uint16_t *exception_positions, idx_t exception_count,
+	                      idx_t count, void *data_ptr) {
+	}
+};
+
+template <class T>
+struct AlpState {
+public:
+	AlpState() : compression_buffer_idx(0), total_size(0), data_ptr(nullptr) {
+	}
+
+	T compression_buffer[ALP_GROUP_SIZE];
+	bool compression_buffer_validity[ALP_GROUP_SIZE];
+	idx_t compression_buffer_idx;
+	idx_t total_size;
+	void *data_ptr;
+
+	//! The encoded digits (relative to the frame of reference) and exceptions of the group that is flushed
+	int64_t digits[ALP_GROUP_SIZE];
+	uint16_t exception_positions[ALP_GROUP_SIZE];
+	idx_t exception_count;
+	int64_t frame_of_reference;
+	bitpacking_width_t width;
+
+public:
+	//! Encodes the current group with the given exponent, and returns the size of the encoded group
+	idx_t EncodeGroup(uint8_t exponent) {
+		exception_count = 0;
+		bool min_max_set = false;
+		int64_t minimum = 0;
+		int64_t maximum = 0;
+		for (idx_t i = 0; i < compression_buffer_idx; i++) {
+			if (!compression_buffer_validity[i]) {
+				continue;
+			}
+			if (!Alp<T>::TryEncode(compression_buffer[i], exponent, digits[i])) {
+				exception_positions[exception_count++] = i;
+				continue;
+			}
+			if (!min_max_set || digits[i] < minimum) {
+				minimum = digits[i];
+			}
+			if (!min_max_set || digits[i] > maximum) {
+				maximum = digits[i];
+			}
+			min_max_set = true;
+		}
+		frame_of_reference = minimum;
+		width = BitpackingPrimitives::MinimumBitWidth<uint64_t>((uint64_t)0, uint64_t(maximum - minimum));
+		return (ALP_GROUP_SIZE * width) / 8 + Alp<T>::ExceptionSize(exception_count) + Alp<T>::MetadataSize();
+	}
+
+	template <class OP>
+	void Flush() {
+		if (compression_buffer_idx == 0) {
+			return;
+		}
+		// try every exponent that is the smallest exponent of at least one value, and keep the smallest encoding
+		idx_t exponent_counts[AlpPrimitives<T>::MAX_EXPONENT + 2] = {0};
+		for (idx_t i = 0; i < compression_buffer_idx; i++) {
+			if (compression_buffer_validity[i]) {
+				exponent_counts[Alp<T>::MinimumExponent(compression_buffer[i])]++;
+			}
+		}
+		uint8_t best_exponent = 0;
+		idx_t best_size = NumericLimits<idx_t>::Maximum();
+		for (uint8_t exponent = 0; exponent <= AlpPrimitives<T>::MAX_EXPONENT; exponent++) {
+			if (exponent_counts[exponent] == 0) {
+				continue;
+			}
+			auto size = EncodeGroup(exponent);
+			if (size < best_size) {
+				best_size = size;
+				best_exponent = exponent;
+			}
+		}
+		auto group_size = EncodeGroup(best_exponent);
+
+		// NULL values and exceptions are packed as zero
+		for (idx_t i = 0; i < compression_buffer_idx; i++) {
+			if (!compression_buffer_validity[i]) {
+				digits[i] = frame_of_reference;
+			}
+		}
+		for (idx_t i = 0; i < exception_count; i++) {
+			digits[exception_positions[i]] = frame_of_reference;
+		}
+		for (idx_t i = 0; i < compression_buffer_idx; i++) {
+			digits[i] -= frame_of_reference;
+		}
+
+		OP::template Operation<T>(compression_buffer, compression_buffer_validity, digits, width, best_exponent,
+		                          frame_of_reference, exception_positions, exception_count, compression_buffer_idx,
+		                          data_ptr);
+		total_size += group_size;
+		compression_buffer_idx = 0;
+	}
+
+	template <class OP = EmptyAlpWriter>
+	void Update(T *data, ValidityMask &validity, idx_t idx) {
+		if (validity.RowIsValid(idx)) {
+			compression_buffer_validity[compression_buffer_idx] = true;
+			compression_buffer[compression_buffer_idx++] = data[idx];
+		} else {
+			compression_buffer_validity[compression_buffer_idx] = false;
+			compression_buffer[compression_buffer_idx++] = 0;
+		}
+
+		if (compression_buffer_idx == ALP_GROUP_SIZE) {
+			Flush<OP>();
+		}
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct AlpAnalyzeState : public AnalyzeState {
+	AlpState<T> state;
+};
+
+template <class T>
+unique_ptr<AnalyzeState> AlpInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_unique<AlpAnalyzeState<T>>();
+}
+
+template <class T>
+bool AlpAnalyze(AnalyzeState &state, Vector &input, idx_t count) {
+	auto &analyze_state = (AlpAnalyzeState<T> &)state;
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = (T *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		analyze_state.state.template Update<EmptyAlpWriter>(data, vdata.validity, idx);
+	}
+	return true;
+}
+
+template <class T>
+idx_t AlpFinalAnalyze(AnalyzeState &state) {
+	auto &alp_state = (AlpAnalyzeState<T> &)state;
+	alp_state.state.template Flush<EmptyAlpWriter>();
+	return alp_state.state.total_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T>
+struct AlpCompressState : public CompressionState {
+public:
+	explicit AlpCompressState(ColumnDataCheckpointer &checkpointer) : checkpointer(checkpointer) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto &config = DBConfig::GetConfig(db);
+		function = config.GetCompressionFunction(CompressionType::COMPRESSION_ALP, type.InternalType());
+		CreateEmptySegment(checkpointer.GetRowStart());
+
+		state.data_ptr = (void *)this;
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction *function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	// Ptr to next free spot in segment;
+	data_ptr_t data_ptr;
+	// Ptr to next free spot for storing the group metadata (growing downwards).
+	data_ptr_t metadata_ptr;
+
+	AlpState<T> state;
+
+public:
+	struct AlpWriter {
+		template <class VALUE_TYPE>
+		static void Operation(VALUE_TYPE *values, bool *validity, int64_t *digits, bitpacking_width_t width,
+		                      uint8_t exponent, int64_t frame_of_reference, uint16_t *exception_positions,
+		                      idx_t exception_count, idx_t count, void *data_ptr) {
+			auto state = (AlpCompressState<T> *)data_ptr;
+			auto total_bytes_needed = (width * ALP_GROUP_SIZE) / 8;
+			total_bytes_needed += Alp<T>::ExceptionSize(exception_count);
+			total_bytes_needed += Alp<T>::MetadataSize();
+
+			if (state->RemainingSize() < total_bytes_needed) {
+				// Segment is full
+				auto row_start = state->current_segment->start + state->current_segment->count;
+				state->FlushSegment();
+				state->CreateEmptySegment(row_start);
+			}
+
+			for (idx_t i = 0; i < count; i++) {
+				if (validity[i]) {
+					NumericStatistics::Update<T>(state->current_segment->stats, values[i]);
+				}
+			}
+
+			state->WriteValues(values, digits, width, exponent, frame_of_reference, exception_positions,
+			                   exception_count, count);
+		}
+	};
+
+	// Space remaining between the metadata_ptr growing down and data ptr growing up
+	idx_t RemainingSize() {
+		return metadata_ptr - data_ptr;
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto compressed_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		compressed_segment->function = function;
+		current_segment = move(compressed_segment);
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + BitpackingPrimitives::BITPACKING_HEADER_SIZE;
+		metadata_ptr = handle.Ptr() + Storage::BLOCK_SIZE - sizeof(bitpacking_width_t);
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = (T *)vdata.data;
+
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			state.template Update<AlpCompressState<T>::AlpWriter>(data, vdata.validity, idx);
+		}
+	}
+
+	void WriteValues(T *values, int64_t *digits, bitpacking_width_t width, uint8_t exponent,
+	                 int64_t frame_of_reference, uint16_t *exception_positions, idx_t exception_count, idx_t count) {
+		BitpackingPrimitives::PackBuffer<int64_t, false>(data_ptr, digits, count, width);
+		data_ptr += (ALP_GROUP_SIZE * width) / 8;
+
+		// the exceptions follow the packed digits: first their positions, then their values
+		auto exception_ptr = data_ptr;
+		for (idx_t i = 0; i < exception_count; i++) {
+			Store<uint16_t>(exception_positions[i], exception_ptr);
+			exception_ptr += sizeof(uint16_t);
+		}
+		for (idx_t i = 0; i < exception_count; i++) {
+			Store<T>(values[exception_positions[i]], exception_ptr);
+			exception_ptr += sizeof(T);
+		}
+		data_ptr += Alp<T>::ExceptionSize(exception_count);
+
+		Store<bitpacking_width_t>(width, metadata_ptr);
+		metadata_ptr -= sizeof(uint8_t);
+		Store<uint8_t>(exponent, metadata_ptr);
+		metadata_ptr -= sizeof(uint16_t);
+		Store<uint16_t>(exception_count, metadata_ptr);
+		metadata_ptr -= sizeof(int64_t);
+		Store<int64_t>(frame_of_reference, metadata_ptr);
+		metadata_ptr -= sizeof(bitpacking_width_t);
+
+		current_segment->count += count;
+	}
+
+	void FlushSegment() {
+		auto &state = checkpointer.GetCheckpointState();
+		auto dataptr = handle.Ptr();
+
+		// Compact the segment by moving the metadata next to the data.
+		idx_t metadata_offset = data_ptr - dataptr;
+		D_ASSERT(ValueIsAligned(metadata_offset));
+		idx_t metadata_size = dataptr + Storage::BLOCK_SIZE - metadata_ptr - 1;
+		idx_t total_segment_size = metadata_offset + metadata_size;
+		memmove(dataptr + metadata_offset, metadata_ptr + 1, metadata_size);
+
+		// Store the offset of the metadata of the first group (which is at the highest address).
+		Store<idx_t>(metadata_offset + metadata_size - 1, dataptr);
+		handle.Destroy();
+
+		state.FlushSegment(move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		state.template Flush<AlpCompressState<T>::AlpWriter>();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T>
+unique_ptr<CompressionState> AlpInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                unique_ptr<AnalyzeState> state) {
+	return make_unique<AlpCompressState<T>>(checkpointer);
+}
+
+template <class T>
+void AlpCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = (AlpCompressState<T> &)state_p;
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T>
+void AlpFinalizeCompress(CompressionState &state_p) {
+	auto &state = (AlpCompressState<T> &)state_p;
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T>
+struct AlpScanState : public SegmentScanState {
+public:
+	explicit AlpScanState(ColumnSegment &segment) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		auto dataptr = handle.Ptr();
+		current_group_ptr = dataptr + segment.GetBlockOffset() + BitpackingPrimitives::BITPACKING_HEADER_SIZE;
+
+		// load offset to the group metadata pointer
+		auto metadata_offset = Load<idx_t>(dataptr + segment.GetBlockOffset());
+		metadata_ptr = dataptr + segment.GetBlockOffset() + metadata_offset;
+
+		// load the metadata of the first group
+		LoadCurrentMetaData();
+	}
+
+	BufferHandle handle;
+
+	int64_t digit_buffer[ALP_GROUP_SIZE];
+	T decompression_buffer[ALP_GROUP_SIZE];
+	//! Whether or not the current group has been decoded into the decompression buffer
+	bool group_decoded = false;
+
+	idx_t position_in_group = 0;
+	data_ptr_t current_group_ptr;
+	data_ptr_t metadata_ptr;
+	bitpacking_width_t current_width;
+	uint8_t current_exponent;
+	uint16_t current_exception_count;
+	int64_t current_frame_of_reference;
+
+public:
+	//! Loads the current group header, and sets pointer to next header
+	void LoadCurrentMetaData() {
+		D_ASSERT(metadata_ptr > handle.Ptr() && metadata_ptr < handle.Ptr() + Storage::BLOCK_SIZE);
+		current_width = Load<bitpacking_width_t>(metadata_ptr);
+		metadata_ptr -= sizeof(uint8_t);
+		current_exponent = Load<uint8_t>(metadata_ptr);
+		metadata_ptr -= sizeof(uint16_t);
+		current_exception_count = Load<uint16_t>(metadata_ptr);
+		metadata_ptr -= sizeof(int64_t);
+		current_frame_of_reference = Load<int64_t>(metadata_ptr);
+		metadata_ptr -= sizeof(bitpacking_width_t);
+		group_decoded = false;
+	}
+
+	void LoadNextGroup() {
+		position_in_group = 0;
+		current_group_ptr += (current_width * ALP_GROUP_SIZE) / 8 + Alp<T>::ExceptionSize(current_exception_count);
+		LoadCurrentMetaData();
+	}
+
+	//! Decodes the entire current group into dst
+	void DecodeGroup(T *dst) {
+		//! Because FOR offsets all our digits to be 0 or above, we can always skip sign extension here
+		BitpackingPrimitives::UnPackBuffer<int64_t>((data_ptr_t)digit_buffer, current_group_ptr, ALP_GROUP_SIZE,
+		                                            current_width, true);
+		auto frame_of_reference = current_frame_of_reference;
+		auto factor = T(ALP_FACTORS[current_exponent]);
+		for (idx_t i = 0; i < ALP_GROUP_SIZE; i++) {
+			dst[i] = T(digit_buffer[i] + frame_of_reference) / factor;
+		}
+		// patch the exceptions
+		auto exception_ptr = current_group_ptr + (current_width * ALP_GROUP_SIZE) / 8;
+		auto value_ptr = exception_ptr + current_exception_count * sizeof(uint16_t);
+		for (idx_t i = 0; i < current_exception_count; i++) {
+			auto position = Load<uint16_t>(exception_ptr + i * sizeof(uint16_t));
+			dst[position] = Load<T>(value_ptr + i * sizeof(T));
+		}
+	}
+
+	void Scan(T *dst, idx_t count) {
+		idx_t scanned = 0;
+		while (scanned < count) {
+			// Exhausted this group, move pointers to next group and load metadata for next group.
+			if (position_in_group >= ALP_GROUP_SIZE) {
+				LoadNextGroup();
+			}
+			idx_t to_scan = MinValue<idx_t>(count - scanned, ALP_GROUP_SIZE - position_in_group);
+			if (to_scan == ALP_GROUP_SIZE) {
+				// Decode directly into the result
+				DecodeGroup(dst + scanned);
+			} else {
+				if (!group_decoded) {
+					DecodeGroup(decompression_buffer);
+					group_decoded = true;
+				}
+				memcpy(dst + scanned, decompression_buffer + position_in_group, to_scan * sizeof(T));
+			}
+			scanned += to_scan;
+			position_in_group += to_scan;
+		}
+	}
+
+	void Skip(ColumnSegment &segment, idx_t skip_count) {
+		while (skip_count > 0) {
+			if (position_in_group >= ALP_GROUP_SIZE) {
+				LoadNextGroup();
+			}
+			auto skipping = MinValue<idx_t>(skip_count, ALP_GROUP_SIZE - position_in_group);
+			position_in_group += skipping;
+			skip_count -= skipping;
+		}
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> AlpInitScan(ColumnSegment &segment) {
+	auto result = make_unique<AlpScanState<T>>(segment);
+	return move(result);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+template <class T>
+void AlpScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                    idx_t result_offset) {
+	auto &scan_state = (AlpScanState<T> &)*state.scan_state;
+
+	T *result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	scan_state.Scan(result_data + result_offset, scan_count);
+}
+
+template <class T>
+void AlpScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	AlpScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void AlpFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
+	AlpScanState<T> scan_state(segment);
+	scan_state.Skip(segment, row_id);
+	auto result_data = FlatVector::GetData<T>(result);
+	scan_state.Scan(result_data + result_idx, 1);
+}
+
+template <class T>
+void AlpSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = (AlpScanState<T> &)*state.scan_state;
+	scan_state.Skip(segment, skip_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T>
+CompressionFunction GetAlpFunction(PhysicalType data_type) {
+	return CompressionFunction(CompressionType::COMPRESSION_ALP, data_type, AlpInitAnalyze<T>, AlpAnalyze<T>,
+	                           AlpFinalAnalyze<T>, AlpInitCompression<T>, AlpCompress<T>, AlpFinalizeCompress<T>,
+	                           AlpInitScan<T>, AlpScan<T>, AlpScanPartial<T>, AlpFetchRow<T>, AlpSkip<T>);
+}
+
+CompressionFunction AlpCompressionFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::FLOAT:
+		return GetAlpFunction<float>(type);
+	case PhysicalType::DOUBLE:
+		return GetAlpFunction<double>(type);
+	default:
+		throw InternalException("Unsupported type for ALP");
+	}
+}
+
+bool AlpCompressionFun::TypeIsSupported(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -169,7 +169,7 @@ public:
 		auto &type = checkpointer.GetType();
 		auto &config = DBConfig::GetConfig(db);
 		function = config.GetCompressionFunction(CompressionType::COMPRESSION_BITPACKING, type.InternalType());
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetRowStart());
 
 		state.data_ptr = (void *)this;
 	}
@@ -0,0 +1,664 @@
+#include "duckdb/common/bitpacking.hpp"
+
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/types/null_value.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/common/operator/subtract.hpp"
+
+namespace duckdb {
+
+// Delta-FOR compression stores the differences between consecutive values of a group, bitpacked relative to the
+// smallest difference of that group. Monotone columns (auto-increment keys, event timestamps) have small and similar
+// differences, so they pack into far fewer bits than their frame-of-reference bitpacked values would.
+//
+// Every group stores its metadata (bit width, frame of reference of the deltas and the first value of the group) at
+// the end of the segment, growing downwards, in the same layout as the bitpacking compression.
+//
+// The offsets of a LIST column are contiguous, so they are stored as the (monotone) end offset of every list: the
+// deltas that are bitpacked are the list lengths. The start offset of the first list of a segment is stored in the
+// segment header, right after the offset of the metadata.
+static constexpr const idx_t DELTA_FOR_GROUP_SIZE = 1024;
+
+static idx_t DeltaForHeaderSize(PhysicalType type) {
+	return BitpackingPrimitives::BITPACKING_HEADER_SIZE + (type == PhysicalType::LIST ? sizeof(uint64_t) : 0);
+}
+
+struct EmptyDeltaForWriter {
+	template <class T>
+	static void Operation(T *deltas, bool *validity, bitpacking_width_t width, T frame_of_reference, T first_value,
+	                      idx_t count, void *data_ptr) {
+	}
+};
+
+template <class T>
+struct DeltaForState {
+public:
+	DeltaForState() : compression_buffer_idx(0), total_size(0), data_ptr(nullptr) {
+		ResetGroup();
+	}
+
+	T compression_buffer[DELTA_FOR_GROUP_SIZE];
+	bool compression_buffer_validity[DELTA_FOR_GROUP_SIZE];
+	idx_t compression_buffer_idx;
+	idx_t total_size;
+	void *data_ptr;
+
+	//! The last valid value that was added to the current group
+	bool last_value_set;
+	T last_value;
+
+	bool min_max_set;
+	T minimum_delta;
+	T maximum_delta;
+
+public:
+	void ResetGroup() {
+		last_value_set = false;
+		last_value = 0;
+		min_max_set = false;
+		//! We set these to 0, in case the group has no deltas, in which case the min and max will never be set.
+		minimum_delta = 0;
+		maximum_delta = 0;
+	}
+
+	bool TryUpdateMinMax(T delta) {
+		bool updated = false;
+		if (!min_max_set || delta < minimum_delta) {
+			minimum_delta = delta;
+			updated = true;
+		}
+		if (!min_max_set || delta > maximum_delta) {
+			maximum_delta = delta;
+			updated = true;
+		}
+		min_max_set = min_max_set || updated;
+		//! Only when either of the values are updated, do we need to test the overflow
+		if (updated) {
+			T ignore;
+			return TrySubtractOperator::Operation(maximum_delta, minimum_delta, ignore);
+		}
+		return true;
+	}
+
+	template <class OP, class T_U = typename std::make_unsigned<T>::type>
+	void Flush() {
+		if (compression_buffer_idx == 0) {
+			return;
+		}
+		// NULL values take the value of the preceding valid value (or the first valid value for leading NULLs)
+		// so they are encoded as a delta of zero
+		idx_t first_valid = 0;
+		while (first_valid < compression_buffer_idx && !compression_buffer_validity[first_valid]) {
+			first_valid++;
+		}
+		T previous = first_valid < compression_buffer_idx ? compression_buffer[first_valid] : 0;
+		for (idx_t i = 0; i < compression_buffer_idx; i++) {
+			if (compression_buffer_validity[i]) {
+				previous = compression_buffer[i];
+			} else {
+				compression_buffer[i] = previous;
+			}
+		}
+
+		// Replace the values by their deltas, offset by the smallest delta so that they are all positive
+		T first_value = compression_buffer[0];
+		T frame_of_reference = minimum_delta;
+		for (idx_t i = compression_buffer_idx - 1; i > 0; i--) {
+			compression_buffer[i] = compression_buffer[i] - compression_buffer[i - 1] - frame_of_reference;
+		}
+		compression_buffer[0] = 0;
+
+		T_U adjusted_maximum = T_U(maximum_delta - frame_of_reference);
+		bitpacking_width_t width = BitpackingPrimitives::MinimumBitWidth<T_U>((T_U)0, adjusted_maximum);
+		OP::template Operation<T>(compression_buffer, compression_buffer_validity, width, frame_of_reference,
+		                          first_value, compression_buffer_idx, data_ptr);
+		total_size += (DELTA_FOR_GROUP_SIZE * width) / 8 + sizeof(bitpacking_width_t) + 2 * sizeof(T);
+		compression_buffer_idx = 0;
+		ResetGroup();
+	}
+
+	template <class OP = EmptyDeltaForWriter>
+	bool Update(T *data, ValidityMask &validity, idx_t idx) {
+		if (validity.RowIsValid(idx)) {
+			auto value = data[idx];
+			if (last_value_set) {
+				T delta;
+				if (!TrySubtractOperator::Operation(value, last_value, delta) || !TryUpdateMinMax(delta)) {
+					return false;
+				}
+			}
+			last_value = value;
+			last_value_set = true;
+			compression_buffer_validity[compression_buffer_idx] = true;
+			compression_buffer[compression_buffer_idx++] = value;
+		} else {
+			// NULL values are encoded as a zero delta
+			if (!TryUpdateMinMax(0)) {
+				return false;
+			}
+			compression_buffer_validity[compression_buffer_idx] = false;
+			compression_buffer[compression_buffer_idx++] = 0;
+		}
+
+		if (compression_buffer_idx == DELTA_FOR_GROUP_SIZE) {
+			Flush<OP>();
+		}
+		return true;
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct DeltaForAnalyzeState : public AnalyzeState {
+	DeltaForState<T> state;
+};
+
+template <class T>
+unique_ptr<AnalyzeState> DeltaForInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_unique<DeltaForAnalyzeState<T>>();
+}
+
+template <class T>
+bool DeltaForAnalyze(AnalyzeState &state, Vector &input, idx_t count) {
+	auto &analyze_state = (DeltaForAnalyzeState<T> &)state;
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = (T *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!analyze_state.state.template Update<EmptyDeltaForWriter>(data, vdata.validity, idx)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <class T>
+idx_t DeltaForFinalAnalyze(AnalyzeState &state) {
+	auto &delta_for_state = (DeltaForAnalyzeState<T> &)state;
+	delta_for_state.state.template Flush<EmptyDeltaForWriter>();
+	return delta_for_state.state.total_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T>
+struct DeltaForCompressState : public CompressionState {
+public:
+	explicit DeltaForCompressState(ColumnDataCheckpointer &checkpointer) : checkpointer(checkpointer) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto &config = DBConfig::GetConfig(db);
+		function = config.GetCompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA, type.InternalType());
+		list_offsets = type.InternalType() == PhysicalType::LIST;
+		CreateEmptySegment(checkpointer.GetRowStart());
+
+		state.data_ptr = (void *)this;
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction *function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	// Ptr to next free spot in segment;
+	data_ptr_t data_ptr;
+	// Ptr to next free spot for storing the group metadata (growing downwards).
+	data_ptr_t metadata_ptr;
+
+	DeltaForState<T> state;
+
+	//! Whether the values are the end offsets of the lists of a LIST column
+	bool list_offsets;
+	//! Whether the start offset of the first list has been set
+	bool list_offset_set = false;
+	//! The start offset of the next list that is written to a segment
+	uint64_t next_list_offset = 0;
+	//! The start offset of the first list of the current segment
+	uint64_t segment_list_offset = 0;
+
+public:
+	struct DeltaForWriter {
+		template <class VALUE_TYPE>
+		static void Operation(VALUE_TYPE *deltas, bool *validity, bitpacking_width_t width,
+		                      VALUE_TYPE frame_of_reference, VALUE_TYPE first_value, idx_t count, void *data_ptr) {
+			auto state = (DeltaForCompressState<T> *)data_ptr;
+			auto total_bytes_needed = (width * DELTA_FOR_GROUP_SIZE) / 8;
+			total_bytes_needed += sizeof(bitpacking_width_t);
+			total_bytes_needed += 2 * sizeof(VALUE_TYPE);
+
+			if (state->RemainingSize() < total_bytes_needed) {
+				// Segment is full
+				auto row_start = state->current_segment->start + state->current_segment->count;
+				state->FlushSegment();
+				state->CreateEmptySegment(row_start);
+			}
+
+			VALUE_TYPE value = first_value;
+			for (idx_t i = 0; i < count; i++) {
+				if (i > 0) {
+					value += deltas[i] + frame_of_reference;
+				}
+				if (validity[i] && !state->list_offsets) {
+					NumericStatistics::Update<T>(state->current_segment->stats, value);
+				}
+			}
+			if (state->list_offsets) {
+				if (state->current_segment->count == 0) {
+					state->segment_list_offset = state->next_list_offset;
+				}
+				state->next_list_offset = (uint64_t)value;
+			}
+
+			state->WriteValues(deltas, width, frame_of_reference, first_value, count);
+		}
+	};
+
+	// Space remaining between the metadata_ptr growing down and data ptr growing up
+	idx_t RemainingSize() {
+		return metadata_ptr - data_ptr;
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto compressed_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		compressed_segment->function = function;
+		current_segment = move(compressed_segment);
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + DeltaForHeaderSize(type.InternalType());
+		metadata_ptr = handle.Ptr() + Storage::BLOCK_SIZE - sizeof(bitpacking_width_t);
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = (T *)vdata.data;
+
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			state.template Update<DeltaForCompressState<T>::DeltaForWriter>(data, vdata.validity, idx);
+		}
+	}
+
+	void WriteValues(T *deltas, bitpacking_width_t width, T frame_of_reference, T first_value, idx_t count) {
+		BitpackingPrimitives::PackBuffer<T, false>(data_ptr, deltas, count, width);
+		data_ptr += (DELTA_FOR_GROUP_SIZE * width) / 8;
+
+		Store<bitpacking_width_t>(width, metadata_ptr);
+		metadata_ptr -= sizeof(T);
+		Store<T>(frame_of_reference, metadata_ptr);
+		metadata_ptr -= sizeof(T);
+		Store<T>(first_value, metadata_ptr);
+		metadata_ptr -= sizeof(bitpacking_width_t);
+
+		current_segment->count += count;
+	}
+
+	void FlushSegment() {
+		auto &state = checkpointer.GetCheckpointState();
+		auto dataptr = handle.Ptr();
+
+		// Compact the segment by moving the metadata next to the data.
+		idx_t metadata_offset = data_ptr - dataptr;
+		D_ASSERT(ValueIsAligned(metadata_offset));
+		idx_t metadata_size = dataptr + Storage::BLOCK_SIZE - metadata_ptr - 1;
+		idx_t total_segment_size = metadata_offset + metadata_size;
+		memmove(dataptr + metadata_offset, metadata_ptr + 1, metadata_size);
+
+		// Store the offset of the metadata of the first group (which is at the highest address).
+		Store<idx_t>(metadata_offset + metadata_size - 1, dataptr);
+		if (list_offsets) {
+			Store<uint64_t>(segment_list_offset, dataptr + BitpackingPrimitives::BITPACKING_HEADER_SIZE);
+		}
+		handle.Destroy();
+
+		state.FlushSegment(move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		state.template Flush<DeltaForCompressState<T>::DeltaForWriter>();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T>
+unique_ptr<CompressionState> DeltaForInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                     unique_ptr<AnalyzeState> state) {
+	return make_unique<DeltaForCompressState<T>>(checkpointer);
+}
+
+template <class T>
+void DeltaForCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = (DeltaForCompressState<T> &)state_p;
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T>
+void DeltaForFinalizeCompress(CompressionState &state_p) {
+	auto &state = (DeltaForCompressState<T> &)state_p;
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T>
+struct DeltaForScanState : public SegmentScanState {
+public:
+	explicit DeltaForScanState(ColumnSegment &segment) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		auto dataptr = handle.Ptr();
+		auto physical_type = segment.type.InternalType();
+		current_group_ptr = dataptr + segment.GetBlockOffset() + DeltaForHeaderSize(physical_type);
+
+		// load offset to the group metadata pointer
+		auto metadata_offset = Load<idx_t>(dataptr + segment.GetBlockOffset());
+		metadata_ptr = dataptr + segment.GetBlockOffset() + metadata_offset;
+		if (physical_type == PhysicalType::LIST) {
+			list_offset =
+			    Load<uint64_t>(dataptr + segment.GetBlockOffset() + BitpackingPrimitives::BITPACKING_HEADER_SIZE);
+		}
+
+		// load the metadata of the first group
+		LoadCurrentMetaData();
+	}
+
+	BufferHandle handle;
+
+	T decompression_buffer[BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE];
+	T skip_buffer[BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE];
+
+	idx_t position_in_group = 0;
+	data_ptr_t current_group_ptr;
+	data_ptr_t metadata_ptr;
+	bitpacking_width_t current_width;
+	T current_frame_of_reference;
+	T current_first_value;
+	//! The last value that was decoded from the current group
+	T current_value;
+	//! The start offset of the next list (LIST only)
+	uint64_t list_offset = 0;
+
+public:
+	//! Loads the current group header, and sets pointer to next header
+	void LoadCurrentMetaData() {
+		D_ASSERT(metadata_ptr > handle.Ptr() && metadata_ptr < handle.Ptr() + Storage::BLOCK_SIZE);
+		current_width = Load<bitpacking_width_t>(metadata_ptr);
+		metadata_ptr -= sizeof(T);
+		current_frame_of_reference = Load<T>(metadata_ptr);
+		metadata_ptr -= sizeof(T);
+		current_first_value = Load<T>(metadata_ptr);
+		metadata_ptr -= sizeof(bitpacking_width_t);
+		current_value = current_first_value;
+	}
+
+	void LoadNextGroup() {
+		position_in_group = 0;
+		current_group_ptr += (current_width * DELTA_FOR_GROUP_SIZE) / 8;
+		LoadCurrentMetaData();
+	}
+
+	//! Decodes the next count values into dst by summing up their deltas
+	void Decode(T *dst, idx_t count) {
+		//! Because FOR offsets all our deltas to be 0 or above, we can always skip sign extension here
+		bool skip_sign_extend = true;
+
+		idx_t decoded = 0;
+		while (decoded < count) {
+			// Exhausted this group, move pointers to next group and load metadata for next group.
+			if (position_in_group >= DELTA_FOR_GROUP_SIZE) {
+				LoadNextGroup();
+			}
+			idx_t offset_in_compression_group =
+			    position_in_group % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+			idx_t to_decode = MinValue<idx_t>(count - decoded, BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE -
+			                                                       offset_in_compression_group);
+
+			// Calculate start of compression algorithm group
+			data_ptr_t decompression_group_start_pointer =
+			    current_group_ptr + (position_in_group - offset_in_compression_group) * current_width / 8;
+			BitpackingPrimitives::UnPackBlock<T>((data_ptr_t)decompression_buffer, decompression_group_start_pointer,
+			                                     current_width, skip_sign_extend);
+
+			auto deltas = decompression_buffer + offset_in_compression_group;
+			auto target = dst + decoded;
+			idx_t i = 0;
+			if (position_in_group == 0) {
+				// The first value of a group is stored as-is
+				current_value = current_first_value;
+				target[0] = current_value;
+				i = 1;
+			}
+			for (; i < to_decode; i++) {
+				current_value += deltas[i] + current_frame_of_reference;
+				target[i] = current_value;
+			}
+			decoded += to_decode;
+			position_in_group += to_decode;
+		}
+	}
+
+	void Skip(ColumnSegment &segment, idx_t skip_count) {
+		while (skip_count > 0) {
+			if (position_in_group >= DELTA_FOR_GROUP_SIZE) {
+				LoadNextGroup();
+			}
+			if (position_in_group == 0 && skip_count >= DELTA_FOR_GROUP_SIZE) {
+				// Skip the entire group without decoding it
+				position_in_group = DELTA_FOR_GROUP_SIZE;
+				skip_count -= DELTA_FOR_GROUP_SIZE;
+				continue;
+			}
+			// The running value depends on all deltas before it: decode the skipped values
+			auto to_skip = MinValue<idx_t>(skip_count, BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE);
+			Decode(skip_buffer, to_skip);
+			skip_count -= to_skip;
+		}
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> DeltaForInitScan(ColumnSegment &segment) {
+	auto result = make_unique<DeltaForScanState<T>>(segment);
+	return move(result);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+template <class T>
+void DeltaForScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                         idx_t result_offset) {
+	auto &scan_state = (DeltaForScanState<T> &)*state.scan_state;
+
+	T *result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	scan_state.Decode(result_data + result_offset, scan_count);
+}
+
+template <class T>
+void DeltaForScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	DeltaForScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void DeltaForFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                      idx_t result_idx) {
+	DeltaForScanState<T> scan_state(segment);
+	scan_state.Skip(segment, row_id);
+	auto result_data = FlatVector::GetData<T>(result);
+	scan_state.Decode(result_data + result_idx, 1);
+}
+
+template <class T>
+void DeltaForSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = (DeltaForScanState<T> &)*state.scan_state;
+	scan_state.Skip(segment, skip_count);
+}
+
+//===--------------------------------------------------------------------===//
+// List offsets
+//===--------------------------------------------------------------------===//
+//! Converts the list entries to their end offsets, and returns the start offset of the first list
+static uint64_t ListEntriesToEnds(Vector &input, idx_t count, uint64_t ends[]) {
+	D_ASSERT(count > 0 && count <= STANDARD_VECTOR_SIZE);
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto entries = (list_entry_t *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto &entry = entries[vdata.sel->get_index(i)];
+		ends[i] = entry.offset + entry.length;
+	}
+	return entries[vdata.sel->get_index(0)].offset;
+}
+
+bool DeltaForListAnalyze(AnalyzeState &state, Vector &input, idx_t count) {
+	auto &analyze_state = (DeltaForAnalyzeState<uint64_t> &)state;
+	uint64_t ends[STANDARD_VECTOR_SIZE];
+	ListEntriesToEnds(input, count, ends);
+	// NULL lists are stored as empty lists, their validity is stored separately
+	ValidityMask validity;
+	for (idx_t i = 0; i < count; i++) {
+		if (!analyze_state.state.template Update<EmptyDeltaForWriter>(ends, validity, i)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void DeltaForListCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = (DeltaForCompressState<uint64_t> &)state_p;
+	uint64_t ends[STANDARD_VECTOR_SIZE];
+	auto start_offset = ListEntriesToEnds(scan_vector, count, ends);
+	if (!state.list_offset_set) {
+		state.next_list_offset = start_offset;
+		state.list_offset_set = true;
+	}
+	UnifiedVectorFormat vdata;
+	vdata.sel = FlatVector::IncrementalSelectionVector();
+	vdata.data = (data_ptr_t)ends;
+	state.Append(vdata, count);
+}
+
+void DeltaForListScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                             idx_t result_offset) {
+	D_ASSERT(scan_count <= STANDARD_VECTOR_SIZE);
+	auto &scan_state = (DeltaForScanState<uint64_t> &)*state.scan_state;
+
+	auto result_data = FlatVector::GetData<list_entry_t>(result) + result_offset;
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	uint64_t ends[STANDARD_VECTOR_SIZE];
+	scan_state.Decode(ends, scan_count);
+	for (idx_t i = 0; i < scan_count; i++) {
+		result_data[i].offset = scan_state.list_offset;
+		result_data[i].length = ends[i] - scan_state.list_offset;
+		scan_state.list_offset = ends[i];
+	}
+}
+
+void DeltaForListScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	DeltaForListScanPartial(segment, state, scan_count, result, 0);
+}
+
+static void DeltaForListSkipRows(DeltaForScanState<uint64_t> &scan_state, idx_t skip_count) {
+	// the start offset of the next list is the end offset of the last skipped list: decode all skipped lists
+	while (skip_count > 0) {
+		auto to_skip = MinValue<idx_t>(skip_count, BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE);
+		scan_state.Decode(scan_state.skip_buffer, to_skip);
+		scan_state.list_offset = scan_state.skip_buffer[to_skip - 1];
+		skip_count -= to_skip;
+	}
+}
+
+void DeltaForListFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                          idx_t result_idx) {
+	DeltaForScanState<uint64_t> scan_state(segment);
+	DeltaForListSkipRows(scan_state, row_id);
+	uint64_t end;
+	scan_state.Decode(&end, 1);
+	auto &entry = FlatVector::GetData<list_entry_t>(result)[result_idx];
+	entry.offset = scan_state.list_offset;
+	entry.length = end - scan_state.list_offset;
+}
+
+void DeltaForListSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = (DeltaForScanState<uint64_t> &)*state.scan_state;
+	DeltaForListSkipRows(scan_state, skip_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T>
+CompressionFunction GetDeltaForFunction(PhysicalType data_type) {
+	return CompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA, data_type, DeltaForInitAnalyze<T>,
+	                           DeltaForAnalyze<T>, DeltaForFinalAnalyze<T>, DeltaForInitCompression<T>,
+	                           DeltaForCompress<T>, DeltaForFinalizeCompress<T>, DeltaForInitScan<T>, DeltaForScan<T>,
+	                           DeltaForScanPartial<T>, DeltaForFetchRow<T>, DeltaForSkip<T>);
+}
+
+CompressionFunction DeltaForFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+		return GetDeltaForFunction<int8_t>(type);
+	case PhysicalType::INT16:
+		return GetDeltaForFunction<int16_t>(type);
+	case PhysicalType::INT32:
+		return GetDeltaForFunction<int32_t>(type);
+	case PhysicalType::INT64:
+		return GetDeltaForFunction<int64_t>(type);
+	case PhysicalType::UINT8:
+		return GetDeltaForFunction<uint8_t>(type);
+	case PhysicalType::UINT16:
+		return GetDeltaForFunction<uint16_t>(type);
+	case PhysicalType::UINT32:
+		return GetDeltaForFunction<uint32_t>(type);
+	case PhysicalType::UINT64:
+		return GetDeltaForFunction<uint64_t>(type);
+	case PhysicalType::LIST:
+		return CompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA, type, DeltaForInitAnalyze<uint64_t>,
+		                           DeltaForListAnalyze, DeltaForFinalAnalyze<uint64_t>,
+		                           DeltaForInitCompression<uint64_t>, DeltaForListCompress,
+		                           DeltaForFinalizeCompress<uint64_t>, DeltaForInitScan<uint64_t>, DeltaForListScan,
+		                           DeltaForListScanPartial, DeltaForListFetchRow, DeltaForListSkip);
+	default:
+		throw InternalException("Unsupported type for Delta-FOR");
+	}
+}
+
+bool DeltaForFun::TypeIsSupported(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::LIST:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -105,6 +105,8 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringSelect(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -135,7 +137,7 @@ struct DictionaryCompressionCompressState : public DictionaryCompressionState {
 		auto &db = checkpointer.GetDatabase();
 		auto &config = DBConfig::GetConfig(db);
 		function = config.GetCompressionFunction(CompressionType::COMPRESSION_DICTIONARY, PhysicalType::VARCHAR);
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetRowStart());
 	}
 
 	ColumnDataCheckpointer &checkpointer;
@@ -431,9 +433,13 @@ void DictionaryCompressionStorage::FinalizeCompress(CompressionState &state_p) {
 struct CompressedStringScanState : public StringScanState {
 	BufferHandle handle;
 	buffer_ptr<Vector> dictionary;
+	idx_t dictionary_size;
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	//! The filter that was last evaluated on the dictionary, and for every dictionary entry whether it passed it
+	const TableFilter *dictionary_filter = nullptr;
+	unique_ptr<bool[]> dictionary_filter_result;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -453,6 +459,7 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = (uint32_t *)(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -460,6 +467,8 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 		uint16_t str_len = GetStringLength(index_buffer_ptr, i);
 		dict_child_data[i] = FetchStringFromDict(segment, dict, baseptr, index_buffer_ptr[i], str_len);
 	}
+	// the dictionary strings reference the block directly: the dictionary keeps it pinned while it is referenced
+	StringVector::AddHandle(*state->dictionary, buffer_manager.Pin(segment.block));
 
 	return move(state);
 }
@@ -484,25 +493,23 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 	auto base_data = (data_ptr_t)(baseptr + DICTIONARY_HEADER_SIZE);
 	auto result_data = FlatVector::GetData<string_t>(result);
 
-	if (!ALLOW_DICT_VECTORS || scan_count != STANDARD_VECTOR_SIZE ||
-	    start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE != 0) {
-		// Emit regular vector
-
-		// Handling non-bitpacking-group-aligned start values;
-		idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+	// Handling non-bitpacking-group-aligned start values;
+	idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
 
-		// We will scan in blocks of BITPACKING_ALGORITHM_GROUP_SIZE, so we may scan some extra values.
-		idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count + start_offset);
+	// We will scan in blocks of BITPACKING_ALGORITHM_GROUP_SIZE, so we may scan some extra values.
+	idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count + start_offset);
 
-		// Create a decompression buffer of sufficient size if we don't already have one.
-		if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
-			scan_state.sel_vec_size = decompress_count;
-			scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
-		}
+	// Create a decompression buffer of sufficient size if we don't already have one.
+	if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
+		scan_state.sel_vec_size = decompress_count;
+		scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+	}
 
-		data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
-		sel_t *sel_vec_ptr = scan_state.sel_vec->data();
+	data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
+	sel_t *sel_vec_ptr = scan_state.sel_vec->data();
 
+	if (!ALLOW_DICT_VECTORS) {
+		// Emit regular vector
 		BitpackingPrimitives::UnPackBuffer<sel_t>((data_ptr_t)sel_vec_ptr, src, decompress_count,
 		                                          scan_state.current_width);
 
@@ -513,26 +520,20 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 			uint16_t str_len = GetStringLength(index_buffer_ptr, string_number);
 			result_data[result_offset + i] = FetchStringFromDict(segment, dict, baseptr, dict_offset, str_len);
 		}
+		// the strings reference the block directly: keep it pinned for as long as the result vector lives
+		StringVector::AddHeapReference(result, *scan_state.dictionary);
 
 	} else {
-		D_ASSERT(start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE == 0);
-		D_ASSERT(scan_count == STANDARD_VECTOR_SIZE);
+		// Scanning an entire vector from this segment, emitting a dict vector
 		D_ASSERT(result_offset == 0);
 
-		idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count);
-
-		// Create a selection vector of sufficient size if we don't already have one.
-		if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
-			scan_state.sel_vec_size = decompress_count;
-			scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+		BitpackingPrimitives::UnPackBuffer<sel_t>((data_ptr_t)sel_vec_ptr, src, decompress_count,
+		                                          scan_state.current_width);
+		if (start_offset != 0) {
+			// shift the selection so that it starts at the first value of the scan
+			memmove(sel_vec_ptr, sel_vec_ptr + start_offset, scan_count * sizeof(sel_t));
 		}
 
-		// Scanning 1024 values, emitting a dict vector
-		data_ptr_t dst = (data_ptr_t)(scan_state.sel_vec->data());
-		data_ptr_t src = (data_ptr_t)&base_data[(start * scan_state.current_width) / 8];
-
-		BitpackingPrimitives::UnPackBuffer<sel_t>(dst, src, scan_count, scan_state.current_width);
-
 		result.Slice(*(scan_state.dictionary), *scan_state.sel_vec, scan_count);
 	}
 }
@@ -542,6 +543,28 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Select
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringSelect(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                                Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+                                                const TableFilter &filter) {
+	auto &scan_state = (CompressedStringScanState &)*state.scan_state;
+	// scanning an entire vector emits a dictionary vector, the selection holds the dictionary entry of every row
+	StringScanPartial<true>(segment, state, scan_count, result, 0);
+	D_ASSERT(result.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+
+	// the filter is evaluated once per dictionary entry, and reused for all vectors of the segment
+	if (scan_state.dictionary_filter != &filter) {
+		scan_state.dictionary_filter_result = unique_ptr<bool[]>(new bool[scan_state.dictionary_size]);
+		ColumnSegment::FilterEntries(*scan_state.dictionary, scan_state.dictionary_size, filter,
+		                             scan_state.dictionary_filter_result.get());
+		scan_state.dictionary_filter = &filter;
+	}
+	ColumnSegment::SelectEntries(sel, approved_tuple_count, scan_state.sel_vec->data(),
+	                             scan_state.dictionary_filter_result.get());
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -638,13 +661,15 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	auto function = CompressionFunction(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	function.select = DictionaryCompressionStorage::StringSelect;
+	return function;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(PhysicalType type) {
@@ -55,7 +55,7 @@ struct UncompressedCompressState : public CompressionState {
 
 UncompressedCompressState::UncompressedCompressState(ColumnDataCheckpointer &checkpointer)
     : checkpointer(checkpointer) {
-	CreateEmptySegment(checkpointer.GetRowGroup().start);
+	CreateEmptySegment(checkpointer.GetRowStart());
 }
 
 void UncompressedCompressState::CreateEmptySegment(idx_t row_start) {
@@ -186,11 +186,36 @@ static unique_ptr<CompressionAppendState> FixedSizeInitAppend(ColumnSegment &seg
 	return make_unique<CompressionAppendState>(move(handle));
 }
 
+//! Updates the statistics with a run of non-NULL values. The min and max are kept in locals (instead of being updated
+//! in the statistics for every value), which the compiler can keep in registers while the values are copied.
+template <class T>
+static void UpdateStatisticsNoNulls(SegmentStatistics &stats, const T *data, idx_t count) {
+	auto &nstats = (NumericStatistics &)*stats.statistics;
+	T min = nstats.min.GetReferenceUnsafe<T>();
+	T max = nstats.max.GetReferenceUnsafe<T>();
+	for (idx_t i = 0; i < count; i++) {
+		NumericStatistics::UpdateValue<T>(data[i], min, max);
+	}
+	nstats.min.GetReferenceUnsafe<T>() = min;
+	nstats.max.GetReferenceUnsafe<T>() = max;
+}
+
+template <>
+void UpdateStatisticsNoNulls<interval_t>(SegmentStatistics &stats, const interval_t *data, idx_t count) {
+	// intervals do not have min/max statistics
+}
+
 template <class T>
 static void AppendLoop(SegmentStatistics &stats, data_ptr_t target, idx_t target_offset, UnifiedVectorFormat &adata,
                        idx_t offset, idx_t count) {
 	auto sdata = (T *)adata.data;
 	auto tdata = (T *)target;
+	if (adata.validity.AllValid() && !adata.sel->data()) {
+		// flat vector without NULL values (the common case when bulk loading a table): copy the values as a whole
+		memcpy(tdata + target_offset, sdata + offset, count * sizeof(T));
+		UpdateStatisticsNoNulls<T>(stats, sdata + offset, count);
+		return;
+	}
 	if (!adata.validity.AllValid()) {
 		for (idx_t i = 0; i < count; i++) {
 			auto source_idx = adata.sel->get_index(offset + i);
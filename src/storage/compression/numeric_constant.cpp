@@ -76,6 +76,24 @@ void ConstantScanFunction(ColumnSegment &segment, ColumnScanState &state, idx_t
 	result.SetVectorType(VectorType::CONSTANT_VECTOR);
 }
 
+//===--------------------------------------------------------------------===//
+// Select
+//===--------------------------------------------------------------------===//
+template <class T>
+void ConstantSelect(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                    SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter) {
+	ConstantScanFunction<T>(segment, state, scan_count, result);
+
+	// the filter is evaluated once for the entire segment
+	Vector constant(result.GetType(), 1);
+	FlatVector::GetData<T>(constant)[0] = ConstantVector::GetData<T>(result)[0];
+	bool passes;
+	ColumnSegment::FilterEntries(constant, 1, filter, &passes);
+	if (!passes) {
+		approved_tuple_count = 0;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -101,9 +119,12 @@ CompressionFunction ConstantGetFunctionValidity(PhysicalType data_type) {
 
 template <class T>
 CompressionFunction ConstantGetFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
-	                           nullptr, nullptr, ConstantInitScan, ConstantScanFunction<T>, ConstantScanPartial<T>,
-	                           ConstantFetchRow<T>, UncompressedFunctions::EmptySkip);
+	auto function =
+	    CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
+	                        nullptr, nullptr, ConstantInitScan, ConstantScanFunction<T>, ConstantScanPartial<T>,
+	                        ConstantFetchRow<T>, UncompressedFunctions::EmptySkip);
+	function.select = ConstantSelect<T>;
+	return function;
 }
 
 CompressionFunction ConstantFun::GetFunction(PhysicalType data_type) {
@@ -140,7 +140,7 @@ struct RLECompressState : public CompressionState {
 		auto &type = checkpointer.GetType();
 		auto &config = DBConfig::GetConfig(db);
 		function = config.GetCompressionFunction(CompressionType::COMPRESSION_RLE, type.InternalType());
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetRowStart());
 
 		state.dataptr = (void *)this;
 		max_rle_count = MaxRLECount();
@@ -320,8 +320,72 @@ void RLEScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_c
 
 template <class T>
 void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
-	// FIXME: emit constant vector if repetition of single value is >= scan_count
-	RLEScanPartial<T>(segment, state, scan_count, result, 0);
+	auto &scan_state = (RLEScanState<T> &)*state.scan_state;
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = (T *)(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = (rle_count_t *)(data + scan_state.rle_count_offset);
+
+	idx_t run_remaining = index_pointer[scan_state.entry_pos] - scan_state.position_in_entry;
+	if (scan_count > run_remaining) {
+		RLEScanPartial<T>(segment, state, scan_count, result, 0);
+		return;
+	}
+	// the entire vector is part of a single run: emit a constant vector
+	auto result_data = ConstantVector::GetData<T>(result);
+	result_data[0] = data_pointer[scan_state.entry_pos];
+	result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	scan_state.position_in_entry += scan_count;
+	if (scan_state.position_in_entry >= index_pointer[scan_state.entry_pos]) {
+		scan_state.entry_pos++;
+		scan_state.position_in_entry = 0;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Select
+//===--------------------------------------------------------------------===//
+template <class T>
+void RLESelect(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+               idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = (RLEScanState<T> &)*state.scan_state;
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = (T *)(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = (rle_count_t *)(data + scan_state.rle_count_offset);
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	// scan the vector run by run, collecting the value of every run
+	Vector run_values(result.GetType(), scan_count);
+	auto run_data = FlatVector::GetData<T>(run_values);
+	sel_t row_runs[STANDARD_VECTOR_SIZE];
+	idx_t run_count = 0;
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto value = data_pointer[scan_state.entry_pos];
+		idx_t to_scan =
+		    MinValue<idx_t>(scan_count - scanned, index_pointer[scan_state.entry_pos] - scan_state.position_in_entry);
+		for (idx_t i = 0; i < to_scan; i++) {
+			result_data[scanned + i] = value;
+			row_runs[scanned + i] = run_count;
+		}
+		run_data[run_count++] = value;
+		scanned += to_scan;
+		scan_state.position_in_entry += to_scan;
+		if (scan_state.position_in_entry >= index_pointer[scan_state.entry_pos]) {
+			// handled all entries in this RLE value
+			// move to the next entry
+			scan_state.entry_pos++;
+			scan_state.position_in_entry = 0;
+		}
+	}
+
+	// the filter is evaluated once per run
+	bool run_passes[STANDARD_VECTOR_SIZE];
+	ColumnSegment::FilterEntries(run_values, run_count, filter, run_passes);
+	ColumnSegment::SelectEntries(sel, approved_tuple_count, row_runs, run_passes);
 }
 
 //===--------------------------------------------------------------------===//
@@ -343,9 +407,12 @@ void RLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id,
 //===--------------------------------------------------------------------===//
 template <class T>
 CompressionFunction GetRLEFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
-	                           RLEFinalAnalyze<T>, RLEInitCompression<T>, RLECompress<T>, RLEFinalizeCompress<T>,
-	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	auto function = CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
+	                                    RLEFinalAnalyze<T>, RLEInitCompression<T>, RLECompress<T>,
+	                                    RLEFinalizeCompress<T>, RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>,
+	                                    RLEFetchRow<T>, RLESkip<T>);
+	function.select = RLESelect<T>;
+	return function;
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
@@ -64,6 +64,7 @@ unique_ptr<SegmentScanState> UncompressedStringStorage::StringInitScan(ColumnSeg
 	auto result = make_unique<StringScanState>();
 	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
 	result->handle = buffer_manager.Pin(segment.block);
+	result->block_reference = make_buffer<ManagedVectorBuffer>(buffer_manager.Pin(segment.block));
 	return move(result);
 }
 
@@ -90,6 +91,8 @@ void UncompressedStringStorage::StringScanPartial(ColumnSegment &segment, Column
 		    FetchStringFromDict(segment, dict, result, baseptr, base_data[start + i], string_length);
 		previous_offset = base_data[start + i];
 	}
+	// the strings reference the block directly: keep it pinned for as long as the result vector lives
+	StringVector::AddBuffer(result, scan_state.block_reference);
 }
 
 void UncompressedStringStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
@@ -31,7 +31,9 @@ DataTable::DataTable(DatabaseInstance &db, shared_ptr<TableIOManager> table_io_m
 	auto types = GetTypes();
 	this->row_groups =
 	    make_shared<RowGroupCollection>(info, TableIOManager::Get(*this).GetBlockManagerForRowData(), types, 0);
-	if (data && !data->row_groups.empty()) {
+	if (data && data->IsLazy()) {
+		this->row_groups->InitializeLazy(data->table_pointer);
+	} else if (data && !data->row_groups.empty()) {
 		this->row_groups->Initialize(*data);
 	} else {
 		this->row_groups->InitializeEmpty();
@@ -192,7 +194,8 @@ void DataTable::InitializeScanWithOffset(TableScanState &state, const vector<col
 }
 
 idx_t DataTable::MaxThreads(ClientContext &context) {
-	idx_t parallel_scan_vector_count = RowGroup::ROW_GROUP_VECTOR_COUNT;
+	// the tail of a parallel scan is split up into morsels that are smaller than a row group
+	idx_t parallel_scan_vector_count = RowGroupCollection::MIN_MORSEL_VECTOR_COUNT;
 	if (ClientConfig::GetConfig(context).verify_parallelism) {
 		parallel_scan_vector_count = 1;
 	}
@@ -207,6 +210,18 @@ void DataTable::InitializeParallelScan(ClientContext &context, ParallelTableScan
 	local_storage.InitializeParallelScan(this, state.local_state);
 }
 
+idx_t DataTable::SkipParallelScan(ClientContext &context, ParallelTableScanState &state, idx_t count) {
+	auto &transaction = Transaction::GetTransaction(context);
+	auto skipped = row_groups->SkipParallelScan(TransactionData(transaction), state.scan_state, count);
+	auto current_row_group = state.scan_state.current_row_group;
+	if (skipped < count && (!current_row_group || current_row_group->count == 0)) {
+		// all persistent rows were skipped: continue with the transaction-local rows
+		auto &local_storage = LocalStorage::Get(context);
+		skipped += local_storage.SkipParallelScan(this, state.local_state, count - skipped);
+	}
+	return skipped;
+}
+
 bool DataTable::NextParallelScan(ClientContext &context, ParallelTableScanState &state, TableScanState &scan_state) {
 	if (row_groups->NextParallelScan(context, state.scan_state, scan_state.table_state)) {
 		return true;
@@ -248,6 +263,43 @@ void DataTable::Fetch(Transaction &transaction, DataChunk &result, const vector<
 //===--------------------------------------------------------------------===//
 // Append
 //===--------------------------------------------------------------------===//
+ConstraintState::ConstraintState(TableCatalogEntry &table, ClientContext &context) : table(table) {
+	if (table.HasGeneratedColumns()) {
+		auto binder = Binder::CreateBinder(context);
+		physical_index_set_t bound_columns;
+		CheckBinder generated_check_binder(*binder, context, table.name, table.columns, bound_columns);
+		vector<LogicalType> generated_types;
+		for (auto &col : table.columns.Logical()) {
+			if (!col.Generated()) {
+				continue;
+			}
+			D_ASSERT(col.Type().id() != LogicalTypeId::ANY);
+			generated_check_binder.target_type = col.Type();
+			auto to_be_bound_expression = col.GeneratedExpression().Copy();
+			generated_expressions.push_back(generated_check_binder.Bind(to_be_bound_expression));
+			generated_columns.push_back(col.Oid());
+			generated_types.push_back(col.Type());
+		}
+		generated_executor = make_unique<ExpressionExecutor>(context, generated_expressions);
+		generated_chunk.Initialize(Allocator::Get(context), generated_types);
+	}
+	vector<LogicalType> check_types;
+	check_executor = make_unique<ExpressionExecutor>(context);
+	for (auto &constraint : table.bound_constraints) {
+		if (constraint->type == ConstraintType::CHECK) {
+			auto &check = (BoundCheckConstraint &)*constraint;
+			check_executor->AddExpression(*check.expression);
+			check_types.push_back(LogicalType::INTEGER);
+		}
+	}
+	if (!check_types.empty()) {
+		check_chunk.Initialize(Allocator::Get(context), check_types);
+	}
+}
+
+ConstraintState::~ConstraintState() {
+}
+
 static void VerifyNotNullConstraint(TableCatalogEntry &table, Vector &vector, idx_t count, const string &col_name) {
 	if (VectorOperations::HasNull(vector, count)) {
 		throw ConstraintException("NOT NULL constraint failed: %s.%s", table.name, col_name);
@@ -255,14 +307,12 @@ static void VerifyNotNullConstraint(TableCatalogEntry &table, Vector &vector, id
 }
 
 // To avoid throwing an error at SELECT, instead this moves the error detection to INSERT
-static void VerifyGeneratedExpressionSuccess(ClientContext &context, TableCatalogEntry &table, DataChunk &chunk,
-                                             Expression &expr, column_t index) {
+static void VerifyGeneratedExpressionSuccess(TableCatalogEntry &table, ExpressionExecutor &executor, idx_t expr_idx,
+                                             Vector &result, column_t index) {
 	auto &col = table.columns.GetColumn(LogicalIndex(index));
 	D_ASSERT(col.Generated());
-	ExpressionExecutor executor(context, expr);
-	Vector result(col.Type());
 	try {
-		executor.ExecuteExpression(chunk, result);
+		executor.ExecuteExpression(expr_idx, result);
 	} catch (std::exception &ex) {
 
 		throw ConstraintException("Incorrect value for generated column \"%s %s AS (%s)\" : %s", col.Name(),
@@ -270,12 +320,10 @@ static void VerifyGeneratedExpressionSuccess(ClientContext &context, TableCatalo
 	}
 }
 
-static void VerifyCheckConstraint(ClientContext &context, TableCatalogEntry &table, Expression &expr,
-                                  DataChunk &chunk) {
-	ExpressionExecutor executor(context, expr);
-	Vector result(LogicalType::INTEGER);
+static void VerifyCheckConstraint(TableCatalogEntry &table, ExpressionExecutor &executor, idx_t expr_idx,
+                                  Vector &result, DataChunk &chunk) {
 	try {
-		executor.ExecuteExpression(chunk, result);
+		executor.ExecuteExpression(expr_idx, result);
 	} catch (std::exception &ex) {
 		throw ConstraintException("CHECK constraint failed: %s (Error: %s)", table.name, ex.what());
 	} catch (...) { // LCOV_EXCL_START
@@ -293,6 +341,14 @@ static void VerifyCheckConstraint(ClientContext &context, TableCatalogEntry &tab
 	}
 }
 
+static void VerifyCheckConstraint(ClientContext &context, TableCatalogEntry &table, Expression &expr,
+                                  DataChunk &chunk) {
+	ExpressionExecutor executor(context, expr);
+	executor.SetChunk(chunk);
+	Vector result(LogicalType::INTEGER);
+	VerifyCheckConstraint(table, executor, 0, result, chunk);
+}
+
 bool DataTable::IsForeignKeyIndex(const vector<PhysicalIndex> &fk_keys, Index &index, ForeignKeyType fk_type) {
 	if (fk_type == ForeignKeyType::FK_TYPE_PRIMARY_KEY_TABLE ? !index.IsUnique() : !index.IsForeign()) {
 		return false;
@@ -415,21 +471,27 @@ void DataTable::VerifyNewConstraint(ClientContext &context, DataTable &parent, c
 }
 
 void DataTable::VerifyAppendConstraints(TableCatalogEntry &table, ClientContext &context, DataChunk &chunk) {
-	if (table.HasGeneratedColumns()) {
-		auto binder = Binder::CreateBinder(context);
-		physical_index_set_t bound_columns;
-		CheckBinder generated_check_binder(*binder, context, table.name, table.columns, bound_columns);
-		for (auto &col : table.columns.Logical()) {
-			if (!col.Generated()) {
-				continue;
-			}
-			D_ASSERT(col.Type().id() != LogicalTypeId::ANY);
-			generated_check_binder.target_type = col.Type();
-			auto to_be_bound_expression = col.GeneratedExpression().Copy();
-			auto bound_expression = generated_check_binder.Bind(to_be_bound_expression);
-			VerifyGeneratedExpressionSuccess(context, table, chunk, *bound_expression, col.Oid());
+	ConstraintState state(table, context);
+	VerifyAppendConstraints(state, context, chunk);
+}
+
+void DataTable::VerifyAppendConstraints(ConstraintState &state, ClientContext &context, DataChunk &chunk) {
+	auto &table = state.table;
+	if (state.generated_executor) {
+		state.generated_chunk.Reset();
+		state.generated_chunk.SetCardinality(chunk);
+		state.generated_executor->SetChunk(chunk);
+		for (idx_t i = 0; i < state.generated_expressions.size(); i++) {
+			VerifyGeneratedExpressionSuccess(table, *state.generated_executor, i, state.generated_chunk.data[i],
+			                                 state.generated_columns[i]);
 		}
 	}
+	if (state.check_chunk.ColumnCount() > 0) {
+		state.check_chunk.Reset();
+		state.check_chunk.SetCardinality(chunk);
+		state.check_executor->SetChunk(chunk);
+	}
+	idx_t check_idx = 0;
 	for (idx_t i = 0; i < table.bound_constraints.size(); i++) {
 		auto &base_constraint = table.constraints[i];
 		auto &constraint = table.bound_constraints[i];
@@ -442,8 +504,8 @@ void DataTable::VerifyAppendConstraints(TableCatalogEntry &table, ClientContext
 			break;
 		}
 		case ConstraintType::CHECK: {
-			auto &check = *reinterpret_cast<BoundCheckConstraint *>(constraint.get());
-			VerifyCheckConstraint(context, table, *check.expression, chunk);
+			VerifyCheckConstraint(table, *state.check_executor, check_idx, state.check_chunk.data[check_idx], chunk);
+			check_idx++;
 			break;
 		}
 		case ConstraintType::UNIQUE: {
@@ -468,6 +530,36 @@ void DataTable::VerifyAppendConstraints(TableCatalogEntry &table, ClientContext
 	}
 }
 
+void DataTable::FilterUniqueConflicts(ClientContext &context, DataChunk &chunk) {
+	idx_t count = chunk.size();
+	if (count == 0) {
+		return;
+	}
+	vector<string> err_msgs;
+	err_msgs.resize(count);
+	info->indexes.Scan([&](Index &index) {
+		index.VerifyAppend(chunk, err_msgs.data());
+		return false;
+	});
+	auto &local_storage = LocalStorage::Get(context);
+	if (local_storage.Find(this)) {
+		local_storage.GetIndexes(this).Scan([&](Index &index) {
+			index.VerifyAppend(chunk, err_msgs.data());
+			return false;
+		});
+	}
+	SelectionVector sel(count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (err_msgs[i].empty()) {
+			sel.set_index(result_count++, i);
+		}
+	}
+	if (result_count < count) {
+		chunk.Slice(sel, result_count);
+	}
+}
+
 void DataTable::InitializeLocalAppend(LocalAppendState &state, ClientContext &context) {
 	if (!is_root) {
 		throw TransactionException("Transaction conflict: adding entries to a table that has been altered!");
@@ -489,7 +581,10 @@ void DataTable::LocalAppend(LocalAppendState &state, TableCatalogEntry &table, C
 	chunk.Verify();
 
 	// verify any constraints on the new chunk
-	VerifyAppendConstraints(table, context, chunk);
+	if (!state.constraint_state) {
+		state.constraint_state = make_unique<ConstraintState>(table, context);
+	}
+	VerifyAppendConstraints(*state.constraint_state, context, chunk);
 
 	// append to the transaction local data
 	LocalStorage::Append(state, chunk);
@@ -525,6 +620,19 @@ void DataTable::LocalAppend(TableCatalogEntry &table, ClientContext &context, Co
 	table.storage->FinalizeLocalAppend(append_state);
 }
 
+void DataTable::LocalAppend(TableCatalogEntry &table, ClientContext &context,
+                            const std::function<bool(DataChunk &chunk)> &next_chunk) {
+	LocalAppendState append_state;
+	table.storage->InitializeLocalAppend(append_state, context);
+	DataChunk chunk;
+	chunk.Initialize(Allocator::Get(context), table.GetTypes());
+	while (next_chunk(chunk)) {
+		table.storage->LocalAppend(append_state, table, context, chunk);
+		chunk.Reset();
+	}
+	table.storage->FinalizeLocalAppend(append_state);
+}
+
 void DataTable::AppendLock(TableAppendState &state) {
 	state.append_lock = unique_lock<mutex>(append_lock);
 	if (!is_root) {
@@ -609,7 +717,28 @@ void DataTable::WriteToLog(WriteAheadLog &log, idx_t row_start, idx_t count) {
 		return;
 	}
 	log.WriteSetTable(info->schema, info->table);
-	ScanTableSegment(row_start, count, [&](DataChunk &chunk) { log.WriteInsert(chunk); });
+	// row groups that have been written to the database file optimistically are logged as pointers to their blocks
+	// the other rows are logged as they are
+	bool synced = false;
+	idx_t end = row_start + count;
+	idx_t current_row = row_start;
+	while (current_row < end) {
+		auto row_group = row_groups->GetRowGroupForRow(current_row);
+		idx_t row_group_end = row_group->start + row_group->count;
+		if (row_group->start == current_row && row_group_end <= end && row_group->IsPersistent()) {
+			if (!synced) {
+				// the blocks need to be on disk before the WAL entry that references them
+				info->table_io_manager->GetBlockManagerForRowData().FileSync();
+				synced = true;
+			}
+			log.WriteRowGroupData(*row_group);
+			current_row = row_group_end;
+			continue;
+		}
+		idx_t scan_end = MinValue<idx_t>(end, row_group_end);
+		ScanTableSegment(current_row, scan_end - current_row, [&](DataChunk &chunk) { log.WriteInsert(chunk); });
+		current_row = scan_end;
+	}
 }
 
 void DataTable::CommitAppend(transaction_t commit_id, idx_t row_start, idx_t count) {
@@ -945,6 +1074,24 @@ unique_ptr<BaseStatistics> DataTable::GetStatistics(ClientContext &context, colu
 	return row_groups->CopyStats(column_id);
 }
 
+bool DataTable::GetExactStatistics(Transaction &transaction, const vector<column_t> &column_ids, idx_t &visible_count,
+                                   vector<Value> &min_values, vector<Value> &max_values) {
+	auto &local_storage = LocalStorage::Get(transaction);
+	if (local_storage.Find(this)) {
+		// transaction-local appends are not part of the statistics
+		return false;
+	}
+	// block appends while the statistics and the version info are read
+	lock_guard<mutex> lock(append_lock);
+	return row_groups->GetExactStatistics(TransactionData(transaction), column_ids, visible_count, min_values,
+	                                      max_values);
+}
+
+double DataTable::EstimateRangeSelectivity(column_t column_id, const Value &lower, const Value &upper) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	return row_groups->EstimateRangeSelectivity(column_id, lower, upper);
+}
+
 void DataTable::SetStatistics(column_t column_id, const std::function<void(BaseStatistics &)> &set_fun) {
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
 	row_groups->SetStatistics(column_id, set_fun);
@@ -954,8 +1101,12 @@ void DataTable::SetStatistics(column_t column_id, const std::function<void(BaseS
 // Checkpoint
 //===--------------------------------------------------------------------===//
 void DataTable::Checkpoint(TableDataWriter &writer) {
+	if (info->indexes.Empty()) {
+		// rewrite the row groups at the end of the table if most of their rows were deleted
+		// the indexes store row ids, so tables with indexes are not vacuumed: the row ids would change
+		row_groups->VacuumDeletes();
+	}
 	// checkpoint each individual row group
-	// FIXME: we might want to combine adjacent row groups in case they have had deletions...
 	vector<unique_ptr<BaseStatistics>> global_stats;
 	for (idx_t i = 0; i < column_definitions.size(); i++) {
 		global_stats.push_back(row_groups->CopyStats(i));
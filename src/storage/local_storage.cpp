@@ -196,6 +196,14 @@ void LocalTableStorage::FlushToDisk() {
 	optimistic_writer.FinalFlush();
 }
 
+void LocalTableStorage::PrepareCommit() {
+	if (row_groups->GetTotalRows() < LocalStorage::MERGE_THRESHOLD || deleted_rows != 0) {
+		// the rows are appended to the table one by one on commit
+		return;
+	}
+	FlushToDisk();
+}
+
 bool LocalTableStorage::AppendToIndexes(Transaction &transaction, RowGroupCollection &source,
                                         TableIndexList &index_list, const vector<LogicalType> &table_types,
                                         row_t &start_row) {
@@ -351,6 +359,13 @@ void LocalTableManager::InsertEntry(DataTable *table, shared_ptr<LocalTableStora
 	table_storage[table] = move(entry);
 }
 
+void LocalTableManager::PrepareCommit() {
+	lock_guard<mutex> l(table_storage_lock);
+	for (auto &storage : table_storage) {
+		storage.second->PrepareCommit();
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // LocalStorage
 //===--------------------------------------------------------------------===//
@@ -389,6 +404,14 @@ void LocalStorage::InitializeParallelScan(DataTable *table, ParallelCollectionSc
 	}
 }
 
+idx_t LocalStorage::SkipParallelScan(DataTable *table, ParallelCollectionScanState &state, idx_t count) {
+	auto storage = table_manager.GetStorage(table);
+	if (!storage) {
+		return 0;
+	}
+	return storage->row_groups->SkipParallelScan(TransactionData(0, 0), state, count);
+}
+
 bool LocalStorage::NextParallelScan(ClientContext &context, DataTable *table, ParallelCollectionScanState &state,
                                     CollectionScanState &scan_state) {
 	auto storage = table_manager.GetStorage(table);
@@ -489,7 +512,7 @@ void LocalStorage::Flush(DataTable &table, LocalTableStorage &storage) {
 	if ((append_state.row_start == 0 || storage.row_groups->GetTotalRows() >= MERGE_THRESHOLD) &&
 	    storage.deleted_rows == 0) {
 		// table is currently empty OR we are bulk appending: move over the storage directly
-		// first flush any out-standing storage nodes
+		// first flush any out-standing storage nodes (bulk appends have already been flushed in PrepareCommit)
 		storage.FlushToDisk();
 		// now append to the indexes (if there are any)
 		// FIXME: we should be able to merge the transaction-local index directly into the main table index
@@ -510,6 +533,10 @@ void LocalStorage::Flush(DataTable &table, LocalTableStorage &storage) {
 	transaction.PushAppend(&table, append_state.row_start, append_count);
 }
 
+void LocalStorage::PrepareCommit() {
+	table_manager.PrepareCommit();
+}
+
 void LocalStorage::Commit(LocalStorage::CommitState &commit_state, Transaction &transaction) {
 	// commit local storage
 	// iterate over all entries in the table storage map and commit them
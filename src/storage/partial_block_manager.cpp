@@ -40,6 +40,7 @@ void PartialBlockManager::AllocateBlock(PartialBlockState &state, uint32_t segme
 }
 
 bool PartialBlockManager::GetPartialBlock(idx_t segment_size, unique_ptr<PartialBlock> &partial_block) {
+	lock_guard<mutex> guard(partial_block_lock);
 	auto entry = partially_filled_blocks.lower_bound(segment_size);
 	if (entry == partially_filled_blocks.end()) {
 		return false;
@@ -55,6 +56,7 @@ bool PartialBlockManager::GetPartialBlock(idx_t segment_size, unique_ptr<Partial
 
 void PartialBlockManager::RegisterPartialBlock(PartialBlockAllocation &&allocation) {
 	auto &state(allocation.partial_block->state);
+	unique_lock<mutex> guard(partial_block_lock);
 	if (state.block_use_count < max_use_count) {
 		auto new_size = AlignValue(allocation.allocation_size + state.offset_in_block);
 		state.offset_in_block = new_size;
@@ -72,6 +74,7 @@ void PartialBlockManager::RegisterPartialBlock(PartialBlockAllocation &&allocati
 		block_to_free = move(itr->second);
 		partially_filled_blocks.erase(itr);
 	}
+	guard.unlock();
 	// Flush any block that we're not going to reuse.
 	if (block_to_free) {
 		block_to_free->Flush();
@@ -79,6 +82,7 @@ void PartialBlockManager::RegisterPartialBlock(PartialBlockAllocation &&allocati
 }
 
 void PartialBlockManager::FlushPartialBlocks() {
+	lock_guard<mutex> guard(partial_block_lock);
 	for (auto &e : partially_filled_blocks) {
 		e.second->Flush();
 	}
@@ -86,6 +90,7 @@ void PartialBlockManager::FlushPartialBlocks() {
 }
 
 void PartialBlockManager::Clear() {
+	lock_guard<mutex> guard(partial_block_lock);
 	for (auto &e : partially_filled_blocks) {
 		e.second->Clear();
 	}
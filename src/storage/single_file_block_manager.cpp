@@ -13,6 +13,12 @@
 #include <algorithm>
 #include <cstring>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace duckdb {
 
 const char MainHeader::MAGIC_BYTES[] = "DUCK";
@@ -88,7 +94,7 @@ SingleFileBlockManager::SingleFileBlockManager(DatabaseInstance &db, string path
     : BlockManager(BufferManager::GetBufferManager(db)), db(db), path(move(path_p)),
       header_buffer(Allocator::Get(db), FileBufferType::MANAGED_BUFFER,
                     Storage::FILE_HEADER_SIZE - Storage::BLOCK_HEADER_SIZE),
-      iteration_count(0), read_only(read_only), use_direct_io(use_direct_io) {
+      iteration_count(0), read_only(read_only), use_direct_io(use_direct_io), mapped_file(nullptr), mapped_size(0) {
 	uint8_t flags;
 	FileLockType lock;
 	if (read_only) {
@@ -182,7 +188,40 @@ SingleFileBlockManager::SingleFileBlockManager(DatabaseInstance &db, string path
 			Initialize(h2);
 		}
 		LoadFreeList();
+		if (read_only && DBConfig::GetConfig(db).options.use_mmap) {
+			MapFile();
+		}
+	}
+}
+
+SingleFileBlockManager::~SingleFileBlockManager() {
+#ifndef _WIN32
+	if (mapped_file) {
+		munmap(mapped_file, mapped_size);
+	}
+#endif
+}
+
+void SingleFileBlockManager::MapFile() {
+#ifndef _WIN32
+	auto file_size = handle->GetFileSize();
+	if (file_size <= (int64_t)BLOCK_START) {
+		return;
+	}
+	// the database is opened read-only and locked for reading, so the mapped file cannot be modified underneath us
+	// if the file cannot be mapped (e.g. because it is not a local file) we fall back to reading the blocks
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd == -1) {
+		return;
 	}
+	auto mapped = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (mapped == MAP_FAILED) {
+		return;
+	}
+	mapped_file = (data_ptr_t)mapped;
+	mapped_size = file_size;
+#endif
 }
 
 void SingleFileBlockManager::Initialize(DatabaseHeader &header) {
@@ -242,6 +281,7 @@ void SingleFileBlockManager::MarkBlockAsFree(block_id_t block_id) {
 	D_ASSERT(free_list.find(block_id) == free_list.end());
 	multi_use_blocks.erase(block_id);
 	free_list.insert(block_id);
+	ResetVerified(block_id);
 }
 
 void SingleFileBlockManager::MarkBlockAsModified(block_id_t block_id) {
@@ -281,6 +321,27 @@ void SingleFileBlockManager::IncreaseBlockReferenceCount(block_id_t block_id) {
 	}
 }
 
+void SingleFileBlockManager::MarkBlockAsUsed(block_id_t block_id) {
+	lock_guard<mutex> lock(block_lock);
+	D_ASSERT(block_id >= 0);
+	if (block_id >= max_block) {
+		// the block is past the end of the file: the blocks in between are free
+		for (; max_block < block_id; max_block++) {
+			free_list.insert(max_block);
+		}
+		max_block = block_id + 1;
+		free_list.erase(block_id);
+	} else if (free_list.erase(block_id) == 0) {
+		// the block is already in use: increase its reference count
+		auto entry = multi_use_blocks.find(block_id);
+		if (entry != multi_use_blocks.end()) {
+			entry->second++;
+		} else {
+			multi_use_blocks[block_id] = 2;
+		}
+	}
+}
+
 block_id_t SingleFileBlockManager::GetMetaBlock() {
 	return meta_block;
 }
@@ -295,6 +356,16 @@ idx_t SingleFileBlockManager::FreeBlocks() {
 	return free_list.size();
 }
 
+block_id_t SingleFileBlockManager::GetRelocationThreshold() {
+	lock_guard<mutex> lock(block_lock);
+	if (free_list.size() * RELOCATION_FREE_RATIO < (idx_t)max_block) {
+		// only a small part of the file is free: not worth moving blocks around
+		return INVALID_BLOCK;
+	}
+	// if all blocks in use were at the start of the file, they would all be below this block id
+	return max_block - free_list.size();
+}
+
 unique_ptr<Block> SingleFileBlockManager::CreateBlock(block_id_t block_id, FileBuffer *source_buffer) {
 	if (source_buffer) {
 		D_ASSERT(source_buffer->AllocSize() == Storage::BLOCK_ALLOC_SIZE);
@@ -307,11 +378,67 @@ unique_ptr<Block> SingleFileBlockManager::CreateBlock(block_id_t block_id, FileB
 void SingleFileBlockManager::Read(Block &block) {
 	D_ASSERT(block.id >= 0);
 	D_ASSERT(std::find(free_list.begin(), free_list.end(), block.id) == free_list.end());
-	block.ReadAndChecksum(*handle, BLOCK_START + block.id * Storage::BLOCK_ALLOC_SIZE);
+	block.Read(*handle, BLOCK_START + block.id * Storage::BLOCK_ALLOC_SIZE);
+	VerifyChecksum(block, block.id);
+}
+
+void SingleFileBlockManager::VerifyChecksum(FileBuffer &block, block_id_t block_id) {
+	if (!DBConfig::GetConfig(db).options.verify_checksums_once) {
+		block.VerifyChecksum();
+		return;
+	}
+	{
+		lock_guard<mutex> lock(verified_lock);
+		if (verified_blocks.find(block_id) != verified_blocks.end()) {
+			// the block was verified when it was first read and has not been written since
+			return;
+		}
+	}
+	block.VerifyChecksum();
+	lock_guard<mutex> lock(verified_lock);
+	verified_blocks.insert(block_id);
+}
+
+void SingleFileBlockManager::ResetVerified(block_id_t block_id) {
+	lock_guard<mutex> lock(verified_lock);
+	verified_blocks.erase(block_id);
+}
+
+unique_ptr<Block> SingleFileBlockManager::ReadMapped(block_id_t block_id) {
+	D_ASSERT(block_id >= 0);
+	if (!mapped_file) {
+		return nullptr;
+	}
+	auto location = BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE;
+	if (location + Storage::BLOCK_ALLOC_SIZE > mapped_size) {
+		return nullptr;
+	}
+	auto block = make_unique<Block>(Allocator::Get(db), block_id, mapped_file + location);
+	VerifyChecksum(*block, block_id);
+	return block;
+}
+
+void SingleFileBlockManager::Prefetch(block_id_t block_id) {
+	D_ASSERT(block_id >= 0);
+	auto location = BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE;
+	if (mapped_file) {
+#if !defined(_WIN32) && defined(MADV_WILLNEED)
+		if (location + Storage::BLOCK_ALLOC_SIZE <= mapped_size) {
+			madvise(mapped_file + location, Storage::BLOCK_ALLOC_SIZE, MADV_WILLNEED);
+		}
+#endif
+		return;
+	}
+	if (use_direct_io) {
+		// direct IO bypasses the page cache, so there is nothing to read ahead into
+		return;
+	}
+	handle->Prefetch(location, Storage::BLOCK_ALLOC_SIZE);
 }
 
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	D_ASSERT(block_id >= 0);
+	ResetVerified(block_id);
 	buffer.ChecksumAndWrite(*handle, BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE);
 }
 
@@ -427,6 +554,24 @@ void SingleFileBlockManager::WriteHeader(DatabaseHeader header) {
 	active_header = 1 - active_header;
 	//! Ensure the header write ends up on disk
 	handle->Sync();
+	// now that the new header is on disk, the free blocks at the end of the file can be removed
+	TruncateFreeBlocks();
+}
+
+void SingleFileBlockManager::FileSync() {
+	handle->Sync();
+}
+
+void SingleFileBlockManager::TruncateFreeBlocks() {
+	lock_guard<mutex> lock(block_lock);
+	while (max_block > 0 && free_list.erase(max_block - 1) > 0) {
+		max_block--;
+	}
+	// the header still counts the removed blocks as free blocks: writing to them later on simply extends the file
+	auto file_size = BLOCK_START + max_block * Storage::BLOCK_ALLOC_SIZE;
+	if (handle->GetFileSize() > (int64_t)file_size) {
+		handle->Truncate(file_size);
+	}
 }
 
 } // namespace duckdb
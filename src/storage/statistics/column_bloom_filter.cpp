@@ -0,0 +1,84 @@
+#include "duckdb/storage/statistics/column_bloom_filter.hpp"
+#include "duckdb/common/serializer.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+ColumnBloomFilter::ColumnBloomFilter(idx_t row_count) {
+	// every 64-bit word holds (at least) 64 / BITS_PER_ROW rows
+	words.resize(NextPowerOfTwo(MaxValue<idx_t>(row_count * BITS_PER_ROW / 64, 1)), 0);
+}
+
+ColumnBloomFilter::ColumnBloomFilter(vector<uint64_t> words_p) : words(move(words_p)) {
+	D_ASSERT(!words.empty() && (words.size() & (words.size() - 1)) == 0);
+}
+
+bool ColumnBloomFilter::SupportsType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+	case LogicalTypeId::UUID:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void ColumnBloomFilter::Insert(Vector &hashes, idx_t count) {
+	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	for (idx_t i = 0; i < count; i++) {
+		const auto hash = hash_data[i];
+		words[GetWord(hash)] |= GetMask(hash);
+	}
+}
+
+bool ColumnBloomFilter::MightContain(const Value &value) const {
+	const auto hash = value.Hash();
+	const auto mask = GetMask(hash);
+	return (words[GetWord(hash)] & mask) == mask;
+}
+
+idx_t ColumnBloomFilter::CountBits(idx_t word_count) const {
+	idx_t bit_count = 0;
+	for (idx_t i = 0; i < word_count; i++) {
+		uint64_t word = 0;
+		for (idx_t j = i; j < words.size(); j += word_count) {
+			word |= words[j];
+		}
+		for (; word; word &= word - 1) {
+			bit_count++;
+		}
+	}
+	return bit_count;
+}
+
+bool ColumnBloomFilter::Finalize() {
+	// the word of a hash is taken from its lower bits: halving the filter is the same as or-ing its two halves
+	while (words.size() > 1) {
+		auto half = words.size() / 2;
+		if (CountBits(half) * 100 > half * 64 * COMPACT_FILL_PERCENTAGE) {
+			break;
+		}
+		for (idx_t i = 0; i < half; i++) {
+			words[i] |= words[i + half];
+		}
+		words.resize(half);
+	}
+	words.shrink_to_fit();
+	return CountBits(words.size()) * 100 <= words.size() * 64 * MAX_FILL_PERCENTAGE;
+}
+
+void ColumnBloomFilter::Serialize(Serializer &serializer) const {
+	serializer.Write<uint64_t>(words.size());
+	serializer.WriteData((const_data_ptr_t)words.data(), words.size() * sizeof(uint64_t));
+}
+
+unique_ptr<ColumnBloomFilter> ColumnBloomFilter::Deserialize(Deserializer &source) {
+	auto word_count = source.Read<uint64_t>();
+	vector<uint64_t> words(word_count);
+	source.ReadData((data_ptr_t)words.data(), word_count * sizeof(uint64_t));
+	return make_unique<ColumnBloomFilter>(move(words));
+}
+
+} // namespace duckdb
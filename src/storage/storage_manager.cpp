@@ -12,6 +12,7 @@
 #include "duckdb/function/function.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
+#include "duckdb/transaction/transaction.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 
 namespace duckdb {
@@ -156,19 +157,21 @@ void SingleFileStorageManager::LoadDatabase() {
 class SingleFileStorageCommitState : public StorageCommitState {
 	idx_t initial_wal_size = 0;
 	idx_t initial_written = 0;
+	Transaction &transaction;
 	WriteAheadLog *log;
 	bool checkpoint;
 
 public:
-	SingleFileStorageCommitState(StorageManager &storage_manager, bool checkpoint);
+	SingleFileStorageCommitState(StorageManager &storage_manager, Transaction &transaction, bool checkpoint);
 	~SingleFileStorageCommitState() override;
 
 	// Make the commit persistent
 	void FlushCommit() override;
 };
 
-SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage_manager, bool checkpoint)
-    : checkpoint(checkpoint) {
+SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage_manager, Transaction &transaction,
+                                                           bool checkpoint)
+    : transaction(transaction), checkpoint(checkpoint) {
 	log = storage_manager.GetWriteAheadLog();
 	if (log) {
 		auto initial_size = log->GetWALSize();
@@ -194,7 +197,8 @@ void SingleFileStorageCommitState::FlushCommit() {
 			(void)checkpoint;
 			D_ASSERT(!checkpoint);
 			D_ASSERT(!log->skip_writing);
-			log->Flush();
+			// the WAL is synced by the transaction manager after releasing the transaction lock
+			transaction.wal_sync_position = log->WriteFlush();
 		}
 		log->skip_writing = false;
 	}
@@ -215,7 +219,7 @@ SingleFileStorageCommitState::~SingleFileStorageCommitState() {
 
 unique_ptr<StorageCommitState> SingleFileStorageManager::GenStorageCommitState(Transaction &transaction,
                                                                                bool checkpoint) {
-	return make_unique<SingleFileStorageCommitState>(*this, checkpoint);
+	return make_unique<SingleFileStorageCommitState>(*this, transaction, checkpoint);
 }
 
 bool SingleFileStorageManager::IsCheckpointClean(block_id_t checkpoint_id) {
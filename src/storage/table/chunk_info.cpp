@@ -102,11 +102,35 @@ unique_ptr<ChunkInfo> ChunkConstantInfo::Deserialize(Deserializer &source) {
 // Vector info
 //===--------------------------------------------------------------------===//
 ChunkVectorInfo::ChunkVectorInfo(idx_t start)
-    : ChunkInfo(start, ChunkInfoType::VECTOR_INFO), insert_id(0), same_inserted_id(true), any_deleted(false) {
+    : ChunkInfo(start, ChunkInfoType::VECTOR_INFO), insert_id(0), same_inserted_id(true), any_deleted(false),
+      pending_deletes(0) {
 	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
 		inserted[i] = 0;
 		deleted[i] = NOT_DELETED_ID;
 	}
+	memset(deleted_mask, 0, sizeof(deleted_mask));
+}
+
+idx_t ChunkVectorInfo::GetUndeletedSelVector(SelectionVector &sel_vector, idx_t max_count) {
+	idx_t count = 0;
+	for (idx_t word_idx = 0; word_idx * 64 < max_count; word_idx++) {
+		idx_t base_idx = word_idx * 64;
+		idx_t next = MinValue<idx_t>(base_idx + 64, max_count);
+		auto mask = deleted_mask[word_idx];
+		if (mask == 0) {
+			// no tuples are deleted in this word
+			for (idx_t i = base_idx; i < next; i++) {
+				sel_vector.set_index(count++, i);
+			}
+		} else if (mask != ~uint64_t(0)) {
+			for (idx_t i = base_idx; i < next; i++) {
+				if (!(mask & (uint64_t(1) << (i - base_idx)))) {
+					sel_vector.set_index(count++, i);
+				}
+			}
+		}
+	}
+	return count;
 }
 
 template <class OP>
@@ -124,6 +148,10 @@ idx_t ChunkVectorInfo::TemplatedGetSelVector(transaction_t start_time, transacti
 		if (!OP::UseInsertedVersion(start_time, transaction_id, insert_id)) {
 			return 0;
 		}
+		if (pending_deletes == 0) {
+			// all deletes are visible to every transaction: only check the deleted mask
+			return GetUndeletedSelVector(sel_vector, max_count);
+		}
 		// have to check deleted flag
 		for (idx_t i = 0; i < max_count; i++) {
 			if (OP::UseDeletedVersion(start_time, transaction_id, deleted[i])) {
@@ -182,6 +210,7 @@ idx_t ChunkVectorInfo::Delete(transaction_t transaction_id, row_t rows[], idx_t
 		}
 		// after verifying that there are no conflicts we mark the tuple as deleted
 		deleted[rows[i]] = transaction_id;
+		pending_deletes++;
 		rows[deleted_tuples] = rows[i];
 		deleted_tuples++;
 	}
@@ -194,6 +223,19 @@ void ChunkVectorInfo::CommitDelete(transaction_t commit_id, row_t rows[], idx_t
 	}
 }
 
+void ChunkVectorInfo::RollbackDelete(row_t rows[], idx_t count) {
+	CommitDelete(NOT_DELETED_ID, rows, count);
+	pending_deletes -= count;
+}
+
+void ChunkVectorInfo::CleanupDelete(row_t rows[], idx_t count) {
+	// the mask is only read while there are no pending deletes, so it can be written until the count is decremented
+	for (idx_t i = 0; i < count; i++) {
+		SetDeleted(rows[i]);
+	}
+	pending_deletes -= count;
+}
+
 void ChunkVectorInfo::Append(idx_t start, idx_t end, transaction_t commit_id) {
 	if (start == 0) {
 		insert_id = commit_id;
@@ -254,6 +296,7 @@ unique_ptr<ChunkInfo> ChunkVectorInfo::Deserialize(Deserializer &source) {
 	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
 		if (deleted_tuples[i]) {
 			result->deleted[i] = 0;
+			result->SetDeleted(i);
 		}
 	}
 	return move(result);
@@ -76,6 +76,7 @@ void ColumnData::InitializeScan(ColumnScanState &state) {
 	state.initialized = false;
 	state.version = version;
 	state.scan_state.reset();
+	state.prefetched = nullptr;
 }
 
 void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx) {
@@ -85,19 +86,40 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx)
 	state.initialized = false;
 	state.version = version;
 	state.scan_state.reset();
+	state.prefetched = nullptr;
 }
 
-idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining) {
+//! The number of segments after the current segment for which a scan issues read-ahead
+static constexpr idx_t PREFETCH_SEGMENT_COUNT = 4;
+
+void ColumnData::PrefetchSegments(ColumnScanState &state) {
+	D_ASSERT(state.current);
+	auto segment = (ColumnSegment *)state.current->Next();
+	for (idx_t i = 0; segment && i < PREFETCH_SEGMENT_COUNT; i++) {
+		if (!state.prefetched || segment->start > state.prefetched->start) {
+			// only persistent blocks that are not loaded yet are read ahead, this is a no-op for all others
+			if (segment->segment_type == ColumnSegmentType::PERSISTENT && segment->block) {
+				block_manager.buffer_manager.Prefetch(segment->block);
+			}
+			state.prefetched = segment;
+		}
+		segment = (ColumnSegment *)segment->Next();
+	}
+}
+
+void ColumnData::BeginScanVector(ColumnScanState &state) {
 	state.previous_states.clear();
 	if (state.version != version) {
 		InitializeScanWithOffset(state, state.row_index);
 		state.current->InitializeScan(state);
 		state.initialized = true;
+		PrefetchSegments(state);
 	} else if (!state.initialized) {
 		D_ASSERT(state.current);
 		state.current->InitializeScan(state);
 		state.internal_index = state.current->start;
 		state.initialized = true;
+		PrefetchSegments(state);
 	}
 	D_ASSERT(data.HasSegment(state.current));
 	D_ASSERT(state.version == version);
@@ -106,6 +128,10 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 		state.current->Skip(state);
 	}
 	D_ASSERT(state.current->type == type);
+}
+
+idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining) {
+	BeginScanVector(state);
 	idx_t initial_remaining = remaining;
 	while (remaining > 0) {
 		D_ASSERT(state.row_index >= state.current->start &&
@@ -127,6 +153,7 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 			state.current = (ColumnSegment *)state.current->Next();
 			state.current->InitializeScan(state);
 			state.segment_checked = false;
+			PrefetchSegments(state);
 			D_ASSERT(state.row_index >= state.current->start &&
 			         state.row_index <= state.current->start + state.current->count);
 		}
@@ -140,7 +167,8 @@ idx_t ColumnData::ScanVector(TransactionData transaction, idx_t vector_index, Co
 	auto scan_count = ScanVector(state, result, STANDARD_VECTOR_SIZE);
 
 	lock_guard<mutex> update_guard(update_lock);
-	if (updates) {
+	// vectors without updates are returned as-is: they do not need to be flattened to merge in the updates
+	if (updates && updates->HasUpdates(vector_index)) {
 		if (!ALLOW_UPDATES && updates->HasUncommittedUpdates(vector_index)) {
 			throw TransactionException("Cannot create index with outstanding updates");
 		}
@@ -201,6 +229,29 @@ void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnS
 	ColumnSegment::FilterSelection(sel, result, filter, count, FlatVector::Validity(result));
 }
 
+bool ColumnData::SelectVector(ColumnScanState &state, Vector &result, SelectionVector &sel, idx_t &count,
+                              const TableFilter &filter, idx_t &scan_count) {
+	BeginScanVector(state);
+	auto segment = state.current;
+	if (!segment->CanSelect(filter)) {
+		return false;
+	}
+	// the filter can only be evaluated on the compressed data if the entire vector comes from this segment
+	scan_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, segment->start + segment->count - state.row_index);
+	if (scan_count == 0 || (scan_count < STANDARD_VECTOR_SIZE && segment->next)) {
+		return false;
+	}
+	lock_guard<mutex> update_guard(update_lock);
+	if (updates) {
+		// updated values are not part of the compressed data
+		return false;
+	}
+	segment->Select(state, scan_count, result, sel, count, filter);
+	state.row_index += scan_count;
+	state.internal_index = state.row_index;
+	return true;
+}
+
 void ColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                             SelectionVector &sel, idx_t count) {
 	Scan(transaction, vector_index, state, result);
@@ -338,6 +389,11 @@ unique_ptr<BaseStatistics> ColumnData::GetUpdateStatistics() {
 	return updates ? updates->GetStatistics() : nullptr;
 }
 
+bool ColumnData::HasUpdates() {
+	lock_guard<mutex> update_guard(update_lock);
+	return updates.get();
+}
+
 void ColumnData::AppendTransientSegment(SegmentLock &l, idx_t start_row) {
 	idx_t segment_size = Storage::BLOCK_SIZE;
 	if (start_row == idx_t(MAX_ROW_ID)) {
@@ -426,6 +482,38 @@ void ColumnData::DeserializeColumn(Deserializer &source) {
 	}
 }
 
+bool ColumnData::IsPersistent() {
+	if (HasUpdates()) {
+		return false;
+	}
+	for (auto segment = (ColumnSegment *)data.GetRootSegment(); segment; segment = (ColumnSegment *)segment->Next()) {
+		if (segment->segment_type != ColumnSegmentType::PERSISTENT) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void ColumnData::SerializePersistentColumn(Serializer &serializer, vector<block_id_t> &blocks) {
+	vector<ColumnSegment *> segments;
+	for (auto segment = (ColumnSegment *)data.GetRootSegment(); segment; segment = (ColumnSegment *)segment->Next()) {
+		D_ASSERT(segment->segment_type == ColumnSegmentType::PERSISTENT);
+		segments.push_back(segment);
+	}
+	serializer.Write<idx_t>(segments.size());
+	for (auto segment : segments) {
+		serializer.Write<idx_t>(segment->start);
+		serializer.Write<idx_t>(segment->count);
+		serializer.Write<block_id_t>(segment->GetBlockId());
+		serializer.Write<uint32_t>(segment->GetBlockOffset());
+		serializer.Write<CompressionType>(segment->function->type);
+		segment->stats.statistics->Serialize(serializer);
+		if (segment->GetBlockId() != INVALID_BLOCK) {
+			blocks.push_back(segment->GetBlockId());
+		}
+	}
+}
+
 shared_ptr<ColumnData> ColumnData::Deserialize(BlockManager &block_manager, DataTableInfo &info, idx_t column_index,
                                                idx_t start_row, Deserializer &source, const LogicalType &type,
                                                ColumnData *parent) {
@@ -10,7 +10,7 @@ ColumnDataCheckpointer::ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup
     : col_data(col_data_p), row_group(row_group_p), state(state_p),
       is_validity(GetType().id() == LogicalTypeId::VALIDITY),
       intermediate(is_validity ? LogicalType::BOOLEAN : GetType(), true, is_validity),
-      checkpoint_info(checkpoint_info_p) {
+      checkpoint_info(checkpoint_info_p), relocation_threshold(INVALID_BLOCK) {
 	auto &config = DBConfig::GetConfig(GetDatabase());
 	compression_functions = config.GetCompressionFunctions(GetType().InternalType());
 }
@@ -31,25 +31,41 @@ RowGroup &ColumnDataCheckpointer::GetRowGroup() {
 	return row_group;
 }
 
+idx_t ColumnDataCheckpointer::GetRowStart() {
+	D_ASSERT(!nodes.empty());
+	return nodes[0].node->start;
+}
+
 ColumnCheckpointState &ColumnDataCheckpointer::GetCheckpointState() {
 	return state;
 }
 
-void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback) {
+void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback, bool sample) {
 	Vector scan_vector(intermediate.GetType(), nullptr);
+	idx_t vector_idx = 0;
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto segment = (ColumnSegment *)nodes[segment_idx].node.get();
 		ColumnScanState scan_state;
 		scan_state.current = segment;
+		scan_state.internal_index = segment->start;
 		segment->InitializeScan(scan_state);
 
-		for (idx_t base_row_index = 0; base_row_index < segment->count; base_row_index += STANDARD_VECTOR_SIZE) {
+		for (idx_t base_row_index = 0; base_row_index < segment->count;
+		     base_row_index += STANDARD_VECTOR_SIZE, vector_idx++) {
+			if (sample && vector_idx % ANALYZE_SAMPLE_STRIDE >= ANALYZE_SAMPLE_RUN) {
+				continue;
+			}
 			scan_vector.Reference(intermediate);
 
 			idx_t count = MinValue<idx_t>(segment->count - base_row_index, STANDARD_VECTOR_SIZE);
 			scan_state.row_index = segment->start + base_row_index;
+			if (scan_state.internal_index < scan_state.row_index) {
+				// we skipped over vectors that are not part of the sample
+				segment->Skip(scan_state);
+			}
 
 			col_data.CheckpointScan(segment, scan_state, row_group.start, count, scan_vector);
+			scan_state.internal_index = scan_state.row_index + count;
 
 			callback(scan_vector, count);
 		}
@@ -83,6 +99,45 @@ CompressionType ForceCompression(vector<CompressionFunction *> &compression_func
 	return found ? compression_type : CompressionType::COMPRESSION_AUTO;
 }
 
+idx_t ColumnDataCheckpointer::GetVectorCount() {
+	idx_t vector_count = 0;
+	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
+		auto segment = (ColumnSegment *)nodes[segment_idx].node.get();
+		vector_count += (segment->count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+	}
+	return vector_count;
+}
+
+idx_t ColumnDataCheckpointer::GetCompressionHint() {
+	// the persistent segments were compressed in a previous checkpoint
+	// if they hold most of the data and all use the same method, that method is a good candidate for the rewrite
+	auto hint = CompressionType::COMPRESSION_AUTO;
+	idx_t persistent_count = 0;
+	idx_t total_count = 0;
+	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
+		auto segment = (ColumnSegment *)nodes[segment_idx].node.get();
+		total_count += segment->count;
+		if (segment->segment_type != ColumnSegmentType::PERSISTENT) {
+			continue;
+		}
+		if (hint != CompressionType::COMPRESSION_AUTO && hint != segment->function->type) {
+			// the persistent segments use different compression methods
+			return DConstants::INVALID_INDEX;
+		}
+		hint = segment->function->type;
+		persistent_count += segment->count;
+	}
+	if (hint == CompressionType::COMPRESSION_AUTO || persistent_count * 2 < total_count) {
+		return DConstants::INVALID_INDEX;
+	}
+	for (idx_t i = 0; i < compression_functions.size(); i++) {
+		if (compression_functions[i] && compression_functions[i]->type == hint) {
+			return i;
+		}
+	}
+	return DConstants::INVALID_INDEX;
+}
+
 unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx_t &compression_idx) {
 	D_ASSERT(!compression_functions.empty());
 	auto &config = DBConfig::GetConfig(GetDatabase());
@@ -96,45 +151,80 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
 		forced_method = ForceCompression(compression_functions, config.options.force_compression);
 	}
+	if (forced_method == CompressionType::COMPRESSION_AUTO) {
+		// try the method that was picked for this data in a previous checkpoint first
+		auto hint_idx = GetCompressionHint();
+		if (hint_idx != DConstants::INVALID_INDEX) {
+			vector<CompressionFunction *> hinted_functions(compression_functions.size(), nullptr);
+			hinted_functions[hint_idx] = compression_functions[hint_idx];
+			auto state = AnalyzeCompression(hinted_functions, false, forced_method, compression_idx);
+			if (state) {
+				return state;
+			}
+		}
+		if (GetVectorCount() > ANALYZE_SAMPLE_THRESHOLD) {
+			// pick the best method based on a sample of the vectors
+			auto sample_functions = compression_functions;
+			idx_t sample_idx;
+			if (AnalyzeCompression(sample_functions, true, forced_method, sample_idx)) {
+				// the analyze state has to cover all of the data: analyze the selected method on the full column
+				vector<CompressionFunction *> selected_functions(compression_functions.size(), nullptr);
+				selected_functions[sample_idx] = compression_functions[sample_idx];
+				auto state = AnalyzeCompression(selected_functions, false, forced_method, compression_idx);
+				if (state) {
+					return state;
+				}
+			}
+			// the selected method cannot compress all of the data: fall back to analyzing all methods
+		}
+	}
+	return AnalyzeCompression(compression_functions, false, forced_method, compression_idx);
+}
+
+unique_ptr<AnalyzeState> ColumnDataCheckpointer::AnalyzeCompression(vector<CompressionFunction *> &functions,
+                                                                    bool sample, CompressionType forced_method,
+                                                                    idx_t &compression_idx) {
 	// set up the analyze states for each compression method
 	vector<unique_ptr<AnalyzeState>> analyze_states;
-	analyze_states.reserve(compression_functions.size());
-	for (idx_t i = 0; i < compression_functions.size(); i++) {
-		if (!compression_functions[i]) {
+	analyze_states.reserve(functions.size());
+	for (idx_t i = 0; i < functions.size(); i++) {
+		if (!functions[i]) {
 			analyze_states.push_back(nullptr);
 			continue;
 		}
-		analyze_states.push_back(compression_functions[i]->init_analyze(col_data, col_data.type.InternalType()));
+		analyze_states.push_back(functions[i]->init_analyze(col_data, col_data.type.InternalType()));
 	}
 
-	// scan over all the segments and run the analyze step
-	ScanSegments([&](Vector &scan_vector, idx_t count) {
-		for (idx_t i = 0; i < compression_functions.size(); i++) {
-			if (!compression_functions[i]) {
-				continue;
-			}
-			auto success = compression_functions[i]->analyze(*analyze_states[i], scan_vector, count);
-			if (!success) {
-				// could not use this compression function on this data set
-				// erase it
-				compression_functions[i] = nullptr;
-				analyze_states[i].reset();
-			}
-		}
-	});
-
-	// now that we have passed over all the data, we need to figure out the best method
+	// scan over the segments and run the analyze step
+	ScanSegments(
+	    [&](Vector &scan_vector, idx_t count) {
+		    for (idx_t i = 0; i < functions.size(); i++) {
+			    if (!functions[i]) {
+				    continue;
+			    }
+			    auto success = functions[i]->analyze(*analyze_states[i], scan_vector, count);
+			    if (!success) {
+				    // could not use this compression function on this data set
+				    // erase it
+				    functions[i] = nullptr;
+				    analyze_states[i].reset();
+			    }
+		    }
+	    },
+	    sample);
+
+	// now that we have passed over the data, we need to figure out the best method
 	// we do this using the final_analyze method
 	unique_ptr<AnalyzeState> state;
 	compression_idx = DConstants::INVALID_INDEX;
 	idx_t best_score = NumericLimits<idx_t>::Maximum();
-	for (idx_t i = 0; i < compression_functions.size(); i++) {
-		if (!compression_functions[i]) {
+	for (idx_t i = 0; i < functions.size(); i++) {
+		if (!functions[i]) {
 			continue;
 		}
 		//! Check if the method type is the forced method (if forced is used)
-		bool forced_method_found = compression_functions[i]->type == forced_method;
-		auto score = compression_functions[i]->final_analyze(*analyze_states[i]);
+		bool forced_method_found = functions[i]->type == forced_method;
+		auto score = functions[i]->final_analyze(*analyze_states[i]);
 
 		//! The finalize method can return this value from final_analyze to indicate it should not be used.
 		if (score == DConstants::INVALID_INDEX) {
@@ -192,26 +282,24 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	nodes.clear();
 }
 
-bool ColumnDataCheckpointer::HasChanges() {
-	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
-		auto segment = (ColumnSegment *)nodes[segment_idx].node.get();
-		if (segment->segment_type == ColumnSegmentType::TRANSIENT) {
-			// transient segment: always need to write to disk
-			return true;
-		} else {
-			// persistent segment; check if there were any updates or deletions in this segment
-			idx_t start_row_idx = segment->start - row_group.start;
-			idx_t end_row_idx = start_row_idx + segment->count;
-			if (col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx)) {
-				return true;
-			}
-		}
+bool ColumnDataCheckpointer::HasChanges(ColumnSegment &segment) {
+	if (segment.segment_type == ColumnSegmentType::TRANSIENT) {
+		// transient segment: always need to write to disk
+		return true;
 	}
-	return false;
+	// persistent segment; check if it is stored near the end of a file with a lot of free space
+	auto block_id = segment.GetBlockId();
+	if (relocation_threshold != INVALID_BLOCK && block_id != INVALID_BLOCK && block_id >= relocation_threshold) {
+		return true;
+	}
+	// check if there were any updates or deletions in this segment
+	idx_t start_row_idx = segment.start - row_group.start;
+	idx_t end_row_idx = start_row_idx + segment.count;
+	return col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx);
 }
 
 void ColumnDataCheckpointer::WritePersistentSegments() {
-	// all segments are persistent and there are no updates
+	// the segments are persistent and there are no updates
 	// we only need to write the metadata
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto segment = (ColumnSegment *)nodes[segment_idx].node.get();
@@ -236,17 +324,29 @@ void ColumnDataCheckpointer::WritePersistentSegments() {
 	}
 }
 
-void ColumnDataCheckpointer::Checkpoint(vector<SegmentNode> nodes) {
-	D_ASSERT(!nodes.empty());
-	this->nodes = move(nodes);
-	// first check if any of the segments have changes
-	if (!HasChanges()) {
-		// no changes: only need to write the metadata for this column
-		WritePersistentSegments();
-	} else {
-		// there are changes: rewrite the set of columns
-		WriteToDisk();
+void ColumnDataCheckpointer::Checkpoint(vector<SegmentNode> all_nodes) {
+	D_ASSERT(!all_nodes.empty());
+	relocation_threshold = col_data.block_manager.GetRelocationThreshold();
+	// split the segments into runs of segments that have changes and segments that do not
+	// only the runs with changes are rewritten: unchanged segments keep referencing their current blocks
+	idx_t segment_idx = 0;
+	while (segment_idx < all_nodes.size()) {
+		bool has_changes = HasChanges((ColumnSegment &)*all_nodes[segment_idx].node);
+		nodes.clear();
+		while (segment_idx < all_nodes.size() &&
+		       HasChanges((ColumnSegment &)*all_nodes[segment_idx].node) == has_changes) {
+			nodes.push_back(move(all_nodes[segment_idx]));
+			segment_idx++;
+		}
+		if (has_changes) {
+			// there are changes: rewrite this run of segments
+			WriteToDisk();
+		} else {
+			// no changes: only need to write the metadata for these segments
+			WritePersistentSegments();
+		}
 	}
+	nodes.clear();
 }
 
 } // namespace duckdb
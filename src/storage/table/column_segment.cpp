@@ -110,6 +110,45 @@ void ColumnSegment::ScanPartial(ColumnScanState &state, idx_t scan_count, Vector
 	function->scan_partial(*this, state, scan_count, result, result_offset);
 }
 
+static bool FilterRejectsNull(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NOT_NULL:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and = (ConjunctionAndFilter &)filter;
+		for (auto &child_filter : conjunction_and.child_filters) {
+			if (!FilterRejectsNull(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_or = (ConjunctionOrFilter &)filter;
+		for (auto &child_filter : conjunction_or.child_filters) {
+			if (!FilterRejectsNull(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ColumnSegment::CanSelect(const TableFilter &filter) const {
+	// NULL rows are removed after the select, which is only correct if the filter never passes a NULL value
+	return function->select && FilterRejectsNull(filter);
+}
+
+void ColumnSegment::Select(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+                           idx_t &approved_tuple_count, const TableFilter &filter) {
+	D_ASSERT(CanSelect(filter));
+	function->select(*this, state, scan_count, result, sel, approved_tuple_count, filter);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -327,6 +366,30 @@ static idx_t TemplatedNullSelection(SelectionVector &sel, idx_t &approved_tuple_
 	}
 }
 
+void ColumnSegment::FilterEntries(Vector &entries, idx_t count, const TableFilter &filter, bool passes[]) {
+	SelectionVector sel;
+	idx_t approved_tuple_count = count;
+	FilterSelection(sel, entries, filter, approved_tuple_count, FlatVector::Validity(entries));
+	memset(passes, 0, count * sizeof(bool));
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		passes[sel.get_index(i)] = true;
+	}
+}
+
+void ColumnSegment::SelectEntries(SelectionVector &sel, idx_t &approved_tuple_count, const sel_t row_entries[],
+                                  const bool passes[]) {
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (passes[row_entries[idx]]) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+}
+
 idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &result, const TableFilter &filter,
                                      idx_t &approved_tuple_count, ValidityMask &mask) {
 	switch (filter.filter_type) {
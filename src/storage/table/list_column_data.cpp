@@ -375,6 +375,16 @@ void ListColumnData::DeserializeColumn(Deserializer &source) {
 	child_column->DeserializeColumn(source);
 }
 
+bool ListColumnData::IsPersistent() {
+	return ColumnData::IsPersistent() && validity.IsPersistent() && child_column->IsPersistent();
+}
+
+void ListColumnData::SerializePersistentColumn(Serializer &serializer, vector<block_id_t> &blocks) {
+	ColumnData::SerializePersistentColumn(serializer, blocks);
+	validity.SerializePersistentColumn(serializer, blocks);
+	child_column->SerializePersistentColumn(serializer, blocks);
+}
+
 void ListColumnData::GetStorageInfo(idx_t row_group_index, vector<idx_t> col_path, vector<vector<Value>> &result) {
 	col_path.push_back(0);
 	validity.GetStorageInfo(row_group_index, col_path, result);
@@ -4,6 +4,7 @@
 namespace duckdb {
 
 PersistentTableData::PersistentTableData(idx_t column_count) {
+	table_pointer.block_id = INVALID_BLOCK;
 }
 
 PersistentTableData::~PersistentTableData() {
@@ -13,6 +13,11 @@
 #include "duckdb/storage/meta_block_reader.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/storage/statistics/column_bloom_filter.hpp"
 
 namespace duckdb {
 
@@ -48,13 +53,15 @@ RowGroup::RowGroup(DatabaseInstance &db, BlockManager &block_manager, DataTableI
 		this->stats.push_back(make_shared<SegmentStatistics>(stats_type, move(stats)));
 	}
 	this->version_info = move(pointer.versions);
+	this->bloom_filters = move(pointer.bloom_filters);
 
 	Verify();
 }
 
 RowGroup::RowGroup(RowGroup &row_group, idx_t start)
     : SegmentBase(start, row_group.count), db(row_group.db), block_manager(row_group.block_manager),
-      table_info(row_group.table_info), version_info(move(row_group.version_info)), stats(move(row_group.stats)) {
+      table_info(row_group.table_info), version_info(move(row_group.version_info)), stats(move(row_group.stats)),
+      bloom_filters(move(row_group.bloom_filters)) {
 	for (auto &column : row_group.columns) {
 		this->columns.push_back(ColumnData::CreateColumn(*column, start));
 	}
@@ -95,6 +102,13 @@ bool RowGroup::InitializeScanWithOffset(RowGroupScanState &state, idx_t vector_o
 			return false;
 		}
 	}
+	auto dynamic_filters = state.GetDynamicFilters();
+	if (dynamic_filters) {
+		auto current_filters = dynamic_filters->GetFilters();
+		if (current_filters && !CheckZonemap(*current_filters, column_ids)) {
+			return false;
+		}
+	}
 
 	state.row_group = this;
 	state.vector_index = vector_offset;
@@ -121,6 +135,13 @@ bool RowGroup::InitializeScan(RowGroupScanState &state) {
 			return false;
 		}
 	}
+	auto dynamic_filters = state.GetDynamicFilters();
+	if (dynamic_filters) {
+		auto current_filters = dynamic_filters->GetFilters();
+		if (current_filters && !CheckZonemap(*current_filters, column_ids)) {
+			return false;
+		}
+	}
 	state.row_group = this;
 	state.vector_index = 0;
 	state.max_row = this->start > parent_max_row ? 0 : MinValue<idx_t>(this->count, parent_max_row - this->start);
@@ -167,6 +188,10 @@ unique_ptr<RowGroup> RowGroup::AlterType(const LogicalType &target_type, idx_t c
 	// set up the row_group based on this row_group
 	auto row_group = make_unique<RowGroup>(db, block_manager, table_info, this->start, this->count);
 	row_group->version_info = version_info;
+	row_group->bloom_filters = bloom_filters;
+	if (!row_group->bloom_filters.empty()) {
+		row_group->bloom_filters[changed_idx].reset();
+	}
 	for (idx_t i = 0; i < columns.size(); i++) {
 		if (i == changed_idx) {
 			// this is the altered column: use the new column
@@ -213,9 +238,13 @@ unique_ptr<RowGroup> RowGroup::AddColumn(ColumnDefinition &new_column, Expressio
 	row_group->version_info = version_info;
 	row_group->columns = columns;
 	row_group->stats = stats;
+	row_group->bloom_filters = bloom_filters;
 	// now add the new column
 	row_group->columns.push_back(move(added_column));
 	row_group->stats.push_back(move(added_col_stats));
+	if (!row_group->bloom_filters.empty()) {
+		row_group->bloom_filters.push_back(nullptr);
+	}
 
 	row_group->Verify();
 	return row_group;
@@ -230,9 +259,13 @@ unique_ptr<RowGroup> RowGroup::RemoveColumn(idx_t removed_column) {
 	row_group->version_info = version_info;
 	row_group->columns = columns;
 	row_group->stats = stats;
+	row_group->bloom_filters = bloom_filters;
 	// now remove the column
 	row_group->columns.erase(row_group->columns.begin() + removed_column);
 	row_group->stats.erase(row_group->stats.begin() + removed_column);
+	if (!row_group->bloom_filters.empty()) {
+		row_group->bloom_filters.erase(row_group->bloom_filters.begin() + removed_column);
+	}
 
 	row_group->Verify();
 	return row_group;
@@ -262,6 +295,39 @@ void RowGroup::NextVector(RowGroupScanState &state) {
 	}
 }
 
+//! Returns false if none of the values in the Bloom filter can pass the filter
+static bool CheckBloomFilter(ColumnBloomFilter &bloom_filter, TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = (ConstantFilter &)filter;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL || constant_filter.constant.IsNull()) {
+			return true;
+		}
+		return bloom_filter.MightContain(constant_filter.constant);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_filter = (ConjunctionAndFilter &)filter;
+		for (auto &child_filter : conjunction_filter.child_filters) {
+			if (!CheckBloomFilter(bloom_filter, *child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_filter = (ConjunctionOrFilter &)filter;
+		for (auto &child_filter : conjunction_filter.child_filters) {
+			if (CheckBloomFilter(bloom_filter, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return true;
+	}
+}
+
 bool RowGroup::CheckZonemap(TableFilterSet &filters, const vector<column_t> &column_ids) {
 	for (auto &entry : filters.filters) {
 		auto column_index = entry.first;
@@ -273,6 +339,11 @@ bool RowGroup::CheckZonemap(TableFilterSet &filters, const vector<column_t> &col
 		    propagate_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
 			return false;
 		}
+		// the min/max of high-cardinality columns rarely rule out an equality filter: check the Bloom filter
+		auto bloom_filter = GetBloomFilter(base_column_index);
+		if (bloom_filter && !CheckBloomFilter(*bloom_filter, *filter)) {
+			return false;
+		}
 	}
 	return true;
 }
@@ -332,6 +403,11 @@ void RowGroup::TemplatedScan(TransactionData transaction, RowGroupScanState &sta
 		if (!CheckZonemapSegments(state)) {
 			continue;
 		}
+		if (state.SkipSampledVector()) {
+			// the vector is not part of the sample: skip it without reading any of its data
+			NextVector(state);
+			continue;
+		}
 		// second, scan the version chunk manager to figure out which tuples to load for this transaction
 		idx_t count;
 		SelectionVector valid_sel(STANDARD_VECTOR_SIZE);
@@ -380,21 +456,27 @@ void RowGroup::TemplatedScan(TransactionData transaction, RowGroupScanState &sta
 				sel.Initialize(nullptr);
 			}
 			//! first, we scan the columns with filters, fetch their data and generate a selection vector.
-			//! get runtime statistics
-			auto start_time = high_resolution_clock::now();
 			if (table_filters) {
 				D_ASSERT(adaptive_filter);
 				D_ASSERT(ALLOW_UPDATES);
 				for (idx_t i = 0; i < table_filters->filters.size(); i++) {
 					auto tf_idx = adaptive_filter->permutation[i];
 					auto col_idx = column_ids[tf_idx];
+					auto tuple_count = approved_tuple_count;
+					auto start_time = high_resolution_clock::now();
 					columns[col_idx]->Select(transaction, state.vector_index, state.column_scans[tf_idx],
 					                         result.data[tf_idx], sel, approved_tuple_count,
 					                         *table_filters->filters[tf_idx]);
+					auto end_time = high_resolution_clock::now();
+					adaptive_filter->AddFilterRuntime(i, tuple_count, tuple_count - approved_tuple_count,
+					                                  duration_cast<duration<double>>(end_time - start_time).count());
 				}
 				for (auto &table_filter : table_filters->filters) {
 					result.data[table_filter.first].Slice(sel, approved_tuple_count);
 				}
+				if (table_filters->filters.size() > 1) {
+					adaptive_filter->AdaptRuntimeStatistics();
+				}
 			}
 			if (approved_tuple_count == 0) {
 				// all rows were filtered out by the table filters
@@ -436,10 +518,6 @@ void RowGroup::TemplatedScan(TransactionData transaction, RowGroupScanState &sta
 					}
 				}
 			}
-			auto end_time = high_resolution_clock::now();
-			if (adaptive_filter && table_filters->filters.size() > 1) {
-				adaptive_filter->AdaptRuntimeStatistics(duration_cast<duration<double>>(end_time - start_time).count());
-			}
 			D_ASSERT(approved_tuple_count > 0);
 			count = approved_tuple_count;
 		}
@@ -491,6 +569,30 @@ idx_t RowGroup::GetSelVector(TransactionData transaction, idx_t vector_idx, Sele
 	return info->GetSelVector(transaction, sel_vector, max_count);
 }
 
+idx_t RowGroup::GetVisibleCount(TransactionData transaction) {
+	SelectionVector sel_vector(STANDARD_VECTOR_SIZE);
+	idx_t visible_count = 0;
+	for (idx_t vector_idx = 0; vector_idx * STANDARD_VECTOR_SIZE < count; vector_idx++) {
+		idx_t max_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - vector_idx * STANDARD_VECTOR_SIZE);
+		visible_count += GetSelVector(transaction, vector_idx, sel_vector, max_count);
+	}
+	return visible_count;
+}
+
+idx_t RowGroup::GetPermanentlyDeletedCount() {
+	auto &transaction_manager = TransactionManager::Get(db);
+	auto lowest_active_start = transaction_manager.LowestActiveStart();
+	auto lowest_active_id = transaction_manager.LowestActiveId();
+	SelectionVector sel_vector(STANDARD_VECTOR_SIZE);
+	idx_t deleted_count = 0;
+	for (idx_t vector_idx = 0; vector_idx * STANDARD_VECTOR_SIZE < count; vector_idx++) {
+		idx_t max_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - vector_idx * STANDARD_VECTOR_SIZE);
+		deleted_count +=
+		    max_count - GetCommittedSelVector(lowest_active_start, lowest_active_id, vector_idx, sel_vector, max_count);
+	}
+	return deleted_count;
+}
+
 idx_t RowGroup::GetCommittedSelVector(transaction_t start_time, transaction_t transaction_id, idx_t vector_idx,
                                       SelectionVector &sel_vector, idx_t max_count) {
 	lock_guard<mutex> lock(row_group_lock);
@@ -618,6 +720,7 @@ void RowGroup::InitializeAppend(RowGroupAppendState &append_state) {
 }
 
 void RowGroup::Append(RowGroupAppendState &state, DataChunk &chunk, idx_t append_count) {
+	InvalidateBloomFilters();
 	// append to the current row_group
 	for (idx_t i = 0; i < columns.size(); i++) {
 		columns[i]->Append(*stats[i]->statistics, state.states[i], chunk.data[i], append_count);
@@ -636,6 +739,7 @@ void RowGroup::Update(TransactionData transaction, DataChunk &update_chunk, row_
 		auto column = column_ids[i];
 		D_ASSERT(column.index != COLUMN_IDENTIFIER_ROW_ID);
 		D_ASSERT(columns[column.index]->type.id() == update_chunk.data[i].GetType().id());
+		InvalidateBloomFilters(column.index);
 		if (offset > 0) {
 			Vector sliced_vector(update_chunk.data[i], offset, offset + count);
 			sliced_vector.Flatten(count);
@@ -655,6 +759,7 @@ void RowGroup::UpdateColumn(TransactionData transaction, DataChunk &updates, Vec
 	auto primary_column_idx = column_path[0];
 	D_ASSERT(primary_column_idx != COLUMN_IDENTIFIER_ROW_ID);
 	D_ASSERT(primary_column_idx < columns.size());
+	InvalidateBloomFilters(primary_column_idx);
 	columns[primary_column_idx]->UpdateColumn(transaction, column_path, updates.data[0], ids, updates.size(), 1);
 	MergeStatistics(primary_column_idx, *columns[primary_column_idx]->GetUpdateStatistics());
 }
@@ -666,6 +771,11 @@ unique_ptr<BaseStatistics> RowGroup::GetStatistics(idx_t column_idx) {
 	return stats[column_idx]->statistics->Copy();
 }
 
+bool RowGroup::HasUpdates(idx_t column_idx) {
+	D_ASSERT(column_idx < columns.size());
+	return columns[column_idx]->HasUpdates();
+}
+
 void RowGroup::MergeStatistics(idx_t column_idx, const BaseStatistics &other) {
 	D_ASSERT(column_idx < stats.size());
 
@@ -680,6 +790,43 @@ void RowGroup::MergeIntoStatistics(idx_t column_idx, BaseStatistics &other) {
 	other.Merge(*stats[column_idx]->statistics);
 }
 
+shared_ptr<ColumnBloomFilter> RowGroup::GetBloomFilter(idx_t column_idx) {
+	lock_guard<mutex> slock(stats_lock);
+	if (column_idx >= bloom_filters.size()) {
+		return nullptr;
+	}
+	return bloom_filters[column_idx];
+}
+
+void RowGroup::InvalidateBloomFilters(idx_t column_idx) {
+	lock_guard<mutex> slock(stats_lock);
+	if (column_idx == DConstants::INVALID_INDEX) {
+		bloom_filters.clear();
+	} else if (column_idx < bloom_filters.size()) {
+		bloom_filters[column_idx].reset();
+	}
+}
+
+unique_ptr<ColumnBloomFilter> RowGroup::BuildBloomFilter(idx_t column_idx) {
+	auto &column = *columns[column_idx];
+	auto bloom_filter = make_unique<ColumnBloomFilter>(count);
+
+	ColumnScanState scan_state;
+	column.InitializeScan(scan_state);
+	Vector hashes(LogicalType::HASH);
+	for (idx_t vector_idx = 0; vector_idx * STANDARD_VECTOR_SIZE < count; vector_idx++) {
+		Vector result(column.type);
+		auto scan_count = column.ScanCommitted(vector_idx, scan_state, result, true);
+		VectorOperations::Hash(result, hashes, scan_count);
+		bloom_filter->Insert(hashes, scan_count);
+	}
+	if (!bloom_filter->Finalize()) {
+		// too many distinct values for the filter to rule out anything
+		return nullptr;
+	}
+	return bloom_filter;
+}
+
 RowGroupWriteData RowGroup::WriteToDisk(PartialBlockManager &manager,
                                         const vector<CompressionType> &compression_types) {
 	RowGroupWriteData result;
@@ -694,8 +841,19 @@ RowGroupWriteData RowGroup::WriteToDisk(PartialBlockManager &manager,
 	// Some of these columns are composite (list, struct). The data is written
 	// first sequentially, and the pointers are written later, so that the
 	// pointers all end up densely packed, and thus more cache-friendly.
+	auto build_bloom_filters = DBConfig::GetConfig(db).options.checkpoint_bloom_filters;
 	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
 		auto &column = columns[column_idx];
+		shared_ptr<ColumnBloomFilter> bloom_filter;
+		if (build_bloom_filters && ColumnBloomFilter::SupportsType(column->type)) {
+			// the filter is dropped when the column changes: an existing filter is still up-to-date
+			bloom_filter = GetBloomFilter(column_idx);
+			if (!bloom_filter) {
+				bloom_filter = BuildBloomFilter(column_idx);
+			}
+		}
+		result.bloom_filters.push_back(move(bloom_filter));
+
 		ColumnCheckpointInfo checkpoint_info {compression_types[column_idx]};
 		auto checkpoint_state = column->Checkpoint(*this, manager, checkpoint_info);
 		D_ASSERT(checkpoint_state);
@@ -710,19 +868,19 @@ RowGroupWriteData RowGroup::WriteToDisk(PartialBlockManager &manager,
 	return result;
 }
 
-RowGroupPointer RowGroup::Checkpoint(RowGroupWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats) {
+RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData result, RowGroupWriter &writer,
+                                     vector<unique_ptr<BaseStatistics>> &global_stats) {
 	RowGroupPointer row_group_pointer;
 
-	vector<CompressionType> compression_types;
-	compression_types.reserve(columns.size());
-	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
-		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
-	}
-	auto result = WriteToDisk(writer.GetPartialBlockManager(), compression_types);
 	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
 		global_stats[column_idx]->Merge(*result.statistics[column_idx]);
 	}
 	row_group_pointer.statistics = move(result.statistics);
+	{
+		lock_guard<mutex> slock(stats_lock);
+		bloom_filters = result.bloom_filters;
+	}
+	row_group_pointer.bloom_filters = move(result.bloom_filters);
 
 	// construct the row group pointer and write the column meta data to disk
 	D_ASSERT(result.states.size() == columns.size());
@@ -804,37 +962,89 @@ void RowGroup::Serialize(RowGroupPointer &pointer, Serializer &main_serializer)
 		serializer.Write<uint64_t>(data_pointer.offset);
 	}
 	CheckpointDeletes(pointer.versions.get(), serializer);
+	// the Bloom filters are optional fields, so row groups that were written without them can still be read
+	for (auto &bloom_filter : pointer.bloom_filters) {
+		writer.WriteField<bool>(bloom_filter ? true : false);
+		if (bloom_filter) {
+			writer.WriteSerializable(*bloom_filter);
+		}
+	}
 	writer.Finalize();
 }
 
-RowGroupPointer RowGroup::Deserialize(Deserializer &main_source, const ColumnList &columns) {
+RowGroupPointer RowGroup::Deserialize(Deserializer &main_source, const vector<LogicalType> &types) {
 	RowGroupPointer result;
 
 	FieldReader reader(main_source);
 	result.row_start = reader.ReadRequired<uint64_t>();
 	result.tuple_count = reader.ReadRequired<uint64_t>();
 
-	auto physical_columns = columns.PhysicalColumnCount();
+	auto physical_columns = types.size();
 	result.data_pointers.reserve(physical_columns);
 	result.statistics.reserve(physical_columns);
 
 	auto &source = reader.GetSource();
-	for (auto &col : columns.Physical()) {
-		auto stats = BaseStatistics::Deserialize(source, col.Type());
+	for (auto &type : types) {
+		auto stats = BaseStatistics::Deserialize(source, type);
 		result.statistics.push_back(move(stats));
 	}
-	for (idx_t i = 0; i < columns.PhysicalColumnCount(); i++) {
+	for (idx_t i = 0; i < physical_columns; i++) {
 		BlockPointer pointer;
 		pointer.block_id = source.Read<block_id_t>();
 		pointer.offset = source.Read<uint64_t>();
 		result.data_pointers.push_back(pointer);
 	}
 	result.versions = DeserializeDeletes(source);
+	for (idx_t i = 0; i < physical_columns; i++) {
+		shared_ptr<ColumnBloomFilter> bloom_filter;
+		if (reader.ReadField<bool>(false)) {
+			bloom_filter = reader.ReadRequiredSerializable<ColumnBloomFilter>();
+		}
+		result.bloom_filters.push_back(move(bloom_filter));
+	}
 
 	reader.Finalize();
 	return result;
 }
 
+bool RowGroup::IsPersistent() {
+	for (auto &column : columns) {
+		if (!column->IsPersistent()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void RowGroup::SerializePersistent(Serializer &serializer, vector<block_id_t> &blocks) {
+	D_ASSERT(IsPersistent());
+	serializer.Write<uint64_t>(start);
+	serializer.Write<uint64_t>(count);
+	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
+		GetStatistics(column_idx)->Serialize(serializer);
+	}
+	for (auto &column : columns) {
+		column->SerializePersistentColumn(serializer, blocks);
+	}
+}
+
+unique_ptr<RowGroup> RowGroup::DeserializePersistent(DatabaseInstance &db, BlockManager &block_manager,
+                                                     DataTableInfo &table_info, const vector<LogicalType> &types,
+                                                     Deserializer &source) {
+	auto row_start = source.Read<uint64_t>();
+	auto tuple_count = source.Read<uint64_t>();
+	auto row_group = make_unique<RowGroup>(db, block_manager, table_info, row_start, tuple_count);
+	for (auto &type : types) {
+		row_group->stats.push_back(make_shared<SegmentStatistics>(type, BaseStatistics::Deserialize(source, type)));
+	}
+	for (idx_t column_idx = 0; column_idx < types.size(); column_idx++) {
+		row_group->columns.push_back(
+		    ColumnData::Deserialize(block_manager, table_info, column_idx, row_start, source, types[column_idx], nullptr));
+	}
+	row_group->Verify();
+	return row_group;
+}
+
 //===--------------------------------------------------------------------===//
 // GetStorageInfo
 //===--------------------------------------------------------------------===//
@@ -2,21 +2,30 @@
 #include "duckdb/storage/table/persistent_table_data.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/task_counter.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/common/preserved_error.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
+#include "duckdb/storage/checkpoint/table_data_reader.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
+#include "duckdb/storage/meta_block_reader.hpp"
+#include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
 
 namespace duckdb {
 
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(move(info_p)), types(move(types_p)),
-      row_start(row_start_p) {
+      row_start(row_start_p), appends_reverted(false), lazy_load(false) {
 	row_groups = make_shared<SegmentTree>();
 }
 
 idx_t RowGroupCollection::GetTotalRows() const {
+	((RowGroupCollection &)*this).LoadTableData();
 	return total_rows.load();
 }
 
@@ -45,6 +54,30 @@ void RowGroupCollection::Initialize(PersistentTableData &data) {
 	stats.Initialize(types, data);
 }
 
+void RowGroupCollection::InitializeLazy(BlockPointer pointer) {
+	D_ASSERT(this->row_start == 0);
+	table_pointer = pointer;
+	lazy_load = true;
+}
+
+void RowGroupCollection::LoadTableData() {
+	if (!lazy_load) {
+		return;
+	}
+	lock_guard<mutex> load_guard(load_lock);
+	if (!lazy_load) {
+		// another thread loaded the table data in the meantime
+		return;
+	}
+	PersistentTableData data(types.size());
+	MetaBlockReader reader(block_manager, table_pointer.block_id);
+	reader.offset = table_pointer.offset;
+	TableDataReader data_reader(reader, types, data);
+	data_reader.ReadTableData();
+	Initialize(data);
+	lazy_load = false;
+}
+
 void RowGroupCollection::InitializeEmpty() {
 	stats.InitializeEmpty(types);
 }
@@ -56,12 +89,31 @@ void RowGroupCollection::AppendRowGroup(SegmentLock &l, idx_t start_row) {
 	row_groups->AppendSegment(l, move(new_row_group));
 }
 
+void RowGroupCollection::AddRowGroup(unique_ptr<RowGroup> row_group) {
+	LoadTableData();
+	D_ASSERT(row_group->start == row_start + total_rows);
+	for (idx_t column_idx = 0; column_idx < types.size(); column_idx++) {
+		stats.MergeStats(column_idx, *row_group->GetStatistics(column_idx));
+	}
+	total_rows += row_group->count;
+	row_groups->AppendSegment(move(row_group));
+}
+
+RowGroup *RowGroupCollection::GetRowGroupForRow(idx_t row_number) {
+	LoadTableData();
+	return (RowGroup *)row_groups->GetSegment(row_number);
+}
+
 RowGroup *RowGroupCollection::GetRowGroup(int64_t index) {
+	LoadTableData();
 	return (RowGroup *)row_groups->GetSegmentByIndex(index);
 }
 
 void RowGroupCollection::Verify() {
 #ifdef DEBUG
+	if (lazy_load) {
+		return;
+	}
 	idx_t current_total_rows = 0;
 	row_groups->Verify();
 	for (auto segment = row_groups->GetRootSegment(); segment; segment = segment->Next()) {
@@ -79,6 +131,7 @@ void RowGroupCollection::Verify() {
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::InitializeScan(CollectionScanState &state, const vector<column_t> &column_ids,
                                         TableFilterSet *table_filters) {
+	LoadTableData();
 	auto row_group = (RowGroup *)row_groups->GetRootSegment();
 	D_ASSERT(row_group);
 	state.max_row = row_start + total_rows;
@@ -88,11 +141,13 @@ void RowGroupCollection::InitializeScan(CollectionScanState &state, const vector
 }
 
 void RowGroupCollection::InitializeCreateIndexScan(CreateIndexScanState &state) {
+	LoadTableData();
 	state.segment_lock = row_groups->Lock();
 }
 
 void RowGroupCollection::InitializeScanWithOffset(CollectionScanState &state, const vector<column_t> &column_ids,
                                                   idx_t start_row, idx_t end_row) {
+	LoadTableData();
 	auto row_group = (RowGroup *)row_groups->GetSegment(start_row);
 	D_ASSERT(row_group);
 	state.max_row = end_row;
@@ -109,37 +164,48 @@ bool RowGroupCollection::InitializeScanInRowGroup(CollectionScanState &state, Ro
 }
 
 void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &state) {
+	LoadTableData();
 	state.current_row_group = (RowGroup *)row_groups->GetRootSegment();
 	state.vector_index = 0;
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
 }
 
+//! Returns the number of vectors that the next morsel of a parallel scan consists of
+static idx_t GetMorselVectorCount(ClientContext &context, ParallelCollectionScanState &state) {
+	if (ClientConfig::GetConfig(context).verify_parallelism) {
+		return 1;
+	}
+	auto next_row = state.current_row_group->start + state.vector_index * STANDARD_VECTOR_SIZE;
+	auto remaining_rows = state.max_row > next_row ? state.max_row - next_row : 0;
+	idx_t thread_count = TaskScheduler::GetScheduler(context).NumberOfThreads();
+	if (remaining_rows >= thread_count * RowGroup::ROW_GROUP_SIZE) {
+		// there is a row group left for every thread: hand out entire row groups
+		return RowGroup::ROW_GROUP_VECTOR_COUNT;
+	}
+	// the tail of the scan: split the remaining rows up into (at least) two morsels per thread, so that the threads
+	// that are done early (e.g. because a filter pruned their rows) can help out with the rest
+	auto remaining_vectors = (remaining_rows + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+	auto morsel_vectors = remaining_vectors / (2 * thread_count);
+	return MaxValue<idx_t>(MinValue<idx_t>(morsel_vectors, RowGroup::ROW_GROUP_VECTOR_COUNT),
+	                       RowGroupCollection::MIN_MORSEL_VECTOR_COUNT);
+}
+
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
                                           CollectionScanState &scan_state) {
 	while (state.current_row_group && state.current_row_group->count > 0) {
-		idx_t vector_index;
-		idx_t max_row;
-		if (ClientConfig::GetConfig(context).verify_parallelism) {
-			vector_index = state.vector_index;
-			max_row = state.current_row_group->start +
-			          MinValue<idx_t>(state.current_row_group->count,
-			                          STANDARD_VECTOR_SIZE * state.vector_index + STANDARD_VECTOR_SIZE);
-			D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
-		} else {
-			vector_index = 0;
-			max_row = state.current_row_group->start + state.current_row_group->count;
-		}
+		D_ASSERT(state.vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
+		auto vector_index = state.vector_index;
+		auto morsel_vectors = GetMorselVectorCount(context, state);
+		idx_t max_row = state.current_row_group->start +
+		                MinValue<idx_t>(state.current_row_group->count,
+		                                STANDARD_VECTOR_SIZE * (state.vector_index + morsel_vectors));
 		max_row = MinValue<idx_t>(max_row, state.max_row);
 		bool need_to_scan = InitializeScanInRowGroup(scan_state, state.current_row_group, vector_index, max_row);
-		if (ClientConfig::GetConfig(context).verify_parallelism) {
-			state.vector_index++;
-			if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
-				state.current_row_group = (RowGroup *)state.current_row_group->Next();
-				state.vector_index = 0;
-			}
-		} else {
+		state.vector_index += morsel_vectors;
+		if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
 			state.current_row_group = (RowGroup *)state.current_row_group->Next();
+			state.vector_index = 0;
 		}
 		scan_state.batch_index = ++state.batch_index;
 		if (!need_to_scan) {
@@ -151,6 +217,43 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 	return false;
 }
 
+idx_t RowGroupCollection::SkipParallelScan(TransactionData transaction, ParallelCollectionScanState &state,
+                                           idx_t count) {
+	D_ASSERT(state.batch_index == 0);
+	SelectionVector sel_vector(STANDARD_VECTOR_SIZE);
+	idx_t skipped = 0;
+	while (state.current_row_group && state.current_row_group->count > 0) {
+		auto row_group = state.current_row_group;
+		auto row_group_end = row_group->start + row_group->count;
+		if (state.vector_index == 0) {
+			// skip the entire row group if all of its visible rows fit in the offset
+			// note that rows appended after the scan was initialized are not visible to the transaction
+			auto visible_count = row_group->GetVisibleCount(transaction);
+			if (skipped + visible_count <= count) {
+				skipped += visible_count;
+				state.current_row_group = (RowGroup *)row_group->Next();
+				continue;
+			}
+		}
+		// the row group contains the first row we cannot skip: skip the vectors in front of it
+		// we always leave the last vector of the row group (or of the scan) to the scan
+		auto scan_end = MinValue<idx_t>(row_group_end, state.max_row);
+		auto vector_start = row_group->start + state.vector_index * STANDARD_VECTOR_SIZE;
+		auto vector_end = MinValue<idx_t>(scan_end, vector_start + STANDARD_VECTOR_SIZE);
+		if (vector_end >= scan_end) {
+			break;
+		}
+		auto visible_count =
+		    row_group->GetSelVector(transaction, state.vector_index, sel_vector, vector_end - vector_start);
+		if (skipped + visible_count > count) {
+			break;
+		}
+		skipped += visible_count;
+		state.vector_index++;
+	}
+	return skipped;
+}
+
 bool RowGroupCollection::Scan(Transaction &transaction, const vector<column_t> &column_ids,
                               const std::function<bool(DataChunk &chunk)> &fun) {
 	vector<LogicalType> scan_types;
@@ -191,6 +294,7 @@ bool RowGroupCollection::Scan(Transaction &transaction, const std::function<bool
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::Fetch(TransactionData transaction, DataChunk &result, const vector<column_t> &column_ids,
                                Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state) {
+	LoadTableData();
 	// figure out which row_group to fetch from
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
 	idx_t count = 0;
@@ -227,6 +331,7 @@ TableAppendState::~TableAppendState() {
 }
 
 bool RowGroupCollection::IsEmpty() const {
+	((RowGroupCollection &)*this).LoadTableData();
 	auto l = row_groups->Lock();
 	return IsEmpty(l);
 }
@@ -236,6 +341,7 @@ bool RowGroupCollection::IsEmpty(SegmentLock &l) const {
 }
 
 void RowGroupCollection::InitializeAppend(TransactionData transaction, TableAppendState &state, idx_t append_count) {
+	LoadTableData();
 	state.row_start = total_rows;
 	state.current_row = state.row_start;
 	state.total_append_count = 0;
@@ -370,6 +476,8 @@ void RowGroupCollection::RevertAppendInternal(idx_t start_row, idx_t count) {
 		throw InternalException("Interleaved appends: this should no longer happen");
 	}
 	total_rows = start_row;
+	// the statistics are not reverted: from now on they are only a bound of the data
+	appends_reverted = true;
 
 	auto l = row_groups->Lock();
 	// find the segment index that the current row belongs to
@@ -385,6 +493,7 @@ void RowGroupCollection::RevertAppendInternal(idx_t start_row, idx_t count) {
 }
 
 void RowGroupCollection::MergeStorage(RowGroupCollection &data) {
+	LoadTableData();
 	D_ASSERT(data.types == types);
 	auto index = row_start + total_rows.load();
 	for (auto segment = data.row_groups->GetRootSegment(); segment; segment = segment->Next()) {
@@ -401,6 +510,7 @@ void RowGroupCollection::MergeStorage(RowGroupCollection &data) {
 // Delete
 //===--------------------------------------------------------------------===//
 idx_t RowGroupCollection::Delete(TransactionData transaction, DataTable *table, row_t *ids, idx_t count) {
+	LoadTableData();
 	idx_t delete_count = 0;
 	// delete is in the row groups
 	// we need to figure out for each id to which row group it belongs
@@ -432,6 +542,7 @@ idx_t RowGroupCollection::Delete(TransactionData transaction, DataTable *table,
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::Update(TransactionData transaction, row_t *ids, const vector<PhysicalIndex> &column_ids,
                                 DataChunk &updates) {
+	LoadTableData();
 	idx_t pos = 0;
 	do {
 		idx_t start = pos;
@@ -462,6 +573,7 @@ void RowGroupCollection::Update(TransactionData transaction, row_t *ids, const v
 }
 
 void RowGroupCollection::RemoveFromIndexes(TableIndexList &indexes, Vector &row_identifiers, idx_t count) {
+	LoadTableData();
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
 
 	// figure out which row_group to fetch from
@@ -504,6 +616,7 @@ void RowGroupCollection::RemoveFromIndexes(TableIndexList &indexes, Vector &row_
 
 void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_ids, const vector<column_t> &column_path,
                                       DataChunk &updates) {
+	LoadTableData();
 	auto first_id = FlatVector::GetValue<row_t>(row_ids, 0);
 	if (first_id >= MAX_ROW_ID) {
 		throw NotImplementedException("Cannot update a column-path on transaction local data");
@@ -519,19 +632,172 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
+struct CollectionCheckpointState {
+	CollectionCheckpointState(TaskScheduler &scheduler, vector<CompressionType> compression_types_p)
+	    : compression_types(move(compression_types_p)), counter(scheduler) {
+	}
+
+	vector<RowGroup *> row_groups;
+	vector<unique_ptr<RowGroupWriter>> writers;
+	vector<RowGroupWriteData> write_data;
+	vector<CompressionType> compression_types;
+	TaskCounter counter;
+
+	mutex error_lock;
+	PreservedError error;
+
+public:
+	void PushError(PreservedError new_error) {
+		lock_guard<mutex> guard(error_lock);
+		if (!error) {
+			error = move(new_error);
+		}
+	}
+};
+
+//! Compresses the columns of a single row group and writes them to disk
+class RowGroupCheckpointTask : public Task {
+public:
+	RowGroupCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t index)
+	    : checkpoint_state(checkpoint_state), index(index) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			auto &row_group = *checkpoint_state.row_groups[index];
+			auto &partial_block_manager = checkpoint_state.writers[index]->GetPartialBlockManager();
+			checkpoint_state.write_data[index] =
+			    row_group.WriteToDisk(partial_block_manager, checkpoint_state.compression_types);
+		} catch (Exception &ex) {
+			checkpoint_state.PushError(PreservedError(ex));
+		} catch (std::exception &ex) {
+			checkpoint_state.PushError(PreservedError(ex));
+		} catch (...) { // LCOV_EXCL_START
+			checkpoint_state.PushError(PreservedError("Unknown exception during checkpoint!"));
+		} // LCOV_EXCL_STOP
+		checkpoint_state.counter.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	CollectionCheckpointState &checkpoint_state;
+	idx_t index;
+};
+
 void RowGroupCollection::Checkpoint(TableDataWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats) {
+	LoadTableData();
+	vector<CompressionType> compression_types;
+	compression_types.reserve(types.size());
+	for (idx_t column_idx = 0; column_idx < types.size(); column_idx++) {
+		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
+	}
+	CollectionCheckpointState checkpoint_state(TaskScheduler::GetScheduler(info->db), move(compression_types));
 	for (auto row_group = (RowGroup *)row_groups->GetRootSegment(); row_group;
 	     row_group = (RowGroup *)row_group->Next()) {
-		auto rowg_writer = writer.GetRowGroupWriter(*row_group);
-		auto pointer = row_group->Checkpoint(*rowg_writer, global_stats);
+		checkpoint_state.row_groups.push_back(row_group);
+		checkpoint_state.writers.push_back(writer.GetRowGroupWriter(*row_group));
+	}
+	// compress and write the columns of the row groups in parallel
+	// the partial block manager is shared, so small segments of different row groups can still end up in one block
+	checkpoint_state.write_data.resize(checkpoint_state.row_groups.size());
+	for (idx_t i = 0; i < checkpoint_state.row_groups.size(); i++) {
+		checkpoint_state.counter.AddTask(make_unique<RowGroupCheckpointTask>(checkpoint_state, i));
+	}
+	checkpoint_state.counter.Finish();
+	if (checkpoint_state.error) {
+		checkpoint_state.error.Throw();
+	}
+	// now write the metadata of the row groups in order
+	for (idx_t i = 0; i < checkpoint_state.row_groups.size(); i++) {
+		auto &row_group = *checkpoint_state.row_groups[i];
+		auto &rowg_writer = checkpoint_state.writers[i];
+		auto pointer = row_group.Checkpoint(move(checkpoint_state.write_data[i]), *rowg_writer, global_stats);
 		writer.AddRowGroup(move(pointer), move(rowg_writer));
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Vacuum
+//===--------------------------------------------------------------------===//
+void RowGroupCollection::VacuumDeletes() {
+	LoadTableData();
+	vector<RowGroup *> segments;
+	vector<idx_t> deleted_counts;
+	for (auto row_group = (RowGroup *)row_groups->GetRootSegment(); row_group;
+	     row_group = (RowGroup *)row_group->Next()) {
+		segments.push_back(row_group);
+		deleted_counts.push_back(row_group->GetPermanentlyDeletedCount());
+	}
+	// find the first row group from which at least half of the rows until the end of the collection are deleted
+	idx_t vacuum_idx = segments.size();
+	idx_t suffix_count = 0;
+	idx_t suffix_deleted = 0;
+	for (idx_t i = segments.size(); i > 0; i--) {
+		suffix_count += segments[i - 1]->count;
+		suffix_deleted += deleted_counts[i - 1];
+		if (suffix_deleted > 0 && suffix_deleted * 2 >= suffix_count) {
+			vacuum_idx = i - 1;
+		}
+	}
+	if (vacuum_idx >= segments.size()) {
+		// not enough deleted rows to be worth rewriting anything
+		return;
+	}
+	auto vacuum_start = segments[vacuum_idx]->start;
+
+	// copy the rows that are not deleted into a new set of row groups
+	vector<column_t> column_ids;
+	for (idx_t i = 0; i < types.size(); i++) {
+		column_ids.push_back(i);
+	}
+	TableScanState scan_state;
+	scan_state.Initialize(column_ids);
+	scan_state.table_state.max_row = row_start + total_rows;
+	segments[vacuum_idx]->InitializeScan(scan_state.table_state.row_group_state);
+
+	auto vacuumed = make_unique<RowGroupCollection>(info, block_manager, types, vacuum_start);
+	vacuumed->InitializeEmpty();
+	TableAppendState append_state;
+	vacuumed->InitializeAppend(append_state);
+
+	DataChunk chunk;
+	chunk.Initialize(GetAllocator(), types);
+	while (true) {
+		chunk.Reset();
+		scan_state.table_state.ScanCommitted(chunk,
+		                                     TableScanType::TABLE_SCAN_COMMITTED_ROWS_OMIT_PERMANENTLY_DELETED);
+		if (chunk.size() == 0) {
+			break;
+		}
+		vacuumed->Append(chunk, append_state);
+	}
+	vacuumed->FinalizeAppend(TransactionData(0, 0), append_state);
+
+	// the blocks of the old row groups can be reused after the checkpoint
+	for (idx_t i = vacuum_idx; i < segments.size(); i++) {
+		segments[i]->CommitDrop();
+	}
+	{
+		auto l = row_groups->Lock();
+		auto nodes = row_groups->MoveSegments(l);
+		for (idx_t i = 0; i < vacuum_idx; i++) {
+			row_groups->AppendSegment(l, move(nodes[i].node));
+		}
+		if (vacuum_idx > 0) {
+			segments[vacuum_idx - 1]->next = nullptr;
+		}
+	}
+	total_rows = vacuum_start - row_start;
+	if (vacuumed->GetTotalRows() > 0) {
+		MergeStorage(*vacuumed);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // CommitDrop
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::CommitDropColumn(idx_t index) {
+	LoadTableData();
 	auto segment = (RowGroup *)row_groups->GetRootSegment();
 	while (segment) {
 		segment->CommitDropColumn(index);
@@ -540,6 +806,7 @@ void RowGroupCollection::CommitDropColumn(idx_t index) {
 }
 
 void RowGroupCollection::CommitDropTable() {
+	LoadTableData();
 	auto segment = (RowGroup *)row_groups->GetRootSegment();
 	while (segment) {
 		segment->CommitDrop();
@@ -551,6 +818,7 @@ void RowGroupCollection::CommitDropTable() {
 // GetStorageInfo
 //===--------------------------------------------------------------------===//
 vector<vector<Value>> RowGroupCollection::GetStorageInfo() {
+	LoadTableData();
 	vector<vector<Value>> result;
 
 	auto row_group = (RowGroup *)row_groups->GetRootSegment();
@@ -570,10 +838,12 @@ vector<vector<Value>> RowGroupCollection::GetStorageInfo() {
 //===--------------------------------------------------------------------===//
 shared_ptr<RowGroupCollection> RowGroupCollection::AddColumn(ClientContext &context, ColumnDefinition &new_column,
                                                              Expression *default_value) {
+	LoadTableData();
 	idx_t new_column_idx = types.size();
 	auto new_types = types;
 	new_types.push_back(new_column.GetType());
 	auto result = make_shared<RowGroupCollection>(info, block_manager, move(new_types), row_start, total_rows.load());
+	result->appends_reverted = appends_reverted.load();
 
 	ExpressionExecutor executor(context);
 	DataChunk dummy_chunk;
@@ -602,11 +872,13 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AddColumn(ClientContext &cont
 }
 
 shared_ptr<RowGroupCollection> RowGroupCollection::RemoveColumn(idx_t col_idx) {
+	LoadTableData();
 	D_ASSERT(col_idx < types.size());
 	auto new_types = types;
 	new_types.erase(new_types.begin() + col_idx);
 
 	auto result = make_shared<RowGroupCollection>(info, block_manager, move(new_types), row_start, total_rows.load());
+	result->appends_reverted = appends_reverted.load();
 	result->stats.InitializeRemoveColumn(stats, col_idx);
 
 	auto current_row_group = (RowGroup *)row_groups->GetRootSegment();
@@ -621,11 +893,13 @@ shared_ptr<RowGroupCollection> RowGroupCollection::RemoveColumn(idx_t col_idx) {
 shared_ptr<RowGroupCollection> RowGroupCollection::AlterType(ClientContext &context, idx_t changed_idx,
                                                              const LogicalType &target_type,
                                                              vector<column_t> bound_columns, Expression &cast_expr) {
+	LoadTableData();
 	D_ASSERT(changed_idx < types.size());
 	auto new_types = types;
 	new_types[changed_idx] = target_type;
 
 	auto result = make_shared<RowGroupCollection>(info, block_manager, move(new_types), row_start, total_rows.load());
+	result->appends_reverted = appends_reverted.load();
 	result->stats.InitializeAlterType(stats, changed_idx, target_type);
 
 	vector<LogicalType> scan_types;
@@ -661,6 +935,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AlterType(ClientContext &cont
 }
 
 void RowGroupCollection::VerifyNewConstraint(DataTable &parent, const BoundConstraint &constraint) {
+	LoadTableData();
 	if (total_rows == 0) {
 		return;
 	}
@@ -698,10 +973,146 @@ void RowGroupCollection::VerifyNewConstraint(DataTable &parent, const BoundConst
 // Statistics
 //===--------------------------------------------------------------------===//
 unique_ptr<BaseStatistics> RowGroupCollection::CopyStats(column_t column_id) {
+	LoadTableData();
 	return stats.CopyStats(column_id);
 }
 
+bool RowGroupCollection::GetExactStatistics(TransactionData transaction, const vector<column_t> &column_ids,
+                                            idx_t &visible_count, vector<Value> &min_values,
+                                            vector<Value> &max_values) {
+	LoadTableData();
+	if (!column_ids.empty() && appends_reverted) {
+		return false;
+	}
+	visible_count = 0;
+	min_values.clear();
+	max_values.clear();
+	for (auto &column_id : column_ids) {
+		min_values.emplace_back(types[column_id]);
+		max_values.emplace_back(types[column_id]);
+	}
+	for (auto row_group = (RowGroup *)row_groups->GetRootSegment(); row_group;
+	     row_group = (RowGroup *)row_group->Next()) {
+		// the statistics are read before the updates and the version info: values that are concurrently updated or
+		// appended are only merged into the statistics after they show up there
+		for (idx_t i = 0; i < column_ids.size(); i++) {
+			auto stats = row_group->GetStatistics(column_ids[i]);
+			if (row_group->HasUpdates(column_ids[i])) {
+				return false;
+			}
+			auto &numeric_stats = (NumericStatistics &)*stats;
+			if (numeric_stats.min.IsNull() || numeric_stats.max.IsNull()) {
+				return false;
+			}
+			if (numeric_stats.min > numeric_stats.max) {
+				// the statistics are still empty: no (non-NULL) values in this row group
+				continue;
+			}
+			if (min_values[i].IsNull() || numeric_stats.min < min_values[i]) {
+				min_values[i] = numeric_stats.min;
+			}
+			if (max_values[i].IsNull() || numeric_stats.max > max_values[i]) {
+				max_values[i] = numeric_stats.max;
+			}
+		}
+		auto row_group_count = row_group->GetVisibleCount(transaction);
+		if (!column_ids.empty() && row_group_count != row_group->count) {
+			// deleted or invisible rows: the statistics include values that the transaction cannot see
+			return false;
+		}
+		visible_count += row_group_count;
+	}
+	return true;
+}
+
+static bool TryGetNumericValue(const Value &value, double &result) {
+	switch (value.type().InternalType()) {
+	case PhysicalType::INT8:
+		result = value.GetValueUnsafe<int8_t>();
+		return true;
+	case PhysicalType::INT16:
+		result = value.GetValueUnsafe<int16_t>();
+		return true;
+	case PhysicalType::INT32:
+		result = value.GetValueUnsafe<int32_t>();
+		return true;
+	case PhysicalType::INT64:
+		result = value.GetValueUnsafe<int64_t>();
+		return true;
+	case PhysicalType::INT128:
+		result = Hugeint::Cast<double>(value.GetValueUnsafe<hugeint_t>());
+		return true;
+	case PhysicalType::UINT8:
+		result = value.GetValueUnsafe<uint8_t>();
+		return true;
+	case PhysicalType::UINT16:
+		result = value.GetValueUnsafe<uint16_t>();
+		return true;
+	case PhysicalType::UINT32:
+		result = value.GetValueUnsafe<uint32_t>();
+		return true;
+	case PhysicalType::UINT64:
+		result = value.GetValueUnsafe<uint64_t>();
+		return true;
+	case PhysicalType::FLOAT:
+		result = value.GetValueUnsafe<float>();
+		return Value::DoubleIsFinite(result);
+	case PhysicalType::DOUBLE:
+		result = value.GetValueUnsafe<double>();
+		return Value::DoubleIsFinite(result);
+	default:
+		return false;
+	}
+}
+
+double RowGroupCollection::EstimateRangeSelectivity(column_t column_id, const Value &lower, const Value &upper) {
+	LoadTableData();
+	if (!TypeIsNumeric(types[column_id].InternalType())) {
+		return -1;
+	}
+	double lower_bound = NumericLimits<double>::Minimum();
+	double upper_bound = NumericLimits<double>::Maximum();
+	if ((!lower.IsNull() && !TryGetNumericValue(lower, lower_bound)) ||
+	    (!upper.IsNull() && !TryGetNumericValue(upper, upper_bound))) {
+		return -1;
+	}
+	// the statistics of every row group form a bucket of an equi-depth-like histogram: its rows are assumed to be
+	// uniformly distributed between the min and the max of the row group
+	double total_count = 0;
+	double matching_count = 0;
+	for (auto row_group = (RowGroup *)row_groups->GetRootSegment(); row_group;
+	     row_group = (RowGroup *)row_group->Next()) {
+		auto stats = row_group->GetStatistics(column_id);
+		auto &numeric_stats = (NumericStatistics &)*stats;
+		double min_value, max_value;
+		if (numeric_stats.min.IsNull() || numeric_stats.max.IsNull() ||
+		    !TryGetNumericValue(numeric_stats.min, min_value) || !TryGetNumericValue(numeric_stats.max, max_value)) {
+			return -1;
+		}
+		total_count += row_group->count;
+		if (min_value > max_value) {
+			// no (non-NULL) values in this row group
+			continue;
+		}
+		auto low = MaxValue<double>(lower_bound, min_value);
+		auto high = MinValue<double>(upper_bound, max_value);
+		if (low > high) {
+			continue;
+		}
+		if (min_value == max_value) {
+			matching_count += row_group->count;
+		} else {
+			matching_count += row_group->count * (high - low) / (max_value - min_value);
+		}
+	}
+	if (total_count == 0) {
+		return -1;
+	}
+	return matching_count / total_count;
+}
+
 void RowGroupCollection::SetStatistics(column_t column_id, const std::function<void(BaseStatistics &)> &set_fun) {
+	LoadTableData();
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
 	auto stats_guard = stats.GetLock();
 	set_fun(*stats.GetStats(column_id).stats);
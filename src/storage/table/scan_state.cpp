@@ -5,15 +5,31 @@
 
 namespace duckdb {
 
-void TableScanState::Initialize(vector<column_t> column_ids, TableFilterSet *table_filters) {
+void TableScanState::Initialize(vector<column_t> column_ids, TableFilterSet *table_filters,
+                                DynamicTableFilterSet *dynamic_filters,
+                                shared_ptr<AdaptiveFilterStatistics> filter_statistics) {
 	this->column_ids = move(column_ids);
 	this->table_filters = table_filters;
+	this->dynamic_filters = dynamic_filters;
 	if (table_filters) {
 		D_ASSERT(table_filters->filters.size() > 0);
-		this->adaptive_filter = make_unique<AdaptiveFilter>(table_filters);
+		this->adaptive_filter = make_unique<AdaptiveFilter>(table_filters, move(filter_statistics));
 	}
 }
 
+void TableScanState::InitializeSample(double probability, int64_t seed) {
+	sample_probability = probability;
+	sample_random = make_unique<RandomEngine>(seed);
+}
+
+bool TableScanState::SkipSampledVector() {
+	if (!sample_random) {
+		return false;
+	}
+	// system sampling: we throw one dice per vector
+	return sample_random->NextRandom() > sample_probability;
+}
+
 const vector<column_t> &TableScanState::GetColumnIds() {
 	D_ASSERT(!column_ids.empty());
 	return column_ids;
@@ -24,6 +40,10 @@ TableFilterSet *TableScanState::GetFilters() {
 	return table_filters;
 }
 
+DynamicTableFilterSet *TableScanState::GetDynamicFilters() {
+	return dynamic_filters;
+}
+
 AdaptiveFilter *TableScanState::GetAdaptiveFilter() {
 	return adaptive_filter.get();
 }
@@ -64,10 +84,18 @@ TableFilterSet *RowGroupScanState::GetFilters() {
 	return parent.GetFilters();
 }
 
+DynamicTableFilterSet *RowGroupScanState::GetDynamicFilters() {
+	return parent.GetDynamicFilters();
+}
+
 AdaptiveFilter *RowGroupScanState::GetAdaptiveFilter() {
 	return parent.GetAdaptiveFilter();
 }
 
+bool RowGroupScanState::SkipSampledVector() {
+	return parent.SkipSampledVector();
+}
+
 idx_t RowGroupScanState::GetParentMaxRow() {
 	return parent.max_row;
 }
@@ -80,10 +108,18 @@ TableFilterSet *CollectionScanState::GetFilters() {
 	return parent.GetFilters();
 }
 
+DynamicTableFilterSet *CollectionScanState::GetDynamicFilters() {
+	return parent.GetDynamicFilters();
+}
+
 AdaptiveFilter *CollectionScanState::GetAdaptiveFilter() {
 	return parent.GetAdaptiveFilter();
 }
 
+bool CollectionScanState::SkipSampledVector() {
+	return parent.SkipSampledVector();
+}
+
 bool CollectionScanState::Scan(Transaction &transaction, DataChunk &result) {
 	auto current_row_group = row_group_state.row_group;
 	while (current_row_group) {
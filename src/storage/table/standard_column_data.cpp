@@ -66,6 +66,36 @@ idx_t StandardColumnData::Scan(TransactionData transaction, idx_t vector_index,
 	return scan_count;
 }
 
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                Vector &result, SelectionVector &sel, idx_t &count, const TableFilter &filter) {
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	idx_t scan_count;
+	if (!SelectVector(state, result, sel, count, filter, scan_count)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, count, filter);
+		return;
+	}
+	validity.Scan(transaction, vector_index, state.child_states[0], result);
+	if (count == 0) {
+		return;
+	}
+	// the filter was evaluated without looking at the validity: remove the NULL values from the selection
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(scan_count, vdata);
+	if (vdata.validity.AllValid()) {
+		return;
+	}
+	SelectionVector result_sel(count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		if (vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	count = result_count;
+}
+
 idx_t StandardColumnData::ScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result,
                                         bool allow_updates) {
 	D_ASSERT(state.row_index == state.child_states[0].row_index);
@@ -212,6 +242,15 @@ void StandardColumnData::DeserializeColumn(Deserializer &source) {
 	validity.DeserializeColumn(source);
 }
 
+bool StandardColumnData::IsPersistent() {
+	return ColumnData::IsPersistent() && validity.IsPersistent();
+}
+
+void StandardColumnData::SerializePersistentColumn(Serializer &serializer, vector<block_id_t> &blocks) {
+	ColumnData::SerializePersistentColumn(serializer, blocks);
+	validity.SerializePersistentColumn(serializer, blocks);
+}
+
 void StandardColumnData::GetStorageInfo(idx_t row_group_index, vector<idx_t> col_path, vector<vector<Value>> &result) {
 	ColumnData::GetStorageInfo(row_group_index, col_path, result);
 	col_path.push_back(0);
@@ -296,6 +296,25 @@ void StructColumnData::DeserializeColumn(Deserializer &source) {
 	}
 }
 
+bool StructColumnData::IsPersistent() {
+	if (!validity.IsPersistent()) {
+		return false;
+	}
+	for (auto &sub_column : sub_columns) {
+		if (!sub_column->IsPersistent()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void StructColumnData::SerializePersistentColumn(Serializer &serializer, vector<block_id_t> &blocks) {
+	validity.SerializePersistentColumn(serializer, blocks);
+	for (auto &sub_column : sub_columns) {
+		sub_column->SerializePersistentColumn(serializer, blocks);
+	}
+}
+
 void StructColumnData::GetStorageInfo(idx_t row_group_index, vector<idx_t> col_path, vector<vector<Value>> &result) {
 	col_path.push_back(0);
 	validity.GetStorageInfo(row_group_index, col_path, result);
@@ -1,5 +1,6 @@
 #include "duckdb/storage/table/update_segment.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/storage/statistics/numeric_statistics.hpp"
 #include "duckdb/storage/statistics/string_statistics.hpp"
@@ -172,8 +173,23 @@ void UpdateSegment::FetchUpdates(TransactionData transaction, idx_t vector_index
 	// FIXME: normalify if this is not the case... need to pass in count?
 	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
 
-	fetch_update_function(transaction.start_time, transaction.transaction_id, root->info[vector_index]->info.get(),
-	                      result);
+	auto base_info = root->info[vector_index]->info.get();
+	auto segment_version = GetSegmentVersion(transaction, base_info);
+	if (!segment_version) {
+		fetch_update_function(transaction.start_time, transaction.transaction_id, base_info, result);
+		return;
+	}
+	// the result holds the values of the column segment: keep the ones of the version before merging the updates
+	auto result_data = FlatVector::GetData(result);
+	auto segment_data = unique_ptr<data_t[]>(new data_t[segment_version->N * type_size]);
+	for (idx_t i = 0; i < segment_version->N; i++) {
+		memcpy(segment_data.get() + i * type_size, result_data + segment_version->tuples[i] * type_size, type_size);
+	}
+	fetch_update_function(transaction.start_time, transaction.transaction_id, base_info, result);
+	// the segment version is the oldest version: its values are restored last
+	for (idx_t i = 0; i < segment_version->N; i++) {
+		memcpy(result_data + segment_version->tuples[i] * type_size, segment_data.get() + i * type_size, type_size);
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -433,8 +449,15 @@ void UpdateSegment::FetchRow(TransactionData transaction, idx_t row_id, Vector &
 		return;
 	}
 	idx_t row_in_vector = row_id - vector_index * STANDARD_VECTOR_SIZE;
-	fetch_row_function(transaction.start_time, transaction.transaction_id, root->info[vector_index]->info.get(),
-	                   row_in_vector, result, result_idx);
+	auto base_info = root->info[vector_index]->info.get();
+	auto segment_version = GetSegmentVersion(transaction, base_info);
+	if (segment_version && std::binary_search(segment_version->tuples, segment_version->tuples + segment_version->N,
+	                                          sel_t(row_in_vector))) {
+		// the transaction sees the value that is stored in the column segment, which has already been fetched
+		return;
+	}
+	fetch_row_function(transaction.start_time, transaction.transaction_id, base_info, row_in_vector, result,
+	                   result_idx);
 }
 
 //===--------------------------------------------------------------------===//
@@ -494,10 +517,33 @@ static UpdateSegment::rollback_update_function_t GetRollbackUpdateFunction(Physi
 void UpdateSegment::RollbackUpdate(UpdateInfo *info) {
 	// obtain an exclusive lock
 	auto lock_handle = lock.GetExclusiveLock();
+	if (!info->prev) {
+		// the info has been replaced by another version of this transaction
+		return;
+	}
 
-	// move the data from the UpdateInfo back into the base info
 	D_ASSERT(root->info[info->vector_index]);
-	rollback_update_function(root->info[info->vector_index]->info.get(), info);
+	auto base_info = root->info[info->vector_index]->info.get();
+	if (info->values_in_segment) {
+		// the tuples show the values of the column segment again: remove them from the base info
+		// no other transaction can have updated these tuples in the meantime, as that would have been a conflict
+		idx_t info_idx = 0, result_count = 0;
+		for (idx_t base_idx = 0; base_idx < base_info->N; base_idx++) {
+			if (info_idx < info->N && base_info->tuples[base_idx] == info->tuples[info_idx]) {
+				info_idx++;
+				continue;
+			}
+			base_info->tuples[result_count] = base_info->tuples[base_idx];
+			memmove(base_info->tuple_data + result_count * type_size, base_info->tuple_data + base_idx * type_size,
+			        type_size);
+			result_count++;
+		}
+		D_ASSERT(info_idx == info->N);
+		base_info->N = result_count;
+	} else {
+		// move the data from the UpdateInfo back into the base info
+		rollback_update_function(base_info, info);
+	}
 
 	// clean up the update chain
 	CleanupUpdateInternal(*lock_handle, info);
@@ -507,7 +553,11 @@ void UpdateSegment::RollbackUpdate(UpdateInfo *info) {
 // Cleanup Update
 //===--------------------------------------------------------------------===//
 void UpdateSegment::CleanupUpdateInternal(const StorageLockKey &lock, UpdateInfo *info) {
-	D_ASSERT(info->prev);
+	if (!info->prev) {
+		// the info has already been merged into another version by CompactUpdates
+		D_ASSERT(!info->next);
+		return;
+	}
 	auto prev = info->prev;
 	prev->next = info->next;
 	if (prev->next) {
@@ -521,6 +571,85 @@ void UpdateSegment::CleanupUpdate(UpdateInfo *info) {
 	CleanupUpdateInternal(*lock_handle, info);
 }
 
+//===--------------------------------------------------------------------===//
+// Compact Updates
+//===--------------------------------------------------------------------===//
+static bool CanMergeVersions(transaction_t a, transaction_t b, const vector<transaction_t> &active_start_times) {
+	if (a >= TRANSACTION_ID_START || b >= TRANSACTION_ID_START) {
+		// uncommitted versions can still be rolled back
+		return false;
+	}
+	// a transaction that started in between the two commits sees one version but not the other
+	auto entry = std::lower_bound(active_start_times.begin(), active_start_times.end(), MinValue(a, b));
+	return entry == active_start_times.end() || *entry >= MaxValue(a, b);
+}
+
+void UpdateSegment::MergeVersions(UpdateInfo *target, UpdateInfo *source, sel_t merged_tuples[],
+                                  data_ptr_t merged_data) {
+	// the version with the lowest commit id holds the oldest values, which are the ones that are restored for the
+	// transactions that see neither version
+	bool target_is_older = target->version_number < source->version_number;
+	idx_t target_idx = 0, source_idx = 0, merged_count = 0;
+	while (target_idx < target->N || source_idx < source->N) {
+		UpdateInfo *info;
+		idx_t idx;
+		if (source_idx == source->N ||
+		    (target_idx < target->N && target->tuples[target_idx] < source->tuples[source_idx])) {
+			info = target;
+			idx = target_idx++;
+		} else if (target_idx == target->N || source->tuples[source_idx] < target->tuples[target_idx]) {
+			info = source;
+			idx = source_idx++;
+		} else {
+			// both versions contain the tuple
+			info = target_is_older ? target : source;
+			idx = target_is_older ? target_idx : source_idx;
+			target_idx++;
+			source_idx++;
+		}
+		merged_tuples[merged_count] = info->tuples[idx];
+		memcpy(merged_data + merged_count * type_size, info->tuple_data + idx * type_size, type_size);
+		merged_count++;
+	}
+	D_ASSERT(merged_count <= target->max);
+	memcpy(target->tuples, merged_tuples, merged_count * sizeof(sel_t));
+	memcpy(target->tuple_data, merged_data, merged_count * type_size);
+	target->N = merged_count;
+	target->version_number = MinValue<transaction_t>(target->version_number, source->version_number);
+	target->Verify();
+}
+
+void UpdateSegment::CompactUpdates(idx_t vector_index, const vector<transaction_t> &active_start_times) {
+	auto write_lock = lock.GetExclusiveLock();
+	if (!root || !root->info[vector_index]) {
+		return;
+	}
+	unique_ptr<sel_t[]> merged_tuples;
+	unique_ptr<data_t[]> merged_data;
+	auto current = root->info[vector_index]->info->next;
+	while (current && current->next) {
+		auto next = current->next;
+		if (next->values_in_segment ||
+		    !CanMergeVersions(current->version_number, next->version_number, active_start_times)) {
+			current = next;
+			continue;
+		}
+		if (!merged_tuples) {
+			merged_tuples = unique_ptr<sel_t[]>(new sel_t[STANDARD_VECTOR_SIZE]);
+			merged_data = unique_ptr<data_t[]>(new data_t[STANDARD_VECTOR_SIZE * type_size]);
+		}
+		// merge the next version into the current one and remove it from the chain
+		// the transaction that owns the removed version skips it when it is cleaned up
+		MergeVersions(current, next, merged_tuples.get(), merged_data.get());
+		current->next = next->next;
+		if (current->next) {
+			current->next->prev = current;
+		}
+		next->prev = nullptr;
+		next->next = nullptr;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Check for conflicts in update
 //===--------------------------------------------------------------------===//
@@ -1054,9 +1183,53 @@ UpdateInfo *CreateEmptyUpdateInfo(TransactionData transaction, idx_t type_size,
 	update_info->tuples = (sel_t *)(((data_ptr_t)update_info) + sizeof(UpdateInfo));
 	update_info->tuple_data = ((data_ptr_t)update_info) + sizeof(UpdateInfo) + sizeof(sel_t) * update_info->max;
 	update_info->version_number = transaction.transaction_id;
+	update_info->values_in_segment = false;
 	return update_info;
 }
 
+bool UpdateSegment::CanKeepValuesInSegment() const {
+	// only fixed-width values can be restored from the scanned vector without further work
+	auto physical_type = column_data.type.InternalType();
+	return physical_type != PhysicalType::BIT && physical_type != PhysicalType::VARCHAR;
+}
+
+UpdateInfo *UpdateSegment::GetSegmentVersion(TransactionData transaction, UpdateInfo *base_info) {
+	auto last = base_info;
+	while (last->next) {
+		last = last->next;
+	}
+	if (!last->values_in_segment || last->version_number <= transaction.start_time ||
+	    last->version_number == transaction.transaction_id) {
+		return nullptr;
+	}
+	return last;
+}
+
+UpdateInfo *UpdateSegment::MaterializeVersion(TransactionData transaction, UpdateInfo *info, Vector &base_data) {
+	D_ASSERT(info->values_in_segment && transaction.transaction);
+	auto result = transaction.transaction->CreateUpdateInfo(type_size, info->N);
+	result->segment = this;
+	result->column_index = info->column_index;
+	result->vector_index = info->vector_index;
+	result->N = info->N;
+	// the base data holds the values of the column segment
+	auto base_array_data = FlatVector::GetData(base_data);
+	for (idx_t i = 0; i < info->N; i++) {
+		result->tuples[i] = info->tuples[i];
+		memcpy(result->tuple_data + i * type_size, base_array_data + info->tuples[i] * type_size, type_size);
+	}
+	// replace the version in the chain
+	result->prev = info->prev;
+	result->next = info->next;
+	result->prev->next = result;
+	if (result->next) {
+		result->next->prev = result;
+	}
+	info->prev = nullptr;
+	info->next = nullptr;
+	return result;
+}
+
 void UpdateSegment::Update(TransactionData transaction, idx_t column_index, Vector &update, row_t *ids, idx_t count,
                            Vector &base_data) {
 	// obtain an exclusive lock
@@ -1115,6 +1288,9 @@ void UpdateSegment::Update(TransactionData transaction, idx_t column_index, Vect
 			node = node->next;
 		}
 		unique_ptr<char[]> update_info_data;
+		if (node && node->values_in_segment) {
+			node = MaterializeVersion(transaction, node, base_data);
+		}
 		if (!node) {
 			// no updates made yet by this transaction: initially the update info to empty
 			if (transaction.transaction) {
@@ -1153,22 +1329,36 @@ void UpdateSegment::Update(TransactionData transaction, idx_t column_index, Vect
 		result->info->tuples = result->tuples.get();
 		result->info->tuple_data = result->tuple_data.get();
 		result->info->version_number = TRANSACTION_ID_START - 1;
+		result->info->values_in_segment = false;
 		result->info->column_index = column_index;
 		InitializeUpdateInfo(*result->info, ids, sel, count, vector_index, vector_offset);
 
 		// now create the transaction level update info in the undo log
+		// the old values of the first version of a vector are the values in the column segment: for fixed-width
+		// types these are not copied (copy-on-write), which keeps bulk updates cheap in time and memory
+		bool values_in_segment = transaction.transaction && CanKeepValuesInSegment();
 		unique_ptr<char[]> update_info_data;
 		UpdateInfo *transaction_node;
 		if (transaction.transaction) {
-			transaction_node = transaction.transaction->CreateUpdateInfo(type_size, count);
+			transaction_node = transaction.transaction->CreateUpdateInfo(values_in_segment ? 0 : type_size, count);
 		} else {
 			transaction_node = CreateEmptyUpdateInfo(transaction, type_size, count, update_info_data);
 		}
+		transaction_node->values_in_segment = values_in_segment;
 
 		InitializeUpdateInfo(*transaction_node, ids, sel, count, vector_index, vector_offset);
 
-		// we write the updates in the update node data, and write the updates in the info
-		initialize_update_function(transaction_node, base_data, result->info.get(), update, sel);
+		if (values_in_segment) {
+			// only write the updates in the update node data
+			auto update_data = FlatVector::GetData(update);
+			for (idx_t i = 0; i < count; i++) {
+				memcpy(result->info->tuple_data + i * type_size, update_data + sel.get_index(i) * type_size,
+				       type_size);
+			}
+		} else {
+			// we write the updates in the update node data, and write the updates in the info
+			initialize_update_function(transaction_node, base_data, result->info.get(), update, sel);
+		}
 
 		result->info->next = transaction.transaction ? transaction_node : nullptr;
 		result->info->prev = nullptr;
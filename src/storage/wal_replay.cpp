@@ -2,12 +2,14 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
+#include "duckdb/common/preserved_error.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_counter.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -15,6 +17,9 @@
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/storage/table/row_group_collection.hpp"
+#include "duckdb/common/serializer/buffered_deserializer.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
@@ -66,6 +71,13 @@ bool WriteAheadLog::Replay(DatabaseInstance &database, string &path) {
 		}
 	}
 
+	// the row groups in the WAL reference blocks that were written before the commit: mark them as used before
+	// replaying anything, so that the replay does not allocate them for other data
+	auto &block_manager = BlockManager::GetBlockManager(database);
+	for (auto &block_id : checkpoint_state.referenced_blocks) {
+		block_manager.MarkBlockAsUsed(block_id);
+	}
+
 	// we need to recover from the WAL: actually set up the replay state
 	BufferedFileReader reader(database.GetFileSystem(), path.c_str());
 	ReplayState state(database, *con.context, reader);
@@ -79,7 +91,8 @@ bool WriteAheadLog::Replay(DatabaseInstance &database, string &path) {
 			// read the current entry
 			WALType entry_type = reader.Read<WALType>();
 			if (entry_type == WALType::WAL_FLUSH) {
-				// flush: commit the current transaction
+				// flush: append the buffered inserts and commit the current transaction
+				state.FlushInserts();
 				con.Commit();
 				// check if the file is exhausted
 				if (reader.Finished()) {
@@ -97,19 +110,140 @@ bool WriteAheadLog::Replay(DatabaseInstance &database, string &path) {
 		// FIXME: this should report a proper warning in the connection
 		Printer::Print(StringUtil::Format("Exception in WAL playback: %s\n", ex.what()));
 		// exception thrown in WAL replay: rollback
+		state.WaitForInserts();
 		con.Rollback();
 	} catch (...) {
 		Printer::Print("Unknown Exception in WAL playback: %s\n");
 		// exception thrown in WAL replay: rollback
+		state.WaitForInserts();
 		con.Rollback();
 	} // LCOV_EXCL_STOP
 	return false;
 }
 
+//===--------------------------------------------------------------------===//
+// Parallel Inserts
+//===--------------------------------------------------------------------===//
+//! The buffered inserts into a single table, in WAL order
+struct ReplayTableInserts {
+	explicit ReplayTableInserts(TableCatalogEntry *table) : table(table) {
+	}
+
+	TableCatalogEntry *table;
+	vector<unique_ptr<DataChunk>> chunks;
+};
+
+class ReplayInsertState {
+public:
+	explicit ReplayInsertState(TaskScheduler &scheduler) : buffered_rows(0), counter(scheduler) {
+	}
+
+	//! The inserts that are buffered, one entry per table
+	vector<ReplayTableInserts> buffered;
+	//! Maps a table to its entry in the buffered inserts
+	unordered_map<TableCatalogEntry *, idx_t> buffered_tables;
+	idx_t buffered_rows;
+	//! The inserts that are appended by the scheduled tasks
+	vector<ReplayTableInserts> appending;
+	TaskCounter counter;
+
+	mutex error_lock;
+	PreservedError error;
+
+public:
+	void PushError(PreservedError new_error) {
+		lock_guard<mutex> guard(error_lock);
+		if (!error) {
+			error = move(new_error);
+		}
+	}
+};
+
+//! Appends the buffered inserts of a single table to the transaction-local storage of that table
+class ReplayInsertTask : public Task {
+public:
+	ReplayInsertTask(ReplayInsertState &insert_state, ClientContext &context, ReplayTableInserts &inserts)
+	    : insert_state(insert_state), context(context), inserts(inserts) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			auto &table = *inserts.table;
+			LocalAppendState append_state;
+			table.storage->InitializeLocalAppend(append_state, context);
+			for (auto &chunk : inserts.chunks) {
+				table.storage->LocalAppend(append_state, table, context, *chunk);
+				chunk.reset();
+			}
+			table.storage->FinalizeLocalAppend(append_state);
+		} catch (Exception &ex) {
+			insert_state.PushError(PreservedError(ex));
+		} catch (std::exception &ex) {
+			insert_state.PushError(PreservedError(ex));
+		} catch (...) { // LCOV_EXCL_START
+			insert_state.PushError(PreservedError("Unknown exception during WAL replay!"));
+		} // LCOV_EXCL_STOP
+		insert_state.counter.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	ReplayInsertState &insert_state;
+	ClientContext &context;
+	ReplayTableInserts &inserts;
+};
+
+ReplayState::ReplayState(DatabaseInstance &db, ClientContext &context, Deserializer &source)
+    : db(db), context(context), source(source), current_table(nullptr), deserialize_only(false),
+      checkpoint_id(INVALID_BLOCK) {
+}
+
+ReplayState::~ReplayState() {
+}
+
+void ReplayState::ScheduleInserts() {
+	// the appends of the previous batch have to finish first: they can target the same tables as this batch
+	WaitForInserts();
+	if (insert_state->error) {
+		insert_state->error.Throw();
+	}
+	// every table is appended to by a single task, so the inserts into one table stay in order
+	insert_state->appending = move(insert_state->buffered);
+	insert_state->buffered.clear();
+	insert_state->buffered_tables.clear();
+	insert_state->buffered_rows = 0;
+	for (auto &inserts : insert_state->appending) {
+		insert_state->counter.AddTask(make_unique<ReplayInsertTask>(*insert_state, context, inserts));
+	}
+}
+
+void ReplayState::FlushInserts() {
+	if (!insert_state) {
+		return;
+	}
+	ScheduleInserts();
+	WaitForInserts();
+	if (insert_state->error) {
+		insert_state->error.Throw();
+	}
+}
+
+void ReplayState::WaitForInserts() {
+	if (!insert_state) {
+		return;
+	}
+	insert_state->counter.Finish();
+	insert_state->appending.clear();
+}
+
 //===--------------------------------------------------------------------===//
 // Replay Entries
 //===--------------------------------------------------------------------===//
 void ReplayState::ReplayEntry(WALType entry_type) {
+	if (entry_type != WALType::INSERT_TUPLE && entry_type != WALType::USE_TABLE) {
+		// any other entry can depend on the buffered inserts (e.g. deletes or updates of the inserted rows)
+		FlushInserts();
+	}
 	switch (entry_type) {
 	case WALType::CREATE_TABLE:
 		ReplayCreateTable();
@@ -165,6 +299,9 @@ void ReplayState::ReplayEntry(WALType entry_type) {
 	case WALType::UPDATE_TUPLE:
 		ReplayUpdate();
 		break;
+	case WALType::ROW_GROUP_DATA:
+		ReplayRowGroupData();
+		break;
 	case WALType::CHECKPOINT:
 		ReplayCheckpoint();
 		break;
@@ -408,8 +545,8 @@ void ReplayState::ReplayUseTable() {
 }
 
 void ReplayState::ReplayInsert() {
-	DataChunk chunk;
-	chunk.Deserialize(source);
+	auto chunk = make_unique<DataChunk>();
+	chunk->Deserialize(source);
 	if (deserialize_only) {
 		return;
 	}
@@ -417,8 +554,20 @@ void ReplayState::ReplayInsert() {
 		throw Exception("Corrupt WAL: insert without table");
 	}
 
-	// append to the current table
-	current_table->storage->LocalAppend(*current_table, context, chunk);
+	// buffer the insert: the inserts are appended to their tables in parallel, while the WAL is read further
+	if (!insert_state) {
+		insert_state = make_unique<ReplayInsertState>(TaskScheduler::GetScheduler(context));
+	}
+	auto entry = insert_state->buffered_tables.find(current_table);
+	if (entry == insert_state->buffered_tables.end()) {
+		entry = insert_state->buffered_tables.insert(make_pair(current_table, insert_state->buffered.size())).first;
+		insert_state->buffered.emplace_back(current_table);
+	}
+	insert_state->buffered_rows += chunk->size();
+	insert_state->buffered[entry->second].chunks.push_back(move(chunk));
+	if (insert_state->buffered_rows >= INSERT_BATCH_SIZE) {
+		ScheduleInserts();
+	}
 }
 
 void ReplayState::ReplayDelete() {
@@ -471,6 +620,37 @@ void ReplayState::ReplayUpdate() {
 	current_table->storage->UpdateColumn(*current_table, context, row_ids, column_path, chunk);
 }
 
+void ReplayState::ReplayRowGroupData() {
+	auto block_count = source.Read<idx_t>();
+	for (idx_t i = 0; i < block_count; i++) {
+		auto block_id = source.Read<block_id_t>();
+		if (deserialize_only) {
+			referenced_blocks.push_back(block_id);
+		}
+	}
+	auto data_size = source.Read<idx_t>();
+	auto data = unique_ptr<data_t[]>(new data_t[data_size]);
+	source.ReadData(data.get(), data_size);
+	if (deserialize_only) {
+		return;
+	}
+	if (!current_table) {
+		throw InternalException("Corrupt WAL: row group data without table");
+	}
+
+	// the blocks of the row group have been marked as used before the replay started
+	auto &table = *current_table->storage;
+	auto &block_manager = table.info->table_io_manager->GetBlockManagerForRowData();
+	BufferedDeserializer reader(data.get(), data_size);
+	auto row_group = RowGroup::DeserializePersistent(db, block_manager, *table.info, table.GetTypes(), reader);
+
+	// the row group is appended to the transaction-local storage, in order with the inserts that surround it
+	RowGroupCollection collection(table.info, block_manager, table.GetTypes(), row_group->start);
+	collection.InitializeEmpty();
+	collection.AddRowGroup(move(row_group));
+	table.LocalMerge(context, collection);
+}
+
 void ReplayState::ReplayCheckpoint() {
 	checkpoint_id = source.Read<block_id_t>();
 }
@@ -5,13 +5,18 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
+#include "duckdb/common/serializer/buffered_serializer.hpp"
+#include "duckdb/storage/table/row_group.hpp"
 #include <cstring>
 
 namespace duckdb {
 
-WriteAheadLog::WriteAheadLog(DatabaseInstance &database, const string &path) : skip_writing(false), database(database) {
+WriteAheadLog::WriteAheadLog(DatabaseInstance &database, const string &path)
+    : skip_writing(false), database(database), sync_in_progress(false), written_position(0), synced_position(0),
+      stop_background_sync(false) {
 	wal_path = path;
 	writer = make_unique<BufferedFileWriter>(database.GetFileSystem(), path.c_str(),
 	                                         FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE |
@@ -19,6 +24,14 @@ WriteAheadLog::WriteAheadLog(DatabaseInstance &database, const string &path) : s
 }
 
 WriteAheadLog::~WriteAheadLog() {
+	StopBackgroundSync();
+	if (writer && synced_position < written_position) {
+		// make the commits that have not been synced by the background thread yet durable
+		try {
+			Sync(written_position);
+		} catch (...) { // LCOV_EXCL_START
+		}               // LCOV_EXCL_STOP
+	}
 }
 
 int64_t WriteAheadLog::GetWALSize() {
@@ -32,6 +45,8 @@ idx_t WriteAheadLog::GetTotalWritten() {
 }
 
 void WriteAheadLog::Truncate(int64_t size) {
+	unique_lock<mutex> guard(sync_lock);
+	sync_finished.wait(guard, [&] { return !sync_in_progress; });
 	writer->Truncate(size);
 }
 
@@ -39,7 +54,11 @@ void WriteAheadLog::Delete() {
 	if (!writer) {
 		return;
 	}
+	StopBackgroundSync();
+	unique_lock<mutex> guard(sync_lock);
+	sync_finished.wait(guard, [&] { return !sync_in_progress; });
 	writer.reset();
+	guard.unlock();
 
 	auto &fs = FileSystem::GetFileSystem(database);
 	fs.RemoveFile(wal_path);
@@ -258,6 +277,25 @@ void WriteAheadLog::WriteUpdate(DataChunk &chunk, const vector<column_t> &column
 	chunk.Serialize(*writer);
 }
 
+void WriteAheadLog::WriteRowGroupData(RowGroup &row_group) {
+	if (skip_writing) {
+		return;
+	}
+	vector<block_id_t> blocks;
+	BufferedSerializer serializer;
+	row_group.SerializePersistent(serializer, blocks);
+	auto data = serializer.GetData();
+
+	writer->Write<WALType>(WALType::ROW_GROUP_DATA);
+	// the referenced blocks come first, so they can be read without knowing the types of the table
+	writer->Write<idx_t>(blocks.size());
+	for (auto &block_id : blocks) {
+		writer->Write<block_id_t>(block_id);
+	}
+	writer->Write<idx_t>(data.size);
+	writer->WriteData(data.data.get(), data.size);
+}
+
 //===--------------------------------------------------------------------===//
 // Write ALTER Statement
 //===--------------------------------------------------------------------===//
@@ -276,10 +314,98 @@ void WriteAheadLog::Flush() {
 	if (skip_writing) {
 		return;
 	}
+	Sync(WriteFlush());
+}
+
+idx_t WriteAheadLog::WriteFlush() {
+	D_ASSERT(!skip_writing);
 	// write an empty entry
 	writer->Write<WALType>(WALType::WAL_FLUSH);
-	// flushes all changes made to the WAL to disk
-	writer->Sync();
+	// write the buffered entries to the file, the sync happens later
+	writer->Flush();
+	idx_t position = writer->GetTotalWritten();
+	written_position = position;
+	return position;
+}
+
+void WriteAheadLog::SyncCommit(idx_t position) {
+#ifndef DUCKDB_NO_THREADS
+	if (!DBConfig::GetConfig(database).options.synchronous_commit) {
+		StartBackgroundSync();
+		return;
+	}
+#endif
+	Sync(position);
+}
+
+void WriteAheadLog::Sync(idx_t position) {
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_position < position) {
+		if (sync_in_progress) {
+			// another thread is syncing: wait for it, it might have covered our position
+			sync_finished.wait(guard);
+			continue;
+		}
+		// sync everything that has been written to the file so far, including the entries of the commits that
+		// are waiting for us
+		sync_in_progress = true;
+		idx_t sync_position = written_position;
+		guard.unlock();
+		try {
+			writer->handle->Sync();
+		} catch (...) {
+			guard.lock();
+			sync_in_progress = false;
+			sync_finished.notify_all();
+			throw;
+		}
+		guard.lock();
+		sync_in_progress = false;
+		synced_position = MaxValue<idx_t>(synced_position, sync_position);
+		sync_finished.notify_all();
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Background Sync
+//===--------------------------------------------------------------------===//
+void WriteAheadLog::StartBackgroundSync() {
+	lock_guard<mutex> guard(sync_lock);
+	if (background_sync) {
+		return;
+	}
+	stop_background_sync = false;
+	background_sync = make_unique<thread>([this] { BackgroundSync(); });
+}
+
+void WriteAheadLog::StopBackgroundSync() {
+	unique_lock<mutex> guard(sync_lock);
+	if (!background_sync) {
+		return;
+	}
+	stop_background_sync = true;
+	background_sync_wakeup.notify_all();
+	guard.unlock();
+	background_sync->join();
+	background_sync.reset();
+}
+
+void WriteAheadLog::BackgroundSync() {
+	unique_lock<mutex> guard(sync_lock);
+	while (!stop_background_sync) {
+		background_sync_wakeup.wait_for(guard, std::chrono::milliseconds(BACKGROUND_SYNC_INTERVAL_MS));
+		if (stop_background_sync || synced_position >= written_position) {
+			continue;
+		}
+		idx_t position = written_position;
+		guard.unlock();
+		try {
+			Sync(position);
+		} catch (...) { // LCOV_EXCL_START
+			// the commits have already been acknowledged: retry at the next interval
+		} // LCOV_EXCL_STOP
+		guard.lock();
+	}
 }
 
 } // namespace duckdb
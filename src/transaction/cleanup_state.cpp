@@ -49,6 +49,9 @@ void CleanupState::CleanupUpdate(UpdateInfo *info) {
 }
 
 void CleanupState::CleanupDelete(DeleteInfo *info) {
+	// every transaction can see the delete now: it no longer has to be checked per tuple
+	info->vinfo->CleanupDelete(info->rows, info->count);
+
 	auto version_table = info->table;
 	D_ASSERT(version_table->info->cardinality >= info->count);
 	version_table->info->cardinality -= info->count;
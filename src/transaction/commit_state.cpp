@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_set.hpp"
 #include "duckdb/common/serializer/buffered_deserializer.hpp"
+#include "duckdb/execution/materialized_view.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table/chunk_info.hpp"
@@ -235,6 +236,8 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		}
 		// mark the tuples as committed
 		info->table->CommitAppend(commit_id, info->start_row, info->count);
+		info->table->info->last_commit_id = commit_id;
+		MaterializedViewData::CommitAppend(*info->table->info, commit_id, info->start_row, info->count);
 		break;
 	}
 	case UndoFlags::DELETE_TUPLE: {
@@ -245,15 +248,23 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		}
 		// mark the tuples as committed
 		info->vinfo->CommitDelete(commit_id, info->rows, info->count);
+		info->table->info->last_commit_id = commit_id;
+		MaterializedViewData::Invalidate(*info->table->info, commit_id);
 		break;
 	}
 	case UndoFlags::UPDATE_TUPLE: {
 		// update:
 		auto info = (UpdateInfo *)data;
+		if (!info->prev) {
+			// the info has been replaced by another version of this transaction
+			break;
+		}
 		if (HAS_LOG && !info->segment->column_data.GetTableInfo().IsTemporary()) {
 			WriteUpdate(info);
 		}
 		info->version_number = commit_id;
+		info->segment->column_data.GetTableInfo().last_commit_id = commit_id;
+		MaterializedViewData::Invalidate(info->segment->column_data.GetTableInfo(), commit_id);
 		break;
 	}
 	default:
@@ -278,6 +289,7 @@ void CommitState::RevertCommit(UndoFlags type, data_ptr_t data) {
 		auto info = (AppendInfo *)data;
 		// revert this append
 		info->table->RevertAppend(info->start_row, info->count);
+		MaterializedViewData::RevertAppend(*info->table->info, info->start_row, info->count);
 		break;
 	}
 	case UndoFlags::DELETE_TUPLE: {
@@ -30,7 +30,7 @@ TransactionData::TransactionData(transaction_t transaction_id_p, transaction_t s
 Transaction::Transaction(ClientContext &context_p, transaction_t start_time, transaction_t transaction_id,
                          timestamp_t start_timestamp, idx_t catalog_version)
     : context(context_p.shared_from_this()), start_time(start_time), transaction_id(transaction_id), commit_id(0),
-      highest_active_query(0), active_query(MAXIMUM_QUERY_ID), start_timestamp(start_timestamp),
+      wal_sync_position(0), highest_active_query(0), active_query(MAXIMUM_QUERY_ID), start_timestamp(start_timestamp),
       catalog_version(catalog_version), temporary_objects(context_p.client_data->temporary_objects),
       undo_buffer(context.lock()), storage(make_unique<LocalStorage>(context_p, *this)) {
 }
@@ -89,6 +89,7 @@ UpdateInfo *Transaction::CreateUpdateInfo(idx_t type_size, idx_t entries) {
 	update_info->tuples = (sel_t *)(((data_ptr_t)update_info) + sizeof(UpdateInfo));
 	update_info->tuple_data = ((data_ptr_t)update_info) + sizeof(UpdateInfo) + sizeof(sel_t) * update_info->max;
 	update_info->version_number = transaction_id;
+	update_info->values_in_segment = false;
 	return update_info;
 }
 
@@ -96,16 +97,29 @@ bool Transaction::ChangesMade() {
 	return undo_buffer.ChangesMade() || storage->ChangesMade();
 }
 
+bool Transaction::IsReadOnly() {
+	return sequence_usage.empty() && !ChangesMade();
+}
+
 bool Transaction::AutomaticCheckpoint(DatabaseInstance &db) {
 	auto &storage_manager = StorageManager::GetStorageManager(db);
 	return storage_manager.AutomaticCheckpoint(storage->EstimatedSize() + undo_buffer.EstimatedSize());
 }
 
+string Transaction::PrepareCommit() noexcept {
+	try {
+		storage->PrepareCommit();
+		return string();
+	} catch (std::exception &ex) {
+		return ex.what();
+	}
+}
+
 string Transaction::Commit(DatabaseInstance &db, transaction_t commit_id, bool checkpoint) noexcept {
 	// "checkpoint" parameter indicates if the caller will checkpoint. If checkpoint ==
 	//    true: Then this function will NOT write to the WAL or flush/persist.
 	//          This method only makes commit in memory, expecting caller to checkpoint/flush.
-	//    false: Then this function WILL write to the WAL and Flush/Persist it.
+	//    false: Then this function WILL write to the WAL, the caller syncs it up to wal_sync_position.
 	this->commit_id = commit_id;
 	auto &storage_manager = StorageManager::GetStorageManager(db);
 	auto log = storage_manager.GetWriteAheadLog();
@@ -139,6 +153,10 @@ void Transaction::Cleanup() {
 	undo_buffer.Cleanup();
 }
 
+void Transaction::CompactUpdates(const vector<transaction_t> &active_start_times) {
+	undo_buffer.CompactUpdates(active_start_times);
+}
+
 ValidChecker &ValidChecker::Get(Transaction &transaction) {
 	return transaction.transaction_validity;
 }
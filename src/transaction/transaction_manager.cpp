@@ -9,6 +9,7 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/connection_manager.hpp"
 
 namespace duckdb {
@@ -38,9 +39,11 @@ struct CheckpointLock {
 	}
 };
 
-TransactionManager::TransactionManager(DatabaseInstance &db) : db(db), thread_is_checkpointing(false) {
-	// start timestamp starts at zero
-	current_start_timestamp = 0;
+TransactionManager::TransactionManager(DatabaseInstance &db)
+    : db(db), thread_is_checkpointing(false), checkpoint_requested(false), stop_background_checkpoint(false) {
+	// start timestamp starts at zero, commit ids are always higher than the start time of any running transaction
+	snapshot_timestamp = 0;
+	current_start_timestamp = 1;
 	// transaction ID starts very high:
 	// it should be much higher than the current start timestamp
 	// if transaction_id < start_timestamp for any set of active transactions
@@ -53,29 +56,33 @@ TransactionManager::TransactionManager(DatabaseInstance &db) : db(db), thread_is
 }
 
 TransactionManager::~TransactionManager() {
+	StopBackgroundCheckpoint();
 }
 
 Transaction *TransactionManager::StartTransaction(ClientContext &context) {
-	// obtain the transaction lock during this function
-	lock_guard<mutex> lock(transaction_lock);
-	if (current_start_timestamp >= TRANSACTION_ID_START) { // LCOV_EXCL_START
+	timestamp_t start_timestamp = Timestamp::GetCurrentTimestamp();
+	auto catalog_version = Catalog::GetCatalog(db).GetCatalogVersion();
+
+	// starting a transaction does not wait for the transaction lock (and thus for running commits): the transaction
+	// starts from the snapshot of the last completed commit
+	// the snapshot is read while holding the lock of the active transactions, so that the transactions that are
+	// removed in the meantime cannot clean up versions this transaction still needs
+	lock_guard<mutex> lock(active_transactions_lock);
+	transaction_t start_time = snapshot_timestamp;
+	if (start_time >= TRANSACTION_ID_START) { // LCOV_EXCL_START
 		throw InternalException("Cannot start more transactions, ran out of "
 		                        "transaction identifiers!");
 	} // LCOV_EXCL_STOP
 
-	// obtain the start time and transaction ID of this transaction
-	transaction_t start_time = current_start_timestamp++;
+	// obtain the transaction ID of this transaction
 	transaction_t transaction_id = current_transaction_id++;
-	timestamp_t start_timestamp = Timestamp::GetCurrentTimestamp();
 	if (active_transactions.empty()) {
 		lowest_active_start = start_time;
 		lowest_active_id = transaction_id;
 	}
 
 	// create the actual transaction
-	auto &catalog = Catalog::GetCatalog(db);
-	auto transaction =
-	    make_unique<Transaction>(context, start_time, transaction_id, start_timestamp, catalog.GetCatalogVersion());
+	auto transaction = make_unique<Transaction>(context, start_time, transaction_id, start_timestamp, catalog_version);
 	auto transaction_ptr = transaction.get();
 
 	// store it in the set of active transactions
@@ -92,12 +99,12 @@ struct ClientLockWrapper {
 	unique_ptr<lock_guard<mutex>> connection_lock;
 };
 
-void TransactionManager::LockClients(vector<ClientLockWrapper> &client_locks, ClientContext &context) {
-	auto &connection_manager = ConnectionManager::Get(context);
+void TransactionManager::LockClients(vector<ClientLockWrapper> &client_locks, ClientContext *context) {
+	auto &connection_manager = ConnectionManager::Get(db);
 	client_locks.emplace_back(connection_manager.connections_lock, nullptr);
 	auto connection_list = connection_manager.GetConnectionList();
 	for (auto &con : connection_list) {
-		if (con.get() == &context) {
+		if (con.get() == context) {
 			continue;
 		}
 		auto &context_lock = con->context_lock;
@@ -124,7 +131,7 @@ void TransactionManager::Checkpoint(ClientContext &context, bool force) {
 	// this ensures no new queries can be started, and no new connections to the database can be made
 	// to avoid deadlock we release the transaction lock while locking the clients
 	vector<ClientLockWrapper> client_locks;
-	LockClients(client_locks, context);
+	LockClients(client_locks, &context);
 
 	lock = make_unique<lock_guard<mutex>>(transaction_lock);
 	auto current = &Transaction::GetTransaction(context);
@@ -138,19 +145,25 @@ void TransactionManager::Checkpoint(ClientContext &context, bool force) {
 		}
 	} else {
 		if (!CanCheckpoint(current)) {
-			for (size_t i = 0; i < active_transactions.size(); i++) {
-				auto &transaction = active_transactions[i];
+			// all clients are locked: no transactions can be started in the meantime
+			vector<Transaction *> transactions;
+			{
+				lock_guard<mutex> active_lock(active_transactions_lock);
+				for (auto &transaction : active_transactions) {
+					transactions.push_back(transaction.get());
+				}
+			}
+			for (auto transaction : transactions) {
 				// rollback the transaction
 				transaction->Rollback();
 				auto transaction_context = transaction->context.lock();
 
 				// remove the transaction id from the list of active transactions
 				// potentially resulting in garbage collection
-				RemoveTransaction(transaction.get());
+				RemoveTransaction(transaction);
 				if (transaction_context) {
 					transaction_context->transaction.ClearTransaction();
 				}
-				i--;
 			}
 			D_ASSERT(CanCheckpoint(nullptr));
 		}
@@ -167,6 +180,7 @@ bool TransactionManager::CanCheckpoint(Transaction *current) {
 	if (!recently_committed_transactions.empty() || !old_transactions.empty()) {
 		return false;
 	}
+	lock_guard<mutex> active_lock(active_transactions_lock);
 	for (auto &transaction : active_transactions) {
 		if (transaction.get() != current) {
 			return false;
@@ -176,11 +190,22 @@ bool TransactionManager::CanCheckpoint(Transaction *current) {
 }
 
 string TransactionManager::CommitTransaction(ClientContext &context, Transaction *transaction) {
+	// with background checkpoints, a read-only transaction cannot trigger a checkpoint either: it only has to be
+	// removed from the set of active transactions
+	bool background_checkpoint = DBConfig::GetConfig(db).options.background_checkpoint;
+	if (background_checkpoint && transaction->IsReadOnly()) {
+		EndReadOnlyTransaction(transaction);
+		return string();
+	}
+	// write the appended data that is merged into the tables to disk before obtaining the transaction lock
+	// this way, concurrent bulk appends only link their row groups into the tables while holding the lock
+	string error = transaction->PrepareCommit();
 	vector<ClientLockWrapper> client_locks;
 	auto lock = make_unique<lock_guard<mutex>>(transaction_lock);
 	CheckpointLock checkpoint_lock(*this);
 	// check if we can checkpoint
-	bool checkpoint = thread_is_checkpointing ? false : CanCheckpoint(transaction);
+	// with background checkpoints the committing transaction never checkpoints: it only wakes up the background thread
+	bool checkpoint = thread_is_checkpointing || background_checkpoint ? false : CanCheckpoint(transaction);
 	if (checkpoint) {
 		if (transaction->AutomaticCheckpoint(db)) {
 			checkpoint_lock.Lock();
@@ -188,7 +213,7 @@ string TransactionManager::CommitTransaction(ClientContext &context, Transaction
 			// to avoid deadlock we release the transaction lock while locking the clients
 			lock.reset();
 
-			LockClients(client_locks, context);
+			LockClients(client_locks, &context);
 
 			lock = make_unique<lock_guard<mutex>>(transaction_lock);
 			checkpoint = CanCheckpoint(transaction);
@@ -200,10 +225,31 @@ string TransactionManager::CommitTransaction(ClientContext &context, Transaction
 			checkpoint = false;
 		}
 	}
-	// obtain a commit id for the transaction
-	transaction_t commit_id = current_start_timestamp++;
-	// commit the UndoBuffer of the transaction
-	string error = transaction->Commit(db, commit_id, checkpoint);
+	if (error.empty()) {
+		// obtain a commit id for the transaction
+		transaction_t commit_id = current_start_timestamp++;
+		// commit the UndoBuffer of the transaction
+		error = transaction->Commit(db, commit_id, checkpoint);
+		if (error.empty()) {
+			// transactions that start from now on see the commit
+			snapshot_timestamp = current_start_timestamp++;
+			// other transactions keep the older versions alive: merge the versions of the updated vectors that none
+			// of them can tell apart, so the version chains (which scans walk) stay short
+			// the active transactions are ordered on start time, and transactions that start from now on see neither
+			vector<transaction_t> active_start_times;
+			{
+				lock_guard<mutex> active_lock(active_transactions_lock);
+				for (auto &active : active_transactions) {
+					if (active.get() != transaction) {
+						active_start_times.push_back(active->start_time);
+					}
+				}
+			}
+			if (!active_start_times.empty()) {
+				transaction->CompactUpdates(active_start_times);
+			}
+		}
+	}
 	if (!error.empty()) {
 		// commit unsuccessful: rollback the transaction instead
 		checkpoint = false;
@@ -218,18 +264,110 @@ string TransactionManager::CommitTransaction(ClientContext &context, Transaction
 
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
+	auto wal_sync_position = error.empty() ? transaction->wal_sync_position : 0;
 	RemoveTransaction(transaction);
 	// now perform a checkpoint if (1) we are able to checkpoint, and (2) the WAL has reached sufficient size to
 	// checkpoint
+	auto &storage_manager = StorageManager::GetStorageManager(db);
 	if (checkpoint) {
 		// checkpoint the database to disk
-		auto &storage_manager = StorageManager::GetStorageManager(db);
 		storage_manager.CreateCheckpoint(false, true);
+	} else if (wal_sync_position > 0) {
+		// sync the WAL after releasing the transaction lock: the transactions that commit in the meantime are made
+		// durable by the same sync (group commit)
+		lock.reset();
+		storage_manager.GetWriteAheadLog()->SyncCommit(wal_sync_position);
+		if (background_checkpoint && storage_manager.AutomaticCheckpoint(0)) {
+			ScheduleBackgroundCheckpoint();
+		}
 	}
 	return error;
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void TransactionManager::ScheduleBackgroundCheckpoint() {
+	lock_guard<mutex> guard(background_checkpoint_lock);
+	if (stop_background_checkpoint) {
+		return;
+	}
+	checkpoint_requested = true;
+	if (!background_checkpoint) {
+		background_checkpoint = make_unique<thread>([this] { BackgroundCheckpoint(); });
+	}
+	background_checkpoint_wakeup.notify_one();
+}
+
+void TransactionManager::StopBackgroundCheckpoint() {
+	unique_lock<mutex> guard(background_checkpoint_lock);
+	stop_background_checkpoint = true;
+	if (!background_checkpoint) {
+		return;
+	}
+	background_checkpoint_wakeup.notify_all();
+	guard.unlock();
+	background_checkpoint->join();
+	background_checkpoint.reset();
+}
+
+void TransactionManager::BackgroundCheckpoint() {
+	unique_lock<mutex> guard(background_checkpoint_lock);
+	while (!stop_background_checkpoint) {
+		if (!checkpoint_requested) {
+			background_checkpoint_wakeup.wait(guard);
+			continue;
+		}
+		guard.unlock();
+		bool finished = TryBackgroundCheckpoint();
+		guard.lock();
+		if (finished) {
+			checkpoint_requested = false;
+		} else {
+			// other transactions are running: retry once they had the chance to finish
+			background_checkpoint_wakeup.wait_for(guard, std::chrono::milliseconds(BACKGROUND_CHECKPOINT_RETRY_MS));
+		}
+	}
+}
+
+bool TransactionManager::TryBackgroundCheckpoint() {
+	auto &storage_manager = StorageManager::GetStorageManager(db);
+	auto lock = make_unique<lock_guard<mutex>>(transaction_lock);
+	if (thread_is_checkpointing) {
+		return false;
+	}
+	if (!storage_manager.AutomaticCheckpoint(0)) {
+		// the WAL has been checkpointed in the meantime
+		return true;
+	}
+	if (!CanCheckpoint()) {
+		return false;
+	}
+	CheckpointLock checkpoint_lock(*this);
+	checkpoint_lock.Lock();
+	// lock all the clients, so that no queries run while the checkpoint is written
+	// to avoid deadlock we release the transaction lock while locking the clients
+	lock.reset();
+	vector<ClientLockWrapper> client_locks;
+	LockClients(client_locks, nullptr);
+
+	lock = make_unique<lock_guard<mutex>>(transaction_lock);
+	if (!CanCheckpoint()) {
+		return false;
+	}
+	try {
+		storage_manager.CreateCheckpoint();
+	} catch (...) { // LCOV_EXCL_START
+		// the commits that requested the checkpoint have already succeeded: the next commit requests a new one
+	} // LCOV_EXCL_STOP
+	return true;
+}
+
 void TransactionManager::RollbackTransaction(Transaction *transaction) {
+	if (transaction->IsReadOnly()) {
+		EndReadOnlyTransaction(transaction);
+		return;
+	}
 	// obtain the transaction lock during this function
 	lock_guard<mutex> lock(transaction_lock);
 
@@ -241,41 +379,68 @@ void TransactionManager::RollbackTransaction(Transaction *transaction) {
 	RemoveTransaction(transaction);
 }
 
-void TransactionManager::RemoveTransaction(Transaction *transaction) noexcept {
+void TransactionManager::EndReadOnlyTransaction(Transaction *transaction) noexcept {
+	// the transaction lock is only required to clean up the transactions that ended before: if another thread holds
+	// it, the read-only transaction does not wait for it, and the next transaction that ends cleans up instead
+	unique_lock<mutex> lock(transaction_lock, std::try_to_lock);
+	if (lock.owns_lock()) {
+		RemoveTransaction(transaction);
+		return;
+	}
+	transaction_t lowest_active_query;
+	RemoveActiveTransaction(transaction, lowest_active_query);
+}
+
+unique_ptr<Transaction> TransactionManager::RemoveActiveTransaction(Transaction *transaction,
+                                                                    transaction_t &lowest_active_query) noexcept {
+	lock_guard<mutex> active_lock(active_transactions_lock);
 	// remove the transaction from the list of active transactions
+	// the list is ordered on start time: short-running transactions are usually found at the end
 	idx_t t_index = active_transactions.size();
-	// check for the lowest and highest start time in the list of transactions
-	transaction_t lowest_start_time = TRANSACTION_ID_START;
-	transaction_t lowest_transaction_id = MAX_TRANSACTION_ID;
-	transaction_t lowest_active_query = MAXIMUM_QUERY_ID;
-	for (idx_t i = 0; i < active_transactions.size(); i++) {
-		if (active_transactions[i].get() == transaction) {
-			t_index = i;
-		} else {
-			transaction_t active_query = active_transactions[i]->active_query;
-			lowest_start_time = MinValue(lowest_start_time, active_transactions[i]->start_time);
-			lowest_active_query = MinValue(lowest_active_query, active_query);
-			lowest_transaction_id = MinValue(lowest_transaction_id, active_transactions[i]->transaction_id);
+	while (t_index > 0) {
+		if (active_transactions[--t_index].get() == transaction) {
+			break;
 		}
 	}
-	lowest_active_start = lowest_start_time;
-	lowest_active_id = lowest_transaction_id;
+	D_ASSERT(active_transactions[t_index].get() == transaction);
+	auto current_transaction = move(active_transactions[t_index]);
+	active_transactions.erase(active_transactions.begin() + t_index);
+
+	// the lowest start time and transaction id are those of the first remaining transaction
+	if (active_transactions.empty()) {
+		lowest_active_start = TRANSACTION_ID_START;
+		lowest_active_id = MAX_TRANSACTION_ID;
+	} else {
+		lowest_active_start = active_transactions[0]->start_time;
+		lowest_active_id = active_transactions[0]->transaction_id;
+	}
+	lowest_active_query = MAXIMUM_QUERY_ID;
+	for (auto &active : active_transactions) {
+		transaction_t active_query = active->active_query;
+		lowest_active_query = MinValue(lowest_active_query, active_query);
+	}
+	return current_transaction;
+}
+
+void TransactionManager::RemoveTransaction(Transaction *transaction) noexcept {
+	transaction_t lowest_active_query;
+	auto current_transaction = RemoveActiveTransaction(transaction, lowest_active_query);
+	transaction_t lowest_start_time = lowest_active_start;
 
 	transaction_t lowest_stored_query = lowest_start_time;
-	D_ASSERT(t_index != active_transactions.size());
-	auto current_transaction = move(active_transactions[t_index]);
 	if (transaction->commit_id != 0) {
 		// the transaction was committed, add it to the list of recently
 		// committed transactions
 		recently_committed_transactions.push_back(move(current_transaction));
+	} else if (transaction->IsReadOnly()) {
+		// the transaction made no changes that other transactions could still be using: it can be destroyed directly
+		current_transaction.reset();
 	} else {
 		// the transaction was aborted, but we might still need its information
 		// add it to the set of transactions awaiting GC
 		current_transaction->highest_active_query = current_query_number;
 		old_transactions.push_back(move(current_transaction));
 	}
-	// remove the transaction from the set of currently active transactions
-	active_transactions.erase(active_transactions.begin() + t_index);
 	// traverse the recently_committed transactions to see if we can remove any
 	idx_t i = 0;
 	for (; i < recently_committed_transactions.size(); i++) {
@@ -312,8 +477,8 @@ void TransactionManager::RemoveTransaction(Transaction *transaction) noexcept {
 		                                      recently_committed_transactions.begin() + i);
 	}
 	// check if we can free the memory of any old transactions
-	i = active_transactions.empty() ? old_transactions.size() : 0;
-	for (; i < old_transactions.size(); i++) {
+	// if there are no active queries, all old transactions can be freed
+	for (i = 0; i < old_transactions.size(); i++) {
 		D_ASSERT(old_transactions[i]);
 		D_ASSERT(old_transactions[i]->highest_active_query > 0);
 		if (old_transactions[i]->highest_active_query >= lowest_active_query) {
@@ -5,10 +5,12 @@
 #include "duckdb/catalog/catalog_set.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/cleanup_state.hpp"
 #include "duckdb/transaction/commit_state.hpp"
 #include "duckdb/transaction/rollback_state.hpp"
+#include "duckdb/transaction/update_info.hpp"
 #include "duckdb/common/pair.hpp"
 
 #include <unordered_map>
@@ -130,6 +132,17 @@ void UndoBuffer::Cleanup() {
 	IterateEntries(iterator_state, [&](UndoFlags type, data_ptr_t data) { state.CleanupEntry(type, data); });
 }
 
+void UndoBuffer::CompactUpdates(const vector<transaction_t> &active_start_times) {
+	UndoBuffer::IteratorState iterator_state;
+	IterateEntries(iterator_state, [&](UndoFlags type, data_ptr_t data) {
+		if (type != UndoFlags::UPDATE_TUPLE) {
+			return;
+		}
+		auto info = (UpdateInfo *)data;
+		info->segment->CompactUpdates(info->vector_index, active_start_times);
+	});
+}
+
 void UndoBuffer::Commit(UndoBuffer::IteratorState &iterator_state, WriteAheadLog *log, transaction_t commit_id) {
 	CommitState state(context, commit_id, log);
 	if (log) {
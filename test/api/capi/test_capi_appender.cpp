@@ -524,3 +524,71 @@ TEST_CASE("Test append timestamp in C API", "[capi]") {
 	REQUIRE_NO_FAIL(*result);
 	REQUIRE(result->Fetch<string>(0, 0) == "2022-04-09 15:56:37.544");
 }
+
+TEST_CASE("Test columnar appends in C API", "[capi]") {
+	CAPITester tester;
+	unique_ptr<CAPIResult> result;
+	duckdb_state status;
+
+	// open the database in in-memory mode
+	REQUIRE(tester.OpenDatabase(nullptr));
+
+	tester.Query("CREATE TABLE test (i INTEGER, d DOUBLE, s VARCHAR)");
+	duckdb_appender appender;
+
+	status = duckdb_appender_create(tester.connection, nullptr, "test", &appender);
+	REQUIRE(status == DuckDBSuccess);
+
+	// a row appended one by one is appended before the columns
+	REQUIRE(duckdb_append_int32(appender, -1) == DuckDBSuccess);
+	REQUIRE(duckdb_append_double(appender, -1) == DuckDBSuccess);
+	REQUIRE(duckdb_append_varchar(appender, "row") == DuckDBSuccess);
+	REQUIRE(duckdb_appender_end_row(appender) == DuckDBSuccess);
+
+	// the rows span multiple vectors, every third integer is NULL
+	const idx_t count = 5000;
+	vector<int32_t> integers;
+	vector<double> doubles;
+	vector<uint64_t> validity((count + 63) / 64, ~uint64_t(0));
+	string string_data;
+	vector<uint32_t> offsets;
+	for (idx_t i = 0; i < count; i++) {
+		integers.push_back(i);
+		doubles.push_back(i / 2.0);
+		if (i % 3 == 0) {
+			validity[i / 64] &= ~(uint64_t(1) << (i % 64));
+		}
+		offsets.push_back(string_data.size());
+		string_data += i % 2 == 0 ? "short" + to_string(i) : "a string that is not inlined " + to_string(i);
+	}
+	offsets.push_back(string_data.size());
+
+	// all columns need data
+	REQUIRE(duckdb_appender_set_column(appender, 0, integers.data(), validity.data()) == DuckDBSuccess);
+	REQUIRE(duckdb_appender_append_columns(appender, count) == DuckDBError);
+	REQUIRE(duckdb_appender_error(appender) != nullptr);
+	REQUIRE(duckdb_appender_set_column(appender, 3, doubles.data(), nullptr) == DuckDBError);
+
+	REQUIRE(duckdb_appender_set_column(appender, 0, integers.data(), validity.data()) == DuckDBSuccess);
+	REQUIRE(duckdb_appender_set_column(appender, 1, doubles.data(), nullptr) == DuckDBSuccess);
+	REQUIRE(duckdb_appender_set_string_column(appender, 2, string_data.c_str(), offsets.data(), nullptr) ==
+	        DuckDBSuccess);
+	REQUIRE(duckdb_appender_append_columns(appender, count) == DuckDBSuccess);
+
+	// the column data is not reused for the next columnar append
+	REQUIRE(duckdb_appender_append_columns(appender, count) == DuckDBError);
+	REQUIRE(duckdb_appender_destroy(&appender) == DuckDBSuccess);
+
+	result = tester.Query("SELECT COUNT(*), COUNT(i), SUM(i), SUM(d), COUNT(DISTINCT s) FROM test");
+	REQUIRE_NO_FAIL(*result);
+	REQUIRE(result->Fetch<int64_t>(0, 0) == 5001);
+	REQUIRE(result->Fetch<int64_t>(1, 0) == 3334);
+	REQUIRE(result->Fetch<double>(3, 0) == 6248749.0);
+	REQUIRE(result->Fetch<int64_t>(4, 0) == 5001);
+	result = tester.Query("SELECT i, s FROM test LIMIT 3 OFFSET 1");
+	REQUIRE_NO_FAIL(*result);
+	REQUIRE(result->IsNull(0, 0));
+	REQUIRE(result->Fetch<int32_t>(0, 1) == 1);
+	REQUIRE(result->Fetch<string>(1, 0) == "short0");
+	REQUIRE(result->Fetch<string>(1, 1) == "a string that is not inlined 1");
+}
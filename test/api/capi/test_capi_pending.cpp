@@ -75,3 +75,49 @@ TEST_CASE("Test pending statements in C API", "[capi]") {
 	REQUIRE(!result->HasError());
 	REQUIRE(result->Fetch<int64_t>(0, 0) == 499999500000LL);
 }
+
+TEST_CASE("Test query progress in C API", "[capi]") {
+	CAPITester tester;
+	CAPIPrepared prepared;
+	CAPIPending pending;
+	unique_ptr<CAPIResult> result;
+
+	REQUIRE(tester.OpenDatabase(nullptr));
+	// no query is running
+	auto progress = duckdb_query_progress(tester.connection);
+	REQUIRE(progress.percentage == -1);
+
+	REQUIRE_NO_FAIL(tester.Query("PRAGMA enable_progress_bar"));
+	REQUIRE_NO_FAIL(tester.Query("PRAGMA disable_print_progress_bar"));
+	REQUIRE_NO_FAIL(tester.Query("CREATE TABLE tbl AS SELECT range i FROM range(100000)"));
+
+	REQUIRE(prepared.Prepare(tester, "SELECT COUNT(*) FROM tbl t1 JOIN tbl t2 USING (i)"));
+	REQUIRE(pending.Pending(prepared));
+	double previous_percentage = 0;
+	while (true) {
+		auto state = pending.ExecuteTask();
+		REQUIRE(state != DUCKDB_PENDING_ERROR);
+		progress = duckdb_query_progress(tester.connection);
+		REQUIRE(progress.percentage >= previous_percentage);
+		REQUIRE(progress.percentage <= 100);
+		REQUIRE(progress.rows_processed <= progress.total_rows_to_process);
+		previous_percentage = progress.percentage;
+		if (state == DUCKDB_PENDING_RESULT_READY) {
+			break;
+		}
+	}
+	// the scans of both sides of the join have produced all rows of the table
+	REQUIRE(progress.percentage == 100);
+	REQUIRE(progress.rows_processed >= 200000);
+	REQUIRE(progress.rows_processed == progress.total_rows_to_process);
+
+	result = pending.Execute();
+	REQUIRE(result);
+	REQUIRE(!result->HasError());
+	REQUIRE(result->Fetch<int64_t>(0, 0) == 100000);
+
+	// the progress is reset when the query has finished
+	progress = duckdb_query_progress(tester.connection);
+	REQUIRE(progress.percentage == -1);
+	REQUIRE(progress.rows_processed == 0);
+}
@@ -87,6 +87,35 @@ TEST_CASE("Test closing database during long running query", "[api]") {
 	REQUIRE_NO_FAIL(conn->Query("SELECT 42"));
 }
 
+static void long_running_blocking_query(Connection *conn, string query, bool *correct) {
+	*correct = true;
+	auto result = conn->Query(query);
+	// the query should fail
+	*correct = result->HasError();
+}
+
+TEST_CASE("Test interrupting long running sorts and hash join builds", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT (range * 9973) % 10000000 AS i FROM range(10000000)"));
+	con.DisableProfiling();
+
+	// the sort and the hash table are only done after all input has been consumed
+	vector<string> queries {"SELECT i FROM integers ORDER BY i OFFSET 10000000",
+	                        "SELECT COUNT(*) FROM integers i1 JOIN integers i2 USING (i)"};
+	for (auto &query : queries) {
+		bool correct = true;
+		auto background_thread = thread(long_running_blocking_query, &con, query, &correct);
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		con.Interrupt();
+		background_thread.join();
+		REQUIRE(correct);
+		// the connection can be used again
+		REQUIRE_NO_FAIL(con.Query("SELECT 42"));
+	}
+}
+
 TEST_CASE("Test closing result after database is gone", "[api]") {
 	auto db = make_unique<DuckDB>(nullptr);
 	auto conn = make_unique<Connection>(*db);
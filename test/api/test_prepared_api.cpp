@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/main/prepared_statement_cache.hpp"
 
 using namespace duckdb;
 using namespace std;
@@ -476,3 +477,136 @@ TEST_CASE("Test ambiguous prepared statement parameter types", "[api]") {
 	result = prep->Execute("hello");
 	REQUIRE(CHECK_COLUMN(result, 0, {"hello"}));
 }
+
+TEST_CASE("Test sharing prepared statements between connections", "[api]") {
+	unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+	Connection con2(db);
+
+	REQUIRE_NO_FAIL(con.Query("SET prepared_statement_cache_size=2"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE a (i INTEGER)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO a VALUES (11), (12), (13)"));
+	auto &cache = PreparedStatementCache::Get(*con.context);
+
+	auto prepare = con.Prepare("SELECT COUNT(*) FROM a WHERE i>$1");
+	REQUIRE(prepare->success);
+	REQUIRE(cache.Count() == 1);
+	auto data = prepare->data.get();
+
+	// the statement data is in use by the first prepared statement: it is not shared
+	auto prepare2 = con2.Prepare("select count(*)   FROM a -- comment\n WHERE i>$1");
+	REQUIRE(prepare2->success);
+	REQUIRE(prepare2->data.get() != data);
+	prepare2.reset();
+
+	// once it is no longer in use, the normalized statement is served from the cache
+	prepare.reset();
+	prepare2 = con2.Prepare("select count(*)   FROM a -- comment\n WHERE i>$1");
+	REQUIRE(prepare2->success);
+	REQUIRE(prepare2->data.get() == data);
+	result = prepare2->Execute(11);
+	REQUIRE(CHECK_COLUMN(result, 0, {2}));
+	// parameters of another type rebind the statement
+	result = prepare2->Execute((int64_t)12);
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	prepare2.reset();
+
+	// catalog changes invalidate the cached statements
+	REQUIRE_NO_FAIL(con.Query("ALTER TABLE a ALTER i TYPE VARCHAR"));
+	prepare = con.Prepare("SELECT COUNT(*) FROM a WHERE i>$1");
+	REQUIRE(prepare->success);
+	REQUIRE(prepare->data.get() != data);
+	result = prepare->Execute("12");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	prepare.reset();
+
+	// temporary tables can shadow the tables of cached statements
+	REQUIRE_NO_FAIL(con2.Query("CREATE TEMPORARY TABLE a AS SELECT 42 AS i"));
+	prepare2 = con2.Prepare("SELECT COUNT(*) FROM a WHERE i>$1");
+	result = prepare2->Execute(0);
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	prepare2.reset();
+	prepare = con.Prepare("SELECT COUNT(*) FROM a WHERE i>$1");
+	result = prepare->Execute("0");
+	REQUIRE(CHECK_COLUMN(result, 0, {3}));
+	prepare.reset();
+
+	// the least recently used statements are evicted
+	REQUIRE(con.Prepare("SELECT 1")->success);
+	REQUIRE(con.Prepare("SELECT 2")->success);
+	REQUIRE(con.Prepare("SELECT 3")->success);
+	REQUIRE(cache.Count() == 2);
+	REQUIRE_NO_FAIL(con.Query("SET prepared_statement_cache_size=0"));
+	REQUIRE(cache.Count() == 0);
+}
+
+TEST_CASE("Test batched execution of prepared statements", "[api]") {
+	unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER PRIMARY KEY, s VARCHAR)"));
+
+	DataChunk parameters;
+	parameters.Initialize(Allocator::DefaultAllocator(), {LogicalType::BIGINT, LogicalType::VARCHAR});
+	for (idx_t i = 0; i < 1000; i++) {
+		parameters.SetValue(0, i, Value::BIGINT(i));
+		parameters.SetValue(1, i, i % 10 == 0 ? Value() : Value("value" + to_string(i)));
+	}
+	parameters.SetCardinality(1000);
+
+	// an INSERT of a single row of values inserts all parameter sets at once
+	auto insert = con.Prepare("INSERT INTO integers VALUES ($1 + 1, $2)");
+	result = insert->ExecuteBatch(parameters);
+	REQUIRE(CHECK_COLUMN(result, 0, {1000}));
+	result = con.Query("SELECT COUNT(*), SUM(i), COUNT(s), MIN(s) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000}));
+	REQUIRE(CHECK_COLUMN(result, 1, {500500}));
+	REQUIRE(CHECK_COLUMN(result, 2, {900}));
+	REQUIRE(CHECK_COLUMN(result, 3, {"value1"}));
+
+	// other statements are executed for every parameter set, the changed rows are summed up
+	DataChunk update_parameters;
+	update_parameters.Initialize(Allocator::DefaultAllocator(), {LogicalType::VARCHAR, LogicalType::INTEGER});
+	update_parameters.SetValue(0, 0, Value("a"));
+	update_parameters.SetValue(1, 0, Value::INTEGER(1));
+	update_parameters.SetValue(0, 1, Value("b"));
+	update_parameters.SetValue(1, 1, Value::INTEGER(2));
+	update_parameters.SetValue(0, 2, Value("c"));
+	update_parameters.SetValue(1, 2, Value::INTEGER(-1));
+	update_parameters.SetCardinality(3);
+	auto update = con.Prepare("UPDATE integers SET s=$1 WHERE i=$2");
+	result = update->ExecuteBatch(update_parameters);
+	REQUIRE(CHECK_COLUMN(result, 0, {2}));
+
+	// query results are concatenated
+	DataChunk select_parameters;
+	select_parameters.Initialize(Allocator::DefaultAllocator(), {LogicalType::INTEGER});
+	select_parameters.SetValue(0, 0, Value::INTEGER(2));
+	select_parameters.SetValue(0, 1, Value::INTEGER(1));
+	select_parameters.SetValue(0, 2, Value::INTEGER(11));
+	select_parameters.SetCardinality(3);
+	auto select = con.Prepare("SELECT s FROM integers WHERE i=$1");
+	result = select->ExecuteBatch(select_parameters);
+	REQUIRE(CHECK_COLUMN(result, 0, {"b", "a", Value()}));
+
+	// the batch runs in a single transaction: a failing parameter set rolls back the entire batch
+	parameters.SetValue(0, 999, Value::BIGINT(0));
+	REQUIRE_FAIL(insert->ExecuteBatch(parameters));
+	result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000}));
+	REQUIRE_NO_FAIL(con.Query("DELETE FROM integers"));
+	for (idx_t i = 0; i < 1000; i++) {
+		parameters.SetValue(0, i, Value::BIGINT(1000 + i));
+	}
+	update_parameters.SetValue(1, 2, Value::INTEGER(1001));
+	REQUIRE_NO_FAIL(insert->ExecuteBatch(parameters));
+	auto upsert = con.Prepare("INSERT INTO integers SELECT $2, $1");
+	REQUIRE_FAIL(upsert->ExecuteBatch(update_parameters));
+	result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000}));
+
+	// the parameter columns have to match the parameters of the statement
+	REQUIRE_FAIL(insert->ExecuteBatch(select_parameters));
+}
@@ -1,5 +1,7 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/query_profiler.hpp"
 
 #include <iostream>
 
@@ -25,3 +27,26 @@ TEST_CASE("Test query profiler", "[api]") {
 	output = con.GetProfilingInformation(ProfilerPrintFormat::JSON);
 	REQUIRE(output.size() > 0);
 }
+
+TEST_CASE("Test query profiler phase timings", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	con.EnableProfiling();
+	con.context->config.emit_profiler_output = false;
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT * FROM range(100) tbl(i)"));
+	REQUIRE_NO_FAIL(con.Query("SELECT SUM(i) FROM integers WHERE i > 10"));
+
+	auto &prev_profilers = ClientData::Get(*con.context).query_profiler_history->GetPrevProfilers();
+	REQUIRE(!prev_profilers.empty());
+	set<string> phases;
+	for (auto &entry : prev_profilers.back().second->GetOrderedPhaseTimings()) {
+		REQUIRE(entry.second >= 0);
+		phases.insert(entry.first);
+	}
+	REQUIRE(phases.find("planner") != phases.end());
+	REQUIRE(phases.find("optimizer") != phases.end());
+	REQUIRE(phases.find("physical_planner") != phases.end());
+	REQUIRE(phases.find("executor_initialize") != phases.end());
+}
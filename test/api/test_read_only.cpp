@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "test_helpers.hpp"
 
 using namespace duckdb;
@@ -127,3 +128,77 @@ TEST_CASE("Test view creation using a read only database", "[readonly]") {
 
 	DeleteDatabase(dbdir);
 }
+
+TEST_CASE("Test reading a memory-mapped read only database", "[readonly]") {
+	auto dbdir = TestCreatePath("read_only_mmap_test");
+	// make sure the database does not exist
+	DeleteDatabase(dbdir);
+
+	// create the database file and initialize it with data
+	{
+		DuckDB db(dbdir);
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE t AS SELECT range AS i, range::VARCHAR AS s FROM range(1000000)"));
+	}
+
+	DBConfig readonly_config;
+	readonly_config.options.use_temporary_directory = false;
+	readonly_config.options.access_mode = AccessMode::READ_ONLY;
+	readonly_config.options.use_mmap = true;
+
+	// several read-only instances can map the same file
+	DuckDB db(dbdir, &readonly_config);
+	DuckDB db2(dbdir, &readonly_config);
+	Connection con(db);
+	Connection con2(db2);
+
+	auto result = con.Query("SELECT current_setting('use_mmap')");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BOOLEAN(true)}));
+	// use a small memory limit so blocks are evicted and loaded again from the mapped file
+	REQUIRE_NO_FAIL(con.Query("PRAGMA memory_limit='4MB'"));
+	for (idx_t i = 0; i < 2; i++) {
+		result = con.Query("SELECT SUM(i), MIN(s), MAX(s) FROM t");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(499999500000)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {"0"}));
+		REQUIRE(CHECK_COLUMN(result, 2, {"999999"}));
+	}
+	result = con2.Query("SELECT COUNT(*), SUM(i) FROM t WHERE i % 2 = 0");
+	REQUIRE(CHECK_COLUMN(result, 0, {500000}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(249999500000)}));
+	// the database can still not be modified
+	REQUIRE_FAIL(con.Query("INSERT INTO t VALUES (42, '42')"));
+}
+
+TEST_CASE("Test that memory-mapped blocks are not charged to the buffer pool", "[readonly]") {
+	auto dbdir = TestCreatePath("read_only_mmap_memory_test");
+	// make sure the database does not exist
+	DeleteDatabase(dbdir);
+
+	{
+		DuckDB db(dbdir);
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE t AS SELECT range AS i FROM range(1000000)"));
+	}
+
+	DBConfig readonly_config;
+	readonly_config.options.use_temporary_directory = false;
+	readonly_config.options.access_mode = AccessMode::READ_ONLY;
+	DuckDB db(dbdir, &readonly_config);
+	readonly_config.options.use_mmap = true;
+	DuckDB mapped_db(dbdir, &readonly_config);
+	Connection con(db);
+	Connection mapped_con(mapped_db);
+
+	// the blocks read through pread stay cached in the buffer pool of the process, the mapped blocks are shared
+	// through the OS page cache instead
+	auto result = con.Query("SELECT SUM(i) FROM t");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(499999500000)}));
+	result = mapped_con.Query("SELECT SUM(i) FROM t");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(499999500000)}));
+
+	auto used_memory = BufferManager::GetBufferManager(*db.instance).GetUsedMemory();
+	auto mapped_used_memory = BufferManager::GetBufferManager(*mapped_db.instance).GetUsedMemory();
+	REQUIRE(used_memory > 0);
+	REQUIRE(mapped_used_memory < used_memory);
+	DeleteDatabase(dbdir);
+}
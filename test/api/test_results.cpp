@@ -3,6 +3,7 @@
 #include "duckdb/common/types/date.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 
 using namespace duckdb;
 using namespace std;
@@ -201,3 +202,174 @@ TEST_CASE("Test ARRAY_AGG with ORDER BY", "[api][array_agg]") {
 	auto result = con.Query("select a, array_agg(c ORDER BY b) from t2 GROUP BY a");
 	REQUIRE(result->names[1] == "array_agg(c ORDER BY b)");
 }
+
+TEST_CASE("Test materialized results that do not fit in memory", "[api][.]") {
+	DBConfig config;
+	config.options.temporary_directory = TestCreatePath("materialized_result_tmp");
+	config.options.maximum_memory = 16 * 1024 * 1024;
+	auto db = make_unique<DuckDB>(nullptr, &config);
+	auto con = make_unique<Connection>(*db);
+
+	// the result is larger than the memory limit: it is spilled to the temporary directory
+	auto result = con->Query("SELECT range AS i, range * 2 AS j FROM range(4000000)");
+	REQUIRE_NO_FAIL(*result);
+	REQUIRE(result->RowCount() == 4000000);
+
+	// the result can be read after the connection and the database have been closed
+	con.reset();
+	db.reset();
+	int64_t sum_i = 0, sum_j = 0;
+	for (auto &chunk : result->Collection().Chunks()) {
+		auto i_data = FlatVector::GetData<int64_t>(chunk.data[0]);
+		auto j_data = FlatVector::GetData<int64_t>(chunk.data[1]);
+		for (idx_t row = 0; row < chunk.size(); row++) {
+			sum_i += i_data[row];
+			sum_j += j_data[row];
+		}
+	}
+	REQUIRE(sum_i == 7999998000000LL);
+	REQUIRE(sum_j == 2 * 7999998000000LL);
+}
+
+TEST_CASE("Test streaming results that are produced in parallel", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("SET streaming_buffer_size='100KB'"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT range AS i FROM range(1000000)"));
+
+	// the chunks are handed out in insertion order
+	auto result = con.SendQuery("SELECT i FROM integers");
+	REQUIRE_NO_FAIL(*result);
+	int64_t row_count = 0;
+	bool in_order = true;
+	while (true) {
+		auto chunk = result->Fetch();
+		if (!chunk || chunk->size() == 0) {
+			break;
+		}
+		auto data = FlatVector::GetData<int64_t>(chunk->data[0]);
+		for (idx_t row = 0; row < chunk->size(); row++) {
+			in_order = in_order && data[row] == row_count++;
+		}
+	}
+	REQUIRE(!result->HasError());
+	REQUIRE(in_order);
+	REQUIRE(row_count == 1000000);
+
+	// without insertion order the chunks are handed out as soon as they are produced
+	REQUIRE_NO_FAIL(con.Query("SET preserve_insertion_order=false"));
+	result = con.SendQuery("SELECT i FROM integers WHERE i % 2 = 0");
+	REQUIRE_NO_FAIL(*result);
+	row_count = 0;
+	int64_t sum = 0;
+	while (true) {
+		auto chunk = result->Fetch();
+		if (!chunk || chunk->size() == 0) {
+			break;
+		}
+		auto data = FlatVector::GetData<int64_t>(chunk->data[0]);
+		for (idx_t row = 0; row < chunk->size(); row++) {
+			sum += data[row];
+		}
+		row_count += chunk->size();
+	}
+	REQUIRE(!result->HasError());
+	REQUIRE(row_count == 500000);
+	REQUIRE(sum == 249999500000LL);
+	REQUIRE_NO_FAIL(con.Query("SET preserve_insertion_order=true"));
+
+	// closing the result early releases the threads that wait for the full buffer to drain
+	result = con.SendQuery("SELECT i FROM integers");
+	REQUIRE_NO_FAIL(*result);
+	auto chunk = result->Fetch();
+	REQUIRE(chunk);
+	REQUIRE(chunk->size() > 0);
+	result.reset();
+	auto count_result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(count_result, 0, {1000000}));
+
+	// errors are reported when the result is fetched
+	result = con.SendQuery("SELECT CASE WHEN i = 999999 THEN 'x' ELSE i::VARCHAR END::INTEGER FROM integers");
+	REQUIRE_NO_FAIL(*result);
+	while (true) {
+		chunk = result->Fetch();
+		if (!chunk || chunk->size() == 0) {
+			break;
+		}
+	}
+	REQUIRE(result->HasError());
+
+	// the buffer can be disabled again
+	REQUIRE_NO_FAIL(con.Query("SET streaming_buffer_size='none'"));
+	result = con.SendQuery("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+}
+
+TEST_CASE("Test query result cache", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db), con2(db);
+	auto &cache = QueryResultCache::Get(*con.context);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT * FROM range(1000) t(i)"));
+	// the cache is disabled by default
+	auto result = con.Query("SELECT SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {499500}));
+	REQUIRE(cache.Count() == 0);
+
+	REQUIRE_NO_FAIL(con.Query("SET query_result_cache_size='64MB'"));
+	result = con.Query("SELECT SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {499500}));
+	REQUIRE(cache.Count() == 1);
+	// the result is shared by all connections
+	result = con2.Query("select   SUM(i) from integers -- comment");
+	REQUIRE(CHECK_COLUMN(result, 0, {499500}));
+	REQUIRE(cache.Count() == 1);
+
+	// prepared statements are cached per parameter
+	auto prepared = con.Prepare("SELECT COUNT(*) FROM integers WHERE i < $1");
+	auto prepared_result = prepared->Execute(10);
+	REQUIRE(CHECK_COLUMN(prepared_result, 0, {10}));
+	prepared_result = prepared->Execute(20);
+	REQUIRE(CHECK_COLUMN(prepared_result, 0, {20}));
+	prepared_result = prepared->Execute(10);
+	REQUIRE(CHECK_COLUMN(prepared_result, 0, {10}));
+	REQUIRE(cache.Count() == 3);
+
+	// a commit to the table invalidates the results
+	REQUIRE_NO_FAIL(con2.Query("INSERT INTO integers VALUES (1000)"));
+	result = con.Query("SELECT SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {500500}));
+	prepared_result = prepared->Execute(2000);
+	REQUIRE(CHECK_COLUMN(prepared_result, 0, {1001}));
+
+	// a transaction that does not see the commit does not use the newer result
+	REQUIRE_NO_FAIL(con.Query("BEGIN TRANSACTION"));
+	REQUIRE_NO_FAIL(con.Query("SELECT 42"));
+	REQUIRE_NO_FAIL(con2.Query("DELETE FROM integers WHERE i=1000"));
+	result = con2.Query("SELECT SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {499500}));
+	result = con.Query("SELECT SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {500500}));
+	// neither does a transaction with local changes
+	REQUIRE_NO_FAIL(con.Query("UPDATE integers SET i=i+1 WHERE i=0"));
+	result = con.Query("SELECT SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {500501}));
+	REQUIRE_NO_FAIL(con.Query("ROLLBACK"));
+	result = con.Query("SELECT SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {499500}));
+
+	// queries with side effects are not cached
+	auto count = cache.Count();
+	REQUIRE_NO_FAIL(con.Query("SELECT random() FROM integers"));
+	REQUIRE(cache.Count() == count);
+
+	// dropping the table invalidates the results
+	REQUIRE_NO_FAIL(con.Query("DROP TABLE integers"));
+	REQUIRE_FAIL(con.Query("SELECT SUM(i) FROM integers"));
+
+	// shrinking the cache evicts the entries
+	REQUIRE_NO_FAIL(con.Query("SET query_result_cache_size='0MB'"));
+	REQUIRE(cache.Count() == 0);
+	REQUIRE(cache.SizeInBytes() == 0);
+}
@@ -0,0 +1,83 @@
+#include "catch.hpp"
+#include "duckdb/main/parallel_appender.hpp"
+#include "test_helpers.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace duckdb;
+using namespace std;
+
+#define PARALLEL_THREAD_COUNT 8
+#define PARALLEL_ROW_COUNT    100000
+
+static void parallel_append(ParallelAppender *appender, idx_t thread_idx) {
+	auto local_appender = appender->CreateLocalAppender();
+	for (idx_t i = 0; i < PARALLEL_ROW_COUNT; i++) {
+		local_appender->AppendRow(int64_t(thread_idx * PARALLEL_ROW_COUNT + i));
+	}
+}
+
+TEST_CASE("Test appending from multiple threads in a single transaction", "[appender]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	Connection con2(db);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i BIGINT PRIMARY KEY)"));
+
+	ParallelAppender appender(con, "integers");
+	thread threads[PARALLEL_THREAD_COUNT];
+	for (idx_t i = 0; i < PARALLEL_THREAD_COUNT; i++) {
+		threads[i] = thread(parallel_append, &appender, i);
+	}
+	for (idx_t i = 0; i < PARALLEL_THREAD_COUNT; i++) {
+		threads[i].join();
+	}
+	// the data is not visible before the commit
+	auto result = con2.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+	appender.Commit();
+
+	idx_t total_count = PARALLEL_THREAD_COUNT * PARALLEL_ROW_COUNT;
+	result = con2.Query("SELECT COUNT(*), SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(total_count)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(hugeint_t(total_count) * hugeint_t(total_count - 1) / 2)}));
+	// the connection can be used again
+	REQUIRE_NO_FAIL(con.Query("SELECT * FROM integers"));
+	REQUIRE_THROWS(appender.CreateLocalAppender());
+}
+
+TEST_CASE("Test parallel appender errors", "[appender]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i BIGINT PRIMARY KEY)"));
+	REQUIRE_THROWS(ParallelAppender(con, "nonexistent"));
+
+	{
+		// local appenders have to be destroyed before committing
+		ParallelAppender appender(con, "integers");
+		auto local_appender = appender.CreateLocalAppender();
+		local_appender->AppendRow(int64_t(1));
+		REQUIRE_THROWS(appender.Commit());
+		local_appender.reset();
+		appender.Commit();
+	}
+	{
+		// duplicate keys from different threads are detected when the local data is merged
+		ParallelAppender appender(con, "integers");
+		auto local_appender = appender.CreateLocalAppender();
+		auto local_appender2 = appender.CreateLocalAppender();
+		local_appender->AppendRow(int64_t(2));
+		local_appender2->AppendRow(int64_t(2));
+		local_appender.reset();
+		local_appender2.reset();
+		REQUIRE_THROWS(appender.Commit());
+	}
+	{
+		// the transaction is rolled back if the appender is not committed
+		ParallelAppender appender(con, "integers");
+		auto local_appender = appender.CreateLocalAppender();
+		local_appender->AppendRow(int64_t(3));
+	}
+	auto result = con.Query("SELECT i FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+}
@@ -11,6 +11,8 @@
 #include "duckdb/common/arrow/arrow_converter.hpp"
 #include "duckdb/common/arrow/arrow_wrapper.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/execution/operator/helper/physical_arrow_collector.hpp"
+#include "duckdb/main/arrow_query_result.hpp"
 
 using namespace duckdb;
 
@@ -222,6 +224,167 @@ TEST_CASE("Test arrow roundtrip", "[arrow]") {
 	                   "(interval (1) seconds AS interval) FROM test_all_types()");
 }
 
+static void TestZeroCopyExport(Connection &con) {
+	auto result = con.Query("SELECT i::BIGINT AS i, CASE WHEN i % 7 = 0 THEN NULL ELSE i::DOUBLE END AS d, "
+	                        "i::VARCHAR AS s FROM range(3000) tbl(i)");
+	REQUIRE_NO_FAIL(*result);
+	auto chunk = result->Fetch();
+	REQUIRE(chunk);
+	ArrowArray array;
+	ArrowConverter::ToArrowArray(*chunk, &array);
+	// the fixed-size columns point to the memory of the result, strings are copied
+	REQUIRE(array.children[0]->buffers[1] == FlatVector::GetData(chunk->data[0]));
+	REQUIRE(array.children[1]->buffers[1] == FlatVector::GetData(chunk->data[1]));
+	REQUIRE(array.children[2]->buffers[1] != FlatVector::GetData(chunk->data[2]));
+
+	// the array remains valid after the result is destroyed
+	idx_t count = chunk->size();
+	chunk.reset();
+	result.reset();
+	REQUIRE(array.length == int64_t(count));
+	REQUIRE(array.children[1]->null_count == int64_t((count + 6) / 7));
+	auto integers = (const int64_t *)array.children[0]->buffers[1];
+	auto doubles = (const double *)array.children[1]->buffers[1];
+	auto validity = (const uint8_t *)array.children[1]->buffers[0];
+	bool correct = true;
+	for (idx_t i = 0; i < count; i++) {
+		bool is_valid = validity[i / 8] & (1 << (i % 8));
+		if (integers[i] != int64_t(i) || is_valid != (i % 7 != 0) || (is_valid && doubles[i] != double(i))) {
+			correct = false;
+		}
+	}
+	array.release(&array);
+	REQUIRE(correct);
+}
+
+TEST_CASE("Test zero-copy Arrow export of fixed-size columns", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	// in-memory result collection
+	TestZeroCopyExport(con);
+	// buffer-managed result collection
+	REQUIRE_NO_FAIL(con.Query("SET temp_directory='" + TestCreatePath("zero_copy_export") + "'"));
+	TestZeroCopyExport(con);
+}
+
+static void TestArrowCollector(Connection &con, idx_t batch_size, bool ordered) {
+	ClientConfig::GetConfig(*con.context).result_collector = [batch_size](ClientContext &context,
+	                                                                      PreparedStatementData &data) {
+		return PhysicalArrowCollector::Create(context, data, batch_size);
+	};
+	auto result = con.Query("SELECT i FROM integers");
+	ClientConfig::GetConfig(*con.context).result_collector = nullptr;
+	REQUIRE_NO_FAIL(*result);
+	REQUIRE(result->type == QueryResultType::ARROW_RESULT);
+
+	idx_t total_count = 0;
+	int64_t sum = 0;
+	while (true) {
+		ArrowArray array;
+		auto count = ArrowUtil::FetchChunk(result.get(), STANDARD_VECTOR_SIZE, &array);
+		if (count == 0) {
+			break;
+		}
+		REQUIRE(count <= batch_size);
+		REQUIRE(array.n_children == 1);
+		auto data = (const int64_t *)array.children[0]->buffers[1];
+		for (idx_t i = 0; i < count; i++) {
+			if (ordered && data[i] != int64_t(total_count + i)) {
+				array.release(&array);
+				FAIL("Arrow arrays were not produced in order");
+			}
+			sum += data[i];
+		}
+		total_count += count;
+		array.release(&array);
+	}
+	REQUIRE(total_count == 1000000);
+	REQUIRE(sum == 499999500000);
+}
+
+TEST_CASE("Test parallel Arrow result collector", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT i::BIGINT AS i FROM range(1000000) tbl(i)"));
+
+	// the arrays are converted in parallel and put back in order using the batch index
+	TestArrowCollector(con, 100000, true);
+	TestArrowCollector(con, STANDARD_VECTOR_SIZE, true);
+	// with a single thread
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=1"));
+	TestArrowCollector(con, 100000, true);
+	// without preserving insertion order the arrays can be produced in any order
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("SET preserve_insertion_order=false"));
+	TestArrowCollector(con, 100000, false);
+}
+
+struct ArrowPartitionedFactory {
+	vector<unique_ptr<ArrowRoundtripFactory>> partitions;
+
+	static unique_ptr<ArrowArrayStreamWrapper> CreateStreams(uintptr_t this_ptr, ArrowStreamParameters &parameters) {
+		auto &factory = *reinterpret_cast<ArrowPartitionedFactory *>(this_ptr); //! NOLINT
+		for (auto &partition : factory.partitions) {
+			parameters.partitions.push_back(
+			    ArrowRoundtripFactory::CreateStream((uintptr_t)partition.get(), parameters));
+		}
+		return nullptr;
+	}
+
+	static void GetSchema(uintptr_t factory_ptr, duckdb::ArrowSchemaWrapper &schema) {
+		auto &factory = *reinterpret_cast<ArrowPartitionedFactory *>(factory_ptr); //! NOLINT
+		factory.partitions[0]->ToArrowSchema(&schema.arrow_schema);
+	}
+};
+
+static void TestArrowScanOrder(Connection &con, const vector<Value> &params) {
+	REQUIRE_NO_FAIL(con.Query("DROP TABLE IF EXISTS scanned"));
+	con.TableFunction("arrow_scan", params)->Create("scanned");
+	auto result = con.Query("SELECT COUNT(*), SUM(i) FROM scanned");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(499999500000)}));
+	// the rows are inserted in the order of the batch indexes
+	result = con.Query("SELECT COUNT(*) FROM (SELECT i, LAG(i) OVER () AS prev FROM scanned) WHERE i <> prev + 1");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+}
+
+TEST_CASE("Test parallel arrow scan", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	auto tz = ClientConfig::GetConfig(*con.context).ExtractTimezone();
+
+	// a single large array is converted in slices by all threads
+	auto query = "SELECT i::BIGINT AS i FROM range(1000000) tbl(i)";
+	auto single_result = con.Query(query);
+	REQUIRE_NO_FAIL(*single_result);
+	auto types = single_result->types;
+	auto names = single_result->names;
+	ArrowRoundtripFactory single_factory(types, names, tz, move(single_result), true);
+	vector<Value> params;
+	params.push_back(Value::POINTER((uintptr_t)&single_factory));
+	params.push_back(Value::POINTER((uintptr_t)&ArrowRoundtripFactory::CreateStream));
+	params.push_back(Value::POINTER((uintptr_t)&ArrowRoundtripFactory::GetSchema));
+	TestArrowScanOrder(con, params);
+
+	// partitions are read concurrently
+	ArrowPartitionedFactory partitioned_factory;
+	for (idx_t i = 0; i < 10; i++) {
+		auto partition_query = StringUtil::Format("SELECT i::BIGINT AS i FROM range(%llu, %llu) tbl(i)", i * 100000,
+		                                          (i + 1) * 100000);
+		auto partition_result = con.Query(partition_query);
+		REQUIRE_NO_FAIL(*partition_result);
+		partitioned_factory.partitions.push_back(
+		    make_unique<ArrowRoundtripFactory>(types, names, tz, move(partition_result), i % 2 == 0));
+	}
+	params.clear();
+	params.push_back(Value::POINTER((uintptr_t)&partitioned_factory));
+	params.push_back(Value::POINTER((uintptr_t)&ArrowPartitionedFactory::CreateStreams));
+	params.push_back(Value::POINTER((uintptr_t)&ArrowPartitionedFactory::GetSchema));
+	TestArrowScanOrder(con, params);
+}
+
 TEST_CASE("Test Parquet Files round-trip", "[arrow][.]") {
 	std::vector<std::string> data;
 	// data.emplace_back("data/parquet-testing/7-set.snappy.arrow2.parquet");
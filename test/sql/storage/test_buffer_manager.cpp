@@ -301,6 +301,57 @@ TEST_CASE("Test buffer manager variable size allocations", "[storage][.]") {
 	CHECK(buffer_manager.GetUsedMemory() == 0);
 }
 
+TEST_CASE("Test buffer manager pooling of variable size buffers", "[storage][.]") {
+	auto storage_database = TestCreatePath("storage_test");
+	auto config = GetTestConfig();
+	// make sure the database does not exist
+	DeleteDatabase(storage_database);
+	DuckDB db(storage_database, config.get());
+	Connection con(db);
+
+	auto &buffer_manager = BufferManager::GetBufferManager(*con.context);
+	idx_t block_size = 424242;
+	idx_t alloc_size = BufferManager::GetAllocSize(block_size);
+	REQUIRE_NO_FAIL(con.Query(StringUtil::Format("PRAGMA memory_limit='%lldB'", alloc_size * 16)));
+
+	// a destroyed variable size buffer is kept in the pool
+	shared_ptr<BlockHandle> block;
+	auto pin = buffer_manager.Allocate(block_size, true, &block);
+	auto ptr = pin.Ptr();
+	pin.Destroy();
+	block.reset();
+	CHECK(buffer_manager.GetUsedMemory() == 0);
+	CHECK(buffer_manager.GetPooledMemory() == alloc_size);
+
+	// an allocation of the same size re-uses the pooled buffer
+	pin = buffer_manager.Allocate(block_size, true, &block);
+	CHECK(pin.Ptr() == ptr);
+	CHECK(buffer_manager.GetUsedMemory() == alloc_size);
+	CHECK(buffer_manager.GetPooledMemory() == 0);
+	pin.Destroy();
+	block.reset();
+
+	// buffers of a different size are not re-used
+	pin = buffer_manager.Allocate(block_size * 2, true, &block);
+	CHECK(buffer_manager.GetPooledMemory() == alloc_size);
+	pin.Destroy();
+	block.reset();
+
+	// the pool holds at most an eighth of the memory limit
+	vector<shared_ptr<BlockHandle>> blocks;
+	for (idx_t i = 0; i < 4; i++) {
+		blocks.emplace_back();
+		buffer_manager.Allocate(block_size, true, &blocks.back());
+	}
+	blocks.clear();
+	CHECK(buffer_manager.GetPooledMemory() == 2 * alloc_size);
+
+	// under memory pressure the pool is released
+	REQUIRE_NO_FAIL(con.Query(StringUtil::Format("PRAGMA memory_limit='%lldB'", alloc_size / 2)));
+	CHECK(buffer_manager.GetPooledMemory() == 0);
+	CHECK(buffer_manager.GetUsedMemory() == 0);
+}
+
 TEST_CASE("Test buffer manager buffer re-use", "[storage][.]") {
 	auto storage_database = TestCreatePath("storage_test");
 	auto config = GetTestConfig();
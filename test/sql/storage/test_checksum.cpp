@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/storage/storage_info.hpp"
 #include "test_helpers.hpp"
 
 using namespace duckdb;
@@ -35,3 +36,48 @@ TEST_CASE("Test functioning of checksum", "[storage]") {
 
 	DeleteDatabase(storage_database);
 }
+
+TEST_CASE("Test checksums that are only verified the first time a block is read", "[storage]") {
+	unique_ptr<FileSystem> fs = FileSystem::CreateLocal();
+	auto storage_database = TestCreatePath("checksum_once_test");
+	auto config = GetTestConfig();
+
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE test AS SELECT * FROM range(1000000) t(i);"));
+	}
+	config->options.verify_checksums_once = true;
+	{
+		// blocks that are evicted and read again are not verified again
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		auto result = con.Query("SELECT current_setting('verify_checksums_once')");
+		REQUIRE(CHECK_COLUMN(result, 0, {true}));
+		REQUIRE_NO_FAIL(con.Query("PRAGMA memory_limit='2MB'"));
+		for (idx_t i = 0; i < 3; i++) {
+			result = con.Query("SELECT SUM(i) FROM test");
+			REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(499999500000)}));
+		}
+	}
+
+	// corrupt the first block of the file: this is still detected when it is read
+	auto handle = fs->OpenFile(storage_database, FileFlags::FILE_FLAGS_WRITE);
+	int8_t value = 0x22;
+	fs->Write(*handle, &value, sizeof(int8_t), Storage::FILE_HEADER_SIZE * 3 + 100);
+	handle->Sync();
+	handle.reset();
+	bool detected_corruption = false;
+	try {
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		auto result = con.Query("SELECT SUM(i) FROM test");
+		detected_corruption = result->HasError();
+	} catch (std::exception &ex) {
+		detected_corruption = true;
+	}
+	REQUIRE(detected_corruption);
+
+	DeleteDatabase(storage_database);
+}
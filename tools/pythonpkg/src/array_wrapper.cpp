@@ -9,6 +9,10 @@
 #include "duckdb_python/pyconnection.hpp"
 #include "duckdb_python/pyresult.hpp"
 #include "duckdb/common/types/uuid.hpp"
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/common/preserved_error.hpp"
+
+#include <thread>
 
 namespace duckdb {
 
@@ -283,6 +287,30 @@ double IntegralConvert::ConvertValue(hugeint_t val) {
 
 } // namespace duckdb_py_convert
 
+PyObject *PythonStringCache::GetString(string_t value) {
+	if (!enabled) {
+		return duckdb_py_convert::StringConvert::ConvertValue<string_t, PyObject *>(value);
+	}
+	auto entry = strings.find(value);
+	if (entry != strings.end()) {
+		auto result = entry->second.ptr();
+		Py_INCREF(result);
+		return result;
+	}
+	auto result = duckdb_py_convert::StringConvert::ConvertValue<string_t, PyObject *>(value);
+	if (strings.size() >= MAX_CACHED_STRINGS) {
+		// the column has many distinct values: caching does not pay off
+		enabled = false;
+		strings.clear();
+		return result;
+	}
+	if (PyUnicode_IS_COMPACT_ASCII(result)) {
+		string_t key((const char *)PyUnicode_DATA(result), value.GetSize());
+		strings[key] = py::reinterpret_borrow<py::object>(result);
+	}
+	return result;
+}
+
 template <class DUCKDB_T, class NUMPY_T, class CONVERT>
 static bool ConvertColumn(idx_t target_offset, data_ptr_t target_data, bool *target_mask, UnifiedVectorFormat &idata,
                           idx_t count) {
@@ -312,6 +340,25 @@ static bool ConvertColumn(idx_t target_offset, data_ptr_t target_data, bool *tar
 	}
 }
 
+static bool ConvertStringColumn(idx_t target_offset, data_ptr_t target_data, bool *target_mask,
+                                UnifiedVectorFormat &idata, idx_t count, PythonStringCache &cache) {
+	auto src_ptr = (string_t *)idata.data;
+	auto out_ptr = (PyObject **)target_data;
+	for (idx_t i = 0; i < count; i++) {
+		idx_t src_idx = idata.sel->get_index(i);
+		idx_t offset = target_offset + i;
+		if (!idata.validity.RowIsValid(src_idx)) {
+			target_mask[offset] = true;
+			out_ptr[offset] = nullptr;
+		} else {
+			// repeated values of columns with few distinct values share their Python string
+			out_ptr[offset] = cache.GetString(src_ptr[src_idx]);
+			target_mask[offset] = false;
+		}
+	}
+	return !idata.validity.AllValid();
+}
+
 template <class DUCKDB_T, class NUMPY_T>
 static bool ConvertColumnCategoricalTemplate(idx_t target_offset, data_ptr_t target_data, UnifiedVectorFormat &idata,
                                              idx_t count) {
@@ -599,7 +646,32 @@ void ArrayWrapper::Resize(idx_t new_capacity) {
 	mask->Resize(new_capacity);
 }
 
+bool ArrayWrapper::CreatesPythonObjects() const {
+	switch (data->type.id()) {
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIME_TZ:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::JSON:
+	case LogicalTypeId::BLOB:
+	case LogicalTypeId::LIST:
+	case LogicalTypeId::MAP:
+	case LogicalTypeId::STRUCT:
+	case LogicalTypeId::UUID:
+		return true;
+	default:
+		return false;
+	}
+}
+
 void ArrayWrapper::Append(idx_t current_offset, Vector &input, idx_t count) {
+	if (Convert(current_offset, input, count)) {
+		requires_mask = true;
+	}
+	data->count += count;
+	mask->count += count;
+}
+
+bool ArrayWrapper::Convert(idx_t current_offset, Vector &input, idx_t count) {
 	auto dataptr = data->data;
 	auto maskptr = (bool *)mask->data;
 	D_ASSERT(dataptr);
@@ -695,8 +767,7 @@ void ArrayWrapper::Append(idx_t current_offset, Vector &input, idx_t count) {
 		break;
 	case LogicalTypeId::JSON:
 	case LogicalTypeId::VARCHAR:
-		may_have_null = ConvertColumn<string_t, PyObject *, duckdb_py_convert::StringConvert>(current_offset, dataptr,
-		                                                                                      maskptr, idata, count);
+		may_have_null = ConvertStringColumn(current_offset, dataptr, maskptr, idata, count, string_cache);
 		break;
 	case LogicalTypeId::BLOB:
 		may_have_null = ConvertColumn<string_t, PyObject *, duckdb_py_convert::BlobConvert>(current_offset, dataptr,
@@ -719,11 +790,7 @@ void ArrayWrapper::Append(idx_t current_offset, Vector &input, idx_t count) {
 	default:
 		throw NotImplementedException("Unsupported type \"%s\"", input.GetType().ToString());
 	}
-	if (may_have_null) {
-		requires_mask = true;
-	}
-	data->count += count;
-	mask->count += count;
+	return may_have_null;
 }
 
 py::object ArrayWrapper::ToArray(idx_t count) const {
@@ -781,4 +848,89 @@ void NumpyResultConversion::Append(DataChunk &chunk) {
 #endif
 }
 
+void NumpyResultConversion::Append(ColumnDataCollection &collection) {
+	D_ASSERT(count == 0);
+	if (collection.Count() > capacity) {
+		Resize(collection.Count());
+	}
+	vector<column_t> parallel_columns;
+	vector<column_t> object_columns;
+	for (idx_t col_idx = 0; col_idx < owned_data.size(); col_idx++) {
+		if (owned_data[col_idx].CreatesPythonObjects()) {
+			object_columns.push_back(col_idx);
+		} else {
+			parallel_columns.push_back(col_idx);
+		}
+	}
+	if (!parallel_columns.empty()) {
+		// every chunk is converted into its own range of the preallocated arrays
+		idx_t thread_count = MinValue<idx_t>(std::thread::hardware_concurrency(), collection.ChunkCount());
+		thread_count = MaxValue<idx_t>(thread_count, 1);
+		ColumnDataParallelScanState scan_state;
+		collection.InitializeScan(scan_state, parallel_columns);
+		vector<vector<bool>> may_have_null(thread_count, vector<bool>(parallel_columns.size(), false));
+		mutex error_lock;
+		vector<PreservedError> errors;
+		auto convert_chunks = [&](idx_t thread_idx) {
+			try {
+				ColumnDataLocalScanState local_state;
+				DataChunk chunk;
+				collection.InitializeScanChunk(scan_state.scan_state, chunk);
+				while (collection.Scan(scan_state, local_state, chunk)) {
+					for (idx_t i = 0; i < parallel_columns.size(); i++) {
+						auto &array = owned_data[parallel_columns[i]];
+						if (array.Convert(local_state.current_row_index, chunk.data[i], chunk.size())) {
+							may_have_null[thread_idx][i] = true;
+						}
+					}
+				}
+			} catch (std::exception &ex) {
+				lock_guard<mutex> guard(error_lock);
+				errors.emplace_back(ex);
+			}
+		};
+		{
+			py::gil_scoped_release release;
+			vector<std::thread> threads;
+			for (idx_t thread_idx = 1; thread_idx < thread_count; thread_idx++) {
+				threads.emplace_back(convert_chunks, thread_idx);
+			}
+			convert_chunks(0);
+			for (auto &thread : threads) {
+				thread.join();
+			}
+		}
+		if (!errors.empty()) {
+			errors[0].Throw();
+		}
+		for (idx_t i = 0; i < parallel_columns.size(); i++) {
+			for (idx_t thread_idx = 0; thread_idx < thread_count; thread_idx++) {
+				if (may_have_null[thread_idx][i]) {
+					owned_data[parallel_columns[i]].requires_mask = true;
+				}
+			}
+		}
+	}
+	if (!object_columns.empty()) {
+		// Python objects can only be created while holding the GIL: convert these columns in this thread
+		ColumnDataScanState scan_state;
+		collection.InitializeScan(scan_state, object_columns);
+		DataChunk chunk;
+		collection.InitializeScanChunk(scan_state, chunk);
+		while (collection.Scan(scan_state, chunk)) {
+			for (idx_t i = 0; i < object_columns.size(); i++) {
+				auto &array = owned_data[object_columns[i]];
+				if (array.Convert(scan_state.current_row_index, chunk.data[i], chunk.size())) {
+					array.requires_mask = true;
+				}
+			}
+		}
+	}
+	count = collection.Count();
+	for (auto &data : owned_data) {
+		data.data->count = count;
+		data.mask->count = count;
+	}
+}
+
 } // namespace duckdb
@@ -55,6 +55,35 @@ py::object PythonTableArrowArrayStreamFactory::ProduceScanner(py::object &arrow_
 		}
 	}
 }
+
+bool PythonTableArrowArrayStreamFactory::ProducePartitions(py::handle &dataset, ArrowStreamParameters &parameters,
+                                                           ClientConfig &config) {
+	auto filters = parameters.filters;
+	py::list fragments;
+	if (filters && !filters->filters.empty()) {
+		// fragments that can not contain any matching rows (e.g., hive partitions) are skipped
+		auto filter = TransformFilter(*filters, parameters.projected_columns.projection_map, config);
+		fragments = py::list(dataset.attr("get_fragments")(py::arg("filter") = filter));
+	} else {
+		fragments = py::list(dataset.attr("get_fragments")());
+	}
+	if (fragments.size() < 2) {
+		return false;
+	}
+	// the fragments are scanned with the schema of the dataset, which might include partition columns
+	auto from_fragment = py::module_::import("pyarrow.dataset").attr("Scanner").attr("from_fragment");
+	auto fragment_scanner = py::module_::import("functools")
+	                            .attr("partial")(from_fragment, py::arg("schema") = dataset.attr("schema"));
+	for (auto fragment : fragments) {
+		auto scanner = ProduceScanner(fragment_scanner, fragment, parameters, config);
+		auto record_batches = scanner.attr("to_reader")();
+		auto stream = make_unique<ArrowArrayStreamWrapper>();
+		record_batches.attr("_export_to_c")((uint64_t)&stream->arrow_array_stream);
+		parameters.partitions.push_back(move(stream));
+	}
+	return true;
+}
+
 unique_ptr<ArrowArrayStreamWrapper> PythonTableArrowArrayStreamFactory::Produce(uintptr_t factory_ptr,
                                                                                 ArrowStreamParameters &parameters) {
 	py::gil_scoped_acquire acquire;
@@ -86,6 +115,10 @@ unique_ptr<ArrowArrayStreamWrapper> PythonTableArrowArrayStreamFactory::Produce(
 		break;
 	}
 	case PyArrowObjectType::Dataset: {
+		// the fragments of a dataset are read concurrently
+		if (ProducePartitions(arrow_obj_handle, parameters, factory->config)) {
+			return nullptr;
+		}
 		scanner = ProduceScanner(arrow_scanner, arrow_obj_handle, parameters, factory->config);
 		break;
 	}
@@ -10,8 +10,25 @@
 
 #include "duckdb_python/pybind_wrapper.hpp"
 #include "duckdb.hpp"
+#include "duckdb/common/string_map_set.hpp"
 
 namespace duckdb {
+class ColumnDataCollection;
+
+//! Caches the Python strings of a column with few distinct values, so every distinct value is only created once
+struct PythonStringCache {
+	//! The maximum amount of distinct strings that are cached, the cache is disabled once a column has more
+	static constexpr idx_t MAX_CACHED_STRINGS = 1024;
+
+	bool enabled = true;
+	//! The cached strings - the keys point to the (ASCII) data of the Python strings
+	string_map_t<py::object> strings;
+
+public:
+	//! Returns a new reference to a Python string of the value
+	PyObject *GetString(string_t value);
+};
+
 struct RawArrayWrapper {
 	explicit RawArrayWrapper(const LogicalType &type);
 
@@ -32,11 +49,18 @@ struct ArrayWrapper {
 	unique_ptr<RawArrayWrapper> data;
 	unique_ptr<RawArrayWrapper> mask;
 	bool requires_mask;
+	PythonStringCache string_cache;
 
 public:
 	void Initialize(idx_t capacity);
 	void Resize(idx_t new_capacity);
 	void Append(idx_t current_offset, Vector &input, idx_t count);
+	//! Converts the values into the arrays at the given offset, returns whether or not there might be NULL values
+	//! Does not change the count of the arrays, so it can be called from multiple threads for different offsets,
+	//! if the column does not create Python objects
+	bool Convert(idx_t current_offset, Vector &input, idx_t count);
+	//! Whether or not converting this column creates Python objects (and requires the GIL)
+	bool CreatesPythonObjects() const;
 	py::object ToArray(idx_t count) const;
 };
 
@@ -45,6 +69,9 @@ public:
 	NumpyResultConversion(vector<LogicalType> &types, idx_t initial_capacity);
 
 	void Append(DataChunk &chunk);
+	//! Converts a materialized result. The columns that do not create Python objects are converted in parallel,
+	//! without holding the GIL.
+	void Append(ColumnDataCollection &collection);
 
 	py::object ToArray(idx_t col_idx) {
 		return owned_data[col_idx].ToArray(count);
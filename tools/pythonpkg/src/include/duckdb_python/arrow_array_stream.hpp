@@ -75,6 +75,8 @@ private:
 
 	static py::object ProduceScanner(py::object &arrow_scanner, py::handle &arrow_obj_handle,
 	                                 ArrowStreamParameters &parameters, ClientConfig &config);
+	//! Produces a stream per fragment of a dataset, returns false if the dataset has less than two fragments
+	static bool ProducePartitions(py::handle &dataset, ArrowStreamParameters &parameters, ClientConfig &config);
 };
 } // namespace duckdb
 
@@ -31,6 +31,9 @@ public:
 	PandasScanInitLocal(ExecutionContext &context, TableFunctionInitInput &input, GlobalTableFunctionState *gstate);
 
 	static idx_t PandasScanMaxThreads(ClientContext &context, const FunctionData *bind_data_p);
+	//! The amount of rows a thread scans at a time: the rows are split evenly over all threads, in ranges of at most
+	//! PANDAS_PARTITION_COUNT rows
+	static idx_t PandasScanPartitionSize(ClientContext &context, const FunctionData *bind_data_p);
 
 	static bool PandasScanParallelStateNext(ClientContext &context, const FunctionData *bind_data_p,
 	                                        LocalTableFunctionState *lstate, GlobalTableFunctionState *gstate);
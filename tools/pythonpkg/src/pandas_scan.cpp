@@ -38,13 +38,15 @@ struct PandasScanLocalState : public LocalTableFunctionState {
 };
 
 struct PandasScanGlobalState : public GlobalTableFunctionState {
-	explicit PandasScanGlobalState(idx_t max_threads) : position(0), batch_index(0), max_threads(max_threads) {
+	PandasScanGlobalState(idx_t max_threads, idx_t partition_size)
+	    : position(0), batch_index(0), max_threads(max_threads), partition_size(partition_size) {
 	}
 
 	std::mutex lock;
 	idx_t position;
 	idx_t batch_index;
 	idx_t max_threads;
+	idx_t partition_size;
 
 	idx_t MaxThreads() const override {
 		return max_threads;
@@ -84,7 +86,8 @@ unique_ptr<FunctionData> PandasScanFunction::PandasScanBind(ClientContext &conte
 
 unique_ptr<GlobalTableFunctionState> PandasScanFunction::PandasScanInitGlobal(ClientContext &context,
                                                                               TableFunctionInitInput &input) {
-	return make_unique<PandasScanGlobalState>(PandasScanMaxThreads(context, input.bind_data));
+	return make_unique<PandasScanGlobalState>(PandasScanMaxThreads(context, input.bind_data),
+	                                          PandasScanPartitionSize(context, input.bind_data));
 }
 
 unique_ptr<LocalTableFunctionState> PandasScanFunction::PandasScanInitLocal(ExecutionContext &context,
@@ -101,7 +104,17 @@ idx_t PandasScanFunction::PandasScanMaxThreads(ClientContext &context, const Fun
 		return context.db->NumberOfThreads();
 	}
 	auto &bind_data = (const PandasScanFunctionData &)*bind_data_p;
-	return bind_data.row_count / PANDAS_PARTITION_COUNT + 1;
+	auto partition_size = PandasScanPartitionSize(context, bind_data_p);
+	return MaxValue<idx_t>((bind_data.row_count + partition_size - 1) / partition_size, 1);
+}
+
+idx_t PandasScanFunction::PandasScanPartitionSize(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = (const PandasScanFunctionData &)*bind_data_p;
+	auto thread_count = MaxValue<idx_t>(context.db->NumberOfThreads(), 1);
+	auto rows_per_thread = (bind_data.row_count + thread_count - 1) / thread_count;
+	// partitions are a multiple of the vector size, so only the last chunk of a partition can be partially filled
+	auto vectors_per_thread = MaxValue<idx_t>((rows_per_thread + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE, 1);
+	return MinValue<idx_t>(vectors_per_thread * STANDARD_VECTOR_SIZE, PANDAS_PARTITION_COUNT);
 }
 
 bool PandasScanFunction::PandasScanParallelStateNext(ClientContext &context, const FunctionData *bind_data_p,
@@ -116,7 +129,7 @@ bool PandasScanFunction::PandasScanParallelStateNext(ClientContext &context, con
 		return false;
 	}
 	state.start = parallel_state.position;
-	parallel_state.position += PANDAS_PARTITION_COUNT;
+	parallel_state.position += parallel_state.partition_size;
 	if (parallel_state.position > bind_data.row_count) {
 		parallel_state.position = bind_data.row_count;
 	}
@@ -10,6 +10,7 @@
 #include "duckdb/main/relation/view_relation.hpp"
 #include "duckdb/function/pragma/pragma_functions.hpp"
 #include "duckdb/parser/statement/pragma_statement.hpp"
+#include "duckdb/execution/operator/helper/physical_arrow_collector.hpp"
 
 namespace duckdb {
 
@@ -555,11 +556,30 @@ py::dict DuckDBPyRelation::FetchNumpy() {
 	return res->FetchNumpy();
 }
 
+//! Executes the relation, converting the result to Arrow in the threads that execute the query
+static unique_ptr<QueryResult> ExecuteToArrow(Relation &rel, idx_t batch_size) {
+	auto context = rel.context.GetContext();
+	auto &config = ClientConfig::GetConfig(*context);
+	auto previous_collector = config.result_collector;
+	config.result_collector = [batch_size](ClientContext &context, PreparedStatementData &data) {
+		return PhysicalArrowCollector::Create(context, data, batch_size);
+	};
+	unique_ptr<QueryResult> result;
+	try {
+		result = rel.Execute();
+	} catch (...) {
+		config.result_collector = previous_collector;
+		throw;
+	}
+	config.result_collector = previous_collector;
+	return result;
+}
+
 duckdb::pyarrow::Table DuckDBPyRelation::ToArrowTable(idx_t batch_size) {
 	auto res = make_unique<DuckDBPyResult>();
 	{
 		py::gil_scoped_release release;
-		res->result = rel->Execute();
+		res->result = ExecuteToArrow(*rel, batch_size);
 	}
 	if (res->result->HasError()) {
 		res->result->ThrowError();
@@ -571,7 +591,7 @@ duckdb::pyarrow::RecordBatchReader DuckDBPyRelation::ToRecordBatch(idx_t batch_s
 	auto res = make_unique<DuckDBPyResult>();
 	{
 		py::gil_scoped_release release;
-		res->result = rel->Execute();
+		res->result = ExecuteToArrow(*rel, batch_size);
 	}
 	if (res->result->HasError()) {
 		res->result->ThrowError();
@@ -303,6 +303,11 @@ void VectorConversion::NumpyToDuckDB(PandasColumnBindData &bind_data, py::array
 		auto &out_mask = FlatVector::Validity(out);
 		unique_ptr<PythonGILWrapper> gil;
 		auto &import_cache = *DuckDBPyConnection::ImportCache();
+		// if pandas is imported, values of type NAType are NULL - look the type up once instead of for every row
+		PyTypeObject *na_type = nullptr;
+		if (import_cache.pandas.libs.NAType.IsLoaded()) {
+			na_type = (PyTypeObject *)import_cache.pandas.libs.NAType().ptr();
+		}
 
 		// Loop over every row of the arrays contents
 		for (idx_t row = 0; row < count; row++) {
@@ -315,14 +320,9 @@ void VectorConversion::NumpyToDuckDB(PandasColumnBindData &bind_data, py::array
 					out_mask.SetInvalid(row);
 					continue;
 				}
-				if (import_cache.pandas.libs.NAType.IsLoaded()) {
-					// If pandas is imported, check if the type is NAType
-					auto val_type = Py_TYPE(val);
-					auto na_type = (PyTypeObject *)import_cache.pandas.libs.NAType().ptr();
-					if (val_type == na_type) {
-						out_mask.SetInvalid(row);
-						continue;
-					}
+				if (na_type && Py_TYPE(val) == na_type) {
+					out_mask.SetInvalid(row);
+					continue;
 				}
 				if (py::isinstance<py::float_>(val) && std::isnan(PyFloat_AsDouble(val))) {
 					out_mask.SetInvalid(row);
@@ -81,4 +81,26 @@ class TestArrowDataset(object):
         # turn it into an arrow table
         arrow_table_2 = pyarrow.Table.from_pandas(df)
 
-        assert arrow_table.equals(arrow_table_2)
\ No newline at end of file
+        assert arrow_table.equals(arrow_table_2)
+    def test_parallel_dataset_fragments(self, duckdb_cursor, tmp_path):
+        if not can_run:
+            return
+
+        duckdb_conn = duckdb.connect()
+        duckdb_conn.execute("PRAGMA threads=4")
+
+        # every file is a fragment of the dataset, the fragments are read concurrently
+        filenames = []
+        for i in range(8):
+            filename = str(tmp_path / ('fragment%d.parquet' % i))
+            data = pyarrow.array(np.arange(i * 100000, (i + 1) * 100000), type=pyarrow.int64())
+            pyarrow.parquet.write_table(pyarrow.Table.from_arrays([data], ['a']), filename)
+            filenames.append(filename)
+        dataset = pyarrow.dataset.dataset(filenames, format="parquet")
+
+        duckdb_conn.register("dataset", dataset)
+        assert duckdb_conn.execute("SELECT COUNT(*), SUM(a) FROM dataset").fetchone() == (800000, 319999600000)
+        assert duckdb_conn.execute("SELECT COUNT(*) FROM dataset WHERE a >= 750000").fetchone()[0] == 50000
+        # the order of the fragments is preserved
+        duckdb_conn.execute("CREATE TABLE t AS SELECT a FROM dataset")
+        assert duckdb_conn.execute("SELECT COUNT(*) FROM (SELECT a, LAG(a) OVER () AS prev FROM t) WHERE a <> prev + 1").fetchone()[0] == 0
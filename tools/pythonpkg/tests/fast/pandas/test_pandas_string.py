@@ -33,4 +33,19 @@ class TestPandasString(object):
         )
         assert con.execute(f"""
             SELECT count(*) from t1
-        """).fetchall() == [(3000000,)]
\ No newline at end of file
+        """).fetchall() == [(3000000,)]
+    def test_string_result_conversion(self, duckdb_cursor):
+        con = duckdb.connect()
+        # few distinct values, many distinct values, non-ASCII values and NULLs
+        df = con.execute("""
+            SELECT i, 'value_' || (i % 10) AS few, 'value_' || i AS many, 'mühle_' || (i % 3) AS unicode,
+                   CASE WHEN i % 7 = 0 THEN NULL ELSE 'v' END AS nulls, CASE WHEN i % 5 = 0 THEN NULL ELSE i END AS j
+            FROM range(100000) tbl(i)
+        """).df()
+        assert df['i'].tolist() == list(range(100000))
+        assert df['few'].tolist() == ['value_' + str(i % 10) for i in range(100000)]
+        assert df['many'].tolist() == ['value_' + str(i) for i in range(100000)]
+        assert df['unicode'].tolist() == ['mühle_' + str(i % 3) for i in range(100000)]
+        assert df['nulls'].isna().sum() == 14286
+        assert df['j'].isna().sum() == 20000
+        assert df['j'].sum() == sum(i for i in range(100000) if i % 5 != 0)
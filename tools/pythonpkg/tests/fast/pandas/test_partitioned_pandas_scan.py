@@ -18,3 +18,15 @@ class TestPartitionedPandasScan(object):
 
         assert seq_results[0][0] == 49999995000000
         assert parallel_results[0][0] == 49999995000000
+
+    def test_parallel_pandas_order(self, duckdb_cursor):
+        con = duckdb.connect()
+        # smaller frames are split over all threads as well
+        df = pd.DataFrame({'i': numpy.arange(300000), 's': [str(x) for x in range(300000)]})
+        con.register('df', df)
+        con.execute("PRAGMA threads=8")
+
+        assert con.execute("SELECT COUNT(*), SUM(i), SUM(s::BIGINT) FROM df").fetchall() == [(300000, 44999850000, 44999850000)]
+        result = con.execute("SELECT i, s FROM df").df()
+        assert result['i'].tolist() == df['i'].tolist()
+        assert result['s'].tolist() == df['s'].tolist()
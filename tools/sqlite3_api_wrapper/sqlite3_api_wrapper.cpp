@@ -41,7 +41,9 @@ struct sqlite3_string_buffer {
 	//! String data
 	unique_ptr<char[]> data;
 	//! String length
-	int data_len;
+	int data_len = 0;
+	//! The size of the allocated buffer
+	idx_t capacity = 0;
 };
 
 struct sqlite3_stmt {
@@ -63,6 +65,11 @@ struct sqlite3_stmt {
 	vector<string> bound_names;
 	//! The current column values converted to string, used and filled by sqlite3_column_text
 	unique_ptr<sqlite3_string_buffer[]> current_text;
+	//! The columns of the current chunk converted to VARCHAR. A column is converted as a whole vector the first time
+	//! sqlite3_column_text is called for it, instead of converting the values of the column one by one
+	DataChunk current_text_chunk;
+	//! For each column, whether or not it has been converted for the current chunk
+	vector<bool> current_text_converted;
 };
 
 void sqlite3_randomness(int N, void *pBuf) {
@@ -268,6 +275,22 @@ char *sqlite3_print_duckbox(sqlite3_stmt *pStmt, size_t max_rows, char *null_val
 	return sqlite3_strdup(result_rendering.c_str());
 }
 
+//! Marks the columns of the current chunk as not converted to VARCHAR yet
+static void sqlite3_reset_text(sqlite3_stmt *pStmt) {
+	auto column_count = pStmt->result->types.size();
+	if (column_count == 0) {
+		return;
+	}
+	if (!pStmt->current_text) {
+		pStmt->current_text = unique_ptr<sqlite3_string_buffer[]>(new sqlite3_string_buffer[column_count]);
+		vector<LogicalType> text_types(column_count, LogicalType::VARCHAR);
+		pStmt->current_text_chunk.Initialize(Allocator::DefaultAllocator(), text_types);
+	} else {
+		pStmt->current_text_chunk.Reset();
+	}
+	pStmt->current_text_converted.assign(column_count, false);
+}
+
 /* Prepare the next result to be retrieved */
 int sqlite3_step(sqlite3_stmt *pStmt) {
 	if (!pStmt) {
@@ -277,7 +300,6 @@ int sqlite3_step(sqlite3_stmt *pStmt) {
 		pStmt->db->last_error = PreservedError("Attempting sqlite3_step() on a non-successfully prepared statement");
 		return SQLITE_ERROR;
 	}
-	pStmt->current_text = nullptr;
 	if (!pStmt->result) {
 		// no result yet! call Execute()
 		pStmt->result = pStmt->prepared->Execute(pStmt->bound_values, true);
@@ -292,6 +314,7 @@ int sqlite3_step(sqlite3_stmt *pStmt) {
 			pStmt->prepared = nullptr;
 			return SQLITE_ERROR;
 		}
+		sqlite3_reset_text(pStmt);
 
 		pStmt->current_row = -1;
 
@@ -325,6 +348,7 @@ int sqlite3_step(sqlite3_stmt *pStmt) {
 			sqlite3_reset(pStmt);
 			return SQLITE_DONE;
 		}
+		sqlite3_reset_text(pStmt);
 	}
 	return SQLITE_ROW;
 }
@@ -540,27 +564,42 @@ sqlite3_int64 sqlite3_column_int64(sqlite3_stmt *stmt, int iCol) {
 	return BigIntValue::Get(val);
 }
 
+//! Copies the string into the (null-terminated) text buffer of the column, the buffer is re-used across rows
+static const char *sqlite3_set_text(sqlite3_stmt *pStmt, int iCol, const char *data, idx_t len) {
+	auto &entry = pStmt->current_text[iCol];
+	if (!entry.data || entry.capacity < len + 1) {
+		entry.capacity = NextPowerOfTwo(len + 1);
+		entry.data = unique_ptr<char[]>(new char[entry.capacity]);
+	}
+	memcpy(entry.data.get(), data, len);
+	entry.data[len] = '\0';
+	entry.data_len = len;
+	return entry.data.get();
+}
+
 const unsigned char *sqlite3_column_text(sqlite3_stmt *pStmt, int iCol) {
-	Value val;
-	if (!sqlite3_column_has_value(pStmt, iCol, LogicalType::VARCHAR, val)) {
+	if (!pStmt || !pStmt->result || !pStmt->current_chunk) {
+		return nullptr;
+	}
+	if (iCol < 0 || iCol >= (int)pStmt->result->types.size()) {
+		return nullptr;
+	}
+	auto &chunk = *pStmt->current_chunk;
+	if (FlatVector::IsNull(chunk.data[iCol], pStmt->current_row)) {
 		return nullptr;
 	}
 	try {
-		if (!pStmt->current_text) {
-			pStmt->current_text =
-			    unique_ptr<sqlite3_string_buffer[]>(new sqlite3_string_buffer[pStmt->result->types.size()]);
-		}
-		auto &entry = pStmt->current_text[iCol];
-		if (!entry.data) {
-			// not initialized yet, convert the value and initialize it
-			auto &str_val = StringValue::Get(val);
-			entry.data = unique_ptr<char[]>(new char[str_val.size() + 1]);
-			memcpy(entry.data.get(), str_val.c_str(), str_val.size() + 1);
-			entry.data_len = str_val.length();
+		if (!pStmt->current_text_converted[iCol]) {
+			// convert the entire column of the current chunk to VARCHAR at once
+			auto &text_vector = pStmt->current_text_chunk.data[iCol];
+			VectorOperations::Cast(*pStmt->db->con->context, chunk.data[iCol], text_vector, chunk.size());
+			text_vector.Flatten(chunk.size());
+			pStmt->current_text_converted[iCol] = true;
 		}
-		return (const unsigned char *)entry.data.get();
+		auto &str = FlatVector::GetData<string_t>(pStmt->current_text_chunk.data[iCol])[pStmt->current_row];
+		return (const unsigned char *)sqlite3_set_text(pStmt, iCol, str.GetDataUnsafe(), str.GetSize());
 	} catch (...) {
-		// memory error!
+		// cast or memory error!
 		return nullptr;
 	}
 }
@@ -571,19 +610,8 @@ const void *sqlite3_column_blob(sqlite3_stmt *pStmt, int iCol) {
 		return nullptr;
 	}
 	try {
-		if (!pStmt->current_text) {
-			pStmt->current_text =
-			    unique_ptr<sqlite3_string_buffer[]>(new sqlite3_string_buffer[pStmt->result->types.size()]);
-		}
-		auto &entry = pStmt->current_text[iCol];
-		if (!entry.data) {
-			// not initialized yet, convert the value and initialize it
-			auto &str_val = StringValue::Get(val);
-			entry.data = unique_ptr<char[]>(new char[str_val.size() + 1]);
-			memcpy(entry.data.get(), str_val.c_str(), str_val.size() + 1);
-			entry.data_len = str_val.length();
-		}
-		return (const unsigned char *)entry.data.get();
+		auto &str_val = StringValue::Get(val);
+		return sqlite3_set_text(pStmt, iCol, str_val.c_str(), str_val.size());
 	} catch (...) {
 		// memory error!
 		return nullptr;
@@ -1046,6 +1074,9 @@ int sqlite3_complete(const char *zSql) {
 // length of varchar or blob value
 int sqlite3_column_bytes(sqlite3_stmt *pStmt, int iCol) {
 	// fprintf(stderr, "sqlite3_column_bytes: unsupported.\n");
+	if (!pStmt || !pStmt->current_text) {
+		return 0;
+	}
 	return pStmt->current_text[iCol].data_len;
 	// return -1;
 }
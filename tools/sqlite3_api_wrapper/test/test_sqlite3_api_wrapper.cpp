@@ -321,3 +321,43 @@ TEST_CASE("Test rollback of aborted transaction", "[sqlite3wrapper]") {
 	// can start a transaction again after a rollback
 	REQUIRE(db.Execute("START TRANSACTION"));
 }
+
+TEST_CASE("Test sqlite3_column_text over multiple chunks", "[sqlite3wrapper]") {
+	SQLiteDBWrapper db;
+	SQLiteStmtWrapper stmt;
+
+	// open an in-memory db
+	REQUIRE(db.Open(":memory:"));
+	REQUIRE(stmt.Prepare(db.db,
+	                     "SELECT i, CASE WHEN i % 1000 = 999 THEN NULL ELSE repeat('a', (i % 50)::INTEGER) END, "
+	                     "i % 2 = 0 FROM range(5000) t(i)",
+	                     -1, nullptr) == SQLITE_OK);
+	// execute the statement twice, to verify that the statement can be re-used
+	for (int run = 0; run < 2; run++) {
+		int64_t row = 0;
+		while (sqlite3_step(stmt.stmt) == SQLITE_ROW) {
+			auto number = sqlite3_column_text(stmt.stmt, 0);
+			REQUIRE(number);
+			REQUIRE(string((const char *)number) == to_string(row));
+			REQUIRE(sqlite3_column_bytes(stmt.stmt, 0) == (int)to_string(row).size());
+			// other accessors can be mixed with the text accessor
+			REQUIRE(sqlite3_column_int64(stmt.stmt, 0) == row);
+
+			auto str = sqlite3_column_text(stmt.stmt, 1);
+			if (row % 1000 == 999) {
+				REQUIRE(!str);
+				REQUIRE(sqlite3_column_type(stmt.stmt, 1) == SQLITE_NULL);
+			} else {
+				REQUIRE(str);
+				REQUIRE(string((const char *)str) == string(row % 50, 'a'));
+				REQUIRE(sqlite3_column_bytes(stmt.stmt, 1) == row % 50);
+			}
+			auto boolean = sqlite3_column_text(stmt.stmt, 2);
+			REQUIRE(boolean);
+			REQUIRE(string((const char *)boolean) == (row % 2 == 0 ? "true" : "false"));
+			row++;
+		}
+		REQUIRE(row == 5000);
+		REQUIRE(sqlite3_reset(stmt.stmt) == SQLITE_OK);
+	}
+}